@@ -48,6 +48,13 @@ typedef struct {
        Type is a void* to keep the format private in codeobject.c to force
        people to go through the proper APIs. */
     void *co_extra;
+    /* For code objects loaded lazily by marshal: a memoryview holding the
+       marshalled co_code, co_consts, co_names and co_lnotab at
+       co_lazyoffset, which are NULL until _PyCode_Materialize() is called.
+       NULL for all other code objects. */
+    PyObject *co_lazybuf;
+    Py_ssize_t co_lazyoffset;
+    Py_ssize_t co_lazysize;
 } PyCodeObject;
 
 /* Masks for co_flags above */
@@ -137,6 +144,25 @@ PyAPI_FUNC(int) _PyCode_CheckLineNumber(PyCodeObject* co,
  * depending on the type and the value. The type is the first item to not
  * compare bytes and str which can raise a BytesWarning exception. */
 PyAPI_FUNC(PyObject*) _PyCode_ConstantKey(PyObject *obj);
+
+/* Create a code object whose co_code, co_consts, co_names and co_lnotab
+   are read from size bytes at offset in buffer (a memoryview) on first use.
+   For use by marshal. */
+PyAPI_FUNC(PyCodeObject *) _PyCode_NewLazy(
+        int argcount, int kwonlyargcount, int nlocals, int stacksize,
+        int flags, PyObject *varnames, PyObject *freevars,
+        PyObject *cellvars, PyObject *filename, PyObject *name,
+        int firstlineno, PyObject *buffer, Py_ssize_t offset,
+        Py_ssize_t size);
+
+/* Load co_code, co_consts, co_names and co_lnotab of a lazily loaded code
+   object.  Return 0 on success (or if co was already loaded), -1 with an
+   exception set on error.  Code which reads those fields from a code object
+   which did not come from a frame must call _PyCode_MATERIALIZE() first. */
+PyAPI_FUNC(int) _PyCode_Materialize(PyCodeObject *co);
+
+#define _PyCode_MATERIALIZE(co) \
+    ((co)->co_lazybuf == NULL ? 0 : _PyCode_Materialize(co))
 #endif
 
 PyAPI_FUNC(PyObject*) PyCode_Optimize(PyObject *code, PyObject* consts,
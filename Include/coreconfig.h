@@ -135,6 +135,8 @@ typedef struct {
     wchar_t *base_prefix;   /* sys.base_prefix */
     wchar_t *exec_prefix;   /* sys.exec_prefix */
     wchar_t *base_exec_prefix;  /* sys.base_exec_prefix */
+    wchar_t *stdlib_dir;    /* sys._stdlib_dir: directory of the standard
+                               library modules, NULL if unknown */
 #ifdef MS_WINDOWS
     wchar_t *dll_path;      /* Windows DLL path */
 #endif
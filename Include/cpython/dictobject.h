@@ -74,6 +74,7 @@ PyAPI_FUNC(int) _PyDict_SetItemId(PyObject *dp, struct _Py_Identifier *key, PyOb
 
 PyAPI_FUNC(int) _PyDict_DelItemId(PyObject *mp, struct _Py_Identifier *key);
 PyAPI_FUNC(void) _PyDict_DebugMallocStats(FILE *out);
+PyAPI_FUNC(Py_ssize_t) _PyDict_GetSplitConversions(void);
 
 int _PyObjectDict_SetItem(PyTypeObject *tp, PyObject **dictptr, PyObject *name, PyObject *value);
 PyObject *_PyDict_LoadGlobal(PyDictObject *, PyDictObject *, PyObject *);
@@ -88,6 +89,26 @@ typedef struct {
 PyAPI_FUNC(PyObject *) _PyDictView_New(PyObject *, PyTypeObject *);
 PyAPI_FUNC(PyObject *) _PyDictView_Intersect(PyObject* self, PyObject *other);
 
+/* frozendict: an immutable dict.  It has the layout of a combined dict,
+   whose keys object may be shared with the dict it was created from, plus
+   a cached hash. */
+
+typedef struct {
+    PyDictObject dict;
+    Py_hash_t hash;             /* Only used by hash(), -1 if not computed */
+} PyFrozenDictObject;
+
+PyAPI_DATA(PyTypeObject) PyFrozenDict_Type;
+PyAPI_DATA(PyTypeObject) _PyDictKeysHolder_Type;
+
+#define PyFrozenDict_CheckExact(op) (Py_TYPE(op) == &PyFrozenDict_Type)
+#define PyFrozenDict_Check(op) \
+    (PyFrozenDict_CheckExact(op) || \
+     PyType_IsSubtype(Py_TYPE(op), &PyFrozenDict_Type))
+#define PyAnyDict_Check(op) (PyDict_Check(op) || PyFrozenDict_Check(op))
+
+PyAPI_FUNC(PyObject *) PyFrozenDict_New(PyObject *);
+
 #ifdef __cplusplus
 }
 #endif
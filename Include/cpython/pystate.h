@@ -44,6 +44,9 @@ typedef struct _is {
     PyObject *sysdict;
     PyObject *builtins;
     PyObject *importlib;
+    /* Used in Python/import.c: nonzero if the frozen copies of standard
+       library modules are imported (-X frozen_modules). */
+    int frozen_stdlib;
 
     /* Used in Python/sysmodule.c. */
     int check_interval;
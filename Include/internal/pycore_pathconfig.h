@@ -27,6 +27,9 @@ typedef struct _PyPathConfig {
     wchar_t *program_full_path;
     wchar_t *prefix;
     wchar_t *exec_prefix;
+    /* Directory of the standard library modules, where the landmark
+       (os.py) was found; NULL if it was not found */
+    wchar_t *stdlib_dir;
 #ifdef MS_WINDOWS
     wchar_t *dll_path;
 #endif
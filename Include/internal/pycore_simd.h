@@ -0,0 +1,78 @@
+#ifndef Py_INTERNAL_SIMD_H
+#define Py_INTERNAL_SIMD_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if !defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_BUILTIN)
+#  error "this header requires Py_BUILD_CORE or Py_BUILD_CORE_BUILTIN define"
+#endif
+
+/* Helpers for vectorized loops over byte strings.
+
+   _Py_HAVE_SSE2 is defined when SSE2 can be used unconditionally (it is
+   part of the x86-64 baseline).
+
+   _Py_HAVE_AVX2_DISPATCH is defined when the compiler can build functions
+   for AVX2 without it being enabled for the whole file: such functions are
+   declared with _Py_TARGET_AVX2 and must only be called when
+   _Py_cpu_has_avx2() is true. */
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define _Py_HAVE_SSE2
+#  include <emmintrin.h>
+#endif
+
+#if defined(_Py_HAVE_SSE2) && (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__clang__) || \
+     (defined(__GNUC__) && (__GNUC__ > 4 || \
+                            (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+#  define _Py_HAVE_AVX2_DISPATCH
+#  include <immintrin.h>
+#  define _Py_TARGET_AVX2 __attribute__((target("avx2")))
+
+/* Return non-zero if the CPU supports AVX2 (and the OS saves the YMM
+   registers).  The result is cached after the first call. */
+static inline int
+_Py_cpu_has_avx2(void)
+{
+    static int has_avx2 = -1;
+    if (has_avx2 < 0) {
+        __builtin_cpu_init();
+        has_avx2 = __builtin_cpu_supports("avx2") ? 1 : 0;
+    }
+    return has_avx2;
+}
+#endif
+
+/* Index of the lowest set bit of a non-zero bit mask, such as the result
+   of _mm_movemask_epi8() or _mm256_movemask_epi8() */
+#if defined(__GNUC__) || defined(__clang__)
+#  define _Py_MASK_FIRST(mask) __builtin_ctz((unsigned int)(mask))
+#elif defined(_MSC_VER)
+#  include <intrin.h>
+static __inline int
+_Py_MASK_FIRST(unsigned int mask)
+{
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (int)index;
+}
+#else
+static inline int
+_Py_MASK_FIRST(unsigned int mask)
+{
+    int index = 0;
+    while (!(mask & 1)) {
+        mask >>= 1;
+        index++;
+    }
+    return index;
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* !Py_INTERNAL_SIMD_H */
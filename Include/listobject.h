@@ -65,6 +65,9 @@ PyAPI_FUNC(PyObject *) _PyList_Extend(PyListObject *, PyObject *);
 
 PyAPI_FUNC(int) PyList_ClearFreeList(void);
 PyAPI_FUNC(void) _PyList_DebugMallocStats(FILE *out);
+
+PyAPI_FUNC(int) _PyList_SetSortThreads(int);
+PyAPI_FUNC(int) _PyList_GetSortThreads(void);
 #endif
 
 /* Macro, trading safety for speed */
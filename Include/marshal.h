@@ -18,6 +18,14 @@ PyAPI_FUNC(long) PyMarshal_ReadLongFromFile(FILE *);
 PyAPI_FUNC(int) PyMarshal_ReadShortFromFile(FILE *);
 PyAPI_FUNC(PyObject *) PyMarshal_ReadObjectFromFile(FILE *);
 PyAPI_FUNC(PyObject *) PyMarshal_ReadLastObjectFromFile(FILE *);
+
+/* Read the co_code, co_consts, co_names and co_lnotab of a lazily loaded
+   code object, written by marshal version 5, from size bytes at offset in
+   buffer (a memoryview).  Nested code objects get filename as co_filename. */
+PyAPI_FUNC(int) _PyMarshal_ReadCodeBody(PyObject *buffer, Py_ssize_t offset,
+                                        Py_ssize_t size, PyObject *filename,
+                                        PyObject **code, PyObject **consts,
+                                        PyObject **names, PyObject **lnotab);
 #endif
 PyAPI_FUNC(PyObject *) PyMarshal_ReadObjectFromString(const char *,
                                                       Py_ssize_t);
@@ -82,12 +82,41 @@ whose size is determined when the object is allocated.
 #define _PyObject_EXTRA_INIT
 #endif
 
+#if defined(Py_LIMITED_API) && defined(Py_BIASED_REFCNT)
+#error Py_LIMITED_API is incompatible with Py_BIASED_REFCNT
+#endif
+
+#ifdef Py_BIASED_REFCNT
+/* Biased reference counting (experimental, see --with-biased-refcount).
+ * The thread that creates an object owns it and updates ob_ref_local.
+ * Every other thread updates a shared count kept outside the object, in a
+ * table whose entries each fill a cache line (see Objects/object.c), so
+ * that it doesn't write the cache line of the object header.  The low bit
+ * of ob_tid is set while the object has a shared count, and the object's
+ * reference count is the sum of the two.  Statically allocated objects
+ * have no owner (ob_tid is 0) and every thread updates their ob_ref_local.
+ */
+#define _PyObject_HEAD_REFCNT           \
+    uintptr_t ob_tid;                   \
+    Py_ssize_t ob_ref_local;
+
+#define _PyObject_REFCNT_INIT(refcnt) 0, refcnt,
+
+#define _Py_REF_SHARED_FLAG ((uintptr_t)1)
+
+#else
+#define _PyObject_HEAD_REFCNT           \
+    Py_ssize_t ob_refcnt;
+
+#define _PyObject_REFCNT_INIT(refcnt) refcnt,
+#endif
+
 /* PyObject_HEAD defines the initial segment of every PyObject. */
 #define PyObject_HEAD                   PyObject ob_base;
 
 #define PyObject_HEAD_INIT(type)        \
     { _PyObject_EXTRA_INIT              \
-    1, type },
+    _PyObject_REFCNT_INIT(1) type },
 
 #define PyVarObject_HEAD_INIT(type, size)       \
     { PyObject_HEAD_INIT(type) size },
@@ -108,7 +137,7 @@ whose size is determined when the object is allocated.
  */
 typedef struct _object {
     _PyObject_HEAD_EXTRA
-    Py_ssize_t ob_refcnt;
+    _PyObject_HEAD_REFCNT
     struct _typeobject *ob_type;
 } PyObject;
 
@@ -123,7 +152,77 @@ typedef struct {
 /* Cast argument to PyVarObject* type. */
 #define _PyVarObject_CAST(op) ((PyVarObject*)(op))
 
+#ifdef Py_BIASED_REFCNT
+#if !defined(__GNUC__) && !defined(__clang__)
+#error Py_BIASED_REFCNT requires GCC or clang
+#endif
+
+/* Return an identifier for the current thread that is cheap to compute.
+   It only has to be unique among the threads that are alive, and must be
+   even as the low bit of ob_tid is _Py_REF_SHARED_FLAG. */
+#if defined(__x86_64__) && defined(__linux__)
+#define _Py_INLINE_THREAD_ID
+static inline uintptr_t _Py_ThreadId(void)
+{
+    uintptr_t tid;
+    __asm__("movq %%fs:0, %0" : "=r" (tid));
+    return tid;
+}
+#elif defined(__aarch64__) && defined(__linux__)
+#define _Py_INLINE_THREAD_ID
+static inline uintptr_t _Py_ThreadId(void)
+{
+    uintptr_t tid;
+    __asm__("mrs %0, tpidr_el0" : "=r" (tid));
+    return tid;
+}
+#else
+PyAPI_FUNC(uintptr_t) _Py_ThreadId(void);
+#endif
+
+/* The shared count of an object whose ob_tid has _Py_REF_SHARED_FLAG set.
+   _Py_RefSharedAdd() adds delta to it and returns the new value, creating
+   it if the object has none; _Py_RefSharedClear() drops it.  They must be
+   called with the GIL held, which also serializes the updates. */
+PyAPI_FUNC(Py_ssize_t) _Py_RefSharedGet(const PyObject *ob);
+PyAPI_FUNC(Py_ssize_t) _Py_RefSharedAdd(PyObject *ob, Py_ssize_t delta);
+PyAPI_FUNC(void) _Py_RefSharedClear(PyObject *ob);
+
+static inline Py_ssize_t _Py_REFCNT(const PyObject *ob)
+{
+    if (ob->ob_tid & _Py_REF_SHARED_FLAG) {
+        return ob->ob_ref_local + _Py_RefSharedGet(ob);
+    }
+    return ob->ob_ref_local;
+}
+
+/* Make the current thread the owner of the object and reset its reference
+   count.  The caller must hold the GIL. */
+static inline void _Py_SetRefcnt(PyObject *ob, Py_ssize_t refcnt)
+{
+    if (ob->ob_tid & _Py_REF_SHARED_FLAG) {
+        _Py_RefSharedClear(ob);
+    }
+    ob->ob_tid = _Py_ThreadId();
+    ob->ob_ref_local = refcnt;
+}
+
+/* Same for a new object, whose header holds whatever was in the memory
+   before. */
+static inline void _Py_InitRefcnt(PyObject *ob, Py_ssize_t refcnt)
+{
+    ob->ob_tid = _Py_ThreadId();
+    ob->ob_ref_local = refcnt;
+}
+
+#define Py_REFCNT(ob)           _Py_REFCNT(_PyObject_CAST(ob))
+#define _Py_SET_REFCNT(ob, refcnt) _Py_SetRefcnt(_PyObject_CAST(ob), refcnt)
+#define _Py_INIT_REFCNT(ob, refcnt) _Py_InitRefcnt(_PyObject_CAST(ob), refcnt)
+#else
 #define Py_REFCNT(ob)           (_PyObject_CAST(ob)->ob_refcnt)
+#define _Py_SET_REFCNT(ob, refcnt) (Py_REFCNT(ob) = (refcnt))
+#define _Py_INIT_REFCNT(ob, refcnt) _Py_SET_REFCNT(ob, refcnt)
+#endif
 #define Py_TYPE(ob)             (_PyObject_CAST(ob)->ob_type)
 #define Py_SIZE(ob)             (_PyVarObject_CAST(ob)->ob_size)
 
@@ -435,7 +534,7 @@ static inline void _Py_NewReference(PyObject *op)
     }
     _Py_INC_TPALLOCS(op);
     _Py_INC_REFTOTAL;
-    Py_REFCNT(op) = 1;
+    _Py_INIT_REFCNT(op, 1);
 }
 
 static inline void _Py_ForgetReference(PyObject *op)
@@ -450,7 +549,17 @@ PyAPI_FUNC(void) _Py_Dealloc(PyObject *);
 static inline void _Py_INCREF(PyObject *op)
 {
     _Py_INC_REFTOTAL;
+#ifdef Py_BIASED_REFCNT
+    uintptr_t tid = op->ob_tid & ~_Py_REF_SHARED_FLAG;
+    if (tid == _Py_ThreadId() || tid == 0) {
+        op->ob_ref_local++;
+    }
+    else {
+        _Py_RefSharedAdd(op, 1);
+    }
+#else
     op->ob_refcnt++;
+#endif
 }
 
 #define Py_INCREF(op) _Py_INCREF(_PyObject_CAST(op))
@@ -459,9 +568,32 @@ static inline void _Py_DECREF(const char *filename, int lineno,
                               PyObject *op)
 {
     _Py_DEC_REFTOTAL;
-    if (--op->ob_refcnt != 0) {
+#ifdef Py_BIASED_REFCNT
+    /* Either count may go negative on its own (a reference taken by one
+       thread can be dropped by another), only the sum is meaningful.
+       Reference counts are still only changed with the GIL held, so the
+       sum can't change under our feet. */
+    Py_ssize_t refcnt;
+    uintptr_t tid = op->ob_tid & ~_Py_REF_SHARED_FLAG;
+    if (tid == _Py_ThreadId() || tid == 0) {
+        refcnt = --op->ob_ref_local;
+        if (op->ob_tid & _Py_REF_SHARED_FLAG) {
+            refcnt += _Py_RefSharedGet(op);
+        }
+    }
+    else {
+        refcnt = _Py_RefSharedAdd(op, -1) + op->ob_ref_local;
+    }
+    if (refcnt == 0 && (op->ob_tid & _Py_REF_SHARED_FLAG)) {
+        _Py_RefSharedClear(op);
+        op->ob_ref_local = 0;
+    }
+#else
+    Py_ssize_t refcnt = --op->ob_refcnt;
+#endif
+    if (refcnt != 0) {
 #ifdef Py_REF_DEBUG
-        if (op->ob_refcnt < 0) {
+        if (refcnt < 0) {
             _Py_NegativeRefcount(filename, lineno, op);
         }
 #endif
@@ -8,6 +8,7 @@ list, set, and tuple.
 * Counter      dict subclass for counting hashable objects
 * OrderedDict  dict subclass that remembers the order entries were added
 * defaultdict  dict subclass that calls a factory function to supply missing values
+* frozendict   immutable and hashable dict
 * UserDict     wrapper around dictionary objects for easier dict subclassing
 * UserList     wrapper around list objects for easier list subclassing
 * UserString   wrapper around string objects for easier string subclassing
@@ -15,7 +16,7 @@ list, set, and tuple.
 '''
 
 __all__ = ['deque', 'defaultdict', 'namedtuple', 'UserDict', 'UserList',
-            'UserString', 'Counter', 'OrderedDict', 'ChainMap']
+            'UserString', 'Counter', 'OrderedDict', 'ChainMap', 'frozendict']
 
 import _collections_abc
 from operator import itemgetter as _itemgetter, eq as _eq
@@ -38,6 +39,13 @@ try:
 except ImportError:
     pass
 
+try:
+    from _collections import frozendict
+except ImportError:
+    pass
+else:
+    _collections_abc.Mapping.register(frozendict)
+
 
 def __getattr__(name):
     # For backwards compatibility, continue to make the collections ABCs
@@ -541,6 +541,14 @@ class Future(object):
             self._condition.notify_all()
         self._invoke_callbacks()
 
+_PyFuture = Future
+try:
+    from _concurrent_futures import Future
+except ImportError:
+    pass
+else:
+    _CFuture = Future
+
 class Executor(object):
     """This is an abstract base class for concrete asynchronous executors."""
 
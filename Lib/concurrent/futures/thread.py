@@ -63,6 +63,22 @@ class _WorkItem(object):
             self.future.set_result(result)
 
 
+def _run_work_items(work_queue):
+    while True:
+        work_item = work_queue.get(block=True)
+        if work_item is None:
+            return
+        work_item.run()
+        # Delete references to object. See issue16284
+        del work_item
+
+
+try:
+    from _concurrent_futures import _WorkItem, _run_work_items
+except ImportError:
+    pass
+
+
 def _worker(executor_reference, work_queue, initializer, initargs):
     if initializer is not None:
         try:
@@ -75,12 +91,7 @@ def _worker(executor_reference, work_queue, initializer, initargs):
             return
     try:
         while True:
-            work_item = work_queue.get(block=True)
-            if work_item is not None:
-                work_item.run()
-                # Delete references to object. See issue16284
-                del work_item
-                continue
+            _run_work_items(work_queue)
             executor = executor_reference()
             # Exit if:
             #   - The interpreter is shutting down OR
@@ -162,14 +173,14 @@ class ThreadPoolExecutor(_base.Executor):
     submit.__doc__ = _base.Executor.submit.__doc__
 
     def _adjust_thread_count(self):
-        # When the executor gets lost, the weakref callback will wake up
-        # the worker threads.
-        def weakref_cb(_, q=self._work_queue):
-            q.put(None)
         # TODO(bquinlan): Should avoid creating new threads if there are more
         # idle threads than items in the work queue.
         num_threads = len(self._threads)
         if num_threads < self._max_workers:
+            # When the executor gets lost, the weakref callback will wake up
+            # the worker threads.
+            def weakref_cb(_, q=self._work_queue):
+                q.put(None)
             thread_name = '%s_%d' % (self._thread_name_prefix or self,
                                      num_threads)
             t = threading.Thread(name=thread_name, target=_worker,
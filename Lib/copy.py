@@ -114,6 +114,12 @@ for t in (type(None), int, float, bool, complex, str, tuple,
 t = getattr(types, "CodeType", None)
 if t is not None:
     d[t] = _copy_immutable
+try:
+    from _collections import frozendict as t
+except ImportError:
+    pass
+else:
+    d[t] = _copy_immutable
 
 d[list] = list.copy
 d[dict] = dict.copy
@@ -788,6 +788,12 @@ class FrozenImporter:
 
     _ORIGIN = "frozen"
 
+    # The source file and, for packages, the directory of the frozen copies
+    # of standard library modules, by name, or None for the modules whose
+    # source changed since they were frozen.  Set by _bootstrap_external
+    # when the copies are used (-X frozen_modules).
+    _stdlib_locations = {}
+
     @staticmethod
     def module_repr(m):
         """Return repr for the module.
@@ -799,10 +805,18 @@ class FrozenImporter:
 
     @classmethod
     def find_spec(cls, fullname, path=None, target=None):
-        if _imp.is_frozen(fullname):
-            return spec_from_loader(fullname, cls, origin=cls._ORIGIN)
-        else:
+        if not _imp.is_frozen(fullname):
+            return None
+        location = cls._stdlib_locations.get(fullname, ())
+        if location is None:
+            # The module is imported from its source instead.
             return None
+        spec = spec_from_loader(fullname, cls, origin=cls._ORIGIN)
+        if location and location[1] is not None:
+            # Submodules which are not frozen are found in the package's
+            # directory as usual.
+            spec.submodule_search_locations = [location[1]]
+        return spec
 
     @classmethod
     def find_module(cls, fullname, path=None):
@@ -811,7 +825,7 @@ class FrozenImporter:
         This method is deprecated.  Use find_spec() instead.
 
         """
-        return cls if _imp.is_frozen(fullname) else None
+        return cls if cls.find_spec(fullname) is not None else None
 
     @classmethod
     def create_module(cls, spec):
@@ -824,6 +838,10 @@ class FrozenImporter:
             raise ImportError('{!r} is not a frozen module'.format(name),
                               name=name)
         code = _call_with_frames_removed(_imp.get_frozen_object, name)
+        location = FrozenImporter._stdlib_locations.get(name)
+        if location is not None:
+            module.__file__ = location[0]
+            _imp._fix_co_filename(code, location[0])
         exec(code, module.__dict__)
 
     @classmethod
@@ -265,6 +265,7 @@ _code_type = type(_write_atomic.__code__)
 #                         this might affected the first line number #32911)
 #     Python 3.8a1  3400 (move frame block handling to compiler #17611)
 #     Python 3.8a1  3401 (add END_ASYNC_FOR #33041)
+#     Python 3.8a1  3402 (marshal version 5 for -X lazy_bytecode)
 #
 # MAGIC must change whenever the bytecode emitted by the compiler may no
 # longer be understood by older implementations of the eval loop (usually
@@ -273,7 +274,7 @@ _code_type = type(_write_atomic.__code__)
 # Whenever MAGIC_NUMBER is changed, the ranges in the magic_values array
 # in PC/launcher.c must also be updated.
 
-MAGIC_NUMBER = (3401).to_bytes(2, 'little') + b'\r\n'
+MAGIC_NUMBER = (3402).to_bytes(2, 'little') + b'\r\n'
 _RAW_MAGIC_NUMBER = int.from_bytes(MAGIC_NUMBER, 'little')  # For import.c
 
 _PYCACHE = '__pycache__'
@@ -569,9 +570,47 @@ def _validate_hash_pyc(data, source_hash, name, exc_details):
         )
 
 
+def _lazy_bytecode():
+    """Return True if bytecode files are written and read for lazy loading
+    of code objects (-X lazy_bytecode)."""
+    return 'lazy_bytecode' in sys._xoptions
+
+
+def _marshal_version():
+    """Return the marshal version to write bytecode files with."""
+    return 5 if _lazy_bytecode() else marshal.version
+
+
+_mmap = None
+
+def _map_file(path):
+    """Return a read-only memory map of the file at path, or None if mmap
+    is not available.
+
+    Code objects which are loaded lazily keep the map alive, so that only
+    the pages of the bytecode file which are used are ever read.  The map
+    does not keep a file descriptor, since every imported module may have
+    one.  On Windows, a mapped file cannot be replaced when the bytecode
+    is rewritten, so None is returned and the file is read instead.
+    """
+    global _mmap
+    if _mmap is None:
+        try:
+            if sys.platform == 'win32':
+                raise ImportError
+            import mmap as _mmap
+        except ImportError:
+            _mmap = False
+    if not _mmap:
+        return None
+    with _io.FileIO(path, 'r') as file:
+        return _mmap.mmap(file.fileno(), 0, access=_mmap.ACCESS_READ,
+                          trackfd=False)
+
+
 def _compile_bytecode(data, name=None, bytecode_path=None, source_path=None):
     """Compile bytecode as found in a pyc."""
-    code = marshal.loads(data)
+    code = marshal.loads(data, lazy=True)
     if isinstance(code, _code_type):
         _bootstrap._verbose_message('code object from {!r}', bytecode_path)
         if source_path is not None:
@@ -588,7 +627,7 @@ def _code_to_timestamp_pyc(code, mtime=0, source_size=0):
     data.extend(_pack_uint32(0))
     data.extend(_pack_uint32(mtime))
     data.extend(_pack_uint32(source_size))
-    data.extend(marshal.dumps(code))
+    data.extend(marshal.dumps(code, _marshal_version()))
     return data
 
 
@@ -599,7 +638,7 @@ def _code_to_hash_pyc(code, source_hash, checked=True):
     data.extend(_pack_uint32(flags))
     assert len(source_hash) == 8
     data.extend(source_hash)
-    data.extend(marshal.dumps(code))
+    data.extend(marshal.dumps(code, _marshal_version()))
     return data
 
 
@@ -821,6 +860,10 @@ class SourceLoader(_LoaderBasics):
         Implementing this method allows for the writing of bytecode files.
         """
 
+    def _read_bytecode(self, path):
+        """Return the contents of the bytecode file at path."""
+        return self.get_data(path)
+
 
     def get_source(self, fullname):
         """Concrete implementation of InspectLoader.get_source."""
@@ -865,7 +908,7 @@ class SourceLoader(_LoaderBasics):
             else:
                 source_mtime = int(st['mtime'])
                 try:
-                    data = self.get_data(bytecode_path)
+                    data = self._read_bytecode(bytecode_path)
                 except OSError:
                     pass
                 else:
@@ -997,6 +1040,19 @@ class SourceFileLoader(FileLoader, SourceLoader):
 
     """Concrete implementation of SourceLoader using the file system."""
 
+    def _read_bytecode(self, path):
+        """Map the bytecode file with -X lazy_bytecode, unless get_data()
+        is overridden."""
+        if _lazy_bytecode() and type(self).get_data is FileLoader.get_data:
+            try:
+                data = _map_file(path)
+            except ValueError:
+                # An empty file
+                data = None
+            if data is not None:
+                return data
+        return self.get_data(path)
+
     def path_stats(self, path):
         """Return the metadata for the path."""
         st = _path_stat(path)
@@ -1604,9 +1660,66 @@ def _setup(_bootstrap_module):
             WindowsRegistryFinder.DEBUG_BUILD = True
 
 
+def _use_frozen_stdlib():
+    """Return True if the frozen copies of standard library modules are to
+    be used (-X frozen_modules=on|off).
+
+    They are not by default when running from the build directory, so that
+    changes to the modules in Lib/ are picked up.  They are never used with
+    -O or -OO, since they are compiled without optimizations.
+
+    """
+    if sys.flags.optimize:
+        return False
+    value = sys._xoptions.get('frozen_modules')
+    if value is not None:
+        return value != 'off'
+    if not sys.executable:
+        return True
+    build_dir = _path_split(sys.executable)[0]
+    return not _path_isfile(_path_join(build_dir, 'pybuilddir.txt'))
+
+
+def _frozen_source_unchanged(name, path):
+    """Return True if the source of the frozen copy of a standard library
+    module is missing, or unchanged since the copy was made."""
+    try:
+        with _io.FileIO(path, 'r') as file:
+            data = file.read()
+    except FileNotFoundError:
+        return True
+    except OSError:
+        return False
+    source_hash = _imp.source_hash(0, data.replace(b'\r\n', b'\n'))
+    return source_hash == _imp._frozen_stdlib_source_hash(name)
+
+
+def _install_frozen_stdlib():
+    """Use the frozen copies of standard library modules whose source is
+    missing or unchanged, with the locations of their source files in the
+    standard library directory found by the path configuration."""
+    stdlib_dir = sys._stdlib_dir
+    if stdlib_dir is None:
+        return
+    _imp._use_frozen_stdlib(True)
+    locations = _bootstrap.FrozenImporter._stdlib_locations
+    for name in _imp._frozen_stdlib_names():
+        path = _path_join(stdlib_dir, *name.split('.'))
+        if _imp.is_frozen_package(name):
+            location = _path_join(path, '__init__.py'), path
+        else:
+            location = path + '.py', None
+        if _frozen_source_unchanged(name, location[0]):
+            locations[name] = location
+        else:
+            locations[name] = None
+
+
 def _install(_bootstrap_module):
     """Install the path-based import components."""
     _setup(_bootstrap_module)
     supported_loaders = _get_supported_file_loaders()
     sys.path_hooks.extend([FileFinder.path_hook(*supported_loaders)])
     sys.meta_path.append(PathFinder)
+    if _use_frozen_stdlib():
+        _install_frozen_stdlib()
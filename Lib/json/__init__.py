@@ -97,13 +97,13 @@ Using json.tool from the shell to validate and pretty-print::
 """
 __version__ = '2.0.9'
 __all__ = [
-    'dump', 'dumps', 'load', 'loads',
-    'JSONDecoder', 'JSONDecodeError', 'JSONEncoder',
+    'dump', 'dumps', 'dumpb', 'load', 'loads', 'iterload',
+    'JSONDecoder', 'JSONIncrementalDecoder', 'JSONDecodeError', 'JSONEncoder',
 ]
 
 __author__ = 'Bob Ippolito <bob@redivi.com>'
 
-from .decoder import JSONDecoder, JSONDecodeError
+from .decoder import JSONDecoder, JSONIncrementalDecoder, JSONDecodeError
 from .encoder import JSONEncoder
 import codecs
 
@@ -238,6 +238,34 @@ def dumps(obj, *, skipkeys=False, ensure_ascii=True, check_circular=True,
         **kw).encode(obj)
 
 
+def dumpb(obj, *, write=None, skipkeys=False, ensure_ascii=True,
+        check_circular=True, allow_nan=True, cls=None, indent=None,
+        separators=None, default=None, sort_keys=False, **kw):
+    """Serialize ``obj`` to JSON formatted, UTF-8 encoded ``bytes``.
+
+    The result is ``dumps(obj).encode('utf-8')``, but it is produced without
+    building the intermediate ``str``.  If ``write`` is given, it is called
+    with successive chunks of the output instead, such as the ``write()``
+    method of a binary file, a socket file or an asyncio transport, and
+    None is returned.
+
+    The other arguments have the same meaning as in ``dumps()``.
+    """
+    # cached encoder
+    if (not skipkeys and ensure_ascii and
+        check_circular and allow_nan and
+        cls is None and indent is None and separators is None and
+        default is None and not sort_keys and not kw):
+        return _default_encoder.encode_bytes(obj, write)
+    if cls is None:
+        cls = JSONEncoder
+    return cls(
+        skipkeys=skipkeys, ensure_ascii=ensure_ascii,
+        check_circular=check_circular, allow_nan=allow_nan, indent=indent,
+        separators=separators, default=default, sort_keys=sort_keys,
+        **kw).encode_bytes(obj, write)
+
+
 _default_decoder = JSONDecoder(object_hook=None, object_pairs_hook=None)
 
 
@@ -296,6 +324,41 @@ def load(fp, *, cls=None, object_hook=None, parse_float=None,
         parse_constant=parse_constant, object_pairs_hook=object_pairs_hook, **kw)
 
 
+def iterload(fp, *, array=False, cls=None, chunk_size=64 * 1024,
+        object_hook=None, parse_float=None, parse_int=None,
+        parse_constant=None, object_pairs_hook=None, **kw):
+    """Deserialize ``fp`` (a ``.read()``-supporting file-like object containing
+    a stream of JSON documents, or a JSON array if ``array`` is true) to an
+    iterator over the documents, or over the elements of the array.
+
+    ``fp`` is read ``chunk_size`` characters or bytes at a time, and the
+    values are decoded as soon as they are complete, so that the whole
+    stream is never held in memory.  Bytes are decoded as UTF-8.
+
+    The other arguments have the same meaning as for ``load()``, except that
+    a custom ``cls`` must be a ``JSONIncrementalDecoder`` subclass.
+    """
+    if cls is None:
+        cls = JSONIncrementalDecoder
+    if object_hook is not None:
+        kw['object_hook'] = object_hook
+    if object_pairs_hook is not None:
+        kw['object_pairs_hook'] = object_pairs_hook
+    if parse_float is not None:
+        kw['parse_float'] = parse_float
+    if parse_int is not None:
+        kw['parse_int'] = parse_int
+    if parse_constant is not None:
+        kw['parse_constant'] = parse_constant
+    decoder = cls(array=array, **kw)
+    while True:
+        data = fp.read(chunk_size)
+        if not data:
+            break
+        yield from decoder.feed(data)
+    yield from decoder.close()
+
+
 def loads(s, *, encoding=None, cls=None, object_hook=None, parse_float=None,
         parse_int=None, parse_constant=None, object_pairs_hook=None, **kw):
     """Deserialize ``s`` (a ``str``, ``bytes`` or ``bytearray`` instance
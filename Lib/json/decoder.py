@@ -1,5 +1,6 @@
 """Implementation of JSONDecoder
 """
+import codecs
 import re
 
 from json import scanner
@@ -7,8 +8,12 @@ try:
     from _json import scanstring as c_scanstring
 except ImportError:
     c_scanstring = None
+try:
+    from _json import make_incremental_scanner as c_make_incremental_scanner
+except ImportError:
+    c_make_incremental_scanner = None
 
-__all__ = ['JSONDecoder', 'JSONDecodeError']
+__all__ = ['JSONDecoder', 'JSONIncrementalDecoder', 'JSONDecodeError']
 
 FLAGS = re.VERBOSE | re.MULTILINE | re.DOTALL
 
@@ -354,3 +359,266 @@ class JSONDecoder(object):
         except StopIteration as err:
             raise JSONDecodeError("Expecting value", s, err.value) from None
         return obj, end
+
+
+# States of the incremental scanner in array mode
+_ARRAY_START, _ARRAY_FIRST, _ARRAY_VALUE, _ARRAY_DELIM, _ARRAY_END = range(5)
+_STRING_SPECIAL = re.compile(r'["\\]')
+
+
+class _IncrementalScanner:
+    # Python version of _json.make_incremental_scanner: each chunk of input
+    # is pre-scanned for the nesting depth of brackets and braces outside
+    # strings, to find where the values to yield end.  The values are only
+    # decoded once they are complete.
+
+    def __init__(self, context, array=False):
+        self.array = bool(array)
+        self._scan_once = scanner.py_make_scanner(context)
+        self._decoding = False      # in feed() or close(), which run hooks
+        self._reset()
+
+    def _reset(self):
+        self._started = False
+        self._in_string = self._in_escape = self._in_scalar = False
+        self._depth = 0
+        self._state = _ARRAY_START
+        self._chunks = []           # the pending input
+        self._length = 0
+        self._complete = 0          # length of its prefix of complete values
+        self._utf8 = codecs.getincrementaldecoder('utf-8')('surrogatepass')
+        # Position of the pending input in the stream, for error messages
+        self._consumed = self._lines = self._column = 0
+
+    def _fail(self, exc):
+        # Make the position of a JSONDecodeError relative to the start of
+        # the stream rather than to the pending input.
+        if isinstance(exc, JSONDecodeError) and self._consumed:
+            if exc.lineno == 1:
+                exc.colno += self._column
+            exc.lineno += self._lines
+            exc.pos += self._consumed
+            exc.args = ('%s: line %d column %d (char %d)' %
+                        (exc.msg, exc.lineno, exc.colno, exc.pos),)
+        self._reset()
+
+    def _prescan(self, s):
+        base = self.array           # depth of the values to yield
+        depth = self._depth
+        in_string = self._in_string
+        in_escape = self._in_escape
+        in_scalar = self._in_scalar
+        complete = -1
+        i = 0
+        n = len(s)
+        while i < n:
+            if in_string:
+                if in_escape:
+                    in_escape = False
+                    i += 1
+                    continue
+                m = _STRING_SPECIAL.search(s, i)
+                if m is None:
+                    break
+                i = m.start()
+                if s[i] == '\\':
+                    in_escape = True
+                else:
+                    in_string = False
+                    if depth <= base:
+                        complete = i + 1
+                i += 1
+                continue
+            c = s[i]
+            if c in '{[':
+                depth += 1
+            elif c in '}]':
+                if depth:
+                    depth -= 1
+            elif c not in '",: \t\n\r':
+                # A number or a name only ends at the next character which
+                # cannot be part of it, or at the end of the stream.
+                if depth <= base:
+                    in_scalar = True
+                i += 1
+                continue
+            if in_scalar:
+                in_scalar = False
+                complete = i
+            if c == '"':
+                in_string = True
+            elif depth <= base:
+                complete = i + 1
+            i += 1
+        self._depth = depth
+        self._in_string = in_string
+        self._in_escape = in_escape
+        self._in_scalar = in_scalar
+        if complete >= 0:
+            self._complete = self._length + complete
+
+    def _add(self, s, from_bytes):
+        if not s:
+            return
+        if not self._started:
+            self._started = True
+            # Skip a byte order mark at the start of UTF-8 input
+            if from_bytes and s.startswith('\ufeff'):
+                s = s[1:]
+        self._prescan(s)
+        self._length += len(s)
+        self._chunks.append(s)
+
+    def _parse(self, _w=WHITESPACE.match):
+        values = []
+        complete = self._complete
+        if not complete:
+            return values
+        s = ''.join(self._chunks)
+        idx = 0
+        while True:
+            idx = _w(s, idx, complete).end()
+            if idx >= complete:
+                break
+            if self.array:
+                state = self._state
+                c = s[idx]
+                if state == _ARRAY_START:
+                    if c != '[':
+                        raise JSONDecodeError("Expecting '['", s, idx)
+                    self._state = _ARRAY_FIRST
+                    idx += 1
+                    continue
+                elif state == _ARRAY_FIRST and c == ']':
+                    self._state = _ARRAY_END
+                    idx += 1
+                    continue
+                elif state == _ARRAY_DELIM:
+                    if c == ',':
+                        self._state = _ARRAY_VALUE
+                    elif c == ']':
+                        self._state = _ARRAY_END
+                    else:
+                        raise JSONDecodeError("Expecting ',' delimiter", s, idx)
+                    idx += 1
+                    continue
+                elif state == _ARRAY_END:
+                    raise JSONDecodeError("Extra data", s, idx)
+            try:
+                value, idx = self._scan_once(s, idx)
+            except StopIteration as err:
+                raise JSONDecodeError("Expecting value", s, err.value) from None
+            values.append(value)
+            if self.array:
+                self._state = _ARRAY_DELIM
+
+        # Discard the decoded input
+        lines = s.count('\n', 0, idx)
+        if lines:
+            self._lines += lines
+            self._column = idx - s.rfind('\n', 0, idx) - 1
+        else:
+            self._column += idx
+        self._consumed += idx
+        self._length -= idx
+        self._complete = max(complete - idx, 0)
+        self._chunks = [s[idx:]] if self._length else []
+        return values
+
+    def _check_not_decoding(self, method):
+        # A hook called by feed() or close() must not modify the pending
+        # input, which they are decoding.
+        if self._decoding:
+            raise RuntimeError(f'{method}() called while feed() or close() '
+                               f'is decoding')
+
+    def feed(self, data):
+        self._check_not_decoding('feed')
+        if not isinstance(data, str):
+            try:
+                data = memoryview(data)
+            except TypeError:
+                raise TypeError(f'data must be str or a bytes-like object, '
+                                f'not {data.__class__.__name__}') from None
+        self._decoding = True
+        try:
+            if isinstance(data, str):
+                self._add(data, False)
+            else:
+                self._add(self._utf8.decode(data), True)
+            return self._parse()
+        except BaseException as exc:
+            self._fail(exc)
+            raise
+        finally:
+            self._decoding = False
+
+    def close(self):
+        self._check_not_decoding('close')
+        self._decoding = True
+        try:
+            self._utf8.decode(b'', True)
+            self._complete = self._length
+            values = self._parse()
+            if self.array and self._state != _ARRAY_END:
+                if self._state == _ARRAY_DELIM:
+                    msg = "Expecting ',' delimiter"
+                else:
+                    msg = "Expecting value"
+                s = ''.join(self._chunks)
+                raise JSONDecodeError(msg, s, len(s))
+        except BaseException as exc:
+            self._fail(exc)
+            raise
+        finally:
+            self._decoding = False
+        self._reset()
+        return values
+
+
+def py_make_incremental_scanner(context, array=False):
+    return _IncrementalScanner(context, array)
+
+make_incremental_scanner = (c_make_incremental_scanner or
+                            py_make_incremental_scanner)
+
+
+class JSONIncrementalDecoder(JSONDecoder):
+    """Incremental JSON decoder
+
+    Decodes a stream of JSON documents, separated by whitespace or not, or
+    the elements of a single top-level array, which is received in chunks
+    of any size, for instance from a socket.  The values are returned as
+    soon as they are complete, and only the incomplete end of the input is
+    kept, so that a large array can be decoded element by element without
+    holding the whole document in memory.
+    """
+
+    def __init__(self, *, array=False, **kw):
+        """If ``array`` is true, the input must be a single JSON array, and
+        its elements are returned rather than the array.
+
+        The other keyword arguments have the same meaning as for
+        ``JSONDecoder``.
+        """
+        super().__init__(**kw)
+        self.array = array
+        self.scan_incremental = make_incremental_scanner(self, array)
+
+    def feed(self, data):
+        """Decode the next chunk of input, a ``str`` or UTF-8 encoded
+        bytes-like object, and return the list of the values completed by
+        it.
+
+        If an error is raised, the pending input is discarded.
+        """
+        return self.scan_incremental.feed(data)
+
+    def close(self):
+        """Signal the end of the input, and return the list of the values
+        completed by it.  Raise a ``JSONDecodeError`` if the input is
+        truncated.
+
+        The decoder is reset and can be used to decode a new stream.
+        """
+        return self.scan_incremental.close()
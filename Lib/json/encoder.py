@@ -33,6 +33,9 @@ for i in range(0x20):
 
 INFINITY = float('inf')
 
+# Size of the chunks of output passed to write() by JSONEncoder.encode_bytes()
+WRITE_CHUNK_SIZE = 64 * 1024
+
 def py_encode_basestring(s):
     """Return a JSON representation of a Python string
 
@@ -201,6 +204,56 @@ class JSONEncoder(object):
             chunks = list(chunks)
         return ''.join(chunks)
 
+    def encode_bytes(self, o, write=None):
+        """Return a JSON representation of a Python data structure as UTF-8
+        encoded bytes.
+
+        If ``write`` is given, it is called with successive chunks of the
+        output instead, and None is returned.  It can be the ``write()``
+        method of a binary file or of a transport.
+
+        >>> from json.encoder import JSONEncoder
+        >>> JSONEncoder().encode_bytes({"foo": ["bar", "baz"]})
+        b'{"foo": ["bar", "baz"]}'
+
+        """
+        if (c_make_encoder is not None and self.indent is None and
+                type(self).encode is JSONEncoder.encode and
+                type(self).iterencode is JSONEncoder.iterencode):
+            # The C encoder writes the UTF-8 output directly, rather than
+            # joining str chunks and encoding the result.  It is only used
+            # when the output would be the same as that of encode().
+            if self.check_circular:
+                markers = {}
+            else:
+                markers = None
+            if self.ensure_ascii:
+                _encoder = encode_basestring_ascii
+            else:
+                _encoder = encode_basestring
+            _iterencode = c_make_encoder(
+                markers, self.default, _encoder, self.indent,
+                self.key_separator, self.item_separator, self.sort_keys,
+                self.skipkeys, self.allow_nan)
+            return _iterencode.encode_bytes(o, write)
+        if write is None or type(self).encode is not JSONEncoder.encode:
+            data = self.encode(o).encode('utf-8')
+            if write is None:
+                return data
+            write(data)
+            return None
+        chunks = []
+        size = 0
+        for chunk in self.iterencode(o):
+            chunks.append(chunk)
+            size += len(chunk)
+            if size >= WRITE_CHUNK_SIZE:
+                write(''.join(chunks).encode('utf-8'))
+                chunks.clear()
+                size = 0
+        if chunks:
+            write(''.join(chunks).encode('utf-8'))
+
     def iterencode(self, o, _one_shot=False):
         """Encode the given object and yield each string
         representation as available.
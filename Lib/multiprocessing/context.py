@@ -111,6 +111,13 @@ class BaseContext(object):
         from .queues import SimpleQueue
         return SimpleQueue(ctx=self.get_context())
 
+    def SharedMemoryQueue(self, maxsize=0, *, capacity=64*1024*1024,
+                          threshold=64*1024):
+        '''Returns a queue object passing large payloads in shared memory'''
+        from .queues import SharedMemoryQueue
+        return SharedMemoryQueue(maxsize, ctx=self.get_context(),
+                                 capacity=capacity, threshold=threshold)
+
     def Pool(self, processes=None, initializer=None, initargs=(),
              maxtasksperchild=None):
         '''Returns a process pool object'''
@@ -118,6 +125,14 @@ class BaseContext(object):
         return Pool(processes, initializer, initargs, maxtasksperchild,
                     context=self.get_context())
 
+    def WorkStealingPool(self, processes=None, initializer=None, initargs=(),
+                         maxtasksperchild=None, prefetch=2, chunk_time=0.01):
+        '''Returns a process pool object with per-worker task queues'''
+        from .pool import WorkStealingPool
+        return WorkStealingPool(processes, initializer, initargs,
+                                maxtasksperchild, context=self.get_context(),
+                                prefetch=prefetch, chunk_time=chunk_time)
+
     def RawValue(self, typecode_or_type, *args):
         '''Returns a shared object'''
         from .sharedctypes import RawValue
@@ -7,7 +7,7 @@
 # Licensed to PSF under a Contributor Agreement.
 #
 
-__all__ = ['Pool', 'ThreadPool']
+__all__ = ['Pool', 'ThreadPool', 'WorkStealingPool']
 
 #
 # Imports
@@ -766,6 +766,68 @@ class MapResult(ApplyResult):
                 self._event.set()
                 self._pool = None
 
+#
+# Class whose instances are returned by `WorkStealingPool.map_async()`
+#
+
+class AdaptiveMapResult(MapResult):
+    '''
+    MapResult for chunks of varying size.  Chunks are identified by the pair
+    (start, count) and the time they take is used to size the next ones.
+    '''
+
+    def __init__(self, pool, length, callback, error_callback):
+        MapResult.__init__(self, pool, 1 if length else 0, length, callback,
+                           error_callback=error_callback)
+        self._length = length
+        self._processes = pool._processes
+        self._chunk_time = pool._chunk_time
+        self._item_time = None
+
+    def _record_time(self, i, elapsed):
+        item_time = elapsed / i[1]
+        if self._item_time is None:
+            self._item_time = item_time
+        else:
+            self._item_time += (item_time - self._item_time) / 4
+
+    def _next_chunksize(self, start):
+        # Probe with single items until a chunk has been timed, then aim at
+        # chunk_time per chunk but leave at least two chunks per worker for
+        # the remaining items so that the tail can still be balanced.
+        if self._item_time is None:
+            return 1
+        remaining = self._length - start
+        limit = -(-remaining // (2 * self._processes))
+        if self._item_time > 0:
+            limit = min(limit, int(self._chunk_time / self._item_time))
+        return max(1, limit)
+
+    def _set(self, i, success_result):
+        start, count = i
+        self._number_left -= count
+        success, result = success_result
+        if success and self._success:
+            self._value[start:start+count] = result
+            if self._number_left == 0:
+                if self._callback:
+                    self._callback(self._value)
+                del self._cache[self._job]
+                self._event.set()
+                self._pool = None
+        else:
+            if not success and self._success:
+                # only store first exception
+                self._success = False
+                self._value = result
+            if self._number_left == 0:
+                # only consider the result ready once all jobs are done
+                if self._error_callback:
+                    self._error_callback(self._value)
+                del self._cache[self._job]
+                self._event.set()
+                self._pool = None
+
 #
 # Class whose instances are returned by `Pool.imap()`
 #
@@ -881,3 +943,467 @@ class ThreadPool(Pool):
             pass
         for i in range(size):
             inqueue.put(None)
+
+#
+# Pool whose workers each have their own deque of tasks
+#
+
+class _WorkerSlot(object):
+    __slots__ = ('process', 'inqueue', 'tasks', 'inflight', 'sent',
+                 'last_done')
+
+    def __init__(self, process, inqueue):
+        self.process = process
+        self.inqueue = inqueue
+        self.tasks = collections.deque()        # assigned, not yet sent
+        self.inflight = collections.OrderedDict()   # (job, i) -> (task, time)
+        self.sent = 0
+        self.last_done = 0.0
+
+
+class _StealingScheduler(object):
+    '''
+    Task deques of a WorkStealingPool, one per worker process.
+
+    The deques live in the parent process and are protected by a single
+    condition.  A task is only written to a worker's pipe once the worker
+    has fewer than `prefetch` tasks in flight; until then it can be stolen
+    by a worker that ran out of work.  The scheduler also stands in for the
+    pool's task queue: `put()` accepts the same (taskseq, set_length) pairs.
+    '''
+
+    def __init__(self, pool, cache, ctx, Process, outqueue, processes,
+                 prefetch, maxtasks, initializer, initargs, wrap_exception):
+        self._pool = pool
+        self._cache = cache
+        self._ctx = ctx
+        self._Process = Process
+        self._outqueue = outqueue
+        self._recv = outqueue._reader.recv
+        self._worker_args = (initializer, initargs, maxtasks, wrap_exception)
+        self._prefetch = prefetch
+        self._maxtasks = maxtasks
+        self._high_water = processes * prefetch
+        self._cond = threading.Condition(threading.Lock())
+        self._workers = []
+        self._owners = {}       # (job, i) -> _WorkerSlot
+        self._taskseqs = collections.deque()
+        self._queued = 0
+        self._next = 0
+        self._closed = False
+        self.steals = 0
+
+    def start_worker(self):
+        inqueue = self._ctx.SimpleQueue()
+        w = self._Process(self._ctx, target=worker,
+                          args=(inqueue, self._outqueue) + self._worker_args)
+        w.name = w.name.replace('Process', 'PoolWorker')
+        w.daemon = True
+        w.start()
+        util.debug('added worker')
+        return w, inqueue
+
+    def add_worker(self, process, inqueue):
+        with self._cond:
+            self._workers.append(_WorkerSlot(process, inqueue))
+            self._cond.notify()
+
+    def put(self, item):
+        with self._cond:
+            if item is None:
+                self._closed = True
+            else:
+                self._taskseqs.append(item)
+            self._cond.notify()
+
+    def wakeup(self):
+        with self._cond:
+            self._cond.notify()
+
+    def get(self):
+        '''Return the next result from the workers, like outqueue.get().'''
+        while True:
+            task = self._recv()
+            if task is None or self._task_done(task[0], task[1]):
+                return task
+            util.debug('dropping result of a task that was run twice')
+
+    def _task_done(self, job, i):
+        now = time.monotonic()
+        with self._cond:
+            slot = self._owners.pop((job, i), None)
+            if slot is None:
+                return False
+            task, sent_time = slot.inflight.pop((job, i))
+            elapsed = now - max(sent_time, slot.last_done)
+            slot.last_done = now
+            self._cond.notify()
+        result = self._cache.get(job)
+        if isinstance(result, AdaptiveMapResult):
+            result._record_time(i, elapsed)
+        return True
+
+    def _queue_tasks(self, tasks):
+        # Deal the tasks out round-robin; stealing evens out the rest.
+        workers = self._workers
+        n = len(workers)
+        for task in tasks:
+            self._next = (self._next + 1) % n
+            workers[self._next].tasks.append(task)
+        self._queued += len(tasks)
+
+    def _steal(self, thief):
+        victim = max(self._workers, key=lambda slot: len(slot.tasks))
+        n = len(victim.tasks)
+        if n == 0:
+            return False
+        # Take the half that the victim would have run last
+        stolen = [victim.tasks.pop() for i in range((n + 1) // 2)]
+        stolen.reverse()
+        thief.tasks.extend(stolen)
+        self.steals += 1
+        return True
+
+    def _assign(self):
+        sends = []
+        now = time.monotonic()
+        for slot in self._workers:
+            if not self._queued:
+                break
+            if slot.inqueue is None:
+                continue
+            while (len(slot.inflight) < self._prefetch and
+                   (self._maxtasks is None or slot.sent < self._maxtasks)):
+                if not slot.tasks and not self._steal(slot):
+                    break
+                task = slot.tasks.popleft()
+                self._queued -= 1
+                key = (task[0], task[1])
+                slot.inflight[key] = (task, now)
+                self._owners[key] = slot
+                slot.sent += 1
+                sends.append((slot.inqueue, task))
+        return sends
+
+    def dispatch(self, thread):
+        '''Feed the workers until the pool is closed or terminated.'''
+        taskseq = set_length = None
+        last_index = -1
+        while True:
+            with self._cond:
+                while True:
+                    if thread._state != RUN:
+                        util.debug('task handler found thread._state != RUN')
+                        return
+                    sends = self._assign()
+                    if sends:
+                        pull = 0
+                        break
+                    if taskseq is None and self._taskseqs:
+                        taskseq, set_length = self._taskseqs.popleft()
+                        taskseq = iter(taskseq)
+                        last_index = -1
+                    if taskseq is not None and self._queued < self._high_water:
+                        pull = self._high_water - self._queued
+                        break
+                    if taskseq is None and self._closed and not self._queued:
+                        util.debug('task handler got sentinel')
+                        return
+                    self._cond.wait()
+
+            for inqueue, task in sends:
+                try:
+                    inqueue._writer.send(task)
+                except Exception as e:
+                    job, idx = task[:2]
+                    with self._cond:
+                        slot = self._owners.pop((job, idx), None)
+                        if slot is not None:
+                            del slot.inflight[(job, idx)]
+                    try:
+                        self._cache[job]._set(idx, (False, e))
+                    except KeyError:
+                        pass
+            task = sends = None
+
+            if pull:
+                # iterating taskseq cannot fail, but may run user code, so
+                # do it without holding the lock
+                tasks = list(itertools.islice(taskseq, pull))
+                if tasks:
+                    last_index = tasks[-1][1]
+                with self._cond:
+                    self._queue_tasks(tasks)
+                    self._cond.notify()
+                if len(tasks) < pull:
+                    if set_length:
+                        util.debug('doing set_length()')
+                        set_length(last_index + 1)
+                    taskseq = set_length = None
+                task = tasks = None
+
+    def send_sentinels(self):
+        for slot in self._workers:
+            if slot.inqueue is not None:
+                slot.inqueue._writer.send(None)
+
+    def maintain(self):
+        '''Replace worker processes which have exited.'''
+        with self._cond:
+            exited = [slot for slot in self._workers
+                      if slot.inqueue is not None and
+                      slot.process.exitcode is not None]
+            for slot in exited:
+                util.debug('cleaning up worker %d' % slot.process.pid)
+                slot.inqueue = None
+                # Results of the tasks a worker ran before exiting normally
+                # are still on their way.  After a crash, assume the oldest
+                # task was running and give the others to a new worker.
+                inflight = list(slot.inflight.items())
+                if slot.process.exitcode != 0 and inflight:
+                    for key, (task, sent_time) in reversed(inflight[1:]):
+                        del slot.inflight[key]
+                        del self._owners[key]
+                        slot.tasks.appendleft(task)
+                        self._queued += 1
+        for slot in exited:
+            slot.process.join()
+            process, inqueue = self.start_worker()
+            with self._cond:
+                self._pool[self._pool.index(slot.process)] = process
+                slot.process = process
+                slot.inqueue = inqueue
+                slot.sent = 0
+                self._cond.notify()
+
+    def drain(self, task_handler):
+        '''Unblock a task handler that is writing to a full pipe.'''
+        for slot in self._workers:
+            inqueue = slot.inqueue
+            if inqueue is None or not inqueue._rlock.acquire(False):
+                continue
+            while task_handler.is_alive() and inqueue._reader.poll():
+                inqueue._reader.recv()
+                time.sleep(0)
+
+    def close_inqueues(self):
+        for slot in self._workers:
+            if slot.inqueue is not None:
+                slot.inqueue._reader.close()
+
+
+class WorkStealingPool(Pool):
+    '''
+    Pool which feeds every worker process from its own deque of tasks.
+
+    Workers keep up to `prefetch` tasks in their pipe and an idle worker
+    steals half of the queued tasks of the most loaded one.  `map()` and
+    `starmap()` called without a chunksize adapt the size of the chunks to
+    the time tasks take, aiming at `chunk_time` seconds per chunk.
+    '''
+
+    def __init__(self, processes=None, initializer=None, initargs=(),
+                 maxtasksperchild=None, context=None, prefetch=2,
+                 chunk_time=0.01):
+        # Attributes initialized early to make sure that they exist in
+        # __del__() if __init__() raises an exception
+        self._pool = []
+        self._state = INIT
+
+        self._ctx = context or get_context()
+        self._outqueue = self._ctx.SimpleQueue()
+        self._cache = {}
+        self._maxtasksperchild = maxtasksperchild
+        self._initializer = initializer
+        self._initargs = initargs
+
+        if processes is None:
+            processes = os.cpu_count() or 1
+        if processes < 1:
+            raise ValueError("Number of processes must be at least 1")
+        if prefetch < 1:
+            raise ValueError("prefetch must be at least 1")
+        if chunk_time <= 0:
+            raise ValueError("chunk_time must be positive")
+
+        if initializer is not None and not callable(initializer):
+            raise TypeError('initializer must be a callable')
+
+        self._processes = processes
+        self._chunk_time = chunk_time
+        self._scheduler = _StealingScheduler(
+            self._pool, self._cache, self._ctx, self.Process, self._outqueue,
+            processes, prefetch, maxtasksperchild, initializer, initargs,
+            self._wrap_exception)
+        self._taskqueue = self._scheduler
+        try:
+            self._repopulate_pool()
+        except Exception:
+            for p in self._pool:
+                if p.exitcode is None:
+                    p.terminate()
+            for p in self._pool:
+                p.join()
+            raise
+
+        self._worker_handler = threading.Thread(
+            target=WorkStealingPool._handle_stealing_workers,
+            args=(self._cache, self._scheduler)
+            )
+        self._worker_handler.daemon = True
+        self._worker_handler._state = RUN
+        self._worker_handler.start()
+
+        self._task_handler = threading.Thread(
+            target=WorkStealingPool._handle_stealing_tasks,
+            args=(self._scheduler, self._outqueue)
+            )
+        self._task_handler.daemon = True
+        self._task_handler._state = RUN
+        self._task_handler.start()
+
+        self._result_handler = threading.Thread(
+            target=Pool._handle_results,
+            args=(self._outqueue, self._scheduler.get, self._cache)
+            )
+        self._result_handler.daemon = True
+        self._result_handler._state = RUN
+        self._result_handler.start()
+
+        self._terminate = util.Finalize(
+            self, self._terminate_stealing_pool,
+            args=(self._scheduler, self._outqueue, self._pool,
+                  self._worker_handler, self._task_handler,
+                  self._result_handler, self._cache),
+            exitpriority=15
+            )
+        self._state = RUN
+
+    def _repopulate_pool(self):
+        for i in range(self._processes - len(self._pool)):
+            w, inqueue = self._scheduler.start_worker()
+            self._pool.append(w)
+            self._scheduler.add_worker(w, inqueue)
+
+    def _map_async(self, func, iterable, mapper, chunksize=None, callback=None,
+            error_callback=None):
+        if chunksize is not None:
+            return Pool._map_async(self, func, iterable, mapper, chunksize,
+                                   callback, error_callback)
+        self._check_running()
+        if not hasattr(iterable, '__len__'):
+            iterable = list(iterable)
+
+        result = AdaptiveMapResult(self, len(iterable), callback,
+                                   error_callback=error_callback)
+        self._taskqueue.put(
+            (
+                self._adaptive_task_generation(result, func, iterable,
+                                               mapper),
+                None
+            )
+        )
+        return result
+
+    @staticmethod
+    def _adaptive_task_generation(result, func, iterable, mapper):
+        '''Generates chunks sized from the task times seen so far.'''
+        start = 0
+        try:
+            it = iter(iterable)
+            while start < result._length:
+                chunk = tuple(itertools.islice(
+                    it, result._next_chunksize(start)))
+                if not chunk:
+                    return
+                yield (result._job, (start, len(chunk)), mapper,
+                       ((func, chunk),), {})
+                start += len(chunk)
+        except Exception as e:
+            yield (result._job, (start, result._length - start),
+                   _helper_reraises_exception, (e,), {})
+
+    @staticmethod
+    def _handle_stealing_workers(cache, scheduler):
+        thread = threading.current_thread()
+
+        # Keep maintaining workers until the cache gets drained, unless the pool
+        # is terminated.
+        while thread._state == RUN or (cache and thread._state != TERMINATE):
+            scheduler.maintain()
+            time.sleep(0.1)
+        # send sentinel to stop the task handler
+        scheduler.put(None)
+        util.debug('worker handler exiting')
+
+    @staticmethod
+    def _handle_stealing_tasks(scheduler, outqueue):
+        thread = threading.current_thread()
+
+        scheduler.dispatch(thread)
+
+        try:
+            # tell result handler to finish when cache is empty
+            util.debug('task handler sending sentinel to result handler')
+            outqueue.put(None)
+
+            # tell workers there is no more work
+            util.debug('task handler sending sentinel to workers')
+            scheduler.send_sentinels()
+        except OSError:
+            util.debug('task handler got OSError when sending sentinels')
+
+        util.debug('task handler exiting')
+
+    @classmethod
+    def _terminate_stealing_pool(cls, scheduler, outqueue, pool,
+                                 worker_handler, task_handler,
+                                 result_handler, cache):
+        # this is guaranteed to only be called once
+        util.debug('finalizing pool')
+
+        worker_handler._state = TERMINATE
+        task_handler._state = TERMINATE
+        scheduler.wakeup()
+
+        util.debug('helping task handler/workers to finish')
+        scheduler.drain(task_handler)
+
+        if (not result_handler.is_alive()) and (len(cache) != 0):
+            raise AssertionError(
+                "Cannot have cache with result_hander not alive")
+
+        result_handler._state = TERMINATE
+        outqueue.put(None)                  # sentinel
+
+        # We must wait for the worker handler to exit before terminating
+        # workers because we don't want workers to be restarted behind our back.
+        util.debug('joining worker handler')
+        if threading.current_thread() is not worker_handler:
+            worker_handler.join()
+
+        # Terminate workers which haven't already finished.
+        if pool:
+            util.debug('terminating workers')
+            for p in pool:
+                if p.exitcode is None:
+                    p.terminate()
+
+        # A task handler blocked on a dead worker's pipe gets an error now
+        scheduler.close_inqueues()
+
+        util.debug('joining task handler')
+        if threading.current_thread() is not task_handler:
+            task_handler.join()
+
+        util.debug('joining result handler')
+        if threading.current_thread() is not result_handler:
+            result_handler.join()
+
+        if pool:
+            util.debug('joining pool workers')
+            for p in pool:
+                if p.is_alive():
+                    # worker has not yet exited
+                    util.debug('cleaning up worker %d' % p.pid)
+                    p.join()
@@ -7,7 +7,7 @@
 # Licensed to PSF under a Contributor Agreement.
 #
 
-__all__ = ['Queue', 'SimpleQueue', 'JoinableQueue']
+__all__ = ['Queue', 'SimpleQueue', 'JoinableQueue', 'SharedMemoryQueue']
 
 import sys
 import os
@@ -16,6 +16,7 @@ import collections
 import time
 import weakref
 import errno
+import struct
 
 from queue import Empty, Full
 
@@ -75,6 +76,8 @@ class Queue(object):
         self._close = None
         self._send_bytes = self._writer.send_bytes
         self._recv_bytes = self._reader.recv_bytes
+        self._dumps = _ForkingPickler.dumps
+        self._loads = _ForkingPickler.loads
         self._poll = self._reader.poll
 
     def put(self, obj, block=True, timeout=None):
@@ -113,7 +116,7 @@ class Queue(object):
             finally:
                 self._rlock.release()
         # unserialize the data after having released the lock
-        return _ForkingPickler.loads(res)
+        return self._loads(res)
 
     def qsize(self):
         # Raises NotImplementedError on Mac OSX because of broken sem_getvalue()
@@ -164,7 +167,7 @@ class Queue(object):
             target=Queue._feed,
             args=(self._buffer, self._notempty, self._send_bytes,
                   self._wlock, self._writer.close, self._ignore_epipe,
-                  self._on_queue_feeder_error, self._sem),
+                  self._on_queue_feeder_error, self._sem, self._dumps),
             name='QueueFeederThread'
         )
         self._thread.daemon = True
@@ -206,14 +209,14 @@ class Queue(object):
 
     @staticmethod
     def _feed(buffer, notempty, send_bytes, writelock, close, ignore_epipe,
-              onerror, queue_sem):
+              onerror, queue_sem, dumps=_ForkingPickler.dumps):
         debug('starting thread to feed data to pipe')
         nacquire = notempty.acquire
         nrelease = notempty.release
         nwait = notempty.wait
         bpopleft = buffer.popleft
         sentinel = _sentinel
-        if sys.platform != 'win32':
+        if writelock is not None:
             wacquire = writelock.acquire
             wrelease = writelock.release
         else:
@@ -236,7 +239,7 @@ class Queue(object):
                             return
 
                         # serialize the data before acquiring the lock
-                        obj = _ForkingPickler.dumps(obj)
+                        obj = dumps(obj)
                         if wacquire is None:
                             send_bytes(obj)
                         else:
@@ -325,6 +328,316 @@ class JoinableQueue(Queue):
             if not self._unfinished_tasks._semlock._is_zero():
                 self._cond.wait()
 
+#
+# Queue type which moves large payloads through shared memory
+#
+# Small objects are pickled and sent through the pipe as usual.  Bytes-like
+# objects and pickles of at least `threshold` bytes are streamed through a
+# ring buffer in a shared memory segment instead, and only a short header
+# goes through the pipe.  The writer holds the write lock and the reader
+# holds the read lock for the whole message, so messages occupy the ring in
+# the order of their headers in the pipe.
+#
+
+_RING_HEADER = 64                       # counters and pids
+_RING_COUNTERS = struct.Struct('QQ')    # head and tail
+# Pids of the processes in the middle of writing and of reading a message,
+# or 0; both are set to _RING_BROKEN once a message was cut short.
+_RING_PIDS = struct.Struct('qq')
+_RING_WRITER, _RING_READER = range(2)
+_RING_BROKEN = -1
+# A side waiting for the other one checks every _RING_POLL_INTERVAL seconds
+# that it still exists, and gives up if it is in the middle of a message
+# but did not move the counters for _RING_STALL_TIMEOUT seconds.
+_RING_POLL_INTERVAL = 1.0
+_RING_STALL_TIMEOUT = 60.0
+
+# Pickles made by ForkingPickler start with the PROTO opcode (0x80), so a
+# message starting with a NUL byte can only be a ring header.
+_RING_TAG = b'\0'
+_RING_MESSAGE = struct.Struct('BQ')     # kind, size
+_RING_PICKLE, _RING_BYTES, _RING_BYTEARRAY, _RING_MEMORYVIEW = range(4)
+
+
+def _process_exists(pid):
+    if sys.platform == 'win32':
+        # os.kill() would terminate the process: only the stall timeout
+        # applies
+        return True
+    try:
+        os.kill(pid, 0)
+    except ProcessLookupError:
+        return False
+    except OSError:
+        pass
+    return True
+
+
+class _SharedRing(object):
+    '''
+    Byte ring buffer in a shared memory segment.
+
+    The head (total bytes written) and tail (total bytes read) counters and
+    the pids of the current writer and reader are stored at the start of
+    the segment and are only accessed with the condition's lock held; the
+    data is copied without holding it.
+    '''
+
+    def __init__(self, capacity, ctx):
+        from .shared_memory import SharedMemory
+        self._capacity = capacity
+        self._cond = ctx.Condition(ctx.Lock())
+        self._shm = SharedMemory(None, size=_RING_HEADER + capacity)
+        self._attach()
+        _RING_COUNTERS.pack_into(self._shm.buf, 0, 0, 0)
+        _RING_PIDS.pack_into(self._shm.buf, _RING_COUNTERS.size, 0, 0)
+        # Only the process which created the segment removes its name;
+        # processes which already mapped it are not affected.
+        Finalize(self, self._shm.unlink, exitpriority=10)
+
+    def __getstate__(self):
+        context.assert_spawning(self)
+        return (self._capacity, self._cond, self._shm.name)
+
+    def __setstate__(self, state):
+        from .shared_memory import SharedMemory
+        self._capacity, self._cond, name = state
+        if os.name == 'nt':
+            self._shm = SharedMemory(name, size=_RING_HEADER + self._capacity)
+        else:
+            self._shm = SharedMemory(name)
+        self._attach()
+
+    def _attach(self):
+        self._data = self._shm.buf[_RING_HEADER:_RING_HEADER + self._capacity]
+        self._chunk = max(1, self._capacity // 4)
+
+    def write(self, data):
+        '''Copy the bytes-like object data into the ring.'''
+        data = memoryview(data).cast('B')
+        buf = self._shm.buf
+        ring = self._data
+        capacity = self._capacity
+        cond = self._cond
+        pos = 0
+        size = len(data)
+        self._begin(_RING_WRITER)
+        while pos < size:
+            with cond:
+                while True:
+                    head, tail = _RING_COUNTERS.unpack_from(buf)
+                    free = capacity - (head - tail)
+                    if free:
+                        break
+                    self._wait(_RING_READER)
+            # Copy at most a chunk so that the reader can start on it
+            offset = head % capacity
+            n = min(size - pos, free, capacity - offset, self._chunk)
+            ring[offset:offset + n] = data[pos:pos + n]
+            pos += n
+            with cond:
+                _RING_COUNTERS.pack_into(buf, 0, head + n,
+                                         _RING_COUNTERS.unpack_from(buf)[1])
+                cond.notify_all()
+        self._end(_RING_WRITER)
+
+    def read(self, size):
+        '''Return a bytearray with the next size bytes of the ring.'''
+        self._begin(_RING_READER)
+        result = self._read(size)
+        self._end(_RING_READER)
+        return result
+
+    def read_bytes(self, size):
+        '''Return the next size bytes of the ring as bytes.'''
+        self._begin(_RING_READER)
+        # A single copy suffices if the whole message is already in the
+        # ring and does not wrap around
+        head, tail = self._wait_data()
+        offset = tail % self._capacity
+        if head - tail >= size and offset + size <= self._capacity:
+            result = bytes(self._data[offset:offset + size])
+            self._consume(tail + size)
+        else:
+            result = bytes(self._read(size))
+        self._end(_RING_READER)
+        return result
+
+    def _read(self, size):
+        result = bytearray(size)
+        self._read_into(memoryview(result), size)
+        return result
+
+    def _begin(self, side):
+        buf = self._shm.buf
+        with self._cond:
+            pids = list(_RING_PIDS.unpack_from(buf, _RING_COUNTERS.size))
+            if pids[side] == _RING_BROKEN:
+                raise BrokenPipeError('the shared memory ring is broken')
+            pids[side] = os.getpid()
+            _RING_PIDS.pack_into(buf, _RING_COUNTERS.size, *pids)
+
+    def _end(self, side):
+        buf = self._shm.buf
+        with self._cond:
+            pids = list(_RING_PIDS.unpack_from(buf, _RING_COUNTERS.size))
+            if pids[side] != _RING_BROKEN:
+                pids[side] = 0
+                _RING_PIDS.pack_into(buf, _RING_COUNTERS.size, *pids)
+
+    def _wait(self, peer):
+        # Called with the condition's lock held when the ring is full (peer
+        # is the reader) or empty (peer is the writer); returns once the
+        # counters changed.  If the peer is in the middle of a message but
+        # exited or stalled, the rest of the message will never come, so
+        # the ring is marked as broken.
+        buf = self._shm.buf
+        cond = self._cond
+        counters = _RING_COUNTERS.unpack_from(buf)
+        waited_pid = 0
+        while True:
+            pid = _RING_PIDS.unpack_from(buf, _RING_COUNTERS.size)[peer]
+            if pid == _RING_BROKEN:
+                raise BrokenPipeError('the shared memory ring is broken')
+            if pid != waited_pid:
+                waited_pid = pid
+                deadline = time.monotonic() + _RING_STALL_TIMEOUT
+            if pid and (not _process_exists(pid) or
+                        time.monotonic() >= deadline):
+                _RING_PIDS.pack_into(buf, _RING_COUNTERS.size,
+                                     _RING_BROKEN, _RING_BROKEN)
+                cond.notify_all()
+                raise BrokenPipeError(
+                    'process %d %s the shared memory ring exited or stalled '
+                    'in the middle of a message' %
+                    (pid, 'reading from' if peer == _RING_READER
+                          else 'writing to'))
+            cond.wait(_RING_POLL_INTERVAL)
+            if _RING_COUNTERS.unpack_from(buf) != counters:
+                return
+
+    def _wait_data(self):
+        buf = self._shm.buf
+        with self._cond:
+            while True:
+                head, tail = _RING_COUNTERS.unpack_from(buf)
+                if head != tail:
+                    return head, tail
+                self._wait(_RING_WRITER)
+
+    def _consume(self, tail):
+        buf = self._shm.buf
+        with self._cond:
+            head = _RING_COUNTERS.unpack_from(buf)[0]
+            _RING_COUNTERS.pack_into(buf, 0, head, tail)
+            self._cond.notify_all()
+
+    def _read_into(self, result, size):
+        ring = self._data
+        capacity = self._capacity
+        pos = 0
+        while pos < size:
+            head, tail = self._wait_data()
+            offset = tail % capacity
+            n = min(size - pos, head - tail, capacity - offset)
+            result[pos:pos + n] = ring[offset:offset + n]
+            pos += n
+            self._consume(tail + n)
+
+
+class SharedMemoryQueue(Queue):
+
+    def __init__(self, maxsize=0, *, ctx, capacity=64*1024*1024,
+                 threshold=64*1024):
+        if capacity < 1:
+            raise ValueError("capacity must be at least 1")
+        if threshold < 1:
+            raise ValueError("threshold must be at least 1")
+        self._ring = _SharedRing(capacity, ctx)
+        self._threshold = threshold
+        Queue.__init__(self, maxsize, ctx=ctx)
+        if self._wlock is None:
+            # the ring needs a write lock even where pipe writes are atomic
+            self._wlock = ctx.Lock()
+        if sys.platform != 'win32':
+            register_after_fork(self, SharedMemoryQueue._after_fork)
+
+    def __getstate__(self):
+        return Queue.__getstate__(self) + (self._ring, self._threshold)
+
+    def __setstate__(self, state):
+        self._ring, self._threshold = state[-2:]
+        Queue.__setstate__(self, state[:-2])
+
+    def _after_fork(self):
+        Queue._after_fork(self)
+        self._send_bytes = self._send_message
+        self._recv_bytes = self._recv_message
+        self._dumps = self._dump_message
+        self._loads = self._load_message
+
+    def _dump_message(self, obj):
+        # Returns bytes to be sent through the pipe, or a (kind, data)
+        # pair for the ring
+        kind = _RING_KINDS.get(type(obj))
+        if kind is not None:
+            if kind == _RING_MEMORYVIEW:
+                if not obj.c_contiguous:
+                    return _ForkingPickler.dumps(obj)  # raises TypeError
+                try:
+                    obj.cast('B').cast(obj.format, obj.shape)
+                except (TypeError, ValueError):
+                    return _ForkingPickler.dumps(obj)
+            data = memoryview(obj)
+            if data.nbytes >= self._threshold:
+                return (kind, data)
+            return _ForkingPickler.dumps(obj)
+        data = _ForkingPickler.dumps(obj)
+        if len(data) >= self._threshold:
+            return (_RING_PICKLE, memoryview(data))
+        return data
+
+    def _send_message(self, message):
+        # Called with the write lock held
+        if type(message) is not tuple:
+            self._writer.send_bytes(message)
+            return
+        kind, data = message
+        header = _RING_TAG + _RING_MESSAGE.pack(kind, data.nbytes)
+        if kind == _RING_MEMORYVIEW:
+            header += _ForkingPickler.dumps((data.format, data.shape))
+        self._writer.send_bytes(header)
+        self._ring.write(data)
+
+    def _recv_message(self):
+        # Called with the read lock held
+        res = self._reader.recv_bytes()
+        if res[:1] != _RING_TAG:
+            return res
+        kind, size = _RING_MESSAGE.unpack_from(res, 1)
+        if kind == _RING_BYTES:
+            return (kind, self._ring.read_bytes(size))
+        data = self._ring.read(size)
+        if kind == _RING_MEMORYVIEW:
+            format, shape = _ForkingPickler.loads(
+                res[1 + _RING_MESSAGE.size:])
+            return (kind, memoryview(data).cast(format, shape))
+        return (kind, data)
+
+    def _load_message(self, res):
+        if type(res) is not tuple:
+            return _ForkingPickler.loads(res)
+        kind, data = res
+        if kind == _RING_PICKLE:
+            return _ForkingPickler.loads(data)
+        return data
+
+_RING_KINDS = {
+    bytes: _RING_BYTES,
+    bytearray: _RING_BYTEARRAY,
+    memoryview: _RING_MEMORYVIEW,
+}
+
 #
 # Simplified Queue type -- really just a locked pipe
 #
@@ -37,13 +37,21 @@ import codecs
 import _compat_pickle
 
 __all__ = ["PickleError", "PicklingError", "UnpicklingError", "Pickler",
-           "Unpickler", "dump", "dumps", "load", "loads"]
+           "Unpickler", "IncrementalUnpickler", "dump", "dumps", "load",
+           "loads"]
+
+try:
+    from _pickle import PickleBuffer
+    __all__.append("PickleBuffer")
+    _HAVE_PICKLE_BUFFER = True
+except ImportError:
+    _HAVE_PICKLE_BUFFER = False
 
 # Shortcut for use in isinstance testing
 bytes_types = (bytes, bytearray)
 
 # These are purely informational; no code uses these.
-format_version = "4.0"                  # File format version we write
+format_version = "5.0"                  # File format version we write
 compatible_formats = ["1.0",            # Original protocol 0
                       "1.1",            # Protocol 0 with INST added
                       "1.2",            # Original protocol 1
@@ -51,10 +59,11 @@ compatible_formats = ["1.0",            # Original protocol 0
                       "2.0",            # Protocol 2
                       "3.0",            # Protocol 3
                       "4.0",            # Protocol 4
+                      "5.0",            # Protocol 5
                       ]                 # Old format versions we can read
 
 # This is the highest protocol number we know how to read.
-HIGHEST_PROTOCOL = 4
+HIGHEST_PROTOCOL = 5
 
 # The protocol we write by default.  May be less than HIGHEST_PROTOCOL.
 # Only bump this if the oldest still supported version of Python already
@@ -178,6 +187,11 @@ STACK_GLOBAL     = b'\x93'  # same as GLOBAL but using names on the stacks
 MEMOIZE          = b'\x94'  # store top of the stack in memo
 FRAME            = b'\x95'  # indicate the beginning of a new frame
 
+# Protocol 5
+BYTEARRAY8       = b'\x96'  # push bytearray
+NEXT_BUFFER      = b'\x97'  # push next out-of-band buffer
+READONLY_BUFFER  = b'\x98'  # make top of stack readonly
+
 __all__.extend([x for x in dir() if re.match("[A-Z][A-Z0-9_]+$", x)])
 
 
@@ -264,6 +278,27 @@ class _Unframer:
         else:
             return self.file_read(n)
 
+    def readinto(self, buf):
+        if self.current_frame:
+            n = self.current_frame.readinto(buf)
+            if n == 0 and len(buf) != 0:
+                self.current_frame = None
+                return self._file_readinto(buf)
+            if n < len(buf):
+                raise UnpicklingError(
+                    "pickle exhausted before end of frame")
+            return n
+        else:
+            return self._file_readinto(buf)
+
+    def _file_readinto(self, buf):
+        n = len(buf)
+        data = self.file_read(n)
+        if len(data) < n:
+            raise UnpicklingError("pickle data was truncated")
+        buf[:] = data
+        return n
+
     def readline(self):
         if self.current_frame:
             data = self.current_frame.readline()
@@ -371,11 +406,12 @@ def decode_long(data):
 
 class _Pickler:
 
-    def __init__(self, file, protocol=None, *, fix_imports=True):
+    def __init__(self, file, protocol=None, *, fix_imports=True,
+                 buffer_callback=None, memoize=True):
         """This takes a binary file for writing a pickle data stream.
 
         The optional *protocol* argument tells the pickler to use the
-        given protocol; supported protocols are 0, 1, 2, 3 and 4.  The
+        given protocol; supported protocols are 0, 1, 2, 3, 4 and 5.  The
         default protocol is 4. It was introduced in Python 3.4, it is
         incompatible with previous versions.
 
@@ -393,6 +429,20 @@ class _Pickler:
         will try to map the new Python 3 names to the old module names
         used in Python 2, so that the pickle data stream is readable
         with Python 2.
+
+        If *buffer_callback* is None (the default), buffer views are
+        serialized into *file* as part of the pickle stream.  Otherwise
+        it is called with each PickleBuffer met while pickling; when it
+        returns a false value, the buffer is not written into the
+        stream and must be passed back, in order, in the *buffers*
+        argument of the unpickler.  It is an error to pass
+        *buffer_callback* with a protocol below 5.
+
+        If *memoize* is false, the pickler does not record the objects
+        it has already written, so shared objects are written once per
+        reference.  This is faster for data without shared or recursive
+        references; a ValueError is raised if a recursive structure is
+        met.
         """
         if protocol is None:
             protocol = DEFAULT_PROTOCOL
@@ -400,6 +450,9 @@ class _Pickler:
             protocol = HIGHEST_PROTOCOL
         elif not 0 <= protocol <= HIGHEST_PROTOCOL:
             raise ValueError("pickle protocol must be <= %d" % HIGHEST_PROTOCOL)
+        if buffer_callback is not None and protocol < 5:
+            raise ValueError("buffer_callback needs protocol >= 5")
+        self._buffer_callback = buffer_callback
         try:
             self._file_write = file.write
         except AttributeError:
@@ -410,7 +463,9 @@ class _Pickler:
         self.memo = {}
         self.proto = int(protocol)
         self.bin = protocol >= 1
-        self.fast = 0
+        self.fast = not memoize
+        self._fast_nesting = 0
+        self._fast_memo = set()
         self.fix_imports = fix_imports and protocol < 3
 
     def clear_memo(self):
@@ -430,6 +485,8 @@ class _Pickler:
         if not hasattr(self, "_file_write"):
             raise PicklingError("Pickler.__init__() was not called by "
                                 "%s.__init__()" % (self.__class__.__name__,))
+        self._fast_nesting = 0
+        self._fast_memo.clear()
         if self.proto >= 2:
             self.write(PROTO + pack("<B", self.proto))
         if self.proto >= 4:
@@ -482,6 +539,26 @@ class _Pickler:
 
         return GET + repr(i).encode("ascii") + b'\n'
 
+    # In fast mode nothing is memoized, so a recursive list or dict would
+    # be pickled forever.  Past this nesting depth the containers being
+    # saved are tracked to report the cycle.  Keep in synch with
+    # FAST_NESTING_LIMIT in _pickle.c.
+    _FAST_NESTING_LIMIT = 50
+
+    def _fast_save_enter(self, obj):
+        self._fast_nesting += 1
+        if self._fast_nesting >= self._FAST_NESTING_LIMIT:
+            if id(obj) in self._fast_memo:
+                raise ValueError("memoization disabled: can't pickle cyclic "
+                                 "objects including object type %s at %#x" %
+                                 (type(obj).__name__, id(obj)))
+            self._fast_memo.add(id(obj))
+
+    def _fast_save_leave(self, obj):
+        if self._fast_nesting >= self._FAST_NESTING_LIMIT:
+            self._fast_memo.discard(id(obj))
+        self._fast_nesting -= 1
+
     def save(self, obj, save_persistent_id=True):
         self.framer.commit_frame()
 
@@ -719,17 +796,74 @@ class _Pickler:
                 self.save_reduce(codecs.encode,
                                  (str(obj, 'latin1'), 'latin1'), obj=obj)
             return
-        n = len(obj)
+        self._write_bytes_data(obj)
+        self.memoize(obj)
+    dispatch[bytes] = save_bytes
+
+    # Write the data of a bytes-like object as a bytes object (protocol 3+).
+    def _write_bytes_data(self, data):
+        n = len(data)
         if n <= 0xff:
-            self.write(SHORT_BINBYTES + pack("<B", n) + obj)
+            self.write(SHORT_BINBYTES + pack("<B", n) + data)
         elif n > 0xffffffff and self.proto >= 4:
-            self._write_large_bytes(BINBYTES8 + pack("<Q", n), obj)
+            self._write_large_bytes(BINBYTES8 + pack("<Q", n), data)
         elif n >= self.framer._FRAME_SIZE_TARGET:
-            self._write_large_bytes(BINBYTES + pack("<I", n), obj)
+            self._write_large_bytes(BINBYTES + pack("<I", n), data)
         else:
-            self.write(BINBYTES + pack("<I", n) + obj)
+            self.write(BINBYTES + pack("<I", n) + data)
+
+    # Write the data of a bytes-like object as a bytearray (protocol 5+).
+    def _write_bytearray_data(self, data):
+        n = len(data)
+        if n >= self.framer._FRAME_SIZE_TARGET:
+            self._write_large_bytes(BYTEARRAY8 + pack("<Q", n), data)
+        else:
+            self.write(BYTEARRAY8 + pack("<Q", n) + data)
+
+    def save_bytearray(self, obj):
+        if self.proto < 5:
+            # Older protocols have no opcode for bytearray objects: use
+            # the same reduction as save() would have.
+            reduce = getattr(self, 'dispatch_table', dispatch_table).get(
+                bytearray)
+            if reduce is not None:
+                rv = reduce(obj)
+            else:
+                rv = obj.__reduce_ex__(self.proto)
+            self.save_reduce(obj=obj, *rv)
+            return
+        self._write_bytearray_data(obj)
         self.memoize(obj)
-    dispatch[bytes] = save_bytes
+    dispatch[bytearray] = save_bytearray
+
+    if _HAVE_PICKLE_BUFFER:
+        def save_picklebuffer(self, obj):
+            if self.proto < 5:
+                raise PicklingError("PickleBuffer can only be pickled with "
+                                    "protocol >= 5")
+            try:
+                m = obj.raw()
+            except BufferError:
+                raise PicklingError("PickleBuffer can not be pickled when "
+                                    "pointing to a non-contiguous buffer")
+            with m:
+                in_band = True
+                if self._buffer_callback is not None:
+                    in_band = bool(self._buffer_callback(obj))
+                if in_band:
+                    # Write data in-band
+                    if m.readonly:
+                        self._write_bytes_data(m)
+                    else:
+                        self._write_bytearray_data(m)
+                    self.memoize(obj)
+                else:
+                    # Write data out-of-band; the data is not memoized, as
+                    # the callback sees it once per occurrence.
+                    self.write(NEXT_BUFFER)
+                    if m.readonly:
+                        self.write(READONLY_BUFFER)
+        dispatch[PickleBuffer] = save_picklebuffer
 
     def save_str(self, obj):
         if self.bin:
@@ -808,8 +942,12 @@ class _Pickler:
         else:   # proto 0 -- can't use EMPTY_LIST
             self.write(MARK + LIST)
 
+        if self.fast:
+            self._fast_save_enter(obj)
         self.memoize(obj)
         self._batch_appends(obj)
+        if self.fast:
+            self._fast_save_leave(obj)
 
     dispatch[list] = save_list
 
@@ -848,8 +986,12 @@ class _Pickler:
         else:   # proto 0 -- can't use EMPTY_DICT
             self.write(MARK + DICT)
 
+        if self.fast:
+            self._fast_save_enter(obj)
         self.memoize(obj)
         self._batch_setitems(obj.items())
+        if self.fast:
+            self._fast_save_leave(obj)
 
     dispatch[dict] = save_dict
     if PyStringMap is not None:
@@ -1017,7 +1159,7 @@ class _Pickler:
 class _Unpickler:
 
     def __init__(self, file, *, fix_imports=True,
-                 encoding="ASCII", errors="strict"):
+                 encoding="ASCII", errors="strict", buffers=None):
         """This takes a binary file for reading a pickle data stream.
 
         The protocol version of the pickle is detected automatically, so
@@ -1044,7 +1186,13 @@ class _Unpickler:
         to decode 8-bit string instances pickled by Python 2; these
         default to 'ASCII' and 'strict', respectively. *encoding* can be
         'bytes' to read theses 8-bit string instances as bytes objects.
+
+        If *buffers* is not None, it is an iterable of buffer-enabled
+        objects that is consumed each time the pickle stream references
+        an out-of-band buffer view.  Such buffers were given in order to
+        the *buffer_callback* of a Pickler object.
         """
+        self._buffers = iter(buffers) if buffers is not None else None
         self._file_readline = file.readline
         self._file_read = file.read
         self.memo = {}
@@ -1065,6 +1213,7 @@ class _Unpickler:
                                   "%s.__init__()" % (self.__class__.__name__,))
         self._unframer = _Unframer(self._file_read, self._file_readline)
         self.read = self._unframer.read
+        self.readinto = self._unframer.readinto
         self.readline = self._unframer.readline
         self.metastack = []
         self.stack = []
@@ -1251,6 +1400,34 @@ class _Unpickler:
         self.append(self.read(len))
     dispatch[BINBYTES8[0]] = load_binbytes8
 
+    def load_bytearray8(self):
+        len, = unpack('<Q', self.read(8))
+        if len > maxsize:
+            raise UnpicklingError("BYTEARRAY8 exceeds system's maximum size "
+                                  "of %d bytes" % maxsize)
+        b = bytearray(len)
+        self.readinto(b)
+        self.append(b)
+    dispatch[BYTEARRAY8[0]] = load_bytearray8
+
+    def load_next_buffer(self):
+        if self._buffers is None:
+            raise UnpicklingError("pickle stream refers to out-of-band data "
+                                  "but no *buffers* argument was given")
+        try:
+            buf = next(self._buffers)
+        except StopIteration:
+            raise UnpicklingError("not enough out-of-band buffers")
+        self.append(buf)
+    dispatch[NEXT_BUFFER[0]] = load_next_buffer
+
+    def load_readonly_buffer(self):
+        buf = self.stack[-1]
+        with memoryview(buf) as m:
+            if not m.readonly:
+                self.stack[-1] = m.toreadonly()
+    dispatch[READONLY_BUFFER[0]] = load_readonly_buffer
+
     def load_short_binstring(self):
         len = self.read(1)[0]
         data = self.read(len)
@@ -1571,28 +1748,214 @@ class _Unpickler:
         raise _Stop(value)
     dispatch[STOP[0]] = load_stop
 
+# Sizes of opcode arguments, used by _IncrementalUnpickler to tell whether
+# an opcode is complete: the size of fixed-size arguments, the size and
+# signedness of the length prefix of counted arguments, and the number of
+# lines of newline-terminated arguments.
+_FIXED_ARG_SIZES = {op[0]: size for ops, size in [
+    ((BININT1, BINGET, BINPUT, PROTO, EXT1), 1),
+    ((BININT2, EXT2), 2),
+    ((BININT, LONG_BINGET, LONG_BINPUT, EXT4), 4),
+    ((BINFLOAT,), 8),
+] for op in ops}
+_COUNTED_ARG_SIZES = {op[0]: size for ops, size in [
+    ((SHORT_BINBYTES, SHORT_BINSTRING, SHORT_BINUNICODE, LONG1), (1, False)),
+    ((BINBYTES, BINUNICODE), (4, False)),
+    ((BINSTRING, LONG4), (4, True)),
+    ((BINBYTES8, BINUNICODE8, BYTEARRAY8, FRAME), (8, False)),
+] for op in ops}
+_LINE_ARGS = {op[0]: 1 for op in (INT, LONG, FLOAT, STRING, UNICODE,
+                                  GET, PUT, PERSID)}
+_LINE_ARGS.update({GLOBAL[0]: 2, INST[0]: 2})
+
+def _opcode_size(data, pos):
+    """Return the size of the complete opcode at data[pos:].
+
+    The size includes the opcode's argument and, for FRAME, the frame it
+    announces.  Return a (size, needed) pair: if the opcode is incomplete,
+    size is 0 and needed is the size it will have if that is known from
+    the bytes available, or 0.
+    """
+    op = data[pos]
+    avail = len(data) - pos
+    if op in _FIXED_ARG_SIZES:
+        size = 1 + _FIXED_ARG_SIZES[op]
+    elif op in _COUNTED_ARG_SIZES:
+        n, signed = _COUNTED_ARG_SIZES[op]
+        if avail < 1 + n:
+            return 0, 1 + n
+        count = int.from_bytes(data[pos+1:pos+1+n], 'little', signed=signed)
+        if not 0 <= count <= maxsize - 1 - n:
+            # Let the opcode report invalid sizes.
+            return 1 + n, 0
+        size = 1 + n + count
+    elif op in _LINE_ARGS:
+        i = pos
+        for _ in range(_LINE_ARGS[op]):
+            i = data.find(b'\n', i + 1)
+            if i < 0:
+                return 0, 0
+        return i + 1 - pos, 0
+    else:
+        return 1, 0
+    if avail < size:
+        return 0, size
+    return size, 0
+
+
+class _IncrementalUnpickler(_Unpickler):
+
+    def __init__(self, *, fix_imports=True, encoding="ASCII",
+                 errors="strict", buffers=None):
+        """Load a stream of pickles fed in chunks of arbitrary sizes.
+
+        Data is passed to the feed() method as it arrives, for instance
+        from a socket, and the objects whose pickle is complete are
+        returned.  Each pickle is loaded independently, as by loads().
+        A partially received pickle is kept as the unpickler's state
+        rather than as raw data, and the opcodes of protocol 4 frames
+        are executed as soon as a whole frame is available.
+
+        Optional keyword arguments *fix_imports*, *encoding*, *errors*
+        and *buffers* have the same meaning as for Unpickler.  *buffers*
+        is shared by all the pickles of the stream.
+        """
+        self._check_not_loading("__init__")
+        super().__init__(io.BytesIO(), fix_imports=fix_imports,
+                         encoding=encoding, errors=errors, buffers=buffers)
+        self._pending = bytearray()
+        self._needed = 1
+        self._in_pickle = False
+        self._loading = False
+
+    def _check_not_loading(self, method):
+        # feed() must not be reentered by find_class(), persistent_load()
+        # or the callables run by the opcodes, since the pending input
+        # would be changed while it is loaded.
+        if getattr(self, "_loading", False):
+            raise RuntimeError("IncrementalUnpickler.%s() called while "
+                               "feed() is loading" % (method,))
+
+    def _reset(self):
+        self.memo.clear()
+        self._in_pickle = False
+
+    def feed(self, data):
+        """Feed the next chunk of the pickle stream.
+
+        Return the list of the objects whose pickle was completed by
+        *data*, in stream order.  If an error is raised, the pending
+        input and the partially loaded pickle are discarded.
+        """
+        # Check whether IncrementalUnpickler was initialized correctly.
+        # This is only needed to mimic the behavior of
+        # _pickle.IncrementalUnpickler.feed().
+        if not hasattr(self, "_pending"):
+            raise UnpicklingError("IncrementalUnpickler.__init__() was not "
+                                  "called by %s.__init__()" %
+                                  (self.__class__.__name__,))
+        self._check_not_loading("feed")
+        pending = self._pending
+        pending += data
+        result = []
+        if len(pending) < self._needed:
+            return result
+        size = len(pending)
+        pos = 0
+        dispatch = self.dispatch
+        self._loading = True
+        try:
+            while True:
+                # Load the longest run of complete opcodes.
+                end = pos
+                needed = 0
+                while end < size:
+                    n, needed = _opcode_size(pending, end)
+                    if not n:
+                        break
+                    end += n
+                if end == pos:
+                    break
+
+                if not self._in_pickle:
+                    self.metastack = []
+                    self.stack = []
+                    self.append = self.stack.append
+                    self.proto = 0
+                    self._in_pickle = True
+                file = io.BytesIO(pending[pos:end])
+                self._unframer = _Unframer(file.read, file.readline)
+                self.read = read = self._unframer.read
+                self.readinto = self._unframer.readinto
+                self.readline = self._unframer.readline
+                try:
+                    while True:
+                        key = read(1)
+                        if not key:
+                            break
+                        dispatch[key[0]](self)
+                except _Stop as stopinst:
+                    result.append(stopinst.value)
+                    self._reset()
+                    pos += file.tell()
+                    frame = self._unframer.current_frame
+                    if frame:
+                        pos -= len(frame.getbuffer()) - frame.tell()
+                else:
+                    pos = end
+        except BaseException:
+            self._reset()
+            pending.clear()
+            self._needed = 1
+            raise
+        finally:
+            self._loading = False
+        del pending[:pos]
+        self._needed = needed or size - pos + 1
+        return result
+
+    def close(self):
+        """Check that the stream ended at the end of a pickle.
+
+        Raise UnpicklingError if a pickle was only partially fed, and
+        reset the unpickler for a new stream.
+        """
+        self._check_not_loading("close")
+        truncated = self._in_pickle or bool(self._pending)
+        self._reset()
+        self._pending.clear()
+        self._needed = 1
+        if truncated:
+            raise UnpicklingError("pickle data was truncated")
+
 
 # Shorthands
 
-def _dump(obj, file, protocol=None, *, fix_imports=True):
-    _Pickler(file, protocol, fix_imports=fix_imports).dump(obj)
+def _dump(obj, file, protocol=None, *, fix_imports=True,
+          buffer_callback=None, memoize=True):
+    _Pickler(file, protocol, fix_imports=fix_imports,
+             buffer_callback=buffer_callback, memoize=memoize).dump(obj)
 
-def _dumps(obj, protocol=None, *, fix_imports=True):
+def _dumps(obj, protocol=None, *, fix_imports=True, buffer_callback=None,
+           memoize=True):
     f = io.BytesIO()
-    _Pickler(f, protocol, fix_imports=fix_imports).dump(obj)
+    _Pickler(f, protocol, fix_imports=fix_imports,
+             buffer_callback=buffer_callback, memoize=memoize).dump(obj)
     res = f.getvalue()
     assert isinstance(res, bytes_types)
     return res
 
-def _load(file, *, fix_imports=True, encoding="ASCII", errors="strict"):
-    return _Unpickler(file, fix_imports=fix_imports,
+def _load(file, *, fix_imports=True, encoding="ASCII", errors="strict",
+          buffers=None):
+    return _Unpickler(file, fix_imports=fix_imports, buffers=buffers,
                      encoding=encoding, errors=errors).load()
 
-def _loads(s, *, fix_imports=True, encoding="ASCII", errors="strict"):
+def _loads(s, *, fix_imports=True, encoding="ASCII", errors="strict",
+           buffers=None):
     if isinstance(s, str):
         raise TypeError("Can't load pickle from unicode string")
     file = io.BytesIO(s)
-    return _Unpickler(file, fix_imports=fix_imports,
+    return _Unpickler(file, fix_imports=fix_imports, buffers=buffers,
                       encoding=encoding, errors=errors).load()
 
 # Use the faster _pickle if possible
@@ -1603,6 +1966,7 @@ try:
         UnpicklingError,
         Pickler,
         Unpickler,
+        IncrementalUnpickler,
         dump,
         dumps,
         load,
@@ -1610,6 +1974,7 @@ try:
     )
 except ImportError:
     Pickler, Unpickler = _Pickler, _Unpickler
+    IncrementalUnpickler = _IncrementalUnpickler
     dump, dumps, load, loads = _dump, _dumps, _load, _loads
 
 # Doctest
@@ -7,6 +7,7 @@ import unittest.mock
 import queue as pyqueue
 import time
 import io
+import functools
 import itertools
 import sys
 import os
@@ -1122,6 +1123,94 @@ class _TestQueue(BaseTestCase):
                 q.put('foo')
             with self.assertRaisesRegex(ValueError, 'is closed'):
                 q.get()
+
+
+class _TestSharedMemoryQueue(_TestQueue):
+    ALLOWED_TYPES = ('processes', )
+    # A small ring and threshold so that most messages go through the ring
+    # and wrap around
+    Queue = staticmethod(functools.partial(multiprocessing.SharedMemoryQueue,
+                                           capacity=4096, threshold=16))
+
+    @classmethod
+    def _test_echo(cls, inq, outq):
+        for obj in iter(inq.get, None):
+            outq.put(obj)
+
+    def test_payload_types(self):
+        inq = self.Queue()
+        outq = self.Queue()
+        p = self.Process(target=self._test_echo, args=(inq, outq))
+        p.daemon = True
+        p.start()
+
+        objs = [
+            b'x' * 10,
+            b'y' * 100000,
+            bytearray(b'z' * 5000),
+            list(range(10000)),
+            array.array('d', range(3000)),
+            'small',
+        ]
+        for obj in objs:
+            inq.put(obj)
+        for obj in objs:
+            res = outq.get(timeout=TIMEOUT)
+            self.assertIs(type(res), type(obj))
+            self.assertEqual(res, obj)
+
+        views = [
+            memoryview(array.array('i', range(1000))),
+            memoryview(bytes(range(256)) * 10).cast('B', (10, 256)),
+        ]
+        for view in views:
+            inq.put(view)
+        for view in views:
+            res = outq.get(timeout=TIMEOUT)
+            self.assertIsInstance(res, memoryview)
+            self.assertEqual(res.format, view.format)
+            self.assertEqual(res.shape, view.shape)
+            self.assertEqual(res.tolist(), view.tolist())
+
+        inq.put(None)
+        join_process(p)
+        close_queue(inq)
+        close_queue(outq)
+
+    @classmethod
+    def _test_exit_mid_message(cls, q):
+        # Exit after copying the first piece of the message out of the ring
+        q._ring._consume = lambda tail: os._exit(0)
+        q.get()
+
+    def test_reader_exits_mid_message(self):
+        q = self.Queue()
+        errors = []
+        q._on_queue_feeder_error = lambda e, obj: errors.append(e)
+        p = self.Process(target=self._test_exit_mid_message, args=(q,))
+        p.start()
+        # The message is larger than the ring, so the feeder thread waits
+        # for the reader to make room
+        q.put(b'x' * 100000)
+        join_process(p)
+        deadline = time.monotonic() + TIMEOUT
+        while not errors and time.monotonic() < deadline:
+            time.sleep(0.1)
+        self.assertEqual(len(errors), 1)
+        self.assertIsInstance(errors[0], BrokenPipeError)
+        # Later messages through the ring fail too
+        q.put(b'y' * 100)
+        while len(errors) < 2 and time.monotonic() < deadline:
+            time.sleep(0.1)
+        self.assertEqual(len(errors), 2)
+        self.assertIsInstance(errors[1], BrokenPipeError)
+        close_queue(q)
+
+    def test_invalid_arguments(self):
+        self.assertRaises(ValueError, multiprocessing.SharedMemoryQueue,
+                          capacity=0)
+        self.assertRaises(ValueError, multiprocessing.SharedMemoryQueue,
+                          threshold=0)
 #
 #
 #
@@ -2684,6 +2773,57 @@ class _TestPoolWorkerLifetime(BaseTestCase):
         for (j, res) in enumerate(results):
             self.assertEqual(res.get(), sqr(j))
 
+def skewed_sleep(x):
+    # every 16th task is much slower than the others
+    time.sleep(0.05 if x % 16 == 0 else 0.001)
+    return x
+
+class _TestWorkStealingPool(_TestPool):
+    ALLOWED_TYPES = ('processes', )
+    Pool = staticmethod(multiprocessing.WorkStealingPool)
+
+    def test_invalid_arguments(self):
+        self.assertRaises(ValueError, self.Pool, 0)
+        self.assertRaises(ValueError, self.Pool, 1, prefetch=0)
+        self.assertRaises(ValueError, self.Pool, 1, chunk_time=0)
+
+    def test_skewed_map(self):
+        expected = list(range(200))
+        self.assertEqual(self.pool.map(skewed_sleep, expected), expected)
+        self.assertEqual(self.pool.map(skewed_sleep, iter(expected)),
+                         expected)
+        self.assertEqual(sorted(self.pool.imap_unordered(skewed_sleep,
+                                                         expected)),
+                         expected)
+
+    def test_adaptive_chunks(self):
+        result = self.pool.map_async(sqr, range(1000))
+        self.assertIsInstance(result, multiprocessing.pool.AdaptiveMapResult)
+        self.assertEqual(result.get(), list(map(sqr, range(1000))))
+        self.assertIsNotNone(result._item_time)
+
+    def test_worker_lifetime(self):
+        p = self.Pool(3, maxtasksperchild=5)
+        origworkerpids = [w.pid for w in p._pool]
+        results = [p.apply_async(sqr, (i, )) for i in range(60)]
+        for (j, res) in enumerate(results):
+            self.assertEqual(res.get(), sqr(j))
+        self.assertEqual(3, len(p._pool))
+        self.assertEqual(p.map(sqr, range(50)), list(map(sqr, range(50))))
+        finalworkerpids = [w.pid for w in p._pool]
+        self.assertNotIn(None, finalworkerpids)
+        self.assertNotEqual(sorted(origworkerpids), sorted(finalworkerpids))
+        p.close()
+        p.join()
+
+    def test_worker_lifetime_early_close(self):
+        p = self.Pool(3, maxtasksperchild=1)
+        results = [p.apply_async(sqr, (i, 0.3)) for i in range(6)]
+        p.close()
+        p.join()
+        for (j, res) in enumerate(results):
+            self.assertEqual(res.get(), sqr(j))
+
 #
 # Test of creating a customized manager class
 #
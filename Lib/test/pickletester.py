@@ -19,6 +19,11 @@ from test.support import (
 
 from pickle import bytes_types
 
+try:
+    import _testbuffer
+except ImportError:
+    _testbuffer = None
+
 requires_32b = unittest.skipUnless(sys.maxsize < 2**32,
                                    "test is only meaningful on 32-bit builds")
 
@@ -157,6 +162,62 @@ def create_dynamic_class(name, bases):
     result.reduce_args = (name, bases)
     return result
 
+
+class ZeroCopyBytes(bytes):
+    # Hands its data out-of-band under protocol 5.
+    readonly = True
+    c_contiguous = True
+    zero_copy_reconstruct = True
+
+    def __reduce_ex__(self, protocol):
+        if protocol >= 5:
+            return type(self)._reconstruct, (pickle.PickleBuffer(self),), None
+        else:
+            return type(self)._reconstruct, (bytes(self),)
+
+    def __repr__(self):
+        return "{}({!r})".format(self.__class__.__name__, bytes(self))
+
+    __str__ = __repr__
+
+    @classmethod
+    def _reconstruct(cls, obj):
+        with memoryview(obj) as m:
+            obj = m.obj
+            if type(obj) is cls:
+                # Zero-copy
+                return obj
+            else:
+                return cls(obj)
+
+
+class ZeroCopyBytearray(bytearray):
+    # Hands its data out-of-band under protocol 5.
+    readonly = False
+    c_contiguous = True
+    zero_copy_reconstruct = True
+
+    def __reduce_ex__(self, protocol):
+        if protocol >= 5:
+            return type(self)._reconstruct, (pickle.PickleBuffer(self),), None
+        else:
+            return type(self)._reconstruct, (bytes(self),)
+
+    def __repr__(self):
+        return "{}({!r})".format(self.__class__.__name__, bytes(self))
+
+    __str__ = __repr__
+
+    @classmethod
+    def _reconstruct(cls, obj):
+        with memoryview(obj) as m:
+            obj = m.obj
+            if type(obj) is cls:
+                # Zero-copy
+                return obj
+            else:
+                return cls(obj)
+
 # DATA0 .. DATA4 are the pickles we expect under the various protocols, for
 # the object returned by create_data().
 
@@ -1416,6 +1477,25 @@ class AbstractPickleTests(unittest.TestCase):
                 p = self.dumps(s, proto)
                 self.assert_is_copy(s, self.loads(p))
 
+    def test_bytearray(self):
+        for proto in protocols:
+            for s in b'', b'xyz', b'xyz'*100:
+                b = bytearray(s)
+                p = self.dumps(b, proto)
+                bb = self.loads(p)
+                self.assertIsNot(bb, b)
+                self.assert_is_copy(b, bb)
+                if proto <= 3:
+                    # bytearray is serialized using a global reference
+                    self.assertIn(b'bytearray', p)
+                    self.assertTrue(opcode_in_pickle(pickle.GLOBAL, p))
+                elif proto == 4:
+                    self.assertIn(b'bytearray', p)
+                    self.assertTrue(opcode_in_pickle(pickle.STACK_GLOBAL, p))
+                elif proto == 5:
+                    self.assertNotIn(b'bytearray', p)
+                    self.assertTrue(opcode_in_pickle(pickle.BYTEARRAY8, p))
+
     def test_ints(self):
         for proto in protocols:
             n = sys.maxsize
@@ -2387,6 +2467,201 @@ class AbstractPickleTests(unittest.TestCase):
             with self.assertRaises((AttributeError, pickle.PicklingError)):
                 pickletools.dis(self.dumps(f, proto))
 
+    #
+    # PEP 574 tests below
+    #
+
+    def buffer_like_objects(self):
+        # Yield buffer-like objects with the bytestring "abcdef" in them
+        bytestring = b"abcdefgh"
+        yield ZeroCopyBytes(bytestring)
+        yield ZeroCopyBytearray(bytestring)
+
+    def test_in_band_buffers(self):
+        # Test in-band buffers (PEP 574)
+        for obj in self.buffer_like_objects():
+            for proto in range(0, pickle.HIGHEST_PROTOCOL + 1):
+                data = self.dumps(obj, proto)
+                if obj.c_contiguous and proto >= 5:
+                    # The raw memory bytes are serialized in physical order
+                    self.assertIn(b"abcdefgh", data)
+                self.assertEqual(count_opcode(pickle.NEXT_BUFFER, data), 0)
+                if proto >= 5:
+                    self.assertEqual(count_opcode(pickle.SHORT_BINBYTES, data),
+                                     1 if obj.readonly else 0)
+                    self.assertEqual(count_opcode(pickle.BYTEARRAY8, data),
+                                     0 if obj.readonly else 1)
+                    # Return a true value from buffer_callback should have
+                    # the same effect
+                    def buffer_callback(obj):
+                        return True
+                    data2 = self.dumps(obj, proto,
+                                       buffer_callback=buffer_callback)
+                    self.assertEqual(data2, data)
+
+                new = self.loads(data)
+                # It's a copy
+                self.assertIsNot(new, obj)
+                self.assertIs(type(new), type(obj))
+                self.assertEqual(new, obj)
+
+    def test_oob_buffers(self):
+        # Test out-of-band buffers (PEP 574)
+        for obj in self.buffer_like_objects():
+            for proto in range(0, 5):
+                # Need protocol >= 5 for buffer_callback
+                with self.assertRaises(ValueError):
+                    self.dumps(obj, proto,
+                               buffer_callback=[].append)
+            for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+                buffers = []
+                buffer_callback = lambda pb: buffers.append(pb.raw())
+                data = self.dumps(obj, proto,
+                                  buffer_callback=buffer_callback)
+                self.assertNotIn(b"abcdefgh", data)
+                self.assertEqual(count_opcode(pickle.SHORT_BINBYTES, data), 0)
+                self.assertEqual(count_opcode(pickle.BYTEARRAY8, data), 0)
+                self.assertEqual(count_opcode(pickle.NEXT_BUFFER, data), 1)
+                self.assertEqual(count_opcode(pickle.READONLY_BUFFER, data),
+                                 1 if obj.readonly else 0)
+
+                if obj.c_contiguous:
+                    self.assertEqual(bytes(buffers[0]), b"abcdefgh")
+                # Need buffers argument to unpickle properly
+                with self.assertRaises(pickle.UnpicklingError):
+                    self.loads(data)
+
+                new = self.loads(data, buffers=buffers)
+                if obj.zero_copy_reconstruct:
+                    # Zero-copy achieved
+                    self.assertIs(new, obj)
+                else:
+                    self.assertIs(type(new), type(obj))
+                    self.assertEqual(new, obj)
+                # Non-sequence buffers accepted too
+                new = self.loads(data, buffers=iter(buffers))
+                if obj.zero_copy_reconstruct:
+                    # Zero-copy achieved
+                    self.assertIs(new, obj)
+                else:
+                    self.assertIs(type(new), type(obj))
+                    self.assertEqual(new, obj)
+
+    def test_oob_buffers_writable_to_readonly(self):
+        # Test reconstructing readonly object from writable buffer
+        obj = ZeroCopyBytes(b"foobar")
+        for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+            buffers = []
+            buffer_callback = buffers.append
+            data = self.dumps(obj, proto, buffer_callback=buffer_callback)
+
+            buffers = map(bytearray, buffers)
+            new = self.loads(data, buffers=buffers)
+            self.assertIs(type(new), type(obj))
+            self.assertEqual(new, obj)
+
+    def test_oob_buffers_shared(self):
+        # An object referenced twice is memoized, and its buffer is handed
+        # out-of-band only once.
+        obj = ZeroCopyBytearray(b"foobar")
+        for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+            buffers = []
+            data = self.dumps([obj, obj], proto,
+                              buffer_callback=buffers.append)
+            self.assertEqual(len(buffers), 1)
+            new = self.loads(data, buffers=buffers)
+            self.assertIs(new[0], obj)
+            self.assertIs(new[1], obj)
+
+    @unittest.skipIf(_testbuffer is None, "requires _testbuffer")
+    def test_in_band_buffers_fortran_shared(self):
+        # A Fortran-contiguous buffer referenced twice is memoized too
+        arr = _testbuffer.ndarray(list(range(6)), shape=(2, 3), format='B',
+                                  flags=_testbuffer.ND_FORTRAN)
+        pb = pickle.PickleBuffer(arr)
+        for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+            data = self.dumps([pb, pb], proto)
+            self.assertEqual(count_opcode(pickle.SHORT_BINBYTES, data), 1)
+            new = self.loads(data)
+            self.assertEqual(new[0], bytes(range(6)))
+            self.assertIs(new[1], new[0])
+
+    def test_picklebuffer_error(self):
+        # PickleBuffer forbidden with protocol < 5
+        pb = pickle.PickleBuffer(b"foobar")
+        for proto in range(0, 5):
+            with self.assertRaises(pickle.PickleError):
+                self.dumps(pb, proto)
+
+    def test_buffers_error(self):
+        pb = pickle.PickleBuffer(b"foobar")
+        for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+            data = self.dumps(pb, proto, buffer_callback=[].append)
+            # Non iterable buffers
+            with self.assertRaises(TypeError):
+                self.loads(data, buffers=object())
+            # Buffer iterable exhausts too early
+            with self.assertRaises(pickle.UnpicklingError):
+                self.loads(data, buffers=[])
+
+    def test_large_bytearray(self):
+        # Larger than a frame, so that the payload bypasses the frames
+        # (and is read directly into the bytearray by the unpickler).
+        data = bytearray(b'x' * 100000 + b'y' * 100000)
+        for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+            p = self.dumps([data, pickle.PickleBuffer(bytes(data)), 1],
+                           proto)
+            new = self.loads(p)
+            self.assertEqual(new, [data, bytes(data), 1])
+            self.assertIs(type(new[0]), bytearray)
+            self.assertIs(type(new[1]), bytes)
+
+    def test_memoize_false(self):
+        shared = ['shared']
+        data = {'a': [1, 2.5, 'text', b'bytes', None, True],
+                'b': {'nested': (1, 'two', [3, {}])},
+                'c': frozenset([1, 2]), 'd': {3, 4},
+                'e': shared, 'f': shared}
+        memo_opcodes = {'PUT', 'BINPUT', 'LONG_BINPUT', 'MEMOIZE',
+                        'GET', 'BINGET', 'LONG_BINGET'}
+        for proto in protocols:
+            with self.subTest(proto=proto):
+                s = self.dumps(data, proto, memoize=False)
+                self.assertFalse({op.name for op, _, _ in
+                                  pickletools.genops(s)} & memo_opcodes)
+                new = self.loads(s)
+                self.assertEqual(new, data)
+                # Shared references are pickled by value.
+                self.assertIsNot(new['e'], new['f'])
+
+    def test_memoize_false_recursive(self):
+        l = []
+        l.append(l)
+        d = {}
+        d[1] = [d]
+        a = C()
+        a.attr = a
+        for proto in protocols:
+            for obj in l, d, a:
+                with self.subTest(proto=proto, type=type(obj)):
+                    with self.assertRaisesRegex(ValueError, 'cyclic'):
+                        self.dumps(obj, proto, memoize=False)
+
+    def test_memoize_false_many_frozensets(self):
+        # Repeated frozensets are not cycles, however many there are.
+        fs = frozenset([1])
+        data = [fs] * 100
+        for proto in protocols:
+            with self.subTest(proto=proto):
+                new = self.loads(self.dumps(data, proto, memoize=False))
+                self.assertEqual(new, data)
+
+    def test_memoize_keyword_only(self):
+        if not hasattr(self, 'pickler'):
+            self.skipTest('pickler class is not defined')
+        with self.assertRaises(TypeError):
+            self.pickler(io.BytesIO(), 0, True, None, False)
+
 
 class BigmemPickleTests(unittest.TestCase):
 
@@ -2671,7 +2946,7 @@ class AbstractPickleModuleTests(unittest.TestCase):
 
     def test_highest_protocol(self):
         # Of course this needs to be changed when HIGHEST_PROTOCOL changes.
-        self.assertEqual(pickle.HIGHEST_PROTOCOL, 4)
+        self.assertEqual(pickle.HIGHEST_PROTOCOL, 5)
 
     def test_callapi(self):
         f = io.BytesIO()
@@ -2919,6 +3194,142 @@ class AbstractPicklerUnpicklerObjectTests(unittest.TestCase):
                 self.assertEqual(unpickler.load(), data)
 
 
+class AbstractIncrementalUnpicklerTests(unittest.TestCase):
+
+    unpickler_class = None
+
+    def feed_chunks(self, unpickler, data, chunk_size):
+        result = []
+        for i in range(0, len(data), chunk_size):
+            result.extend(unpickler.feed(data[i:i+chunk_size]))
+        return result
+
+    def check_chunks(self, objs, chunk_sizes):
+        for proto in protocols:
+            data = b''.join(pickle.dumps(obj, proto) for obj in objs)
+            for chunk_size in chunk_sizes + [len(data)]:
+                with self.subTest(proto=proto, chunk_size=chunk_size):
+                    unpickler = self.unpickler_class()
+                    result = self.feed_chunks(unpickler, data, chunk_size)
+                    unpickler.close()
+                    self.assertEqual(len(result), len(objs))
+                    for obj, new in zip(objs, result):
+                        self.assertEqual(type(new), type(obj))
+                        if type(obj) is K:
+                            self.assertEqual(new.value, obj.value)
+                        else:
+                            self.assertEqual(new, obj)
+
+    def test_small_chunks(self):
+        self.check_chunks([None, 1, -2**70, 1.5, 'abc', 'é' * 100, b'x' * 300,
+                           (1, 2), list(range(100)),
+                           {'a': [1, {2: 3}], 'b': {4, 5}}, frozenset([6]),
+                           K(1)],
+                          [1, 3, 100])
+
+    def test_large_chunks(self):
+        self.check_chunks([list(range(20000)), b'y' * 200000, 'z' * 100000,
+                           bytearray(b'w' * 70000),
+                           {str(i): i for i in range(3000)}],
+                          [5000])
+
+    def test_memo_per_pickle(self):
+        l = [1]
+        data = pickle.dumps([l, l], 4)
+        unpickler = self.unpickler_class()
+        first, second = unpickler.feed(data + data)
+        self.assertIs(first[0], first[1])
+        self.assertIs(second[0], second[1])
+        self.assertIsNot(first[0], second[0])
+
+    def test_yield_per_pickle(self):
+        first = pickle.dumps('first', 4)
+        second = pickle.dumps('second', 4)
+        unpickler = self.unpickler_class()
+        self.assertEqual(unpickler.feed(first + second[:5]), ['first'])
+        self.assertEqual(unpickler.feed(second[5:]), ['second'])
+        unpickler.close()
+
+    def test_frames_loaded_before_stop(self):
+        # Complete frames are executed while the rest of the pickle is
+        # still to come.
+        loaded = []
+        class Unpickler(self.unpickler_class):
+            def find_class(self, module, name):
+                loaded.append(name)
+                return super().find_class(module, name)
+        obj = [K, b'x' * 200000, [str(i) for i in range(20000)], C]
+        data = pickle.dumps(obj, 4)
+        unpickler = Unpickler()
+        self.assertEqual(unpickler.feed(data[:len(data) // 2]), [])
+        self.assertEqual(loaded, ['K'])
+        new, = unpickler.feed(data[len(data) // 2:])
+        self.assertEqual(loaded, ['K', 'C'])
+        self.assertEqual(new, obj)
+        unpickler.close()
+
+    def test_close(self):
+        data = pickle.dumps([1, 2, 3], 4)
+        for n in 1, 3, len(data) - 1:
+            unpickler = self.unpickler_class()
+            self.assertEqual(unpickler.feed(data[:n]), [])
+            with self.assertRaisesRegex(pickle.UnpicklingError, 'truncated'):
+                unpickler.close()
+            # The unpickler can be reused for a new stream.
+            self.assertEqual(unpickler.feed(data), [[1, 2, 3]])
+            unpickler.close()
+
+    def test_error(self):
+        unpickler = self.unpickler_class()
+        with self.assertRaises((pickle.UnpicklingError, KeyError)):
+            unpickler.feed(b'\x80\x04\xff')
+        # The bad input is discarded.
+        self.assertEqual(unpickler.feed(pickle.dumps('ok', 4)), ['ok'])
+        unpickler.close()
+
+    def test_persistent_load(self):
+        class Unpickler(self.unpickler_class):
+            def persistent_load(self, pid):
+                return pid.upper()
+        data = b'(Pabc\nQ.'
+        self.assertEqual(Unpickler().feed(data), ['ABC'])
+
+    def test_reentrant_calls(self):
+        # find_class() cannot reset or feed the unpickler while its
+        # pending input is loaded.
+        obj = [K, b'x' * 1000, C]
+        data = pickle.dumps(obj, 4)
+        for method, args in [('close', ()), ('feed', (data,)),
+                             ('__init__', ())]:
+            with self.subTest(method=method):
+                errors = []
+                class Unpickler(self.unpickler_class):
+                    def find_class(self, module, name):
+                        try:
+                            getattr(self, method)(*args)
+                        except RuntimeError as exc:
+                            errors.append(exc)
+                        return super().find_class(module, name)
+                unpickler = Unpickler()
+                self.assertEqual(unpickler.feed(data), [obj])
+                self.assertEqual(len(errors), 2)
+                # The unpickler is still usable.
+                self.assertEqual(unpickler.feed(data[:10]), [])
+                self.assertEqual(unpickler.feed(data[10:]), [obj])
+                unpickler.close()
+
+    @unittest.skipIf(not hasattr(pickle, 'PickleBuffer'),
+                     'pickle protocol 5 is not supported')
+    def test_buffers(self):
+        objs = [ZeroCopyBytearray(b'abc'), ZeroCopyBytearray(b'defg')]
+        buffers = []
+        data = b''.join(pickle.dumps(obj, 5, buffer_callback=buffers.append)
+                        for obj in objs)
+        unpickler = self.unpickler_class(buffers=buffers)
+        self.assertEqual(self.feed_chunks(unpickler, data, 2), objs)
+        unpickler.close()
+
+
 # Tests for dispatch_table attribute
 
 REDUCE_A = 'reduce_A'
@@ -213,6 +213,47 @@ class BaseTest:
                 if loc != -1:
                     self.assertEqual(i[loc:loc+len(j)], j)
 
+    def test_find_periodic_pattern(self):
+        # Long periodic haystacks make the search switch to the two-way
+        # algorithm part of the way through
+        for unit in ('a', 'ab', 'abc', 'aab'):
+            for reps in (10, 50, 200):
+                needle = unit * reps + 'x' + unit * reps
+                haystack = unit * 5000
+                self.checkequal(-1, haystack, 'find', needle)
+                self.checkequal(0, haystack, 'count', needle)
+                pos = len(haystack) - 7 * len(unit)
+                haystack2 = haystack[:pos] + needle + haystack[pos:]
+                self.checkequal(pos, haystack2, 'find', needle)
+                self.checkequal(1, haystack2, 'count', needle)
+                self.checkequal(pos, haystack2, 'index', needle)
+                self.checkequal(True, haystack2, '__contains__', needle)
+            needle = unit * 100
+            haystack = unit * 5000 + 'x' + unit * 5000
+            self.checkequal(100, haystack, 'count', needle)
+            self.checkequal(len(unit) * 50, haystack, 'find', needle,
+                            len(unit) * 50)
+            self.checkequal([unit * 5000, unit * 5000], haystack, 'split',
+                            'x')
+
+    def test_find_long_pattern(self):
+        # Long patterns start out skipping through text that shares no
+        # characters with them, then continue with another loop when the
+        # skips become short
+        needle = 'ABCDEFGHIJKLMNOPQRSTUVWXYZ' * 3 + 'z'
+        close = needle[:-1] + 'y'
+        far = 'abcdefghijklmnopqrstuvwxy' * 40
+        near = close * 40
+        for haystack in (far + needle + near + needle + near,
+                         near + needle + far + needle + near,
+                         far + near + needle + needle + far):
+            pos = haystack.find(needle)
+            self.checkequal(pos, haystack, 'find', needle)
+            self.checkequal(2, haystack, 'count', needle)
+            self.checkequal(1, haystack, 'count', needle, pos + 1)
+            self.checkequal(haystack.split(needle), haystack, 'split', needle)
+            self.checkequal(-1, haystack, 'find', needle[1:] + 'b')
+
     def test_rfind(self):
         self.checkequal(9,  'abcdefghiabc', 'rfind', 'abc')
         self.checkequal(12, 'abcdefghiabc', 'rfind', '')
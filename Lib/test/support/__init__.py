@@ -1603,8 +1603,12 @@ def python_is_optimized():
     return final_opt not in ('', '-O0', '-Og')
 
 
+# ob_refcnt, ob_type
 _header = 'nP'
 _align = '0n'
+if 'b' in getattr(sys, 'abiflags', ''):
+    # Py_BIASED_REFCNT: ob_tid, ob_ref_local, ob_type
+    _header = 'PnP'
 if hasattr(sys, "gettotalrefcount"):
     _header = '2P' + _header
     _align = '0P'
@@ -1616,6 +1620,13 @@ def calcobjsize(fmt):
 def calcvobjsize(fmt):
     return struct.calcsize(_vheader + fmt + _align)
 
+def calcdictindicessize(size):
+    """Size of the hash table of a dict with size (at most 128) slots."""
+    if sysconfig.get_config_var('Py_DICT_CONTROL_BYTES'):
+        # Py_DICT_CONTROL_BYTES: 16 control bytes per group of 16 slots
+        return size + 16 * max(size // 16, 1)
+    return size
+
 
 _TPFLAGS_HAVE_GC = 1<<14
 _TPFLAGS_HEAPTYPE = 1<<9
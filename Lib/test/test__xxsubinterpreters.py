@@ -1302,6 +1302,136 @@ class ChannelTests(TestBase):
         with self.assertRaises(interpreters.ChannelEmptyError):
             interpreters.channel_recv(cid)
 
+    def test_recv_block_timeout_empty(self):
+        cid = interpreters.channel_create()
+        before = time.monotonic()
+        with self.assertRaises(interpreters.ChannelEmptyError):
+            interpreters.channel_recv(cid, block=True, timeout=0.1)
+        self.assertGreaterEqual(time.monotonic() - before, 0.1)
+
+    def test_recv_block_bad_timeout(self):
+        cid = interpreters.channel_create()
+        with self.assertRaises(ValueError):
+            interpreters.channel_recv(cid, block=True, timeout=-1)
+
+    def test_recv_block_different_threads(self):
+        cid = interpreters.channel_create()
+
+        def f():
+            obj = interpreters.channel_recv(cid, block=True)
+            interpreters.channel_send(cid.send, obj + b'!')
+        t = threading.Thread(target=f)
+        t.start()
+
+        time.sleep(0.1)
+        interpreters.channel_send(cid, b'spam')
+        t.join()
+        obj = interpreters.channel_recv(cid)
+
+        self.assertEqual(obj, b'spam!')
+
+    def test_recv_block_different_interpreters_and_threads(self):
+        cid = interpreters.channel_create()
+        id1 = interpreters.create()
+
+        def f():
+            _run_output(id1, dedent(f"""
+                import _xxsubinterpreters as _interpreters
+                obj = _interpreters.channel_recv({cid}, block=True)
+                assert(obj == b'spam')
+                _interpreters.channel_send({cid}, b'eggs')
+                """))
+        t = threading.Thread(target=f)
+        t.start()
+
+        interpreters.channel_send(cid, b'spam')
+        t.join()
+        obj = interpreters.channel_recv(cid)
+
+        self.assertEqual(obj, b'eggs')
+
+    def test_recv_block_multiple_waiters(self):
+        cid = interpreters.channel_create()
+        results = []
+
+        def f():
+            results.append(interpreters.channel_recv(cid, block=True,
+                                                     timeout=10))
+        threads = [threading.Thread(target=f) for _ in range(5)]
+        for t in threads:
+            t.start()
+        time.sleep(0.1)
+        interpreters.channel_send_many(cid, [b'spam'] * 5)
+        for t in threads:
+            t.join()
+
+        self.assertEqual(results, [b'spam'] * 5)
+
+    def test_recv_block_closed(self):
+        cid = interpreters.channel_create()
+        interpreters.channel_send(cid, b'spam')
+        interpreters.channel_recv(cid)
+        exc = None
+
+        def f():
+            nonlocal exc
+            try:
+                interpreters.channel_recv(cid, block=True, timeout=10)
+            except Exception as e:
+                exc = e
+        t = threading.Thread(target=f)
+        t.start()
+        time.sleep(0.1)
+        interpreters.channel_close(cid)
+        t.join()
+
+        self.assertIsInstance(exc, interpreters.ChannelClosedError)
+
+    def test_send_recv_many(self):
+        cid = interpreters.channel_create()
+        interpreters.channel_send_many(cid, [b'spam', b'eggs', b'ham'])
+        first = interpreters.channel_recv_many(cid, 2)
+        rest = interpreters.channel_recv_many(cid, 10)
+
+        self.assertEqual(first, [b'spam', b'eggs'])
+        self.assertEqual(rest, [b'ham'])
+        with self.assertRaises(interpreters.ChannelEmptyError):
+            interpreters.channel_recv_many(cid, 10)
+
+    def test_send_many_not_shareable(self):
+        cid = interpreters.channel_create()
+        with self.assertRaises(ValueError):
+            interpreters.channel_send_many(cid, [b'spam', object()])
+        # Nothing was sent.
+        with self.assertRaises(interpreters.ChannelEmptyError):
+            interpreters.channel_recv(cid)
+
+    def test_send_many_empty(self):
+        cid = interpreters.channel_create()
+        interpreters.channel_send_many(cid, [])
+        with self.assertRaises(interpreters.ChannelEmptyError):
+            interpreters.channel_recv(cid)
+
+    def test_recv_many_bad_max(self):
+        cid = interpreters.channel_create()
+        with self.assertRaises(ValueError):
+            interpreters.channel_recv_many(cid, 0)
+
+    def test_recv_many_block(self):
+        cid = interpreters.channel_create()
+
+        def f():
+            time.sleep(0.1)
+            interpreters.channel_send_many(cid, [1, 2, 3])
+        t = threading.Thread(target=f)
+        t.start()
+        objs = interpreters.channel_recv_many(cid, 3, block=True, timeout=10)
+        t.join()
+        while len(objs) < 3:
+            objs += interpreters.channel_recv_many(cid, 3)
+
+        self.assertEqual(objs, [1, 2, 3])
+
     def test_run_string_arg_unresolved(self):
         cid = interpreters.channel_create()
         interp = interpreters.create()
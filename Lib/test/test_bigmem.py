@@ -772,6 +772,12 @@ class BytesTest(unittest.TestCase, BaseStrTest):
         s = self.from_latin1('.') * size
         self.assertEqual(len(s.decode('utf-8')), size)
 
+    @bigmemtest(size=_2G + 2, memuse=2 + ascii_char_size)
+    def test_decode_continuation_bytes(self, size):
+        # More than 2**31 continuation bytes
+        s = b'\xc3\xa9' * size
+        self.assertEqual(len(s.decode('utf-8')), size)
+
     @bigmemtest(size=_2G, memuse=2)
     def test_capitalize(self, size):
         self._test_capitalize(size)
@@ -21,15 +21,21 @@ import weakref
 from pickle import PicklingError
 
 from concurrent import futures
+from concurrent.futures import _base
 from concurrent.futures._base import (
     PENDING, RUNNING, CANCELLED, CANCELLED_AND_NOTIFIED, FINISHED, Future,
     BrokenExecutor)
 from concurrent.futures.process import BrokenProcessPool
 from multiprocessing import get_context
 
+try:
+    import _concurrent_futures
+except ImportError:
+    _concurrent_futures = None
 
-def create_future(state=PENDING, exception=None, result=None):
-    f = Future()
+
+def create_future(state=PENDING, exception=None, result=None, cls=Future):
+    f = cls()
     f._state = state
     f._exception = exception
     f._result = result
@@ -981,14 +987,30 @@ create_executor_tests(ExecutorDeadlockTest,
                                        ProcessPoolSpawnMixin))
 
 
-class FutureTests(BaseTestCase):
+class FutureTests:
+    Future = None
+
+    def setUp(self):
+        super().setUp()
+        self.PENDING_FUTURE = self.create_future(state=PENDING)
+        self.RUNNING_FUTURE = self.create_future(state=RUNNING)
+        self.CANCELLED_FUTURE = self.create_future(state=CANCELLED)
+        self.CANCELLED_AND_NOTIFIED_FUTURE = self.create_future(
+                state=CANCELLED_AND_NOTIFIED)
+        self.EXCEPTION_FUTURE = self.create_future(state=FINISHED,
+                                                   exception=OSError())
+        self.SUCCESSFUL_FUTURE = self.create_future(state=FINISHED, result=42)
+
+    def create_future(self, state=PENDING, exception=None, result=None):
+        return create_future(state, exception, result, cls=self.Future)
+
     def test_done_callback_with_result(self):
         callback_result = None
         def fn(callback_future):
             nonlocal callback_result
             callback_result = callback_future.result()
 
-        f = Future()
+        f = self.Future()
         f.add_done_callback(fn)
         f.set_result(5)
         self.assertEqual(5, callback_result)
@@ -999,7 +1021,7 @@ class FutureTests(BaseTestCase):
             nonlocal callback_exception
             callback_exception = callback_future.exception()
 
-        f = Future()
+        f = self.Future()
         f.add_done_callback(fn)
         f.set_exception(Exception('test'))
         self.assertEqual(('test',), callback_exception.args)
@@ -1010,7 +1032,7 @@ class FutureTests(BaseTestCase):
             nonlocal was_cancelled
             was_cancelled = callback_future.cancelled()
 
-        f = Future()
+        f = self.Future()
         f.add_done_callback(fn)
         self.assertTrue(f.cancel())
         self.assertTrue(was_cancelled)
@@ -1029,7 +1051,7 @@ class FutureTests(BaseTestCase):
                 nonlocal fn_was_called
                 fn_was_called = True
 
-            f = Future()
+            f = self.Future()
             f.add_done_callback(raising_fn)
             f.add_done_callback(fn)
             f.set_result(5)
@@ -1043,7 +1065,7 @@ class FutureTests(BaseTestCase):
             nonlocal callback_result
             callback_result = callback_future.result()
 
-        f = Future()
+        f = self.Future()
         f.set_result(5)
         f.add_done_callback(fn)
         self.assertEqual(5, callback_result)
@@ -1054,7 +1076,7 @@ class FutureTests(BaseTestCase):
             nonlocal callback_exception
             callback_exception = callback_future.exception()
 
-        f = Future()
+        f = self.Future()
         f.set_exception(Exception('test'))
         f.add_done_callback(fn)
         self.assertEqual(('test',), callback_exception.args)
@@ -1065,35 +1087,35 @@ class FutureTests(BaseTestCase):
             nonlocal was_cancelled
             was_cancelled = callback_future.cancelled()
 
-        f = Future()
+        f = self.Future()
         self.assertTrue(f.cancel())
         f.add_done_callback(fn)
         self.assertTrue(was_cancelled)
 
     def test_repr(self):
-        self.assertRegex(repr(PENDING_FUTURE),
+        self.assertRegex(repr(self.PENDING_FUTURE),
                          '<Future at 0x[0-9a-f]+ state=pending>')
-        self.assertRegex(repr(RUNNING_FUTURE),
+        self.assertRegex(repr(self.RUNNING_FUTURE),
                          '<Future at 0x[0-9a-f]+ state=running>')
-        self.assertRegex(repr(CANCELLED_FUTURE),
+        self.assertRegex(repr(self.CANCELLED_FUTURE),
                          '<Future at 0x[0-9a-f]+ state=cancelled>')
-        self.assertRegex(repr(CANCELLED_AND_NOTIFIED_FUTURE),
+        self.assertRegex(repr(self.CANCELLED_AND_NOTIFIED_FUTURE),
                          '<Future at 0x[0-9a-f]+ state=cancelled>')
         self.assertRegex(
-                repr(EXCEPTION_FUTURE),
+                repr(self.EXCEPTION_FUTURE),
                 '<Future at 0x[0-9a-f]+ state=finished raised OSError>')
         self.assertRegex(
-                repr(SUCCESSFUL_FUTURE),
+                repr(self.SUCCESSFUL_FUTURE),
                 '<Future at 0x[0-9a-f]+ state=finished returned int>')
 
 
     def test_cancel(self):
-        f1 = create_future(state=PENDING)
-        f2 = create_future(state=RUNNING)
-        f3 = create_future(state=CANCELLED)
-        f4 = create_future(state=CANCELLED_AND_NOTIFIED)
-        f5 = create_future(state=FINISHED, exception=OSError())
-        f6 = create_future(state=FINISHED, result=5)
+        f1 = self.create_future(state=PENDING)
+        f2 = self.create_future(state=RUNNING)
+        f3 = self.create_future(state=CANCELLED)
+        f4 = self.create_future(state=CANCELLED_AND_NOTIFIED)
+        f5 = self.create_future(state=FINISHED, exception=OSError())
+        f6 = self.create_future(state=FINISHED, result=5)
 
         self.assertTrue(f1.cancel())
         self.assertEqual(f1._state, CANCELLED)
@@ -1114,40 +1136,40 @@ class FutureTests(BaseTestCase):
         self.assertEqual(f6._state, FINISHED)
 
     def test_cancelled(self):
-        self.assertFalse(PENDING_FUTURE.cancelled())
-        self.assertFalse(RUNNING_FUTURE.cancelled())
-        self.assertTrue(CANCELLED_FUTURE.cancelled())
-        self.assertTrue(CANCELLED_AND_NOTIFIED_FUTURE.cancelled())
-        self.assertFalse(EXCEPTION_FUTURE.cancelled())
-        self.assertFalse(SUCCESSFUL_FUTURE.cancelled())
+        self.assertFalse(self.PENDING_FUTURE.cancelled())
+        self.assertFalse(self.RUNNING_FUTURE.cancelled())
+        self.assertTrue(self.CANCELLED_FUTURE.cancelled())
+        self.assertTrue(self.CANCELLED_AND_NOTIFIED_FUTURE.cancelled())
+        self.assertFalse(self.EXCEPTION_FUTURE.cancelled())
+        self.assertFalse(self.SUCCESSFUL_FUTURE.cancelled())
 
     def test_done(self):
-        self.assertFalse(PENDING_FUTURE.done())
-        self.assertFalse(RUNNING_FUTURE.done())
-        self.assertTrue(CANCELLED_FUTURE.done())
-        self.assertTrue(CANCELLED_AND_NOTIFIED_FUTURE.done())
-        self.assertTrue(EXCEPTION_FUTURE.done())
-        self.assertTrue(SUCCESSFUL_FUTURE.done())
+        self.assertFalse(self.PENDING_FUTURE.done())
+        self.assertFalse(self.RUNNING_FUTURE.done())
+        self.assertTrue(self.CANCELLED_FUTURE.done())
+        self.assertTrue(self.CANCELLED_AND_NOTIFIED_FUTURE.done())
+        self.assertTrue(self.EXCEPTION_FUTURE.done())
+        self.assertTrue(self.SUCCESSFUL_FUTURE.done())
 
     def test_running(self):
-        self.assertFalse(PENDING_FUTURE.running())
-        self.assertTrue(RUNNING_FUTURE.running())
-        self.assertFalse(CANCELLED_FUTURE.running())
-        self.assertFalse(CANCELLED_AND_NOTIFIED_FUTURE.running())
-        self.assertFalse(EXCEPTION_FUTURE.running())
-        self.assertFalse(SUCCESSFUL_FUTURE.running())
+        self.assertFalse(self.PENDING_FUTURE.running())
+        self.assertTrue(self.RUNNING_FUTURE.running())
+        self.assertFalse(self.CANCELLED_FUTURE.running())
+        self.assertFalse(self.CANCELLED_AND_NOTIFIED_FUTURE.running())
+        self.assertFalse(self.EXCEPTION_FUTURE.running())
+        self.assertFalse(self.SUCCESSFUL_FUTURE.running())
 
     def test_result_with_timeout(self):
         self.assertRaises(futures.TimeoutError,
-                          PENDING_FUTURE.result, timeout=0)
+                          self.PENDING_FUTURE.result, timeout=0)
         self.assertRaises(futures.TimeoutError,
-                          RUNNING_FUTURE.result, timeout=0)
+                          self.RUNNING_FUTURE.result, timeout=0)
         self.assertRaises(futures.CancelledError,
-                          CANCELLED_FUTURE.result, timeout=0)
+                          self.CANCELLED_FUTURE.result, timeout=0)
         self.assertRaises(futures.CancelledError,
-                          CANCELLED_AND_NOTIFIED_FUTURE.result, timeout=0)
-        self.assertRaises(OSError, EXCEPTION_FUTURE.result, timeout=0)
-        self.assertEqual(SUCCESSFUL_FUTURE.result(timeout=0), 42)
+                          self.CANCELLED_AND_NOTIFIED_FUTURE.result, timeout=0)
+        self.assertRaises(OSError, self.EXCEPTION_FUTURE.result, timeout=0)
+        self.assertEqual(self.SUCCESSFUL_FUTURE.result(timeout=0), 42)
 
     def test_result_with_success(self):
         # TODO(brian@sweetapp.com): This test is timing dependent.
@@ -1156,7 +1178,7 @@ class FutureTests(BaseTestCase):
             time.sleep(1)
             f1.set_result(42)
 
-        f1 = create_future(state=PENDING)
+        f1 = self.create_future(state=PENDING)
         t = threading.Thread(target=notification)
         t.start()
 
@@ -1170,7 +1192,7 @@ class FutureTests(BaseTestCase):
             time.sleep(1)
             f1.cancel()
 
-        f1 = create_future(state=PENDING)
+        f1 = self.create_future(state=PENDING)
         t = threading.Thread(target=notification)
         t.start()
 
@@ -1179,16 +1201,16 @@ class FutureTests(BaseTestCase):
 
     def test_exception_with_timeout(self):
         self.assertRaises(futures.TimeoutError,
-                          PENDING_FUTURE.exception, timeout=0)
+                          self.PENDING_FUTURE.exception, timeout=0)
         self.assertRaises(futures.TimeoutError,
-                          RUNNING_FUTURE.exception, timeout=0)
+                          self.RUNNING_FUTURE.exception, timeout=0)
         self.assertRaises(futures.CancelledError,
-                          CANCELLED_FUTURE.exception, timeout=0)
+                          self.CANCELLED_FUTURE.exception, timeout=0)
         self.assertRaises(futures.CancelledError,
-                          CANCELLED_AND_NOTIFIED_FUTURE.exception, timeout=0)
-        self.assertTrue(isinstance(EXCEPTION_FUTURE.exception(timeout=0),
+                          self.CANCELLED_AND_NOTIFIED_FUTURE.exception, timeout=0)
+        self.assertTrue(isinstance(self.EXCEPTION_FUTURE.exception(timeout=0),
                                    OSError))
-        self.assertEqual(SUCCESSFUL_FUTURE.exception(timeout=0), None)
+        self.assertEqual(self.SUCCESSFUL_FUTURE.exception(timeout=0), None)
 
     def test_exception_with_success(self):
         def notification():
@@ -1199,7 +1221,7 @@ class FutureTests(BaseTestCase):
                 f1._exception = OSError()
                 f1._condition.notify_all()
 
-        f1 = create_future(state=PENDING)
+        f1 = self.create_future(state=PENDING)
         t = threading.Thread(target=notification)
         t.start()
 
@@ -1207,7 +1229,7 @@ class FutureTests(BaseTestCase):
         t.join()
 
     def test_multiple_set_result(self):
-        f = create_future(state=PENDING)
+        f = self.create_future(state=PENDING)
         f.set_result(1)
 
         with self.assertRaisesRegex(
@@ -1221,7 +1243,7 @@ class FutureTests(BaseTestCase):
         self.assertEqual(f.result(), 1)
 
     def test_multiple_set_exception(self):
-        f = create_future(state=PENDING)
+        f = self.create_future(state=PENDING)
         e = ValueError()
         f.set_exception(e)
 
@@ -1234,6 +1256,87 @@ class FutureTests(BaseTestCase):
 
         self.assertEqual(f.exception(), e)
 
+    def test_result_multiple_waiters(self):
+        f = self.create_future(state=PENDING)
+        results = []
+        def waiter():
+            results.append(f.result(timeout=5))
+        threads = [threading.Thread(target=waiter) for _ in range(4)]
+        for t in threads:
+            t.start()
+        time.sleep(0.1)
+        f.set_result(42)
+        for t in threads:
+            t.join()
+        self.assertEqual(results, [42] * 4)
+
+    def test_reset_state(self):
+        f = self.create_future(state=PENDING)
+        self.assertRaises(futures.TimeoutError, f.result, timeout=0)
+        f.set_result(1)
+        self.assertEqual(f.result(timeout=0), 1)
+        f._state = RUNNING
+        self.assertRaises(futures.TimeoutError, f.result, timeout=0.01)
+        f._state = FINISHED
+        self.assertEqual(f.result(timeout=0), 1)
+
+    def test_exception_traceback(self):
+        def raising():
+            raise ValueError('boom')
+        f = self.Future()
+        try:
+            raising()
+        except ValueError as exc:
+            f.set_exception(exc)
+        try:
+            f.result()
+        except ValueError as exc:
+            tb = exc.__traceback__
+        else:
+            self.fail('ValueError not raised')
+        while tb.tb_next is not None:
+            tb = tb.tb_next
+        self.assertEqual(tb.tb_frame.f_code.co_name, 'raising')
+
+    def test_subclass(self):
+        class MyFuture(self.Future):
+            pass
+        f = MyFuture()
+        f.extra = 'value'
+        self.assertEqual(f.extra, 'value')
+        self.assertRegex(repr(f), '<MyFuture at 0x[0-9a-f]+ state=pending>')
+        r = weakref.ref(f)
+        f.set_result(3)
+        self.assertEqual(futures.wait([f]).done, {f})
+        del f
+        test.support.gc_collect()
+        self.assertIsNone(r())
+
+
+class PyFutureTests(FutureTests, BaseTestCase):
+    Future = _base._PyFuture
+
+
+@unittest.skipIf(_concurrent_futures is None, 'requires _concurrent_futures')
+class CFutureTests(FutureTests, BaseTestCase):
+    Future = getattr(_base, '_CFuture', None)
+
+    def test_invalid_state(self):
+        f = self.Future()
+        with self.assertRaises(ValueError):
+            f._state = 'BOGUS'
+        with self.assertRaises(ValueError):
+            f._state = None
+        self.assertEqual(f._state, PENDING)
+
+    def test_condition_created_lazily(self):
+        f = self.Future()
+        self.assertNotIn('_condition', f.__dict__)
+        f.set_result(1)
+        cond = f._condition
+        self.assertIs(f._condition, cond)
+        self.assertEqual(f.result(), 1)
+
 
 @test.support.reap_threads
 def test_main():
@@ -7,6 +7,7 @@ import string
 import sys
 import unittest
 import weakref
+from collections import frozendict
 from test import support
 
 
@@ -766,6 +767,35 @@ class DictTest(unittest.TestCase):
         resizing = True
         d[9] = 6
 
+    def test_colliding_hashes(self):
+        # Keys whose hashes only differ in their high bits, or not at all,
+        # share their probe sequences; lookups must still find every key
+        # across deletions and reinsertions.
+        class Same:
+            def __init__(self, i):
+                self.i = i
+            def __hash__(self):
+                return 42
+            def __eq__(self, other):
+                return isinstance(other, Same) and self.i == other.i
+        for keys in ([i << 40 for i in range(2000)],
+                     [-(i << 52) for i in range(2000)],
+                     [Same(i) for i in range(200)]):
+            d = dict.fromkeys(keys, 0)
+            for k in keys[::2]:
+                del d[k]
+            self.assertEqual(len(d), len(keys) // 2)
+            for k in keys[::4]:
+                d[k] = 1
+            for i, k in enumerate(keys):
+                if i % 2:
+                    self.assertEqual(d[k], 0)
+                elif i % 4 == 0:
+                    self.assertEqual(d[k], 1)
+                else:
+                    self.assertNotIn(k, d)
+            self.assertEqual(list(d), keys[1::2] + keys[::4])
+
     def test_empty_presized_dict_in_freelist(self):
         # Bug #3537: if an empty but presized dict with a size larger
         # than 7 was in the freelist, it triggered an assertion failure
@@ -905,53 +935,63 @@ class DictTest(unittest.TestCase):
 
     @support.cpython_only
     def test_splittable_setdefault(self):
-        """split table must be combined when setdefault()
-        breaks insertion order"""
+        """split table keeps its own insertion order when setdefault()
+        breaks the shared one"""
+        import _testcapi
         a, b = self.make_shared_key_dict(2)
 
         a['a'] = 1
-        size_a = sys.getsizeof(a)
         a['b'] = 2
         b.setdefault('b', 2)
-        size_b = sys.getsizeof(b)
         b['a'] = 1
 
-        self.assertGreater(size_b, size_a)
+        self.assertTrue(_testcapi.dict_hassplittable(a))
+        self.assertTrue(_testcapi.dict_hassplittable(b))
+        self.assertEqual(sys.getsizeof(b), sys.getsizeof(a))
         self.assertEqual(list(a), ['x', 'y', 'z', 'a', 'b'])
         self.assertEqual(list(b), ['x', 'y', 'z', 'b', 'a'])
 
     @support.cpython_only
     def test_splittable_del(self):
-        """split table must be combined when del d[k]"""
+        """split table stays split when del d[k]"""
+        import _testcapi
         a, b = self.make_shared_key_dict(2)
 
         orig_size = sys.getsizeof(a)
 
-        del a['y']  # split table is combined
+        del a['y']
         with self.assertRaises(KeyError):
             del a['y']
 
-        self.assertGreater(sys.getsizeof(a), orig_size)
+        self.assertTrue(_testcapi.dict_hassplittable(a))
+        self.assertEqual(sys.getsizeof(a), orig_size)
         self.assertEqual(list(a), ['x', 'z'])
         self.assertEqual(list(b), ['x', 'y', 'z'])
 
         # Two dicts have different insertion order.
         a['y'] = 42
+        self.assertTrue(_testcapi.dict_hassplittable(a))
         self.assertEqual(list(a), ['x', 'z', 'y'])
+        self.assertEqual(list(a.values()), [1, 3, 42])
+        self.assertEqual(list(reversed(a.items())),
+                         [('y', 42), ('z', 3), ('x', 1)])
         self.assertEqual(list(b), ['x', 'y', 'z'])
+        self.assertEqual(a, {'x': 1, 'y': 42, 'z': 3})
 
     @support.cpython_only
     def test_splittable_pop(self):
-        """split table must be combined when d.pop(k)"""
+        """split table stays split when d.pop(k)"""
+        import _testcapi
         a, b = self.make_shared_key_dict(2)
 
         orig_size = sys.getsizeof(a)
 
-        a.pop('y')  # split table is combined
+        self.assertEqual(a.pop('y'), 2)
         with self.assertRaises(KeyError):
             a.pop('y')
 
-        self.assertGreater(sys.getsizeof(a), orig_size)
+        self.assertTrue(_testcapi.dict_hassplittable(a))
+        self.assertEqual(sys.getsizeof(a), orig_size)
         self.assertEqual(list(a), ['x', 'z'])
         self.assertEqual(list(b), ['x', 'y', 'z'])
 
@@ -971,20 +1011,29 @@ class DictTest(unittest.TestCase):
 
     @support.cpython_only
     def test_splittable_popitem(self):
-        """split table must be combined when d.popitem()"""
+        """split table pops its last inserted item with d.popitem()"""
+        import _testcapi
         a, b = self.make_shared_key_dict(2)
 
         orig_size = sys.getsizeof(a)
 
-        item = a.popitem()  # split table is combined
+        item = a.popitem()
         self.assertEqual(item, ('z', 3))
         with self.assertRaises(KeyError):
             del a['z']
 
-        self.assertGreater(sys.getsizeof(a), orig_size)
+        self.assertTrue(_testcapi.dict_hassplittable(a))
+        self.assertEqual(sys.getsizeof(a), orig_size)
         self.assertEqual(list(a), ['x', 'y'])
         self.assertEqual(list(b), ['x', 'y', 'z'])
 
+        del b['x']
+        b['x'] = 4
+        self.assertEqual(b.popitem(), ('x', 4))
+        self.assertEqual(b.popitem(), ('z', 3))
+        self.assertEqual(b.popitem(), ('y', 2))
+        self.assertRaises(KeyError, b.popitem)
+
     @support.cpython_only
     def test_splittable_setattr_after_pop(self):
         """setattr() must not convert combined table into split table."""
@@ -998,12 +1047,18 @@ class DictTest(unittest.TestCase):
         a.a = 1
         self.assertTrue(_testcapi.dict_hassplittable(a.__dict__))
 
-        # dict.pop() convert it to combined table
+        # dict.pop() keeps the table split
         a.__dict__.pop('a')
+        self.assertTrue(_testcapi.dict_hassplittable(a.__dict__))
+        a.a = 1
+        self.assertTrue(_testcapi.dict_hassplittable(a.__dict__))
+
+        # A non-string key converts it to combined table
+        a.__dict__[1] = 1
         self.assertFalse(_testcapi.dict_hassplittable(a.__dict__))
 
         # But C should not convert a.__dict__ to split table again.
-        a.a = 1
+        a.b = 1
         self.assertFalse(_testcapi.dict_hassplittable(a.__dict__))
 
         # Same for popitem()
@@ -1011,9 +1066,96 @@ class DictTest(unittest.TestCase):
         a.a = 2
         self.assertTrue(_testcapi.dict_hassplittable(a.__dict__))
         a.__dict__.popitem()
-        self.assertFalse(_testcapi.dict_hassplittable(a.__dict__))
+        self.assertTrue(_testcapi.dict_hassplittable(a.__dict__))
         a.a = 3
-        self.assertFalse(_testcapi.dict_hassplittable(a.__dict__))
+        self.assertTrue(_testcapi.dict_hassplittable(a.__dict__))
+        self.assertEqual(a.__dict__, {'a': 3})
+
+    @support.cpython_only
+    def test_splittable_attribute_order(self):
+        """instances share keys whatever the order of their attributes"""
+        import _testcapi
+
+        class C:
+            pass
+        names = ['a%d' % i for i in range(100)]
+        a = C()
+        for i, name in enumerate(names):
+            setattr(a, name, i)
+        b = C()
+        for i, name in reversed(list(enumerate(names))):
+            setattr(b, name, i)
+        for name in names[::2]:
+            delattr(b, name)
+        c = C()
+        c.a5 = 5
+        del c.a5
+        c.a3 = 3
+
+        for obj in a, b, c:
+            self.assertTrue(_testcapi.dict_hassplittable(obj.__dict__))
+        self.assertEqual(list(a.__dict__), names)
+        self.assertEqual(list(b.__dict__), names[::-2])
+        self.assertEqual(list(b.__dict__.values()), list(range(99, 0, -2)))
+        self.assertEqual(b.__dict__.copy(), dict(zip(names[1::2],
+                                                     range(1, 100, 2))))
+        self.assertEqual(list(c.__dict__.items()), [('a3', 3)])
+        self.assertFalse(hasattr(c, 'a5'))
+
+        # Instances created after a deletion still share the keys
+        d = C()
+        d.a1 = 1
+        self.assertTrue(_testcapi.dict_hassplittable(d.__dict__))
+
+    @support.cpython_only
+    def test_splittable_conversions(self):
+        a, b = self.make_shared_key_dict(2)
+        n = sys._getsplitdictconversions()
+        del a['y']
+        a['w'] = 1
+        b.popitem()
+        b.setdefault('v', 2)
+        dict(a)
+        self.assertEqual(sys._getsplitdictconversions(), n)
+        a[1] = 1
+        self.assertEqual(sys._getsplitdictconversions(), n + 1)
+        self.assertEqual(list(a), ['x', 'z', 'w', 1])
+
+    @support.cpython_only
+    def test_splittable_grow_shared_keys(self):
+        """split table full shared keys are replaced with larger ones"""
+        import _testcapi
+
+        class C:
+            pass
+        a = C()
+        a.x = 1
+        b = C()
+        b.y = 2
+        n = sys._getsplitdictconversions()
+        for i in range(20):
+            setattr(b, 'b%d' % i, i)
+        self.assertEqual(sys._getsplitdictconversions(), n)
+        self.assertTrue(_testcapi.dict_hassplittable(a.__dict__))
+        self.assertTrue(_testcapi.dict_hassplittable(b.__dict__))
+        self.assertEqual(list(b.__dict__)[:3], ['y', 'b0', 'b1'])
+        self.assertEqual(a.__dict__, {'x': 1})
+        # new instances share the larger keys
+        c = C()
+        c.b19 = 19
+        self.assertTrue(_testcapi.dict_hassplittable(c.__dict__))
+        self.assertEqual(sys.getsizeof(c.__dict__), sys.getsizeof(b.__dict__))
+
+        # but instances do not share keys growing without bound
+        for i in range(100):
+            setattr(c, 'c%d' % i, i)
+        d = C()
+        for i in range(100):
+            setattr(d, 'd%d' % i, i)
+        self.assertGreater(sys._getsplitdictconversions(), n)
+        self.assertFalse(_testcapi.dict_hassplittable(d.__dict__))
+        self.assertEqual(len(d.__dict__), 100)
+        self.assertEqual(d.d99, 99)
 
     def test_iterator_pickling(self):
         for proto in range(pickle.HIGHEST_PROTOCOL + 1):
@@ -1316,6 +1458,290 @@ class DictTest(unittest.TestCase):
         self.assertEqual(pairs[::-1], list(dict(d).items()))
 
 
+class FrozenDictTest(unittest.TestCase):
+
+    def test_constructor(self):
+        self.assertEqual(frozendict(), {})
+        self.assertEqual(frozendict({1: 2}), {1: 2})
+        self.assertEqual(frozendict([(1, 2), (3, 4)]), {1: 2, 3: 4})
+        self.assertEqual(frozendict(a=1, b=2), {'a': 1, 'b': 2})
+        self.assertEqual(frozendict({'a': 1}, b=2), {'a': 1, 'b': 2})
+        self.assertEqual(frozendict(collections.UserDict(a=1)), {'a': 1})
+        self.assertRaises(TypeError, frozendict, 1)
+        self.assertRaises(ValueError, frozendict, [(1, 2, 3)])
+        self.assertRaises(TypeError, frozendict, {}, {})
+        f = frozendict({1: 2})
+        self.assertIs(frozendict(f), f)
+        self.assertIsNot(frozendict(f, x=1), f)
+        self.assertIs(type(frozendict(f, x=1)), frozendict)
+
+    def test_immutable(self):
+        f = frozendict({'a': 1})
+        with self.assertRaises(TypeError):
+            f['a'] = 2
+        with self.assertRaises(TypeError):
+            f['b'] = 2
+        with self.assertRaises(TypeError):
+            del f['a']
+        for name in ('update', 'pop', 'popitem', 'setdefault', 'clear'):
+            self.assertFalse(hasattr(f, name), name)
+        self.assertEqual(f, {'a': 1})
+
+    def check_copy_on_write(self, keys):
+        def mutations():
+            yield lambda d: d.__setitem__(keys[0], 'x')
+            yield lambda d: d.__setitem__('new', 'x')
+            yield lambda d: d.__delitem__(keys[1])
+            yield lambda d: d.pop(keys[2])
+            yield lambda d: d.popitem()
+            yield lambda d: d.setdefault('new', 'x')
+            yield lambda d: d.update({keys[3]: 'x'})
+            yield lambda d: d.update({i: i for i in range(100)})
+            yield lambda d: d.clear()
+        items = [(k, i) for i, k in enumerate(keys)]
+        for mutate in mutations():
+            d = dict(items)
+            f = frozendict(d)
+            mutate(d)
+            self.assertEqual(list(f.items()), items)
+            self.assertNotEqual(d, f)
+            # dict(f) shares the keys of f as well
+            d = dict(f)
+            mutate(d)
+            self.assertEqual(list(f.items()), items)
+            self.assertNotEqual(d, f)
+            del d
+            self.assertEqual(list(f.items()), items)
+
+    def test_copy_on_write(self):
+        self.check_copy_on_write(['a', 'b', 'c', 'd', 'e'])
+        self.check_copy_on_write([1, 2, 3, 4, 5])
+        self.check_copy_on_write([(1,), 2.5, 'c', None, b'e'])
+
+    def test_sparse_and_split_source(self):
+        d = {i: i for i in range(100)}
+        for i in range(90):
+            del d[i]
+        self.assertEqual(frozendict(d), d)
+
+        class C:
+            pass
+        obj = C()
+        obj.a = 1
+        obj.b = 2
+        f = frozendict(obj.__dict__)
+        obj.a = 3
+        self.assertEqual(f, {'a': 1, 'b': 2})
+
+    def test_hash(self):
+        f1 = frozendict({'a': 1, 'b': (2, 3)})
+        f2 = frozendict([('b', (2, 3)), ('a', 1)])
+        self.assertEqual(hash(f1), hash(f2))
+        self.assertEqual(hash(frozendict()), hash(frozendict()))
+        self.assertNotEqual(hash(frozendict({1: 2})),
+                            hash(frozendict({2: 1})))
+        self.assertEqual({f1: 1}[f2], 1)
+        self.assertIn(frozendict({'a': frozendict()}),
+                      {frozendict({'a': frozendict()})})
+        self.assertRaises(TypeError, hash, frozendict({'a': []}))
+
+        class Value:
+            calls = 0
+            def __hash__(self):
+                Value.calls += 1
+                return 1
+        f = frozendict(a=Value())
+        self.assertEqual(hash(f), hash(f))
+        self.assertEqual(Value.calls, 1)
+
+    def test_compare(self):
+        f = frozendict({'a': 1})
+        self.assertEqual(f, {'a': 1})
+        self.assertEqual({'a': 1}, f)
+        self.assertEqual(f, frozendict(a=1))
+        self.assertNotEqual(f, {'a': 2})
+        self.assertNotEqual(f, frozendict())
+        self.assertNotEqual(f, [('a', 1)])
+        self.assertRaises(TypeError, lambda: f < f)
+
+    def test_repr(self):
+        self.assertEqual(repr(frozendict()), 'frozendict()')
+        self.assertEqual(repr(frozendict({'a': 1})), "frozendict({'a': 1})")
+
+        class FD(frozendict):
+            pass
+        self.assertEqual(repr(FD()), 'FD()')
+        self.assertEqual(repr(FD({1: 2})), 'FD({1: 2})')
+
+    def test_read_methods(self):
+        items = [('a', 1), ('b', 2), ('c', 3)]
+        f = frozendict(items)
+        self.assertEqual(len(f), 3)
+        self.assertEqual(list(f), ['a', 'b', 'c'])
+        self.assertEqual(list(reversed(f)), ['c', 'b', 'a'])
+        self.assertEqual(list(f.keys()), ['a', 'b', 'c'])
+        self.assertEqual(list(f.values()), [1, 2, 3])
+        self.assertEqual(list(f.items()), items)
+        self.assertEqual(list(reversed(f.items())), items[::-1])
+        self.assertIn(('a', 1), f.items())
+        self.assertNotIn(('a', 2), f.items())
+        self.assertEqual(f.keys() & {'a', 'z'}, {'a'})
+        self.assertIn('a', f)
+        self.assertNotIn('z', f)
+        self.assertEqual(f['b'], 2)
+        self.assertRaises(KeyError, f.__getitem__, 'z')
+        self.assertEqual(f.get('z'), None)
+        self.assertEqual(f.get('z', 0), 0)
+        self.assertIs(f.copy(), f)
+        self.assertIsInstance(f, collections.abc.Mapping)
+        self.assertNotIsInstance(f, collections.abc.MutableMapping)
+        self.assertIsInstance(f, collections.abc.Hashable)
+
+    def test_fromkeys(self):
+        f = frozendict.fromkeys('abc')
+        self.assertIs(type(f), frozendict)
+        self.assertEqual(f, dict.fromkeys('abc'))
+        self.assertEqual(frozendict.fromkeys(f, 0), dict.fromkeys('abc', 0))
+
+        class FD(frozendict):
+            pass
+        f = FD.fromkeys('ab', 1)
+        self.assertIs(type(f), FD)
+        self.assertEqual(f, {'a': 1, 'b': 1})
+
+    def test_subclass(self):
+        class FD(frozendict):
+            def __missing__(self, key):
+                return key
+        f = FD({'a': 1}, b=2)
+        self.assertIs(type(f), FD)
+        self.assertEqual(f, {'a': 1, 'b': 2})
+        self.assertEqual(f['z'], 'z')
+        c = f.copy()
+        self.assertIs(type(c), frozendict)
+        self.assertEqual(c, f)
+        self.assertIsNot(FD(f), f)
+
+    def test_pickle_and_copy(self):
+        import copy
+        f = frozendict({'a': 1, 'b': [2]})
+        for proto in range(pickle.HIGHEST_PROTOCOL + 1):
+            g = pickle.loads(pickle.dumps(f, proto))
+            self.assertIs(type(g), frozendict)
+            self.assertEqual(g, f)
+        self.assertIs(copy.copy(f), f)
+        g = copy.deepcopy(f)
+        self.assertEqual(g, f)
+        self.assertIsNot(g['b'], f['b'])
+
+        f = FrozenDictWithAttr({'a': 1})
+        f.attr = 'x'
+        for proto in range(pickle.HIGHEST_PROTOCOL + 1):
+            g = pickle.loads(pickle.dumps(f, proto))
+            self.assertIs(type(g), FrozenDictWithAttr)
+            self.assertEqual(g, f)
+            self.assertEqual(g.attr, 'x')
+
+    def test_cycle_collected(self):
+        class Obj:
+            pass
+        # The keys of d are shared while both d and f are alive
+        obj = Obj()
+        d = {'obj': obj}
+        f = frozendict(d)
+        obj.f = f
+        ref = weakref.ref(obj)
+        del obj, f
+        gc.collect()
+        self.assertIsNotNone(ref())
+        del d
+        gc.collect()
+        self.assertIsNone(ref())
+
+        obj = Obj()
+        obj.f = frozendict(obj=obj)
+        ref = weakref.ref(obj)
+        del obj
+        gc.collect()
+        self.assertIsNone(ref())
+
+    def test_shared_keys_cycle_collected(self):
+        # A cycle through the values of keys shared by a dict and a
+        # frozendict which both belong to it
+        l = []
+        d = {'l': l}
+        f = FrozenDictWithAttr(d)
+        l += [f, d]
+        ref = weakref.ref(f)
+        del l, d, f
+        gc.collect()
+        self.assertIsNone(ref())
+
+        class Obj:
+            pass
+        obj = Obj()
+        l = [obj]
+        d = {'l': l}
+        f = frozendict(d)
+        l += [f, d]
+        ref = weakref.ref(obj)
+        del obj, l, d, f
+        gc.collect()
+        self.assertIsNone(ref())
+
+    def test_shared_keys_cycle_kept(self):
+        # The entries stay alive while any of the dicts sharing them does
+        l = []
+        d = {'l': l}
+        f = frozendict(d)
+        l.append(f)
+        del f
+        gc.collect()
+        self.assertEqual(d, {'l': [{'l': l}]})
+        f = l.pop()
+        gc.collect()
+        d.clear()
+        gc.collect()
+        self.assertEqual(f, {'l': []})
+
+    @support.cpython_only
+    def test_share_without_incref(self):
+        # Sharing the keys doesn't take references to the entries
+        key = 'key-%d' % id(self)
+        value = object()
+        d = {key: value}
+        refs = sys.getrefcount(key), sys.getrefcount(value)
+        f = frozendict(d)
+        d2 = dict(f)
+        self.assertEqual((sys.getrefcount(key), sys.getrefcount(value)),
+                         refs)
+        del d, f
+        self.assertEqual(d2, {key: value})
+
+    @support.cpython_only
+    def test_track(self):
+        self.assertFalse(gc.is_tracked(frozendict({1: 2})))
+        self.assertTrue(gc.is_tracked(frozendict({1: []})))
+        self.assertTrue(gc.is_tracked(frozendict({1: 2}, a=[])))
+
+    @support.cpython_only
+    def test_shared_keys(self):
+        d = {i: i for i in range(1000)}
+        dsize = sys.getsizeof(d)
+        f = frozendict(d)
+        # d and f share the keys table, neither accounts for it
+        self.assertLess(sys.getsizeof(f), dsize)
+        self.assertLess(sys.getsizeof(d), dsize)
+        # the first modification of d copies the table
+        d[0] = 1
+        self.assertEqual(sys.getsizeof(d), dsize)
+        self.assertGreater(sys.getsizeof(f), dsize)
+
+
+class FrozenDictWithAttr(frozendict):
+    pass
+
+
 class CAPITest(unittest.TestCase):
 
     # Test _PyDict_GetItem_KnownHash()
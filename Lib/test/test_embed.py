@@ -305,6 +305,7 @@ class InitConfigTests(EmbeddingTestsMixin, unittest.TestCase):
         'base_prefix': GET_DEFAULT_CONFIG,
         'exec_prefix': GET_DEFAULT_CONFIG,
         'base_exec_prefix': GET_DEFAULT_CONFIG,
+        'stdlib_dir': GET_DEFAULT_CONFIG,
 
         'isolated': 0,
         'site_import': 1,
@@ -417,6 +418,7 @@ class InitConfigTests(EmbeddingTestsMixin, unittest.TestCase):
                 'base_prefix': sys.base_prefix,
                 'exec_prefix': sys.exec_prefix,
                 'base_exec_prefix': sys.base_exec_prefix,
+                'stdlib_dir': sys._stdlib_dir,
                 'filesystem_encoding': sys.getfilesystemencoding(),
                 'filesystem_errors': sys.getfilesystemencodeerrors(),
             }
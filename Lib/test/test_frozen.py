@@ -10,9 +10,13 @@
 # Invalid marshalled data in frozen.c could case the interpreter to
 # crash when __hello__ is imported.
 
+import os
+import shutil
 import sys
 import unittest
+from test import support
 from test.support import captured_stdout
+from test.support.script_helper import assert_python_ok
 
 
 class TestFrozen(unittest.TestCase):
@@ -25,5 +29,114 @@ class TestFrozen(unittest.TestCase):
         self.assertEqual(out.getvalue(), 'Hello world!\n')
 
 
+class TestFrozenStdlib(unittest.TestCase):
+    # The frozen copies of standard library modules used with
+    # -X frozen_modules (source is in Python/frozen_stdlib.c).
+
+    def run_python(self, *args, **env_vars):
+        rc, out, err = assert_python_ok(*args, **env_vars)
+        return out.decode('ascii').splitlines()
+
+    def test_startup_modules(self):
+        code = ('import os, site; '
+                'print(os.__spec__.origin); print(os.__file__)')
+        origin, filename = self.run_python('-X', 'frozen_modules=on',
+                                           '-c', code)
+        self.assertEqual(origin, 'frozen')
+        self.assertEqual(os.path.normcase(filename),
+                         os.path.normcase(os.__file__))
+        origin, filename = self.run_python('-X', 'frozen_modules=off',
+                                           '-c', code)
+        self.assertNotEqual(origin, 'frozen')
+
+    def test_package(self):
+        # Submodules which are not frozen are imported from the package's
+        # directory.
+        code = ('import encodings, encodings.idna; '
+                'print(encodings.__path__[0]); '
+                'print(encodings.idna.__spec__.origin)')
+        path, origin = self.run_python('-X', 'frozen_modules=on', '-c', code)
+        self.assertEqual(os.path.dirname(origin), path)
+        self.assertTrue(os.path.samefile(
+            path, os.path.dirname(sys.modules['encodings'].__file__)))
+
+    def test_code_filename(self):
+        # Tracebacks and inspect show the source file
+        code = 'import os; print(os.walk.__code__.co_filename)'
+        filename, = self.run_python('-X', 'frozen_modules=on', '-c', code)
+        self.assertTrue(os.path.samefile(filename, os.__file__))
+
+    def test_changed_source(self):
+        # A module whose source changed since it was frozen is imported
+        # from its source.  The frozen copies of the other modules are
+        # used, even if their source is missing.
+        with support.temp_dir() as home:
+            if sys.platform == 'win32':
+                stdlib_dir = os.path.join(home, 'Lib')
+            else:
+                stdlib_dir = os.path.join(home, 'lib', 'python%d.%d'
+                                          % sys.version_info[:2])
+            os.makedirs(stdlib_dir)
+            filename = os.path.join(stdlib_dir, 'os.py')
+            shutil.copyfile(os.__file__, filename)
+            with open(filename, 'a') as file:
+                file.write('\nCHANGED = True\n')
+            code = ('import os, stat, sys; print(sys._stdlib_dir); '
+                    'print(os.__spec__.origin); print(os.CHANGED); '
+                    'print(stat.__spec__.origin)')
+            path, os_origin, changed, stat_origin = self.run_python(
+                '-X', 'frozen_modules=on', '-c', code, PYTHONHOME=home)
+            self.assertTrue(os.path.samefile(path, stdlib_dir))
+            self.assertTrue(os.path.samefile(os_origin, filename))
+            self.assertEqual(changed, 'True')
+            self.assertEqual(stat_origin, 'frozen')
+
+    def test_optimize(self):
+        # The frozen copies are compiled without optimizations
+        code = 'import os; print(os.__spec__.origin)'
+        for opt in ('-O', '-OO'):
+            with self.subTest(opt=opt):
+                origin, = self.run_python(opt, '-X', 'frozen_modules=on',
+                                          '-c', code)
+                self.assertNotEqual(origin, 'frozen')
+
+    def test_stdlib_dir(self):
+        # The standard library directory comes from the path configuration,
+        # not from a search of sys.path.
+        with support.temp_dir() as path:
+            with open(os.path.join(path, 'os.py'), 'w') as file:
+                file.write('raise ImportError\n')
+            code = ('import os, sys; print(os.__spec__.origin); '
+                    'print(sys._stdlib_dir); print(os.__file__)')
+            origin, stdlib_dir, filename = self.run_python(
+                '-X', 'frozen_modules=on', '-c', code, PYTHONPATH=path)
+        self.assertEqual(origin, 'frozen')
+        self.assertTrue(os.path.samefile(stdlib_dir,
+                                         os.path.dirname(os.__file__)))
+        self.assertTrue(os.path.samefile(filename, os.__file__))
+
+    def test_up_to_date(self):
+        # The frozen copies and the hashes of their sources must be
+        # regenerated with "make regen-frozen" when a module changes.
+        code = """if 1:
+            import _imp
+            from importlib.machinery import FrozenImporter
+            for name in _imp._frozen_stdlib_names():
+                location = FrozenImporter._stdlib_locations[name]
+                if location is None:
+                    # the hash of the source differs
+                    print(name)
+                    continue
+                filename = location[0]
+                with open(filename, 'rb') as file:
+                    source = file.read()
+                code = compile(source, filename, 'exec', dont_inherit=True)
+                if code != _imp.get_frozen_object(name):
+                    print(name)
+            """
+        stale = self.run_python('-X', 'frozen_modules=on', '-c', code)
+        self.assertEqual(stale, [])
+
+
 if __name__ == '__main__':
     unittest.main()
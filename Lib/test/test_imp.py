@@ -214,7 +214,8 @@ class ImportTests(unittest.TestCase):
         orig_path = os.path
         orig_getenv = os.getenv
         with support.EnvironmentVarGuard():
-            x = imp.find_module("os")
+            # Look in the directory of os.py, as os may be frozen
+            x = imp.find_module("os", [os.path.dirname(os.__file__)])
             self.addCleanup(x[0].close)
             new_os = imp.load_module("os", *x)
             self.assertIs(os, new_os)
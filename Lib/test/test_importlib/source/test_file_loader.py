@@ -17,8 +17,14 @@ import types
 import unittest
 import warnings
 
+from test import support
 from test.support import make_legacy_pyc, unload
 
+try:
+    import mmap
+except ImportError:
+    mmap = None
+
 from test.test_py_compile import without_source_date_epoch
 from test.test_py_compile import SourceDateEpochTestMeta
 
@@ -355,6 +361,64 @@ class SimpleTest(abc.LoaderTests):
                 data[8:16],
             )
 
+    @util.writes_bytecode_files
+    def test_lazy_bytecode(self):
+        # With -X lazy_bytecode, code objects are written with marshal
+        # version 5 and loaded on first use from a memory map.
+        with util.create_modules('_temp') as mapping, \
+             support.swap_item(sys._xoptions, 'lazy_bytecode', True):
+            source = mapping['_temp']
+            pyc = self.util.cache_from_source(source)
+            with open(source, 'w') as fp:
+                fp.write('def f():\n    "doc"\n    return 42\n')
+            py_compile.compile(source)
+            loader = self.machinery.SourceFileLoader('_temp', source)
+            data = loader._read_bytecode(pyc)
+            mapped = mmap is not None and sys.platform != 'win32'
+            if mapped:
+                self.assertIsInstance(data, mmap.mmap)
+            # The module code object, then its co_code...
+            i = 16 + 1 + 5 * 4
+            self.assertEqual(data[i] & 0x7f, ord('s'))
+            i += 5 + int.from_bytes(data[i + 1:i + 5], 'little')
+            # ...and co_consts, starting with a TYPE_LAZY_CODE for f.
+            self.assertEqual(data[i] & 0x7f, ord(')'))
+            self.assertEqual(data[i + 2] & 0x7f, ord('C'))
+            if mapped:
+                data.close()
+            del data
+            mod = types.ModuleType('_temp')
+            mod.__spec__ = self.util.spec_from_loader('_temp', loader)
+            loader.exec_module(mod)
+            self.assertEqual(mod.f.__doc__, 'doc')
+            self.assertEqual(mod.f(), 42)
+            del mod
+            support.gc_collect()
+
+    @util.writes_bytecode_files
+    def test_lazy_bytecode_fd_count(self):
+        # The bytecode files of lazily loaded code objects stay mapped,
+        # but not open.
+        names = ['_temp%d' % i for i in range(300)]
+        with util.create_modules(*names) as mapping, \
+             support.swap_item(sys._xoptions, 'lazy_bytecode', True):
+            modules = []
+            start = support.fd_count()
+            for name in names:
+                source = mapping[name]
+                with open(source, 'w') as fp:
+                    fp.write('def f():\n    return %r\n' % name)
+                py_compile.compile(source)
+                loader = self.machinery.SourceFileLoader(name, source)
+                mod = types.ModuleType(name)
+                mod.__spec__ = self.util.spec_from_loader(name, loader)
+                loader.exec_module(mod)
+                modules.append(mod)
+            self.assertLess(support.fd_count() - start, 10)
+            self.assertEqual([mod.f() for mod in modules], names)
+            del modules
+            support.gc_collect()
+
 
 (Frozen_SimpleTest,
  Source_SimpleTest
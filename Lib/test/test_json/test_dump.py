@@ -47,6 +47,75 @@ class TestDump:
         d[1337] = "true.dat"
         self.assertEqual(self.dumps(d, sort_keys=True), '{"1337": "true.dat"}')
 
+    def test_dumpb(self):
+        values = [None, True, False, 0, -2**63, 2**64, 1.5, -1e300,
+                  float('inf'), 'a"\\\n\x00\x1f\x7f\x80\xe9\u20ac\U0001f600',
+                  {'\xe9': [1, 2.0, {}], 3: None, 1.5: 'x'}, [[], ()],
+                  list(range(1000)), ['x' * 1000] * 300]
+        for obj in values:
+            for kw in ({}, {'ensure_ascii': False}, {'indent': 2},
+                       {'separators': (',', ':')}):
+                with self.subTest(obj=obj, **kw):
+                    expected = self.dumps(obj, **kw).encode('utf-8')
+                    self.assertEqual(self.json.dumpb(obj, **kw), expected)
+        self.assertEqual(self.json.dumpb({'b': 1, 'a': [2]}, sort_keys=True,
+                                         default=repr),
+                         b'{"a": [2], "b": 1}')
+        self.assertEqual(self.json.dumpb([object], default=lambda o: 'x'),
+                         b'["x"]')
+
+    def test_dumpb_write(self):
+        obj = [{'id': i, 'name': '\u20ac' * (i % 50)} for i in range(5000)]
+        for kw in ({}, {'ensure_ascii': False}, {'indent': 1}):
+            with self.subTest(**kw):
+                chunks = []
+                self.assertIsNone(self.json.dumpb(obj, write=chunks.append,
+                                                  **kw))
+                self.assertGreater(len(chunks), 1)
+                self.assertEqual(b''.join(chunks),
+                                 self.dumps(obj, **kw).encode('utf-8'))
+                # The output is written in chunks of about 64 KiB
+                for chunk in chunks:
+                    self.assertIsInstance(chunk, bytes)
+                    self.assertLess(len(chunk), 128 * 1024)
+        chunks = []
+        self.json.dumpb('x', write=chunks.append)
+        self.assertEqual(chunks, [b'"x"'])
+
+    def test_dumpb_errors(self):
+        self.assertRaises(UnicodeEncodeError, self.json.dumpb, ['\ud800'],
+                          ensure_ascii=False)
+        self.assertEqual(self.json.dumpb(['\ud800']), b'["\\ud800"]')
+        self.assertRaises(ValueError, self.json.dumpb, [float('nan')],
+                          allow_nan=False)
+        self.assertRaises(TypeError, self.json.dumpb, [object()])
+        def write(data):
+            raise OSError
+        self.assertRaises(OSError, self.json.dumpb, ['x'] * 10**5,
+                          write=write)
+
+    def test_dumpb_overridden_encode(self):
+        class Encoder(self.json.JSONEncoder):
+            def encode(self, o):
+                return '["encode"]'
+        self.assertEqual(self.json.dumpb([1], cls=Encoder), b'["encode"]')
+        chunks = []
+        self.assertIsNone(self.json.dumpb([1], cls=Encoder,
+                                          write=chunks.append))
+        self.assertEqual(chunks, [b'["encode"]'])
+
+    def test_dumpb_overridden_iterencode(self):
+        class Encoder(self.json.JSONEncoder):
+            def iterencode(self, o, _one_shot=False):
+                yield '["iter'
+                yield '\u20ac"]'
+        self.assertEqual(self.json.dumpb([1], cls=Encoder),
+                         '["iter\u20ac"]'.encode('utf-8'))
+        chunks = []
+        self.assertIsNone(self.json.dumpb([1], cls=Encoder,
+                                          write=chunks.append))
+        self.assertEqual(b''.join(chunks), '["iter\u20ac"]'.encode('utf-8'))
+
 
 class TestPyDump(TestDump, PyTest): pass
 
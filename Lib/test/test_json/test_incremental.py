@@ -0,0 +1,182 @@
+import decimal
+from io import BytesIO, StringIO
+from test.test_json import PyTest, CTest
+
+
+DOC = ('{"a": [1, 2.5, {"b": "c\\"]}"}], "d": null}  12 "x\\u00e9\\\\"\n'
+       '[true, false, [], {}] -1e3 "€" NaN 7')
+VALUES = [{"a": [1, 2.5, {"b": 'c"]}'}], "d": None}, 12, 'x\xe9\\',
+          [True, False, [], {}], -1e3, '€', float('nan'), 7]
+
+
+class TestIncremental:
+    def decode(self, chunks, **kw):
+        decoder = self.json.JSONIncrementalDecoder(**kw)
+        values = []
+        for chunk in chunks:
+            values.extend(decoder.feed(chunk))
+        values.extend(decoder.close())
+        return values
+
+    def split(self, data, size):
+        return [data[i:i + size] for i in range(0, len(data), size)]
+
+    def assertValuesEqual(self, values, expected):
+        # Compare NaN equal
+        self.assertEqual(repr(values), repr(expected))
+
+    def test_stream(self):
+        for size in (1, 2, 3, 7, 16, len(DOC)):
+            with self.subTest(size=size):
+                self.assertValuesEqual(self.decode(self.split(DOC, size)),
+                                       VALUES)
+        self.assertEqual(self.decode(['1 2', ' 3']), [1, 2, 3])
+        self.assertEqual(self.decode(['[1]{}"a"', 'null']),
+                         [[1], {}, 'a', None])
+        self.assertEqual(self.decode([]), [])
+        self.assertEqual(self.decode([' \n ']), [])
+
+    def test_array(self):
+        doc = self.json.dumps(VALUES, indent=2)
+        for size in (1, 2, 3, 7, 16, len(doc)):
+            with self.subTest(size=size):
+                values = self.decode(self.split(doc, size), array=True)
+                self.assertValuesEqual(values, VALUES)
+        self.assertEqual(self.decode([' [ ] '], array=True), [])
+        self.assertEqual(self.decode(['[[1,', '2],3', ']'], array=True),
+                         [[1, 2], 3])
+
+    def test_values_when_complete(self):
+        decoder = self.json.JSONIncrementalDecoder()
+        self.assertEqual(decoder.feed('{"a": [1, '), [])
+        self.assertEqual(decoder.feed('2]} "b'), [{"a": [1, 2]}])
+        self.assertEqual(decoder.feed('c" 12'), ['bc'])
+        # A number may continue in the next chunk
+        self.assertEqual(decoder.feed('3'), [])
+        self.assertEqual(decoder.close(), [123])
+        decoder = self.json.JSONIncrementalDecoder(array=True)
+        self.assertEqual(decoder.feed('[{"a": 1}'), [{"a": 1}])
+        self.assertEqual(decoder.feed(', 2'), [])
+        self.assertEqual(decoder.feed(', '), [2])
+        self.assertEqual(decoder.feed('3]'), [3])
+        self.assertEqual(decoder.close(), [])
+
+    def test_bytes(self):
+        data = DOC.encode('utf-8')
+        for size in (1, 2, 3, 5):
+            with self.subTest(size=size):
+                self.assertValuesEqual(self.decode(self.split(data, size)),
+                                       VALUES)
+        chunks = [bytearray(b'["\xe2\x82'), memoryview(b'\xac"]')]
+        self.assertEqual(self.decode(chunks, array=True), ['€'])
+        # A UTF-8 byte order mark is skipped
+        self.assertEqual(self.decode([b'\xef', b'\xbb\xbf1']), [1])
+        self.assertRaises(UnicodeDecodeError, self.decode, [b'"\xff"'])
+        self.assertRaises(UnicodeDecodeError, self.decode, [b'"\xe2\x82'])
+
+    def test_hooks(self):
+        values = self.decode(['{"a": 1.5', '}[2]'],
+                             object_pairs_hook=lambda pairs: pairs,
+                             parse_float=decimal.Decimal, parse_int=float)
+        self.assertEqual(values, [[('a', decimal.Decimal('1.5'))], [2.0]])
+        self.assertIsInstance(values[1][0], float)
+        values = self.decode(['["a\tb"]'], array=True, strict=False)
+        self.assertEqual(values, ['a\tb'])
+        self.assertRaises(self.JSONDecodeError, self.decode, ['["a\tb"]'])
+
+    def test_errors(self):
+        for doc, msg, pos in [
+                ('[1, 2', "Expecting ',' delimiter", 5),
+                ('[1,]', 'Expecting value', 3),
+                ('[1 2]', "Expecting ',' delimiter", 3),
+                ('[', 'Expecting value', 1),
+                ('', 'Expecting value', 0),
+                ('[1] 2', 'Extra data', 4),
+                ('[{"a" 1}]', "Expecting ':' delimiter", 6),
+                ('[1,\n 2,\n  ["a", x]]', 'Expecting value', 16),
+                ]:
+            for size in (1, 2, len(doc) or 1):
+                with self.subTest(doc=doc, size=size):
+                    with self.assertRaises(self.JSONDecodeError) as cm:
+                        self.decode(self.split(doc, size), array=True)
+                    err = cm.exception
+                    self.assertEqual(err.msg, msg)
+                    self.assertEqual(err.pos, pos)
+                    if doc:
+                        with self.assertRaises(self.JSONDecodeError) as cm:
+                            self.loads(doc)
+                        self.assertEqual((err.lineno, err.colno),
+                                         (cm.exception.lineno,
+                                          cm.exception.colno))
+                        self.assertEqual(str(err), str(cm.exception))
+        with self.assertRaises(self.JSONDecodeError) as cm:
+            self.decode(['{"a": 1} ', '"b', 'c" [1, 2'])
+        self.assertEqual(cm.exception.msg, "Expecting ',' delimiter")
+        self.assertEqual(cm.exception.pos, 19)
+        with self.assertRaises(self.JSONDecodeError) as cm:
+            self.decode(['1 "abc'])
+        self.assertEqual(cm.exception.msg, 'Unterminated string starting at')
+        self.assertEqual(cm.exception.pos, 2)
+        self.assertRaises(self.JSONDecodeError, self.decode, ['{"a": 1'])
+        self.assertRaises(self.JSONDecodeError, self.decode, ['{"a": 1]}'])
+        self.assertRaises(self.JSONDecodeError, self.decode, ['{"a": 1}'],
+                          array=True)
+
+    def test_reset(self):
+        decoder = self.json.JSONIncrementalDecoder(array=True)
+        self.assertEqual(decoder.feed('[1, 2'), [1])
+        self.assertRaises(self.JSONDecodeError, decoder.close)
+        # The decoder is reset after an error or the end of the stream
+        self.assertEqual(decoder.feed('[3]'), [3])
+        self.assertEqual(decoder.close(), [])
+        self.assertEqual(decoder.feed('[4, 5'), [4])
+        with self.assertRaises(self.JSONDecodeError) as cm:
+            decoder.feed(' 6]')
+        self.assertEqual(cm.exception.pos, 6)
+        self.assertEqual(decoder.feed('[7]'), [7])
+        self.assertEqual(decoder.close(), [])
+
+    def test_reentrant_calls(self):
+        # A hook can't feed or close the decoder which is calling it
+        errors = []
+        def hook(obj):
+            for call in (lambda: decoder.feed('"abc'),
+                         lambda: decoder.feed('def" '),
+                         decoder.close):
+                try:
+                    call()
+                except RuntimeError as exc:
+                    errors.append(str(exc))
+            return obj
+        decoder = self.json.JSONIncrementalDecoder(object_hook=hook)
+        self.assertEqual(decoder.feed('{"a": 1} {"b"'), [{'a': 1}])
+        self.assertEqual(decoder.feed(': 2} 3'), [{'b': 2}])
+        self.assertEqual(decoder.close(), [3])
+        self.assertEqual(errors, [
+            'feed() called while feed() or close() is decoding',
+            'feed() called while feed() or close() is decoding',
+            'close() called while feed() or close() is decoding',
+        ] * 2)
+        # The decoder is usable after it raised
+        self.assertEqual(decoder.feed('[1] '), [[1]])
+        self.assertEqual(decoder.close(), [])
+
+    def test_bad_data(self):
+        decoder = self.json.JSONIncrementalDecoder()
+        self.assertRaises(TypeError, decoder.feed, 1)
+        self.assertRaises(TypeError, decoder.feed, None)
+
+    def test_iterload(self):
+        it = self.json.iterload(StringIO(DOC), chunk_size=5)
+        self.assertEqual(next(it), VALUES[0])
+        self.assertValuesEqual(list(it), VALUES[1:])
+        values = self.json.iterload(BytesIO(b'[{"a": 1}, 2.5]'), array=True,
+                                    chunk_size=1, parse_float=decimal.Decimal)
+        self.assertEqual(list(values), [{"a": 1}, decimal.Decimal('2.5')])
+        values = self.json.iterload(StringIO('[1, 2'), array=True)
+        self.assertEqual(next(values), 1)
+        self.assertRaises(self.JSONDecodeError, list, values)
+
+
+class TestPyIncremental(TestIncremental, PyTest): pass
+class TestCIncremental(TestIncremental, CTest): pass
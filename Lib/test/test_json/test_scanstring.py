@@ -132,6 +132,28 @@ class TestScanstring:
             with self.assertRaises(self.JSONDecodeError, msg=s):
                 scanstring(s, 1, True)
 
+    def test_long_strings(self):
+        # The special characters are found at every offset of strings
+        # longer than the blocks looked at by the C scanner.
+        scanstring = self.json.decoder.scanstring
+        for filler in 'x', '\xe9', '\u20ac', '\U0001d120':
+            for n in range(100):
+                prefix = filler * n
+                s = '"' + prefix + '"' + 'y' * 40
+                self.assertEqual(scanstring(s, 1, True),
+                                 (prefix, n + 2))
+                s = '"' + prefix + '\\n' + prefix + '"'
+                self.assertEqual(scanstring(s, 1, True),
+                                 (prefix + '\n' + prefix, 2 * n + 4))
+                s = '"' + prefix + '\x1f' + 'y' * 40 + '"'
+                self.assertEqual(scanstring(s, 1, False),
+                                 (prefix + '\x1f' + 'y' * 40, n + 43))
+                with self.assertRaises(self.JSONDecodeError):
+                    scanstring(s, 1, True)
+                with self.assertRaises(self.JSONDecodeError) as cm:
+                    scanstring('"' + prefix, 1, True)
+                self.assertEqual(cm.exception.pos, 0)
+
     def test_overflow(self):
         with self.assertRaises(OverflowError):
             self.json.decoder.scanstring(b"xxx", sys.maxsize+1)
@@ -12,6 +12,8 @@ SHIFT = sys.int_info.bits_per_digit
 BASE = 2 ** SHIFT
 MASK = BASE - 1
 KARATSUBA_CUTOFF = 70   # from longobject.c
+TOOM3_CUTOFF = 400      # ditto
+BURNIKEL_ZIEGLER_CUTOFF = 80    # ditto
 
 # Max number of base BASE digits to use in test cases.  Doubling
 # this will more than double the runtime.
@@ -229,6 +231,62 @@ class LongTest(unittest.TestCase):
                          1)
                     self.assertEqual(x, y)
 
+    def test_toom3(self):
+        digits = [TOOM3_CUTOFF + 1, TOOM3_CUTOFF + 2, TOOM3_CUTOFF * 2,
+                  TOOM3_CUTOFF * 3 + 1, TOOM3_CUTOFF * 10]
+        bits = [digit * SHIFT for digit in digits]
+
+        # Products of long strings of 1 bits, as in test_karatsuba, which
+        # includes squares and operands of unbalanced sizes.
+        for abits in bits:
+            a = (1 << abits) - 1
+            for bbits in bits:
+                if bbits < abits:
+                    continue
+                with self.subTest(abits=abits, bbits=bbits):
+                    b = (1 << bbits) - 1
+                    x = a * b
+                    y = ((1 << (abits + bbits)) -
+                         (1 << abits) -
+                         (1 << bbits) +
+                         1)
+                    self.assertEqual(x, y)
+
+        # Random operands, checked against products of pieces too small for
+        # Toom-3.
+        chunk = (TOOM3_CUTOFF // 2) * SHIFT
+        for lena, lenb in [(digits[0], digits[0]), (digits[1], digits[2]),
+                           (digits[3], digits[3]), (digits[4], digits[4])]:
+            a = self.getran(lena)
+            b = self.getran(lenb)
+            for x, y in (a, b), (a, a), (-a, b):
+                with self.subTest(lena=lena, lenb=lenb, x=x % 1000):
+                    expected = 0
+                    for i in range(0, lena * SHIFT, chunk):
+                        expected += ((abs(x) >> i) % (1 << chunk)) * y << i
+                    if x < 0:
+                        expected = -expected
+                    self.assertEqual(x * y, expected)
+
+    def test_burnikel_ziegler_division(self):
+        digits = [BURNIKEL_ZIEGLER_CUTOFF + 1, BURNIKEL_ZIEGLER_CUTOFF * 2 + 1,
+                  BURNIKEL_ZIEGLER_CUTOFF * 5, BURNIKEL_ZIEGLER_CUTOFF * 13 + 7]
+        for leny in digits:
+            for lenq in digits:
+                x = self.getran(leny + lenq)
+                y = self.getran(leny)
+                self.check_division(x, y)
+        # Quotient digits of BASE - 1, where the recursive step can't
+        # estimate the quotient by a division.
+        for n in digits:
+            y = (1 << (n * SHIFT)) - 1
+            x = y * y
+            self.assertEqual(divmod(x, y), (y, 0))
+            self.assertEqual(divmod(x - 1, y), (y - 1, y - 1))
+            self.assertEqual(divmod(-x, y), (-y, 0))
+            self.check_division(x + y - 1, y)
+            self.check_division(x, y >> 1)
+
     def check_bitop_identities_1(self, x):
         eq = self.assertEqual
         with self.subTest(x=x):
@@ -321,6 +379,53 @@ class LongTest(unittest.TestCase):
                 x = self.getran(lenx)
                 self.check_format_1(x)
 
+    def chunked_format(self, x):
+        # Format x by pieces small enough for the schoolbook conversion.
+        if x < 0:
+            return '-' + self.chunked_format(-x)
+        chunks = []
+        while x >= 10**500:
+            x, r = divmod(x, 10**500)
+            chunks.append('%0500d' % r)
+        chunks.append(str(x))
+        return ''.join(reversed(chunks))
+
+    def chunked_parse(self, s, base):
+        x = 0
+        for i in range(0, len(s), 500):
+            x = x * base**len(s[i:i+500]) + int(s[i:i+500], base)
+        return x
+
+    def test_huge_decimal_conversion(self):
+        # Sizes around the cutoffs of the divide-and-conquer conversions,
+        # and ones that need a few levels of recursion.
+        for bits in (60000, 60001, 66000, 66500, 250000):
+            x = random.getrandbits(bits) | (1 << (bits - 1))
+            for y in x, x - 1, (1 << bits) - 1, 1 << bits, -x, 10**(bits // 4):
+                with self.subTest(bits=bits, y=y % 1000):
+                    s = str(y)
+                    self.assertEqual(s, self.chunked_format(y))
+                    self.assertEqual(int(s), y)
+                    self.assertEqual(int(s.encode('ascii')), y)
+        for ndigits in 4999, 5000, 5001, 7777, 50000:
+            s = ''.join(random.choice('0123456789') for _ in range(ndigits))
+            with self.subTest(ndigits=ndigits):
+                x = int(s)
+                self.assertEqual(x, self.chunked_parse(s, 10))
+                self.assertEqual(int('-' + s), -x)
+                self.assertEqual(int('0' * 3000 + s), x)
+                self.assertEqual(int(' +%s\n' % s), x)
+                self.assertEqual(int('_'.join(s[i:i+3]
+                                     for i in range(0, ndigits, 3))), x)
+        for base in 3, 7, 36:
+            s = ''.join(random.choice('0123456789abcdefghijklmnopqrstuvwxyz'
+                                      [:base]) for _ in range(20000))
+            with self.subTest(base=base):
+                self.assertEqual(int(s, base), self.chunked_parse(s, base))
+        self.assertRaises(ValueError, int, '1' * 10000 + '_')
+        self.assertRaises(ValueError, int, '1' * 10000 + '__1')
+        self.assertRaises(ValueError, int, '1' * 10000 + 'a')
+
     def test_long(self):
         # Check conversions from string
         LL = [
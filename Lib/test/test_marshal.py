@@ -134,6 +134,80 @@ class CodeTestCase(unittest.TestCase):
             if isinstance(obj, types.CodeType):
                 self.assertIs(co.co_filename, obj.co_filename)
 
+LAZY_SOURCE = """\
+\"""Module docstring\"""
+def f(x):
+    \"""Docstring of f\"""
+    return [y * 2 for y in x]
+class C:
+    def m(self):
+        return 42
+"""
+
+class LazyCodeTestCase(unittest.TestCase, HelperMixin):
+    def run_code(self, co):
+        ns = {}
+        exec(co, ns)
+        self.assertEqual(ns['__doc__'], 'Module docstring')
+        self.assertEqual(ns['f'].__doc__, 'Docstring of f')
+        self.assertEqual(ns['f']([1, 2]), [2, 4])
+        self.assertEqual(ns['C']().m(), 42)
+
+    def test_code(self):
+        co = compile(LAZY_SOURCE, 'lazy', 'exec')
+        self.helper(co, 5)
+        data = marshal.dumps(co, 5)
+        for lazy in (False, True):
+            with self.subTest(lazy=lazy):
+                new = marshal.loads(data, lazy=lazy)
+                self.assertEqual(co, new)
+                self.assertEqual(hash(co), hash(new))
+                self.run_code(marshal.loads(data, lazy=lazy))
+
+    def test_loaded_on_first_use(self):
+        co = compile(LAZY_SOURCE, 'lazy', 'exec')
+        f_code = [c for c in co.co_consts if isinstance(c, types.CodeType)][0]
+        data = marshal.dumps(co, 5)
+        # Make the co_code of f unreadable
+        i = data.index(f_code.co_code)
+        data = data[:i - 5] + b'?' + data[i - 4:]
+        self.assertRaises(ValueError, marshal.loads, data)
+        # Mutable buffers are always loaded eagerly
+        self.assertRaises(ValueError, marshal.loads, bytearray(data),
+                          lazy=True)
+
+        ns = {}
+        exec(marshal.loads(data, lazy=True), ns)
+        self.assertEqual(ns['C']().m(), 42)
+        f = ns['f']
+        self.assertEqual(f.__name__, 'f')
+        self.assertEqual(f.__code__.co_varnames, ('x',))
+        self.assertRaises(ValueError, f, [1])
+        self.assertRaises(ValueError, getattr, f, '__doc__')
+        self.assertRaises(ValueError, getattr, f.__code__, 'co_consts')
+        self.assertRaises(ValueError, marshal.dumps, f.__code__)
+
+    def test_memoryview(self):
+        data = memoryview(marshal.dumps(compile(LAZY_SOURCE, 'lazy', 'exec'),
+                                        5))
+        co = marshal.loads(data, lazy=True)
+        data.release()
+        self.run_code(co)
+
+    def test_dumps(self):
+        co = compile(LAZY_SOURCE, 'lazy', 'exec')
+        for version in range(marshal.version, 6):
+            new = marshal.loads(marshal.dumps(co, 5), lazy=True)
+            self.assertEqual(marshal.loads(marshal.dumps(new, version)), co)
+
+    @support.cpython_only
+    def test_same_filename_used(self):
+        co = compile(LAZY_SOURCE, "myfile", "exec")
+        co = marshal.loads(marshal.dumps(co, 5), lazy=True)
+        for obj in co.co_consts:
+            if isinstance(obj, types.CodeType):
+                self.assertIs(co.co_filename, obj.co_filename)
+
 class ContainerTestCase(unittest.TestCase, HelperMixin):
     d = {'astring': 'foo@bar.baz.spam',
          'afloat': 7283.43,
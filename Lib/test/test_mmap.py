@@ -570,6 +570,23 @@ class MmapTests(unittest.TestCase):
         self.assertRaises(TypeError, m.write, "foo")
         f.close()
 
+    @unittest.skipIf(os.name == 'nt', 'trackfd is only supported on Unix')
+    def test_trackfd(self):
+        with open(TESTFN, "wb") as fp:
+            fp.write(b"abcdef")
+        with open(TESTFN, "r+b") as f:
+            m = mmap.mmap(f.fileno(), 0, trackfd=False)
+        self.addCleanup(m.close)
+        # The map stays valid once the file is closed.
+        self.assertEqual(m[:], b"abcdef")
+        m[:3] = b"xyz"
+        m.flush()
+        with open(TESTFN, "rb") as f:
+            self.assertEqual(f.read(), b"xyzdef")
+        self.assertRaises(ValueError, m.size)
+        self.assertRaises(ValueError, m.resize, 3)
+        self.assertEqual(len(m), 6)
+
     def test_error(self):
         self.assertIs(mmap.error, OSError)
 
@@ -17,6 +17,7 @@ from test.pickletester import AbstractPickleModuleTests
 from test.pickletester import AbstractPersistentPicklerTests
 from test.pickletester import AbstractIdentityPersistentPicklerTests
 from test.pickletester import AbstractPicklerUnpicklerObjectTests
+from test.pickletester import AbstractIncrementalUnpicklerTests
 from test.pickletester import AbstractDispatchTableTests
 from test.pickletester import BigmemPickleTests
 
@@ -55,9 +56,9 @@ class PyPicklerTests(AbstractPickleTests):
     pickler = pickle._Pickler
     unpickler = pickle._Unpickler
 
-    def dumps(self, arg, proto=None):
+    def dumps(self, arg, proto=None, **kwargs):
         f = io.BytesIO()
-        p = self.pickler(f, proto)
+        p = self.pickler(f, proto, **kwargs)
         p.dump(arg)
         f.seek(0)
         return bytes(f.read())
@@ -76,8 +77,8 @@ class InMemoryPickleTests(AbstractPickleTests, AbstractUnpickleTests,
                         AttributeError, ValueError,
                         struct.error, IndexError, ImportError)
 
-    def dumps(self, arg, protocol=None):
-        return pickle.dumps(arg, protocol)
+    def dumps(self, arg, protocol=None, **kwargs):
+        return pickle.dumps(arg, protocol, **kwargs)
 
     def loads(self, buf, **kwds):
         return pickle.loads(buf, **kwds)
@@ -185,6 +186,11 @@ class PyPicklerUnpicklerObjectTests(AbstractPicklerUnpicklerObjectTests):
     unpickler_class = pickle._Unpickler
 
 
+class PyIncrementalUnpicklerTests(AbstractIncrementalUnpicklerTests):
+
+    unpickler_class = pickle._IncrementalUnpickler
+
+
 class PyDispatchTableTests(AbstractDispatchTableTests):
 
     pickler_class = pickle._Pickler
@@ -243,6 +249,9 @@ if has_c_implementation:
                 unpickler.memo = {-1: None}
             unpickler.memo = {1: None}
 
+    class CIncrementalUnpicklerTests(AbstractIncrementalUnpicklerTests):
+        unpickler_class = _pickle.IncrementalUnpickler
+
     class CDispatchTableTests(AbstractDispatchTableTests):
         pickler_class = pickle.Pickler
         def get_dispatch_table(self):
@@ -253,12 +262,101 @@ if has_c_implementation:
         def get_dispatch_table(self):
             return collections.ChainMap({}, pickle.dispatch_table)
 
+    class PickleBufferTests(unittest.TestCase):
+
+        def check_memoryview(self, pb, equiv):
+            with memoryview(pb) as m:
+                with memoryview(equiv) as expected:
+                    self.assertEqual(m.nbytes, expected.nbytes)
+                    self.assertEqual(m.readonly, expected.readonly)
+                    self.assertEqual(m.itemsize, expected.itemsize)
+                    self.assertEqual(m.shape, expected.shape)
+                    self.assertEqual(m.strides, expected.strides)
+                    self.assertEqual(m.c_contiguous, expected.c_contiguous)
+                    self.assertEqual(m.f_contiguous, expected.f_contiguous)
+                    self.assertEqual(m.format, expected.format)
+                    self.assertEqual(m.tobytes(), expected.tobytes())
+
+        def check_raw(self, obj, equiv):
+            pb = pickle.PickleBuffer(obj)
+            with pb.raw() as m:
+                self.assertIsInstance(m, memoryview)
+                self.check_memoryview(m, equiv)
+
+        def test_constructor_failure(self):
+            with self.assertRaises(TypeError):
+                pickle.PickleBuffer()
+            with self.assertRaises(TypeError):
+                pickle.PickleBuffer("foo")
+            # Released memoryview fails taking a buffer
+            m = memoryview(b"foo")
+            m.release()
+            with self.assertRaises(ValueError):
+                pickle.PickleBuffer(m)
+
+        def test_basics(self):
+            def check(pb, readonly):
+                with memoryview(pb) as m:
+                    self.assertEqual(m.readonly, readonly)
+                    self.assertEqual(m.tobytes(), b"foo")
+            check(pickle.PickleBuffer(b"foo"), True)
+            check(pickle.PickleBuffer(bytearray(b"foo")), False)
+            check(pickle.PickleBuffer(memoryview(b"foo")), True)
+
+        def test_release(self):
+            b = bytearray(b"foo")
+            pb = pickle.PickleBuffer(b)
+            with self.assertRaises(BufferError):
+                b.append(1)         # Exported
+            pb.release()
+            b.append(1)             # No longer exported
+            pb.release()            # Idempotent
+            with self.assertRaises(ValueError):
+                memoryview(pb)
+            with self.assertRaises(ValueError):
+                pb.raw()
+
+        def test_cycle(self):
+            class B(bytearray):
+                pass
+            b = B(b"foo")
+            pb = pickle.PickleBuffer(b)
+            wpb = weakref.ref(pb)
+            b.pb = pb
+            del b, pb
+            support.gc_collect()
+            self.assertIsNone(wpb())
+
+        def test_ndarray_2d(self):
+            # 2-D, C-contiguous
+            ndarray = memoryview(bytearray(range(12))).cast('B', (3, 4))
+            pb = pickle.PickleBuffer(ndarray)
+            self.check_memoryview(pb, ndarray)
+            self.check_raw(ndarray, memoryview(bytearray(range(12))))
+            # 2-D, non-contiguous
+            ndarray = ndarray[::2]
+            pb = pickle.PickleBuffer(ndarray)
+            self.check_memoryview(pb, ndarray)
+            with self.assertRaises(BufferError):
+                pb.raw()
+            for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+                with self.assertRaises(pickle.PicklingError):
+                    pickle.dumps(pb, proto)
+
+        def test_raw_format(self):
+            arr = memoryview(bytearray(16)).cast('i')
+            with pickle.PickleBuffer(arr).raw() as m:
+                self.assertEqual(m.format, 'B')
+                self.assertEqual(m.shape, (16,))
+                self.assertEqual(m.strides, (1,))
+                self.assertFalse(m.readonly)
+
     @support.cpython_only
     class SizeofTests(unittest.TestCase):
         check_sizeof = support.check_sizeof
 
         def test_pickler(self):
-            basesize = support.calcobjsize('6P2n3i2n3iP')
+            basesize = support.calcobjsize('6P2n3i2n3i2P')
             p = _pickle.Pickler(io.BytesIO())
             self.assertEqual(object.__sizeof__(p), basesize)
             MT_size = struct.calcsize('3nP0n')
@@ -275,7 +373,7 @@ if has_c_implementation:
                 0)  # Write buffer is cleared after every dump().
 
         def test_unpickler(self):
-            basesize = support.calcobjsize('2P2n2P 2P2n2i5P 2P3n6P2n2i')
+            basesize = support.calcobjsize('2P2n2P 2P2n2i5P 2P3n7P2n2iP')
             unpickler = _pickle.Unpickler
             P = struct.calcsize('P')  # Size of memo table entry.
             n = struct.calcsize('n')  # Size of mark table entry.
@@ -497,7 +595,7 @@ class CompatPickleTests(unittest.TestCase):
 def test_main():
     tests = [PyPickleTests, PyUnpicklerTests, PyPicklerTests,
              PyPersPicklerTests, PyIdPersPicklerTests,
-             PyDispatchTableTests, PyChainDispatchTableTests,
+             PyIncrementalUnpicklerTests, PyDispatchTableTests, PyChainDispatchTableTests,
              CompatPickleTests]
     if has_c_implementation:
         tests.extend([CPickleTests, CUnpicklerTests, CPicklerTests,
@@ -505,8 +603,10 @@ def test_main():
                       CDumpPickle_LoadPickle, DumpPickle_CLoadPickle,
                       PyPicklerUnpicklerObjectTests,
                       CPicklerUnpicklerObjectTests,
+                      CIncrementalUnpicklerTests,
                       CDispatchTableTests, CChainDispatchTableTests,
-                      InMemoryPickleTests, SizeofTests])
+                      InMemoryPickleTests, PickleBufferTests,
+                      SizeofTests])
     support.run_unittest(*tests)
     support.run_doctest(pickle)
 
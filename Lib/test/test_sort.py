@@ -1,5 +1,6 @@
 from test import support
 import random
+import sys
 import unittest
 from functools import cmp_to_key
 
@@ -373,6 +374,111 @@ class TestOptimizedCompares(unittest.TestCase):
         check_against_PyObject_RichCompareBool(self, [float('nan')]*100)
         check_against_PyObject_RichCompareBool(self, [float('nan') for
                                                       _ in range(100)])
+
+    # Lists of at least 512 machine-size ints or floats, or with keys which
+    # are tuples of them, are radix sorted unless they are mostly in order.
+    # Equal values are distinct objects below, so the checks cover stability
+    # as well.
+
+    def test_radix_sort_ints(self):
+        for bits in 8, 30, 40, 62, 63:
+            L = [random.randrange(-2**bits, 2**bits) for _ in range(2000)]
+            check_against_PyObject_RichCompareBool(self, L + L[:500])
+        L = [-2**63 + 1, 2**63 - 1, 0, -1, 1] * 200
+        check_against_PyObject_RichCompareBool(self, L)
+        # ints too large for a machine word take the timsort path
+        L = [random.randrange(-2**64, 2**64) for _ in range(2000)]
+        check_against_PyObject_RichCompareBool(self, L + [-2**63, 2**63])
+
+    def test_radix_sort_floats(self):
+        L = [random.gauss(0, 1e6) for _ in range(2000)]
+        check_against_PyObject_RichCompareBool(self, L + L[:500])
+        L = [0.0, -0.0, 1.5, -1.5, 1e-320, -1e-320, 1e308, -1e308,
+             float('inf'), float('-inf')] * 100
+        check_against_PyObject_RichCompareBool(self, L)
+        # NaNs leave the list to timsort
+        L = [float(x) for x in range(2000)] + [float('nan')]
+        check_against_PyObject_RichCompareBool(self, L)
+
+    def test_radix_sort_reverse(self):
+        data = [(random.randrange(100), i) for i in range(2000)]
+        for make in (lambda x: x + 2**40), float:
+            L = [make(x) for x, i in data]
+            expected = [L[i] for x, i in sorted(data, key=lambda t: t[0],
+                                                reverse=True)]
+            L.sort(reverse=True)
+            self.assertEqual(len(L), len(expected))
+            for x, y in zip(L, expected):
+                self.assertIs(x, y)
+
+    def test_radix_sort_key(self):
+        data = [random.randrange(-2**40, 2**40) for _ in range(2000)]
+        data += data[:500]
+        for key in (lambda x: x, float, lambda x: (x,),
+                    lambda x: (x % 7, float(x)), lambda x: (x % 3, x % 5, x),
+                    lambda x: (x % 2, x % 3, x % 5, x)):
+            L = data[:]
+            random.shuffle(L)
+            for reverse in False, True:
+                expected = sorted(L, key=cmp_to_key(
+                    lambda a, b: (key(a) > key(b)) - (key(a) < key(b))),
+                    reverse=reverse)
+                got = sorted(L, key=key, reverse=reverse)
+                for x, y in zip(got, expected):
+                    self.assertIs(x, y)
+        # keys which can't be radix sorted are left to timsort
+        for key in (lambda x: (x % 3, x % 2 or 0.5),
+                    lambda x: (x,) * (x % 2 + 1),
+                    lambda x: (x, x, x, x, x),
+                    lambda x: (x, float('nan'))):
+            L = data[:]
+            self.assertEqual(sorted(L, key=key), sorted(L, key=cmp_to_key(
+                lambda a, b: (key(a) > key(b)) - (key(a) < key(b)))))
+
+    def test_radix_sort_presorted(self):
+        # mostly ordered lists are left to timsort
+        for L in (list(range(2000)), list(range(2000, 0, -1)),
+                  [float(x) for x in range(1000)] * 2):
+            self.assertEqual(sorted(L), sorted(L, key=lambda x: x))
+
+class TestParallelSort(unittest.TestCase):
+    # Lists of at least 2 * 2**16 floats, single digit ints or latin-1
+    # strings are sorted by several threads after sys.setsortthreads().
+
+    def setUp(self):
+        self.addCleanup(sys.setsortthreads, sys.getsortthreads())
+
+    def check(self, L, **kwargs):
+        sys.setsortthreads(1)
+        expected = sorted(L, **kwargs)
+        for n in 2, 3, 8:
+            sys.setsortthreads(n)
+            got = sorted(L, **kwargs)
+            self.assertEqual(len(got), len(expected))
+            for x, y in zip(got, expected):
+                self.assertIs(x, y)
+
+    def test_strings(self):
+        # few distinct values, as distinct objects, to check stability
+        L = ['%03x' % random.randrange(4000) for _ in range(200000)]
+        self.check(L)
+        self.check(L, reverse=True)
+        self.check(L, key=str.lower)
+
+    def test_ints_and_floats(self):
+        # mostly sorted lists, which aren't radix sorted
+        L = list(range(200000))
+        for i in range(0, len(L), 997):
+            L[i] = random.randrange(1000) + 2**20
+        self.check(L)
+        self.check([x + 0.5 for x in L], reverse=True)
+
+    def test_not_parallel(self):
+        # tuples and large ints may run Python code while comparing
+        L = [(random.randrange(100), i) for i in range(200000)]
+        self.check(L)
+        self.check([x + 2**100 for x, i in L])
+
 #==============================================================================
 
 if __name__ == "__main__":
@@ -826,5 +826,135 @@ class UnpackIteratorTest(unittest.TestCase):
             self.assertEqual(bits, struct.pack(formatcode, f))
 
 
+class ColumnsTest(unittest.TestCase):
+    """
+    Tests for unpacking to and packing from columns
+    (struct.Struct.unpack_columns and struct.Struct.pack_columns).
+    """
+
+    def check_roundtrip(self, fmt, records):
+        s = struct.Struct(fmt)
+        data = b''.join(s.pack(*record) for record in records)
+        columns = s.unpack_columns(data)
+        self.assertIsInstance(columns, tuple)
+        self.assertEqual(len(columns), len(records[0]) if records else
+                         len(s.unpack(bytes(s.size))))
+        self.assertEqual(list(zip(*[list(c) for c in columns])),
+                         [s.unpack(s.pack(*record)) for record in records])
+        self.assertEqual(s.pack_columns(*columns), data)
+        self.assertEqual(s.pack_columns(*[list(c) for c in columns]), data)
+        return columns
+
+    def test_integers(self):
+        for code, byteorder in iter_integer_formats():
+            fmt = byteorder + code
+            with self.subTest(format=fmt):
+                size = struct.calcsize(fmt)
+                if code.islower():
+                    values = [0, 1, -1, 2 ** (size * 8 - 1) - 1,
+                              -2 ** (size * 8 - 1)]
+                else:
+                    values = [0, 1, 2 ** (size * 8) - 1, 0x12]
+                column, = self.check_roundtrip(fmt, [(v,) for v in values])
+                self.assertIsInstance(column, memoryview)
+                self.assertEqual(column.itemsize, size)
+                self.assertEqual(column.format.islower(), code.islower())
+
+    def test_floats(self):
+        values = [0.0, -0.0, 1.5, -2.25, float('inf'), 65504.0]
+        for code in 'efd':
+            for byteorder in byteorders:
+                fmt = byteorder + code
+                with self.subTest(format=fmt):
+                    column, = self.check_roundtrip(fmt,
+                                                   [(v,) for v in values])
+                    self.assertEqual(column.format, 'd' if code == 'd'
+                                                    else 'f')
+        column, = struct.unpack_columns('<d', struct.pack('<d', math.nan))
+        self.assertTrue(math.isnan(column[0]))
+        with self.assertRaises(OverflowError):
+            struct.pack_columns('<e', array.array('f', [1e6]))
+
+    def test_mixed(self):
+        records = [(i, -i, i * 0.5, i % 3 == 0, b'abc'[:i % 4], b'%d' % i,
+                    bytes([i % 256]))
+                   for i in range(1000)]
+        for byteorder in byteorders:
+            fmt = byteorder + 'Ih2xd?3s5pc'
+            with self.subTest(format=fmt):
+                columns = self.check_roundtrip(fmt, records)
+                self.assertEqual([type(c) for c in columns],
+                                 [memoryview] * 4 + [list] * 2 +
+                                 [memoryview])
+        columns = struct.unpack_columns('<2H', b'\x01\x00\x02\x00')
+        self.assertEqual([list(c) for c in columns], [[1], [2]])
+
+    def test_bool(self):
+        columns = struct.unpack_columns('<?', bytes([0, 1, 2, 255]))
+        self.assertEqual(list(columns[0]), [False, True, True, True])
+        self.assertEqual(struct.pack_columns('<?', columns[0]),
+                         bytes([0, 1, 1, 1]))
+
+    def test_offset_count(self):
+        s = struct.Struct('>H')
+        data = bytes(range(10))
+        column, = s.unpack_columns(data, 1, 2)
+        self.assertEqual(list(column), [0x0102, 0x0304])
+        column, = s.unpack_columns(data, offset=4)
+        self.assertEqual(list(column), [0x0405, 0x0607, 0x0809])
+        column, = s.unpack_columns(data, -4)
+        self.assertEqual(list(column), [0x0607, 0x0809])
+        column, = s.unpack_columns(data, count=0)
+        self.assertEqual(list(column), [])
+        column, = s.unpack_columns(memoryview(data)[2:], count=4)
+        self.assertEqual(list(column), [0x0203, 0x0405, 0x0607, 0x0809])
+        with self.assertRaises(struct.error):
+            s.unpack_columns(data, 1)
+        with self.assertRaises(struct.error):
+            s.unpack_columns(data, count=6)
+        with self.assertRaises(struct.error):
+            s.unpack_columns(data, 11)
+        with self.assertRaises(struct.error):
+            s.unpack_columns(data, -11)
+        with self.assertRaises(struct.error):
+            struct.Struct('>').unpack_columns(b'')
+
+    def test_pack_columns(self):
+        s = struct.Struct('<iQ')
+        expected = s.pack(1, 2) + s.pack(-3, 4)
+        # Buffers of other formats, and other sequences are packed value
+        # by value
+        for first in ([1, -3], (1, -3), array.array('i', [1, -3]),
+                      array.array('l', [1, -3]), array.array('b', [1, -3]),
+                      memoryview(array.array('q', [1, -3]))):
+            for second in (range(2, 5, 2), array.array('Q', [2, 4]),
+                           array.array('B', [2, 4])):
+                with self.subTest(first=first, second=second):
+                    self.assertEqual(s.pack_columns(first, second),
+                                     expected)
+        self.assertEqual(struct.pack_columns('<c', b'ab'), b'ab')
+        self.assertEqual(s.pack_columns([], []), b'')
+        with self.assertRaises(struct.error):
+            s.pack_columns([1])
+        with self.assertRaises(struct.error):
+            s.pack_columns([1], [2, 3])
+        with self.assertRaises(struct.error):
+            s.pack_columns([2 ** 40], [2])
+        with self.assertRaises(struct.error):
+            s.pack_columns(array.array('q', [2 ** 40]), [2])
+        with self.assertRaises(struct.error):
+            s.pack_columns([1], [-2])
+        with self.assertRaises(TypeError):
+            s.pack_columns(1, [2])
+        with self.assertRaises(struct.error):
+            struct.pack_columns('3s', [1])
+
+    def test_writable(self):
+        s = struct.Struct('<I')
+        column, = s.unpack_columns(s.pack(1) + s.pack(2))
+        column[0] = 5
+        self.assertEqual(s.pack_columns(column), s.pack(5) + s.pack(2))
+
+
 if __name__ == '__main__':
     unittest.main()
@@ -183,6 +183,20 @@ class SysModuleTest(unittest.TestCase):
         finally:
             sys.setswitchinterval(orig)
 
+    def test_sortthreads(self):
+        self.assertRaises(TypeError, sys.setsortthreads)
+        self.assertRaises(TypeError, sys.setsortthreads, 2.0)
+        self.assertRaises(ValueError, sys.setsortthreads, 0)
+        self.assertRaises(ValueError, sys.setsortthreads, 257)
+        orig = sys.getsortthreads()
+        self.assertEqual(orig, 1)
+        try:
+            for n in 2, 256, 1:
+                sys.setsortthreads(n)
+                self.assertEqual(sys.getsortthreads(), n)
+        finally:
+            sys.setsortthreads(orig)
+
     def test_recursionlimit(self):
         self.assertRaises(TypeError, sys.getrecursionlimit, 42)
         oldlimit = sys.getrecursionlimit()
@@ -891,6 +905,15 @@ class SizeofTest(unittest.TestCase):
         # but lists are
         self.assertEqual(sys.getsizeof([]), vsize('Pn') + gc_header_size)
 
+    def test_object_header(self):
+        # The object header format of test.support matches the C layout
+        import _testcapi
+        header = test.support._header
+        self.assertEqual(struct.calcsize(header), _testcapi.SIZEOF_PYOBJECT)
+        # ob_type is the last field
+        self.assertEqual(struct.calcsize(header[:-1]),
+                         _testcapi.OFFSETOF_OB_TYPE)
+
     def test_errors(self):
         class BadSizeof:
             def __sizeof__(self):
@@ -932,6 +955,7 @@ class SizeofTest(unittest.TestCase):
         calcsize = struct.calcsize
         size = test.support.calcobjsize
         vsize = test.support.calcvobjsize
+        indices = test.support.calcdictindicessize
         check = self.check_sizeof
         # bool
         check(True, vsize('') + self.longdigit)
@@ -983,9 +1007,9 @@ class SizeofTest(unittest.TestCase):
         # method-wrapper (descriptor object)
         check({}.__iter__, size('2P'))
         # dict
-        check({}, size('nQ2P') + calcsize('2nP2n') + 8 + (8*2//3)*calcsize('n2P'))
+        check({}, size('nQ2P') + calcsize('2nP2nP') + indices(8) + (8*2//3)*calcsize('n2P'))
         longdict = {1:1, 2:2, 3:3, 4:4, 5:5, 6:6, 7:7, 8:8}
-        check(longdict, size('nQ2P') + calcsize('2nP2n') + 16 + (16*2//3)*calcsize('n2P'))
+        check(longdict, size('nQ2P') + calcsize('2nP2nP') + indices(16) + (16*2//3)*calcsize('n2P'))
         # dictionary-keyview
         check({}.keys(), size('P'))
         # dictionary-valueview
@@ -1146,15 +1170,15 @@ class SizeofTest(unittest.TestCase):
                   '4P')
         class newstyleclass(object): pass
         # Separate block for PyDictKeysObject with 8 keys and 5 entries
-        check(newstyleclass, s + calcsize("2nP2n0P") + 8 + 5*calcsize("n2P"))
-        # dict with shared keys
-        check(newstyleclass().__dict__, size('nQ2P') + 5*self.P)
+        check(newstyleclass, s + calcsize("2nP2nP") + indices(8) + 5*calcsize("n2P"))
+        # dict with shared keys: values and insertion order
+        check(newstyleclass().__dict__, size('nQ2P') + 5*(self.P + 1))
         o = newstyleclass()
         o.a = o.b = o.c = o.d = o.e = o.f = o.g = o.h = 1
         # Separate block for PyDictKeysObject with 16 keys and 10 entries
-        check(newstyleclass, s + calcsize("2nP2n0P") + 16 + 10*calcsize("n2P"))
-        # dict with shared keys
-        check(newstyleclass().__dict__, size('nQ2P') + 10*self.P)
+        check(newstyleclass, s + calcsize("2nP2nP") + indices(16) + 10*calcsize("n2P"))
+        # dict with shared keys: values and insertion order
+        check(newstyleclass().__dict__, size('nQ2P') + 10*(self.P + 1))
         # unicode
         # each tuple contains a string and its expected character size
         # don't put any static strings here, as they may contain
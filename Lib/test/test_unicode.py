@@ -1735,6 +1735,79 @@ class UnicodeTest(string_tests.CommonTest,
             self.assertRaises(UnicodeDecodeError,
                               (b'\xF4'+cb+b'\xBF\xBF').decode, 'utf-8')
 
+    # Lengths around the 16 and 32 bytes handled at a time by the
+    # vectorized decoder, to test both its main loop and its tail
+    utf8_run_lengths = (15, 16, 17, 31, 32, 33)
+
+    def test_utf8_decode_runs(self):
+        for n in self.utf8_run_lengths:
+            for c in ('a', '\xe9', '€', '\U0001f600'):
+                for s in (c * n, 'a' * n + c, c + 'a' * n):
+                    with self.subTest(n=n, s=ascii(s[:2])):
+                        decoded = s.encode('utf-8').decode('utf-8')
+                        self.assertEqual(decoded, s)
+                        # the result has the narrowest kind
+                        self.assertEqual(sys.getsizeof(decoded),
+                                         sys.getsizeof(s))
+
+    def test_utf8_decode_at_vector_boundary(self):
+        for n in self.utf8_run_lengths:
+            for c in ('\x80', '\xff', 'Ā', '￿', '\U00010000'):
+                for m in (0, 1, 15, 16, 32):
+                    s = 'a' * n + c + 'b' * m
+                    with self.subTest(n=n, c=ascii(c), m=m):
+                        decoded = s.encode('utf-8').decode('utf-8')
+                        self.assertEqual(decoded, s)
+                        self.assertEqual(sys.getsizeof(decoded),
+                                         sys.getsizeof(s))
+
+    def test_utf8_decode_errors_in_vector(self):
+        invalid = [
+            b'\x80',                # lone continuation byte
+            b'\xff',                # invalid start byte
+            b'\xc0\xaf',            # overlong 2-byte sequence
+            b'\xe0\x80\xaf',        # overlong 3-byte sequence
+            b'\xf0\x80\x80\xaf',    # overlong 4-byte sequence
+            b'\xed\xa0\x80',        # surrogate
+            b'\xf4\x90\x80\x80',    # above U+10FFFF
+            b'\xc3',                # truncated 2-byte sequence
+            b'\xe2\x82',            # truncated 3-byte sequence
+            b'\xf0\x9f\x98',        # truncated 4-byte sequence
+        ]
+        for n in self.utf8_run_lengths:
+            for prefix in ('a' * n, '\xe9' * n, '€' * n):
+                head = prefix.encode('utf-8')
+                for seq in invalid:
+                    # decoded alone, the short sequence takes the scalar path
+                    short = seq + b'b'
+                    data = head + short + b'b' * 32
+                    with self.subTest(prefix=ascii(prefix[:2]), n=n, seq=seq):
+                        with self.assertRaises(UnicodeDecodeError) as cm:
+                            short.decode('utf-8')
+                        expected = cm.exception
+                        with self.assertRaises(UnicodeDecodeError) as cm:
+                            data.decode('utf-8')
+                        exc = cm.exception
+                        self.assertEqual(exc.reason, expected.reason)
+                        self.assertEqual(exc.start, len(head) + expected.start)
+                        self.assertEqual(exc.end, len(head) + expected.end)
+                        for errors in ('replace', 'surrogateescape',
+                                       'backslashreplace', 'ignore'):
+                            self.assertEqual(data.decode('utf-8', errors),
+                                             prefix +
+                                             short.decode('utf-8', errors) +
+                                             'b' * 32)
+
+    def test_utf8_decode_incomplete_after_run(self):
+        for n in self.utf8_run_lengths:
+            for prefix in ('a' * n, '\xe9' * n, '\U0001f600' * n):
+                head = prefix.encode('utf-8')
+                for seq in (b'\xc3', b'\xe2\x82', b'\xf0\x9f\x98'):
+                    with self.subTest(prefix=ascii(prefix[:2]), n=n, seq=seq):
+                        self.assertEqual(
+                            codecs.utf_8_decode(head + seq, 'strict', False),
+                            (prefix, len(head)))
+
     def test_issue8271(self):
         # Issue #8271: during the decoding of an invalid UTF-8 byte sequence,
         # only the start byte and the continuation byte(s) are now considered
@@ -1689,6 +1689,27 @@ class MappingTestCase(TestBase):
                 self.assertEqual(len(d), 1)
                 o = None  # lose ref
 
+    def test_remove_dead_weakref(self):
+        # _remove_dead_weakref() deletes the slot of the key it is given,
+        # also among keys probing the same slots
+        from _weakref import _remove_dead_weakref
+        live = Object(1)
+        dead = Object(2)
+        keys = [i << 10 for i in range(40)]
+        d = {k: weakref.ref(live) for k in keys}
+        d[keys[20]] = weakref.ref(dead)
+        del dead
+        gc.collect()  # For PyPy or other GCs.
+        _remove_dead_weakref(d, keys[5])
+        _remove_dead_weakref(d, keys[20])
+        keys.remove(keys[20])
+        self.assertEqual(list(d), keys)
+        for k in keys:
+            self.assertIs(d[k](), live)
+        d[20 << 10] = None
+        self.assertIsNone(d[20 << 10])
+        self.assertEqual(len(d), 40)
+
     def check_threaded_weak_dict_copy(self, type_, deepcopy):
         # `type_` should be either WeakKeyDictionary or WeakValueDictionary.
         # `deepcopy` should be either True or False.
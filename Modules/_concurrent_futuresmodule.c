@@ -0,0 +1,1394 @@
+/* C implementation of concurrent.futures.Future and of the worker loop
+   used by ThreadPoolExecutor.
+
+   The Python Future guards its state with a threading.Condition that is
+   created for every instance.  Here the GIL protects the state instead and
+   the Condition is only created when somebody asks for the _condition
+   attribute (wait() and as_completed() do).  Once it exists, state changes
+   take it and notify it exactly like the Python version. */
+
+#include "Python.h"
+#include "structmember.h"
+#include "pythread.h"
+
+
+/*[clinic input]
+module _concurrent_futures
+class _concurrent_futures.Future "FutureObj *" "&FutureType"
+class _concurrent_futures._WorkItem "WorkItemObj *" "&WorkItemType"
+[clinic start generated code]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=a7a7ab44d6a50210]*/
+
+
+_Py_IDENTIFIER(acquire);
+_Py_IDENTIFIER(add_cancelled);
+_Py_IDENTIFIER(add_exception);
+_Py_IDENTIFIER(add_result);
+_Py_IDENTIFIER(critical);
+_Py_IDENTIFIER(exc_info);
+_Py_IDENTIFIER(exception);
+_Py_IDENTIFIER(get);
+_Py_IDENTIFIER(notify_all);
+_Py_IDENTIFIER(release);
+_Py_IDENTIFIER(run);
+_Py_IDENTIFIER(set_exception);
+_Py_IDENTIFIER(set_result);
+_Py_IDENTIFIER(set_running_or_notify_cancel);
+
+
+/* Objects imported from concurrent.futures._base and threading.  They are
+   looked up when the first Future is created, since _base imports this
+   module while it is itself being initialized. */
+static PyObject *futures_CancelledError;
+static PyObject *futures_TimeoutError;
+static PyObject *futures_InvalidStateError;
+static PyObject *futures_logger;
+static PyObject *threading_Condition;
+
+
+typedef enum {
+    STATE_PENDING,
+    STATE_RUNNING,
+    STATE_CANCELLED,
+    STATE_CANCELLED_AND_NOTIFIED,
+    STATE_FINISHED
+} fut_state;
+
+#define STATE_IS_CANCELLED(state) \
+    ((state) == STATE_CANCELLED || (state) == STATE_CANCELLED_AND_NOTIFIED)
+#define STATE_IS_DONE(state) ((state) >= STATE_CANCELLED)
+
+/* Same values as the constants in concurrent.futures._base */
+static const char * const state_names[] = {
+    "PENDING",
+    "RUNNING",
+    "CANCELLED",
+    "CANCELLED_AND_NOTIFIED",
+    "FINISHED",
+};
+static const char * const state_descriptions[] = {
+    "pending",
+    "running",
+    "cancelled",
+    "cancelled",
+    "finished",
+};
+#define NUM_STATES (Py_ARRAY_LENGTH(state_names))
+static PyObject *state_strings[NUM_STATES];
+
+
+typedef struct {
+    PyObject_HEAD
+    fut_state fut_state;
+    PyObject *fut_result;
+    PyObject *fut_exception;
+    PyObject *fut_waiters;          /* list, created on first use */
+    PyObject *fut_callbacks;        /* list, created on first use */
+    PyObject *fut_condition;        /* threading.Condition or NULL */
+    /* Held for as long as the future is not done; created by the first
+       thread that has to wait for the future. */
+    PyThread_type_lock fut_done_lock;
+    PyObject *dict;
+    PyObject *fut_weakreflist;
+} FutureObj;
+
+typedef struct {
+    PyObject_HEAD
+    PyObject *wi_future;
+    PyObject *wi_fn;
+    PyObject *wi_args;
+    PyObject *wi_kwargs;
+} WorkItemObj;
+
+static PyTypeObject FutureType;
+static PyTypeObject WorkItemType;
+
+#define Future_CheckExact(obj) (Py_TYPE(obj) == &FutureType)
+#define WorkItem_CheckExact(obj) (Py_TYPE(obj) == &WorkItemType)
+
+
+static int
+import_base_objects(void)
+{
+    PyObject *module;
+
+    if (futures_logger != NULL) {
+        return 0;
+    }
+
+    module = PyImport_ImportModule("threading");
+    if (module == NULL) {
+        return -1;
+    }
+    threading_Condition = PyObject_GetAttrString(module, "Condition");
+    Py_DECREF(module);
+    if (threading_Condition == NULL) {
+        return -1;
+    }
+
+    module = PyImport_ImportModule("concurrent.futures._base");
+    if (module == NULL) {
+        goto error;
+    }
+    futures_CancelledError = PyObject_GetAttrString(module, "CancelledError");
+    if (futures_CancelledError == NULL) {
+        goto error;
+    }
+    futures_TimeoutError = PyObject_GetAttrString(module, "TimeoutError");
+    if (futures_TimeoutError == NULL) {
+        goto error;
+    }
+    futures_InvalidStateError = PyObject_GetAttrString(module,
+                                                       "InvalidStateError");
+    if (futures_InvalidStateError == NULL) {
+        goto error;
+    }
+    futures_logger = PyObject_GetAttrString(module, "LOGGER");
+    if (futures_logger == NULL) {
+        goto error;
+    }
+    Py_DECREF(module);
+    return 0;
+
+error:
+    Py_XDECREF(module);
+    Py_CLEAR(threading_Condition);
+    Py_CLEAR(futures_CancelledError);
+    Py_CLEAR(futures_TimeoutError);
+    Py_CLEAR(futures_InvalidStateError);
+    return -1;
+}
+
+
+/* Future: locking */
+
+/* Acquire the future's condition if it has one.  *pcond is set to the
+   acquired condition (or NULL), which must be passed to future_unlock();
+   the condition may be created by other code while we hold the GIL-only
+   "lock", so it is not looked up again on release. */
+static int
+future_lock(FutureObj *fut, PyObject **pcond)
+{
+    PyObject *cond = fut->fut_condition;
+    PyObject *res;
+
+    *pcond = NULL;
+    if (cond == NULL) {
+        return 0;
+    }
+    Py_INCREF(cond);
+    res = _PyObject_CallMethodIdObjArgs(cond, &PyId_acquire, NULL);
+    if (res == NULL) {
+        Py_DECREF(cond);
+        return -1;
+    }
+    Py_DECREF(res);
+    *pcond = cond;
+    return 0;
+}
+
+/* Release a condition acquired by future_lock(), optionally notifying its
+   waiters first.  An exception that is already set is preserved. */
+static int
+future_unlock(PyObject *cond, int notify)
+{
+    PyObject *exc_type, *exc_value, *exc_tb;
+    PyObject *res;
+    int status = 0;
+
+    if (cond == NULL) {
+        return 0;
+    }
+    PyErr_Fetch(&exc_type, &exc_value, &exc_tb);
+    if (notify) {
+        res = _PyObject_CallMethodIdObjArgs(cond, &PyId_notify_all, NULL);
+        if (res == NULL) {
+            status = -1;
+        }
+        else {
+            Py_DECREF(res);
+        }
+    }
+    if (status == 0) {
+        res = _PyObject_CallMethodIdObjArgs(cond, &PyId_release, NULL);
+        if (res == NULL) {
+            status = -1;
+        }
+        else {
+            Py_DECREF(res);
+        }
+    }
+    else {
+        /* Still release the condition, reporting the notify error */
+        PyObject *type, *value, *tb;
+        PyErr_Fetch(&type, &value, &tb);
+        res = _PyObject_CallMethodIdObjArgs(cond, &PyId_release, NULL);
+        if (res == NULL) {
+            PyErr_WriteUnraisable(cond);
+        }
+        else {
+            Py_DECREF(res);
+        }
+        PyErr_Restore(type, value, tb);
+    }
+    if (exc_type != NULL) {
+        if (status < 0) {
+            PyErr_WriteUnraisable(cond);
+        }
+        PyErr_Restore(exc_type, exc_value, exc_tb);
+        status = -1;
+    }
+    Py_DECREF(cond);
+    return status;
+}
+
+/* Wait for anybody holding the condition to release it, so that state
+   they set under it (for example the result after _state) is visible. */
+static int
+future_barrier(FutureObj *fut)
+{
+    PyObject *cond;
+
+    if (future_lock(fut, &cond) < 0) {
+        return -1;
+    }
+    return future_unlock(cond, 0);
+}
+
+static void
+future_set_state(FutureObj *fut, fut_state state)
+{
+    int was_done = STATE_IS_DONE(fut->fut_state);
+
+    fut->fut_state = state;
+    if (fut->fut_done_lock == NULL || was_done == STATE_IS_DONE(state)) {
+        return;
+    }
+    if (was_done) {
+        /* Only reachable by assigning to _state.  A waiter that grabbed
+           the lock releases it again without needing the GIL. */
+        PyThread_acquire_lock(fut->fut_done_lock, WAIT_LOCK);
+    }
+    else {
+        PyThread_release_lock(fut->fut_done_lock);
+    }
+}
+
+/* Wait until the future is done.  Return 1 if it is, 0 if the timeout
+   expired first and -1 with an exception set on error. */
+static int
+future_wait(FutureObj *fut, PyObject *timeout)
+{
+    _PyTime_t timeout_val, endtime = 0;
+    PY_TIMEOUT_T microseconds;
+    PyLockStatus r;
+
+    if (timeout == Py_None) {
+        microseconds = -1;
+    }
+    else {
+        if (_PyTime_FromSecondsObject(&timeout_val, timeout,
+                                      _PyTime_ROUND_TIMEOUT) < 0) {
+            return -1;
+        }
+        if (timeout_val < 0) {
+            timeout_val = 0;
+        }
+        microseconds = _PyTime_AsMicroseconds(timeout_val,
+                                              _PyTime_ROUND_TIMEOUT);
+        if (microseconds >= PY_TIMEOUT_MAX) {
+            PyErr_SetString(PyExc_OverflowError,
+                            "timeout value is too large");
+            return -1;
+        }
+        endtime = _PyTime_GetMonotonicClock() + timeout_val;
+    }
+
+    if (fut->fut_done_lock == NULL) {
+        fut->fut_done_lock = PyThread_allocate_lock();
+        if (fut->fut_done_lock == NULL) {
+            PyErr_SetString(PyExc_MemoryError, "can't allocate lock");
+            return -1;
+        }
+        if (!STATE_IS_DONE(fut->fut_state)) {
+            PyThread_acquire_lock(fut->fut_done_lock, NOWAIT_LOCK);
+        }
+    }
+
+    /* The lock is released when the future becomes done.  Each waiter
+       releases it again straight away so that every waiter wakes up. */
+    while (!STATE_IS_DONE(fut->fut_state) && microseconds != 0) {
+        Py_BEGIN_ALLOW_THREADS
+        r = PyThread_acquire_lock_timed(fut->fut_done_lock, microseconds, 1);
+        if (r == PY_LOCK_ACQUIRED) {
+            PyThread_release_lock(fut->fut_done_lock);
+        }
+        Py_END_ALLOW_THREADS
+
+        if (r == PY_LOCK_INTR && Py_MakePendingCalls() < 0) {
+            return -1;
+        }
+        if (r == PY_LOCK_ACQUIRED && future_barrier(fut) < 0) {
+            return -1;
+        }
+        if (r == PY_LOCK_FAILURE) {
+            break;
+        }
+        if (endtime > 0) {
+            timeout_val = endtime - _PyTime_GetMonotonicClock();
+            if (timeout_val < 0) {
+                timeout_val = 0;
+            }
+            microseconds = _PyTime_AsMicroseconds(timeout_val,
+                                                  _PyTime_ROUND_TIMEOUT);
+        }
+    }
+    return STATE_IS_DONE(fut->fut_state);
+}
+
+
+/* Future: helpers */
+
+static int
+future_ensure_list(PyObject **plist)
+{
+    if (*plist == NULL) {
+        *plist = PyList_New(0);
+        if (*plist == NULL) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/* Call method 'name' of every waiter with the future.  Iterates over a
+   copy since a woken up waiter may remove itself from the list. */
+static int
+future_notify_waiters(FutureObj *fut, _Py_Identifier *name)
+{
+    PyObject *waiters, *res;
+    Py_ssize_t i;
+
+    if (fut->fut_waiters == NULL || PyList_GET_SIZE(fut->fut_waiters) == 0) {
+        return 0;
+    }
+    waiters = PyList_GetSlice(fut->fut_waiters, 0,
+                              PyList_GET_SIZE(fut->fut_waiters));
+    if (waiters == NULL) {
+        return -1;
+    }
+    for (i = 0; i < PyList_GET_SIZE(waiters); i++) {
+        res = _PyObject_CallMethodIdObjArgs(PyList_GET_ITEM(waiters, i),
+                                            name, (PyObject *)fut, NULL);
+        if (res == NULL) {
+            Py_DECREF(waiters);
+            return -1;
+        }
+        Py_DECREF(res);
+    }
+    Py_DECREF(waiters);
+    return 0;
+}
+
+/* Log the current exception, like LOGGER.exception(msg, fut) would from
+   an except clause. */
+static int
+future_log_exception(const char *msg, FutureObj *fut)
+{
+    PyObject *exc_type, *exc_value, *exc_tb;
+    PyObject *func, *args, *kwargs, *res;
+
+    PyErr_Fetch(&exc_type, &exc_value, &exc_tb);
+    PyErr_NormalizeException(&exc_type, &exc_value, &exc_tb);
+    if (exc_tb != NULL) {
+        PyException_SetTraceback(exc_value, exc_tb);
+    }
+    Py_XDECREF(exc_type);
+    Py_XDECREF(exc_tb);
+
+    res = NULL;
+    func = _PyObject_GetAttrId(futures_logger, &PyId_exception);
+    args = Py_BuildValue("(sO)", msg, fut);
+    kwargs = PyDict_New();
+    if (func != NULL && args != NULL && kwargs != NULL &&
+        _PyDict_SetItemId(kwargs, &PyId_exc_info, exc_value) == 0)
+    {
+        res = PyObject_Call(func, args, kwargs);
+    }
+    Py_XDECREF(func);
+    Py_XDECREF(args);
+    Py_XDECREF(kwargs);
+    Py_XDECREF(exc_value);
+    if (res == NULL) {
+        return -1;
+    }
+    Py_DECREF(res);
+    return 0;
+}
+
+static int
+future_invoke_callbacks(FutureObj *fut)
+{
+    PyObject *callback, *res;
+    Py_ssize_t i;
+
+    if (fut->fut_callbacks == NULL) {
+        return 0;
+    }
+    for (i = 0; i < PyList_GET_SIZE(fut->fut_callbacks); i++) {
+        callback = PyList_GET_ITEM(fut->fut_callbacks, i);
+        Py_INCREF(callback);
+        res = PyObject_CallFunctionObjArgs(callback, (PyObject *)fut, NULL);
+        Py_DECREF(callback);
+        if (res != NULL) {
+            Py_DECREF(res);
+            continue;
+        }
+        if (!PyErr_ExceptionMatches(PyExc_Exception)) {
+            return -1;
+        }
+        if (future_log_exception("exception calling callback for %r",
+                                 fut) < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/* Raise the stored exception, keeping the traceback it was raised with. */
+static void
+future_raise_exception(PyObject *exc)
+{
+    if (PyExceptionInstance_Check(exc)) {
+        PyObject *type = PyExceptionInstance_Class(exc);
+        PyObject *tb = PyException_GetTraceback(exc);
+        Py_INCREF(type);
+        Py_INCREF(exc);
+        PyErr_Restore(type, exc, tb);
+    }
+    else if (PyExceptionClass_Check(exc)) {
+        PyErr_SetNone(exc);
+    }
+    else {
+        PyErr_SetString(PyExc_TypeError,
+                        "exceptions must derive from BaseException");
+    }
+}
+
+/* Return the result of a finished future or raise its exception. */
+static PyObject *
+future_get_result(FutureObj *fut)
+{
+    if (fut->fut_exception != NULL) {
+        int failed = PyObject_IsTrue(fut->fut_exception);
+        if (failed < 0) {
+            return NULL;
+        }
+        if (failed) {
+            future_raise_exception(fut->fut_exception);
+            return NULL;
+        }
+    }
+    if (fut->fut_result == NULL) {
+        Py_RETURN_NONE;
+    }
+    Py_INCREF(fut->fut_result);
+    return fut->fut_result;
+}
+
+/* Wait for the future like result() and exception() do.  Return 0 when the
+   future finished, or -1 with CancelledError, TimeoutError or another
+   exception set. */
+static int
+future_wait_finished(FutureObj *fut, PyObject *timeout)
+{
+    if (fut->fut_condition != NULL && future_barrier(fut) < 0) {
+        return -1;
+    }
+    if (!STATE_IS_DONE(fut->fut_state)) {
+        int done = future_wait(fut, timeout);
+        if (done < 0) {
+            return -1;
+        }
+        if (!done) {
+            PyErr_SetNone(futures_TimeoutError);
+            return -1;
+        }
+    }
+    if (STATE_IS_CANCELLED(fut->fut_state)) {
+        PyErr_SetNone(futures_CancelledError);
+        return -1;
+    }
+    return 0;
+}
+
+static int
+future_cancel(FutureObj *fut)
+{
+    PyObject *cond;
+
+    if (future_lock(fut, &cond) < 0) {
+        return -1;
+    }
+    if (fut->fut_state == STATE_RUNNING || fut->fut_state == STATE_FINISHED) {
+        if (future_unlock(cond, 0) < 0) {
+            return -1;
+        }
+        return 0;
+    }
+    if (STATE_IS_CANCELLED(fut->fut_state)) {
+        if (future_unlock(cond, 0) < 0) {
+            return -1;
+        }
+        return 1;
+    }
+    future_set_state(fut, STATE_CANCELLED);
+    if (future_unlock(cond, 1) < 0) {
+        return -1;
+    }
+    if (future_invoke_callbacks(fut) < 0) {
+        return -1;
+    }
+    return 1;
+}
+
+static int
+future_set_running_or_notify_cancel(FutureObj *fut)
+{
+    PyObject *cond, *res;
+
+    if (future_lock(fut, &cond) < 0) {
+        return -1;
+    }
+    if (fut->fut_state == STATE_CANCELLED) {
+        future_set_state(fut, STATE_CANCELLED_AND_NOTIFIED);
+        if (future_notify_waiters(fut, &PyId_add_cancelled) < 0) {
+            future_unlock(cond, 0);
+            return -1;
+        }
+        /* No need to notify the condition, cancel() already did. */
+        if (future_unlock(cond, 0) < 0) {
+            return -1;
+        }
+        return 0;
+    }
+    if (fut->fut_state == STATE_PENDING) {
+        future_set_state(fut, STATE_RUNNING);
+        if (future_unlock(cond, 0) < 0) {
+            return -1;
+        }
+        return 1;
+    }
+
+    res = _PyObject_CallMethodId(futures_logger, &PyId_critical, "snO",
+                                 "Future %s in unexpected state: %s",
+                                 (Py_ssize_t)fut,
+                                 state_strings[fut->fut_state]);
+    if (res == NULL) {
+        future_unlock(cond, 0);
+        return -1;
+    }
+    Py_DECREF(res);
+    PyErr_SetString(PyExc_RuntimeError, "Future in unexpected state");
+    future_unlock(cond, 0);
+    return -1;
+}
+
+/* Shared by set_result() and set_exception(). */
+static int
+future_finish(FutureObj *fut, PyObject **slot, PyObject *value,
+              _Py_Identifier *notify_method)
+{
+    PyObject *cond;
+
+    if (future_lock(fut, &cond) < 0) {
+        return -1;
+    }
+    if (STATE_IS_DONE(fut->fut_state)) {
+        PyErr_Format(futures_InvalidStateError, "%U: %R",
+                     state_strings[fut->fut_state], fut);
+        future_unlock(cond, 0);
+        return -1;
+    }
+    Py_INCREF(value);
+    Py_XSETREF(*slot, value);
+    future_set_state(fut, STATE_FINISHED);
+    if (future_notify_waiters(fut, notify_method) < 0) {
+        future_unlock(cond, 1);
+        return -1;
+    }
+    if (future_unlock(cond, 1) < 0) {
+        return -1;
+    }
+    return future_invoke_callbacks(fut);
+}
+
+static int
+future_set_result(FutureObj *fut, PyObject *result)
+{
+    return future_finish(fut, &fut->fut_result, result, &PyId_add_result);
+}
+
+static int
+future_set_exception(FutureObj *fut, PyObject *exception)
+{
+    return future_finish(fut, &fut->fut_exception, exception,
+                         &PyId_add_exception);
+}
+
+
+/* Future: methods */
+
+/*[clinic input]
+@classmethod
+_concurrent_futures.Future.__new__ as future_new
+
+Represents the result of an asynchronous computation.
+[clinic start generated code]*/
+
+static PyObject *
+future_new_impl(PyTypeObject *type)
+/*[clinic end generated code: output=fc1381b521e7b6b8 input=52528ea35723f0c8]*/
+{
+    FutureObj *fut;
+
+    if (import_base_objects() < 0) {
+        return NULL;
+    }
+    fut = (FutureObj *)type->tp_alloc(type, 0);
+    if (fut == NULL) {
+        return NULL;
+    }
+    fut->fut_state = STATE_PENDING;
+    return (PyObject *)fut;
+}
+
+/*[clinic input]
+_concurrent_futures.Future.cancel
+
+Cancel the future if possible.
+
+Returns True if the future was cancelled, False otherwise. A future
+cannot be cancelled if it is running or has already completed.
+[clinic start generated code]*/
+
+static PyObject *
+_concurrent_futures_Future_cancel_impl(FutureObj *self)
+/*[clinic end generated code: output=b030c248ff0a1358 input=795053f858b10fcb]*/
+{
+    int cancelled = future_cancel(self);
+    if (cancelled < 0) {
+        return NULL;
+    }
+    return PyBool_FromLong(cancelled);
+}
+
+/*[clinic input]
+_concurrent_futures.Future.cancelled
+
+Return True if the future was cancelled.
+[clinic start generated code]*/
+
+static PyObject *
+_concurrent_futures_Future_cancelled_impl(FutureObj *self)
+/*[clinic end generated code: output=4c48406f2309b286 input=2181dfd1d84a8ae3]*/
+{
+    return PyBool_FromLong(STATE_IS_CANCELLED(self->fut_state));
+}
+
+/*[clinic input]
+_concurrent_futures.Future.running
+
+Return True if the future is currently executing.
+[clinic start generated code]*/
+
+static PyObject *
+_concurrent_futures_Future_running_impl(FutureObj *self)
+/*[clinic end generated code: output=e617d35117a5fc75 input=e3e423c4b1b10b3a]*/
+{
+    return PyBool_FromLong(self->fut_state == STATE_RUNNING);
+}
+
+/*[clinic input]
+_concurrent_futures.Future.done
+
+Return True of the future was cancelled or finished executing.
+[clinic start generated code]*/
+
+static PyObject *
+_concurrent_futures_Future_done_impl(FutureObj *self)
+/*[clinic end generated code: output=eb526842fb2951e2 input=50d82f8def050264]*/
+{
+    return PyBool_FromLong(STATE_IS_DONE(self->fut_state));
+}
+
+/*[clinic input]
+_concurrent_futures.Future.add_done_callback
+
+    fn: object
+
+Attaches a callable that will be called when the future finishes.
+
+The callable is called with this future as its only argument.  If the
+future has already completed or been cancelled then the callable will
+be called immediately.  Callables are called in the order that they
+were added.
+[clinic start generated code]*/
+
+static PyObject *
+_concurrent_futures_Future_add_done_callback_impl(FutureObj *self,
+                                                  PyObject *fn)
+/*[clinic end generated code: output=23239940297c41be input=98014169b77cf344]*/
+{
+    PyObject *cond, *res;
+
+    if (future_lock(self, &cond) < 0) {
+        return NULL;
+    }
+    if (!STATE_IS_DONE(self->fut_state)) {
+        if (future_ensure_list(&self->fut_callbacks) < 0 ||
+            PyList_Append(self->fut_callbacks, fn) < 0)
+        {
+            future_unlock(cond, 0);
+            return NULL;
+        }
+        if (future_unlock(cond, 0) < 0) {
+            return NULL;
+        }
+        Py_RETURN_NONE;
+    }
+    if (future_unlock(cond, 0) < 0) {
+        return NULL;
+    }
+    res = PyObject_CallFunctionObjArgs(fn, (PyObject *)self, NULL);
+    if (res == NULL) {
+        return NULL;
+    }
+    Py_DECREF(res);
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_concurrent_futures.Future.result
+
+    timeout: object = None
+
+Return the result of the call that the future represents.
+
+Wait up to timeout seconds (forever if None) for the future to finish.
+Raises CancelledError if the future was cancelled, TimeoutError if it
+did not finish in time, and the exception raised by the call if any.
+[clinic start generated code]*/
+
+static PyObject *
+_concurrent_futures_Future_result_impl(FutureObj *self, PyObject *timeout)
+/*[clinic end generated code: output=fe017f5cbbd62bac input=7c8c60f64afa9260]*/
+{
+    if (future_wait_finished(self, timeout) < 0) {
+        return NULL;
+    }
+    return future_get_result(self);
+}
+
+/*[clinic input]
+_concurrent_futures.Future.exception
+
+    timeout: object = None
+
+Return the exception raised by the call that the future represents.
+
+Wait up to timeout seconds (forever if None) for the future to finish.
+Returns None if the call completed without raising.  Raises
+CancelledError if the future was cancelled and TimeoutError if it did
+not finish in time.
+[clinic start generated code]*/
+
+static PyObject *
+_concurrent_futures_Future_exception_impl(FutureObj *self, PyObject *timeout)
+/*[clinic end generated code: output=14d3158044a3d916 input=02a9e80cc5ed665f]*/
+{
+    if (future_wait_finished(self, timeout) < 0) {
+        return NULL;
+    }
+    if (self->fut_exception == NULL) {
+        Py_RETURN_NONE;
+    }
+    Py_INCREF(self->fut_exception);
+    return self->fut_exception;
+}
+
+/*[clinic input]
+_concurrent_futures.Future.set_running_or_notify_cancel
+
+Mark the future as running or process any cancel notifications.
+
+Should only be used by Executor implementations and unit tests.
+
+Returns False if the future was cancelled (notifying threads waiting in
+wait() or as_completed()), True otherwise.  Raises RuntimeError if the
+future is already running or done.
+[clinic start generated code]*/
+
+static PyObject *
+_concurrent_futures_Future_set_running_or_notify_cancel_impl(FutureObj *self)
+/*[clinic end generated code: output=250be576f8dcc857 input=b8a900bf9cf7cf25]*/
+{
+    int running = future_set_running_or_notify_cancel(self);
+    if (running < 0) {
+        return NULL;
+    }
+    return PyBool_FromLong(running);
+}
+
+/*[clinic input]
+_concurrent_futures.Future.set_result
+
+    result: object
+
+Sets the return value of work associated with the future.
+
+Should only be used by Executor implementations and unit tests.
+[clinic start generated code]*/
+
+static PyObject *
+_concurrent_futures_Future_set_result_impl(FutureObj *self, PyObject *result)
+/*[clinic end generated code: output=37b04d79d69666f1 input=c1789449063c716e]*/
+{
+    if (future_set_result(self, result) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_concurrent_futures.Future.set_exception
+
+    exception: object
+
+Sets the result of the future as being the given exception.
+
+Should only be used by Executor implementations and unit tests.
+[clinic start generated code]*/
+
+static PyObject *
+_concurrent_futures_Future_set_exception_impl(FutureObj *self,
+                                              PyObject *exception)
+/*[clinic end generated code: output=44e90b58f3de1beb input=ca9770d8340fe13f]*/
+{
+    if (future_set_exception(self, exception) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_concurrent_futures.Future._invoke_callbacks
+
+Call the done callbacks, logging exceptions they raise.
+[clinic start generated code]*/
+
+static PyObject *
+_concurrent_futures_Future__invoke_callbacks_impl(FutureObj *self)
+/*[clinic end generated code: output=9dd677561a34fbff input=8e69d95a845bb5a6]*/
+{
+    if (future_invoke_callbacks(self) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+FutureObj_repr(FutureObj *fut)
+{
+    const char *name = _PyType_Name(Py_TYPE(fut));
+    const char *description = state_descriptions[fut->fut_state];
+
+    if (fut->fut_state == STATE_FINISHED) {
+        int failed = 0;
+        if (fut->fut_exception != NULL) {
+            failed = PyObject_IsTrue(fut->fut_exception);
+            if (failed < 0) {
+                return NULL;
+            }
+        }
+        if (failed) {
+            return PyUnicode_FromFormat("<%s at %p state=%s raised %s>",
+                                        name, fut, description,
+                                        _PyType_Name(Py_TYPE(fut->fut_exception)));
+        }
+        return PyUnicode_FromFormat("<%s at %p state=%s returned %s>",
+                                    name, fut, description,
+                                    fut->fut_result == NULL ? "NoneType" :
+                                    _PyType_Name(Py_TYPE(fut->fut_result)));
+    }
+    return PyUnicode_FromFormat("<%s at %p state=%s>",
+                                name, fut, description);
+}
+
+
+/* Future: attributes */
+
+static PyObject *
+FutureObj_get_state(FutureObj *fut, void *Py_UNUSED(ignored))
+{
+    PyObject *state = state_strings[fut->fut_state];
+    Py_INCREF(state);
+    return state;
+}
+
+static int
+FutureObj_set_state(FutureObj *fut, PyObject *value, void *Py_UNUSED(ignored))
+{
+    Py_ssize_t i;
+
+    if (value == NULL) {
+        PyErr_SetString(PyExc_AttributeError, "cannot delete _state");
+        return -1;
+    }
+    if (PyUnicode_Check(value)) {
+        for (i = 0; i < (Py_ssize_t)NUM_STATES; i++) {
+            if (_PyUnicode_EqualToASCIIString(value, state_names[i])) {
+                future_set_state(fut, (fut_state)i);
+                return 0;
+            }
+        }
+    }
+    PyErr_Format(PyExc_ValueError, "invalid future state: %R", value);
+    return -1;
+}
+
+static PyObject *
+FutureObj_get_waiters(FutureObj *fut, void *Py_UNUSED(ignored))
+{
+    if (future_ensure_list(&fut->fut_waiters) < 0) {
+        return NULL;
+    }
+    Py_INCREF(fut->fut_waiters);
+    return fut->fut_waiters;
+}
+
+static PyObject *
+FutureObj_get_callbacks(FutureObj *fut, void *Py_UNUSED(ignored))
+{
+    if (future_ensure_list(&fut->fut_callbacks) < 0) {
+        return NULL;
+    }
+    Py_INCREF(fut->fut_callbacks);
+    return fut->fut_callbacks;
+}
+
+static PyObject *
+FutureObj_get_condition(FutureObj *fut, void *Py_UNUSED(ignored))
+{
+    if (fut->fut_condition == NULL) {
+        PyObject *cond = _PyObject_CallNoArg(threading_Condition);
+        if (cond == NULL) {
+            return NULL;
+        }
+        /* Creating the condition may have let another thread do the same */
+        if (fut->fut_condition == NULL) {
+            fut->fut_condition = cond;
+        }
+        else {
+            Py_DECREF(cond);
+        }
+    }
+    Py_INCREF(fut->fut_condition);
+    return fut->fut_condition;
+}
+
+static PyGetSetDef FutureType_getsetlist[] = {
+    {"_state", (getter)FutureObj_get_state, (setter)FutureObj_set_state,
+     NULL},
+    {"_waiters", (getter)FutureObj_get_waiters, NULL, NULL},
+    {"_done_callbacks", (getter)FutureObj_get_callbacks, NULL, NULL},
+    {"_condition", (getter)FutureObj_get_condition, NULL, NULL},
+    {"__dict__", PyObject_GenericGetDict, PyObject_GenericSetDict},
+    {NULL} /* Sentinel */
+};
+
+static PyMemberDef FutureType_members[] = {
+    {"_result", T_OBJECT, offsetof(FutureObj, fut_result), 0},
+    {"_exception", T_OBJECT, offsetof(FutureObj, fut_exception), 0},
+    {NULL} /* Sentinel */
+};
+
+
+/* Future: type */
+
+static int
+FutureObj_clear(FutureObj *fut)
+{
+    Py_CLEAR(fut->fut_result);
+    Py_CLEAR(fut->fut_exception);
+    Py_CLEAR(fut->fut_waiters);
+    Py_CLEAR(fut->fut_callbacks);
+    Py_CLEAR(fut->fut_condition);
+    Py_CLEAR(fut->dict);
+    return 0;
+}
+
+static int
+FutureObj_traverse(FutureObj *fut, visitproc visit, void *arg)
+{
+    Py_VISIT(fut->fut_result);
+    Py_VISIT(fut->fut_exception);
+    Py_VISIT(fut->fut_waiters);
+    Py_VISIT(fut->fut_callbacks);
+    Py_VISIT(fut->fut_condition);
+    Py_VISIT(fut->dict);
+    return 0;
+}
+
+static void
+FutureObj_dealloc(FutureObj *fut)
+{
+    PyObject_GC_UnTrack(fut);
+    if (fut->fut_weakreflist != NULL) {
+        PyObject_ClearWeakRefs((PyObject *)fut);
+    }
+    (void)FutureObj_clear(fut);
+    if (fut->fut_done_lock != NULL) {
+        /* Unlock the lock so it's safe to free it */
+        if (!STATE_IS_DONE(fut->fut_state)) {
+            PyThread_release_lock(fut->fut_done_lock);
+        }
+        PyThread_free_lock(fut->fut_done_lock);
+    }
+    Py_TYPE(fut)->tp_free(fut);
+}
+
+#include "clinic/_concurrent_futuresmodule.c.h"
+
+static PyMethodDef FutureType_methods[] = {
+    _CONCURRENT_FUTURES_FUTURE_CANCEL_METHODDEF
+    _CONCURRENT_FUTURES_FUTURE_CANCELLED_METHODDEF
+    _CONCURRENT_FUTURES_FUTURE_RUNNING_METHODDEF
+    _CONCURRENT_FUTURES_FUTURE_DONE_METHODDEF
+    _CONCURRENT_FUTURES_FUTURE_ADD_DONE_CALLBACK_METHODDEF
+    _CONCURRENT_FUTURES_FUTURE_RESULT_METHODDEF
+    _CONCURRENT_FUTURES_FUTURE_EXCEPTION_METHODDEF
+    _CONCURRENT_FUTURES_FUTURE_SET_RUNNING_OR_NOTIFY_CANCEL_METHODDEF
+    _CONCURRENT_FUTURES_FUTURE_SET_RESULT_METHODDEF
+    _CONCURRENT_FUTURES_FUTURE_SET_EXCEPTION_METHODDEF
+    _CONCURRENT_FUTURES_FUTURE__INVOKE_CALLBACKS_METHODDEF
+    {NULL, NULL}        /* Sentinel */
+};
+
+static PyTypeObject FutureType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "_concurrent_futures.Future",
+    sizeof(FutureObj),                       /* tp_basicsize */
+    .tp_dealloc = (destructor)FutureObj_dealloc,
+    .tp_repr = (reprfunc)FutureObj_repr,
+    .tp_flags = (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC
+        | Py_TPFLAGS_BASETYPE),
+    .tp_doc = future_new__doc__,
+    .tp_traverse = (traverseproc)FutureObj_traverse,
+    .tp_clear = (inquiry)FutureObj_clear,
+    .tp_weaklistoffset = offsetof(FutureObj, fut_weakreflist),
+    .tp_methods = FutureType_methods,
+    .tp_members = FutureType_members,
+    .tp_getset = FutureType_getsetlist,
+    .tp_dictoffset = offsetof(FutureObj, dict),
+    .tp_new = future_new,
+};
+
+
+/* _WorkItem */
+
+/*[clinic input]
+@classmethod
+_concurrent_futures._WorkItem.__new__ as workitem_new
+
+    future: object
+    fn: object
+    args as call_args: object(subclass_of='&PyTuple_Type')
+    kwargs as call_kwargs: object(subclass_of='&PyDict_Type')
+    /
+
+A call to run in a worker thread and the future for its result.
+[clinic start generated code]*/
+
+static PyObject *
+workitem_new_impl(PyTypeObject *type, PyObject *future, PyObject *fn,
+                  PyObject *call_args, PyObject *call_kwargs)
+/*[clinic end generated code: output=66937ed3c236de9c input=3ab83f46a9e62094]*/
+{
+    WorkItemObj *item = (WorkItemObj *)type->tp_alloc(type, 0);
+    if (item == NULL) {
+        return NULL;
+    }
+    Py_INCREF(future);
+    item->wi_future = future;
+    Py_INCREF(fn);
+    item->wi_fn = fn;
+    Py_INCREF(call_args);
+    item->wi_args = call_args;
+    Py_INCREF(call_kwargs);
+    item->wi_kwargs = call_kwargs;
+    return (PyObject *)item;
+}
+
+static int
+workitem_set_running(PyObject *future)
+{
+    PyObject *res;
+    int running;
+
+    if (Future_CheckExact(future)) {
+        return future_set_running_or_notify_cancel((FutureObj *)future);
+    }
+    res = _PyObject_CallMethodIdObjArgs(future,
+                                        &PyId_set_running_or_notify_cancel,
+                                        NULL);
+    if (res == NULL) {
+        return -1;
+    }
+    running = PyObject_IsTrue(res);
+    Py_DECREF(res);
+    return running;
+}
+
+static int
+workitem_run(WorkItemObj *item)
+{
+    PyObject *future = item->wi_future;
+    PyObject *kwargs = item->wi_kwargs;
+    PyObject *result, *res;
+    int running, status;
+
+    Py_INCREF(future);
+    running = workitem_set_running(future);
+    if (running <= 0) {
+        Py_DECREF(future);
+        return running;
+    }
+
+    if (kwargs != NULL && PyDict_GET_SIZE(kwargs) == 0) {
+        kwargs = NULL;
+    }
+    result = PyObject_Call(item->wi_fn, item->wi_args, kwargs);
+    if (result == NULL) {
+        PyObject *exc_type, *exc_value, *exc_tb;
+
+        PyErr_Fetch(&exc_type, &exc_value, &exc_tb);
+        PyErr_NormalizeException(&exc_type, &exc_value, &exc_tb);
+        if (exc_tb != NULL) {
+            PyException_SetTraceback(exc_value, exc_tb);
+        }
+        if (Future_CheckExact(future)) {
+            status = future_set_exception((FutureObj *)future, exc_value);
+        }
+        else {
+            res = _PyObject_CallMethodIdObjArgs(future, &PyId_set_exception,
+                                                exc_value, NULL);
+            status = res == NULL ? -1 : 0;
+            Py_XDECREF(res);
+        }
+        Py_XDECREF(exc_type);
+        Py_XDECREF(exc_value);
+        Py_XDECREF(exc_tb);
+    }
+    else {
+        if (Future_CheckExact(future)) {
+            status = future_set_result((FutureObj *)future, result);
+        }
+        else {
+            res = _PyObject_CallMethodIdObjArgs(future, &PyId_set_result,
+                                                result, NULL);
+            status = res == NULL ? -1 : 0;
+            Py_XDECREF(res);
+        }
+        Py_DECREF(result);
+    }
+    Py_DECREF(future);
+    return status;
+}
+
+/*[clinic input]
+_concurrent_futures._WorkItem.run
+
+Run the call and store its outcome in the future.
+
+Does nothing if the future was cancelled.
+[clinic start generated code]*/
+
+static PyObject *
+_concurrent_futures__WorkItem_run_impl(WorkItemObj *self)
+/*[clinic end generated code: output=972e4a90b472cf09 input=b7897ed151e5e56e]*/
+{
+    if (workitem_run(self) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static int
+WorkItemObj_clear(WorkItemObj *item)
+{
+    Py_CLEAR(item->wi_future);
+    Py_CLEAR(item->wi_fn);
+    Py_CLEAR(item->wi_args);
+    Py_CLEAR(item->wi_kwargs);
+    return 0;
+}
+
+static int
+WorkItemObj_traverse(WorkItemObj *item, visitproc visit, void *arg)
+{
+    Py_VISIT(item->wi_future);
+    Py_VISIT(item->wi_fn);
+    Py_VISIT(item->wi_args);
+    Py_VISIT(item->wi_kwargs);
+    return 0;
+}
+
+static void
+WorkItemObj_dealloc(WorkItemObj *item)
+{
+    PyObject_GC_UnTrack(item);
+    (void)WorkItemObj_clear(item);
+    Py_TYPE(item)->tp_free(item);
+}
+
+static PyMethodDef WorkItemType_methods[] = {
+    _CONCURRENT_FUTURES__WORKITEM_RUN_METHODDEF
+    {NULL, NULL}        /* Sentinel */
+};
+
+static PyMemberDef WorkItemType_members[] = {
+    {"future", T_OBJECT, offsetof(WorkItemObj, wi_future), READONLY},
+    {"fn", T_OBJECT, offsetof(WorkItemObj, wi_fn), READONLY},
+    {"args", T_OBJECT, offsetof(WorkItemObj, wi_args), READONLY},
+    {"kwargs", T_OBJECT, offsetof(WorkItemObj, wi_kwargs), READONLY},
+    {NULL} /* Sentinel */
+};
+
+static PyTypeObject WorkItemType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "_concurrent_futures._WorkItem",
+    sizeof(WorkItemObj),                     /* tp_basicsize */
+    .tp_dealloc = (destructor)WorkItemObj_dealloc,
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,
+    .tp_doc = workitem_new__doc__,
+    .tp_traverse = (traverseproc)WorkItemObj_traverse,
+    .tp_clear = (inquiry)WorkItemObj_clear,
+    .tp_methods = WorkItemType_methods,
+    .tp_members = WorkItemType_members,
+    .tp_new = workitem_new,
+};
+
+
+/* Module */
+
+/*[clinic input]
+_concurrent_futures._run_work_items
+
+    work_queue: object
+    /
+
+Run the work items taken from work_queue until it returns None.
+[clinic start generated code]*/
+
+static PyObject *
+_concurrent_futures__run_work_items(PyObject *module, PyObject *work_queue)
+/*[clinic end generated code: output=8f19d3343d306060 input=e3a30538161aaa76]*/
+{
+    PyObject *get, *item, *res;
+    int status;
+
+    get = _PyObject_GetAttrId(work_queue, &PyId_get);
+    if (get == NULL) {
+        return NULL;
+    }
+    for (;;) {
+        item = _PyObject_CallNoArg(get);
+        if (item == NULL) {
+            break;
+        }
+        if (item == Py_None) {
+            Py_DECREF(item);
+            Py_DECREF(get);
+            Py_RETURN_NONE;
+        }
+        if (WorkItem_CheckExact(item)) {
+            status = workitem_run((WorkItemObj *)item);
+        }
+        else {
+            res = _PyObject_CallMethodIdObjArgs(item, &PyId_run, NULL);
+            status = res == NULL ? -1 : 0;
+            Py_XDECREF(res);
+        }
+        /* Delete references to object. See issue16284 */
+        Py_DECREF(item);
+        if (status < 0) {
+            break;
+        }
+    }
+    Py_DECREF(get);
+    return NULL;
+}
+
+static PyMethodDef module_methods[] = {
+    _CONCURRENT_FUTURES__RUN_WORK_ITEMS_METHODDEF
+    {NULL, NULL}        /* Sentinel */
+};
+
+PyDoc_STRVAR(module_doc,
+"Accelerator module for concurrent.futures.\n\
+This module is an implementation detail, please do not use it directly.");
+
+static struct PyModuleDef _concurrent_futuresmodule = {
+    PyModuleDef_HEAD_INIT,
+    "_concurrent_futures",
+    module_doc,
+    -1,
+    module_methods,
+    NULL,
+    NULL,
+    NULL,
+    NULL
+};
+
+
+PyMODINIT_FUNC
+PyInit__concurrent_futures(void)
+{
+    PyObject *m;
+    size_t i;
+
+    for (i = 0; i < NUM_STATES; i++) {
+        if (state_strings[i] == NULL) {
+            state_strings[i] = PyUnicode_InternFromString(state_names[i]);
+            if (state_strings[i] == NULL) {
+                return NULL;
+            }
+        }
+    }
+    if (PyType_Ready(&FutureType) < 0) {
+        return NULL;
+    }
+    if (PyType_Ready(&WorkItemType) < 0) {
+        return NULL;
+    }
+
+    m = PyModule_Create(&_concurrent_futuresmodule);
+    if (m == NULL) {
+        return NULL;
+    }
+
+    Py_INCREF(&FutureType);
+    if (PyModule_AddObject(m, "Future", (PyObject *)&FutureType) < 0) {
+        Py_DECREF(&FutureType);
+        Py_DECREF(m);
+        return NULL;
+    }
+    Py_INCREF(&WorkItemType);
+    if (PyModule_AddObject(m, "_WorkItem", (PyObject *)&WorkItemType) < 0) {
+        Py_DECREF(&WorkItemType);
+        Py_DECREF(m);
+        return NULL;
+    }
+    return m;
+}
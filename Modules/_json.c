@@ -8,6 +8,7 @@
 #include "Python.h"
 #include "structmember.h"
 #include "pycore_accu.h"
+#include "pycore_simd.h"
 
 #ifdef __GNUC__
 #define UNUSED __attribute__((__unused__))
@@ -58,6 +59,19 @@ typedef struct _PyEncoderObject {
     PyCFunction fast_encode;
 } PyEncoderObject;
 
+/* Output of the encoder: either str fragments accumulated for the caller to
+   join, or UTF-8 encoded bytes written to a growing buffer.  If a write()
+   callable is given, the buffer is passed to it whenever it holds about
+   OUTPUT_CHUNK_SIZE bytes, and then replaced. */
+typedef struct {
+    _PyAccu *acc;           /* str output, or NULL for bytes output */
+    PyObject *bytes;        /* the bytes buffer */
+    Py_ssize_t len;         /* length of its used part */
+    PyObject *write;        /* callable to flush the buffer to, or NULL */
+} EncoderOutput;
+
+#define OUTPUT_CHUNK_SIZE (64 * 1024)
+
 static PyMemberDef encoder_members[] = {
     {"markers", T_OBJECT, offsetof(PyEncoderObject, markers), READONLY, "markers"},
     {"default", T_OBJECT, offsetof(PyEncoderObject, defaultfn), READONLY, "default"},
@@ -107,17 +121,19 @@ encoder_dealloc(PyObject *self);
 static int
 encoder_clear(PyObject *self);
 static int
-encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc, PyObject *seq, Py_ssize_t indent_level);
+encoder_listencode_list(PyEncoderObject *s, EncoderOutput *out, PyObject *seq, Py_ssize_t indent_level);
 static int
-encoder_listencode_obj(PyEncoderObject *s, _PyAccu *acc, PyObject *obj, Py_ssize_t indent_level);
+encoder_listencode_obj(PyEncoderObject *s, EncoderOutput *out, PyObject *obj, Py_ssize_t indent_level);
 static int
-encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc, PyObject *dct, Py_ssize_t indent_level);
+encoder_listencode_dict(PyEncoderObject *s, EncoderOutput *out, PyObject *dct, Py_ssize_t indent_level);
 static PyObject *
 _encoded_const(PyObject *obj);
 static void
 raise_errmsg(const char *msg, PyObject *s, Py_ssize_t end);
 static PyObject *
 encoder_encode_string(PyEncoderObject *s, PyObject *obj);
+static int
+output_flush(EncoderOutput *out);
 static PyObject *
 encoder_encode_float(PyEncoderObject *s, PyObject *obj);
 
@@ -323,21 +339,30 @@ escape_unicode(PyObject *pystr)
     return rval;
 }
 
-static void
-raise_errmsg(const char *msg, PyObject *s, Py_ssize_t end)
+static PyObject *JSONDecodeError = NULL;
+
+static int
+load_json_decode_error(void)
 {
-    /* Use JSONDecodeError exception to raise a nice looking ValueError subclass */
-    static PyObject *JSONDecodeError = NULL;
-    PyObject *exc;
     if (JSONDecodeError == NULL) {
         PyObject *decoder = PyImport_ImportModule("json.decoder");
         if (decoder == NULL)
-            return;
+            return -1;
         JSONDecodeError = PyObject_GetAttrString(decoder, "JSONDecodeError");
         Py_DECREF(decoder);
         if (JSONDecodeError == NULL)
-            return;
+            return -1;
     }
+    return 0;
+}
+
+static void
+raise_errmsg(const char *msg, PyObject *s, Py_ssize_t end)
+{
+    /* Use JSONDecodeError exception to raise a nice looking ValueError subclass */
+    PyObject *exc;
+    if (load_json_decode_error() < 0)
+        return;
     exc = PyObject_CallFunction(JSONDecodeError, "zOn", msg, s, end);
     if (exc) {
         PyErr_SetObject(JSONDecodeError, exc);
@@ -397,6 +422,166 @@ _build_rval_index_tuple(PyObject *rval, Py_ssize_t idx) {
         Py_CLEAR(chunk); \
     }
 
+/* Scanning of string contents and whitespace.
+
+   find_string_special() returns the index of the first '"', '\\' or (if
+   strict) control character at or after start, or len if there is none.
+   The characters before it are copied as they are, and strings are often
+   long, so 1-byte and 2-byte strings are looked at 16 bytes at a time with
+   SSE2 (32 with AVX2).  Control characters are those with none of the bits
+   of ~0x1f set. */
+
+static Py_ssize_t
+find_string_special_scalar(int kind, const void *buf, Py_ssize_t i,
+                           Py_ssize_t len, int strict)
+{
+    for (; i < len; i++) {
+        Py_UCS4 c = PyUnicode_READ(kind, buf, i);
+        if (c == '"' || c == '\\' || (strict && c <= 0x1f))
+            break;
+    }
+    return i;
+}
+
+#ifdef _Py_HAVE_SSE2
+static Py_ssize_t
+find_string_special_ucs1_sse2(const Py_UCS1 *buf, Py_ssize_t i,
+                              Py_ssize_t len, int strict)
+{
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i high = _mm_set1_epi8((char)0xe0);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ctrl = _mm_set1_epi8(strict ? -1 : 0);
+
+    for (; len - i >= 16; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(buf + i));
+        __m128i m = _mm_or_si128(_mm_cmpeq_epi8(v, quote),
+                                 _mm_cmpeq_epi8(v, backslash));
+        m = _mm_or_si128(m, _mm_and_si128(
+            _mm_cmpeq_epi8(_mm_and_si128(v, high), zero), ctrl));
+        int mask = _mm_movemask_epi8(m);
+        if (mask)
+            return i + _Py_MASK_FIRST(mask);
+    }
+    return find_string_special_scalar(PyUnicode_1BYTE_KIND, buf, i, len,
+                                      strict);
+}
+
+static Py_ssize_t
+find_string_special_ucs2_sse2(const Py_UCS2 *buf, Py_ssize_t i,
+                              Py_ssize_t len, int strict)
+{
+    const __m128i quote = _mm_set1_epi16('"');
+    const __m128i backslash = _mm_set1_epi16('\\');
+    const __m128i high = _mm_set1_epi16((short)0xffe0);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ctrl = _mm_set1_epi16(strict ? -1 : 0);
+
+    for (; len - i >= 8; i += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(buf + i));
+        __m128i m = _mm_or_si128(_mm_cmpeq_epi16(v, quote),
+                                 _mm_cmpeq_epi16(v, backslash));
+        m = _mm_or_si128(m, _mm_and_si128(
+            _mm_cmpeq_epi16(_mm_and_si128(v, high), zero), ctrl));
+        /* two mask bits per character */
+        int mask = _mm_movemask_epi8(m);
+        if (mask)
+            return i + _Py_MASK_FIRST(mask) / 2;
+    }
+    return find_string_special_scalar(PyUnicode_2BYTE_KIND, buf, i, len,
+                                      strict);
+}
+#endif
+
+#ifdef _Py_HAVE_AVX2_DISPATCH
+_Py_TARGET_AVX2 static Py_ssize_t
+find_string_special_ucs1_avx2(const Py_UCS1 *buf, Py_ssize_t i,
+                              Py_ssize_t len, int strict)
+{
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    const __m256i high = _mm256_set1_epi8((char)0xe0);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ctrl = _mm256_set1_epi8(strict ? -1 : 0);
+
+    for (; len - i >= 32; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(buf + i));
+        __m256i m = _mm256_or_si256(_mm256_cmpeq_epi8(v, quote),
+                                    _mm256_cmpeq_epi8(v, backslash));
+        m = _mm256_or_si256(m, _mm256_and_si256(
+            _mm256_cmpeq_epi8(_mm256_and_si256(v, high), zero), ctrl));
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(m);
+        if (mask)
+            return i + _Py_MASK_FIRST(mask);
+    }
+    return find_string_special_ucs1_sse2(buf, i, len, strict);
+}
+#endif
+
+static Py_ssize_t
+find_string_special(int kind, const void *buf, Py_ssize_t start,
+                    Py_ssize_t len, int strict)
+{
+#ifdef _Py_HAVE_SSE2
+    if (kind == PyUnicode_1BYTE_KIND) {
+#ifdef _Py_HAVE_AVX2_DISPATCH
+        if (len - start >= 64 && _Py_cpu_has_avx2())
+            return find_string_special_ucs1_avx2(buf, start, len, strict);
+#endif
+        return find_string_special_ucs1_sse2(buf, start, len, strict);
+    }
+    if (kind == PyUnicode_2BYTE_KIND)
+        return find_string_special_ucs2_sse2(buf, start, len, strict);
+#endif
+    return find_string_special_scalar(kind, buf, start, len, strict);
+}
+
+#ifdef _Py_HAVE_SSE2
+static Py_ssize_t
+skip_whitespace_ucs1_sse2(const Py_UCS1 *buf, Py_ssize_t i, Py_ssize_t len)
+{
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i newline = _mm_set1_epi8('\n');
+    const __m128i cr = _mm_set1_epi8('\r');
+
+    for (; len - i >= 16; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(buf + i));
+        __m128i m = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, tab)),
+            _mm_or_si128(_mm_cmpeq_epi8(v, newline), _mm_cmpeq_epi8(v, cr)));
+        int mask = ~_mm_movemask_epi8(m) & 0xffff;
+        if (mask)
+            return i + _Py_MASK_FIRST(mask);
+    }
+    while (i < len && IS_WHITESPACE(buf[i]))
+        i++;
+    return i;
+}
+#endif
+
+/* Return the index of the first non-whitespace character at or after idx,
+   or end_idx + 1.  Most runs of whitespace are empty or a single space;
+   longer ones are usually the indentation of pretty-printed documents. */
+static inline Py_ssize_t
+skip_whitespace(int kind, const void *buf, Py_ssize_t idx, Py_ssize_t end_idx)
+{
+    if (idx > end_idx || !IS_WHITESPACE(PyUnicode_READ(kind, buf, idx)))
+        return idx;
+    idx++;
+#ifdef _Py_HAVE_SSE2
+    if (kind == PyUnicode_1BYTE_KIND && idx <= end_idx &&
+        IS_WHITESPACE(((const Py_UCS1 *)buf)[idx]))
+    {
+        return skip_whitespace_ucs1_sse2(buf, idx + 1, end_idx + 1);
+    }
+#endif
+    while (idx <= end_idx && IS_WHITESPACE(PyUnicode_READ(kind, buf, idx)))
+        idx++;
+    return idx;
+}
+
 static PyObject *
 scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next_end_ptr)
 {
@@ -431,12 +616,10 @@ scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next
     while (1) {
         /* Find the end of the string or the next escape */
         Py_UCS4 c = 0;
-        for (next = end; next < len; next++) {
+        next = find_string_special(kind, buf, end, len, strict);
+        if (next < len) {
             c = PyUnicode_READ(kind, buf, next);
-            if (c == '"' || c == '\\') {
-                break;
-            }
-            else if (strict && c <= 0x1f) {
+            if (c <= 0x1f) {
                 raise_errmsg("Invalid control character at", pystr, next);
                 goto bail;
             }
@@ -731,7 +914,7 @@ _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ss
         return NULL;
 
     /* skip whitespace after { */
-    while (idx <= end_idx && IS_WHITESPACE(PyUnicode_READ(kind,str, idx))) idx++;
+    idx = skip_whitespace(kind, str, idx, end_idx);
 
     /* only loop if the object is non-empty */
     if (idx > end_idx || PyUnicode_READ(kind, str, idx) != '}') {
@@ -759,13 +942,13 @@ _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ss
             idx = next_idx;
 
             /* skip whitespace between key and : delimiter, read :, skip whitespace */
-            while (idx <= end_idx && IS_WHITESPACE(PyUnicode_READ(kind, str, idx))) idx++;
+            idx = skip_whitespace(kind, str, idx, end_idx);
             if (idx > end_idx || PyUnicode_READ(kind, str, idx) != ':') {
                 raise_errmsg("Expecting ':' delimiter", pystr, idx);
                 goto bail;
             }
             idx++;
-            while (idx <= end_idx && IS_WHITESPACE(PyUnicode_READ(kind, str, idx))) idx++;
+            idx = skip_whitespace(kind, str, idx, end_idx);
 
             /* read any JSON term */
             val = scan_once_unicode(s, pystr, idx, &next_idx);
@@ -793,7 +976,7 @@ _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ss
             idx = next_idx;
 
             /* skip whitespace before } or , */
-            while (idx <= end_idx && IS_WHITESPACE(PyUnicode_READ(kind, str, idx))) idx++;
+            idx = skip_whitespace(kind, str, idx, end_idx);
 
             /* bail if the object is closed or we didn't get the , delimiter */
             if (idx <= end_idx && PyUnicode_READ(kind, str, idx) == '}')
@@ -805,7 +988,7 @@ _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ss
             idx++;
 
             /* skip whitespace after , delimiter */
-            while (idx <= end_idx && IS_WHITESPACE(PyUnicode_READ(kind, str, idx))) idx++;
+            idx = skip_whitespace(kind, str, idx, end_idx);
         }
     }
 
@@ -859,7 +1042,7 @@ _parse_array_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ssi
     end_idx = PyUnicode_GET_LENGTH(pystr) - 1;
 
     /* skip whitespace after [ */
-    while (idx <= end_idx && IS_WHITESPACE(PyUnicode_READ(kind, str, idx))) idx++;
+    idx = skip_whitespace(kind, str, idx, end_idx);
 
     /* only loop if the array is non-empty */
     if (idx > end_idx || PyUnicode_READ(kind, str, idx) != ']') {
@@ -877,7 +1060,7 @@ _parse_array_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ssi
             idx = next_idx;
 
             /* skip whitespace between term and , */
-            while (idx <= end_idx && IS_WHITESPACE(PyUnicode_READ(kind, str, idx))) idx++;
+            idx = skip_whitespace(kind, str, idx, end_idx);
 
             /* bail if the array is closed or we didn't get the , delimiter */
             if (idx <= end_idx && PyUnicode_READ(kind, str, idx) == ']')
@@ -889,7 +1072,7 @@ _parse_array_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ssi
             idx++;
 
             /* skip whitespace after , */
-            while (idx <= end_idx && IS_WHITESPACE(PyUnicode_READ(kind, str, idx))) idx++;
+            idx = skip_whitespace(kind, str, idx, end_idx);
         }
     }
 
@@ -1287,6 +1470,632 @@ PyTypeObject PyScannerType = {
     0,/* PyObject_GC_Del, */              /* tp_free */
 };
 
+/* The incremental scanner decodes a stream of JSON values, or the elements
+   of a top-level array, which is fed in chunks of any size.
+
+   Each chunk is first pre-scanned for the structure of the input: the
+   nesting depth of brackets and braces outside strings, and whether a
+   string or a scalar (a number or a name) is still open at its end.  This
+   finds where the values to yield end, so that scan_once_unicode() is only
+   called on complete values, and a value split over many chunks is not
+   parsed again for each of them.  The chunks are joined only once a value
+   is complete, and the input which remains pending is then the incomplete
+   tail of the last chunk. */
+
+static PyTypeObject PyIncrementalScannerType;
+
+/* States of the parser in array mode */
+enum {
+    ARRAY_START,        /* before the opening bracket */
+    ARRAY_FIRST,        /* after the opening bracket */
+    ARRAY_VALUE,        /* after a comma */
+    ARRAY_DELIM,        /* after an element */
+    ARRAY_END           /* after the closing bracket */
+};
+
+typedef struct _PyIncrementalScannerObject {
+    PyObject_HEAD
+    PyScannerObject *scanner;
+    char array;             /* yield the elements of a top-level array */
+    char started;           /* some input was fed */
+    char decoding;          /* in feed() or close(), which may run hooks */
+    /* Pre-scan state at the end of the pending input */
+    char in_string;
+    char in_escape;
+    char in_scalar;
+    Py_ssize_t depth;
+    int state;              /* parser state in array mode */
+    PyObject *chunks;       /* list of str, the pending input */
+    Py_ssize_t length;      /* length of the pending input */
+    Py_ssize_t complete;    /* length of its prefix of complete values */
+    char utf8[4];           /* incomplete UTF-8 sequence ending the input */
+    int utf8_len;
+    /* Position of the pending input in the stream, for error messages */
+    Py_ssize_t consumed;
+    Py_ssize_t lines;       /* newlines before it */
+    Py_ssize_t column;      /* characters after the last newline */
+} PyIncrementalScannerObject;
+
+static PyMemberDef incremental_scanner_members[] = {
+    {"array", T_BOOL, offsetof(PyIncrementalScannerObject, array), READONLY, "array"},
+    {NULL}
+};
+
+static int
+incremental_scanner_reset(PyIncrementalScannerObject *s)
+{
+    s->started = 0;
+    s->in_string = s->in_escape = s->in_scalar = 0;
+    s->depth = 0;
+    s->state = ARRAY_START;
+    s->length = s->complete = 0;
+    s->utf8_len = 0;
+    s->consumed = s->lines = s->column = 0;
+    PyDict_Clear(s->scanner->memo);
+    return PyList_SetSlice(s->chunks, 0, PyList_GET_SIZE(s->chunks), NULL);
+}
+
+static int
+get_ssize_attr(PyObject *obj, const char *name, Py_ssize_t *value)
+{
+    PyObject *attr = PyObject_GetAttrString(obj, name);
+    if (attr == NULL)
+        return -1;
+    *value = PyLong_AsSsize_t(attr);
+    Py_DECREF(attr);
+    if (*value == -1 && PyErr_Occurred())
+        return -1;
+    return 0;
+}
+
+static int
+set_ssize_attr(PyObject *obj, const char *name, Py_ssize_t value)
+{
+    int res;
+    PyObject *attr = PyLong_FromSsize_t(value);
+    if (attr == NULL)
+        return -1;
+    res = PyObject_SetAttrString(obj, name, attr);
+    Py_DECREF(attr);
+    return res;
+}
+
+static void
+incremental_scanner_fail(PyIncrementalScannerObject *s)
+{
+    /* Make the position of a JSONDecodeError relative to the start of the
+       stream rather than to the pending input, and discard the input. */
+    PyObject *type, *value, *tb;
+    PyObject *msg = NULL, *errmsg = NULL;
+    Py_ssize_t pos, lineno, colno;
+
+    PyErr_Fetch(&type, &value, &tb);
+    if (JSONDecodeError != NULL && s->consumed > 0 &&
+        PyErr_GivenExceptionMatches(type, JSONDecodeError))
+    {
+        PyErr_NormalizeException(&type, &value, &tb);
+        if (value == NULL ||
+            (msg = PyObject_GetAttrString(value, "msg")) == NULL ||
+            get_ssize_attr(value, "pos", &pos) < 0 ||
+            get_ssize_attr(value, "lineno", &lineno) < 0 ||
+            get_ssize_attr(value, "colno", &colno) < 0)
+            goto done;
+        if (lineno == 1)
+            colno += s->column;
+        lineno += s->lines;
+        pos += s->consumed;
+        errmsg = PyUnicode_FromFormat("%S: line %zd column %zd (char %zd)",
+                                      msg, lineno, colno, pos);
+        if (errmsg == NULL ||
+            set_ssize_attr(value, "pos", pos) < 0 ||
+            set_ssize_attr(value, "lineno", lineno) < 0 ||
+            set_ssize_attr(value, "colno", colno) < 0)
+            goto done;
+        Py_SETREF(((PyBaseExceptionObject *)value)->args,
+                  PyTuple_Pack(1, errmsg));
+    }
+done:
+    Py_XDECREF(msg);
+    Py_XDECREF(errmsg);
+    PyErr_Clear();
+    if (incremental_scanner_reset(s) < 0)
+        PyErr_Clear();
+    PyErr_Restore(type, value, tb);
+}
+
+static void
+incremental_scanner_prescan(PyIncrementalScannerObject *s, PyObject *pystr)
+{
+    /* Update the pre-scan state with the next chunk of input, and the length
+       of the prefix of the input made of complete values. */
+    void *str = PyUnicode_DATA(pystr);
+    int kind = PyUnicode_KIND(pystr);
+    Py_ssize_t len = PyUnicode_GET_LENGTH(pystr);
+    Py_ssize_t base = s->array;     /* depth of the values to yield */
+    Py_ssize_t depth = s->depth;
+    int in_string = s->in_string;
+    int in_escape = s->in_escape;
+    int in_scalar = s->in_scalar;
+    Py_ssize_t complete = -1;
+    Py_ssize_t i;
+
+    for (i = 0; i < len; i++) {
+        Py_UCS4 c = PyUnicode_READ(kind, str, i);
+        if (in_string) {
+            if (in_escape)
+                in_escape = 0;
+            else if (c == '\\')
+                in_escape = 1;
+            else if (c == '"') {
+                in_string = 0;
+                if (depth <= base)
+                    complete = i + 1;
+            }
+            continue;
+        }
+        switch (c) {
+            case '{':
+            case '[':
+                depth++;
+                break;
+            case '}':
+            case ']':
+                if (depth > 0)
+                    depth--;
+                break;
+            case '"':
+            case ',':
+            case ':':
+            case ' ':
+            case '\t':
+            case '\n':
+            case '\r':
+                break;
+            default:
+                /* A number or a name only ends at the next character which
+                   cannot be part of it, or at the end of the stream. */
+                if (depth <= base)
+                    in_scalar = 1;
+                continue;
+        }
+        if (in_scalar) {
+            in_scalar = 0;
+            complete = i;
+        }
+        if (c == '"')
+            in_string = 1;
+        else if (depth <= base)
+            complete = i + 1;
+    }
+    s->depth = depth;
+    s->in_string = in_string;
+    s->in_escape = in_escape;
+    s->in_scalar = in_scalar;
+    if (complete >= 0)
+        s->complete = s->length + complete;
+}
+
+static int
+incremental_scanner_add(PyIncrementalScannerObject *s, PyObject *pystr,
+                        int from_bytes)
+{
+    /* Append a chunk of text to the pending input */
+    PyObject *tail = NULL;
+    int res;
+
+    if (PyUnicode_READY(pystr) == -1)
+        return -1;
+    if (PyUnicode_GET_LENGTH(pystr) == 0)
+        return 0;
+    if (!s->started) {
+        s->started = 1;
+        /* Skip a byte order mark at the start of UTF-8 input */
+        if (from_bytes && PyUnicode_READ_CHAR(pystr, 0) == 0xFEFF) {
+            tail = PyUnicode_Substring(pystr, 1, PyUnicode_GET_LENGTH(pystr));
+            if (tail == NULL)
+                return -1;
+            pystr = tail;
+        }
+    }
+    incremental_scanner_prescan(s, pystr);
+    s->length += PyUnicode_GET_LENGTH(pystr);
+    res = PyList_Append(s->chunks, pystr);
+    Py_XDECREF(tail);
+    return res;
+}
+
+static int
+incremental_scanner_add_bytes(PyIncrementalScannerObject *s, PyObject *data)
+{
+    /* Decode a chunk of UTF-8 input and append it to the pending input.
+       A sequence split between chunks is decoded with the second one. */
+    Py_buffer view;
+    PyObject *pystr;
+    const char *p;
+    Py_ssize_t n, consumed;
+
+    if (PyObject_GetBuffer(data, &view, PyBUF_SIMPLE) < 0)
+        return -1;
+    p = view.buf;
+    n = view.len;
+    while (s->utf8_len > 0 && n > 0) {
+        assert(s->utf8_len < 4);
+        s->utf8[s->utf8_len++] = *p++;
+        n--;
+        pystr = PyUnicode_DecodeUTF8Stateful(s->utf8, s->utf8_len,
+                                             "surrogatepass", &consumed);
+        if (pystr == NULL)
+            goto bail;
+        if (consumed == s->utf8_len) {
+            s->utf8_len = 0;
+            if (incremental_scanner_add(s, pystr, 1) < 0) {
+                Py_DECREF(pystr);
+                goto bail;
+            }
+        }
+        Py_DECREF(pystr);
+    }
+    pystr = PyUnicode_DecodeUTF8Stateful(p, n, "surrogatepass", &consumed);
+    if (pystr == NULL)
+        goto bail;
+    if (incremental_scanner_add(s, pystr, 1) < 0) {
+        Py_DECREF(pystr);
+        goto bail;
+    }
+    Py_DECREF(pystr);
+    assert(n - consumed < 4);
+    memcpy(s->utf8 + s->utf8_len, p + consumed, n - consumed);
+    s->utf8_len += (int)(n - consumed);
+    PyBuffer_Release(&view);
+    return 0;
+
+bail:
+    PyBuffer_Release(&view);
+    return -1;
+}
+
+static PyObject *
+incremental_scanner_parse(PyIncrementalScannerObject *s)
+{
+    /* Decode the complete values at the start of the pending input, and
+       return the list of the values to yield. */
+    PyObject *rval;
+    PyObject *pystr = NULL;
+    PyObject *tail;
+    void *str;
+    int kind;
+    Py_ssize_t idx = 0;
+    Py_ssize_t next_idx;
+    Py_ssize_t i;
+
+    rval = PyList_New(0);
+    if (rval == NULL || s->complete == 0)
+        return rval;
+
+    if (PyList_GET_SIZE(s->chunks) == 1) {
+        pystr = PyList_GET_ITEM(s->chunks, 0);
+        Py_INCREF(pystr);
+    }
+    else {
+        pystr = join_list_unicode(s->chunks);
+        if (pystr == NULL || PyUnicode_READY(pystr) == -1)
+            goto bail;
+    }
+    str = PyUnicode_DATA(pystr);
+    kind = PyUnicode_KIND(pystr);
+
+    for (;;) {
+        PyObject *val;
+        idx = skip_whitespace(kind, str, idx, s->complete - 1);
+        if (idx >= s->complete)
+            break;
+        if (s->array) {
+            Py_UCS4 c = PyUnicode_READ(kind, str, idx);
+            switch (s->state) {
+                case ARRAY_START:
+                    if (c != '[') {
+                        raise_errmsg("Expecting '['", pystr, idx);
+                        goto bail;
+                    }
+                    s->state = ARRAY_FIRST;
+                    idx++;
+                    continue;
+                case ARRAY_FIRST:
+                    if (c == ']') {
+                        s->state = ARRAY_END;
+                        idx++;
+                        continue;
+                    }
+                    break;
+                case ARRAY_VALUE:
+                    break;
+                case ARRAY_DELIM:
+                    if (c == ',')
+                        s->state = ARRAY_VALUE;
+                    else if (c == ']')
+                        s->state = ARRAY_END;
+                    else {
+                        raise_errmsg("Expecting ',' delimiter", pystr, idx);
+                        goto bail;
+                    }
+                    idx++;
+                    continue;
+                default:
+                    raise_errmsg("Extra data", pystr, idx);
+                    goto bail;
+            }
+        }
+        val = scan_once_unicode(s->scanner, pystr, idx, &next_idx);
+        if (val == NULL) {
+            if (PyErr_ExceptionMatches(PyExc_StopIteration)) {
+                /* The index where a value was expected */
+                if (_PyGen_FetchStopIterationValue(&val) < 0)
+                    goto bail;
+                idx = PyLong_AsSsize_t(val);
+                Py_DECREF(val);
+                if (idx == -1 && PyErr_Occurred())
+                    goto bail;
+                raise_errmsg("Expecting value", pystr, idx);
+            }
+            goto bail;
+        }
+        if (PyList_Append(rval, val) < 0) {
+            Py_DECREF(val);
+            goto bail;
+        }
+        Py_DECREF(val);
+        idx = next_idx;
+        if (s->array)
+            s->state = ARRAY_DELIM;
+    }
+    PyDict_Clear(s->scanner->memo);
+
+    /* Discard the decoded input */
+    for (i = 0; i < idx; i++) {
+        if (PyUnicode_READ(kind, str, i) == '\n') {
+            s->lines++;
+            s->column = 0;
+        }
+        else
+            s->column++;
+    }
+    s->consumed += idx;
+    s->length -= idx;
+    s->complete = s->complete > idx ? s->complete - idx : 0;
+    if (PyList_SetSlice(s->chunks, 0, PyList_GET_SIZE(s->chunks), NULL) < 0)
+        goto bail;
+    if (s->length > 0) {
+        tail = PyUnicode_Substring(pystr, idx, idx + s->length);
+        if (tail == NULL)
+            goto bail;
+        if (PyList_Append(s->chunks, tail) < 0) {
+            Py_DECREF(tail);
+            goto bail;
+        }
+        Py_DECREF(tail);
+    }
+    Py_DECREF(pystr);
+    return rval;
+
+bail:
+    Py_XDECREF(pystr);
+    Py_DECREF(rval);
+    return NULL;
+}
+
+static int
+incremental_scanner_check_not_decoding(PyIncrementalScannerObject *s,
+                                       const char *method)
+{
+    /* A hook called by feed() or close() must not modify the pending
+       input, which they are decoding. */
+    if (s->decoding) {
+        PyErr_Format(PyExc_RuntimeError,
+                     "%s() called while feed() or close() is decoding",
+                     method);
+        return -1;
+    }
+    return 0;
+}
+
+PyDoc_STRVAR(incremental_scanner_feed_doc,
+"feed(data) -> list\n"
+"\n"
+"Decode the next chunk of input, a str or UTF-8 encoded bytes-like\n"
+"object, and return the list of the values completed by it.");
+
+static PyObject *
+incremental_scanner_feed(PyObject *self, PyObject *data)
+{
+    PyIncrementalScannerObject *s = (PyIncrementalScannerObject *)self;
+    PyObject *rval;
+    int res;
+
+    if (incremental_scanner_check_not_decoding(s, "feed") < 0)
+        return NULL;
+    if (PyUnicode_Check(data))
+        res = incremental_scanner_add(s, data, 0);
+    else if (PyObject_CheckBuffer(data))
+        res = incremental_scanner_add_bytes(s, data);
+    else {
+        PyErr_Format(PyExc_TypeError,
+                     "data must be str or a bytes-like object, not %.80s",
+                     Py_TYPE(data)->tp_name);
+        return NULL;
+    }
+    s->decoding = 1;
+    if (res < 0 || (rval = incremental_scanner_parse(s)) == NULL) {
+        incremental_scanner_fail(s);
+        s->decoding = 0;
+        return NULL;
+    }
+    s->decoding = 0;
+    return rval;
+}
+
+PyDoc_STRVAR(incremental_scanner_close_doc,
+"close() -> list\n"
+"\n"
+"Signal the end of the input, and return the list of the values completed\n"
+"by it.  Raise JSONDecodeError if the input is truncated.");
+
+static PyObject *
+incremental_scanner_close(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    PyIncrementalScannerObject *s = (PyIncrementalScannerObject *)self;
+    PyObject *rval, *pystr;
+    const char *msg;
+
+    if (incremental_scanner_check_not_decoding(s, "close") < 0)
+        return NULL;
+    s->decoding = 1;
+    if (s->utf8_len > 0) {
+        /* Raises UnicodeDecodeError */
+        pystr = PyUnicode_DecodeUTF8(s->utf8, s->utf8_len, "surrogatepass");
+        assert(pystr == NULL);
+        Py_XDECREF(pystr);
+        goto bail;
+    }
+    s->complete = s->length;
+    rval = incremental_scanner_parse(s);
+    if (rval == NULL)
+        goto bail;
+    if (s->array && s->state != ARRAY_END) {
+        Py_DECREF(rval);
+        msg = s->state == ARRAY_DELIM ? "Expecting ',' delimiter"
+                                      : "Expecting value";
+        pystr = join_list_unicode(s->chunks);
+        if (pystr != NULL) {
+            raise_errmsg(msg, pystr, s->length);
+            Py_DECREF(pystr);
+        }
+        goto bail;
+    }
+    s->decoding = 0;
+    if (incremental_scanner_reset(s) < 0) {
+        Py_DECREF(rval);
+        return NULL;
+    }
+    return rval;
+
+bail:
+    incremental_scanner_fail(s);
+    s->decoding = 0;
+    return NULL;
+}
+
+static PyMethodDef incremental_scanner_methods[] = {
+    {"feed", incremental_scanner_feed, METH_O, incremental_scanner_feed_doc},
+    {"close", incremental_scanner_close, METH_NOARGS,
+     incremental_scanner_close_doc},
+    {NULL, NULL}
+};
+
+static void
+incremental_scanner_dealloc(PyObject *self)
+{
+    PyIncrementalScannerObject *s = (PyIncrementalScannerObject *)self;
+    PyObject_GC_UnTrack(self);
+    Py_CLEAR(s->scanner);
+    Py_CLEAR(s->chunks);
+    Py_TYPE(self)->tp_free(self);
+}
+
+static int
+incremental_scanner_traverse(PyObject *self, visitproc visit, void *arg)
+{
+    PyIncrementalScannerObject *s = (PyIncrementalScannerObject *)self;
+    Py_VISIT(s->scanner);
+    return 0;
+}
+
+static int
+incremental_scanner_clear(PyObject *self)
+{
+    PyIncrementalScannerObject *s = (PyIncrementalScannerObject *)self;
+    Py_CLEAR(s->scanner);
+    return 0;
+}
+
+static PyObject *
+incremental_scanner_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    PyIncrementalScannerObject *s;
+    PyObject *ctx;
+    int array = 0;
+    static char *kwlist[] = {"context", "array", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|p:make_incremental_scanner",
+                                     kwlist, &ctx, &array))
+        return NULL;
+
+    s = (PyIncrementalScannerObject *)type->tp_alloc(type, 0);
+    if (s == NULL)
+        return NULL;
+    s->array = array;
+    s->state = ARRAY_START;
+    s->chunks = PyList_New(0);
+    if (s->chunks == NULL)
+        goto bail;
+    s->scanner = (PyScannerObject *)PyObject_CallFunctionObjArgs(
+        (PyObject *)&PyScannerType, ctx, NULL);
+    if (s->scanner == NULL)
+        goto bail;
+    /* For the position of errors */
+    if (load_json_decode_error() < 0)
+        goto bail;
+    return (PyObject *)s;
+
+bail:
+    Py_DECREF(s);
+    return NULL;
+}
+
+PyDoc_STRVAR(incremental_scanner_doc, "Incremental JSON scanner object");
+
+static
+PyTypeObject PyIncrementalScannerType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "_json.IncrementalScanner",      /* tp_name */
+    sizeof(PyIncrementalScannerObject), /* tp_basicsize */
+    0,                    /* tp_itemsize */
+    incremental_scanner_dealloc, /* tp_dealloc */
+    0,                    /* tp_print */
+    0,                    /* tp_getattr */
+    0,                    /* tp_setattr */
+    0,                    /* tp_compare */
+    0,                    /* tp_repr */
+    0,                    /* tp_as_number */
+    0,                    /* tp_as_sequence */
+    0,                    /* tp_as_mapping */
+    0,                    /* tp_hash */
+    0,                    /* tp_call */
+    0,                    /* tp_str */
+    0,                    /* tp_getattro */
+    0,                    /* tp_setattro */
+    0,                    /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,   /* tp_flags */
+    incremental_scanner_doc, /* tp_doc */
+    incremental_scanner_traverse, /* tp_traverse */
+    incremental_scanner_clear, /* tp_clear */
+    0,                    /* tp_richcompare */
+    0,                    /* tp_weaklistoffset */
+    0,                    /* tp_iter */
+    0,                    /* tp_iternext */
+    incremental_scanner_methods, /* tp_methods */
+    incremental_scanner_members, /* tp_members */
+    0,                    /* tp_getset */
+    0,                    /* tp_base */
+    0,                    /* tp_dict */
+    0,                    /* tp_descr_get */
+    0,                    /* tp_descr_set */
+    0,                    /* tp_dictoffset */
+    0,                    /* tp_init */
+    0,                    /* tp_alloc */
+    incremental_scanner_new, /* tp_new */
+    0,                    /* tp_free */
+};
+
 static PyObject *
 encoder_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
@@ -1350,6 +2159,7 @@ encoder_call(PyObject *self, PyObject *args, PyObject *kwds)
     Py_ssize_t indent_level;
     PyEncoderObject *s;
     _PyAccu acc;
+    EncoderOutput out = {&acc, NULL, 0, NULL};
 
     assert(PyEncoder_Check(self));
     s = (PyEncoderObject *)self;
@@ -1358,13 +2168,57 @@ encoder_call(PyObject *self, PyObject *args, PyObject *kwds)
         return NULL;
     if (_PyAccu_Init(&acc))
         return NULL;
-    if (encoder_listencode_obj(s, &acc, obj, indent_level)) {
+    if (encoder_listencode_obj(s, &out, obj, indent_level)) {
         _PyAccu_Destroy(&acc);
         return NULL;
     }
     return _PyAccu_FinishAsList(&acc);
 }
 
+PyDoc_STRVAR(encoder_encode_bytes_doc,
+"encode_bytes(obj, write=None) -> bytes\n"
+"\n"
+"Return the UTF-8 encoded JSON representation of obj.  If write is given,\n"
+"call it with successive chunks of the output instead, and return None.");
+
+static PyObject *
+encoder_encode_bytes(PyObject *self, PyObject *args, PyObject *kwds)
+{
+    /* Python callable interface to encode_listencode_obj, with bytes output */
+    static char *kwlist[] = {"obj", "write", NULL};
+    PyObject *obj;
+    PyObject *write = Py_None;
+    PyEncoderObject *s;
+    EncoderOutput out = {NULL, NULL, 0, NULL};
+
+    assert(PyEncoder_Check(self));
+    s = (PyEncoderObject *)self;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|O:encode_bytes", kwlist,
+        &obj, &write))
+        return NULL;
+    if (write != Py_None) {
+        if (!PyCallable_Check(write)) {
+            PyErr_Format(PyExc_TypeError,
+                         "write must be callable, not %.80s",
+                         Py_TYPE(write)->tp_name);
+            return NULL;
+        }
+        out.write = write;
+    }
+    if (encoder_listencode_obj(s, &out, obj, 0)) {
+        Py_XDECREF(out.bytes);
+        return NULL;
+    }
+    if (out.write != NULL) {
+        if (output_flush(&out) < 0)
+            return NULL;
+        Py_RETURN_NONE;
+    }
+    if (_PyBytes_Resize(&out.bytes, out.len) < 0)
+        return NULL;
+    return out.bytes;
+}
+
 static PyObject *
 _encoded_const(PyObject *obj)
 {
@@ -1446,16 +2300,243 @@ encoder_encode_string(PyEncoderObject *s, PyObject *obj)
 }
 
 static int
-_steal_accumulate(_PyAccu *acc, PyObject *stolen)
+output_flush(EncoderOutput *out)
+{
+    /* Pass the bytes buffered to write() */
+    PyObject *res;
+
+    if (out->len == 0)
+        return 0;
+    if (_PyBytes_Resize(&out->bytes, out->len) < 0) {
+        out->len = 0;
+        return -1;
+    }
+    res = PyObject_CallFunctionObjArgs(out->write, out->bytes, NULL);
+    Py_CLEAR(out->bytes);
+    out->len = 0;
+    if (res == NULL)
+        return -1;
+    Py_DECREF(res);
+    return 0;
+}
+
+static char *
+output_reserve(EncoderOutput *out, Py_ssize_t n)
+{
+    /* Return a pointer to n free bytes at the end of the bytes buffer.
+       The caller then adds the number of bytes written to out->len. */
+    Py_ssize_t size, needed;
+
+    if (out->write != NULL && out->len > 0 &&
+        n > OUTPUT_CHUNK_SIZE - out->len) {
+        if (output_flush(out) < 0)
+            return NULL;
+    }
+    size = out->bytes == NULL ? 0 : PyBytes_GET_SIZE(out->bytes);
+    if (n > size - out->len) {
+        if (n > PY_SSIZE_T_MAX - out->len) {
+            PyErr_NoMemory();
+            return NULL;
+        }
+        needed = out->len + n;
+        if (size == 0)
+            size = out->write != NULL ? OUTPUT_CHUNK_SIZE : 1024;
+        while (size < needed)
+            size = size <= PY_SSIZE_T_MAX / 2 ? size * 2 : needed;
+        if (out->bytes == NULL) {
+            out->bytes = PyBytes_FromStringAndSize(NULL, size);
+            if (out->bytes == NULL)
+                return NULL;
+        }
+        else if (_PyBytes_Resize(&out->bytes, size) < 0) {
+            out->len = 0;
+            return NULL;
+        }
+    }
+    return PyBytes_AS_STRING(out->bytes) + out->len;
+}
+
+static int
+output_write_bytes(EncoderOutput *out, const char *buf, Py_ssize_t n)
+{
+    char *p = output_reserve(out, n);
+    if (p == NULL)
+        return -1;
+    memcpy(p, buf, n);
+    out->len += n;
+    return 0;
+}
+
+static int
+output_write(EncoderOutput *out, PyObject *str)
+{
+    /* Append the str fragment str to the output */
+    PyObject *utf8;
+    int rval;
+
+    if (out->acc != NULL)
+        return _PyAccu_Accumulate(out->acc, str);
+    if (PyUnicode_READY(str) == -1)
+        return -1;
+    if (PyUnicode_IS_ASCII(str))
+        return output_write_bytes(out, (const char *)PyUnicode_1BYTE_DATA(str),
+                                  PyUnicode_GET_LENGTH(str));
+    utf8 = PyUnicode_AsUTF8String(str);
+    if (utf8 == NULL)
+        return -1;
+    rval = output_write_bytes(out, PyBytes_AS_STRING(utf8),
+                              PyBytes_GET_SIZE(utf8));
+    Py_DECREF(utf8);
+    return rval;
+}
+
+static int
+_steal_accumulate(EncoderOutput *out, PyObject *stolen)
 {
     /* Append stolen and then decrement its reference count */
-    int rval = _PyAccu_Accumulate(acc, stolen);
+    int rval = output_write(out, stolen);
     Py_DECREF(stolen);
     return rval;
 }
 
+/* Number of characters of a string escaped at a time into the bytes buffer */
+#define ESCAPE_CHUNK_SIZE 512
+
 static int
-encoder_listencode_obj(PyEncoderObject *s, _PyAccu *acc,
+encoder_write_string(PyEncoderObject *s, EncoderOutput *out, PyObject *pystr)
+{
+    /* Append the JSON representation of a string to the output.  With bytes
+       output and one of the builtin escape functions, the string is escaped
+       and encoded to UTF-8 in a single pass, into the bytes buffer. */
+    Py_ssize_t i, end, input_chars, chars, width;
+    unsigned char *output;
+    void *input;
+    int kind;
+    int ascii_only;
+
+    if (out->acc != NULL || s->fast_encode == NULL) {
+        PyObject *encoded = encoder_encode_string(s, pystr);
+        if (encoded == NULL)
+            return -1;
+        return _steal_accumulate(out, encoded);
+    }
+    if (PyUnicode_READY(pystr) == -1)
+        return -1;
+    ascii_only = s->fast_encode == (PyCFunction)py_encode_basestring_ascii;
+    input_chars = PyUnicode_GET_LENGTH(pystr);
+    input = PyUnicode_DATA(pystr);
+    kind = PyUnicode_KIND(pystr);
+    /* Longest output for a character: an escaped surrogate pair, an escaped
+       control character or a 4-byte UTF-8 sequence */
+    width = ascii_only && kind != PyUnicode_1BYTE_KIND ? 12 : 6;
+
+    if (output_write_bytes(out, "\"", 1) < 0)
+        return -1;
+    for (i = 0; i < input_chars; ) {
+        end = Py_MIN(input_chars, i + ESCAPE_CHUNK_SIZE);
+        output = (unsigned char *)output_reserve(out, (end - i) * width);
+        if (output == NULL)
+            return -1;
+        chars = 0;
+        for (; i < end; i++) {
+            Py_UCS4 c = PyUnicode_READ(kind, input, i);
+            if (S_CHAR(c)) {
+                output[chars++] = c;
+            }
+            else if (ascii_only || c < 0x7f) {
+                chars = ascii_escape_unichar(c, output, chars);
+            }
+            else if (c < 0x80) {
+                output[chars++] = c;
+            }
+            else if (c < 0x800) {
+                output[chars++] = 0xc0 | (c >> 6);
+                output[chars++] = 0x80 | (c & 0x3f);
+            }
+            else if (c < 0x10000) {
+                if (Py_UNICODE_IS_SURROGATE(c)) {
+                    /* Raises UnicodeEncodeError */
+                    PyObject *utf8 = PyUnicode_AsUTF8String(pystr);
+                    assert(utf8 == NULL);
+                    Py_XDECREF(utf8);
+                    return -1;
+                }
+                output[chars++] = 0xe0 | (c >> 12);
+                output[chars++] = 0x80 | ((c >> 6) & 0x3f);
+                output[chars++] = 0x80 | (c & 0x3f);
+            }
+            else {
+                output[chars++] = 0xf0 | (c >> 18);
+                output[chars++] = 0x80 | ((c >> 12) & 0x3f);
+                output[chars++] = 0x80 | ((c >> 6) & 0x3f);
+                output[chars++] = 0x80 | (c & 0x3f);
+            }
+        }
+        out->len += chars;
+    }
+    return output_write_bytes(out, "\"", 1);
+}
+
+static int
+encoder_write_long(EncoderOutput *out, PyObject *obj)
+{
+    /* Append the JSON representation of a PyLong to the output */
+    char buf[24];
+    char *p = buf + sizeof(buf);
+    PyObject *encoded;
+    unsigned long long u;
+    long long value;
+    int overflow;
+
+    if (out->acc == NULL) {
+        value = PyLong_AsLongLongAndOverflow(obj, &overflow);
+        if (value == -1 && PyErr_Occurred())
+            return -1;
+        if (!overflow) {
+            /* Format the digits directly into the bytes buffer */
+            u = value < 0 ? 0ULL - (unsigned long long)value
+                          : (unsigned long long)value;
+            do {
+                *--p = '0' + (char)(u % 10);
+                u /= 10;
+            } while (u);
+            if (value < 0)
+                *--p = '-';
+            return output_write_bytes(out, p, buf + sizeof(buf) - p);
+        }
+    }
+    encoded = PyLong_Type.tp_str(obj);
+    if (encoded == NULL)
+        return -1;
+    return _steal_accumulate(out, encoded);
+}
+
+static int
+encoder_write_float(PyEncoderObject *s, EncoderOutput *out, PyObject *obj)
+{
+    /* Append the JSON representation of a PyFloat to the output */
+    double d = PyFloat_AS_DOUBLE(obj);
+    PyObject *encoded;
+
+    if (out->acc == NULL && Py_IS_FINITE(d)) {
+        /* Same as float.__repr__(), without creating a str */
+        char *buf = PyOS_double_to_string(d, 'r', 0, Py_DTSF_ADD_DOT_0,
+                                          NULL);
+        int rval;
+        if (buf == NULL)
+            return -1;
+        rval = output_write_bytes(out, buf, strlen(buf));
+        PyMem_Free(buf);
+        return rval;
+    }
+    encoded = encoder_encode_float(s, obj);
+    if (encoded == NULL)
+        return -1;
+    return _steal_accumulate(out, encoded);
+}
+
+static int
+encoder_listencode_obj(PyEncoderObject *s, EncoderOutput *out,
                        PyObject *obj, Py_ssize_t indent_level)
 {
     /* Encode Python object obj to a JSON term */
@@ -1466,38 +2547,29 @@ encoder_listencode_obj(PyEncoderObject *s, _PyAccu *acc,
         PyObject *cstr = _encoded_const(obj);
         if (cstr == NULL)
             return -1;
-        return _steal_accumulate(acc, cstr);
+        return _steal_accumulate(out, cstr);
     }
     else if (PyUnicode_Check(obj))
     {
-        PyObject *encoded = encoder_encode_string(s, obj);
-        if (encoded == NULL)
-            return -1;
-        return _steal_accumulate(acc, encoded);
+        return encoder_write_string(s, out, obj);
     }
     else if (PyLong_Check(obj)) {
-        PyObject *encoded = PyLong_Type.tp_str(obj);
-        if (encoded == NULL)
-            return -1;
-        return _steal_accumulate(acc, encoded);
+        return encoder_write_long(out, obj);
     }
     else if (PyFloat_Check(obj)) {
-        PyObject *encoded = encoder_encode_float(s, obj);
-        if (encoded == NULL)
-            return -1;
-        return _steal_accumulate(acc, encoded);
+        return encoder_write_float(s, out, obj);
     }
     else if (PyList_Check(obj) || PyTuple_Check(obj)) {
         if (Py_EnterRecursiveCall(" while encoding a JSON object"))
             return -1;
-        rv = encoder_listencode_list(s, acc, obj, indent_level);
+        rv = encoder_listencode_list(s, out, obj, indent_level);
         Py_LeaveRecursiveCall();
         return rv;
     }
     else if (PyDict_Check(obj)) {
         if (Py_EnterRecursiveCall(" while encoding a JSON object"))
             return -1;
-        rv = encoder_listencode_dict(s, acc, obj, indent_level);
+        rv = encoder_listencode_dict(s, out, obj, indent_level);
         Py_LeaveRecursiveCall();
         return rv;
     }
@@ -1531,7 +2603,7 @@ encoder_listencode_obj(PyEncoderObject *s, _PyAccu *acc,
             Py_XDECREF(ident);
             return -1;
         }
-        rv = encoder_listencode_obj(s, acc, newobj, indent_level);
+        rv = encoder_listencode_obj(s, out, newobj, indent_level);
         Py_LeaveRecursiveCall();
 
         Py_DECREF(newobj);
@@ -1551,7 +2623,7 @@ encoder_listencode_obj(PyEncoderObject *s, _PyAccu *acc,
 }
 
 static int
-encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
+encoder_listencode_dict(PyEncoderObject *s, EncoderOutput *out,
                         PyObject *dct, Py_ssize_t indent_level)
 {
     /* Encode Python dict dct a JSON term */
@@ -1573,7 +2645,7 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
             return -1;
     }
     if (PyDict_GET_SIZE(dct) == 0)  /* Fast path */
-        return _PyAccu_Accumulate(acc, empty_dict);
+        return output_write(out, empty_dict);
 
     if (s->markers != Py_None) {
         int has_key;
@@ -1591,7 +2663,7 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
         }
     }
 
-    if (_PyAccu_Accumulate(acc, open_dict))
+    if (output_write(out, open_dict))
         goto bail;
 
     if (s->indent != Py_None) {
@@ -1617,7 +2689,7 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
         goto bail;
     idx = 0;
     while ((item = PyIter_Next(it)) != NULL) {
-        PyObject *encoded, *key, *value;
+        PyObject *key, *value;
         if (!PyTuple_Check(item) || PyTuple_GET_SIZE(item) != 2) {
             PyErr_SetString(PyExc_ValueError, "items must return 2-tuples");
             goto bail;
@@ -1657,24 +2729,18 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
         }
 
         if (idx) {
-            if (_PyAccu_Accumulate(acc, s->item_separator))
+            if (output_write(out, s->item_separator))
                 goto bail;
         }
 
-        encoded = encoder_encode_string(s, kstr);
-        Py_CLEAR(kstr);
-        if (encoded == NULL)
-            goto bail;
-        if (_PyAccu_Accumulate(acc, encoded)) {
-            Py_DECREF(encoded);
+        if (encoder_write_string(s, out, kstr))
             goto bail;
-        }
-        Py_DECREF(encoded);
-        if (_PyAccu_Accumulate(acc, s->key_separator))
+        Py_CLEAR(kstr);
+        if (output_write(out, s->key_separator))
             goto bail;
 
         value = PyTuple_GET_ITEM(item, 1);
-        if (encoder_listencode_obj(s, acc, value, indent_level))
+        if (encoder_listencode_obj(s, out, value, indent_level))
             goto bail;
         idx += 1;
         Py_DECREF(item);
@@ -1694,7 +2760,7 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
 
         yield '\n' + (' ' * (_indent * _current_indent_level))
     }*/
-    if (_PyAccu_Accumulate(acc, close_dict))
+    if (output_write(out, close_dict))
         goto bail;
     return 0;
 
@@ -1708,7 +2774,7 @@ bail:
 
 
 static int
-encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
+encoder_listencode_list(PyEncoderObject *s, EncoderOutput *out,
                         PyObject *seq, Py_ssize_t indent_level)
 {
     /* Encode Python list seq to a JSON term */
@@ -1732,7 +2798,7 @@ encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
         return -1;
     if (PySequence_Fast_GET_SIZE(s_fast) == 0) {
         Py_DECREF(s_fast);
-        return _PyAccu_Accumulate(acc, empty_array);
+        return output_write(out, empty_array);
     }
 
     if (s->markers != Py_None) {
@@ -1751,7 +2817,7 @@ encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
         }
     }
 
-    if (_PyAccu_Accumulate(acc, open_array))
+    if (output_write(out, open_array))
         goto bail;
     if (s->indent != Py_None) {
         /* TODO: DOES NOT RUN */
@@ -1765,10 +2831,10 @@ encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
     for (i = 0; i < PySequence_Fast_GET_SIZE(s_fast); i++) {
         PyObject *obj = PySequence_Fast_GET_ITEM(s_fast, i);
         if (i) {
-            if (_PyAccu_Accumulate(acc, s->item_separator))
+            if (output_write(out, s->item_separator))
                 goto bail;
         }
-        if (encoder_listencode_obj(s, acc, obj, indent_level))
+        if (encoder_listencode_obj(s, out, obj, indent_level))
             goto bail;
     }
     if (ident != NULL) {
@@ -1783,7 +2849,7 @@ encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
 
         yield '\n' + (' ' * (_indent * _current_indent_level))
     }*/
-    if (_PyAccu_Accumulate(acc, close_array))
+    if (output_write(out, close_array))
         goto bail;
     Py_DECREF(s_fast);
     return 0;
@@ -1834,6 +2900,12 @@ encoder_clear(PyObject *self)
     return 0;
 }
 
+static PyMethodDef encoder_methods[] = {
+    {"encode_bytes", (PyCFunction)(void(*)(void))encoder_encode_bytes,
+     METH_VARARGS | METH_KEYWORDS, encoder_encode_bytes_doc},
+    {NULL, NULL}
+};
+
 PyDoc_STRVAR(encoder_doc, "_iterencode(obj, _current_indent_level) -> iterable");
 
 static
@@ -1865,7 +2937,7 @@ PyTypeObject PyEncoderType = {
     0,                    /* tp_weaklistoffset */
     0,                    /* tp_iter */
     0,                    /* tp_iternext */
-    0,                    /* tp_methods */
+    encoder_methods,      /* tp_methods */
     encoder_members,      /* tp_members */
     0,                    /* tp_getset */
     0,                    /* tp_base */
@@ -1925,6 +2997,14 @@ PyInit__json(void)
         Py_DECREF((PyObject*)&PyScannerType);
         goto fail;
     }
+    if (PyType_Ready(&PyIncrementalScannerType) < 0)
+        goto fail;
+    Py_INCREF((PyObject*)&PyIncrementalScannerType);
+    if (PyModule_AddObject(m, "make_incremental_scanner",
+                           (PyObject*)&PyIncrementalScannerType) < 0) {
+        Py_DECREF((PyObject*)&PyIncrementalScannerType);
+        goto fail;
+    }
     Py_INCREF((PyObject*)&PyEncoderType);
     if (PyModule_AddObject(m, "make_encoder", (PyObject*)&PyEncoderType) < 0) {
         Py_DECREF((PyObject*)&PyEncoderType);
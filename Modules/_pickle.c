@@ -17,14 +17,16 @@ class _pickle.Pickler "PicklerObject *" "&Pickler_Type"
 class _pickle.PicklerMemoProxy "PicklerMemoProxyObject *" "&PicklerMemoProxyType"
 class _pickle.Unpickler "UnpicklerObject *" "&Unpickler_Type"
 class _pickle.UnpicklerMemoProxy "UnpicklerMemoProxyObject *" "&UnpicklerMemoProxyType"
+class _pickle.IncrementalUnpickler "IncrementalUnpicklerObject *" "&IncrementalUnpickler_Type"
+class _pickle.PickleBuffer "PickleBufferObject *" "&PickleBuffer_Type"
 [clinic start generated code]*/
-/*[clinic end generated code: output=da39a3ee5e6b4b0d input=4b3e113468a58e6c]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=9888fb40aced8423]*/
 
 /* Bump HIGHEST_PROTOCOL when new opcodes are added to the pickle protocol.
    Bump DEFAULT_PROTOCOL only when the oldest still supported version of Python
    already includes it. */
 enum {
-    HIGHEST_PROTOCOL = 4,
+    HIGHEST_PROTOCOL = 5,
     DEFAULT_PROTOCOL = 4
 };
 
@@ -101,7 +103,12 @@ enum opcode {
     NEWOBJ_EX        = '\x92',
     STACK_GLOBAL     = '\x93',
     MEMOIZE          = '\x94',
-    FRAME            = '\x95'
+    FRAME            = '\x95',
+
+    /* Protocol 5 */
+    BYTEARRAY8       = '\x96',
+    NEXT_BUFFER      = '\x97',
+    READONLY_BUFFER  = '\x98'
 };
 
 enum {
@@ -637,6 +644,7 @@ typedef struct PicklerObject {
     int fix_imports;            /* Indicate whether Pickler should fix
                                    the name of globals for Python 2.x. */
     PyObject *fast_memo;
+    PyObject *buffer_callback;  /* Callback for out-of-band buffers, or NULL */
 } PicklerObject;
 
 typedef struct UnpicklerObject {
@@ -663,6 +671,8 @@ typedef struct UnpicklerObject {
     PyObject *read;             /* read() method of the input stream. */
     PyObject *readline;         /* readline() method of the input stream. */
     PyObject *peek;             /* peek() method of the input stream, or NULL */
+    PyObject *readinto;         /* readinto() method of the input stream, or
+                                   NULL */
 
     char *encoding;             /* Name of the encoding to be used for
                                    decoding strings pickled using Python
@@ -677,8 +687,19 @@ typedef struct UnpicklerObject {
     int proto;                  /* Protocol of the pickle loaded. */
     int fix_imports;            /* Indicate whether Unpickler should fix
                                    the name of globals pickled by Python 2.x. */
+    PyObject *buffers;          /* iterable of out-of-band buffers, or NULL */
 } UnpicklerObject;
 
+typedef struct {
+    UnpicklerObject unpickler;  /* Holds the state of the pickle being
+                                   loaded between calls to feed(). */
+    PyObject *pending;          /* bytearray of the input not yet loaded. */
+    Py_ssize_t needed;          /* Size pending must reach before more
+                                   opcodes can be executed. */
+    int in_pickle;              /* True if a pickle was partially loaded. */
+    int loading;                /* True while feed() executes opcodes. */
+} IncrementalUnpicklerObject;
+
 typedef struct {
     PyObject_HEAD
     PicklerObject *pickler; /* Pickler whose memo table we're proxying. */
@@ -689,14 +710,214 @@ typedef struct {
     UnpicklerObject *unpickler;
 } UnpicklerMemoProxyObject;
 
+typedef struct {
+    PyObject_HEAD
+    Py_buffer view;             /* Buffer exported by the wrapped object.
+                                   view.obj is NULL once released. */
+    PyObject *weakreflist;
+} PickleBufferObject;
+
 /* Forward declarations */
 static int save(PicklerObject *, PyObject *, int);
 static int save_reduce(PicklerObject *, PyObject *, PyObject *);
 static PyTypeObject Pickler_Type;
 static PyTypeObject Unpickler_Type;
+static PyTypeObject IncrementalUnpickler_Type;
+static PyTypeObject PickleBuffer_Type;
 
 #include "clinic/_pickle.c.h"
 
+/*************************************************************************
+ PickleBuffer wraps an object exporting the buffer protocol, so that its
+ __reduce_ex__() can hand the memory to a protocol 5 pickler.  Depending on
+ the buffer_callback given to the pickler, the data is then either written
+ in-band (as bytes or bytearray) or passed out-of-band to the callback,
+ without ever being copied into the pickle stream.
+ *************************************************************************/
+
+/*[clinic input]
+@classmethod
+_pickle.PickleBuffer.__new__
+
+  buffer: object
+  /
+
+Wrapper for potentially out-of-band buffers.
+[clinic start generated code]*/
+
+static PyObject *
+_pickle_PickleBuffer_impl(PyTypeObject *type, PyObject *buffer)
+/*[clinic end generated code: output=25b0f5cb909430cb input=237cc36c3191d483]*/
+{
+    PickleBufferObject *self;
+
+    self = (PickleBufferObject *)type->tp_alloc(type, 0);
+    if (self == NULL)
+        return NULL;
+    self->view.obj = NULL;
+    self->weakreflist = NULL;
+    if (PyObject_GetBuffer(buffer, &self->view, PyBUF_FULL_RO) < 0) {
+        Py_DECREF(self);
+        return NULL;
+    }
+    return (PyObject *)self;
+}
+
+static int
+PickleBuffer_check_released(PickleBufferObject *self)
+{
+    if (self->view.obj == NULL) {
+        PyErr_SetString(PyExc_ValueError,
+                        "operation forbidden on released PickleBuffer object");
+        return -1;
+    }
+    return 0;
+}
+
+/*[clinic input]
+_pickle.PickleBuffer.raw
+
+Return a memoryview of the raw memory underlying this buffer.
+
+The memoryview is one-dimensional with format 'B'.  BufferError is
+raised if the buffer is not contiguous.
+[clinic start generated code]*/
+
+static PyObject *
+_pickle_PickleBuffer_raw_impl(PickleBufferObject *self)
+/*[clinic end generated code: output=c78b3fd04355aba5 input=ac25dd502fb37432]*/
+{
+    PyObject *m;
+    PyMemoryViewObject *mv;
+
+    if (PickleBuffer_check_released(self) < 0)
+        return NULL;
+    if (self->view.suboffsets != NULL ||
+        !PyBuffer_IsContiguous(&self->view, 'A')) {
+        PyErr_SetString(PyExc_BufferError,
+                        "cannot extract raw buffer from non-contiguous buffer");
+        return NULL;
+    }
+    m = PyMemoryView_FromObject((PyObject *)self);
+    if (m == NULL)
+        return NULL;
+    /* Reshape the memoryview in place into a flat view of bytes.  This
+       is valid for any contiguous layout, unlike memoryview.cast(). */
+    mv = (PyMemoryViewObject *)m;
+    mv->view.format = "B";
+    mv->view.ndim = 1;
+    mv->view.itemsize = 1;
+    mv->view.shape = &mv->view.len;
+    mv->view.strides = &mv->view.itemsize;
+    mv->view.suboffsets = NULL;
+    mv->flags = _Py_MEMORYVIEW_C | _Py_MEMORYVIEW_FORTRAN;
+    return m;
+}
+
+/*[clinic input]
+_pickle.PickleBuffer.release
+
+Release the underlying buffer exposed by the PickleBuffer object.
+[clinic start generated code]*/
+
+static PyObject *
+_pickle_PickleBuffer_release_impl(PickleBufferObject *self)
+/*[clinic end generated code: output=cc7900aaba67e761 input=b9a5e91e3bdd0dc7]*/
+{
+    if (self->view.obj != NULL)
+        PyBuffer_Release(&self->view);
+    Py_RETURN_NONE;
+}
+
+static int
+PickleBuffer_getbuffer(PickleBufferObject *self, Py_buffer *view, int flags)
+{
+    if (PickleBuffer_check_released(self) < 0)
+        return -1;
+    /* Re-export from the original object, so that consumers don't keep
+       the PickleBuffer itself alive. */
+    return PyObject_GetBuffer(self->view.obj, view, flags);
+}
+
+static void
+PickleBuffer_dealloc(PickleBufferObject *self)
+{
+    PyObject_GC_UnTrack(self);
+    if (self->weakreflist != NULL)
+        PyObject_ClearWeakRefs((PyObject *)self);
+    if (self->view.obj != NULL)
+        PyBuffer_Release(&self->view);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static int
+PickleBuffer_traverse(PickleBufferObject *self, visitproc visit, void *arg)
+{
+    Py_VISIT(self->view.obj);
+    return 0;
+}
+
+static int
+PickleBuffer_clear(PickleBufferObject *self)
+{
+    if (self->view.obj != NULL)
+        PyBuffer_Release(&self->view);
+    return 0;
+}
+
+static PyBufferProcs PickleBuffer_as_buffer = {
+    (getbufferproc)PickleBuffer_getbuffer,      /* bf_getbuffer */
+    0,                                          /* bf_releasebuffer */
+};
+
+static struct PyMethodDef PickleBuffer_methods[] = {
+    _PICKLE_PICKLEBUFFER_RAW_METHODDEF
+    _PICKLE_PICKLEBUFFER_RELEASE_METHODDEF
+    {NULL, NULL}                /* sentinel */
+};
+
+static PyTypeObject PickleBuffer_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "pickle.PickleBuffer",                      /*tp_name*/
+    sizeof(PickleBufferObject),                 /*tp_basicsize*/
+    0,                                          /*tp_itemsize*/
+    (destructor)PickleBuffer_dealloc,           /*tp_dealloc*/
+    0,                                          /*tp_print*/
+    0,                                          /*tp_getattr*/
+    0,                                          /*tp_setattr*/
+    0,                                          /*tp_reserved*/
+    0,                                          /*tp_repr*/
+    0,                                          /*tp_as_number*/
+    0,                                          /*tp_as_sequence*/
+    0,                                          /*tp_as_mapping*/
+    0,                                          /*tp_hash*/
+    0,                                          /*tp_call*/
+    0,                                          /*tp_str*/
+    0,                                          /*tp_getattro*/
+    0,                                          /*tp_setattro*/
+    &PickleBuffer_as_buffer,                    /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,
+    _pickle_PickleBuffer__doc__,                /*tp_doc*/
+    (traverseproc)PickleBuffer_traverse,        /*tp_traverse*/
+    (inquiry)PickleBuffer_clear,                /*tp_clear*/
+    0,                                          /*tp_richcompare*/
+    offsetof(PickleBufferObject, weakreflist),  /*tp_weaklistoffset*/
+    0,                                          /*tp_iter*/
+    0,                                          /*tp_iternext*/
+    PickleBuffer_methods,                       /*tp_methods*/
+    0,                                          /*tp_members*/
+    0,                                          /*tp_getset*/
+    0,                                          /*tp_base*/
+    0,                                          /*tp_dict*/
+    0,                                          /*tp_descr_get*/
+    0,                                          /*tp_descr_set*/
+    0,                                          /*tp_dictoffset*/
+    0,                                          /*tp_init*/
+    PyType_GenericAlloc,                        /*tp_alloc*/
+    _pickle_PickleBuffer,                       /*tp_new*/
+    PyObject_GC_Del,                            /*tp_free*/
+};
+
 /*************************************************************************
  A custom hashtable mapping void* to Python ints. This is used by the pickler
  for memoization. Using a custom hashtable rather than PyDict allows us to skip
@@ -1105,6 +1326,7 @@ _Pickler_New(void)
     self->fast_nesting = 0;
     self->fix_imports = 0;
     self->fast_memo = NULL;
+    self->buffer_callback = NULL;
     self->max_output_len = WRITE_BUF_SIZE;
     self->output_len = 0;
 
@@ -1165,6 +1387,26 @@ _Pickler_SetOutputStream(PicklerObject *self, PyObject *file)
     return 0;
 }
 
+/* Returns -1 (with an exception set) on failure, 0 on success. This may
+   be called once on a freshly created Pickler, after its protocol was
+   set. */
+static int
+_Pickler_SetBufferCallback(PicklerObject *self, PyObject *buffer_callback)
+{
+    if (buffer_callback == Py_None) {
+        buffer_callback = NULL;
+    }
+    if (buffer_callback != NULL && self->proto < 5) {
+        PyErr_SetString(PyExc_ValueError,
+                        "buffer_callback needs protocol >= 5");
+        return -1;
+    }
+
+    Py_XINCREF(buffer_callback);
+    Py_XSETREF(self->buffer_callback, buffer_callback);
+    return 0;
+}
+
 /* Returns the size of the input on success, -1 on failure. This takes its
    own reference to `input`. */
 static Py_ssize_t
@@ -1326,6 +1568,83 @@ _Unpickler_ReadImpl(UnpicklerObject *self, char **s, Py_ssize_t n)
         (n))                                                 \
      : _Unpickler_ReadImpl(self, (s), (n)))
 
+/* Read exactly `n` bytes from the unpickler's data source into `buf`.
+
+   Bytes already buffered are copied first; the rest is read from the input
+   stream directly into `buf` with its readinto() method if it has one,
+   rather than going through an intermediate bytes object.
+
+   Returns -1 (with an exception set) on failure. On success, return `n`. */
+static Py_ssize_t
+_Unpickler_ReadInto(UnpicklerObject *self, char *buf, Py_ssize_t n)
+{
+    Py_ssize_t in_buffer = self->input_len - self->next_read_idx;
+    Py_ssize_t remaining = n;
+    Py_ssize_t read_size;
+
+    if (in_buffer > 0) {
+        Py_ssize_t to_read = Py_MIN(in_buffer, n);
+        memcpy(buf, self->input_buffer + self->next_read_idx, to_read);
+        self->next_read_idx += to_read;
+        buf += to_read;
+        remaining -= to_read;
+        if (remaining == 0)
+            return n;
+    }
+
+    if (!self->read)
+        return bad_readline();
+    if (_Unpickler_SkipConsumed(self) < 0)
+        return -1;
+
+    if (self->readinto == NULL) {
+        PyObject *len, *data;
+
+        len = PyLong_FromSsize_t(remaining);
+        if (len == NULL)
+            return -1;
+        data = _Pickle_FastCall(self->read, len);
+        if (data == NULL)
+            return -1;
+        if (!PyBytes_Check(data)) {
+            PyErr_Format(PyExc_ValueError,
+                         "read() returned non-bytes object (%R)",
+                         Py_TYPE(data));
+            Py_DECREF(data);
+            return -1;
+        }
+        read_size = PyBytes_GET_SIZE(data);
+        if (read_size < remaining) {
+            Py_DECREF(data);
+            return bad_readline();
+        }
+        memcpy(buf, PyBytes_AS_STRING(data), remaining);
+        Py_DECREF(data);
+        return n;
+    }
+    else {
+        PyObject *view, *result;
+
+        view = PyMemoryView_FromMemory(buf, remaining, PyBUF_WRITE);
+        if (view == NULL)
+            return -1;
+        result = _Pickle_FastCall(self->readinto, view);
+        if (result == NULL)
+            return -1;
+        read_size = PyLong_AsSsize_t(result);
+        Py_DECREF(result);
+        if (read_size < 0) {
+            if (!PyErr_Occurred())
+                PyErr_SetString(PyExc_ValueError,
+                                "readinto() returned negative size");
+            return -1;
+        }
+        if (read_size < remaining)
+            return bad_readline();
+        return n;
+    }
+}
+
 static Py_ssize_t
 _Unpickler_CopyLine(UnpicklerObject *self, char *line, Py_ssize_t len,
                     char **result)
@@ -1475,6 +1794,7 @@ _Unpickler_New(void)
     self->read = NULL;
     self->readline = NULL;
     self->peek = NULL;
+    self->readinto = NULL;
     self->encoding = NULL;
     self->errors = NULL;
     self->marks = NULL;
@@ -1482,6 +1802,7 @@ _Unpickler_New(void)
     self->marks_size = 0;
     self->proto = 0;
     self->fix_imports = 0;
+    self->buffers = NULL;
     memset(&self->buffer, 0, sizeof(Py_buffer));
     self->memo_size = 32;
     self->memo_len = 0;
@@ -1503,11 +1824,16 @@ _Unpickler_SetInputStream(UnpicklerObject *self, PyObject *file)
 {
     _Py_IDENTIFIER(peek);
     _Py_IDENTIFIER(read);
+    _Py_IDENTIFIER(readinto);
     _Py_IDENTIFIER(readline);
 
     if (_PyObject_LookupAttrId(file, &PyId_peek, &self->peek) < 0) {
         return -1;
     }
+    if (_PyObject_LookupAttrId(file, &PyId_readinto, &self->readinto) < 0) {
+        Py_CLEAR(self->peek);
+        return -1;
+    }
     (void)_PyObject_LookupAttrId(file, &PyId_read, &self->read);
     (void)_PyObject_LookupAttrId(file, &PyId_readline, &self->readline);
     if (self->readline == NULL || self->read == NULL) {
@@ -1518,6 +1844,7 @@ _Unpickler_SetInputStream(UnpicklerObject *self, PyObject *file)
         Py_CLEAR(self->read);
         Py_CLEAR(self->readline);
         Py_CLEAR(self->peek);
+        Py_CLEAR(self->readinto);
         return -1;
     }
     return 0;
@@ -1544,6 +1871,21 @@ _Unpickler_SetInputEncoding(UnpicklerObject *self,
     return 0;
 }
 
+/* Returns -1 (with an exception set) on failure, 0 on success. This may
+   be called once on a freshly created Unpickler. */
+static int
+_Unpickler_SetBuffers(UnpicklerObject *self, PyObject *buffers)
+{
+    if (buffers == NULL || buffers == Py_None) {
+        Py_CLEAR(self->buffers);
+        return 0;
+    }
+    Py_XSETREF(self->buffers, PyObject_GetIter(buffers));
+    if (self->buffers == NULL)
+        return -1;
+    return 0;
+}
+
 /* Generate a GET opcode for an object stored in the memo. */
 static int
 memo_get(PicklerObject *self, PyObject *key)
@@ -1853,7 +2195,7 @@ fast_save_enter(PicklerObject *self, PyObject *obj)
         if (PyDict_GetItemWithError(self->fast_memo, key)) {
             Py_DECREF(key);
             PyErr_Format(PyExc_ValueError,
-                         "fast mode: can't pickle cyclic objects "
+                         "memoization disabled: can't pickle cyclic objects "
                          "including object type %.200s at %p",
                          obj->ob_type->tp_name, obj);
             self->fast_nesting = -1;
@@ -2199,6 +2541,78 @@ _Pickler_write_bytes(PicklerObject *self,
     return 0;
 }
 
+/* Write the data of a bytes-like object as a bytes object, and memoize
+   obj.  Large data is passed to file.write() as payload, a C-contiguous
+   buffer exporter.  Requires protocol >= 3. */
+static int
+_save_bytes_data(PicklerObject *self, PyObject *obj, PyObject *payload,
+                 const char *data, Py_ssize_t size)
+{
+    char header[9];
+    Py_ssize_t len;
+
+    assert(self->proto >= 3);
+    if (size < 0)
+        return -1;
+
+    if (size <= 0xff) {
+        header[0] = SHORT_BINBYTES;
+        header[1] = (unsigned char)size;
+        len = 2;
+    }
+    else if ((size_t)size <= 0xffffffffUL) {
+        header[0] = BINBYTES;
+        header[1] = (unsigned char)(size & 0xff);
+        header[2] = (unsigned char)((size >> 8) & 0xff);
+        header[3] = (unsigned char)((size >> 16) & 0xff);
+        header[4] = (unsigned char)((size >> 24) & 0xff);
+        len = 5;
+    }
+    else if (self->proto >= 4) {
+        header[0] = BINBYTES8;
+        _write_size64(header + 1, size);
+        len = 9;
+    }
+    else {
+        PyErr_SetString(PyExc_OverflowError,
+                        "cannot serialize a bytes object larger than 4 GiB");
+        return -1;          /* string too large */
+    }
+
+    if (_Pickler_write_bytes(self, header, len, data, size, payload) < 0)
+        return -1;
+
+    if (memo_put(self, obj) < 0)
+        return -1;
+
+    return 0;
+}
+
+/* Write the data of a bytes-like object as a bytearray object, and
+   memoize obj.  Large data is passed to file.write() as payload, a
+   C-contiguous buffer exporter.  Requires protocol >= 5. */
+static int
+_save_bytearray_data(PicklerObject *self, PyObject *obj, PyObject *payload,
+                     const char *data, Py_ssize_t size)
+{
+    char header[9];
+
+    assert(self->proto >= 5);
+    if (size < 0)
+        return -1;
+
+    header[0] = BYTEARRAY8;
+    _write_size64(header + 1, size);
+
+    if (_Pickler_write_bytes(self, header, 9, data, size, payload) < 0)
+        return -1;
+
+    if (memo_put(self, obj) < 0)
+        return -1;
+
+    return 0;
+}
+
 static int
 save_bytes(PicklerObject *self, PyObject *obj)
 {
@@ -2245,49 +2659,92 @@ save_bytes(PicklerObject *self, PyObject *obj)
         return status;
     }
     else {
-        Py_ssize_t size;
-        char header[9];
-        Py_ssize_t len;
+        return _save_bytes_data(self, obj, obj, PyBytes_AS_STRING(obj),
+                                PyBytes_GET_SIZE(obj));
+    }
+}
+
+/* Only called for protocol >= 5; older protocols pickle bytearray objects
+   through their __reduce_ex__() method. */
+static int
+save_bytearray(PicklerObject *self, PyObject *obj)
+{
+    return _save_bytearray_data(self, obj, obj, PyByteArray_AS_STRING(obj),
+                                PyByteArray_GET_SIZE(obj));
+}
+
+static int
+save_picklebuffer(PicklerObject *self, PyObject *obj)
+{
+    const Py_buffer *view = &((PickleBufferObject *)obj)->view;
+    int in_band = 1;
+
+    if (self->proto < 5) {
+        PickleState *st = _Pickle_GetGlobalState();
+        PyErr_SetString(st->PicklingError,
+                        "PickleBuffer can only be pickled with protocol >= 5");
+        return -1;
+    }
+    if (PickleBuffer_check_released((PickleBufferObject *)obj) < 0)
+        return -1;
+    if (view->suboffsets != NULL || !PyBuffer_IsContiguous(view, 'A')) {
+        PickleState *st = _Pickle_GetGlobalState();
+        PyErr_SetString(st->PicklingError,
+                        "PickleBuffer can not be pickled when "
+                        "pointing to a non-contiguous buffer");
+        return -1;
+    }
+    if (self->buffer_callback != NULL) {
+        PyObject *ret;
 
-        size = PyBytes_GET_SIZE(obj);
-        if (size < 0)
+        Py_INCREF(obj);
+        ret = _Pickle_FastCall(self->buffer_callback, obj);
+        if (ret == NULL)
+            return -1;
+        in_band = PyObject_IsTrue(ret);
+        Py_DECREF(ret);
+        if (in_band < 0)
             return -1;
+    }
 
-        if (size <= 0xff) {
-            header[0] = SHORT_BINBYTES;
-            header[1] = (unsigned char)size;
-            len = 2;
-        }
-        else if ((size_t)size <= 0xffffffffUL) {
-            header[0] = BINBYTES;
-            header[1] = (unsigned char)(size & 0xff);
-            header[2] = (unsigned char)((size >> 8) & 0xff);
-            header[3] = (unsigned char)((size >> 16) & 0xff);
-            header[4] = (unsigned char)((size >> 24) & 0xff);
-            len = 5;
-        }
-        else if (self->proto >= 4) {
-            header[0] = BINBYTES8;
-            _write_size64(header + 1, size);
-            len = 9;
+    if (in_band) {
+        /* The data is written into the pickle stream.  Large payloads are
+           passed to file.write() as is, which only accepts C-contiguous
+           buffers: substitute a flat view for other layouts. */
+        PyObject *payload = obj;
+        int status;
+
+        if (!PyBuffer_IsContiguous(view, 'C')) {
+            payload = _pickle_PickleBuffer_raw_impl((PickleBufferObject *)obj);
+            if (payload == NULL)
+                return -1;
         }
         else {
-            PyErr_SetString(PyExc_OverflowError,
-                            "cannot serialize a bytes object larger than 4 GiB");
-            return -1;          /* string too large */
-        }
-
-        if (_Pickler_write_bytes(self, header, len,
-                                 PyBytes_AS_STRING(obj), size, obj) < 0)
-        {
-            return -1;
+            Py_INCREF(payload);
         }
-
-        if (memo_put(self, obj) < 0)
+        if (view->readonly)
+            status = _save_bytes_data(self, obj, payload,
+                                      (const char *)view->buf, view->len);
+        else
+            status = _save_bytearray_data(self, obj, payload,
+                                          (const char *)view->buf, view->len);
+        Py_DECREF(payload);
+        return status;
+    }
+    else {
+        /* The callback took care of the data; only a reference to the next
+           out-of-band buffer is written.  Out-of-band buffers are not
+           memoized, as the callback sees them once per occurrence. */
+        char op[2];
+        Py_ssize_t len = 1;
+
+        op[0] = NEXT_BUFFER;
+        if (view->readonly)
+            op[len++] = READONLY_BUFFER;
+        if (_Pickler_Write(self, op, len) < 0)
             return -1;
-
-        return 0;
     }
+    return 0;
 }
 
 /* A copy of PyUnicode_EncodeRawUnicodeEscape() that also translates
@@ -3173,6 +3630,8 @@ save_frozenset(PicklerObject *self, PyObject *obj)
         /* save_reduce() will memoize the object automatically. */
         status = save_reduce(self, reduce_value, obj);
         Py_DECREF(reduce_value);
+        if (status == 0 && self->fast && !fast_save_leave(self, obj))
+            return -1;
         return status;
     }
 
@@ -3220,6 +3679,8 @@ save_frozenset(PicklerObject *self, PyObject *obj)
         return -1;
     if (memo_put(self, obj) < 0)
         return -1;
+    if (self->fast && !fast_save_leave(self, obj))
+        return -1;
 
     return 0;
 }
@@ -3982,8 +4443,8 @@ save(PicklerObject *self, PyObject *obj, int pers_save)
 
     /* Check the memo to see if it has the object. If so, generate
        a GET (or BINGET) opcode, instead of pickling the object
-       once again. */
-    if (PyMemoTable_Get(self->memo, obj)) {
+       once again.  Nothing is memoized in fast mode. */
+    if (!self->fast && PyMemoTable_Get(self->memo, obj)) {
         return memo_get(self, obj);
     }
 
@@ -3993,6 +4454,12 @@ save(PicklerObject *self, PyObject *obj, int pers_save)
     else if (type == &PyUnicode_Type) {
         return save_unicode(self, obj);
     }
+    else if (type == &PyByteArray_Type && self->proto >= 5) {
+        return save_bytearray(self, obj);
+    }
+    else if (type == &PickleBuffer_Type) {
+        return save_picklebuffer(self, obj);
+    }
 
     /* We're only calling Py_EnterRecursiveCall here so that atomic
        types above are pickled faster. */
@@ -4143,6 +4610,11 @@ dump(PicklerObject *self, PyObject *obj)
 {
     const char stop_op = STOP;
 
+    /* Start from a clean cycle check, even if a previous dump failed. */
+    self->fast_nesting = 0;
+    if (self->fast_memo != NULL)
+        PyDict_Clear(self->fast_memo);
+
     if (self->proto >= 2) {
         char header[2];
 
@@ -4266,6 +4738,7 @@ Pickler_dealloc(PicklerObject *self)
     Py_XDECREF(self->pers_func);
     Py_XDECREF(self->dispatch_table);
     Py_XDECREF(self->fast_memo);
+    Py_XDECREF(self->buffer_callback);
 
     PyMemoTable_Del(self->memo);
 
@@ -4279,6 +4752,7 @@ Pickler_traverse(PicklerObject *self, visitproc visit, void *arg)
     Py_VISIT(self->pers_func);
     Py_VISIT(self->dispatch_table);
     Py_VISIT(self->fast_memo);
+    Py_VISIT(self->buffer_callback);
     return 0;
 }
 
@@ -4290,6 +4764,7 @@ Pickler_clear(PicklerObject *self)
     Py_CLEAR(self->pers_func);
     Py_CLEAR(self->dispatch_table);
     Py_CLEAR(self->fast_memo);
+    Py_CLEAR(self->buffer_callback);
 
     if (self->memo != NULL) {
         PyMemoTable *memo = self->memo;
@@ -4307,12 +4782,16 @@ _pickle.Pickler.__init__
   file: object
   protocol: object = NULL
   fix_imports: bool = True
+  buffer_callback: object = None
+  *
+  memoize: bool = True
 
 This takes a binary file for writing a pickle data stream.
 
 The optional *protocol* argument tells the pickler to use the given
-protocol; supported protocols are 0, 1, 2, 3 and 4.  The default
-protocol is 3; a backward-incompatible protocol designed for Python 3.
+protocol; supported protocols are 0, 1, 2, 3, 4 and 5.  The default
+protocol is 4. It was introduced in Python 3.4, it is incompatible
+with previous versions.
 
 Specifying a negative protocol version selects the highest protocol
 version supported.  The higher the protocol used, the more recent the
@@ -4326,12 +4805,25 @@ this interface.
 If *fix_imports* is True and protocol is less than 3, pickle will try
 to map the new Python 3 names to the old module names used in Python
 2, so that the pickle data stream is readable with Python 2.
+
+If *buffer_callback* is None (the default), buffer views are
+serialized into *file* as part of the pickle stream.  Otherwise it is
+called with each PickleBuffer met while pickling; when it returns a
+false value, the buffer is not written into the stream and must be
+passed back, in order, in the *buffers* argument of the unpickler.
+It is an error to pass *buffer_callback* with a protocol below 5.
+
+If *memoize* is false, the pickler does not record the objects it has
+already written, so shared objects are written once per reference.
+This is faster for data without shared or recursive references; a
+ValueError is raised if a recursive structure is met.
 [clinic start generated code]*/
 
 static int
 _pickle_Pickler___init___impl(PicklerObject *self, PyObject *file,
-                              PyObject *protocol, int fix_imports)
-/*[clinic end generated code: output=b5f31078dab17fb0 input=4faabdbc763c2389]*/
+                              PyObject *protocol, int fix_imports,
+                              PyObject *buffer_callback, int memoize)
+/*[clinic end generated code: output=6ebb6baffb55826a input=350a47e7370fea3a]*/
 {
     _Py_IDENTIFIER(persistent_id);
     _Py_IDENTIFIER(dispatch_table);
@@ -4346,6 +4838,9 @@ _pickle_Pickler___init___impl(PicklerObject *self, PyObject *file,
     if (_Pickler_SetOutputStream(self, file) < 0)
         return -1;
 
+    if (_Pickler_SetBufferCallback(self, buffer_callback) < 0)
+        return -1;
+
     /* memo and output_buffer may have already been created in _Pickler_New */
     if (self->memo == NULL) {
         self->memo = PyMemoTable_New();
@@ -4361,7 +4856,7 @@ _pickle_Pickler___init___impl(PicklerObject *self, PyObject *file,
             return -1;
     }
 
-    self->fast = 0;
+    self->fast = !memoize;
     self->fast_nesting = 0;
     self->fast_memo = NULL;
 
@@ -5146,9 +5641,92 @@ load_counted_binbytes(UnpicklerObject *self, int nbytes)
 }
 
 static int
-load_unicode(UnpicklerObject *self)
+load_counted_bytearray(UnpicklerObject *self)
 {
-    PyObject *str;
+    PyObject *bytearray;
+    Py_ssize_t size;
+    char *s;
+
+    if (_Unpickler_Read(self, &s, 8) < 0)
+        return -1;
+
+    size = calc_binsize(s, 8);
+    if (size < 0) {
+        PyErr_Format(PyExc_OverflowError,
+                     "BYTEARRAY8 exceeds system's maximum size of %zd bytes",
+                     PY_SSIZE_T_MAX);
+        return -1;
+    }
+
+    bytearray = PyByteArray_FromStringAndSize(NULL, size);
+    if (bytearray == NULL)
+        return -1;
+    if (_Unpickler_ReadInto(self, PyByteArray_AS_STRING(bytearray),
+                            size) < 0) {
+        Py_DECREF(bytearray);
+        return -1;
+    }
+
+    PDATA_PUSH(self->stack, bytearray, -1);
+    return 0;
+}
+
+static int
+load_next_buffer(UnpicklerObject *self)
+{
+    PyObject *buf;
+
+    if (self->buffers == NULL) {
+        PickleState *st = _Pickle_GetGlobalState();
+        PyErr_SetString(st->UnpicklingError,
+                        "pickle stream refers to out-of-band data "
+                        "but no *buffers* argument was given");
+        return -1;
+    }
+    buf = PyIter_Next(self->buffers);
+    if (buf == NULL) {
+        if (!PyErr_Occurred()) {
+            PickleState *st = _Pickle_GetGlobalState();
+            PyErr_SetString(st->UnpicklingError,
+                            "not enough out-of-band buffers");
+        }
+        return -1;
+    }
+
+    PDATA_PUSH(self->stack, buf, -1);
+    return 0;
+}
+
+static int
+load_readonly_buffer(UnpicklerObject *self)
+{
+    Py_ssize_t len = Py_SIZE(self->stack);
+    PyObject *obj, *view;
+
+    if (len <= self->stack->fence)
+        return Pdata_stack_underflow(self->stack);
+
+    obj = self->stack->data[len - 1];
+    view = PyMemoryView_FromObject(obj);
+    if (view == NULL)
+        return -1;
+    if (!PyMemoryView_GET_BUFFER(view)->readonly) {
+        /* The buffer given is writable: only expose a read-only view
+           of it, as the pickled buffer was read-only. */
+        PyMemoryView_GET_BUFFER(view)->readonly = 1;
+        self->stack->data[len - 1] = view;
+        Py_DECREF(obj);
+    }
+    else {
+        Py_DECREF(view);
+    }
+    return 0;
+}
+
+static int
+load_unicode(UnpicklerObject *self)
+{
+    PyObject *str;
     Py_ssize_t len;
     char *s = NULL;
 
@@ -6390,18 +6968,30 @@ load_frame(UnpicklerObject *self)
     return 0;
 }
 
-static PyObject *
-load(UnpicklerObject *self)
+/* Reset the unpickler's state before loading a new pickle. */
+static void
+_Unpickler_ResetState(UnpicklerObject *self)
 {
-    PyObject *value = NULL;
-    char *s = NULL;
-
     self->num_marks = 0;
     self->stack->mark_set = 0;
     self->stack->fence = 0;
     self->proto = 0;
     if (Py_SIZE(self->stack))
         Pdata_clear(self->stack, 0);
+}
+
+/* Execute opcodes until STOP, leaving the loaded object on the stack.
+
+   If `partial` is true, running out of input at an opcode boundary is not
+   an error: the opcodes executed so far are kept in the unpickler's state
+   and loading can be resumed once more input is available.
+
+   Returns -1 (with an exception set) on failure, 1 if STOP was reached and
+   0 if the input ran out first. */
+static int
+load_opcodes(UnpicklerObject *self, int partial)
+{
+    char *s = NULL;
 
     /* Convenient macros for the dispatch while-switch loop just below. */
 #define OP(opcode, load_func) \
@@ -6414,9 +7004,13 @@ load(UnpicklerObject *self)
         if (_Unpickler_Read(self, &s, 1) < 0) {
             PickleState *st = _Pickle_GetGlobalState();
             if (PyErr_ExceptionMatches(st->UnpicklingError)) {
+                if (partial) {
+                    PyErr_Clear();
+                    return 0;
+                }
                 PyErr_Format(PyExc_EOFError, "Ran out of input");
             }
-            return NULL;
+            return -1;
         }
 
         switch ((enum opcode)s[0]) {
@@ -6479,6 +7073,9 @@ load(UnpicklerObject *self)
         OP(REDUCE, load_reduce)
         OP(PROTO, load_proto)
         OP(FRAME, load_frame)
+        OP(BYTEARRAY8, load_counted_bytearray)
+        OP(NEXT_BUFFER, load_next_buffer)
+        OP(READONLY_BUFFER, load_readonly_buffer)
         OP_ARG(EXT1, load_extension, 1)
         OP_ARG(EXT2, load_extension, 2)
         OP_ARG(EXT4, load_extension, 4)
@@ -6500,7 +7097,7 @@ load(UnpicklerObject *self)
                     PyErr_Format(st->UnpicklingError,
                                  "invalid load key, '\\x%02x'.", c);
                 }
-                return NULL;
+                return -1;
             }
         }
 
@@ -6508,8 +7105,20 @@ load(UnpicklerObject *self)
     }
 
     if (PyErr_Occurred()) {
-        return NULL;
+        return -1;
     }
+    return 1;
+}
+
+static PyObject *
+load(UnpicklerObject *self)
+{
+    PyObject *value = NULL;
+
+    _Unpickler_ResetState(self);
+
+    if (load_opcodes(self, 0) < 0)
+        return NULL;
 
     if (_Unpickler_SkipConsumed(self) < 0)
         return NULL;
@@ -6690,8 +7299,10 @@ Unpickler_dealloc(UnpicklerObject *self)
     Py_XDECREF(self->readline);
     Py_XDECREF(self->read);
     Py_XDECREF(self->peek);
+    Py_XDECREF(self->readinto);
     Py_XDECREF(self->stack);
     Py_XDECREF(self->pers_func);
+    Py_XDECREF(self->buffers);
     if (self->buffer.buf != NULL) {
         PyBuffer_Release(&self->buffer);
         self->buffer.buf = NULL;
@@ -6712,8 +7323,10 @@ Unpickler_traverse(UnpicklerObject *self, visitproc visit, void *arg)
     Py_VISIT(self->readline);
     Py_VISIT(self->read);
     Py_VISIT(self->peek);
+    Py_VISIT(self->readinto);
     Py_VISIT(self->stack);
     Py_VISIT(self->pers_func);
+    Py_VISIT(self->buffers);
     return 0;
 }
 
@@ -6723,8 +7336,10 @@ Unpickler_clear(UnpicklerObject *self)
     Py_CLEAR(self->readline);
     Py_CLEAR(self->read);
     Py_CLEAR(self->peek);
+    Py_CLEAR(self->readinto);
     Py_CLEAR(self->stack);
     Py_CLEAR(self->pers_func);
+    Py_CLEAR(self->buffers);
     if (self->buffer.buf != NULL) {
         PyBuffer_Release(&self->buffer);
         self->buffer.buf = NULL;
@@ -6752,6 +7367,7 @@ _pickle.Unpickler.__init__
   fix_imports: bool = True
   encoding: str = 'ASCII'
   errors: str = 'strict'
+  buffers: object(c_default="NULL") = ()
 
 This takes a binary file for reading a pickle data stream.
 
@@ -6773,13 +7389,18 @@ map the old Python 2 names to the new names used in Python 3.  The
 instances pickled by Python 2; these default to 'ASCII' and 'strict',
 respectively.  The *encoding* can be 'bytes' to read these 8-bit
 string instances as bytes objects.
+
+If *buffers* is not None, it is an iterable of buffer-enabled objects
+that is consumed each time the pickle stream references an out-of-band
+buffer view.  Such buffers were given in order to the *buffer_callback*
+of a Pickler object.
 [clinic start generated code]*/
 
 static int
 _pickle_Unpickler___init___impl(UnpicklerObject *self, PyObject *file,
                                 int fix_imports, const char *encoding,
-                                const char *errors)
-/*[clinic end generated code: output=e2c8ce748edc57b0 input=f9b7da04f5f4f335]*/
+                                const char *errors, PyObject *buffers)
+/*[clinic end generated code: output=09f0192649ea3f85 input=f5b1842fd40d4131]*/
 {
     _Py_IDENTIFIER(persistent_load);
 
@@ -6793,6 +7414,9 @@ _pickle_Unpickler___init___impl(UnpicklerObject *self, PyObject *file,
     if (_Unpickler_SetInputEncoding(self, encoding, errors) < 0)
         return -1;
 
+    if (_Unpickler_SetBuffers(self, buffers) < 0)
+        return -1;
+
     self->fix_imports = fix_imports;
 
     if (init_method_ref((PyObject *)self, &PyId_persistent_load,
@@ -7162,6 +7786,433 @@ static PyTypeObject Unpickler_Type = {
     0,                                  /*tp_is_gc*/
 };
 
+/* IncrementalUnpickler loads a stream of pickles fed in chunks of any size.
+ * It only ever executes complete opcodes, so that the unpickler's state
+ * stays consistent between chunks: a FRAME is executed once the whole frame
+ * is available, and opcodes outside frames (in pickles with protocols older
+ * than 4, or too small to be framed) once their argument is complete. */
+
+/* Return the size of the complete opcode at the start of the `len` bytes
+   at `s`, including its argument and, for FRAME, the frame it announces.
+   If the opcode is incomplete, return 0 and set *needed to the size it
+   will have if that is known from the bytes available, or to 0. */
+static Py_ssize_t
+opcode_size(char *s, Py_ssize_t len, Py_ssize_t *needed)
+{
+    Py_ssize_t arg, count, i;
+    int nbytes, lines = 1;
+
+    assert(len > 0);
+    *needed = 0;
+    switch ((enum opcode)s[0]) {
+    case BININT1: case BINGET: case BINPUT: case PROTO: case EXT1:
+        arg = 1;
+        break;
+    case BININT2: case EXT2:
+        arg = 2;
+        break;
+    case BININT: case LONG_BINGET: case LONG_BINPUT: case EXT4:
+        arg = 4;
+        break;
+    case BINFLOAT:
+        arg = 8;
+        break;
+
+    case SHORT_BINBYTES: case SHORT_BINSTRING: case SHORT_BINUNICODE:
+    case LONG1:
+        nbytes = 1;
+        goto counted;
+    case BINBYTES: case BINSTRING: case BINUNICODE: case LONG4:
+        nbytes = 4;
+        goto counted;
+    case BINBYTES8: case BINUNICODE8: case BYTEARRAY8: case FRAME:
+        nbytes = 8;
+    counted:
+        if (len < 1 + nbytes) {
+            *needed = 1 + nbytes;
+            return 0;
+        }
+        if ((enum opcode)s[0] == BINSTRING || (enum opcode)s[0] == LONG4)
+            count = calc_binint(s + 1, nbytes);
+        else
+            count = calc_binsize(s + 1, nbytes);
+        /* Let the opcode report invalid sizes. */
+        if (count < 0 || count > PY_SSIZE_T_MAX - 1 - nbytes)
+            return 1 + nbytes;
+        arg = nbytes + count;
+        break;
+
+    case GLOBAL: case INST:
+        lines = 2;
+        /* fall through */
+    case INT: case LONG: case FLOAT: case STRING: case UNICODE:
+    case GET: case PUT: case PERSID:
+        for (i = 1; i < len; i++) {
+            if (s[i] == '\n' && --lines == 0)
+                return i + 1;
+        }
+        return 0;
+
+    default:
+        return 1;
+    }
+    if (len < 1 + arg) {
+        *needed = 1 + arg;
+        return 0;
+    }
+    return 1 + arg;
+}
+
+static void
+_IncrementalUnpickler_Reset(IncrementalUnpicklerObject *self)
+{
+    UnpicklerObject *unpickler = &self->unpickler;
+    size_t i;
+
+    if (unpickler->buffer.buf != NULL) {
+        PyBuffer_Release(&unpickler->buffer);
+        unpickler->buffer.buf = NULL;
+    }
+    unpickler->input_buffer = NULL;
+    unpickler->input_len = 0;
+    unpickler->next_read_idx = 0;
+    unpickler->prefetched_idx = 0;
+
+    _Unpickler_ResetState(unpickler);
+    for (i = 0; i < unpickler->memo_size; i++)
+        Py_CLEAR(unpickler->memo[i]);
+    unpickler->memo_len = 0;
+    self->in_pickle = 0;
+}
+
+/* feed(), close() and __init__() must not be called by find_class(),
+   persistent_load() or the callables run by the opcodes while feed() is
+   loading the pending input, since they change or free it. */
+static int
+_IncrementalUnpickler_CheckNotLoading(IncrementalUnpicklerObject *self,
+                                      const char *method)
+{
+    if (self->loading) {
+        PyErr_Format(PyExc_RuntimeError,
+                     "IncrementalUnpickler.%s() called while feed() "
+                     "is loading", method);
+        return -1;
+    }
+    return 0;
+}
+
+/*[clinic input]
+
+_pickle.IncrementalUnpickler.__init__
+
+  *
+  fix_imports: bool = True
+  encoding: str = 'ASCII'
+  errors: str = 'strict'
+  buffers: object(c_default="NULL") = ()
+
+Load a stream of pickles fed in chunks of arbitrary sizes.
+
+Data is passed to the feed() method as it arrives, for instance from a
+socket, and the objects whose pickle is complete are returned.  Each
+pickle is loaded independently, as by loads().  A partially received
+pickle is kept as the unpickler's state rather than as raw data, and
+the opcodes of protocol 4 frames are executed as soon as a whole frame
+is available.
+
+Optional keyword arguments *fix_imports*, *encoding*, *errors* and
+*buffers* have the same meaning as for Unpickler.  *buffers* is shared
+by all the pickles of the stream.
+[clinic start generated code]*/
+
+static int
+_pickle_IncrementalUnpickler___init___impl(IncrementalUnpicklerObject *self,
+                                           int fix_imports,
+                                           const char *encoding,
+                                           const char *errors,
+                                           PyObject *buffers)
+/*[clinic end generated code: output=d153426d2d3a9be2 input=b3e836b6cde48ac8]*/
+{
+    _Py_IDENTIFIER(persistent_load);
+    UnpicklerObject *unpickler = &self->unpickler;
+
+    if (_IncrementalUnpickler_CheckNotLoading(self, "__init__") < 0)
+        return -1;
+
+    /* In case of multiple __init__() calls, clear previous content. */
+    if (unpickler->stack != NULL) {
+        (void)Unpickler_clear(unpickler);
+        Py_CLEAR(self->pending);
+    }
+
+    if (_Unpickler_SetInputEncoding(unpickler, encoding, errors) < 0)
+        return -1;
+
+    if (_Unpickler_SetBuffers(unpickler, buffers) < 0)
+        return -1;
+
+    unpickler->fix_imports = fix_imports;
+
+    if (init_method_ref((PyObject *)self, &PyId_persistent_load,
+                        &unpickler->pers_func,
+                        &unpickler->pers_func_self) < 0)
+    {
+        return -1;
+    }
+
+    unpickler->stack = (Pdata *)Pdata_New();
+    if (unpickler->stack == NULL)
+        return -1;
+
+    unpickler->memo_size = 32;
+    unpickler->memo = _Unpickler_NewMemo(unpickler->memo_size);
+    if (unpickler->memo == NULL)
+        return -1;
+
+    unpickler->proto = 0;
+
+    self->pending = PyByteArray_FromStringAndSize(NULL, 0);
+    if (self->pending == NULL)
+        return -1;
+    self->needed = 1;
+    self->in_pickle = 0;
+    self->loading = 0;
+
+    return 0;
+}
+
+static int
+_IncrementalUnpickler_CheckInit(IncrementalUnpicklerObject *self)
+{
+    if (self->pending == NULL) {
+        PickleState *st = _Pickle_GetGlobalState();
+        PyErr_Format(st->UnpicklingError,
+                     "IncrementalUnpickler.__init__() was not called by "
+                     "%s.__init__()", Py_TYPE(self)->tp_name);
+        return -1;
+    }
+    return 0;
+}
+
+/*[clinic input]
+
+_pickle.IncrementalUnpickler.feed
+
+  data: Py_buffer
+  /
+
+Feed the next chunk of the pickle stream.
+
+Return the list of the objects whose pickle was completed by *data*,
+in stream order.  If an error is raised, the pending input and the
+partially loaded pickle are discarded.
+[clinic start generated code]*/
+
+static PyObject *
+_pickle_IncrementalUnpickler_feed_impl(IncrementalUnpicklerObject *self,
+                                       Py_buffer *data)
+/*[clinic end generated code: output=aa0df4eaa71a33c1 input=79faf972b62bc676]*/
+{
+    UnpicklerObject *unpickler = &self->unpickler;
+    PyObject *result, *value;
+    Py_ssize_t size, pos, end, n, needed;
+    int status;
+
+    if (_IncrementalUnpickler_CheckInit(self) < 0 ||
+        _IncrementalUnpickler_CheckNotLoading(self, "feed") < 0)
+        return NULL;
+
+    size = PyByteArray_GET_SIZE(self->pending);
+    if (data->len > PY_SSIZE_T_MAX - size) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    if (PyByteArray_Resize(self->pending, size + data->len) < 0)
+        return NULL;
+    memcpy(PyByteArray_AS_STRING(self->pending) + size, data->buf, data->len);
+    size += data->len;
+
+    result = PyList_New(0);
+    if (result == NULL)
+        return NULL;
+    if (size < self->needed)
+        return result;
+
+    if (_Unpickler_SetStringInput(unpickler, self->pending) < 0)
+        goto error;
+
+    self->loading = 1;
+    pos = 0;
+    for (;;) {
+        /* Load the longest run of complete opcodes. */
+        end = pos;
+        needed = 0;
+        while (end < size) {
+            n = opcode_size(unpickler->input_buffer + end, size - end,
+                            &needed);
+            if (n == 0)
+                break;
+            end += n;
+        }
+        if (end == pos)
+            break;
+
+        if (!self->in_pickle) {
+            _Unpickler_ResetState(unpickler);
+            self->in_pickle = 1;
+        }
+        unpickler->next_read_idx = pos;
+        unpickler->input_len = end;
+        status = load_opcodes(unpickler, 1);
+        if (status < 0)
+            goto error;
+        pos = unpickler->next_read_idx;
+        if (status == 1) {
+            size_t i;
+
+            PDATA_POP(unpickler->stack, value);
+            if (value == NULL)
+                goto error;
+            if (PyList_Append(result, value) < 0) {
+                Py_DECREF(value);
+                goto error;
+            }
+            Py_DECREF(value);
+            self->in_pickle = 0;
+            /* Pickles are loaded independently. */
+            for (i = 0; i < unpickler->memo_size; i++)
+                Py_CLEAR(unpickler->memo[i]);
+            unpickler->memo_len = 0;
+        }
+    }
+
+    self->loading = 0;
+    /* Keep the input which could not be loaded yet. */
+    PyBuffer_Release(&unpickler->buffer);
+    unpickler->buffer.buf = NULL;
+    unpickler->input_buffer = NULL;
+    unpickler->input_len = 0;
+    unpickler->next_read_idx = 0;
+    if (PySequence_DelSlice(self->pending, 0, pos) < 0)
+        goto error;
+    self->needed = needed > 0 ? needed : size - pos + 1;
+    return result;
+
+  error:
+    self->loading = 0;
+    Py_DECREF(result);
+    _IncrementalUnpickler_Reset(self);
+    (void)PyByteArray_Resize(self->pending, 0);
+    self->needed = 1;
+    return NULL;
+}
+
+/*[clinic input]
+
+_pickle.IncrementalUnpickler.close
+
+Check that the stream ended at the end of a pickle.
+
+Raise UnpicklingError if a pickle was only partially fed, and reset the
+unpickler for a new stream.
+[clinic start generated code]*/
+
+static PyObject *
+_pickle_IncrementalUnpickler_close_impl(IncrementalUnpicklerObject *self)
+/*[clinic end generated code: output=729eed2e082dc6bb input=2ffdccc2c2193aeb]*/
+{
+    int truncated;
+
+    if (_IncrementalUnpickler_CheckInit(self) < 0 ||
+        _IncrementalUnpickler_CheckNotLoading(self, "close") < 0)
+        return NULL;
+
+    truncated = self->in_pickle || PyByteArray_GET_SIZE(self->pending) > 0;
+    _IncrementalUnpickler_Reset(self);
+    if (PyByteArray_Resize(self->pending, 0) < 0)
+        return NULL;
+    self->needed = 1;
+    if (truncated) {
+        PickleState *st = _Pickle_GetGlobalState();
+        PyErr_SetString(st->UnpicklingError, "pickle data was truncated");
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static struct PyMethodDef IncrementalUnpickler_methods[] = {
+    _PICKLE_INCREMENTALUNPICKLER_FEED_METHODDEF
+    _PICKLE_INCREMENTALUNPICKLER_CLOSE_METHODDEF
+    _PICKLE_UNPICKLER_FIND_CLASS_METHODDEF
+    {NULL, NULL}                /* sentinel */
+};
+
+static void
+IncrementalUnpickler_dealloc(IncrementalUnpicklerObject *self)
+{
+    PyObject_GC_UnTrack((PyObject *)self);
+    Py_XDECREF(self->pending);
+    Unpickler_dealloc(&self->unpickler);
+}
+
+static int
+IncrementalUnpickler_traverse(IncrementalUnpicklerObject *self,
+                              visitproc visit, void *arg)
+{
+    Py_VISIT(self->pending);
+    return Unpickler_traverse(&self->unpickler, visit, arg);
+}
+
+static int
+IncrementalUnpickler_clear(IncrementalUnpicklerObject *self)
+{
+    Py_CLEAR(self->pending);
+    return Unpickler_clear(&self->unpickler);
+}
+
+static PyTypeObject IncrementalUnpickler_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "_pickle.IncrementalUnpickler",     /*tp_name*/
+    sizeof(IncrementalUnpicklerObject), /*tp_basicsize*/
+    0,                                  /*tp_itemsize*/
+    (destructor)IncrementalUnpickler_dealloc, /*tp_dealloc*/
+    0,                                  /*tp_print*/
+    0,                                  /*tp_getattr*/
+    0,                                  /*tp_setattr*/
+    0,                                  /*tp_reserved*/
+    0,                                  /*tp_repr*/
+    0,                                  /*tp_as_number*/
+    0,                                  /*tp_as_sequence*/
+    0,                                  /*tp_as_mapping*/
+    0,                                  /*tp_hash*/
+    0,                                  /*tp_call*/
+    0,                                  /*tp_str*/
+    0,                                  /*tp_getattro*/
+    0,                                  /*tp_setattro*/
+    0,                                  /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC,
+    _pickle_IncrementalUnpickler___init____doc__, /*tp_doc*/
+    (traverseproc)IncrementalUnpickler_traverse, /*tp_traverse*/
+    (inquiry)IncrementalUnpickler_clear, /*tp_clear*/
+    0,                                  /*tp_richcompare*/
+    0,                                  /*tp_weaklistoffset*/
+    0,                                  /*tp_iter*/
+    0,                                  /*tp_iternext*/
+    IncrementalUnpickler_methods,       /*tp_methods*/
+    0,                                  /*tp_members*/
+    0,                                  /*tp_getset*/
+    0,                                  /*tp_base*/
+    0,                                  /*tp_dict*/
+    0,                                  /*tp_descr_get*/
+    0,                                  /*tp_descr_set*/
+    0,                                  /*tp_dictoffset*/
+    _pickle_IncrementalUnpickler___init__, /*tp_init*/
+    PyType_GenericAlloc,                /*tp_alloc*/
+    PyType_GenericNew,                  /*tp_new*/
+    PyObject_GC_Del,                    /*tp_free*/
+    0,                                  /*tp_is_gc*/
+};
+
 /*[clinic input]
 
 _pickle.dump
@@ -7171,6 +8222,8 @@ _pickle.dump
   protocol: object = NULL
   *
   fix_imports: bool = True
+  buffer_callback: object = None
+  memoize: bool = True
 
 Write a pickled representation of obj to the open file object file.
 
@@ -7178,7 +8231,7 @@ This is equivalent to ``Pickler(file, protocol).dump(obj)``, but may
 be more efficient.
 
 The optional *protocol* argument tells the pickler to use the given
-protocol; supported protocols are 0, 1, 2, 3 and 4.  The default
+protocol; supported protocols are 0, 1, 2, 3, 4 and 5.  The default
 protocol is 4. It was introduced in Python 3.4, it is incompatible
 with previous versions.
 
@@ -7194,12 +8247,18 @@ this interface.
 If *fix_imports* is True and protocol is less than 3, pickle will try
 to map the new Python 3 names to the old module names used in Python
 2, so that the pickle data stream is readable with Python 2.
+
+If *buffer_callback* is not None, it is called with the out-of-band
+buffer candidates, as for Pickler.
+
+If *memoize* is false, objects are not memoized, as for Pickler.
 [clinic start generated code]*/
 
 static PyObject *
 _pickle_dump_impl(PyObject *module, PyObject *obj, PyObject *file,
-                  PyObject *protocol, int fix_imports)
-/*[clinic end generated code: output=a4774d5fde7d34de input=93f1408489a87472]*/
+                  PyObject *protocol, int fix_imports,
+                  PyObject *buffer_callback, int memoize)
+/*[clinic end generated code: output=7c0107c92fde0822 input=fa98e961eb42d0b1]*/
 {
     PicklerObject *pickler = _Pickler_New();
 
@@ -7212,6 +8271,10 @@ _pickle_dump_impl(PyObject *module, PyObject *obj, PyObject *file,
     if (_Pickler_SetOutputStream(pickler, file) < 0)
         goto error;
 
+    if (_Pickler_SetBufferCallback(pickler, buffer_callback) < 0)
+        goto error;
+    pickler->fast = !memoize;
+
     if (dump(pickler, obj) < 0)
         goto error;
 
@@ -7234,11 +8297,13 @@ _pickle.dumps
   protocol: object = NULL
   *
   fix_imports: bool = True
+  buffer_callback: object = None
+  memoize: bool = True
 
 Return the pickled representation of the object as a bytes object.
 
 The optional *protocol* argument tells the pickler to use the given
-protocol; supported protocols are 0, 1, 2, 3 and 4.  The default
+protocol; supported protocols are 0, 1, 2, 3, 4 and 5.  The default
 protocol is 4. It was introduced in Python 3.4, it is incompatible
 with previous versions.
 
@@ -7249,12 +8314,17 @@ version of Python needed to read the pickle produced.
 If *fix_imports* is True and *protocol* is less than 3, pickle will
 try to map the new Python 3 names to the old module names used in
 Python 2, so that the pickle data stream is readable with Python 2.
+
+If *buffer_callback* is not None, it is called with the out-of-band
+buffer candidates, as for Pickler.
+
+If *memoize* is false, objects are not memoized, as for Pickler.
 [clinic start generated code]*/
 
 static PyObject *
 _pickle_dumps_impl(PyObject *module, PyObject *obj, PyObject *protocol,
-                   int fix_imports)
-/*[clinic end generated code: output=d75d5cda456fd261 input=b6efb45a7d19b5ab]*/
+                   int fix_imports, PyObject *buffer_callback, int memoize)
+/*[clinic end generated code: output=790234514c393629 input=1b0a38cbf5de6b59]*/
 {
     PyObject *result;
     PicklerObject *pickler = _Pickler_New();
@@ -7265,6 +8335,10 @@ _pickle_dumps_impl(PyObject *module, PyObject *obj, PyObject *protocol,
     if (_Pickler_SetProtocol(pickler, protocol, fix_imports) < 0)
         goto error;
 
+    if (_Pickler_SetBufferCallback(pickler, buffer_callback) < 0)
+        goto error;
+    pickler->fast = !memoize;
+
     if (dump(pickler, obj) < 0)
         goto error;
 
@@ -7286,6 +8360,7 @@ _pickle.load
   fix_imports: bool = True
   encoding: str = 'ASCII'
   errors: str = 'strict'
+  buffers: object(c_default="NULL") = ()
 
 Read and return an object from the pickle data stored in a file.
 
@@ -7310,12 +8385,18 @@ map the old Python 2 names to the new names used in Python 3.  The
 instances pickled by Python 2; these default to 'ASCII' and 'strict',
 respectively.  The *encoding* can be 'bytes' to read these 8-bit
 string instances as bytes objects.
+
+If *buffers* is not None, it is an iterable of buffer-enabled objects
+that is consumed each time the pickle stream references an out-of-band
+buffer view.  Such buffers were given in order to the *buffer_callback*
+of a Pickler object.
 [clinic start generated code]*/
 
 static PyObject *
 _pickle_load_impl(PyObject *module, PyObject *file, int fix_imports,
-                  const char *encoding, const char *errors)
-/*[clinic end generated code: output=69e298160285199e input=01b44dd3fc07afa7]*/
+                  const char *encoding, const char *errors,
+                  PyObject *buffers)
+/*[clinic end generated code: output=250452d141c23e76 input=ecdebf276b6925d1]*/
 {
     PyObject *result;
     UnpicklerObject *unpickler = _Unpickler_New();
@@ -7329,6 +8410,9 @@ _pickle_load_impl(PyObject *module, PyObject *file, int fix_imports,
     if (_Unpickler_SetInputEncoding(unpickler, encoding, errors) < 0)
         goto error;
 
+    if (_Unpickler_SetBuffers(unpickler, buffers) < 0)
+        goto error;
+
     unpickler->fix_imports = fix_imports;
 
     result = load(unpickler);
@@ -7349,6 +8433,7 @@ _pickle.loads
   fix_imports: bool = True
   encoding: str = 'ASCII'
   errors: str = 'strict'
+  buffers: object(c_default="NULL") = ()
 
 Read and return an object from the given pickle data.
 
@@ -7364,12 +8449,18 @@ map the old Python 2 names to the new names used in Python 3.  The
 instances pickled by Python 2; these default to 'ASCII' and 'strict',
 respectively.  The *encoding* can be 'bytes' to read these 8-bit
 string instances as bytes objects.
+
+If *buffers* is not None, it is an iterable of buffer-enabled objects
+that is consumed each time the pickle stream references an out-of-band
+buffer view.  Such buffers were given in order to the *buffer_callback*
+of a Pickler object.
 [clinic start generated code]*/
 
 static PyObject *
 _pickle_loads_impl(PyObject *module, PyObject *data, int fix_imports,
-                   const char *encoding, const char *errors)
-/*[clinic end generated code: output=1e7cb2343f2c440f input=70605948a719feb9]*/
+                   const char *encoding, const char *errors,
+                   PyObject *buffers)
+/*[clinic end generated code: output=82ac1e6b588e6d02 input=f92263835286785b]*/
 {
     PyObject *result;
     UnpicklerObject *unpickler = _Unpickler_New();
@@ -7383,6 +8474,9 @@ _pickle_loads_impl(PyObject *module, PyObject *data, int fix_imports,
     if (_Unpickler_SetInputEncoding(unpickler, encoding, errors) < 0)
         goto error;
 
+    if (_Unpickler_SetBuffers(unpickler, buffers) < 0)
+        goto error;
+
     unpickler->fix_imports = fix_imports;
 
     result = load(unpickler);
@@ -7469,6 +8563,10 @@ PyInit__pickle(void)
         return NULL;
     if (PyType_Ready(&UnpicklerMemoProxyType) < 0)
         return NULL;
+    if (PyType_Ready(&PickleBuffer_Type) < 0)
+        return NULL;
+    if (PyType_Ready(&IncrementalUnpickler_Type) < 0)
+        return NULL;
 
     /* Create the module and add the functions. */
     m = PyModule_Create(&_picklemodule);
@@ -7481,6 +8579,14 @@ PyInit__pickle(void)
     Py_INCREF(&Unpickler_Type);
     if (PyModule_AddObject(m, "Unpickler", (PyObject *)&Unpickler_Type) < 0)
         return NULL;
+    Py_INCREF(&PickleBuffer_Type);
+    if (PyModule_AddObject(m, "PickleBuffer",
+                           (PyObject *)&PickleBuffer_Type) < 0)
+        return NULL;
+    Py_INCREF(&IncrementalUnpickler_Type);
+    if (PyModule_AddObject(m, "IncrementalUnpickler",
+                           (PyObject *)&IncrementalUnpickler_Type) < 0)
+        return NULL;
 
     st = _Pickle_GetState(m);
 
@@ -1745,6 +1745,71 @@ Struct_iter_unpack(PyStructObject *self, PyObject *buffer)
 }
 
 
+/* Pack the value v of the item of code at res.  Return 0 on success, -1
+   on error. */
+static int
+s_pack_item(const formatcode *code, char *res, PyObject *v)
+{
+    const formatdef *e = code->fmtdef;
+
+    if (e->format == 's') {
+        Py_ssize_t n;
+        int isstring;
+        void *p;
+        isstring = PyBytes_Check(v);
+        if (!isstring && !PyByteArray_Check(v)) {
+            PyErr_SetString(StructError,
+                            "argument for 's' must be a bytes object");
+            return -1;
+        }
+        if (isstring) {
+            n = PyBytes_GET_SIZE(v);
+            p = PyBytes_AS_STRING(v);
+        }
+        else {
+            n = PyByteArray_GET_SIZE(v);
+            p = PyByteArray_AS_STRING(v);
+        }
+        if (n > code->size)
+            n = code->size;
+        if (n > 0)
+            memcpy(res, p, n);
+    } else if (e->format == 'p') {
+        Py_ssize_t n;
+        int isstring;
+        void *p;
+        isstring = PyBytes_Check(v);
+        if (!isstring && !PyByteArray_Check(v)) {
+            PyErr_SetString(StructError,
+                            "argument for 'p' must be a bytes object");
+            return -1;
+        }
+        if (isstring) {
+            n = PyBytes_GET_SIZE(v);
+            p = PyBytes_AS_STRING(v);
+        }
+        else {
+            n = PyByteArray_GET_SIZE(v);
+            p = PyByteArray_AS_STRING(v);
+        }
+        if (n > (code->size - 1))
+            n = code->size - 1;
+        if (n > 0)
+            memcpy(res + 1, p, n);
+        if (n > 255)
+            n = 255;
+        *res = Py_SAFE_DOWNCAST(n, Py_ssize_t, unsigned char);
+    } else {
+        if (e->pack(res, v, e) < 0) {
+            if (PyLong_Check(v) && PyErr_ExceptionMatches(PyExc_OverflowError))
+                PyErr_SetString(StructError,
+                                "int too large to convert");
+            return -1;
+        }
+    }
+    return 0;
+}
+
 /*
  * Guts of the pack function.
  *
@@ -1766,66 +1831,11 @@ s_pack_internal(PyStructObject *soself, PyObject *const *args, int offset, char*
     memset(buf, '\0', soself->s_size);
     i = offset;
     for (code = soself->s_codes; code->fmtdef != NULL; code++) {
-        const formatdef *e = code->fmtdef;
         char *res = buf + code->offset;
         Py_ssize_t j = code->repeat;
         while (j--) {
-            PyObject *v = args[i++];
-            if (e->format == 's') {
-                Py_ssize_t n;
-                int isstring;
-                void *p;
-                isstring = PyBytes_Check(v);
-                if (!isstring && !PyByteArray_Check(v)) {
-                    PyErr_SetString(StructError,
-                                    "argument for 's' must be a bytes object");
-                    return -1;
-                }
-                if (isstring) {
-                    n = PyBytes_GET_SIZE(v);
-                    p = PyBytes_AS_STRING(v);
-                }
-                else {
-                    n = PyByteArray_GET_SIZE(v);
-                    p = PyByteArray_AS_STRING(v);
-                }
-                if (n > code->size)
-                    n = code->size;
-                if (n > 0)
-                    memcpy(res, p, n);
-            } else if (e->format == 'p') {
-                Py_ssize_t n;
-                int isstring;
-                void *p;
-                isstring = PyBytes_Check(v);
-                if (!isstring && !PyByteArray_Check(v)) {
-                    PyErr_SetString(StructError,
-                                    "argument for 'p' must be a bytes object");
-                    return -1;
-                }
-                if (isstring) {
-                    n = PyBytes_GET_SIZE(v);
-                    p = PyBytes_AS_STRING(v);
-                }
-                else {
-                    n = PyByteArray_GET_SIZE(v);
-                    p = PyByteArray_AS_STRING(v);
-                }
-                if (n > (code->size - 1))
-                    n = code->size - 1;
-                if (n > 0)
-                    memcpy(res + 1, p, n);
-                if (n > 255)
-                    n = 255;
-                *res = Py_SAFE_DOWNCAST(n, Py_ssize_t, unsigned char);
-            } else {
-                if (e->pack(res, v, e) < 0) {
-                    if (PyLong_Check(v) && PyErr_ExceptionMatches(PyExc_OverflowError))
-                        PyErr_SetString(StructError,
-                                        "int too large to convert");
-                    return -1;
-                }
-            }
+            if (s_pack_item(code, res, args[i++]) < 0)
+                return -1;
             res += code->size;
         }
     }
@@ -1974,6 +1984,575 @@ s_pack_into(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
     Py_RETURN_NONE;
 }
 
+/*
+ * Columns.
+ *
+ * unpack_columns() and pack_columns() convert between an array of records
+ * and one array per field, holding the values of the field as the native C
+ * type of the same size (float for 'e').  The fields are converted a block
+ * of records at a time, so the records are read from the cache once for
+ * all the fields.
+ */
+
+#define COLUMN_BLOCK_SIZE (64 * 1024)   /* bytes of records per block */
+
+enum column_kind {
+    COLUMN_COPY,        /* same byte order */
+    COLUMN_SWAP,        /* of the other byte order */
+    COLUMN_BOOL,
+    COLUMN_HALF,        /* 'e' to float */
+    COLUMN_FLOAT,       /* standard 'f' to float */
+    COLUMN_DOUBLE,      /* standard 'd' to double */
+    COLUMN_BYTES        /* 's' and 'p', a list of bytes objects */
+};
+
+typedef struct {
+    const formatcode *code;
+    Py_ssize_t offset;          /* of the field in the record */
+    Py_ssize_t itemsize;        /* of the values in the column */
+    enum column_kind kind;
+    int le;                     /* byte order of standard floats */
+    char format[2];             /* of the column's memoryview */
+} column;
+
+/* The native format code of an integer of the given size and signedness */
+static char
+column_int_format(char c, Py_ssize_t size)
+{
+    int is_signed = (c == 'b' || c == 'h' || c == 'i' || c == 'l' ||
+                     c == 'q');
+    switch (size) {
+    case 1: return is_signed ? 'b' : 'B';
+    case 2: return is_signed ? 'h' : 'H';
+#if SIZEOF_INT == 4
+    case 4: return is_signed ? 'i' : 'I';
+#else
+    case 4: return is_signed ? 'l' : 'L';
+#endif
+    default: return is_signed ? 'q' : 'Q';
+    }
+}
+
+/* Return non-zero if float and double are IEEE 754 binary32 and binary64,
+   so that the standard 'f' and 'd' items can be copied as they are, or
+   with their bytes reversed.  The values are those floatobject.c uses to
+   find the formats. */
+static int
+native_ieee_floats(void)
+{
+    static int result = -1;
+
+    if (result < 0) {
+        double x = 9006104071832581.0;
+        float y = 16711938.0;
+        unsigned char px[8], py[4];
+        result = (_PyFloat_Pack8(x, px, PY_LITTLE_ENDIAN) == 0 &&
+                  memcmp(&x, px, sizeof(x)) == 0 &&
+                  _PyFloat_Pack4(y, py, PY_LITTLE_ENDIAN) == 0 &&
+                  memcmp(&y, py, sizeof(y)) == 0);
+    }
+    return result;
+}
+
+/* Fill in the s_len columns of the struct */
+static void
+s_get_columns(PyStructObject *self, column *columns)
+{
+    formatcode *code;
+    column *col = columns;
+    int ieee = native_ieee_floats();
+
+    for (code = self->s_codes; code->fmtdef != NULL; code++) {
+        const formatdef *e = code->fmtdef;
+        int native = (e >= native_table &&
+                      e < native_table + Py_ARRAY_LENGTH(native_table));
+        int le = native ? PY_LITTLE_ENDIAN :
+                 (e >= lilendian_table &&
+                  e < lilendian_table + Py_ARRAY_LENGTH(lilendian_table));
+        Py_ssize_t j;
+
+        for (j = 0; j < code->repeat; j++, col++) {
+            col->code = code;
+            col->offset = code->offset + j * code->size;
+            col->itemsize = code->size;
+            col->le = le;
+            col->format[0] = e->format;
+            col->format[1] = '\0';
+            switch (e->format) {
+            case 's':
+            case 'p':
+                col->kind = COLUMN_BYTES;
+                break;
+            case '?':
+                col->kind = COLUMN_BOOL;
+                col->itemsize = sizeof(_Bool);
+                break;
+            case 'e':
+                col->kind = COLUMN_HALF;
+                col->itemsize = sizeof(float);
+                col->format[0] = 'f';
+                break;
+            case 'f':
+            case 'd':
+                if (native || (ieee && le == PY_LITTLE_ENDIAN))
+                    col->kind = COLUMN_COPY;
+                else if (ieee)
+                    col->kind = COLUMN_SWAP;
+                else
+                    col->kind = e->format == 'f' ? COLUMN_FLOAT
+                                                 : COLUMN_DOUBLE;
+                col->itemsize = e->format == 'f' ? sizeof(float)
+                                                 : sizeof(double);
+                break;
+            default:
+                /* integers, 'c' and 'P' */
+                col->kind = (native || le == PY_LITTLE_ENDIAN) ?
+                            COLUMN_COPY : COLUMN_SWAP;
+                if (!native && e->format != 'c')
+                    col->format[0] = column_int_format(e->format,
+                                                       code->size);
+                break;
+            }
+        }
+    }
+}
+
+/* Copy n items of size bytes from src to dst, which are dstep and sstep
+   bytes apart, reversing their bytes if swap is true.  The sizes of the
+   values are constants in each loop so that the copies are inlined. */
+#define COPY_ITEMS(SIZE) \
+    for (i = 0; i < n; i++, dst += dstep, src += sstep) { \
+        if (swap) { \
+            for (k = 0; k < SIZE; k++) \
+                dst[k] = src[SIZE - 1 - k]; \
+        } \
+        else \
+            memcpy(dst, src, SIZE); \
+    }
+
+static void
+copy_items(char *dst, Py_ssize_t dstep, const char *src, Py_ssize_t sstep,
+           Py_ssize_t n, Py_ssize_t size, int swap)
+{
+    Py_ssize_t i, k;
+
+    switch (size) {
+    case 1: COPY_ITEMS(1); break;
+    case 2: COPY_ITEMS(2); break;
+    case 4: COPY_ITEMS(4); break;
+    case 8: COPY_ITEMS(8); break;
+    default: COPY_ITEMS(size); break;
+    }
+}
+
+#undef COPY_ITEMS
+
+/* Unpack the field of n records at src into the column at dst, a list for
+   COLUMN_BYTES.  Return 0 on success, -1 on error. */
+static int
+unpack_column(const column *col, const char *src, Py_ssize_t stride,
+              Py_ssize_t n, char *dst, PyObject *list, Py_ssize_t start)
+{
+    const formatcode *code = col->code;
+    Py_ssize_t i;
+
+    src += col->offset;
+    switch (col->kind) {
+    case COLUMN_COPY:
+    case COLUMN_SWAP:
+        copy_items(dst, col->itemsize, src, stride, n, code->size,
+                   col->kind == COLUMN_SWAP);
+        break;
+    case COLUMN_BOOL:
+        for (i = 0; i < n; i++, src += stride) {
+            _Bool x = 0;
+            Py_ssize_t k;
+            for (k = 0; k < code->size; k++)
+                x |= (src[k] != 0);
+            memcpy(dst + i * sizeof(_Bool), &x, sizeof(_Bool));
+        }
+        break;
+    case COLUMN_HALF:
+    case COLUMN_FLOAT:
+    case COLUMN_DOUBLE:
+        for (i = 0; i < n; i++, src += stride) {
+            const unsigned char *p = (const unsigned char *)src;
+            double x;
+            if (col->kind == COLUMN_HALF)
+                x = _PyFloat_Unpack2(p, col->le);
+            else if (col->kind == COLUMN_FLOAT)
+                x = _PyFloat_Unpack4(p, col->le);
+            else
+                x = _PyFloat_Unpack8(p, col->le);
+            if (x == -1.0 && PyErr_Occurred())
+                return -1;
+            if (col->kind == COLUMN_DOUBLE)
+                memcpy(dst + i * sizeof(double), &x, sizeof(double));
+            else {
+                float y = (float)x;
+                memcpy(dst + i * sizeof(float), &y, sizeof(float));
+            }
+        }
+        break;
+    case COLUMN_BYTES:
+        for (i = 0; i < n; i++, src += stride) {
+            PyObject *v;
+            if (code->fmtdef->format == 's') {
+                v = PyBytes_FromStringAndSize(src, code->size);
+            } else {
+                Py_ssize_t len = *(unsigned char*)src;
+                if (len >= code->size)
+                    len = code->size - 1;
+                v = PyBytes_FromStringAndSize(src + 1, len);
+            }
+            if (v == NULL)
+                return -1;
+            PyList_SET_ITEM(list, start + i, v);
+        }
+        break;
+    }
+    return 0;
+}
+
+/* Pack the column at src into the field of n records at dst.  Return 0 on
+   success, -1 on error. */
+static int
+pack_column(const column *col, const char *src, Py_ssize_t n,
+            char *dst, Py_ssize_t stride)
+{
+    const formatcode *code = col->code;
+    Py_ssize_t i;
+
+    dst += col->offset;
+    switch (col->kind) {
+    case COLUMN_COPY:
+    case COLUMN_SWAP:
+        copy_items(dst, stride, src, col->itemsize, n, code->size,
+                   col->kind == COLUMN_SWAP);
+        break;
+    case COLUMN_BOOL:
+        for (i = 0; i < n; i++, dst += stride) {
+            _Bool x;
+            memcpy(&x, src + i * sizeof(_Bool), sizeof(_Bool));
+            *dst = (x != 0);
+        }
+        break;
+    case COLUMN_HALF:
+    case COLUMN_FLOAT:
+    case COLUMN_DOUBLE:
+        for (i = 0; i < n; i++, dst += stride) {
+            unsigned char *p = (unsigned char *)dst;
+            int res;
+            if (col->kind == COLUMN_DOUBLE) {
+                double x;
+                memcpy(&x, src + i * sizeof(double), sizeof(double));
+                res = _PyFloat_Pack8(x, p, col->le);
+            }
+            else {
+                float x;
+                memcpy(&x, src + i * sizeof(float), sizeof(float));
+                if (col->kind == COLUMN_HALF)
+                    res = _PyFloat_Pack2(x, p, col->le);
+                else
+                    res = _PyFloat_Pack4(x, p, col->le);
+            }
+            if (res < 0)
+                return -1;
+        }
+        break;
+    case COLUMN_BYTES:
+        Py_UNREACHABLE();
+    }
+    return 0;
+}
+
+/*[clinic input]
+Struct.unpack_columns
+
+    buffer: Py_buffer
+    offset: Py_ssize_t = 0
+    count: Py_ssize_t = -1
+
+Return a tuple of columns of values unpacked from consecutive records.
+
+Unpacks count records starting at position offset, or all of them if count
+is negative, in which case the buffer's size in bytes, starting at offset,
+must be a multiple of Struct.size.  Each field gives a memoryview of the
+native C type of the same size; 's' and 'p' fields give lists of bytes.
+
+See help(struct) for more on format strings.
+[clinic start generated code]*/
+
+static PyObject *
+Struct_unpack_columns_impl(PyStructObject *self, Py_buffer *buffer,
+                           Py_ssize_t offset, Py_ssize_t count)
+/*[clinic end generated code: output=e570c287bf80b7c2 input=6baf8f85c3868403]*/
+{
+    column *columns;
+    char **data = NULL;
+    PyObject *result = NULL;
+    Py_ssize_t i, n, start, block;
+
+    assert(self->s_codes != NULL);
+    if (self->s_size == 0) {
+        PyErr_SetString(StructError,
+                        "cannot unpack columns with a struct of length 0");
+        return NULL;
+    }
+    if (offset < 0) {
+        if (offset + buffer->len < 0) {
+            PyErr_Format(StructError,
+                         "offset %zd out of range for %zd-byte buffer",
+                         offset, buffer->len);
+            return NULL;
+        }
+        offset += buffer->len;
+    }
+    if (offset > buffer->len) {
+        PyErr_Format(StructError,
+                     "offset %zd out of range for %zd-byte buffer",
+                     offset, buffer->len);
+        return NULL;
+    }
+    if (count < 0) {
+        if ((buffer->len - offset) % self->s_size != 0) {
+            PyErr_Format(StructError,
+                         "unpacking columns requires a buffer of "
+                         "a multiple of %zd bytes",
+                         self->s_size);
+            return NULL;
+        }
+        n = (buffer->len - offset) / self->s_size;
+    }
+    else {
+        n = count;
+        if ((buffer->len - offset) / self->s_size < n) {
+            PyErr_Format(StructError,
+                         "not enough data to unpack %zd records of %zd bytes "
+                         "at offset %zd (actual buffer size is %zd)",
+                         n, self->s_size, offset, buffer->len);
+            return NULL;
+        }
+    }
+
+    columns = PyMem_New(column, self->s_len);
+    data = PyMem_New(char *, self->s_len);
+    if (columns == NULL || data == NULL) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    s_get_columns(self, columns);
+
+    result = PyTuple_New(self->s_len);
+    if (result == NULL)
+        goto done;
+    for (i = 0; i < self->s_len; i++) {
+        PyObject *col;
+        if (columns[i].kind == COLUMN_BYTES) {
+            col = PyList_New(n);
+            data[i] = NULL;
+        }
+        else {
+            if (n > PY_SSIZE_T_MAX / columns[i].itemsize) {
+                PyErr_NoMemory();
+                goto error;
+            }
+            col = PyByteArray_FromStringAndSize(NULL, n * columns[i].itemsize);
+            if (col != NULL)
+                data[i] = PyByteArray_AS_STRING(col);
+        }
+        if (col == NULL)
+            goto error;
+        PyTuple_SET_ITEM(result, i, col);
+    }
+
+    block = Py_MAX(1, COLUMN_BLOCK_SIZE / self->s_size);
+    for (start = 0; start < n; start += block) {
+        const char *src = (const char *)buffer->buf + offset +
+                          start * self->s_size;
+        Py_ssize_t m = Py_MIN(block, n - start);
+        for (i = 0; i < self->s_len; i++) {
+            char *dst = NULL;
+            if (data[i] != NULL)
+                dst = data[i] + start * columns[i].itemsize;
+            if (unpack_column(&columns[i], src, self->s_size, m, dst,
+                              PyTuple_GET_ITEM(result, i), start) < 0)
+                goto error;
+        }
+    }
+
+    /* Wrap the bytearrays in memoryviews of the values */
+    for (i = 0; i < self->s_len; i++) {
+        PyObject *view, *cast;
+        if (columns[i].kind == COLUMN_BYTES)
+            continue;
+        view = PyMemoryView_FromObject(PyTuple_GET_ITEM(result, i));
+        if (view == NULL)
+            goto error;
+        cast = PyObject_CallMethod(view, "cast", "s", columns[i].format);
+        Py_DECREF(view);
+        if (cast == NULL)
+            goto error;
+        Py_SETREF(PyTuple_GET_ITEM(result, i), cast);
+    }
+    goto done;
+
+  error:
+    Py_CLEAR(result);
+  done:
+    PyMem_Free(columns);
+    PyMem_Free(data);
+    return result;
+}
+
+/* Return non-zero if the values of a buffer of the given format and item
+   size can be copied to or from the column as they are. */
+static int
+column_format_matches(const column *col, const char *format,
+                      Py_ssize_t itemsize)
+{
+    char c = col->format[0];
+
+    if (format == NULL)
+        format = "B";
+    if (format[0] == '@')
+        format++;
+    if (format[0] == '\0' || format[1] != '\0' || itemsize != col->itemsize)
+        return 0;
+    if (format[0] == c)
+        return 1;
+    /* integers of the same size and signedness */
+    if (strchr("bhilqn", format[0]) != NULL && strchr("bhilqn", c) != NULL)
+        return 1;
+    if (strchr("BHILQN", format[0]) != NULL && strchr("BHILQN", c) != NULL)
+        return 1;
+    return c == 'c' && format[0] == 'B';
+}
+
+PyDoc_STRVAR(s_pack_columns__doc__,
+"S.pack_columns(column1, column2, ...) -> bytes\n\
+\n\
+Return a bytes object containing records packed from the values of\n\
+the columns, one per field, according to the format string S.format.\n\
+The columns must have the same length.  Columns of the types returned by\n\
+S.unpack_columns(), such as memoryviews and array.arrays, are copied\n\
+directly; other columns are sequences of values.  See help(struct) for\n\
+more on format strings.");
+
+static PyObject *
+s_pack_columns(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyStructObject *soself = (PyStructObject *)self;
+    column *columns;
+    Py_buffer *views = NULL;
+    PyObject **seqs = NULL;
+    PyObject *result = NULL;
+    Py_ssize_t i, n = 0, start, block;
+
+    assert(PyStruct_Check(self));
+    assert(soself->s_codes != NULL);
+    if (nargs != soself->s_len) {
+        PyErr_Format(StructError,
+            "pack_columns expected %zd columns for packing (got %zd)",
+            soself->s_len, nargs);
+        return NULL;
+    }
+
+    columns = PyMem_New(column, nargs);
+    views = PyMem_New(Py_buffer, nargs);
+    seqs = PyMem_New(PyObject *, nargs);
+    if (columns == NULL || views == NULL || seqs == NULL) {
+        PyMem_Free(columns);
+        PyMem_Free(views);
+        PyMem_Free(seqs);
+        return PyErr_NoMemory();
+    }
+    s_get_columns(soself, columns);
+    for (i = 0; i < nargs; i++) {
+        views[i].obj = NULL;
+        seqs[i] = NULL;
+    }
+
+    /* Use the buffers whose values can be copied, and the other columns
+       as sequences */
+    for (i = 0; i < nargs; i++) {
+        Py_ssize_t len;
+        if (columns[i].kind != COLUMN_BYTES && PyObject_CheckBuffer(args[i])) {
+            if (PyObject_GetBuffer(args[i], &views[i],
+                                   PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) < 0)
+                PyErr_Clear();
+            else if (views[i].ndim != 1 ||
+                     !column_format_matches(&columns[i], views[i].format,
+                                            views[i].itemsize))
+                PyBuffer_Release(&views[i]);
+        }
+        if (views[i].obj != NULL)
+            len = views[i].shape[0];
+        else {
+            /* A tuple, as packing the values may run code changing them */
+            seqs[i] = PySequence_Tuple(args[i]);
+            if (seqs[i] == NULL)
+                goto done;
+            len = PyTuple_GET_SIZE(seqs[i]);
+        }
+        if (i == 0)
+            n = len;
+        else if (len != n) {
+            PyErr_Format(StructError,
+                         "pack_columns expected columns of the same length "
+                         "(got %zd and %zd)", n, len);
+            goto done;
+        }
+    }
+
+    if (n > 0 && soself->s_size > PY_SSIZE_T_MAX / n) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    result = PyBytes_FromStringAndSize(NULL, n * soself->s_size);
+    if (result == NULL)
+        goto done;
+    memset(PyBytes_AS_STRING(result), '\0', n * soself->s_size);
+
+    block = Py_MAX(1, COLUMN_BLOCK_SIZE / Py_MAX(soself->s_size, 1));
+    for (start = 0; start < n; start += block) {
+        char *dst = PyBytes_AS_STRING(result) + start * soself->s_size;
+        Py_ssize_t m = Py_MIN(block, n - start);
+        for (i = 0; i < nargs; i++) {
+            if (views[i].obj != NULL) {
+                const char *src = (const char *)views[i].buf +
+                                  start * columns[i].itemsize;
+                if (pack_column(&columns[i], src, m, dst,
+                                soself->s_size) < 0)
+                    goto error;
+            }
+            else {
+                PyObject **items = &PyTuple_GET_ITEM(seqs[i], start);
+                char *res = dst + columns[i].offset;
+                Py_ssize_t j;
+                for (j = 0; j < m; j++, res += soself->s_size) {
+                    if (s_pack_item(columns[i].code, res, items[j]) < 0)
+                        goto error;
+                }
+            }
+        }
+    }
+    goto done;
+
+  error:
+    Py_CLEAR(result);
+  done:
+    for (i = 0; i < nargs; i++) {
+        if (views[i].obj != NULL)
+            PyBuffer_Release(&views[i]);
+        Py_XDECREF(seqs[i]);
+    }
+    PyMem_Free(columns);
+    PyMem_Free(views);
+    PyMem_Free(seqs);
+    return result;
+}
+
 static PyObject *
 s_get_format(PyStructObject *self, void *unused)
 {
@@ -2008,8 +2587,10 @@ static struct PyMethodDef s_methods[] = {
     STRUCT_ITER_UNPACK_METHODDEF
     {"pack",            (PyCFunction)(void(*)(void))s_pack, METH_FASTCALL, s_pack__doc__},
     {"pack_into",       (PyCFunction)(void(*)(void))s_pack_into, METH_FASTCALL, s_pack_into__doc__},
+    {"pack_columns",    (PyCFunction)(void(*)(void))s_pack_columns, METH_FASTCALL, s_pack_columns__doc__},
     STRUCT_UNPACK_METHODDEF
     STRUCT_UNPACK_FROM_METHODDEF
+    STRUCT_UNPACK_COLUMNS_METHODDEF
     {"__sizeof__",      (PyCFunction)s_sizeof, METH_NOARGS, s_sizeof__doc__},
     {NULL,       NULL}          /* sentinel */
 };
@@ -2260,14 +2841,65 @@ iter_unpack_impl(PyObject *module, PyStructObject *s_object,
     return Struct_iter_unpack(s_object, buffer);
 }
 
+PyDoc_STRVAR(pack_columns_doc,
+"pack_columns(format, column1, column2, ...) -> bytes\n\
+\n\
+Return a bytes object containing records packed from the values of\n\
+the columns, one per field, according to the format string.  See\n\
+Struct.pack_columns() and help(struct) for more.");
+
+static PyObject *
+pack_columns(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *s_object = NULL;
+    PyObject *format, *result;
+
+    if (nargs == 0) {
+        PyErr_SetString(PyExc_TypeError, "missing format argument");
+        return NULL;
+    }
+    format = args[0];
+
+    if (!cache_struct_converter(format, (PyStructObject **)&s_object)) {
+        return NULL;
+    }
+    result = s_pack_columns(s_object, args + 1, nargs - 1);
+    Py_DECREF(s_object);
+    return result;
+}
+
+/*[clinic input]
+unpack_columns
+
+    format as s_object: cache_struct
+    /
+    buffer: Py_buffer
+    offset: Py_ssize_t = 0
+    count: Py_ssize_t = -1
+
+Return a tuple of columns of values unpacked from consecutive records.
+
+See Struct.unpack_columns() and help(struct) for more.
+[clinic start generated code]*/
+
+static PyObject *
+unpack_columns_impl(PyObject *module, PyStructObject *s_object,
+                    Py_buffer *buffer, Py_ssize_t offset, Py_ssize_t count)
+/*[clinic end generated code: output=39d8a58295a60053 input=0c1971243a2cf728]*/
+{
+    return Struct_unpack_columns_impl(s_object, buffer, offset, count);
+}
+
 static struct PyMethodDef module_functions[] = {
     _CLEARCACHE_METHODDEF
     CALCSIZE_METHODDEF
     ITER_UNPACK_METHODDEF
     {"pack",            (PyCFunction)(void(*)(void))pack, METH_FASTCALL,   pack_doc},
     {"pack_into",       (PyCFunction)(void(*)(void))pack_into, METH_FASTCALL,   pack_into_doc},
+    {"pack_columns",    (PyCFunction)(void(*)(void))pack_columns, METH_FASTCALL,   pack_columns_doc},
     UNPACK_METHODDEF
     UNPACK_FROM_METHODDEF
+    UNPACK_COLUMNS_METHODDEF
     {NULL,       NULL}          /* sentinel */
 };
 
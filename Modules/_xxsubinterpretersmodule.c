@@ -488,20 +488,81 @@ _channelqueue_put(_channelqueue *queue, _PyCrossInterpreterData *data)
     return 0;
 }
 
-static _PyCrossInterpreterData *
-_channelqueue_get(_channelqueue *queue)
+// Build a chain of items for the given data outside of the channel lock,
+// so that it can be added to a queue with a single _channelqueue_put_chain().
+static _channelitem *
+_channelitem_new_chain(_PyCrossInterpreterData **datas, Py_ssize_t count,
+                       _channelitem **plast)
+{
+    _channelitem *first = NULL;
+    _channelitem *last = NULL;
+    for (Py_ssize_t i = 0; i < count; i++) {
+        _channelitem *item = _channelitem_new();
+        if (item == NULL) {
+            // The caller still owns the data.
+            for (_channelitem *cur = first; cur != NULL; cur = cur->next) {
+                cur->data = NULL;
+            }
+            _channelitem_free_all(first);
+            return NULL;
+        }
+        item->data = datas[i];
+        if (first == NULL) {
+            first = item;
+        }
+        else {
+            last->next = item;
+        }
+        last = item;
+    }
+    *plast = last;
+    return first;
+}
+
+static void
+_channelqueue_put_chain(_channelqueue *queue, _channelitem *first,
+                        _channelitem *last, Py_ssize_t count)
 {
-    _channelitem *item = queue->first;
-    if (item == NULL) {
+    if (first == NULL) {
+        return;
+    }
+    queue->count += count;
+    if (queue->first == NULL) {
+        queue->first = first;
+    }
+    else {
+        queue->last->next = first;
+    }
+    queue->last = last;
+}
+
+// Detach up to "max" items from the front of the queue.  The items are
+// returned as a chain and must be released by the caller (ideally after
+// the channel lock has been released).
+static _channelitem *
+_channelqueue_get_chain(_channelqueue *queue, Py_ssize_t max,
+                        Py_ssize_t *pcount)
+{
+    _channelitem *first = queue->first;
+    _channelitem *last = NULL;
+    Py_ssize_t count = 0;
+    for (_channelitem *item = first; item != NULL && count < max;
+            item = item->next) {
+        last = item;
+        count += 1;
+    }
+    if (count == 0) {
+        *pcount = 0;
         return NULL;
     }
-    queue->first = item->next;
-    if (queue->last == item) {
+    queue->first = last->next;
+    if (queue->first == NULL) {
         queue->last = NULL;
     }
-    queue->count -= 1;
-
-    return _channelitem_popped(item);
+    queue->count -= count;
+    last->next = NULL;
+    *pcount = count;
+    return first;
 }
 
 /* channel-interpreter associations */
@@ -727,6 +788,85 @@ _channelends_close_all(_channelends *ends, int which, int force)
     }
 }
 
+/* receivers blocked on an empty channel */
+
+struct _channelwaiter;
+
+// Each blocked receiver owns a waiter (and its lock).  The waiter is
+// linked into the channel while the receiver sleeps on the lock.  The
+// channel only ever unlinks a waiter and then releases its lock, so
+// every link is matched by exactly one release (see _channel_wake()).
+typedef struct _channelwaiter {
+    PyThread_type_lock lock;
+    int linked;
+    struct _channelwaiter *next;
+} _channelwaiter;
+
+typedef struct _channelwaiters {
+    _channelwaiter *first;
+    _channelwaiter *last;
+} _channelwaiters;
+
+static void
+_channelwaiters_add(_channelwaiters *waiters, _channelwaiter *waiter)
+{
+    waiter->next = NULL;
+    waiter->linked = 1;
+    if (waiters->first == NULL) {
+        waiters->first = waiter;
+    }
+    else {
+        waiters->last->next = waiter;
+    }
+    waiters->last = waiter;
+}
+
+static int
+_channelwaiters_remove(_channelwaiters *waiters, _channelwaiter *waiter)
+{
+    _channelwaiter *prev = NULL;
+    _channelwaiter *cur = waiters->first;
+    while (cur != NULL && cur != waiter) {
+        prev = cur;
+        cur = cur->next;
+    }
+    if (cur == NULL) {
+        return 0;
+    }
+    if (prev == NULL) {
+        waiters->first = cur->next;
+    }
+    else {
+        prev->next = cur->next;
+    }
+    if (waiters->last == cur) {
+        waiters->last = prev;
+    }
+    cur->next = NULL;
+    cur->linked = 0;
+    return 1;
+}
+
+// Wake up to "count" waiters (all of them if count is negative).
+static void
+_channelwaiters_wake(_channelwaiters *waiters, Py_ssize_t count)
+{
+    while (waiters->first != NULL && count != 0) {
+        _channelwaiter *waiter = waiters->first;
+        waiters->first = waiter->next;
+        if (waiters->first == NULL) {
+            waiters->last = NULL;
+        }
+        waiter->next = NULL;
+        waiter->linked = 0;
+        // Past this point the waiter may go away at any time.
+        PyThread_release_lock(waiter->lock);
+        if (count > 0) {
+            count -= 1;
+        }
+    }
+}
+
 /* channels */
 
 struct _channel;
@@ -738,6 +878,7 @@ typedef struct _channel {
     PyThread_type_lock mutex;
     _channelqueue *queue;
     _channelends *ends;
+    _channelwaiters waiters;
     int open;
     struct _channel_closing *closing;
 } _PyChannelState;
@@ -767,6 +908,8 @@ _channel_new(void)
         PyMem_Free(chan);
         return NULL;
     }
+    chan->waiters.first = NULL;
+    chan->waiters.last = NULL;
     chan->open = 1;
     chan->closing = NULL;
     return chan;
@@ -777,6 +920,7 @@ _channel_free(_PyChannelState *chan)
 {
     _channel_clear_closing(chan);
     PyThread_acquire_lock(chan->mutex, WAIT_LOCK);
+    _channelwaiters_wake(&chan->waiters, -1);
     _channelqueue_free(chan->queue);
     _channelends_free(chan->ends);
     PyThread_release_lock(chan->mutex);
@@ -803,6 +947,7 @@ _channel_add(_PyChannelState *chan, int64_t interp,
     if (_channelqueue_put(chan->queue, data) != 0) {
         goto done;
     }
+    _channelwaiters_wake(&chan->waiters, 1);
 
     res = 0;
 done:
@@ -810,23 +955,61 @@ done:
     return res;
 }
 
-static _PyCrossInterpreterData *
-_channel_next(_PyChannelState *chan, int64_t interp)
+// On success the chain of items is owned by the channel.
+static int
+_channel_add_chain(_PyChannelState *chan, int64_t interp,
+                   _channelitem *first, _channelitem *last, Py_ssize_t count)
+{
+    int res = -1;
+    PyThread_acquire_lock(chan->mutex, WAIT_LOCK);
+
+    if (!chan->open) {
+        PyErr_SetString(ChannelClosedError, "channel closed");
+        goto done;
+    }
+    if (_channelends_associate(chan->ends, interp, 1) != 0) {
+        goto done;
+    }
+
+    _channelqueue_put_chain(chan->queue, first, last, count);
+    _channelwaiters_wake(&chan->waiters, count);
+
+    res = 0;
+done:
+    PyThread_release_lock(chan->mutex);
+    return res;
+}
+
+// Pop up to "max" items off the channel.  If none are available and a
+// waiter is given then it is linked into the channel before the lock is
+// released, so a concurrent send can't be missed.
+static _channelitem *
+_channel_next_chain(_PyChannelState *chan, int64_t interp, Py_ssize_t max,
+                    _channelwaiter *waiter, Py_ssize_t *pcount)
 {
-    _PyCrossInterpreterData *data = NULL;
+    _channelitem *items = NULL;
+    *pcount = 0;
     PyThread_acquire_lock(chan->mutex, WAIT_LOCK);
 
     if (!chan->open) {
         PyErr_SetString(ChannelClosedError, "channel closed");
+        *pcount = -1;
         goto done;
     }
     if (_channelends_associate(chan->ends, interp, 0) != 0) {
+        *pcount = -1;
         goto done;
     }
 
-    data = _channelqueue_get(chan->queue);
-    if (data == NULL && !PyErr_Occurred() && chan->closing != NULL) {
-        chan->open = 0;
+    items = _channelqueue_get_chain(chan->queue, max, pcount);
+    if (items == NULL) {
+        if (chan->closing != NULL) {
+            chan->open = 0;
+            _channelwaiters_wake(&chan->waiters, -1);
+        }
+        else if (waiter != NULL) {
+            _channelwaiters_add(&chan->waiters, waiter);
+        }
     }
 
 done:
@@ -834,7 +1017,23 @@ done:
     if (chan->queue->count == 0) {
         _channel_finish_closing(chan);
     }
-    return data;
+    return items;
+}
+
+// Unlink the waiter if the channel hasn't done so already.  Otherwise
+// consume the pending wakeup and pass it on if there is still data left.
+static void
+_channel_forget_waiter(_PyChannelState *chan, _channelwaiter *waiter)
+{
+    PyThread_acquire_lock(chan->mutex, WAIT_LOCK);
+    if (!_channelwaiters_remove(&chan->waiters, waiter)) {
+        // The lock was released under the mutex, so this won't block.
+        PyThread_acquire_lock(waiter->lock, WAIT_LOCK);
+        if (chan->queue->count > 0) {
+            _channelwaiters_wake(&chan->waiters, 1);
+        }
+    }
+    PyThread_release_lock(chan->mutex);
 }
 
 static int
@@ -852,6 +1051,9 @@ _channel_close_interpreter(_PyChannelState *chan, int64_t interp, int end)
         goto done;
     }
     chan->open = _channelends_is_open(chan->ends);
+    if (!chan->open) {
+        _channelwaiters_wake(&chan->waiters, -1);
+    }
 
     res = 0;
 done:
@@ -877,6 +1079,7 @@ _channel_close_all(_PyChannelState *chan, int end, int force)
     }
 
     chan->open = 0;
+    _channelwaiters_wake(&chan->waiters, -1);
 
     // We *could* also just leave these in place, since we've marked
     // the channel as closed already.
@@ -1085,7 +1288,7 @@ _channels_close(_channels *channels, int64_t cid, _PyChannelState **pchan,
                     goto done;
                 }
                 // Mark the channel as closing and return.  The channel
-                // will be cleaned up in _channel_next().
+                // will be cleaned up in _channel_next_chain().
                 PyErr_Clear();
                 if (_channel_set_closing(ref, channels->mutex) != 0) {
                     goto done;
@@ -1355,43 +1558,253 @@ _channel_send(_channels *channels, int64_t id, PyObject *obj)
     return 0;
 }
 
-static PyObject *
-_channel_recv(_channels *channels, int64_t id)
+static int
+_channel_send_many(_channels *channels, int64_t id, PyObject *objs)
 {
     PyInterpreterState *interp = _get_current();
     if (interp == NULL) {
-        return NULL;
+        return -1;
+    }
+
+    PyObject *seq = PySequence_Fast(objs, "objs must be iterable");
+    if (seq == NULL) {
+        return -1;
+    }
+    Py_ssize_t count = PySequence_Fast_GET_SIZE(seq);
+    if (count == 0) {
+        Py_DECREF(seq);
+        return 0;
+    }
+
+    // Convert all the objects to cross-interpreter data up front, so the
+    // channel lock is only held while the items are spliced in.
+    int res = -1;
+    Py_ssize_t converted = 0;
+    _PyCrossInterpreterData **datas = PyMem_NEW(_PyCrossInterpreterData *,
+                                                count);
+    if (datas == NULL) {
+        PyErr_NoMemory();
+        goto finally;
+    }
+    for (; converted < count; converted++) {
+        _PyCrossInterpreterData *data = PyMem_NEW(_PyCrossInterpreterData, 1);
+        if (data == NULL) {
+            PyErr_NoMemory();
+            goto finally;
+        }
+        PyObject *obj = PySequence_Fast_GET_ITEM(seq, converted);
+        if (_PyObject_GetCrossInterpreterData(obj, data) != 0) {
+            PyMem_Free(data);
+            goto finally;
+        }
+        datas[converted] = data;
+    }
+    _channelitem *last = NULL;
+    _channelitem *first = _channelitem_new_chain(datas, count, &last);
+    if (first == NULL) {
+        goto finally;
     }
 
     // Look up the channel.
     PyThread_type_lock mutex = NULL;
     _PyChannelState *chan = _channels_lookup(channels, id, &mutex);
     if (chan == NULL) {
-        return NULL;
+        goto release_chain;
     }
     // Past this point we are responsible for releasing the mutex.
 
-    // Pop off the next item from the channel.
-    _PyCrossInterpreterData *data = _channel_next(chan, interp->id);
+    if (chan->closing != NULL) {
+        PyErr_Format(ChannelClosedError, "channel %" PRId64 " closed", id);
+        PyThread_release_lock(mutex);
+        goto release_chain;
+    }
+
+    // Add the data to the channel.
+    res = _channel_add_chain(chan, interp->id, first, last, count);
     PyThread_release_lock(mutex);
-    if (data == NULL) {
-        if (!PyErr_Occurred()) {
-            PyErr_Format(ChannelEmptyError, "channel %" PRId64 " is empty", id);
+    if (res == 0) {
+        // The channel owns the data now.
+        converted = 0;
+        goto finally;
+    }
+
+release_chain:
+    // The data is released below.
+    for (_channelitem *item = first; item != NULL; item = item->next) {
+        item->data = NULL;
+    }
+    _channelitem_free_all(first);
+finally:
+    for (Py_ssize_t i = 0; i < converted; i++) {
+        _PyCrossInterpreterData_Release(datas[i]);
+        PyMem_Free(datas[i]);
+    }
+    PyMem_Free(datas);
+    Py_DECREF(seq);
+    return res;
+}
+
+// Pop up to "max" items off the channel, waiting for at least one to
+// arrive if the channel is empty.  A timeout of -1 means to wait forever
+// and 0 means not to wait at all.  Returns the number of items popped
+// (always at least 1) or -1 on error.
+static Py_ssize_t
+_channel_recv_chain(_channels *channels, int64_t id, Py_ssize_t max,
+                    PY_TIMEOUT_T microseconds, _channelitem **pitems)
+{
+    PyInterpreterState *interp = _get_current();
+    if (interp == NULL) {
+        return -1;
+    }
+
+    _PyTime_t endtime = 0;
+    _channelwaiter waiter = {NULL, 0, NULL};
+    if (microseconds != 0) {
+        if (microseconds > 0) {
+            endtime = _PyTime_GetMonotonicClock() +
+                      _PyTime_FromNanoseconds((_PyTime_t)microseconds * 1000);
         }
+        // A waiter sleeps on its (already held) lock until the channel
+        // releases it.
+        waiter.lock = PyThread_allocate_lock();
+        if (waiter.lock == NULL) {
+            PyErr_SetString(ChannelError,
+                            "can't initialize mutex for channel receive");
+            return -1;
+        }
+        PyThread_acquire_lock(waiter.lock, WAIT_LOCK);
+    }
+
+    Py_ssize_t count;
+    while (1) {
+        // Look up the channel.
+        PyThread_type_lock mutex = NULL;
+        _PyChannelState *chan = _channels_lookup(channels, id, &mutex);
+        if (chan == NULL) {
+            count = -1;
+            break;
+        }
+        // Past this point we are responsible for releasing the mutex.
+
+        // Pop off the next items from the channel.
+        *pitems = _channel_next_chain(chan, interp->id, max,
+                                      microseconds != 0 ? &waiter : NULL,
+                                      &count);
+        PyThread_release_lock(mutex);
+        if (count != 0) {
+            break;
+        }
+        if (microseconds == 0) {
+            if (!PyErr_Occurred()) {
+                PyErr_Format(ChannelEmptyError,
+                             "channel %" PRId64 " is empty", id);
+            }
+            count = -1;
+            break;
+        }
+        if (!waiter.linked) {
+            // The channel was closed.  The next lookup will fail.
+            continue;
+        }
+
+        // Wait for a sender (or for the channel to close).
+        PyLockStatus r;
+        Py_BEGIN_ALLOW_THREADS
+        r = PyThread_acquire_lock_timed(waiter.lock, microseconds, 1);
+        Py_END_ALLOW_THREADS
+        if (r != PY_LOCK_ACQUIRED) {
+            chan = _channels_lookup(channels, id, &mutex);
+            if (chan != NULL) {
+                _channel_forget_waiter(chan, &waiter);
+                PyThread_release_lock(mutex);
+            }
+            else {
+                // The channel is going away and will release the lock.
+                PyErr_Clear();
+                Py_BEGIN_ALLOW_THREADS
+                PyThread_acquire_lock(waiter.lock, WAIT_LOCK);
+                Py_END_ALLOW_THREADS
+            }
+        }
+        if (r == PY_LOCK_INTR && Py_MakePendingCalls() < 0) {
+            count = -1;
+            break;
+        }
+        if (r == PY_LOCK_FAILURE) {
+            // Timed out, so make one last (non-blocking) attempt.
+            microseconds = 0;
+        }
+        else if (endtime > 0) {
+            _PyTime_t timeout = endtime - _PyTime_GetMonotonicClock();
+            if (timeout <= 0) {
+                microseconds = 0;
+            }
+            else {
+                microseconds = _PyTime_AsMicroseconds(timeout,
+                                                      _PyTime_ROUND_CEILING);
+            }
+        }
+    }
+
+    if (waiter.lock != NULL) {
+        assert(!waiter.linked);
+        PyThread_release_lock(waiter.lock);
+        PyThread_free_lock(waiter.lock);
+    }
+    return count;
+}
+
+static PyObject *
+_channel_recv(_channels *channels, int64_t id, PY_TIMEOUT_T microseconds)
+{
+    _channelitem *item = NULL;
+    if (_channel_recv_chain(channels, id, 1, microseconds, &item) < 0) {
         return NULL;
     }
+    _PyCrossInterpreterData *data = _channelitem_popped(item);
 
     // Convert the data back to an object.
     PyObject *obj = _PyCrossInterpreterData_NewObject(data);
-    if (obj == NULL) {
-        return NULL;
-    }
     _PyCrossInterpreterData_Release(data);
     PyMem_Free(data);
 
     return obj;
 }
 
+static PyObject *
+_channel_recv_many(_channels *channels, int64_t id, Py_ssize_t max,
+                   PY_TIMEOUT_T microseconds)
+{
+    _channelitem *items = NULL;
+    Py_ssize_t count = _channel_recv_chain(channels, id, max, microseconds,
+                                           &items);
+    if (count < 0) {
+        return NULL;
+    }
+
+    // Convert the data back to objects.
+    PyObject *objs = PyList_New(count);
+    if (objs == NULL) {
+        _channelitem_free_all(items);
+        return NULL;
+    }
+    for (Py_ssize_t i = 0; i < count; i++) {
+        _channelitem *item = items;
+        items = item->next;
+        _PyCrossInterpreterData *data = _channelitem_popped(item);
+        PyObject *obj = _PyCrossInterpreterData_NewObject(data);
+        _PyCrossInterpreterData_Release(data);
+        PyMem_Free(data);
+        if (obj == NULL) {
+            _channelitem_free_all(items);
+            Py_DECREF(objs);
+            return NULL;
+        }
+        PyList_SET_ITEM(objs, i, obj);
+    }
+    return objs;
+}
+
 static int
 _channel_drop(_channels *channels, int64_t id, int send, int recv)
 {
@@ -2647,27 +3060,135 @@ PyDoc_STRVAR(channel_send_doc,
 \n\
 Add the object's data to the channel's queue.");
 
+static PyObject *
+channel_send_many(PyObject *self, PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {"cid", "objs", NULL};
+    PyObject *id;
+    PyObject *objs;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds,
+                                     "OO:channel_send_many", kwlist,
+                                     &id, &objs)) {
+        return NULL;
+    }
+    int64_t cid = _coerce_id(id);
+    if (cid < 0) {
+        return NULL;
+    }
+
+    if (_channel_send_many(&_globals.channels, cid, objs) != 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(channel_send_many_doc,
+"channel_send_many(cid, objs)\n\
+\n\
+Add the data of each of the objects to the channel's queue, in order.\n\
+Either all of the objects are added or none of them are.");
+
+static int
+_coerce_timeout(int block, PyObject *timeout, PY_TIMEOUT_T *pmicroseconds)
+{
+    if (!block) {
+        *pmicroseconds = 0;
+        return 0;
+    }
+    if (timeout == Py_None) {
+        *pmicroseconds = -1;
+        return 0;
+    }
+    _PyTime_t timeout_val;
+    if (_PyTime_FromSecondsObject(&timeout_val,
+                                  timeout, _PyTime_ROUND_CEILING) < 0) {
+        return -1;
+    }
+    if (timeout_val < 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "'timeout' must be a non-negative number");
+        return -1;
+    }
+    PY_TIMEOUT_T microseconds = _PyTime_AsMicroseconds(timeout_val,
+                                                       _PyTime_ROUND_CEILING);
+    if (microseconds >= PY_TIMEOUT_MAX) {
+        PyErr_SetString(PyExc_OverflowError,
+                        "timeout value is too large");
+        return -1;
+    }
+    *pmicroseconds = microseconds;
+    return 0;
+}
+
 static PyObject *
 channel_recv(PyObject *self, PyObject *args, PyObject *kwds)
 {
-    static char *kwlist[] = {"cid", NULL};
+    static char *kwlist[] = {"cid", "block", "timeout", NULL};
     PyObject *id;
+    int block = 0;
+    PyObject *timeout = Py_None;
     if (!PyArg_ParseTupleAndKeywords(args, kwds,
-                                     "O:channel_recv", kwlist, &id)) {
+                                     "O|$pO:channel_recv", kwlist,
+                                     &id, &block, &timeout)) {
         return NULL;
     }
     int64_t cid = _coerce_id(id);
     if (cid < 0) {
         return NULL;
     }
+    PY_TIMEOUT_T microseconds;
+    if (_coerce_timeout(block, timeout, &microseconds) != 0) {
+        return NULL;
+    }
 
-    return _channel_recv(&_globals.channels, cid);
+    return _channel_recv(&_globals.channels, cid, microseconds);
 }
 
 PyDoc_STRVAR(channel_recv_doc,
-"channel_recv(cid) -> obj\n\
+"channel_recv(cid, *, block=False, timeout=None) -> obj\n\
+\n\
+Return a new object from the data at the from of the channel's queue.\n\
+\n\
+If block is true then wait (for at most timeout seconds, if given) for\n\
+data to arrive if the channel is empty.  ChannelEmptyError is raised\n\
+if no data is available.");
+
+static PyObject *
+channel_recv_many(PyObject *self, PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {"cid", "max", "block", "timeout", NULL};
+    PyObject *id;
+    Py_ssize_t max;
+    int block = 0;
+    PyObject *timeout = Py_None;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds,
+                                     "On|$pO:channel_recv_many", kwlist,
+                                     &id, &max, &block, &timeout)) {
+        return NULL;
+    }
+    int64_t cid = _coerce_id(id);
+    if (cid < 0) {
+        return NULL;
+    }
+    if (max <= 0) {
+        PyErr_SetString(PyExc_ValueError, "'max' must be a positive integer");
+        return NULL;
+    }
+    PY_TIMEOUT_T microseconds;
+    if (_coerce_timeout(block, timeout, &microseconds) != 0) {
+        return NULL;
+    }
+
+    return _channel_recv_many(&_globals.channels, cid, max, microseconds);
+}
+
+PyDoc_STRVAR(channel_recv_many_doc,
+"channel_recv_many(cid, max, *, block=False, timeout=None) -> [obj]\n\
+\n\
+Return a list of new objects from the data at the front of the channel's\n\
+queue, with at least one and at most max items.\n\
 \n\
-Return a new object from the data at the from of the channel's queue.");
+The block and timeout arguments behave as for channel_recv().");
 
 static PyObject *
 channel_close(PyObject *self, PyObject *args, PyObject *kwds)
@@ -2792,8 +3313,12 @@ static PyMethodDef module_functions[] = {
      METH_NOARGS, channel_list_all_doc},
     {"channel_send",              (PyCFunction)(void(*)(void))channel_send,
      METH_VARARGS | METH_KEYWORDS, channel_send_doc},
+    {"channel_send_many",         (PyCFunction)(void(*)(void))channel_send_many,
+     METH_VARARGS | METH_KEYWORDS, channel_send_many_doc},
     {"channel_recv",              (PyCFunction)(void(*)(void))channel_recv,
      METH_VARARGS | METH_KEYWORDS, channel_recv_doc},
+    {"channel_recv_many",         (PyCFunction)(void(*)(void))channel_recv_many,
+     METH_VARARGS | METH_KEYWORDS, channel_recv_many_doc},
     {"channel_close",             (PyCFunction)(void(*)(void))channel_close,
      METH_VARARGS | METH_KEYWORDS, channel_close_doc},
     {"channel_release",           (PyCFunction)(void(*)(void))channel_release,
@@ -0,0 +1,392 @@
+/*[clinic input]
+preserve
+[clinic start generated code]*/
+
+PyDoc_STRVAR(future_new__doc__,
+"Future()\n"
+"--\n"
+"\n"
+"Represents the result of an asynchronous computation.");
+
+static PyObject *
+future_new_impl(PyTypeObject *type);
+
+static PyObject *
+future_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+    PyObject *return_value = NULL;
+
+    if ((type == &FutureType) &&
+        !_PyArg_NoPositional("Future", args)) {
+        goto exit;
+    }
+    if ((type == &FutureType) &&
+        !_PyArg_NoKeywords("Future", kwargs)) {
+        goto exit;
+    }
+    return_value = future_new_impl(type);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_concurrent_futures_Future_cancel__doc__,
+"cancel($self, /)\n"
+"--\n"
+"\n"
+"Cancel the future if possible.\n"
+"\n"
+"Returns True if the future was cancelled, False otherwise. A future\n"
+"cannot be cancelled if it is running or has already completed.");
+
+#define _CONCURRENT_FUTURES_FUTURE_CANCEL_METHODDEF    \
+    {"cancel", (PyCFunction)_concurrent_futures_Future_cancel, METH_NOARGS, _concurrent_futures_Future_cancel__doc__},
+
+static PyObject *
+_concurrent_futures_Future_cancel_impl(FutureObj *self);
+
+static PyObject *
+_concurrent_futures_Future_cancel(FutureObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _concurrent_futures_Future_cancel_impl(self);
+}
+
+PyDoc_STRVAR(_concurrent_futures_Future_cancelled__doc__,
+"cancelled($self, /)\n"
+"--\n"
+"\n"
+"Return True if the future was cancelled.");
+
+#define _CONCURRENT_FUTURES_FUTURE_CANCELLED_METHODDEF    \
+    {"cancelled", (PyCFunction)_concurrent_futures_Future_cancelled, METH_NOARGS, _concurrent_futures_Future_cancelled__doc__},
+
+static PyObject *
+_concurrent_futures_Future_cancelled_impl(FutureObj *self);
+
+static PyObject *
+_concurrent_futures_Future_cancelled(FutureObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _concurrent_futures_Future_cancelled_impl(self);
+}
+
+PyDoc_STRVAR(_concurrent_futures_Future_running__doc__,
+"running($self, /)\n"
+"--\n"
+"\n"
+"Return True if the future is currently executing.");
+
+#define _CONCURRENT_FUTURES_FUTURE_RUNNING_METHODDEF    \
+    {"running", (PyCFunction)_concurrent_futures_Future_running, METH_NOARGS, _concurrent_futures_Future_running__doc__},
+
+static PyObject *
+_concurrent_futures_Future_running_impl(FutureObj *self);
+
+static PyObject *
+_concurrent_futures_Future_running(FutureObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _concurrent_futures_Future_running_impl(self);
+}
+
+PyDoc_STRVAR(_concurrent_futures_Future_done__doc__,
+"done($self, /)\n"
+"--\n"
+"\n"
+"Return True of the future was cancelled or finished executing.");
+
+#define _CONCURRENT_FUTURES_FUTURE_DONE_METHODDEF    \
+    {"done", (PyCFunction)_concurrent_futures_Future_done, METH_NOARGS, _concurrent_futures_Future_done__doc__},
+
+static PyObject *
+_concurrent_futures_Future_done_impl(FutureObj *self);
+
+static PyObject *
+_concurrent_futures_Future_done(FutureObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _concurrent_futures_Future_done_impl(self);
+}
+
+PyDoc_STRVAR(_concurrent_futures_Future_add_done_callback__doc__,
+"add_done_callback($self, /, fn)\n"
+"--\n"
+"\n"
+"Attaches a callable that will be called when the future finishes.\n"
+"\n"
+"The callable is called with this future as its only argument.  If the\n"
+"future has already completed or been cancelled then the callable will\n"
+"be called immediately.  Callables are called in the order that they\n"
+"were added.");
+
+#define _CONCURRENT_FUTURES_FUTURE_ADD_DONE_CALLBACK_METHODDEF    \
+    {"add_done_callback", (PyCFunction)(void(*)(void))_concurrent_futures_Future_add_done_callback, METH_FASTCALL|METH_KEYWORDS, _concurrent_futures_Future_add_done_callback__doc__},
+
+static PyObject *
+_concurrent_futures_Future_add_done_callback_impl(FutureObj *self,
+                                                  PyObject *fn);
+
+static PyObject *
+_concurrent_futures_Future_add_done_callback(FutureObj *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    static const char * const _keywords[] = {"fn", NULL};
+    static _PyArg_Parser _parser = {"O:add_done_callback", _keywords, 0};
+    PyObject *fn;
+
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, &_parser,
+        &fn)) {
+        goto exit;
+    }
+    return_value = _concurrent_futures_Future_add_done_callback_impl(self, fn);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_concurrent_futures_Future_result__doc__,
+"result($self, /, timeout=None)\n"
+"--\n"
+"\n"
+"Return the result of the call that the future represents.\n"
+"\n"
+"Wait up to timeout seconds (forever if None) for the future to finish.\n"
+"Raises CancelledError if the future was cancelled, TimeoutError if it\n"
+"did not finish in time, and the exception raised by the call if any.");
+
+#define _CONCURRENT_FUTURES_FUTURE_RESULT_METHODDEF    \
+    {"result", (PyCFunction)(void(*)(void))_concurrent_futures_Future_result, METH_FASTCALL|METH_KEYWORDS, _concurrent_futures_Future_result__doc__},
+
+static PyObject *
+_concurrent_futures_Future_result_impl(FutureObj *self, PyObject *timeout);
+
+static PyObject *
+_concurrent_futures_Future_result(FutureObj *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    static const char * const _keywords[] = {"timeout", NULL};
+    static _PyArg_Parser _parser = {"|O:result", _keywords, 0};
+    PyObject *timeout = Py_None;
+
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, &_parser,
+        &timeout)) {
+        goto exit;
+    }
+    return_value = _concurrent_futures_Future_result_impl(self, timeout);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_concurrent_futures_Future_exception__doc__,
+"exception($self, /, timeout=None)\n"
+"--\n"
+"\n"
+"Return the exception raised by the call that the future represents.\n"
+"\n"
+"Wait up to timeout seconds (forever if None) for the future to finish.\n"
+"Returns None if the call completed without raising.  Raises\n"
+"CancelledError if the future was cancelled and TimeoutError if it did\n"
+"not finish in time.");
+
+#define _CONCURRENT_FUTURES_FUTURE_EXCEPTION_METHODDEF    \
+    {"exception", (PyCFunction)(void(*)(void))_concurrent_futures_Future_exception, METH_FASTCALL|METH_KEYWORDS, _concurrent_futures_Future_exception__doc__},
+
+static PyObject *
+_concurrent_futures_Future_exception_impl(FutureObj *self, PyObject *timeout);
+
+static PyObject *
+_concurrent_futures_Future_exception(FutureObj *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    static const char * const _keywords[] = {"timeout", NULL};
+    static _PyArg_Parser _parser = {"|O:exception", _keywords, 0};
+    PyObject *timeout = Py_None;
+
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, &_parser,
+        &timeout)) {
+        goto exit;
+    }
+    return_value = _concurrent_futures_Future_exception_impl(self, timeout);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_concurrent_futures_Future_set_running_or_notify_cancel__doc__,
+"set_running_or_notify_cancel($self, /)\n"
+"--\n"
+"\n"
+"Mark the future as running or process any cancel notifications.\n"
+"\n"
+"Should only be used by Executor implementations and unit tests.\n"
+"\n"
+"Returns False if the future was cancelled (notifying threads waiting in\n"
+"wait() or as_completed()), True otherwise.  Raises RuntimeError if the\n"
+"future is already running or done.");
+
+#define _CONCURRENT_FUTURES_FUTURE_SET_RUNNING_OR_NOTIFY_CANCEL_METHODDEF    \
+    {"set_running_or_notify_cancel", (PyCFunction)_concurrent_futures_Future_set_running_or_notify_cancel, METH_NOARGS, _concurrent_futures_Future_set_running_or_notify_cancel__doc__},
+
+static PyObject *
+_concurrent_futures_Future_set_running_or_notify_cancel_impl(FutureObj *self);
+
+static PyObject *
+_concurrent_futures_Future_set_running_or_notify_cancel(FutureObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _concurrent_futures_Future_set_running_or_notify_cancel_impl(self);
+}
+
+PyDoc_STRVAR(_concurrent_futures_Future_set_result__doc__,
+"set_result($self, /, result)\n"
+"--\n"
+"\n"
+"Sets the return value of work associated with the future.\n"
+"\n"
+"Should only be used by Executor implementations and unit tests.");
+
+#define _CONCURRENT_FUTURES_FUTURE_SET_RESULT_METHODDEF    \
+    {"set_result", (PyCFunction)(void(*)(void))_concurrent_futures_Future_set_result, METH_FASTCALL|METH_KEYWORDS, _concurrent_futures_Future_set_result__doc__},
+
+static PyObject *
+_concurrent_futures_Future_set_result_impl(FutureObj *self, PyObject *result);
+
+static PyObject *
+_concurrent_futures_Future_set_result(FutureObj *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    static const char * const _keywords[] = {"result", NULL};
+    static _PyArg_Parser _parser = {"O:set_result", _keywords, 0};
+    PyObject *result;
+
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, &_parser,
+        &result)) {
+        goto exit;
+    }
+    return_value = _concurrent_futures_Future_set_result_impl(self, result);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_concurrent_futures_Future_set_exception__doc__,
+"set_exception($self, /, exception)\n"
+"--\n"
+"\n"
+"Sets the result of the future as being the given exception.\n"
+"\n"
+"Should only be used by Executor implementations and unit tests.");
+
+#define _CONCURRENT_FUTURES_FUTURE_SET_EXCEPTION_METHODDEF    \
+    {"set_exception", (PyCFunction)(void(*)(void))_concurrent_futures_Future_set_exception, METH_FASTCALL|METH_KEYWORDS, _concurrent_futures_Future_set_exception__doc__},
+
+static PyObject *
+_concurrent_futures_Future_set_exception_impl(FutureObj *self,
+                                              PyObject *exception);
+
+static PyObject *
+_concurrent_futures_Future_set_exception(FutureObj *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    static const char * const _keywords[] = {"exception", NULL};
+    static _PyArg_Parser _parser = {"O:set_exception", _keywords, 0};
+    PyObject *exception;
+
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, &_parser,
+        &exception)) {
+        goto exit;
+    }
+    return_value = _concurrent_futures_Future_set_exception_impl(self, exception);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_concurrent_futures_Future__invoke_callbacks__doc__,
+"_invoke_callbacks($self, /)\n"
+"--\n"
+"\n"
+"Call the done callbacks, logging exceptions they raise.");
+
+#define _CONCURRENT_FUTURES_FUTURE__INVOKE_CALLBACKS_METHODDEF    \
+    {"_invoke_callbacks", (PyCFunction)_concurrent_futures_Future__invoke_callbacks, METH_NOARGS, _concurrent_futures_Future__invoke_callbacks__doc__},
+
+static PyObject *
+_concurrent_futures_Future__invoke_callbacks_impl(FutureObj *self);
+
+static PyObject *
+_concurrent_futures_Future__invoke_callbacks(FutureObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _concurrent_futures_Future__invoke_callbacks_impl(self);
+}
+
+PyDoc_STRVAR(workitem_new__doc__,
+"_WorkItem(future, fn, args, kwargs, /)\n"
+"--\n"
+"\n"
+"A call to run in a worker thread and the future for its result.");
+
+static PyObject *
+workitem_new_impl(PyTypeObject *type, PyObject *future, PyObject *fn,
+                  PyObject *call_args, PyObject *call_kwargs);
+
+static PyObject *
+workitem_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *future;
+    PyObject *fn;
+    PyObject *call_args;
+    PyObject *call_kwargs;
+
+    if ((type == &WorkItemType) &&
+        !_PyArg_NoKeywords("_WorkItem", kwargs)) {
+        goto exit;
+    }
+    if (!_PyArg_CheckPositional("_WorkItem", PyTuple_GET_SIZE(args), 4, 4)) {
+        goto exit;
+    }
+    future = PyTuple_GET_ITEM(args, 0);
+    fn = PyTuple_GET_ITEM(args, 1);
+    if (!PyTuple_Check(PyTuple_GET_ITEM(args, 2))) {
+        _PyArg_BadArgument("_WorkItem", 3, "tuple", PyTuple_GET_ITEM(args, 2));
+        goto exit;
+    }
+    call_args = PyTuple_GET_ITEM(args, 2);
+    if (!PyDict_Check(PyTuple_GET_ITEM(args, 3))) {
+        _PyArg_BadArgument("_WorkItem", 4, "dict", PyTuple_GET_ITEM(args, 3));
+        goto exit;
+    }
+    call_kwargs = PyTuple_GET_ITEM(args, 3);
+    return_value = workitem_new_impl(type, future, fn, call_args, call_kwargs);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_concurrent_futures__WorkItem_run__doc__,
+"run($self, /)\n"
+"--\n"
+"\n"
+"Run the call and store its outcome in the future.\n"
+"\n"
+"Does nothing if the future was cancelled.");
+
+#define _CONCURRENT_FUTURES__WORKITEM_RUN_METHODDEF    \
+    {"run", (PyCFunction)_concurrent_futures__WorkItem_run, METH_NOARGS, _concurrent_futures__WorkItem_run__doc__},
+
+static PyObject *
+_concurrent_futures__WorkItem_run_impl(WorkItemObj *self);
+
+static PyObject *
+_concurrent_futures__WorkItem_run(WorkItemObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _concurrent_futures__WorkItem_run_impl(self);
+}
+
+PyDoc_STRVAR(_concurrent_futures__run_work_items__doc__,
+"_run_work_items($module, work_queue, /)\n"
+"--\n"
+"\n"
+"Run the work items taken from work_queue until it returns None.");
+
+#define _CONCURRENT_FUTURES__RUN_WORK_ITEMS_METHODDEF    \
+    {"_run_work_items", (PyCFunction)_concurrent_futures__run_work_items, METH_O, _concurrent_futures__run_work_items__doc__},
+/*[clinic end generated code: output=e5751d331a3d80c7 input=a9049054013a1b77]*/
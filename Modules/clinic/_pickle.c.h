@@ -2,6 +2,74 @@
 preserve
 [clinic start generated code]*/
 
+PyDoc_STRVAR(_pickle_PickleBuffer__doc__,
+"PickleBuffer(buffer, /)\n"
+"--\n"
+"\n"
+"Wrapper for potentially out-of-band buffers.");
+
+static PyObject *
+_pickle_PickleBuffer_impl(PyTypeObject *type, PyObject *buffer);
+
+static PyObject *
+_pickle_PickleBuffer(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *buffer;
+
+    if ((type == &PickleBuffer_Type) &&
+        !_PyArg_NoKeywords("PickleBuffer", kwargs)) {
+        goto exit;
+    }
+    if (!_PyArg_CheckPositional("PickleBuffer", PyTuple_GET_SIZE(args), 1, 1)) {
+        goto exit;
+    }
+    buffer = PyTuple_GET_ITEM(args, 0);
+    return_value = _pickle_PickleBuffer_impl(type, buffer);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_pickle_PickleBuffer_raw__doc__,
+"raw($self, /)\n"
+"--\n"
+"\n"
+"Return a memoryview of the raw memory underlying this buffer.\n"
+"\n"
+"The memoryview is one-dimensional with format \'B\'.  BufferError is\n"
+"raised if the buffer is not contiguous.");
+
+#define _PICKLE_PICKLEBUFFER_RAW_METHODDEF    \
+    {"raw", (PyCFunction)_pickle_PickleBuffer_raw, METH_NOARGS, _pickle_PickleBuffer_raw__doc__},
+
+static PyObject *
+_pickle_PickleBuffer_raw_impl(PickleBufferObject *self);
+
+static PyObject *
+_pickle_PickleBuffer_raw(PickleBufferObject *self, PyObject *Py_UNUSED(ignored))
+{
+    return _pickle_PickleBuffer_raw_impl(self);
+}
+
+PyDoc_STRVAR(_pickle_PickleBuffer_release__doc__,
+"release($self, /)\n"
+"--\n"
+"\n"
+"Release the underlying buffer exposed by the PickleBuffer object.");
+
+#define _PICKLE_PICKLEBUFFER_RELEASE_METHODDEF    \
+    {"release", (PyCFunction)_pickle_PickleBuffer_release, METH_NOARGS, _pickle_PickleBuffer_release__doc__},
+
+static PyObject *
+_pickle_PickleBuffer_release_impl(PickleBufferObject *self);
+
+static PyObject *
+_pickle_PickleBuffer_release(PickleBufferObject *self, PyObject *Py_UNUSED(ignored))
+{
+    return _pickle_PickleBuffer_release_impl(self);
+}
+
 PyDoc_STRVAR(_pickle_Pickler_clear_memo__doc__,
 "clear_memo($self, /)\n"
 "--\n"
@@ -63,14 +131,16 @@ exit:
 }
 
 PyDoc_STRVAR(_pickle_Pickler___init____doc__,
-"Pickler(file, protocol=None, fix_imports=True)\n"
+"Pickler(file, protocol=None, fix_imports=True, buffer_callback=None, *,\n"
+"        memoize=True)\n"
 "--\n"
 "\n"
 "This takes a binary file for writing a pickle data stream.\n"
 "\n"
 "The optional *protocol* argument tells the pickler to use the given\n"
-"protocol; supported protocols are 0, 1, 2, 3 and 4.  The default\n"
-"protocol is 3; a backward-incompatible protocol designed for Python 3.\n"
+"protocol; supported protocols are 0, 1, 2, 3, 4 and 5.  The default\n"
+"protocol is 4. It was introduced in Python 3.4, it is incompatible\n"
+"with previous versions.\n"
 "\n"
 "Specifying a negative protocol version selects the highest protocol\n"
 "version supported.  The higher the protocol used, the more recent the\n"
@@ -83,27 +153,42 @@ PyDoc_STRVAR(_pickle_Pickler___init____doc__,
 "\n"
 "If *fix_imports* is True and protocol is less than 3, pickle will try\n"
 "to map the new Python 3 names to the old module names used in Python\n"
-"2, so that the pickle data stream is readable with Python 2.");
+"2, so that the pickle data stream is readable with Python 2.\n"
+"\n"
+"If *buffer_callback* is None (the default), buffer views are\n"
+"serialized into *file* as part of the pickle stream.  Otherwise it is\n"
+"called with each PickleBuffer met while pickling; when it returns a\n"
+"false value, the buffer is not written into the stream and must be\n"
+"passed back, in order, in the *buffers* argument of the unpickler.\n"
+"It is an error to pass *buffer_callback* with a protocol below 5.\n"
+"\n"
+"If *memoize* is false, the pickler does not record the objects it has\n"
+"already written, so shared objects are written once per reference.\n"
+"This is faster for data without shared or recursive references; a\n"
+"ValueError is raised if a recursive structure is met.");
 
 static int
 _pickle_Pickler___init___impl(PicklerObject *self, PyObject *file,
-                              PyObject *protocol, int fix_imports);
+                              PyObject *protocol, int fix_imports,
+                              PyObject *buffer_callback, int memoize);
 
 static int
 _pickle_Pickler___init__(PyObject *self, PyObject *args, PyObject *kwargs)
 {
     int return_value = -1;
-    static const char * const _keywords[] = {"file", "protocol", "fix_imports", NULL};
-    static _PyArg_Parser _parser = {"O|Op:Pickler", _keywords, 0};
+    static const char * const _keywords[] = {"file", "protocol", "fix_imports", "buffer_callback", "memoize", NULL};
+    static _PyArg_Parser _parser = {"O|OpO$p:Pickler", _keywords, 0};
     PyObject *file;
     PyObject *protocol = NULL;
     int fix_imports = 1;
+    PyObject *buffer_callback = Py_None;
+    int memoize = 1;
 
     if (!_PyArg_ParseTupleAndKeywordsFast(args, kwargs, &_parser,
-        &file, &protocol, &fix_imports)) {
+        &file, &protocol, &fix_imports, &buffer_callback, &memoize)) {
         goto exit;
     }
-    return_value = _pickle_Pickler___init___impl((PicklerObject *)self, file, protocol, fix_imports);
+    return_value = _pickle_Pickler___init___impl((PicklerObject *)self, file, protocol, fix_imports, buffer_callback, memoize);
 
 exit:
     return return_value;
@@ -253,7 +338,8 @@ exit:
 }
 
 PyDoc_STRVAR(_pickle_Unpickler___init____doc__,
-"Unpickler(file, *, fix_imports=True, encoding=\'ASCII\', errors=\'strict\')\n"
+"Unpickler(file, *, fix_imports=True, encoding=\'ASCII\', errors=\'strict\',\n"
+"          buffers=())\n"
 "--\n"
 "\n"
 "This takes a binary file for reading a pickle data stream.\n"
@@ -275,29 +361,35 @@ PyDoc_STRVAR(_pickle_Unpickler___init____doc__,
 "*encoding* and *errors* tell pickle how to decode 8-bit string\n"
 "instances pickled by Python 2; these default to \'ASCII\' and \'strict\',\n"
 "respectively.  The *encoding* can be \'bytes\' to read these 8-bit\n"
-"string instances as bytes objects.");
+"string instances as bytes objects.\n"
+"\n"
+"If *buffers* is not None, it is an iterable of buffer-enabled objects\n"
+"that is consumed each time the pickle stream references an out-of-band\n"
+"buffer view.  Such buffers were given in order to the *buffer_callback*\n"
+"of a Pickler object.");
 
 static int
 _pickle_Unpickler___init___impl(UnpicklerObject *self, PyObject *file,
                                 int fix_imports, const char *encoding,
-                                const char *errors);
+                                const char *errors, PyObject *buffers);
 
 static int
 _pickle_Unpickler___init__(PyObject *self, PyObject *args, PyObject *kwargs)
 {
     int return_value = -1;
-    static const char * const _keywords[] = {"file", "fix_imports", "encoding", "errors", NULL};
-    static _PyArg_Parser _parser = {"O|$pss:Unpickler", _keywords, 0};
+    static const char * const _keywords[] = {"file", "fix_imports", "encoding", "errors", "buffers", NULL};
+    static _PyArg_Parser _parser = {"O|$pssO:Unpickler", _keywords, 0};
     PyObject *file;
     int fix_imports = 1;
     const char *encoding = "ASCII";
     const char *errors = "strict";
+    PyObject *buffers = NULL;
 
     if (!_PyArg_ParseTupleAndKeywordsFast(args, kwargs, &_parser,
-        &file, &fix_imports, &encoding, &errors)) {
+        &file, &fix_imports, &encoding, &errors, &buffers)) {
         goto exit;
     }
-    return_value = _pickle_Unpickler___init___impl((UnpicklerObject *)self, file, fix_imports, encoding, errors);
+    return_value = _pickle_Unpickler___init___impl((UnpicklerObject *)self, file, fix_imports, encoding, errors, buffers);
 
 exit:
     return return_value;
@@ -357,8 +449,117 @@ _pickle_UnpicklerMemoProxy___reduce__(UnpicklerMemoProxyObject *self, PyObject *
     return _pickle_UnpicklerMemoProxy___reduce___impl(self);
 }
 
+PyDoc_STRVAR(_pickle_IncrementalUnpickler___init____doc__,
+"IncrementalUnpickler(*, fix_imports=True, encoding=\'ASCII\',\n"
+"                     errors=\'strict\', buffers=())\n"
+"--\n"
+"\n"
+"Load a stream of pickles fed in chunks of arbitrary sizes.\n"
+"\n"
+"Data is passed to the feed() method as it arrives, for instance from a\n"
+"socket, and the objects whose pickle is complete are returned.  Each\n"
+"pickle is loaded independently, as by loads().  A partially received\n"
+"pickle is kept as the unpickler\'s state rather than as raw data, and\n"
+"the opcodes of protocol 4 frames are executed as soon as a whole frame\n"
+"is available.\n"
+"\n"
+"Optional keyword arguments *fix_imports*, *encoding*, *errors* and\n"
+"*buffers* have the same meaning as for Unpickler.  *buffers* is shared\n"
+"by all the pickles of the stream.");
+
+static int
+_pickle_IncrementalUnpickler___init___impl(IncrementalUnpicklerObject *self,
+                                           int fix_imports,
+                                           const char *encoding,
+                                           const char *errors,
+                                           PyObject *buffers);
+
+static int
+_pickle_IncrementalUnpickler___init__(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    int return_value = -1;
+    static const char * const _keywords[] = {"fix_imports", "encoding", "errors", "buffers", NULL};
+    static _PyArg_Parser _parser = {"|$pssO:IncrementalUnpickler", _keywords, 0};
+    int fix_imports = 1;
+    const char *encoding = "ASCII";
+    const char *errors = "strict";
+    PyObject *buffers = NULL;
+
+    if (!_PyArg_ParseTupleAndKeywordsFast(args, kwargs, &_parser,
+        &fix_imports, &encoding, &errors, &buffers)) {
+        goto exit;
+    }
+    return_value = _pickle_IncrementalUnpickler___init___impl((IncrementalUnpicklerObject *)self, fix_imports, encoding, errors, buffers);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_pickle_IncrementalUnpickler_feed__doc__,
+"feed($self, data, /)\n"
+"--\n"
+"\n"
+"Feed the next chunk of the pickle stream.\n"
+"\n"
+"Return the list of the objects whose pickle was completed by *data*,\n"
+"in stream order.  If an error is raised, the pending input and the\n"
+"partially loaded pickle are discarded.");
+
+#define _PICKLE_INCREMENTALUNPICKLER_FEED_METHODDEF    \
+    {"feed", (PyCFunction)_pickle_IncrementalUnpickler_feed, METH_O, _pickle_IncrementalUnpickler_feed__doc__},
+
+static PyObject *
+_pickle_IncrementalUnpickler_feed_impl(IncrementalUnpicklerObject *self,
+                                       Py_buffer *data);
+
+static PyObject *
+_pickle_IncrementalUnpickler_feed(IncrementalUnpicklerObject *self, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    Py_buffer data = {NULL, NULL};
+
+    if (PyObject_GetBuffer(arg, &data, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (!PyBuffer_IsContiguous(&data, 'C')) {
+        _PyArg_BadArgument("feed", 0, "contiguous buffer", arg);
+        goto exit;
+    }
+    return_value = _pickle_IncrementalUnpickler_feed_impl(self, &data);
+
+exit:
+    /* Cleanup for data */
+    if (data.obj) {
+       PyBuffer_Release(&data);
+    }
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_pickle_IncrementalUnpickler_close__doc__,
+"close($self, /)\n"
+"--\n"
+"\n"
+"Check that the stream ended at the end of a pickle.\n"
+"\n"
+"Raise UnpicklingError if a pickle was only partially fed, and reset the\n"
+"unpickler for a new stream.");
+
+#define _PICKLE_INCREMENTALUNPICKLER_CLOSE_METHODDEF    \
+    {"close", (PyCFunction)_pickle_IncrementalUnpickler_close, METH_NOARGS, _pickle_IncrementalUnpickler_close__doc__},
+
+static PyObject *
+_pickle_IncrementalUnpickler_close_impl(IncrementalUnpicklerObject *self);
+
+static PyObject *
+_pickle_IncrementalUnpickler_close(IncrementalUnpicklerObject *self, PyObject *Py_UNUSED(ignored))
+{
+    return _pickle_IncrementalUnpickler_close_impl(self);
+}
+
 PyDoc_STRVAR(_pickle_dump__doc__,
-"dump($module, /, obj, file, protocol=None, *, fix_imports=True)\n"
+"dump($module, /, obj, file, protocol=None, *, fix_imports=True,\n"
+"     buffer_callback=None, memoize=True)\n"
 "--\n"
 "\n"
 "Write a pickled representation of obj to the open file object file.\n"
@@ -367,7 +568,7 @@ PyDoc_STRVAR(_pickle_dump__doc__,
 "be more efficient.\n"
 "\n"
 "The optional *protocol* argument tells the pickler to use the given\n"
-"protocol; supported protocols are 0, 1, 2, 3 and 4.  The default\n"
+"protocol; supported protocols are 0, 1, 2, 3, 4 and 5.  The default\n"
 "protocol is 4. It was introduced in Python 3.4, it is incompatible\n"
 "with previous versions.\n"
 "\n"
@@ -382,44 +583,53 @@ PyDoc_STRVAR(_pickle_dump__doc__,
 "\n"
 "If *fix_imports* is True and protocol is less than 3, pickle will try\n"
 "to map the new Python 3 names to the old module names used in Python\n"
-"2, so that the pickle data stream is readable with Python 2.");
+"2, so that the pickle data stream is readable with Python 2.\n"
+"\n"
+"If *buffer_callback* is not None, it is called with the out-of-band\n"
+"buffer candidates, as for Pickler.\n"
+"\n"
+"If *memoize* is false, objects are not memoized, as for Pickler.");
 
 #define _PICKLE_DUMP_METHODDEF    \
     {"dump", (PyCFunction)(void(*)(void))_pickle_dump, METH_FASTCALL|METH_KEYWORDS, _pickle_dump__doc__},
 
 static PyObject *
 _pickle_dump_impl(PyObject *module, PyObject *obj, PyObject *file,
-                  PyObject *protocol, int fix_imports);
+                  PyObject *protocol, int fix_imports,
+                  PyObject *buffer_callback, int memoize);
 
 static PyObject *
 _pickle_dump(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
-    static const char * const _keywords[] = {"obj", "file", "protocol", "fix_imports", NULL};
-    static _PyArg_Parser _parser = {"OO|O$p:dump", _keywords, 0};
+    static const char * const _keywords[] = {"obj", "file", "protocol", "fix_imports", "buffer_callback", "memoize", NULL};
+    static _PyArg_Parser _parser = {"OO|O$pOp:dump", _keywords, 0};
     PyObject *obj;
     PyObject *file;
     PyObject *protocol = NULL;
     int fix_imports = 1;
+    PyObject *buffer_callback = Py_None;
+    int memoize = 1;
 
     if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, &_parser,
-        &obj, &file, &protocol, &fix_imports)) {
+        &obj, &file, &protocol, &fix_imports, &buffer_callback, &memoize)) {
         goto exit;
     }
-    return_value = _pickle_dump_impl(module, obj, file, protocol, fix_imports);
+    return_value = _pickle_dump_impl(module, obj, file, protocol, fix_imports, buffer_callback, memoize);
 
 exit:
     return return_value;
 }
 
 PyDoc_STRVAR(_pickle_dumps__doc__,
-"dumps($module, /, obj, protocol=None, *, fix_imports=True)\n"
+"dumps($module, /, obj, protocol=None, *, fix_imports=True,\n"
+"      buffer_callback=None, memoize=True)\n"
 "--\n"
 "\n"
 "Return the pickled representation of the object as a bytes object.\n"
 "\n"
 "The optional *protocol* argument tells the pickler to use the given\n"
-"protocol; supported protocols are 0, 1, 2, 3 and 4.  The default\n"
+"protocol; supported protocols are 0, 1, 2, 3, 4 and 5.  The default\n"
 "protocol is 4. It was introduced in Python 3.4, it is incompatible\n"
 "with previous versions.\n"
 "\n"
@@ -429,30 +639,37 @@ PyDoc_STRVAR(_pickle_dumps__doc__,
 "\n"
 "If *fix_imports* is True and *protocol* is less than 3, pickle will\n"
 "try to map the new Python 3 names to the old module names used in\n"
-"Python 2, so that the pickle data stream is readable with Python 2.");
+"Python 2, so that the pickle data stream is readable with Python 2.\n"
+"\n"
+"If *buffer_callback* is not None, it is called with the out-of-band\n"
+"buffer candidates, as for Pickler.\n"
+"\n"
+"If *memoize* is false, objects are not memoized, as for Pickler.");
 
 #define _PICKLE_DUMPS_METHODDEF    \
     {"dumps", (PyCFunction)(void(*)(void))_pickle_dumps, METH_FASTCALL|METH_KEYWORDS, _pickle_dumps__doc__},
 
 static PyObject *
 _pickle_dumps_impl(PyObject *module, PyObject *obj, PyObject *protocol,
-                   int fix_imports);
+                   int fix_imports, PyObject *buffer_callback, int memoize);
 
 static PyObject *
 _pickle_dumps(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
-    static const char * const _keywords[] = {"obj", "protocol", "fix_imports", NULL};
-    static _PyArg_Parser _parser = {"O|O$p:dumps", _keywords, 0};
+    static const char * const _keywords[] = {"obj", "protocol", "fix_imports", "buffer_callback", "memoize", NULL};
+    static _PyArg_Parser _parser = {"O|O$pOp:dumps", _keywords, 0};
     PyObject *obj;
     PyObject *protocol = NULL;
     int fix_imports = 1;
+    PyObject *buffer_callback = Py_None;
+    int memoize = 1;
 
     if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, &_parser,
-        &obj, &protocol, &fix_imports)) {
+        &obj, &protocol, &fix_imports, &buffer_callback, &memoize)) {
         goto exit;
     }
-    return_value = _pickle_dumps_impl(module, obj, protocol, fix_imports);
+    return_value = _pickle_dumps_impl(module, obj, protocol, fix_imports, buffer_callback, memoize);
 
 exit:
     return return_value;
@@ -460,7 +677,7 @@ exit:
 
 PyDoc_STRVAR(_pickle_load__doc__,
 "load($module, /, file, *, fix_imports=True, encoding=\'ASCII\',\n"
-"     errors=\'strict\')\n"
+"     errors=\'strict\', buffers=())\n"
 "--\n"
 "\n"
 "Read and return an object from the pickle data stored in a file.\n"
@@ -485,31 +702,38 @@ PyDoc_STRVAR(_pickle_load__doc__,
 "*encoding* and *errors* tell pickle how to decode 8-bit string\n"
 "instances pickled by Python 2; these default to \'ASCII\' and \'strict\',\n"
 "respectively.  The *encoding* can be \'bytes\' to read these 8-bit\n"
-"string instances as bytes objects.");
+"string instances as bytes objects.\n"
+"\n"
+"If *buffers* is not None, it is an iterable of buffer-enabled objects\n"
+"that is consumed each time the pickle stream references an out-of-band\n"
+"buffer view.  Such buffers were given in order to the *buffer_callback*\n"
+"of a Pickler object.");
 
 #define _PICKLE_LOAD_METHODDEF    \
     {"load", (PyCFunction)(void(*)(void))_pickle_load, METH_FASTCALL|METH_KEYWORDS, _pickle_load__doc__},
 
 static PyObject *
 _pickle_load_impl(PyObject *module, PyObject *file, int fix_imports,
-                  const char *encoding, const char *errors);
+                  const char *encoding, const char *errors,
+                  PyObject *buffers);
 
 static PyObject *
 _pickle_load(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
-    static const char * const _keywords[] = {"file", "fix_imports", "encoding", "errors", NULL};
-    static _PyArg_Parser _parser = {"O|$pss:load", _keywords, 0};
+    static const char * const _keywords[] = {"file", "fix_imports", "encoding", "errors", "buffers", NULL};
+    static _PyArg_Parser _parser = {"O|$pssO:load", _keywords, 0};
     PyObject *file;
     int fix_imports = 1;
     const char *encoding = "ASCII";
     const char *errors = "strict";
+    PyObject *buffers = NULL;
 
     if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, &_parser,
-        &file, &fix_imports, &encoding, &errors)) {
+        &file, &fix_imports, &encoding, &errors, &buffers)) {
         goto exit;
     }
-    return_value = _pickle_load_impl(module, file, fix_imports, encoding, errors);
+    return_value = _pickle_load_impl(module, file, fix_imports, encoding, errors, buffers);
 
 exit:
     return return_value;
@@ -517,7 +741,7 @@ exit:
 
 PyDoc_STRVAR(_pickle_loads__doc__,
 "loads($module, /, data, *, fix_imports=True, encoding=\'ASCII\',\n"
-"      errors=\'strict\')\n"
+"      errors=\'strict\', buffers=())\n"
 "--\n"
 "\n"
 "Read and return an object from the given pickle data.\n"
@@ -533,33 +757,40 @@ PyDoc_STRVAR(_pickle_loads__doc__,
 "*encoding* and *errors* tell pickle how to decode 8-bit string\n"
 "instances pickled by Python 2; these default to \'ASCII\' and \'strict\',\n"
 "respectively.  The *encoding* can be \'bytes\' to read these 8-bit\n"
-"string instances as bytes objects.");
+"string instances as bytes objects.\n"
+"\n"
+"If *buffers* is not None, it is an iterable of buffer-enabled objects\n"
+"that is consumed each time the pickle stream references an out-of-band\n"
+"buffer view.  Such buffers were given in order to the *buffer_callback*\n"
+"of a Pickler object.");
 
 #define _PICKLE_LOADS_METHODDEF    \
     {"loads", (PyCFunction)(void(*)(void))_pickle_loads, METH_FASTCALL|METH_KEYWORDS, _pickle_loads__doc__},
 
 static PyObject *
 _pickle_loads_impl(PyObject *module, PyObject *data, int fix_imports,
-                   const char *encoding, const char *errors);
+                   const char *encoding, const char *errors,
+                   PyObject *buffers);
 
 static PyObject *
 _pickle_loads(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
-    static const char * const _keywords[] = {"data", "fix_imports", "encoding", "errors", NULL};
-    static _PyArg_Parser _parser = {"O|$pss:loads", _keywords, 0};
+    static const char * const _keywords[] = {"data", "fix_imports", "encoding", "errors", "buffers", NULL};
+    static _PyArg_Parser _parser = {"O|$pssO:loads", _keywords, 0};
     PyObject *data;
     int fix_imports = 1;
     const char *encoding = "ASCII";
     const char *errors = "strict";
+    PyObject *buffers = NULL;
 
     if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, &_parser,
-        &data, &fix_imports, &encoding, &errors)) {
+        &data, &fix_imports, &encoding, &errors, &buffers)) {
         goto exit;
     }
-    return_value = _pickle_loads_impl(module, data, fix_imports, encoding, errors);
+    return_value = _pickle_loads_impl(module, data, fix_imports, encoding, errors, buffers);
 
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=225f06abcf27ed2b input=a9049054013a1b77]*/
+/*[clinic end generated code: output=d971508a13d9a716 input=a9049054013a1b77]*/
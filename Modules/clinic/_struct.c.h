@@ -133,6 +133,51 @@ PyDoc_STRVAR(Struct_iter_unpack__doc__,
 #define STRUCT_ITER_UNPACK_METHODDEF    \
     {"iter_unpack", (PyCFunction)Struct_iter_unpack, METH_O, Struct_iter_unpack__doc__},
 
+PyDoc_STRVAR(Struct_unpack_columns__doc__,
+"unpack_columns($self, /, buffer, offset=0, count=-1)\n"
+"--\n"
+"\n"
+"Return a tuple of columns of values unpacked from consecutive records.\n"
+"\n"
+"Unpacks count records starting at position offset, or all of them if count\n"
+"is negative, in which case the buffer\'s size in bytes, starting at offset,\n"
+"must be a multiple of Struct.size.  Each field gives a memoryview of the\n"
+"native C type of the same size; \'s\' and \'p\' fields give lists of bytes.\n"
+"\n"
+"See help(struct) for more on format strings.");
+
+#define STRUCT_UNPACK_COLUMNS_METHODDEF    \
+    {"unpack_columns", (PyCFunction)(void(*)(void))Struct_unpack_columns, METH_FASTCALL|METH_KEYWORDS, Struct_unpack_columns__doc__},
+
+static PyObject *
+Struct_unpack_columns_impl(PyStructObject *self, Py_buffer *buffer,
+                           Py_ssize_t offset, Py_ssize_t count);
+
+static PyObject *
+Struct_unpack_columns(PyStructObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    static const char * const _keywords[] = {"buffer", "offset", "count", NULL};
+    static _PyArg_Parser _parser = {"y*|nn:unpack_columns", _keywords, 0};
+    Py_buffer buffer = {NULL, NULL};
+    Py_ssize_t offset = 0;
+    Py_ssize_t count = -1;
+
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, &_parser,
+        &buffer, &offset, &count)) {
+        goto exit;
+    }
+    return_value = Struct_unpack_columns_impl(self, &buffer, offset, count);
+
+exit:
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
 PyDoc_STRVAR(_clearcache__doc__,
 "_clearcache($module, /)\n"
 "--\n"
@@ -319,4 +364,47 @@ exit:
 
     return return_value;
 }
-/*[clinic end generated code: output=ac595db9d2b271aa input=a9049054013a1b77]*/
+
+PyDoc_STRVAR(unpack_columns__doc__,
+"unpack_columns($module, format, /, buffer, offset=0, count=-1)\n"
+"--\n"
+"\n"
+"Return a tuple of columns of values unpacked from consecutive records.\n"
+"\n"
+"See Struct.unpack_columns() and help(struct) for more.");
+
+#define UNPACK_COLUMNS_METHODDEF    \
+    {"unpack_columns", (PyCFunction)(void(*)(void))unpack_columns, METH_FASTCALL|METH_KEYWORDS, unpack_columns__doc__},
+
+static PyObject *
+unpack_columns_impl(PyObject *module, PyStructObject *s_object,
+                    Py_buffer *buffer, Py_ssize_t offset, Py_ssize_t count);
+
+static PyObject *
+unpack_columns(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    static const char * const _keywords[] = {"", "buffer", "offset", "count", NULL};
+    static _PyArg_Parser _parser = {"O&y*|nn:unpack_columns", _keywords, 0};
+    PyStructObject *s_object = NULL;
+    Py_buffer buffer = {NULL, NULL};
+    Py_ssize_t offset = 0;
+    Py_ssize_t count = -1;
+
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, &_parser,
+        cache_struct_converter, &s_object, &buffer, &offset, &count)) {
+        goto exit;
+    }
+    return_value = unpack_columns_impl(module, s_object, &buffer, offset, count);
+
+exit:
+    /* Cleanup for s_object */
+    Py_XDECREF(s_object);
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+/*[clinic end generated code: output=6eee6d14bf1d5be4 input=a9049054013a1b77]*/
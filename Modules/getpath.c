@@ -955,6 +955,14 @@ calculate_path_impl(const _PyCoreConfig *core_config,
     memset(prefix, 0, sizeof(prefix));
     calculate_prefix(core_config, calculate, prefix);
 
+    /* Before it is reduced, prefix is the directory of the landmark */
+    if (calculate->prefix_found) {
+        config->stdlib_dir = _PyMem_RawWcsdup(prefix);
+        if (config->stdlib_dir == NULL) {
+            return _Py_INIT_NO_MEMORY();
+        }
+    }
+
     calculate_zip_path(calculate, prefix);
 
     wchar_t exec_prefix[MAXPATHLEN+1];
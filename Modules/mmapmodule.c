@@ -107,6 +107,7 @@ typedef struct {
 
 #ifdef UNIX
     int fd;
+    int trackfd;        /* False if the mapped file has no descriptor */
 #endif
 
     PyObject *weakreflist;
@@ -430,6 +431,12 @@ mmap_size_method(mmap_object *self,
 #ifdef UNIX
     {
         struct _Py_stat_struct status;
+        if (!self->trackfd) {
+            PyErr_SetString(PyExc_ValueError,
+                            "mmap: the size of a file mapped with "
+                            "trackfd=False is unknown");
+            return NULL;
+        }
         if (_Py_fstat(self->fd, &status) == -1)
             return NULL;
 #ifdef HAVE_LARGEFILE_SUPPORT
@@ -521,6 +528,12 @@ mmap_resize_method(mmap_object *self,
 #else
         void *newmap;
 
+        if (!self->trackfd) {
+            PyErr_SetString(PyExc_ValueError,
+                            "mmap: cannot resize a file mapped with "
+                            "trackfd=False");
+            return NULL;
+        }
         if (self->fd != -1 && ftruncate(self->fd, self->offset + new_size) == -1) {
             PyErr_SetFromErrno(PyExc_OSError);
             return NULL;
@@ -966,7 +979,8 @@ is 0, the maximum length of the map is the current size of the file,\n\
 except that if the file is empty Windows raises an exception (you cannot\n\
 create an empty mapping on Windows).\n\
 \n\
-Unix: mmap(fileno, length[, flags[, prot[, access[, offset]]]])\n\
+Unix: mmap(fileno, length[, flags[, prot[, access[, offset]]]],\n\
+           *, trackfd=True)\n\
 \n\
 Maps length bytes from the file specified by the file descriptor fileno,\n\
 and returns a mmap object.  If length is 0, the maximum length of the map\n\
@@ -976,6 +990,8 @@ private copy-on-write mapping, so changes to the contents of the mmap\n\
 object will be private to this process, and MAP_SHARED creates a mapping\n\
 that's shared with all other processes mapping the same areas of the file.\n\
 The default value is MAP_SHARED.\n\
+If trackfd is false, fileno is not duplicated and size() and resize()\n\
+cannot be used.\n\
 \n\
 To map anonymous memory, pass -1 as the fileno (both versions).");
 
@@ -1041,14 +1057,15 @@ new_mmap_object(PyTypeObject *type, PyObject *args, PyObject *kwdict)
     off_t offset = 0;
     int fd, flags = MAP_SHARED, prot = PROT_WRITE | PROT_READ;
     int devzero = -1;
-    int access = (int)ACCESS_DEFAULT;
+    int access = (int)ACCESS_DEFAULT, trackfd = 1;
     static char *keywords[] = {"fileno", "length",
                                "flags", "prot",
-                               "access", "offset", NULL};
+                               "access", "offset", "trackfd", NULL};
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwdict, "in|iii" _Py_PARSE_OFF_T, keywords,
+    if (!PyArg_ParseTupleAndKeywords(args, kwdict,
+                                     "in|iii" _Py_PARSE_OFF_T "$p", keywords,
                                      &fd, &map_size, &flags, &prot,
-                                     &access, &offset))
+                                     &access, &offset, &trackfd))
         return NULL;
     if (map_size < 0) {
         PyErr_SetString(PyExc_OverflowError,
@@ -1140,6 +1157,7 @@ new_mmap_object(PyTypeObject *type, PyObject *args, PyObject *kwdict)
     m_obj->weakreflist = NULL;
     m_obj->exports = 0;
     m_obj->offset = offset;
+    m_obj->trackfd = 1;
     if (fd == -1) {
         m_obj->fd = -1;
         /* Assume the caller wants to map anonymous memory.
@@ -1158,6 +1176,11 @@ new_mmap_object(PyTypeObject *type, PyObject *args, PyObject *kwdict)
         }
 #endif
     }
+    else if (!trackfd) {
+        /* The mapping keeps the file open; don't use up a descriptor. */
+        m_obj->fd = -1;
+        m_obj->trackfd = 0;
+    }
     else {
         m_obj->fd = _Py_dup(fd);
         if (m_obj->fd == -1) {
@@ -2,6 +2,7 @@
 
 #include "Python.h"
 #include "code.h"
+#include "marshal.h"
 #include "structmember.h"
 #include "pycore_pystate.h"
 #include "pycore_tupleobject.h"
@@ -95,13 +96,16 @@ intern_string_constants(PyObject *tuple)
 }
 
 
-PyCodeObject *
-PyCode_New(int argcount, int kwonlyargcount,
-           int nlocals, int stacksize, int flags,
-           PyObject *code, PyObject *consts, PyObject *names,
-           PyObject *varnames, PyObject *freevars, PyObject *cellvars,
-           PyObject *filename, PyObject *name, int firstlineno,
-           PyObject *lnotab)
+/* Create a code object.  If buffer is not NULL, code, consts, names and
+   lnotab are NULL and will be read from buffer by _PyCode_Materialize(). */
+static PyCodeObject *
+code_create(int argcount, int kwonlyargcount,
+            int nlocals, int stacksize, int flags,
+            PyObject *code, PyObject *consts, PyObject *names,
+            PyObject *varnames, PyObject *freevars, PyObject *cellvars,
+            PyObject *filename, PyObject *name, int firstlineno,
+            PyObject *lnotab, PyObject *buffer, Py_ssize_t offset,
+            Py_ssize_t size)
 {
     PyCodeObject *co;
     Py_ssize_t *cell2arg = NULL;
@@ -109,15 +113,20 @@ PyCode_New(int argcount, int kwonlyargcount,
 
     /* Check argument types */
     if (argcount < 0 || kwonlyargcount < 0 || nlocals < 0 ||
-        code == NULL || !PyBytes_Check(code) ||
-        consts == NULL || !PyTuple_Check(consts) ||
-        names == NULL || !PyTuple_Check(names) ||
         varnames == NULL || !PyTuple_Check(varnames) ||
         freevars == NULL || !PyTuple_Check(freevars) ||
         cellvars == NULL || !PyTuple_Check(cellvars) ||
         name == NULL || !PyUnicode_Check(name) ||
-        filename == NULL || !PyUnicode_Check(filename) ||
-        lnotab == NULL || !PyBytes_Check(lnotab)) {
+        filename == NULL || !PyUnicode_Check(filename)) {
+        PyErr_BadInternalCall();
+        return NULL;
+    }
+    if (buffer == NULL ?
+        (code == NULL || !PyBytes_Check(code) ||
+         consts == NULL || !PyTuple_Check(consts) ||
+         names == NULL || !PyTuple_Check(names) ||
+         lnotab == NULL || !PyBytes_Check(lnotab)) :
+        (!PyMemoryView_Check(buffer) || offset < 0 || size < 0)) {
         PyErr_BadInternalCall();
         return NULL;
     }
@@ -126,11 +135,13 @@ PyCode_New(int argcount, int kwonlyargcount,
     if (PyUnicode_READY(filename) < 0)
         return NULL;
 
-    intern_strings(names);
+    if (buffer == NULL) {
+        intern_strings(names);
+        intern_string_constants(consts);
+    }
     intern_strings(varnames);
     intern_strings(freevars);
     intern_strings(cellvars);
-    intern_string_constants(consts);
 
     /* Check for any inner or outer closure references */
     n_cellvars = PyTuple_GET_SIZE(cellvars);
@@ -197,11 +208,11 @@ PyCode_New(int argcount, int kwonlyargcount,
     co->co_nlocals = nlocals;
     co->co_stacksize = stacksize;
     co->co_flags = flags;
-    Py_INCREF(code);
+    Py_XINCREF(code);
     co->co_code = code;
-    Py_INCREF(consts);
+    Py_XINCREF(consts);
     co->co_consts = consts;
-    Py_INCREF(names);
+    Py_XINCREF(names);
     co->co_names = names;
     Py_INCREF(varnames);
     co->co_varnames = varnames;
@@ -215,14 +226,102 @@ PyCode_New(int argcount, int kwonlyargcount,
     Py_INCREF(name);
     co->co_name = name;
     co->co_firstlineno = firstlineno;
-    Py_INCREF(lnotab);
+    Py_XINCREF(lnotab);
     co->co_lnotab = lnotab;
     co->co_zombieframe = NULL;
     co->co_weakreflist = NULL;
     co->co_extra = NULL;
+    Py_XINCREF(buffer);
+    co->co_lazybuf = buffer;
+    co->co_lazyoffset = offset;
+    co->co_lazysize = size;
     return co;
 }
 
+PyCodeObject *
+PyCode_New(int argcount, int kwonlyargcount,
+           int nlocals, int stacksize, int flags,
+           PyObject *code, PyObject *consts, PyObject *names,
+           PyObject *varnames, PyObject *freevars, PyObject *cellvars,
+           PyObject *filename, PyObject *name, int firstlineno,
+           PyObject *lnotab)
+{
+    return code_create(argcount, kwonlyargcount, nlocals, stacksize, flags,
+                       code, consts, names, varnames, freevars, cellvars,
+                       filename, name, firstlineno, lnotab, NULL, 0, 0);
+}
+
+PyCodeObject *
+_PyCode_NewLazy(int argcount, int kwonlyargcount,
+                int nlocals, int stacksize, int flags,
+                PyObject *varnames, PyObject *freevars, PyObject *cellvars,
+                PyObject *filename, PyObject *name, int firstlineno,
+                PyObject *buffer, Py_ssize_t offset, Py_ssize_t size)
+{
+    if (buffer == NULL) {
+        PyErr_BadInternalCall();
+        return NULL;
+    }
+    return code_create(argcount, kwonlyargcount, nlocals, stacksize, flags,
+                       NULL, NULL, NULL, varnames, freevars, cellvars,
+                       filename, name, firstlineno, NULL,
+                       buffer, offset, size);
+}
+
+int
+_PyCode_Materialize(PyCodeObject *co)
+{
+    PyObject *buffer = co->co_lazybuf;
+    PyObject *code, *consts, *names, *lnotab;
+    int res;
+
+    if (buffer == NULL)
+        return 0;
+    /* Reading may run arbitrary code through the GC, which may load co
+       and release the last reference to the buffer. */
+    Py_INCREF(buffer);
+    res = _PyMarshal_ReadCodeBody(buffer, co->co_lazyoffset, co->co_lazysize,
+                                  co->co_filename,
+                                  &code, &consts, &names, &lnotab);
+    Py_DECREF(buffer);
+    if (res < 0)
+        return -1;
+    if (!PyBytes_CheckExact(code) || !PyTuple_CheckExact(consts) ||
+        !PyTuple_CheckExact(names) || !PyBytes_CheckExact(lnotab)) {
+        PyErr_SetString(PyExc_ValueError,
+                        "bad marshal data (invalid lazy code object)");
+        goto error;
+    }
+    for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(names); i++) {
+        if (!PyUnicode_CheckExact(PyTuple_GET_ITEM(names, i))) {
+            PyErr_SetString(PyExc_ValueError,
+                            "bad marshal data (invalid lazy code object)");
+            goto error;
+        }
+    }
+    if (co->co_lazybuf == NULL) {
+        /* Loaded while we were reading */
+        goto done;
+    }
+    intern_strings(names);
+    intern_string_constants(consts);
+    co->co_code = code;
+    co->co_consts = consts;
+    co->co_names = names;
+    co->co_lnotab = lnotab;
+    Py_CLEAR(co->co_lazybuf);
+    return 0;
+
+  error:
+    res = -1;
+  done:
+    Py_DECREF(code);
+    Py_DECREF(consts);
+    Py_DECREF(names);
+    Py_DECREF(lnotab);
+    return res;
+}
+
 PyCodeObject *
 PyCode_NewEmpty(const char *filename, const char *funcname, int firstlineno)
 {
@@ -279,16 +378,55 @@ static PyMemberDef code_memberlist[] = {
     {"co_nlocals",      T_INT,          OFF(co_nlocals),        READONLY},
     {"co_stacksize",T_INT,              OFF(co_stacksize),      READONLY},
     {"co_flags",        T_INT,          OFF(co_flags),          READONLY},
-    {"co_code",         T_OBJECT,       OFF(co_code),           READONLY},
-    {"co_consts",       T_OBJECT,       OFF(co_consts),         READONLY},
-    {"co_names",        T_OBJECT,       OFF(co_names),          READONLY},
     {"co_varnames",     T_OBJECT,       OFF(co_varnames),       READONLY},
     {"co_freevars",     T_OBJECT,       OFF(co_freevars),       READONLY},
     {"co_cellvars",     T_OBJECT,       OFF(co_cellvars),       READONLY},
     {"co_filename",     T_OBJECT,       OFF(co_filename),       READONLY},
     {"co_name",         T_OBJECT,       OFF(co_name),           READONLY},
     {"co_firstlineno", T_INT,           OFF(co_firstlineno),    READONLY},
-    {"co_lnotab",       T_OBJECT,       OFF(co_lnotab),         READONLY},
+    {NULL}      /* Sentinel */
+};
+
+/* The fields which are not loaded yet in lazily loaded code objects */
+
+static PyObject *
+code_get_lazy_field(PyCodeObject *co, PyObject **field)
+{
+    if (_PyCode_MATERIALIZE(co) < 0)
+        return NULL;
+    Py_INCREF(*field);
+    return *field;
+}
+
+static PyObject *
+code_getcode(PyCodeObject *co, void *Py_UNUSED(ignored))
+{
+    return code_get_lazy_field(co, &co->co_code);
+}
+
+static PyObject *
+code_getconsts(PyCodeObject *co, void *Py_UNUSED(ignored))
+{
+    return code_get_lazy_field(co, &co->co_consts);
+}
+
+static PyObject *
+code_getnames(PyCodeObject *co, void *Py_UNUSED(ignored))
+{
+    return code_get_lazy_field(co, &co->co_names);
+}
+
+static PyObject *
+code_getlnotab(PyCodeObject *co, void *Py_UNUSED(ignored))
+{
+    return code_get_lazy_field(co, &co->co_lnotab);
+}
+
+static PyGetSetDef code_getsetlist[] = {
+    {"co_code",         (getter)code_getcode,   NULL, NULL},
+    {"co_consts",       (getter)code_getconsts, NULL, NULL},
+    {"co_names",        (getter)code_getnames,  NULL, NULL},
+    {"co_lnotab",       (getter)code_getlnotab, NULL, NULL},
     {NULL}      /* Sentinel */
 };
 
@@ -453,6 +591,7 @@ code_dealloc(PyCodeObject *co)
     Py_XDECREF(co->co_filename);
     Py_XDECREF(co->co_name);
     Py_XDECREF(co->co_lnotab);
+    Py_XDECREF(co->co_lazybuf);
     if (co->co_cell2arg != NULL)
         PyMem_FREE(co->co_cell2arg);
     if (co->co_zombieframe != NULL)
@@ -643,6 +782,8 @@ code_richcompare(PyObject *self, PyObject *other, int op)
 
     co = (PyCodeObject *)self;
     cp = (PyCodeObject *)other;
+    if (_PyCode_MATERIALIZE(co) < 0 || _PyCode_MATERIALIZE(cp) < 0)
+        return NULL;
 
     eq = PyObject_RichCompareBool(co->co_name, cp->co_name, Py_EQ);
     if (eq <= 0) goto unequal;
@@ -705,6 +846,8 @@ static Py_hash_t
 code_hash(PyCodeObject *co)
 {
     Py_hash_t h, h0, h1, h2, h3, h4, h5, h6;
+    if (_PyCode_MATERIALIZE(co) < 0)
+        return -1;
     h0 = PyObject_Hash(co->co_name);
     if (h0 == -1) return -1;
     h1 = PyObject_Hash(co->co_code);
@@ -763,7 +906,7 @@ PyTypeObject PyCode_Type = {
     0,                                  /* tp_iternext */
     code_methods,                       /* tp_methods */
     code_memberlist,                    /* tp_members */
-    0,                                  /* tp_getset */
+    code_getsetlist,                    /* tp_getset */
     0,                                  /* tp_base */
     0,                                  /* tp_dict */
     0,                                  /* tp_descr_get */
@@ -781,10 +924,23 @@ PyTypeObject PyCode_Type = {
 int
 PyCode_Addr2Line(PyCodeObject *co, int addrq)
 {
-    Py_ssize_t size = PyBytes_Size(co->co_lnotab) / 2;
-    unsigned char *p = (unsigned char*)PyBytes_AsString(co->co_lnotab);
+    Py_ssize_t size;
+    unsigned char *p;
     int line = co->co_firstlineno;
     int addr = 0;
+    if (co->co_lazybuf != NULL) {
+        /* This function cannot fail, and may be called with an exception
+           set */
+        PyObject *type, *value, *traceback;
+        int res;
+        PyErr_Fetch(&type, &value, &traceback);
+        res = _PyCode_Materialize(co);
+        PyErr_Restore(type, value, traceback);
+        if (res < 0)
+            return line;
+    }
+    size = PyBytes_Size(co->co_lnotab) / 2;
+    p = (unsigned char*)PyBytes_AsString(co->co_lnotab);
     while (--size >= 0) {
         addr += *p++;
         if (addr > addrq)
@@ -46,6 +46,11 @@ struct _dictkeysobject {
     /* Number of used entries in dk_entries. */
     Py_ssize_t dk_nentries;
 
+    /* While a combined keys object is shared, the object which reports
+       its entries to the garbage collector, or NULL: see
+       dictkeys_share(). */
+    PyObject *dk_holder;
+
     /* Actual hash table of dk_size entries. It holds indices in dk_entries,
        or DKIX_EMPTY(-1) or DKIX_DUMMY(-2).
 
@@ -58,7 +63,10 @@ struct _dictkeysobject {
        - 4 bytes if dk_size <= 0xffffffff (int32_t*)
        - 8 bytes otherwise (int64_t*)
 
-       Dynamically sized, SIZEOF_VOID_P is minimum. */
+       Dynamically sized, SIZEOF_VOID_P is minimum.
+
+       With Py_DICT_CONTROL_BYTES, groups of indices are preceded by
+       control bytes: see dictobject.c. */
     char dk_indices[];  /* char is required to avoid strict aliasing. */
 
     /* "PyDictKeyEntry dk_entries[dk_usable];" array follows:
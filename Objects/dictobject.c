@@ -22,6 +22,7 @@ layout:
 | dk_lookup     |
 | dk_usable     |
 | dk_nentries   |
+| dk_holder     |
 +---------------+
 | dk_indices    |
 |               |
@@ -45,6 +46,21 @@ DK_ENTRIES(dk) can be used to get pointer to entries.
 NOTE: Since negative value is used for DKIX_EMPTY and DKIX_DUMMY, type of
 dk_indices entry is signed integer and int16 is used for table which
 dk_size == 256.
+
+When built with Py_DICT_CONTROL_BYTES (experimental), dk_indices is split in
+groups of 16 slots (a single group of dk_size slots when dk_size < 16):
+
++-----------------------------+------------------------------+
+| 16 control bytes (int8)     | 16 indices (DK_IXSIZE bytes) |
++-----------------------------+------------------------------+
+
+The control byte of a slot is DK_CTRL_EMPTY when its index is DKIX_EMPTY,
+DK_CTRL_DELETED when it is DKIX_DUMMY, and otherwise 7 bits of the hash of
+the key (DK_H2()).  Control bytes past dk_size are DK_CTRL_SENTINEL.  The
+hash selects a sequence of groups rather than of slots, and lookups compare
+the 16 control bytes of a group at once, only reading indices and entries
+whose control byte matches; a group with an empty slot ends the search.
+Most collisions and misses are then resolved without touching dk_entries.
 */
 
 
@@ -55,12 +71,17 @@ Either:
   A combined table:
     ma_values == NULL, dk_refcnt == 1.
     Values are stored in the me_value field of the PyDictKeysObject.
+    A frozendict created from a dict shares the keys object of the dict
+    (dk_refcnt > 1) instead of copying it; the dict gets its own copy
+    before its next modification, see dict_unshare_keys().  The entries
+    are reported to the garbage collector by the holder of the shared
+    keys, see dictkeys_share().
 Or:
   A split table:
     ma_values != NULL, dk_refcnt >= 1
-    Values are stored in the ma_values array.
+    Values are stored in the ma_values array, followed by the insertion
+    order of the dict, see values_get_order().
     Only string (unicode) keys are allowed.
-    All dicts sharing same key must have same insertion order.
 
 There are four kinds of slots in the table (slot is index, and
 DK_ENTRIES(keys)[index] if index >= 0):
@@ -96,8 +117,11 @@ dk_nentries to achieve amortized O(1).  Since there are DKIX_DUMMY remains in
 dk_indices, we can't increment dk_usable even though dk_nentries is
 decremented.
 
-In split table, inserting into pending entry is allowed only for dk_entries[ix]
-where ix == mp->ma_used. Inserting into other index and deleting item cause
+In split table, dk_entries holds the keys of all the dicts sharing it, in the
+order in which they were first inserted into any of them.  Each dict records
+its own insertion order as ma_used indices into dk_entries, stored after its
+values.  A key can be inserted into a pending entry or deleted in any order,
+and a new key can be added to the shared keys while they have room, without
 converting the dict to the combined table.
 */
 
@@ -113,13 +137,15 @@ converting the dict to the combined table.
 #include "Python.h"
 #include "pycore_object.h"
 #include "pycore_pystate.h"
+#include "pycore_simd.h"
 #include "dict-common.h"
 #include "stringlib/eq.h"    /* to get unicode_eq() */
 
 /*[clinic input]
 class dict "PyDictObject *" "&PyDict_Type"
+class frozendict "PyDictObject *" "&PyFrozenDict_Type"
 [clinic start generated code]*/
-/*[clinic end generated code: output=da39a3ee5e6b4b0d input=f157a5a0ce9589d6]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=8a8459cbf30481b7]*/
 
 
 /*
@@ -235,6 +261,7 @@ static Py_ssize_t lookdict_split(PyDictObject *mp, PyObject *key,
                                  Py_hash_t hash, PyObject **value_addr);
 
 static int dictresize(PyDictObject *mp, Py_ssize_t minused);
+static int split_keys_resize(PyDictObject *mp);
 
 static PyObject* dict_iter(PyDictObject *dict);
 
@@ -281,6 +308,17 @@ _PyDict_DebugMallocStats(FILE *out)
 }
 
 
+/* Number of split tables converted to combined tables since startup, see
+   sys._getsplitdictconversions() */
+static Py_ssize_t split_conversions = 0;
+
+Py_ssize_t
+_PyDict_GetSplitConversions(void)
+{
+    return split_conversions;
+}
+
+
 void
 PyDict_Fini(void)
 {
@@ -300,13 +338,40 @@ PyDict_Fini(void)
         1 : DK_SIZE(dk) <= 0xffff ?            \
             2 : sizeof(int32_t))
 #endif
+#ifdef Py_DICT_CONTROL_BYTES
+#define DK_GROUP_WIDTH 16
+#define DK_CTRL_EMPTY ((int8_t)-128)
+#define DK_CTRL_DELETED ((int8_t)-2)
+#define DK_CTRL_SENTINEL ((int8_t)-1)
+/* Control byte of an active slot: the low bits of the hash, which tell
+   apart consecutive integers, mixed with its high bits */
+#define DK_H2(hash) \
+    ((int8_t)(((size_t)(hash) ^ \
+               ((size_t)(hash) >> (8 * SIZEOF_SIZE_T - 7))) & 0x7f))
+#define DK_GROUP_SLOTS(dk) Py_MIN(DK_SIZE(dk), DK_GROUP_WIDTH)
+#define DK_GROUP_MASK(dk) \
+    (DK_SIZE(dk) > DK_GROUP_WIDTH ? \
+        (size_t)DK_SIZE(dk) / DK_GROUP_WIDTH - 1 : 0)
+#define DK_GROUP_BYTES(dk) \
+    (DK_GROUP_WIDTH + DK_GROUP_SLOTS(dk) * DK_IXSIZE(dk))
+#define DK_INDICES_SIZE(dk) \
+    ((DK_GROUP_MASK(dk) + 1) * DK_GROUP_BYTES(dk))
+#define DK_CTRL(dk, g) \
+    (&((int8_t*)((dk)->dk_indices))[(g) * DK_GROUP_BYTES(dk)])
+/* Same as DK_CTRL() with DK_GROUP_BYTES(dk) computed once by the caller */
+#define DK_CTRL_AT(dk, g, gbytes) \
+    (&((int8_t*)((dk)->dk_indices))[(g) * (gbytes)])
+#else
+#define DK_INDICES_SIZE(dk) (DK_SIZE(dk) * DK_IXSIZE(dk))
+#endif
 #define DK_ENTRIES(dk) \
-    ((PyDictKeyEntry*)(&((int8_t*)((dk)->dk_indices))[DK_SIZE(dk) * DK_IXSIZE(dk)]))
+    ((PyDictKeyEntry*)(&((int8_t*)((dk)->dk_indices))[DK_INDICES_SIZE(dk)]))
 
 #define DK_MASK(dk) (((dk)->dk_size)-1)
 #define IS_POWER_OF_2(x) (((x) & (x-1)) == 0)
 
 static void free_keys_object(PyDictKeysObject *keys);
+static void dictkeys_release_shared(PyDictKeysObject *dk);
 
 static inline void
 dictkeys_incref(PyDictKeysObject *dk)
@@ -319,6 +384,10 @@ static inline void
 dictkeys_decref(PyDictKeysObject *dk)
 {
     assert(dk->dk_refcnt > 0);
+    if (dk->dk_refcnt > 1 && dk->dk_lookup != lookdict_split) {
+        dictkeys_release_shared(dk);
+        return;
+    }
     _Py_DEC_REFTOTAL;
     if (--dk->dk_refcnt == 0) {
         free_keys_object(dk);
@@ -331,23 +400,29 @@ dictkeys_get_index(PyDictKeysObject *keys, Py_ssize_t i)
 {
     Py_ssize_t s = DK_SIZE(keys);
     Py_ssize_t ix;
+#ifdef Py_DICT_CONTROL_BYTES
+    char *base = (char *)DK_CTRL(keys, i / DK_GROUP_WIDTH) + DK_GROUP_WIDTH;
+    i %= DK_GROUP_WIDTH;
+#else
+    char *base = keys->dk_indices;
+#endif
 
     if (s <= 0xff) {
-        int8_t *indices = (int8_t*)(keys->dk_indices);
+        int8_t *indices = (int8_t*)base;
         ix = indices[i];
     }
     else if (s <= 0xffff) {
-        int16_t *indices = (int16_t*)(keys->dk_indices);
+        int16_t *indices = (int16_t*)base;
         ix = indices[i];
     }
 #if SIZEOF_VOID_P > 4
     else if (s > 0xffffffff) {
-        int64_t *indices = (int64_t*)(keys->dk_indices);
+        int64_t *indices = (int64_t*)base;
         ix = indices[i];
     }
 #endif
     else {
-        int32_t *indices = (int32_t*)(keys->dk_indices);
+        int32_t *indices = (int32_t*)base;
         ix = indices[i];
     }
     assert(ix >= DKIX_DUMMY);
@@ -359,32 +434,140 @@ static inline void
 dictkeys_set_index(PyDictKeysObject *keys, Py_ssize_t i, Py_ssize_t ix)
 {
     Py_ssize_t s = DK_SIZE(keys);
+#ifdef Py_DICT_CONTROL_BYTES
+    int8_t *ctrl = DK_CTRL(keys, i / DK_GROUP_WIDTH);
+    char *base = (char *)ctrl + DK_GROUP_WIDTH;
+    i %= DK_GROUP_WIDTH;
+    /* active slots get their control byte from dictkeys_set_hash_index() */
+    if (ix == DKIX_EMPTY)
+        ctrl[i] = DK_CTRL_EMPTY;
+    else if (ix == DKIX_DUMMY)
+        ctrl[i] = DK_CTRL_DELETED;
+#else
+    char *base = keys->dk_indices;
+#endif
 
     assert(ix >= DKIX_DUMMY);
 
     if (s <= 0xff) {
-        int8_t *indices = (int8_t*)(keys->dk_indices);
+        int8_t *indices = (int8_t*)base;
         assert(ix <= 0x7f);
         indices[i] = (char)ix;
     }
     else if (s <= 0xffff) {
-        int16_t *indices = (int16_t*)(keys->dk_indices);
+        int16_t *indices = (int16_t*)base;
         assert(ix <= 0x7fff);
         indices[i] = (int16_t)ix;
     }
 #if SIZEOF_VOID_P > 4
     else if (s > 0xffffffff) {
-        int64_t *indices = (int64_t*)(keys->dk_indices);
+        int64_t *indices = (int64_t*)base;
         indices[i] = ix;
     }
 #endif
     else {
-        int32_t *indices = (int32_t*)(keys->dk_indices);
+        int32_t *indices = (int32_t*)base;
         assert(ix <= 0x7fffffff);
         indices[i] = (int32_t)ix;
     }
 }
 
+/* write the index of a new entry with the given hash to indices. */
+static inline void
+dictkeys_set_hash_index(PyDictKeysObject *keys, Py_ssize_t i, Py_ssize_t ix,
+                        Py_hash_t hash)
+{
+    assert(ix >= 0);
+#ifdef Py_DICT_CONTROL_BYTES
+    DK_CTRL(keys, i / DK_GROUP_WIDTH)[i % DK_GROUP_WIDTH] = DK_H2(hash);
+#endif
+    dictkeys_set_index(keys, i, ix);
+}
+
+#ifdef Py_DICT_CONTROL_BYTES
+/* Bit masks of the slots of a group (ctrl points to its control bytes)
+   holding an entry with the given DK_H2(), that are empty, and that are
+   empty or deleted. */
+static inline unsigned int
+dk_ctrl_match(const int8_t *ctrl, int8_t h2)
+{
+#ifdef _Py_HAVE_SSE2
+    __m128i c = _mm_loadu_si128((const __m128i *)ctrl);
+    return (unsigned int)_mm_movemask_epi8(
+        _mm_cmpeq_epi8(c, _mm_set1_epi8(h2)));
+#else
+    unsigned int bits = 0;
+    for (int k = 0; k < DK_GROUP_WIDTH; k++) {
+        bits |= (unsigned int)(ctrl[k] == h2) << k;
+    }
+    return bits;
+#endif
+}
+
+/* Index stored in slot k of the group of a table of size s */
+static inline Py_ssize_t
+dk_group_get_index(const int8_t *ctrl, Py_ssize_t s, int k)
+{
+    const char *base = (const char *)ctrl + DK_GROUP_WIDTH;
+    if (s <= 0xff) {
+        return ((const int8_t*)base)[k];
+    }
+    else if (s <= 0xffff) {
+        return ((const int16_t*)base)[k];
+    }
+#if SIZEOF_VOID_P > 4
+    else if (s > 0xffffffff) {
+        return ((const int64_t*)base)[k];
+    }
+#endif
+    else {
+        return ((const int32_t*)base)[k];
+    }
+}
+
+static inline unsigned int
+dk_ctrl_empty(const int8_t *ctrl)
+{
+    return dk_ctrl_match(ctrl, DK_CTRL_EMPTY);
+}
+
+static inline unsigned int
+dk_ctrl_free(const int8_t *ctrl)
+{
+#ifdef _Py_HAVE_SSE2
+    __m128i c = _mm_loadu_si128((const __m128i *)ctrl);
+    return (unsigned int)_mm_movemask_epi8(
+        _mm_cmpgt_epi8(_mm_set1_epi8(DK_CTRL_SENTINEL), c));
+#else
+    unsigned int bits = 0;
+    for (int k = 0; k < DK_GROUP_WIDTH; k++) {
+        bits |= (unsigned int)(ctrl[k] < DK_CTRL_SENTINEL) << k;
+    }
+    return bits;
+#endif
+}
+
+/* First group of the probe sequence of hash, and the next one.  Like the
+   slot sequence described above, it eventually visits every group. */
+#define DK_FIRST_GROUP(hash, gmask) (((size_t)(hash) / DK_GROUP_WIDTH) & (gmask))
+#define DK_NEXT_GROUP(g, perturb, gmask) \
+    ((perturb) >>= PERTURB_SHIFT, ((g)*5 + (perturb) + 1) & (gmask))
+
+/* Empty every slot of a new keys object */
+static void
+dk_init_ctrl(PyDictKeysObject *dk)
+{
+    Py_ssize_t slots = DK_GROUP_SLOTS(dk);
+    size_t g, gmask = DK_GROUP_MASK(dk);
+    for (g = 0; g <= gmask; g++) {
+        int8_t *ctrl = DK_CTRL(dk, g);
+        memset(ctrl, DK_CTRL_EMPTY, slots);
+        memset(ctrl + slots, DK_CTRL_SENTINEL, DK_GROUP_WIDTH - slots);
+        memset(ctrl + DK_GROUP_WIDTH, 0xff, slots * DK_IXSIZE(dk));
+    }
+}
+#endif
+
 
 /* USABLE_FRACTION is the maximum dictionary load.
  * Increasing this ratio makes dictionaries more dense resulting in more
@@ -438,14 +621,124 @@ static PyDictKeysObject empty_keys_struct = {
         lookdict_split, /* dk_lookup */
         0, /* dk_usable (immutable) */
         0, /* dk_nentries */
+        NULL, /* dk_holder */
+#ifdef Py_DICT_CONTROL_BYTES
+        {DK_CTRL_EMPTY, DK_CTRL_SENTINEL, DK_CTRL_SENTINEL, DK_CTRL_SENTINEL,
+         DK_CTRL_SENTINEL, DK_CTRL_SENTINEL, DK_CTRL_SENTINEL, DK_CTRL_SENTINEL,
+         DK_CTRL_SENTINEL, DK_CTRL_SENTINEL, DK_CTRL_SENTINEL, DK_CTRL_SENTINEL,
+         DK_CTRL_SENTINEL, DK_CTRL_SENTINEL, DK_CTRL_SENTINEL, DK_CTRL_SENTINEL,
+         DKIX_EMPTY}, /* dk_indices */
+#else
         {DKIX_EMPTY, DKIX_EMPTY, DKIX_EMPTY, DKIX_EMPTY,
          DKIX_EMPTY, DKIX_EMPTY, DKIX_EMPTY, DKIX_EMPTY}, /* dk_indices */
+#endif
 };
 
 static PyObject *empty_values[1] = { NULL };
 
 #define Py_EMPTY_KEYS &empty_keys_struct
 
+/* The values array of a split table has one slot per usable entry of its
+   keys, and is followed by the insertion order: the indices of the ma_used
+   values which are set, in the order they were set, each as wide as an
+   index of the hash table. */
+#define DK_VALUES_SIZE(dk) \
+    (USABLE_FRACTION(DK_SIZE(dk)) * (sizeof(PyObject *) + DK_IXSIZE(dk)))
+#define new_values(keys) ((PyObject **)PyMem_MALLOC(DK_VALUES_SIZE(keys)))
+
+/* Split tables are resized as split tables while their shared keys are
+   smaller than this; larger ones are converted to combined tables.  Every
+   value array is as large as the shared keys, so that a class whose
+   instances use many different attribute names does not make them all pay
+   for all the names. */
+#define SHARED_KEYS_MAX_SIZE 64
+#define free_values(values) PyMem_FREE(values)
+
+/* Index of the i-th value inserted in the values array of a split table
+   using the given keys */
+static inline Py_ssize_t
+values_get_order(PyDictKeysObject *keys, PyObject **values, Py_ssize_t i)
+{
+    Py_ssize_t s = DK_SIZE(keys);
+    void *order = values + USABLE_FRACTION(s);
+
+    assert(0 <= i && i < USABLE_FRACTION(s));
+    if (s <= 0xff) {
+        return ((int8_t *)order)[i];
+    }
+    else if (s <= 0xffff) {
+        return ((int16_t *)order)[i];
+    }
+#if SIZEOF_VOID_P > 4
+    else if (s > 0xffffffff) {
+        return ((int64_t *)order)[i];
+    }
+#endif
+    else {
+        return ((int32_t *)order)[i];
+    }
+}
+
+static inline void
+values_set_order(PyDictKeysObject *keys, PyObject **values, Py_ssize_t i,
+                 Py_ssize_t ix)
+{
+    Py_ssize_t s = DK_SIZE(keys);
+    void *order = values + USABLE_FRACTION(s);
+
+    assert(0 <= i && i < USABLE_FRACTION(s));
+    assert(0 <= ix && ix < USABLE_FRACTION(s));
+    if (s <= 0xff) {
+        ((int8_t *)order)[i] = (int8_t)ix;
+    }
+    else if (s <= 0xffff) {
+        ((int16_t *)order)[i] = (int16_t)ix;
+    }
+#if SIZEOF_VOID_P > 4
+    else if (s > 0xffffffff) {
+        ((int64_t *)order)[i] = ix;
+    }
+#endif
+    else {
+        ((int32_t *)order)[i] = (int32_t)ix;
+    }
+}
+
+/* Set the value of the pending entry ix of the split table mp, which takes
+   the reference to value, and append ix to its insertion order. */
+static void
+split_insert_value(PyDictObject *mp, Py_ssize_t ix, PyObject *value)
+{
+    assert(mp->ma_values[ix] == NULL);
+    mp->ma_values[ix] = value;
+    values_set_order(mp->ma_keys, mp->ma_values, mp->ma_used, ix);
+    mp->ma_used++;
+}
+
+/* Clear the value of entry ix of the split table mp, and remove ix from its
+   insertion order.  The key stays in the shared keys, as a pending entry of
+   mp.  Return the reference to the value held by mp. */
+static PyObject *
+split_delete_value(PyDictObject *mp, Py_ssize_t ix)
+{
+    PyDictKeysObject *keys = mp->ma_keys;
+    PyObject **values = mp->ma_values;
+    Py_ssize_t i = mp->ma_used - 1;
+    Py_ssize_t next = values_get_order(keys, values, i);
+    PyObject *value = values[ix];
+
+    assert(value != NULL);
+    /* Search from the end, where the latest attributes are */
+    while (next != ix) {
+        Py_ssize_t cur = values_get_order(keys, values, --i);
+        values_set_order(keys, values, i, next);
+        next = cur;
+    }
+    values[ix] = NULL;
+    mp->ma_used--;
+    return value;
+}
+
 /* Uncomment to check the dict content in _PyDict_CheckConsistency() */
 /* #define DEBUG_PYDICT */
 
@@ -472,9 +765,13 @@ _PyDict_CheckConsistency(PyDictObject *mp)
            && keys->dk_nentries <= usable);
     ASSERT(keys->dk_usable + keys->dk_nentries <= usable);
 
-    if (!splitted) {
-        /* combined table */
-        ASSERT(keys->dk_refcnt == 1);
+    if (keys->dk_refcnt > 1 && !splitted) {
+        /* combined table shared with a frozendict */
+        ASSERT(keys != Py_EMPTY_KEYS);
+        ASSERT(keys->dk_holder != NULL);
+    }
+    else {
+        ASSERT(keys->dk_holder == NULL);
     }
 
 #ifdef DEBUG_PYDICT
@@ -509,8 +806,16 @@ _PyDict_CheckConsistency(PyDictObject *mp)
 
     if (splitted) {
         /* splitted table */
+        Py_ssize_t nvalues = 0;
+        for (i=0; i < keys->dk_nentries; i++) {
+            if (mp->ma_values[i] != NULL) {
+                nvalues++;
+            }
+        }
+        ASSERT(nvalues == mp->ma_used);
         for (i=0; i < mp->ma_used; i++) {
-            ASSERT(mp->ma_values[i] != NULL);
+            ASSERT(mp->ma_values[values_get_order(keys, mp->ma_values, i)]
+                   != NULL);
         }
     }
 #endif
@@ -525,7 +830,7 @@ _PyDict_CheckConsistency(PyDictObject *mp)
 static PyDictKeysObject *new_keys_object(Py_ssize_t size)
 {
     PyDictKeysObject *dk;
-    Py_ssize_t es, usable;
+    Py_ssize_t es, usable, indices_size;
 
     assert(size >= PyDict_MINSIZE);
     assert(IS_POWER_OF_2(size));
@@ -545,13 +850,19 @@ static PyDictKeysObject *new_keys_object(Py_ssize_t size)
     else {
         es = sizeof(Py_ssize_t);
     }
+#ifdef Py_DICT_CONTROL_BYTES
+    indices_size = (size / Py_MIN(size, DK_GROUP_WIDTH)) * DK_GROUP_WIDTH
+                   + es * size;
+#else
+    indices_size = es * size;
+#endif
 
     if (size == PyDict_MINSIZE && numfreekeys > 0) {
         dk = keys_free_list[--numfreekeys];
     }
     else {
         dk = PyObject_MALLOC(sizeof(PyDictKeysObject)
-                             + es * size
+                             + indices_size
                              + sizeof(PyDictKeyEntry) * usable);
         if (dk == NULL) {
             PyErr_NoMemory();
@@ -564,7 +875,12 @@ static PyDictKeysObject *new_keys_object(Py_ssize_t size)
     dk->dk_usable = usable;
     dk->dk_lookup = lookdict_unicode_nodummy;
     dk->dk_nentries = 0;
+    dk->dk_holder = NULL;
+#ifdef Py_DICT_CONTROL_BYTES
+    dk_init_ctrl(dk);
+#else
     memset(&dk->dk_indices[0], 0xff, es * size);
+#endif
     memset(DK_ENTRIES(dk), 0, sizeof(PyDictKeyEntry) * usable);
     return dk;
 }
@@ -585,8 +901,118 @@ free_keys_object(PyDictKeysObject *keys)
     PyObject_FREE(keys);
 }
 
-#define new_values(size) PyMem_NEW(PyObject *, size)
-#define free_values(values) PyMem_FREE(values)
+/* The entries of a shared combined keys object hold a single reference to
+   their keys and values for all the dicts sharing it, so these dicts must
+   not visit them in tp_traverse.  They are visited by a holder object
+   instead: each dict sharing the keys holds a reference to the holder and
+   visits it, and the holder visits the entries once.  The holder does not
+   own the keys object, it only exists while the keys are shared. */
+typedef struct {
+    PyObject_HEAD
+    PyDictKeysObject *keys;     /* NULL once the keys are not shared */
+} dictkeysholderobject;
+
+/* Add a dict or frozendict to the holders of the combined keys object dk.
+   This is O(1) and doesn't write to the entries.  Return -1 on error. */
+static int
+dictkeys_share(PyDictKeysObject *dk)
+{
+    assert(dk->dk_lookup != lookdict_split);
+    if (dk->dk_holder == NULL) {
+        dictkeysholderobject *holder;
+
+        assert(dk->dk_refcnt == 1);
+        holder = PyObject_GC_New(dictkeysholderobject,
+                                 &_PyDictKeysHolder_Type);
+        if (holder == NULL) {
+            return -1;
+        }
+        holder->keys = dk;
+        /* One reference for the dict which already has dk, one for the
+           new one. */
+        Py_INCREF(holder);
+        dk->dk_holder = (PyObject *)holder;
+        _PyObject_GC_TRACK(holder);
+    }
+    else {
+        Py_INCREF(dk->dk_holder);
+    }
+    dictkeys_incref(dk);
+    return 0;
+}
+
+/* Remove one of the dicts sharing the combined keys object dk.  When a
+   single one is left, it visits the entries itself again. */
+static void
+dictkeys_release_shared(PyDictKeysObject *dk)
+{
+    PyObject *holder = dk->dk_holder;
+
+    assert(dk->dk_refcnt > 1 && dk->dk_lookup != lookdict_split);
+    assert(holder != NULL);
+    _Py_DEC_REFTOTAL;
+    if (--dk->dk_refcnt == 1) {
+        ((dictkeysholderobject *)holder)->keys = NULL;
+        dk->dk_holder = NULL;
+        Py_DECREF(holder);
+    }
+    Py_DECREF(holder);
+}
+
+static void
+dictkeysholder_dealloc(dictkeysholderobject *holder)
+{
+    assert(holder->keys == NULL);
+    PyObject_GC_UnTrack(holder);
+    PyObject_GC_Del(holder);
+}
+
+static int
+dictkeysholder_traverse(dictkeysholderobject *holder, visitproc visit,
+                        void *arg)
+{
+    PyDictKeysObject *keys = holder->keys;
+    PyDictKeyEntry *entries;
+    Py_ssize_t i, n;
+
+    if (keys == NULL) {
+        return 0;
+    }
+    entries = DK_ENTRIES(keys);
+    for (i = 0, n = keys->dk_nentries; i < n; i++) {
+        if (entries[i].me_value != NULL) {
+            Py_VISIT(entries[i].me_value);
+            Py_VISIT(entries[i].me_key);
+        }
+    }
+    return 0;
+}
+
+PyTypeObject _PyDictKeysHolder_Type = {
+    PyVarObject_HEAD_INIT(&PyType_Type, 0)
+    "dict_keys_holder",                         /* tp_name */
+    sizeof(dictkeysholderobject),               /* tp_basicsize */
+    0,                                          /* tp_itemsize */
+    (destructor)dictkeysholder_dealloc,         /* tp_dealloc */
+    0,                                          /* tp_print */
+    0,                                          /* tp_getattr */
+    0,                                          /* tp_setattr */
+    0,                                          /* tp_reserved */
+    0,                                          /* tp_repr */
+    0,                                          /* tp_as_number */
+    0,                                          /* tp_as_sequence */
+    0,                                          /* tp_as_mapping */
+    0,                                          /* tp_hash */
+    0,                                          /* tp_call */
+    0,                                          /* tp_str */
+    PyObject_GenericGetAttr,                    /* tp_getattro */
+    0,                                          /* tp_setattro */
+    0,                                          /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,    /* tp_flags */
+    0,                                          /* tp_doc */
+    (traverseproc)dictkeysholder_traverse,      /* tp_traverse */
+    0,                                          /* tp_clear */
+};
 
 /* Consumes a reference to the keys object */
 static PyObject *
@@ -624,7 +1050,7 @@ new_dict_with_shared_keys(PyDictKeysObject *keys)
     Py_ssize_t i, size;
 
     size = USABLE_FRACTION(DK_SIZE(keys));
-    values = new_values(size);
+    values = new_values(keys);
     if (values == NULL) {
         dictkeys_decref(keys);
         return PyErr_NoMemory();
@@ -636,25 +1062,25 @@ new_dict_with_shared_keys(PyDictKeysObject *keys)
 }
 
 
-static PyObject *
-clone_combined_dict(PyDictObject *orig)
+/* Return a copy of the combined keys object orig, with the same indices
+   and entries. */
+static PyDictKeysObject *
+clone_combined_keys(PyDictKeysObject *orig)
 {
-    assert(PyDict_CheckExact(orig));
-    assert(orig->ma_values == NULL);
-    assert(orig->ma_keys->dk_refcnt == 1);
-
-    Py_ssize_t keys_size = _PyDict_KeysSize(orig->ma_keys);
+    Py_ssize_t keys_size = _PyDict_KeysSize(orig);
     PyDictKeysObject *keys = PyObject_Malloc(keys_size);
     if (keys == NULL) {
         PyErr_NoMemory();
         return NULL;
     }
 
-    memcpy(keys, orig->ma_keys, keys_size);
+    memcpy(keys, orig, keys_size);
+    keys->dk_refcnt = 1;
+    keys->dk_holder = NULL;
 
     /* After copying key/value pairs, we need to incref all
        keys and values and they are about to be co-owned by a
-       new dict object. */
+       new keys object. */
     PyDictKeyEntry *ep0 = DK_ENTRIES(keys);
     Py_ssize_t n = keys->dk_nentries;
     for (Py_ssize_t i = 0; i < n; i++) {
@@ -666,6 +1092,46 @@ clone_combined_dict(PyDictObject *orig)
         }
     }
 
+    /* Since we copied the keys table we now have an extra reference
+       in the system.  Manually call _Py_INC_REFTOTAL to signal that
+       we have it now; calling dictkeys_incref would be an error as
+       keys->dk_refcnt is already set to 1. */
+    _Py_INC_REFTOTAL;
+    return keys;
+}
+
+/* The keys object of a combined dict may be shared with frozendicts, which
+   must not see the modifications of the dict: the dict gets a private copy
+   of the keys object before its first modification.  The copy preserves
+   the position of the entries, so an index returned by a lookup is still
+   valid after the call. */
+#define DICT_KEYS_SHARED(mp) \
+    ((mp)->ma_values == NULL && (mp)->ma_keys->dk_refcnt > 1)
+
+static int
+dict_unshare_keys(PyDictObject *mp)
+{
+    assert(DICT_KEYS_SHARED(mp));
+    PyDictKeysObject *keys = clone_combined_keys(mp->ma_keys);
+    if (keys == NULL) {
+        return -1;
+    }
+    dictkeys_decref(mp->ma_keys);
+    mp->ma_keys = keys;
+    return 0;
+}
+
+static PyObject *
+clone_combined_dict(PyDictObject *orig)
+{
+    assert(PyDict_CheckExact(orig));
+    assert(orig->ma_values == NULL);
+
+    PyDictKeysObject *keys = clone_combined_keys(orig->ma_keys);
+    if (keys == NULL) {
+        return NULL;
+    }
+
     PyDictObject *new = (PyDictObject *)new_dict(keys, NULL);
     if (new == NULL) {
         /* In case of an error, `new_dict()` takes care of
@@ -679,12 +1145,6 @@ clone_combined_dict(PyDictObject *orig)
         _PyObject_GC_TRACK(new);
     }
 
-    /* Since we copied the keys table we now have an extra reference
-       in the system.  Manually call _Py_INC_REFTOTAL to signal that
-       we have it now; calling dictkeys_incref would be an error as
-       keys->dk_refcnt is already set to 1 (after memcpy). */
-    _Py_INC_REFTOTAL;
-
     return (PyObject *)new;
 }
 
@@ -701,6 +1161,30 @@ PyDict_New(void)
 static Py_ssize_t
 lookdict_index(PyDictKeysObject *k, Py_hash_t hash, Py_ssize_t index)
 {
+#ifdef Py_DICT_CONTROL_BYTES
+    Py_ssize_t s = DK_SIZE(k);
+    size_t gbytes = DK_GROUP_BYTES(k);
+    size_t gmask = DK_GROUP_MASK(k);
+    size_t perturb = (size_t)hash;
+    size_t g = DK_FIRST_GROUP(hash, gmask);
+    int8_t h2 = DK_H2(hash);
+
+    for (;;) {
+        const int8_t *ctrl = DK_CTRL_AT(k, g, gbytes);
+        unsigned int bits = dk_ctrl_match(ctrl, h2);
+        while (bits) {
+            int lane = _Py_MASK_FIRST(bits);
+            bits &= bits - 1;
+            if (dk_group_get_index(ctrl, s, lane) == index) {
+                return g * DK_GROUP_WIDTH + lane;
+            }
+        }
+        if (dk_ctrl_empty(ctrl)) {
+            return DKIX_EMPTY;
+        }
+        g = DK_NEXT_GROUP(g, perturb, gmask);
+    }
+#else
     size_t mask = DK_MASK(k);
     size_t perturb = (size_t)hash;
     size_t i = (size_t)hash & mask;
@@ -716,6 +1200,7 @@ lookdict_index(PyDictKeysObject *k, Py_hash_t hash, Py_ssize_t index)
         perturb >>= PERTURB_SHIFT;
         i = mask & (i*5 + perturb + 1);
     }
+#endif
     Py_UNREACHABLE();
 }
 
@@ -750,20 +1235,50 @@ lookdict(PyDictObject *mp, PyObject *key,
     size_t i, mask, perturb;
     PyDictKeysObject *dk;
     PyDictKeyEntry *ep0;
+#ifdef Py_DICT_CONTROL_BYTES
+    int8_t h2 = DK_H2(hash);
+    const int8_t *ctrl;
+    size_t gbytes;
+    unsigned int bits;
+#endif
 
 top:
     dk = mp->ma_keys;
     ep0 = DK_ENTRIES(dk);
-    mask = DK_MASK(dk);
     perturb = hash;
+#ifdef Py_DICT_CONTROL_BYTES
+    gbytes = DK_GROUP_BYTES(dk);
+    mask = DK_GROUP_MASK(dk);
+    i = DK_FIRST_GROUP(hash, mask);
+    ctrl = DK_CTRL_AT(dk, i, gbytes);
+    bits = dk_ctrl_match(ctrl, h2);
+#else
+    mask = DK_MASK(dk);
     i = (size_t)hash & mask;
+#endif
 
     for (;;) {
+#ifdef Py_DICT_CONTROL_BYTES
+        if (bits == 0) {
+            if (dk_ctrl_empty(ctrl)) {
+                *value_addr = NULL;
+                return DKIX_EMPTY;
+            }
+            i = DK_NEXT_GROUP(i, perturb, mask);
+            ctrl = DK_CTRL_AT(dk, i, gbytes);
+            bits = dk_ctrl_match(ctrl, h2);
+            continue;
+        }
+        Py_ssize_t ix = dk_group_get_index(ctrl, DK_SIZE(dk),
+                                           _Py_MASK_FIRST(bits));
+        bits &= bits - 1;
+#else
         Py_ssize_t ix = dictkeys_get_index(dk, i);
         if (ix == DKIX_EMPTY) {
             *value_addr = NULL;
             return ix;
         }
+#endif
         if (ix >= 0) {
             PyDictKeyEntry *ep = &ep0[ix];
             assert(ep->me_key != NULL);
@@ -792,12 +1307,51 @@ top:
                 }
             }
         }
+#ifndef Py_DICT_CONTROL_BYTES
         perturb >>= PERTURB_SHIFT;
         i = (i*5 + perturb + 1) & mask;
+#endif
     }
     Py_UNREACHABLE();
 }
 
+#ifdef Py_DICT_CONTROL_BYTES
+/* Find the entry of an exact str key in keys holding only exact str keys.
+   Returns its index, or DKIX_EMPTY. */
+static inline Py_ssize_t
+lookdict_unicode_ctrl(PyDictKeysObject *dk, PyObject *key, Py_hash_t hash)
+{
+    Py_ssize_t s = DK_SIZE(dk);
+    size_t gbytes = DK_GROUP_BYTES(dk);
+    PyDictKeyEntry *ep0 = DK_ENTRIES(dk);
+    size_t gmask = DK_GROUP_MASK(dk);
+    size_t perturb = (size_t)hash;
+    size_t g = DK_FIRST_GROUP(hash, gmask);
+    int8_t h2 = DK_H2(hash);
+
+    for (;;) {
+        const int8_t *ctrl = DK_CTRL_AT(dk, g, gbytes);
+        unsigned int bits = dk_ctrl_match(ctrl, h2);
+        while (bits) {
+            Py_ssize_t ix = dk_group_get_index(ctrl, s, _Py_MASK_FIRST(bits));
+            bits &= bits - 1;
+            PyDictKeyEntry *ep = &ep0[ix];
+            assert(ix >= 0);
+            assert(ep->me_key != NULL);
+            assert(PyUnicode_CheckExact(ep->me_key));
+            if (ep->me_key == key ||
+                    (ep->me_hash == hash && unicode_eq(ep->me_key, key))) {
+                return ix;
+            }
+        }
+        if (dk_ctrl_empty(ctrl)) {
+            return DKIX_EMPTY;
+        }
+        g = DK_NEXT_GROUP(g, perturb, gmask);
+    }
+}
+#endif
+
 /* Specialized version for string-only keys */
 static Py_ssize_t _Py_HOT_FUNCTION
 lookdict_unicode(PyDictObject *mp, PyObject *key,
@@ -813,6 +1367,11 @@ lookdict_unicode(PyDictObject *mp, PyObject *key,
         return lookdict(mp, key, hash, value_addr);
     }
 
+#ifdef Py_DICT_CONTROL_BYTES
+    Py_ssize_t ix = lookdict_unicode_ctrl(mp->ma_keys, key, hash);
+    *value_addr = ix >= 0 ? DK_ENTRIES(mp->ma_keys)[ix].me_value : NULL;
+    return ix;
+#else
     PyDictKeyEntry *ep0 = DK_ENTRIES(mp->ma_keys);
     size_t mask = DK_MASK(mp->ma_keys);
     size_t perturb = (size_t)hash;
@@ -837,6 +1396,7 @@ lookdict_unicode(PyDictObject *mp, PyObject *key,
         perturb >>= PERTURB_SHIFT;
         i = mask & (i*5 + perturb + 1);
     }
+#endif
     Py_UNREACHABLE();
 }
 
@@ -856,6 +1416,11 @@ lookdict_unicode_nodummy(PyDictObject *mp, PyObject *key,
         return lookdict(mp, key, hash, value_addr);
     }
 
+#ifdef Py_DICT_CONTROL_BYTES
+    Py_ssize_t ix = lookdict_unicode_ctrl(mp->ma_keys, key, hash);
+    *value_addr = ix >= 0 ? DK_ENTRIES(mp->ma_keys)[ix].me_value : NULL;
+    return ix;
+#else
     PyDictKeyEntry *ep0 = DK_ENTRIES(mp->ma_keys);
     size_t mask = DK_MASK(mp->ma_keys);
     size_t perturb = (size_t)hash;
@@ -879,6 +1444,7 @@ lookdict_unicode_nodummy(PyDictObject *mp, PyObject *key,
         perturb >>= PERTURB_SHIFT;
         i = mask & (i*5 + perturb + 1);
     }
+#endif
     Py_UNREACHABLE();
 }
 
@@ -901,6 +1467,11 @@ lookdict_split(PyDictObject *mp, PyObject *key,
         return ix;
     }
 
+#ifdef Py_DICT_CONTROL_BYTES
+    Py_ssize_t ix = lookdict_unicode_ctrl(mp->ma_keys, key, hash);
+    *value_addr = ix >= 0 ? mp->ma_values[ix] : NULL;
+    return ix;
+#else
     PyDictKeyEntry *ep0 = DK_ENTRIES(mp->ma_keys);
     size_t mask = DK_MASK(mp->ma_keys);
     size_t perturb = (size_t)hash;
@@ -924,6 +1495,7 @@ lookdict_split(PyDictObject *mp, PyObject *key,
         perturb >>= PERTURB_SHIFT;
         i = mask & (i*5 + perturb + 1);
     }
+#endif
     Py_UNREACHABLE();
 }
 
@@ -932,7 +1504,7 @@ _PyDict_HasOnlyStringKeys(PyObject *dict)
 {
     Py_ssize_t pos = 0;
     PyObject *key, *value;
-    assert(PyDict_Check(dict));
+    assert(PyAnyDict_Check(dict));
     /* Shortcut */
     if (((PyDictObject *)dict)->ma_keys->dk_lookup != lookdict)
         return 1;
@@ -997,6 +1569,18 @@ find_empty_slot(PyDictKeysObject *keys, Py_hash_t hash)
 {
     assert(keys != NULL);
 
+#ifdef Py_DICT_CONTROL_BYTES
+    const size_t gbytes = DK_GROUP_BYTES(keys);
+    const size_t gmask = DK_GROUP_MASK(keys);
+    size_t perturb = (size_t)hash;
+    size_t g = DK_FIRST_GROUP(hash, gmask);
+    unsigned int bits = dk_ctrl_free(DK_CTRL_AT(keys, g, gbytes));
+    while (bits == 0) {
+        g = DK_NEXT_GROUP(g, perturb, gmask);
+        bits = dk_ctrl_free(DK_CTRL_AT(keys, g, gbytes));
+    }
+    return g * DK_GROUP_WIDTH + _Py_MASK_FIRST(bits);
+#else
     const size_t mask = DK_MASK(keys);
     size_t i = hash & mask;
     Py_ssize_t ix = dictkeys_get_index(keys, i);
@@ -1006,6 +1590,7 @@ find_empty_slot(PyDictKeysObject *keys, Py_hash_t hash)
         ix = dictkeys_get_index(keys, i);
     }
     return i;
+#endif
 }
 
 static int
@@ -1014,6 +1599,19 @@ insertion_resize(PyDictObject *mp)
     return dictresize(mp, GROWTH_RATE(mp));
 }
 
+/* Make room for a new key in the full keys of mp.  A split table whose
+   keys are not too large to be shared stays split. */
+static int
+insertion_grow(PyDictObject *mp)
+{
+    if (_PyDict_HasSplitTable(mp) && mp->ma_keys != Py_EMPTY_KEYS &&
+        (mp->ma_keys->dk_refcnt == 1 ||
+         DK_SIZE(mp->ma_keys) < SHARED_KEYS_MAX_SIZE)) {
+        return split_keys_resize(mp);
+    }
+    return insertion_resize(mp);
+}
+
 /*
 Internal routine to insert a new item into the table.
 Used both by the internal resize routine and by the public insert routine.
@@ -1037,40 +1635,32 @@ insertdict(PyDictObject *mp, PyObject *key, Py_hash_t hash, PyObject *value)
         goto Fail;
 
     assert(PyUnicode_CheckExact(key) || mp->ma_keys->dk_lookup == lookdict);
+    if (DICT_KEYS_SHARED(mp) && dict_unshare_keys(mp) < 0)
+        goto Fail;
     MAINTAIN_TRACKING(mp, key, value);
 
-    /* When insertion order is different from shared key, we can't share
-     * the key anymore.  Convert this instance to combine table.
-     */
-    if (_PyDict_HasSplitTable(mp) &&
-        ((ix >= 0 && old_value == NULL && mp->ma_used != ix) ||
-         (ix == DKIX_EMPTY && mp->ma_used != mp->ma_keys->dk_nentries))) {
-        if (insertion_resize(mp) < 0)
-            goto Fail;
-        ix = DKIX_EMPTY;
-    }
-
     if (ix == DKIX_EMPTY) {
         /* Insert into new slot. */
         assert(old_value == NULL);
         if (mp->ma_keys->dk_usable <= 0) {
             /* Need to resize. */
-            if (insertion_resize(mp) < 0)
+            if (insertion_grow(mp) < 0)
                 goto Fail;
         }
         Py_ssize_t hashpos = find_empty_slot(mp->ma_keys, hash);
         ep = &DK_ENTRIES(mp->ma_keys)[mp->ma_keys->dk_nentries];
-        dictkeys_set_index(mp->ma_keys, hashpos, mp->ma_keys->dk_nentries);
+        dictkeys_set_hash_index(mp->ma_keys, hashpos,
+                                mp->ma_keys->dk_nentries, hash);
         ep->me_key = key;
         ep->me_hash = hash;
         if (mp->ma_values) {
-            assert (mp->ma_values[mp->ma_keys->dk_nentries] == NULL);
-            mp->ma_values[mp->ma_keys->dk_nentries] = value;
+            /* Other dicts sharing the keys see it as a pending entry */
+            split_insert_value(mp, mp->ma_keys->dk_nentries, value);
         }
         else {
             ep->me_value = value;
+            mp->ma_used++;
         }
-        mp->ma_used++;
         mp->ma_version_tag = DICT_NEXT_VERSION();
         mp->ma_keys->dk_usable--;
         mp->ma_keys->dk_nentries++;
@@ -1080,11 +1670,12 @@ insertdict(PyDictObject *mp, PyObject *key, Py_hash_t hash, PyObject *value)
     }
 
     if (_PyDict_HasSplitTable(mp)) {
-        mp->ma_values[ix] = value;
         if (old_value == NULL) {
             /* pending state */
-            assert(ix == mp->ma_used);
-            mp->ma_used++;
+            split_insert_value(mp, ix, value);
+        }
+        else {
+            mp->ma_values[ix] = value;
         }
     }
     else {
@@ -1110,6 +1701,12 @@ Internal routine used by dictresize() to build a hashtable of entries.
 static void
 build_indices(PyDictKeysObject *keys, PyDictKeyEntry *ep, Py_ssize_t n)
 {
+#ifdef Py_DICT_CONTROL_BYTES
+    for (Py_ssize_t ix = 0; ix != n; ix++, ep++) {
+        Py_hash_t hash = ep->me_hash;
+        dictkeys_set_hash_index(keys, find_empty_slot(keys, hash), ix, hash);
+    }
+#else
     size_t mask = (size_t)DK_SIZE(keys) - 1;
     for (Py_ssize_t ix = 0; ix != n; ix++, ep++) {
         Py_hash_t hash = ep->me_hash;
@@ -1120,6 +1717,7 @@ build_indices(PyDictKeysObject *keys, PyDictKeyEntry *ep, Py_ssize_t n)
         }
         dictkeys_set_index(keys, i, ix);
     }
+#endif
 }
 
 /*
@@ -1173,24 +1771,25 @@ dictresize(PyDictObject *mp, Py_ssize_t minsize)
     newentries = DK_ENTRIES(mp->ma_keys);
     oldvalues = mp->ma_values;
     if (oldvalues != NULL) {
-        /* Convert split table into new combined table.
-         * We must incref keys; we can transfer values.
-         * Note that values of split table is always dense.
+        /* Convert split table into new combined table, in the insertion
+         * order of mp.  We must incref keys; we can transfer values.
          */
         for (Py_ssize_t i = 0; i < numentries; i++) {
-            assert(oldvalues[i] != NULL);
-            PyDictKeyEntry *ep = &oldentries[i];
+            Py_ssize_t ix = values_get_order(oldkeys, oldvalues, i);
+            assert(oldvalues[ix] != NULL);
+            PyDictKeyEntry *ep = &oldentries[ix];
             PyObject *key = ep->me_key;
             Py_INCREF(key);
             newentries[i].me_key = key;
             newentries[i].me_hash = ep->me_hash;
-            newentries[i].me_value = oldvalues[i];
+            newentries[i].me_value = oldvalues[ix];
         }
 
         dictkeys_decref(oldkeys);
         mp->ma_values = NULL;
         if (oldvalues != empty_values) {
             free_values(oldvalues);
+            split_conversions++;
         }
     }
     else {  // combined table.
@@ -1207,8 +1806,16 @@ dictresize(PyDictObject *mp, Py_ssize_t minsize)
         }
 
         assert(oldkeys->dk_lookup != lookdict_split);
-        assert(oldkeys->dk_refcnt == 1);
-        if (oldkeys->dk_size == PyDict_MINSIZE &&
+        if (oldkeys->dk_refcnt > 1) {
+            /* oldkeys is shared with a frozendict which keeps its
+               references: take new ones. */
+            for (Py_ssize_t i = 0; i < numentries; i++) {
+                Py_INCREF(newentries[i].me_key);
+                Py_INCREF(newentries[i].me_value);
+            }
+            dictkeys_decref(oldkeys);
+        }
+        else if (oldkeys->dk_size == PyDict_MINSIZE &&
             numfreekeys < PyDict_MAXFREELIST) {
             _Py_DEC_REFTOTAL;
             keys_free_list[numfreekeys++] = oldkeys;
@@ -1225,6 +1832,61 @@ dictresize(PyDictObject *mp, Py_ssize_t minsize)
     return 0;
 }
 
+/*
+Give the split table mp a new keys object twice as large as its full shared
+keys, holding the same entries, so that a new key can be added to it and mp
+stays split.  The other dicts sharing the old keys keep them.
+*/
+static int
+split_keys_resize(PyDictObject *mp)
+{
+    PyDictKeysObject *oldkeys = mp->ma_keys, *keys;
+    PyObject **oldvalues = mp->ma_values, **values;
+    PyDictKeyEntry *oldentries, *newentries;
+    Py_ssize_t i, n = oldkeys->dk_nentries;
+
+    keys = new_keys_object(DK_SIZE(oldkeys) * 2);
+    if (keys == NULL) {
+        return -1;
+    }
+    keys->dk_lookup = lookdict_split;
+    values = new_values(keys);
+    if (values == NULL) {
+        dictkeys_decref(keys);
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    /* Split keys have no deleted entries: the indices of the entries, and
+       so of the values, are kept */
+    oldentries = DK_ENTRIES(oldkeys);
+    newentries = DK_ENTRIES(keys);
+    for (i = 0; i < n; i++) {
+        PyObject *key = oldentries[i].me_key;
+        assert(key != NULL);
+        Py_INCREF(key);
+        newentries[i].me_key = key;
+        newentries[i].me_hash = oldentries[i].me_hash;
+        values[i] = oldvalues[i];
+    }
+    for (; i < USABLE_FRACTION(DK_SIZE(keys)); i++) {
+        values[i] = NULL;
+    }
+    for (i = 0; i < mp->ma_used; i++) {
+        values_set_order(keys, values, i,
+                         values_get_order(oldkeys, oldvalues, i));
+    }
+    build_indices(keys, newentries, n);
+    keys->dk_usable -= n;
+    keys->dk_nentries = n;
+
+    mp->ma_keys = keys;
+    mp->ma_values = values;
+    free_values(oldvalues);
+    dictkeys_decref(oldkeys);
+    return 0;
+}
+
 /* Returns NULL if unable to split table.
  * A NULL return does not necessarily indicate an error */
 static PyDictKeysObject *
@@ -1239,8 +1901,7 @@ make_keys_shared(PyObject *op)
     if (!_PyDict_HasSplitTable(mp)) {
         PyDictKeyEntry *ep0;
         PyObject **values;
-        assert(mp->ma_keys->dk_refcnt == 1);
-        if (mp->ma_keys->dk_lookup == lookdict) {
+        if (mp->ma_keys->dk_lookup == lookdict || DICT_KEYS_SHARED(mp)) {
             return NULL;
         }
         else if (mp->ma_keys->dk_lookup == lookdict_unicode) {
@@ -1252,16 +1913,20 @@ make_keys_shared(PyObject *op)
         /* Copy values into a new array */
         ep0 = DK_ENTRIES(mp->ma_keys);
         size = USABLE_FRACTION(DK_SIZE(mp->ma_keys));
-        values = new_values(size);
+        values = new_values(mp->ma_keys);
         if (values == NULL) {
             PyErr_SetString(PyExc_MemoryError,
                 "Not enough memory to allocate new values array");
             return NULL;
         }
+        assert(mp->ma_keys->dk_nentries == mp->ma_used);
         for (i = 0; i < size; i++) {
             values[i] = ep0[i].me_value;
             ep0[i].me_value = NULL;
         }
+        for (i = 0; i < mp->ma_used; i++) {
+            values_set_order(mp->ma_keys, values, i, i);
+        }
         mp->ma_keys->dk_lookup = lookdict_split;
         mp->ma_values = values;
     }
@@ -1317,7 +1982,7 @@ PyDict_GetItem(PyObject *op, PyObject *key)
     PyThreadState *tstate;
     PyObject *value;
 
-    if (!PyDict_Check(op))
+    if (!PyAnyDict_Check(op))
         return NULL;
     if (!PyUnicode_CheckExact(key) ||
         (hash = ((PyASCIIObject *) key)->hash) == -1)
@@ -1366,7 +2031,7 @@ _PyDict_GetItem_KnownHash(PyObject *op, PyObject *key, Py_hash_t hash)
     PyDictObject *mp = (PyDictObject *)op;
     PyObject *value;
 
-    if (!PyDict_Check(op)) {
+    if (!PyAnyDict_Check(op)) {
         PyErr_BadInternalCall();
         return NULL;
     }
@@ -1390,7 +2055,7 @@ PyDict_GetItemWithError(PyObject *op, PyObject *key)
     PyDictObject*mp = (PyDictObject *)op;
     PyObject *value;
 
-    if (!PyDict_Check(op)) {
+    if (!PyAnyDict_Check(op)) {
         PyErr_BadInternalCall();
         return NULL;
     }
@@ -1511,6 +2176,16 @@ delitem_common(PyDictObject *mp, Py_hash_t hash, Py_ssize_t ix,
     PyObject *old_key;
     PyDictKeyEntry *ep;
 
+    if (_PyDict_HasSplitTable(mp)) {
+        old_value = split_delete_value(mp, ix);
+        mp->ma_version_tag = DICT_NEXT_VERSION();
+        Py_DECREF(old_value);
+        assert(_PyDict_CheckConsistency(mp));
+        return 0;
+    }
+    if (DICT_KEYS_SHARED(mp) && dict_unshare_keys(mp) < 0)
+        return -1;
+
     Py_ssize_t hashpos = lookdict_index(mp->ma_keys, hash, ix);
     assert(hashpos >= 0);
 
@@ -1566,15 +2241,6 @@ _PyDict_DelItem_KnownHash(PyObject *op, PyObject *key, Py_hash_t hash)
         return -1;
     }
 
-    // Split table doesn't allow deletion.  Combine it.
-    if (_PyDict_HasSplitTable(mp)) {
-        if (dictresize(mp, DK_SIZE(mp->ma_keys))) {
-            return -1;
-        }
-        ix = (mp->ma_keys->dk_lookup)(mp, key, hash, &old_value);
-        assert(ix >= 0);
-    }
-
     return delitem_common(mp, hash, ix, old_value);
 }
 
@@ -1586,7 +2252,7 @@ int
 _PyDict_DelItemIf(PyObject *op, PyObject *key,
                   int (*predicate)(PyObject *value))
 {
-    Py_ssize_t hashpos, ix;
+    Py_ssize_t ix;
     PyDictObject *mp;
     Py_hash_t hash;
     PyObject *old_value;
@@ -1609,24 +2275,12 @@ _PyDict_DelItemIf(PyObject *op, PyObject *key,
         return -1;
     }
 
-    // Split table doesn't allow deletion.  Combine it.
-    if (_PyDict_HasSplitTable(mp)) {
-        if (dictresize(mp, DK_SIZE(mp->ma_keys))) {
-            return -1;
-        }
-        ix = (mp->ma_keys->dk_lookup)(mp, key, hash, &old_value);
-        assert(ix >= 0);
-    }
-
     res = predicate(old_value);
     if (res == -1)
         return -1;
 
-    hashpos = lookdict_index(mp->ma_keys, hash, ix);
-    assert(hashpos >= 0);
-
     if (res > 0)
-        return delitem_common(mp, hashpos, ix, old_value);
+        return delitem_common(mp, hash, ix, old_value);
     else
         return 0;
 }
@@ -1662,7 +2316,6 @@ PyDict_Clear(PyObject *op)
         dictkeys_decref(oldkeys);
     }
     else {
-       assert(oldkeys->dk_refcnt == 1);
        dictkeys_decref(oldkeys);
     }
     assert(_PyDict_CheckConsistency(mp));
@@ -1682,16 +2335,16 @@ _PyDict_Next(PyObject *op, Py_ssize_t *ppos, PyObject **pkey,
     PyDictKeyEntry *entry_ptr;
     PyObject *value;
 
-    if (!PyDict_Check(op))
+    if (!PyAnyDict_Check(op))
         return 0;
     mp = (PyDictObject *)op;
     i = *ppos;
     if (mp->ma_values) {
         if (i < 0 || i >= mp->ma_used)
             return 0;
-        /* values of split table is always dense */
-        entry_ptr = &DK_ENTRIES(mp->ma_keys)[i];
-        value = mp->ma_values[i];
+        Py_ssize_t ix = values_get_order(mp->ma_keys, mp->ma_values, i);
+        entry_ptr = &DK_ENTRIES(mp->ma_keys)[ix];
+        value = mp->ma_values[ix];
         assert(value != NULL);
     }
     else {
@@ -1773,14 +2426,14 @@ _PyDict_Pop_KnownHash(PyObject *dict, PyObject *key, Py_hash_t hash, PyObject *d
         return NULL;
     }
 
-    // Split table doesn't allow deletion.  Combine it.
-    if (_PyDict_HasSplitTable(mp)) {
-        if (dictresize(mp, DK_SIZE(mp->ma_keys))) {
-            return NULL;
-        }
-        ix = (mp->ma_keys->dk_lookup)(mp, key, hash, &old_value);
-        assert(ix >= 0);
+    if (_PyDict_HasSplitTable(mp)) {
+        old_value = split_delete_value(mp, ix);
+        mp->ma_version_tag = DICT_NEXT_VERSION();
+        assert(_PyDict_CheckConsistency(mp));
+        return old_value;
     }
+    if (DICT_KEYS_SHARED(mp) && dict_unshare_keys(mp) < 0)
+        return NULL;
 
     hashpos = lookdict_index(mp->ma_keys, hash, ix);
     assert(hashpos >= 0);
@@ -1931,7 +2584,6 @@ dict_dealloc(PyDictObject *mp)
         dictkeys_decref(keys);
     }
     else if (keys != NULL) {
-        assert(keys->dk_refcnt == 1);
         dictkeys_decref(keys);
     }
     if (numfree < PyDict_MAXFREELIST && Py_TYPE(mp) == &PyDict_Type)
@@ -2048,7 +2700,7 @@ dict_subscript(PyDictObject *mp, PyObject *key)
     if (ix == DKIX_ERROR)
         return NULL;
     if (ix == DKIX_EMPTY || value == NULL) {
-        if (!PyDict_CheckExact(mp)) {
+        if (!PyDict_CheckExact(mp) && !PyFrozenDict_CheckExact(mp)) {
             /* Look up __missing__ method if we're a subclass. */
             PyObject *missing, *res;
             _Py_IDENTIFIER(__missing__);
@@ -2090,8 +2742,7 @@ dict_keys(PyDictObject *mp)
     PyObject *v;
     Py_ssize_t i, j;
     PyDictKeyEntry *ep;
-    Py_ssize_t size, n, offset;
-    PyObject **value_ptr;
+    Py_ssize_t size, n;
 
   again:
     n = mp->ma_used;
@@ -2106,23 +2757,23 @@ dict_keys(PyDictObject *mp)
         goto again;
     }
     ep = DK_ENTRIES(mp->ma_keys);
-    size = mp->ma_keys->dk_nentries;
     if (mp->ma_values) {
-        value_ptr = mp->ma_values;
-        offset = sizeof(PyObject *);
-    }
-    else {
-        value_ptr = &ep[0].me_value;
-        offset = sizeof(PyDictKeyEntry);
+        for (j = 0; j < n; j++) {
+            PyObject *key = ep[values_get_order(mp->ma_keys,
+                                                mp->ma_values, j)].me_key;
+            Py_INCREF(key);
+            PyList_SET_ITEM(v, j, key);
+        }
+        return v;
     }
+    size = mp->ma_keys->dk_nentries;
     for (i = 0, j = 0; i < size; i++) {
-        if (*value_ptr != NULL) {
+        if (ep[i].me_value != NULL) {
             PyObject *key = ep[i].me_key;
             Py_INCREF(key);
             PyList_SET_ITEM(v, j, key);
             j++;
         }
-        value_ptr = (PyObject **)(((char *)value_ptr) + offset);
     }
     assert(j == n);
     return v;
@@ -2134,8 +2785,7 @@ dict_values(PyDictObject *mp)
     PyObject *v;
     Py_ssize_t i, j;
     PyDictKeyEntry *ep;
-    Py_ssize_t size, n, offset;
-    PyObject **value_ptr;
+    Py_ssize_t size, n;
 
   again:
     n = mp->ma_used;
@@ -2150,18 +2800,18 @@ dict_values(PyDictObject *mp)
         goto again;
     }
     ep = DK_ENTRIES(mp->ma_keys);
-    size = mp->ma_keys->dk_nentries;
     if (mp->ma_values) {
-        value_ptr = mp->ma_values;
-        offset = sizeof(PyObject *);
-    }
-    else {
-        value_ptr = &ep[0].me_value;
-        offset = sizeof(PyDictKeyEntry);
+        for (j = 0; j < n; j++) {
+            PyObject *value = mp->ma_values[
+                values_get_order(mp->ma_keys, mp->ma_values, j)];
+            Py_INCREF(value);
+            PyList_SET_ITEM(v, j, value);
+        }
+        return v;
     }
+    size = mp->ma_keys->dk_nentries;
     for (i = 0, j = 0; i < size; i++) {
-        PyObject *value = *value_ptr;
-        value_ptr = (PyObject **)(((char *)value_ptr) + offset);
+        PyObject *value = ep[i].me_value;
         if (value != NULL) {
             Py_INCREF(value);
             PyList_SET_ITEM(v, j, value);
@@ -2177,10 +2827,9 @@ dict_items(PyDictObject *mp)
 {
     PyObject *v;
     Py_ssize_t i, j, n;
-    Py_ssize_t size, offset;
+    Py_ssize_t size;
     PyObject *item, *key;
     PyDictKeyEntry *ep;
-    PyObject **value_ptr;
 
     /* Preallocate the list of tuples, to avoid allocations during
      * the loop over the items, which could trigger GC, which
@@ -2208,18 +2857,21 @@ dict_items(PyDictObject *mp)
     }
     /* Nothing we do below makes any function calls. */
     ep = DK_ENTRIES(mp->ma_keys);
-    size = mp->ma_keys->dk_nentries;
     if (mp->ma_values) {
-        value_ptr = mp->ma_values;
-        offset = sizeof(PyObject *);
-    }
-    else {
-        value_ptr = &ep[0].me_value;
-        offset = sizeof(PyDictKeyEntry);
+        for (j = 0; j < n; j++) {
+            i = values_get_order(mp->ma_keys, mp->ma_values, j);
+            key = ep[i].me_key;
+            item = PyList_GET_ITEM(v, j);
+            Py_INCREF(key);
+            PyTuple_SET_ITEM(item, 0, key);
+            Py_INCREF(mp->ma_values[i]);
+            PyTuple_SET_ITEM(item, 1, mp->ma_values[i]);
+        }
+        return v;
     }
+    size = mp->ma_keys->dk_nentries;
     for (i = 0, j = 0; i < size; i++) {
-        PyObject *value = *value_ptr;
-        value_ptr = (PyObject **)(((char *)value_ptr) + offset);
+        PyObject *value = ep[i].me_value;
         if (value != NULL) {
             key = ep[i].me_key;
             item = PyList_GET_ITEM(v, j);
@@ -2251,6 +2903,22 @@ dict_fromkeys_impl(PyTypeObject *type, PyObject *iterable, PyObject *value)
     return _PyDict_FromKeys((PyObject *)type, iterable, value);
 }
 
+static int
+dict_update_arg(PyObject *self, PyObject *arg)
+{
+    _Py_IDENTIFIER(keys);
+    PyObject *func;
+
+    if (_PyObject_LookupAttrId(arg, &PyId_keys, &func) < 0) {
+        return -1;
+    }
+    if (func != NULL) {
+        Py_DECREF(func);
+        return PyDict_Merge(self, arg, 1);
+    }
+    return PyDict_MergeFromSeq2(self, arg, 1);
+}
+
 static int
 dict_update_common(PyObject *self, PyObject *args, PyObject *kwds,
                    const char *methname)
@@ -2262,18 +2930,7 @@ dict_update_common(PyObject *self, PyObject *args, PyObject *kwds,
         result = -1;
     }
     else if (arg != NULL) {
-        _Py_IDENTIFIER(keys);
-        PyObject *func;
-        if (_PyObject_LookupAttrId(arg, &PyId_keys, &func) < 0) {
-            result = -1;
-        }
-        else if (func != NULL) {
-            Py_DECREF(func);
-            result = PyDict_Merge(self, arg, 1);
-        }
-        else {
-            result = PyDict_MergeFromSeq2(self, arg, 1);
-        }
+        result = dict_update_arg(self, arg);
     }
 
     if (result == 0 && kwds != NULL) {
@@ -2390,6 +3047,8 @@ dict_merge(PyObject *a, PyObject *b, int override)
     PyDictObject *mp, *other;
     Py_ssize_t i, n;
     PyDictKeyEntry *entry, *ep0;
+    PyDictKeysObject *okeys;
+    PyObject **ovalues;
 
     assert(0 <= override && override <= 2);
 
@@ -2403,11 +3062,34 @@ dict_merge(PyObject *a, PyObject *b, int override)
         return -1;
     }
     mp = (PyDictObject*)a;
-    if (PyDict_Check(b) && (Py_TYPE(b)->tp_iter == (getiterfunc)dict_iter)) {
+    if (PyAnyDict_Check(b) && (Py_TYPE(b)->tp_iter == (getiterfunc)dict_iter)) {
         other = (PyDictObject*)b;
         if (other == mp || other->ma_used == 0)
             /* a.update(a) or a.update({}); nothing to do */
             return 0;
+        if (mp->ma_used == 0 && PyDict_CheckExact(a) &&
+                PyFrozenDict_Check(b) && other->ma_values == NULL) {
+            /* dict(frozendict): share the keys of the frozendict, they
+               are copied by the first modification of mp. */
+            PyDictKeysObject *oldkeys = mp->ma_keys;
+            PyObject **oldvalues = mp->ma_values;
+
+            if (dictkeys_share(other->ma_keys) < 0)
+                return -1;
+            mp->ma_keys = other->ma_keys;
+            mp->ma_values = NULL;
+            mp->ma_used = other->ma_used;
+            mp->ma_version_tag = DICT_NEXT_VERSION();
+            if (oldvalues != NULL && oldvalues != empty_values)
+                free_values(oldvalues);
+            dictkeys_decref(oldkeys);
+            if (_PyObject_GC_IS_TRACKED(other) &&
+                    !_PyObject_GC_IS_TRACKED(mp)) {
+                _PyObject_GC_TRACK(mp);
+            }
+            assert(_PyDict_CheckConsistency(mp));
+            return 0;
+        }
         if (mp->ma_used == 0)
             /* Since the target dict is empty, PyDict_GetItem()
              * always returns NULL.  Setting override to 1
@@ -2423,17 +3105,25 @@ dict_merge(PyObject *a, PyObject *b, int override)
                return -1;
             }
         }
-        ep0 = DK_ENTRIES(other->ma_keys);
-        for (i = 0, n = other->ma_keys->dk_nentries; i < n; i++) {
+        okeys = other->ma_keys;
+        ovalues = other->ma_values;
+        ep0 = DK_ENTRIES(okeys);
+        /* A split table is visited in its own insertion order */
+        n = ovalues ? other->ma_used : okeys->dk_nentries;
+        for (i = 0; i < n; i++) {
             PyObject *key, *value;
             Py_hash_t hash;
-            entry = &ep0[i];
+            if (ovalues) {
+                Py_ssize_t ix = values_get_order(okeys, ovalues, i);
+                entry = &ep0[ix];
+                value = ovalues[ix];
+            }
+            else {
+                entry = &ep0[i];
+                value = entry->me_value;
+            }
             key = entry->me_key;
             hash = entry->me_hash;
-            if (other->ma_values)
-                value = other->ma_values[i];
-            else
-                value = entry->me_value;
 
             if (value != NULL) {
                 int err = 0;
@@ -2460,7 +3150,8 @@ dict_merge(PyObject *a, PyObject *b, int override)
                 if (err != 0)
                     return -1;
 
-                if (n != other->ma_keys->dk_nentries) {
+                if (other->ma_keys != okeys || other->ma_values != ovalues ||
+                    n != (ovalues ? other->ma_used : okeys->dk_nentries)) {
                     PyErr_SetString(PyExc_RuntimeError,
                                     "dict mutated during update");
                     return -1;
@@ -2554,7 +3245,7 @@ PyDict_Copy(PyObject *o)
     PyDictObject *mp;
     Py_ssize_t i, n;
 
-    if (o == NULL || !PyDict_Check(o)) {
+    if (o == NULL || !PyAnyDict_Check(o)) {
         PyErr_BadInternalCall();
         return NULL;
     }
@@ -2569,7 +3260,7 @@ PyDict_Copy(PyObject *o)
         PyDictObject *split_copy;
         Py_ssize_t size = USABLE_FRACTION(DK_SIZE(mp->ma_keys));
         PyObject **newvalues;
-        newvalues = new_values(size);
+        newvalues = new_values(mp->ma_keys);
         if (newvalues == NULL)
             return PyErr_NoMemory();
         split_copy = PyObject_GC_New(PyDictObject, &PyDict_Type);
@@ -2587,6 +3278,10 @@ PyDict_Copy(PyObject *o)
             Py_XINCREF(value);
             split_copy->ma_values[i] = value;
         }
+        for (i = 0; i < mp->ma_used; i++) {
+            values_set_order(mp->ma_keys, newvalues, i,
+                             values_get_order(mp->ma_keys, mp->ma_values, i));
+        }
         if (_PyObject_GC_IS_TRACKED(mp))
             _PyObject_GC_TRACK(split_copy);
         return (PyObject *)split_copy;
@@ -2624,7 +3319,7 @@ PyDict_Copy(PyObject *o)
 Py_ssize_t
 PyDict_Size(PyObject *mp)
 {
-    if (mp == NULL || !PyDict_Check(mp)) {
+    if (mp == NULL || !PyAnyDict_Check(mp)) {
         PyErr_BadInternalCall();
         return -1;
     }
@@ -2634,7 +3329,7 @@ PyDict_Size(PyObject *mp)
 PyObject *
 PyDict_Keys(PyObject *mp)
 {
-    if (mp == NULL || !PyDict_Check(mp)) {
+    if (mp == NULL || !PyAnyDict_Check(mp)) {
         PyErr_BadInternalCall();
         return NULL;
     }
@@ -2644,7 +3339,7 @@ PyDict_Keys(PyObject *mp)
 PyObject *
 PyDict_Values(PyObject *mp)
 {
-    if (mp == NULL || !PyDict_Check(mp)) {
+    if (mp == NULL || !PyAnyDict_Check(mp)) {
         PyErr_BadInternalCall();
         return NULL;
     }
@@ -2654,7 +3349,7 @@ PyDict_Values(PyObject *mp)
 PyObject *
 PyDict_Items(PyObject *mp)
 {
-    if (mp == NULL || !PyDict_Check(mp)) {
+    if (mp == NULL || !PyAnyDict_Check(mp)) {
         PyErr_BadInternalCall();
         return NULL;
     }
@@ -2715,7 +3410,7 @@ dict_richcompare(PyObject *v, PyObject *w, int op)
     int cmp;
     PyObject *res;
 
-    if (!PyDict_Check(v) || !PyDict_Check(w)) {
+    if (!PyAnyDict_Check(v) || !PyAnyDict_Check(w)) {
         res = Py_NotImplemented;
     }
     else if (op == Py_EQ || op == Py_NE) {
@@ -2826,40 +3521,33 @@ PyDict_SetDefault(PyObject *d, PyObject *key, PyObject *defaultobj)
     if (ix == DKIX_ERROR)
         return NULL;
 
-    if (_PyDict_HasSplitTable(mp) &&
-        ((ix >= 0 && value == NULL && mp->ma_used != ix) ||
-         (ix == DKIX_EMPTY && mp->ma_used != mp->ma_keys->dk_nentries))) {
-        if (insertion_resize(mp) < 0) {
-            return NULL;
-        }
-        ix = DKIX_EMPTY;
-    }
-
     if (ix == DKIX_EMPTY) {
         PyDictKeyEntry *ep, *ep0;
         value = defaultobj;
+        if (DICT_KEYS_SHARED(mp) && dict_unshare_keys(mp) < 0)
+            return NULL;
         if (mp->ma_keys->dk_usable <= 0) {
-            if (insertion_resize(mp) < 0) {
+            if (insertion_grow(mp) < 0) {
                 return NULL;
             }
         }
         Py_ssize_t hashpos = find_empty_slot(mp->ma_keys, hash);
         ep0 = DK_ENTRIES(mp->ma_keys);
         ep = &ep0[mp->ma_keys->dk_nentries];
-        dictkeys_set_index(mp->ma_keys, hashpos, mp->ma_keys->dk_nentries);
+        dictkeys_set_hash_index(mp->ma_keys, hashpos,
+                                mp->ma_keys->dk_nentries, hash);
         Py_INCREF(key);
         Py_INCREF(value);
         MAINTAIN_TRACKING(mp, key, value);
         ep->me_key = key;
         ep->me_hash = hash;
         if (_PyDict_HasSplitTable(mp)) {
-            assert(mp->ma_values[mp->ma_keys->dk_nentries] == NULL);
-            mp->ma_values[mp->ma_keys->dk_nentries] = value;
+            split_insert_value(mp, mp->ma_keys->dk_nentries, value);
         }
         else {
             ep->me_value = value;
+            mp->ma_used++;
         }
-        mp->ma_used++;
         mp->ma_version_tag = DICT_NEXT_VERSION();
         mp->ma_keys->dk_usable--;
         mp->ma_keys->dk_nentries++;
@@ -2868,11 +3556,9 @@ PyDict_SetDefault(PyObject *d, PyObject *key, PyObject *defaultobj)
     else if (value == NULL) {
         value = defaultobj;
         assert(_PyDict_HasSplitTable(mp));
-        assert(ix == mp->ma_used);
         Py_INCREF(value);
         MAINTAIN_TRACKING(mp, key, value);
-        mp->ma_values[ix] = value;
-        mp->ma_used++;
+        split_insert_value(mp, ix, value);
         mp->ma_version_tag = DICT_NEXT_VERSION();
     }
 
@@ -2947,12 +3633,20 @@ dict_popitem(PyDictObject *mp, PyObject *Py_UNUSED(ignored))
                         "popitem(): dictionary is empty");
         return NULL;
     }
-    /* Convert split table to combined table */
-    if (mp->ma_keys->dk_lookup == lookdict_split) {
-        if (dictresize(mp, DK_SIZE(mp->ma_keys))) {
-            Py_DECREF(res);
-            return NULL;
-        }
+    if (_PyDict_HasSplitTable(mp)) {
+        /* Pop the last inserted value, the key stays in the shared keys */
+        i = values_get_order(mp->ma_keys, mp->ma_values, mp->ma_used - 1);
+        ep = &DK_ENTRIES(mp->ma_keys)[i];
+        Py_INCREF(ep->me_key);
+        PyTuple_SET_ITEM(res, 0, ep->me_key);
+        PyTuple_SET_ITEM(res, 1, split_delete_value(mp, i));
+        mp->ma_version_tag = DICT_NEXT_VERSION();
+        assert(_PyDict_CheckConsistency(mp));
+        return res;
+    }
+    if (DICT_KEYS_SHARED(mp) && dict_unshare_keys(mp) < 0) {
+        Py_DECREF(res);
+        return NULL;
     }
     ENSURE_ALLOWS_DELETIONS(mp);
 
@@ -2990,6 +3684,11 @@ dict_traverse(PyObject *op, visitproc visit, void *arg)
     PyDictKeyEntry *entries = DK_ENTRIES(keys);
     Py_ssize_t i, n = keys->dk_nentries;
 
+    if (keys->dk_holder != NULL) {
+        /* The shared entries are visited by the holder */
+        Py_VISIT(keys->dk_holder);
+        return 0;
+    }
     if (keys->dk_lookup == lookdict) {
         for (i = 0; i < n; i++) {
             if (entries[i].me_value != NULL) {
@@ -3032,12 +3731,12 @@ _PyDict_SizeOf(PyDictObject *mp)
 
     res = _PyObject_SIZE(Py_TYPE(mp));
     if (mp->ma_values)
-        res += usable * sizeof(PyObject*);
+        res += usable * (sizeof(PyObject*) + DK_IXSIZE(mp->ma_keys));
     /* If the dictionary is split, the keys portion is accounted-for
        in the type object. */
     if (mp->ma_keys->dk_refcnt == 1)
         res += (sizeof(PyDictKeysObject)
-                + DK_IXSIZE(mp->ma_keys) * size
+                + DK_INDICES_SIZE(mp->ma_keys)
                 + sizeof(PyDictKeyEntry) * usable);
     return res;
 }
@@ -3046,7 +3745,7 @@ Py_ssize_t
 _PyDict_KeysSize(PyDictKeysObject *keys)
 {
     return (sizeof(PyDictKeysObject)
-            + DK_IXSIZE(keys) * DK_SIZE(keys)
+            + DK_INDICES_SIZE(keys)
             + USABLE_FRACTION(DK_SIZE(keys)) * sizeof(PyDictKeyEntry));
 }
 
@@ -3264,6 +3963,356 @@ PyTypeObject PyDict_Type = {
     PyObject_GC_Del,                            /* tp_free */
 };
 
+/***********************************************/
+/* frozendict                                  */
+/***********************************************/
+
+/* A frozendict is a combined dict (or an empty split dict) which is never
+   modified after its creation.  It shares the keys object of the dict it
+   is created from, so frozendict(d) and dict(frozendict) only copy the
+   table when it is sparse or split. */
+
+/* Create a frozendict of the given type with the items of mp, a dict or
+   a frozendict. */
+static PyObject *
+frozendict_from_dict(PyTypeObject *type, PyDictObject *mp)
+{
+    PyFrozenDictObject *fd;
+    PyDictObject *copy = NULL;
+
+    if (mp->ma_used != 0 &&
+            (mp->ma_values != NULL ||
+             mp->ma_used < (mp->ma_keys->dk_nentries * 2) / 3)) {
+        /* Split or sparse table: share a compact copy */
+        copy = (PyDictObject *)PyDict_New();
+        if (copy == NULL)
+            return NULL;
+        if (dict_merge((PyObject *)copy, (PyObject *)mp, 1) < 0) {
+            Py_DECREF(copy);
+            return NULL;
+        }
+        mp = copy;
+    }
+
+    if (mp->ma_used != 0 && dictkeys_share(mp->ma_keys) < 0) {
+        Py_XDECREF(copy);
+        return NULL;
+    }
+    if (type == &PyFrozenDict_Type) {
+        fd = PyObject_GC_New(PyFrozenDictObject, type);
+    }
+    else {
+        /* The object is tracked by tp_alloc */
+        fd = (PyFrozenDictObject *)type->tp_alloc(type, 0);
+    }
+    if (fd == NULL) {
+        if (mp->ma_used != 0)
+            dictkeys_decref(mp->ma_keys);
+        Py_XDECREF(copy);
+        return NULL;
+    }
+    if (mp->ma_used == 0) {
+        dictkeys_incref(Py_EMPTY_KEYS);
+        fd->dict.ma_keys = Py_EMPTY_KEYS;
+        fd->dict.ma_values = empty_values;
+    }
+    else {
+        fd->dict.ma_keys = mp->ma_keys;
+        fd->dict.ma_values = NULL;
+    }
+    fd->dict.ma_used = mp->ma_used;
+    fd->dict.ma_version_tag = DICT_NEXT_VERSION();
+    fd->hash = -1;
+    if (type == &PyFrozenDict_Type && _PyObject_GC_IS_TRACKED(mp)) {
+        _PyObject_GC_TRACK(fd);
+    }
+    Py_XDECREF(copy);
+    assert(_PyDict_CheckConsistency(&fd->dict));
+    return (PyObject *)fd;
+}
+
+static PyObject *
+make_new_frozendict(PyTypeObject *type, PyObject *arg, PyObject *kwds)
+{
+    PyObject *d, *result;
+
+    if (arg != NULL && kwds == NULL) {
+        /* frozendict(f) is idempotent */
+        if (type == &PyFrozenDict_Type && PyFrozenDict_CheckExact(arg)) {
+            Py_INCREF(arg);
+            return arg;
+        }
+        if (PyAnyDict_Check(arg) &&
+                Py_TYPE(arg)->tp_iter == (getiterfunc)dict_iter) {
+            return frozendict_from_dict(type, (PyDictObject *)arg);
+        }
+    }
+
+    d = PyDict_New();
+    if (d == NULL)
+        return NULL;
+    if (arg != NULL && dict_update_arg(d, arg) < 0) {
+        Py_DECREF(d);
+        return NULL;
+    }
+    if (kwds != NULL && PyDict_Merge(d, kwds, 1) < 0) {
+        Py_DECREF(d);
+        return NULL;
+    }
+    result = frozendict_from_dict(type, (PyDictObject *)d);
+    Py_DECREF(d);
+    return result;
+}
+
+static PyObject *
+frozendict_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    PyObject *arg = NULL;
+
+    if (!PyArg_UnpackTuple(args, type->tp_name, 0, 1, &arg))
+        return NULL;
+    if (kwds != NULL) {
+        if (!PyArg_ValidateKeywordArguments(kwds))
+            return NULL;
+        if (PyDict_GET_SIZE(kwds) == 0)
+            kwds = NULL;
+    }
+    return make_new_frozendict(type, arg, kwds);
+}
+
+PyObject *
+PyFrozenDict_New(PyObject *iterable)
+{
+    return make_new_frozendict(&PyFrozenDict_Type, iterable, NULL);
+}
+
+static int
+frozendict_tp_clear(PyObject *op)
+{
+    PyDictObject *mp = (PyDictObject *)op;
+    PyDictKeysObject *oldkeys = mp->ma_keys;
+
+    if (mp->ma_values == empty_values)
+        return 0;
+    dictkeys_incref(Py_EMPTY_KEYS);
+    mp->ma_keys = Py_EMPTY_KEYS;
+    mp->ma_values = empty_values;
+    mp->ma_used = 0;
+    dictkeys_decref(oldkeys);
+    return 0;
+}
+
+static Py_uhash_t
+_shuffle_bits(Py_uhash_t h)
+{
+    return ((h ^ 89869747UL) ^ (h << 16)) * 3644798167UL;
+}
+
+/* Like the hash of a frozenset of the items, computed from the hashes of
+   the keys stored in the entries. */
+static Py_hash_t
+frozendict_hash(PyFrozenDictObject *fd)
+{
+    PyDictObject *mp = &fd->dict;
+    Py_uhash_t hash = 0;
+
+    if (fd->hash != -1)
+        return fd->hash;
+
+    if (mp->ma_used != 0) {
+        PyDictKeyEntry *ep0 = DK_ENTRIES(mp->ma_keys);
+        Py_ssize_t i, n = mp->ma_keys->dk_nentries;
+
+        assert(mp->ma_values == NULL);
+        for (i = 0; i < n; i++) {
+            PyObject *value = ep0[i].me_value;
+            Py_hash_t vhash;
+            if (value == NULL)
+                continue;
+            vhash = PyObject_Hash(value);
+            if (vhash == -1)
+                return -1;
+            hash ^= _shuffle_bits((Py_uhash_t)ep0[i].me_hash * 1000003UL
+                                  ^ (Py_uhash_t)vhash);
+        }
+    }
+
+    /* Factor in the number of items */
+    hash ^= ((Py_uhash_t)mp->ma_used + 1) * 1927868237UL;
+
+    /* Disperse patterns arising in nested frozendicts */
+    hash ^= (hash >> 11) ^ (hash >> 25);
+    hash = hash * 69069U + 907133923UL;
+
+    /* -1 is reserved as an error code */
+    if (hash == (Py_uhash_t)-1)
+        hash = 590923713UL;
+
+    fd->hash = hash;
+    return hash;
+}
+
+static PyObject *
+frozendict_repr(PyDictObject *mp)
+{
+    PyObject *result, *dictrepr;
+
+    if (mp->ma_used == 0)
+        return PyUnicode_FromFormat("%s()", _PyType_Name(Py_TYPE(mp)));
+    dictrepr = dict_repr(mp);
+    if (dictrepr == NULL)
+        return NULL;
+    result = PyUnicode_FromFormat("%s(%U)", _PyType_Name(Py_TYPE(mp)),
+                                  dictrepr);
+    Py_DECREF(dictrepr);
+    return result;
+}
+
+/*[clinic input]
+@classmethod
+frozendict.fromkeys
+    iterable: object
+    value: object=None
+    /
+
+Create a new frozendict with keys from iterable and values set to value.
+[clinic start generated code]*/
+
+static PyObject *
+frozendict_fromkeys_impl(PyTypeObject *type, PyObject *iterable,
+                         PyObject *value)
+/*[clinic end generated code: output=2729d20c12ef0c12 input=9b1cd7494cbf18ea]*/
+{
+    PyObject *d, *result;
+
+    d = _PyDict_FromKeys((PyObject *)&PyDict_Type, iterable, value);
+    if (d == NULL)
+        return NULL;
+    if (type == &PyFrozenDict_Type)
+        result = frozendict_from_dict(type, (PyDictObject *)d);
+    else
+        result = PyObject_CallFunctionObjArgs((PyObject *)type, d, NULL);
+    Py_DECREF(d);
+    return result;
+}
+
+static PyObject *
+frozendict_copy(PyDictObject *mp, PyObject *Py_UNUSED(ignored))
+{
+    if (PyFrozenDict_CheckExact(mp)) {
+        Py_INCREF(mp);
+        return (PyObject *)mp;
+    }
+    return frozendict_from_dict(&PyFrozenDict_Type, mp);
+}
+
+static PyObject *
+frozendict_reduce(PyDictObject *mp, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *items, *state;
+    _Py_IDENTIFIER(__dict__);
+
+    /* Shares the keys of mp */
+    items = PyDict_Copy((PyObject *)mp);
+    if (items == NULL)
+        return NULL;
+    state = _PyObject_GetAttrId((PyObject *)mp, &PyId___dict__);
+    if (state == NULL) {
+        PyErr_Clear();
+        state = Py_None;
+        Py_INCREF(state);
+    }
+    return Py_BuildValue("O(N)N", Py_TYPE(mp), items, state);
+}
+
+PyDoc_STRVAR(frozendict_copy__doc__,
+"D.copy() -> a shallow copy of D");
+
+PyDoc_STRVAR(reduce__doc__, "Return state information for pickling.");
+
+static PyMethodDef frozendict_methods[] = {
+    DICT___CONTAINS___METHODDEF
+    {"__getitem__", (PyCFunction)(void(*)(void))dict_subscript,        METH_O | METH_COEXIST,
+     getitem__doc__},
+    {"__sizeof__",      (PyCFunction)(void(*)(void))dict_sizeof,       METH_NOARGS,
+     sizeof__doc__},
+    DICT_GET_METHODDEF
+    {"keys",            dictkeys_new,                   METH_NOARGS,
+    keys__doc__},
+    {"items",           dictitems_new,                  METH_NOARGS,
+    items__doc__},
+    {"values",          dictvalues_new,                 METH_NOARGS,
+    values__doc__},
+    FROZENDICT_FROMKEYS_METHODDEF
+    {"copy",            (PyCFunction)frozendict_copy,   METH_NOARGS,
+     frozendict_copy__doc__},
+    DICT___REVERSED___METHODDEF
+    {"__reduce__",      (PyCFunction)frozendict_reduce, METH_NOARGS,
+     reduce__doc__},
+    {NULL,              NULL}   /* sentinel */
+};
+
+static PyMappingMethods frozendict_as_mapping = {
+    (lenfunc)dict_length, /*mp_length*/
+    (binaryfunc)dict_subscript, /*mp_subscript*/
+    0, /*mp_ass_subscript*/
+};
+
+PyDoc_STRVAR(frozendict_doc,
+"frozendict() -> new empty frozendict\n"
+"frozendict(mapping) -> new frozendict initialized from a mapping object's\n"
+"    (key, value) pairs\n"
+"frozendict(iterable) -> new frozendict initialized from an iterable of\n"
+"    (key, value) pairs\n"
+"frozendict(**kwargs) -> new frozendict initialized with the name=value\n"
+"    pairs in the keyword argument list.\n"
+"\n"
+"An immutable and hashable dict.  frozendict(d) does not copy the table\n"
+"of the dict d; the first modification of d does.");
+
+PyTypeObject PyFrozenDict_Type = {
+    PyVarObject_HEAD_INIT(&PyType_Type, 0)
+    "collections.frozendict",
+    sizeof(PyFrozenDictObject),
+    0,
+    (destructor)dict_dealloc,                   /* tp_dealloc */
+    0,                                          /* tp_print */
+    0,                                          /* tp_getattr */
+    0,                                          /* tp_setattr */
+    0,                                          /* tp_reserved */
+    (reprfunc)frozendict_repr,                  /* tp_repr */
+    0,                                          /* tp_as_number */
+    &dict_as_sequence,                          /* tp_as_sequence */
+    &frozendict_as_mapping,                     /* tp_as_mapping */
+    (hashfunc)frozendict_hash,                  /* tp_hash */
+    0,                                          /* tp_call */
+    0,                                          /* tp_str */
+    PyObject_GenericGetAttr,                    /* tp_getattro */
+    0,                                          /* tp_setattro */
+    0,                                          /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC |
+        Py_TPFLAGS_BASETYPE,                    /* tp_flags */
+    frozendict_doc,                             /* tp_doc */
+    dict_traverse,                              /* tp_traverse */
+    frozendict_tp_clear,                        /* tp_clear */
+    dict_richcompare,                           /* tp_richcompare */
+    0,                                          /* tp_weaklistoffset */
+    (getiterfunc)dict_iter,                     /* tp_iter */
+    0,                                          /* tp_iternext */
+    frozendict_methods,                         /* tp_methods */
+    0,                                          /* tp_members */
+    0,                                          /* tp_getset */
+    0,                                          /* tp_base */
+    0,                                          /* tp_dict */
+    0,                                          /* tp_descr_get */
+    0,                                          /* tp_descr_set */
+    0,                                          /* tp_dictoffset */
+    0,                                          /* tp_init */
+    PyType_GenericAlloc,                        /* tp_alloc */
+    frozendict_new,                             /* tp_new */
+    PyObject_GC_Del,                            /* tp_free */
+};
+
 PyObject *
 _PyDict_GetItemId(PyObject *dp, struct _Py_Identifier *key)
 {
@@ -3364,7 +4413,12 @@ dictiter_new(PyDictObject *dict, PyTypeObject *itertype)
     if ((itertype == &PyDictRevIterKey_Type ||
          itertype == &PyDictRevIterItem_Type ||
          itertype == &PyDictRevIterValue_Type) && dict->ma_used) {
+        if (dict->ma_values) {
+            di->di_pos = dict->ma_used - 1;
+        }
+        else {
             di->di_pos = dict->ma_keys->dk_nentries - 1;
+        }
     }
     else {
         di->di_pos = 0;
@@ -3437,7 +4491,7 @@ dictiter_iternextkey(dictiterobject *di)
 
     if (d == NULL)
         return NULL;
-    assert (PyDict_Check(d));
+    assert (PyAnyDict_Check(d));
 
     if (di->di_used != d->ma_used) {
         PyErr_SetString(PyExc_RuntimeError,
@@ -3452,8 +4506,9 @@ dictiter_iternextkey(dictiterobject *di)
     if (d->ma_values) {
         if (i >= d->ma_used)
             goto fail;
-        key = DK_ENTRIES(k)[i].me_key;
-        assert(d->ma_values[i] != NULL);
+        Py_ssize_t ix = values_get_order(k, d->ma_values, i);
+        key = DK_ENTRIES(k)[ix].me_key;
+        assert(d->ma_values[ix] != NULL);
     }
     else {
         Py_ssize_t n = k->dk_nentries;
@@ -3519,7 +4574,7 @@ dictiter_iternextvalue(dictiterobject *di)
 
     if (d == NULL)
         return NULL;
-    assert (PyDict_Check(d));
+    assert (PyAnyDict_Check(d));
 
     if (di->di_used != d->ma_used) {
         PyErr_SetString(PyExc_RuntimeError,
@@ -3533,7 +4588,7 @@ dictiter_iternextvalue(dictiterobject *di)
     if (d->ma_values) {
         if (i >= d->ma_used)
             goto fail;
-        value = d->ma_values[i];
+        value = d->ma_values[values_get_order(d->ma_keys, d->ma_values, i)];
         assert(value != NULL);
     }
     else {
@@ -3600,7 +4655,7 @@ dictiter_iternextitem(dictiterobject *di)
 
     if (d == NULL)
         return NULL;
-    assert (PyDict_Check(d));
+    assert (PyAnyDict_Check(d));
 
     if (di->di_used != d->ma_used) {
         PyErr_SetString(PyExc_RuntimeError,
@@ -3614,8 +4669,9 @@ dictiter_iternextitem(dictiterobject *di)
     if (d->ma_values) {
         if (i >= d->ma_used)
             goto fail;
-        key = DK_ENTRIES(d->ma_keys)[i].me_key;
-        value = d->ma_values[i];
+        Py_ssize_t ix = values_get_order(d->ma_keys, d->ma_values, i);
+        key = DK_ENTRIES(d->ma_keys)[ix].me_key;
+        value = d->ma_values[ix];
         assert(value != NULL);
     }
     else {
@@ -3703,7 +4759,7 @@ dictreviter_iternext(dictiterobject *di)
     if (d == NULL) {
         return NULL;
     }
-    assert (PyDict_Check(d));
+    assert (PyAnyDict_Check(d));
 
     if (di->di_used != d->ma_used) {
         PyErr_SetString(PyExc_RuntimeError,
@@ -3720,8 +4776,9 @@ dictreviter_iternext(dictiterobject *di)
         if (i < 0) {
             goto fail;
         }
-        key = DK_ENTRIES(k)[i].me_key;
-        value = d->ma_values[i];
+        Py_ssize_t ix = values_get_order(k, d->ma_values, i);
+        key = DK_ENTRIES(k)[ix].me_key;
+        value = d->ma_values[ix];
         assert (value != NULL);
     }
     else {
@@ -3803,7 +4860,7 @@ static PyObject *
 dict___reversed___impl(PyDictObject *self)
 /*[clinic end generated code: output=e674483336d1ed51 input=23210ef3477d8c4d]*/
 {
-    assert (PyDict_Check(self));
+    assert (PyAnyDict_Check(self));
     return dictiter_new(self, &PyDictRevIterKey_Type);
 }
 
@@ -3886,7 +4943,7 @@ _PyDictView_New(PyObject *dict, PyTypeObject *type)
         PyErr_BadInternalCall();
         return NULL;
     }
-    if (!PyDict_Check(dict)) {
+    if (!PyAnyDict_Check(dict)) {
         /* XXX Get rid of this restriction later */
         PyErr_Format(PyExc_TypeError,
                      "%s() requires a dict argument, not '%s'",
@@ -4510,13 +5567,8 @@ _PyObjectDict_SetItem(PyTypeObject *tp, PyObject **dictptr,
             *dictptr = dict;
         }
         if (value == NULL) {
+            /* Deleting from a split table keeps the keys shared */
             res = PyDict_DelItem(dict, key);
-            // Since key sharing dict doesn't allow deletion, PyDict_DelItem()
-            // always converts dict to combined form.
-            if ((cached = CACHED_KEYS(tp)) != NULL) {
-                CACHED_KEYS(tp) = NULL;
-                dictkeys_decref(cached);
-            }
         }
         else {
             int was_shared = (cached == ((PyDictObject *)dict)->ma_keys);
@@ -4524,7 +5576,8 @@ _PyObjectDict_SetItem(PyTypeObject *tp, PyObject **dictptr,
             if (was_shared &&
                     (cached = CACHED_KEYS(tp)) != NULL &&
                     cached != ((PyDictObject *)dict)->ma_keys) {
-                /* PyDict_SetItem() may call dictresize and convert split table
+                /* PyDict_SetItem() may give the split table larger shared
+                 * keys, which become the type's shared keys, or convert it
                  * into combined table.  In such case, convert it to split
                  * table again and update type's shared key only when this is
                  * the only dict sharing key with the type.
@@ -4538,7 +5591,8 @@ _PyObjectDict_SetItem(PyTypeObject *tp, PyObject **dictptr,
                  *             self.d, self.e, self.f = 4, 5, 6
                  *     a = C()
                  */
-                if (cached->dk_refcnt == 1) {
+                if (_PyDict_HasSplitTable((PyDictObject *)dict) ||
+                        cached->dk_refcnt == 1) {
                     CACHED_KEYS(tp) = make_keys_shared(dict);
                 }
                 else {
@@ -612,6 +612,8 @@ _PyFrame_New_NoTrack(PyThreadState *tstate, PyCodeObject *code,
         return NULL;
     }
 #endif
+    if (_PyCode_MATERIALIZE(code) < 0)
+        return NULL;
     if (back == NULL || back->f_globals != globals) {
         builtins = _PyDict_GetItemId(globals, &PyId___builtins__);
         if (builtins) {
@@ -9,11 +9,25 @@
 #include "code.h"
 #include "structmember.h"
 
+/* Return a borrowed reference to the docstring of a loaded code object */
+static PyObject *
+code_get_doc(PyCodeObject *code)
+{
+    PyObject *doc;
+
+    if (PyTuple_GET_SIZE(code->co_consts) >= 1) {
+        doc = PyTuple_GET_ITEM(code->co_consts, 0);
+        if (PyUnicode_Check(doc))
+            return doc;
+    }
+    return Py_None;
+}
+
 PyObject *
 PyFunction_NewWithQualName(PyObject *code, PyObject *globals, PyObject *qualname)
 {
     PyFunctionObject *op;
-    PyObject *doc, *consts, *module;
+    PyObject *module;
     static PyObject *__name__ = NULL;
 
     if (__name__ == NULL) {
@@ -37,16 +51,14 @@ PyFunction_NewWithQualName(PyObject *code, PyObject *globals, PyObject *qualname
     op->func_kwdefaults = NULL; /* No keyword only defaults */
     op->func_closure = NULL;
 
-    consts = ((PyCodeObject *)code)->co_consts;
-    if (PyTuple_Size(consts) >= 1) {
-        doc = PyTuple_GetItem(consts, 0);
-        if (!PyUnicode_Check(doc))
-            doc = Py_None;
+    /* Don't load a lazily loaded code object for its docstring until
+       __doc__ is read */
+    if (((PyCodeObject *)code)->co_lazybuf != NULL)
+        op->func_doc = NULL;
+    else {
+        op->func_doc = code_get_doc((PyCodeObject *)code);
+        Py_INCREF(op->func_doc);
     }
-    else
-        doc = Py_None;
-    Py_INCREF(doc);
-    op->func_doc = doc;
 
     op->func_dict = NULL;
     op->func_module = NULL;
@@ -236,7 +248,6 @@ PyFunction_SetAnnotations(PyObject *op, PyObject *annotations)
 static PyMemberDef func_memberlist[] = {
     {"__closure__",   T_OBJECT,     OFF(func_closure),
      RESTRICTED|READONLY},
-    {"__doc__",       T_OBJECT,     OFF(func_doc), PY_WRITE_RESTRICTED},
     {"__globals__",   T_OBJECT,     OFF(func_globals),
      RESTRICTED|READONLY},
     {"__module__",    T_OBJECT,     OFF(func_module), PY_WRITE_RESTRICTED},
@@ -250,6 +261,46 @@ func_get_code(PyFunctionObject *op, void *Py_UNUSED(ignored))
     return op->func_code;
 }
 
+/* Set func_doc from the code if it was left NULL for a lazily loaded code
+   object. */
+static int
+func_load_doc(PyFunctionObject *op)
+{
+    if (op->func_doc == NULL && op->func_code != NULL) {
+        PyCodeObject *code = (PyCodeObject *)op->func_code;
+        if (_PyCode_MATERIALIZE(code) < 0)
+            return -1;
+        if (op->func_doc == NULL) {
+            op->func_doc = code_get_doc(code);
+            Py_INCREF(op->func_doc);
+        }
+    }
+    return 0;
+}
+
+static PyObject *
+func_get_doc(PyFunctionObject *op, void *Py_UNUSED(ignored))
+{
+    if (func_load_doc(op) < 0)
+        return NULL;
+    if (op->func_doc == NULL) {
+        Py_RETURN_NONE;
+    }
+    Py_INCREF(op->func_doc);
+    return op->func_doc;
+}
+
+static int
+func_set_doc(PyFunctionObject *op, PyObject *value, void *Py_UNUSED(ignored))
+{
+    /* Deleting __doc__ sets it to None */
+    if (value == NULL)
+        value = Py_None;
+    Py_INCREF(value);
+    Py_XSETREF(op->func_doc, value);
+    return 0;
+}
+
 static int
 func_set_code(PyFunctionObject *op, PyObject *value, void *Py_UNUSED(ignored))
 {
@@ -273,6 +324,9 @@ func_set_code(PyFunctionObject *op, PyObject *value, void *Py_UNUSED(ignored))
                      nclosure, nfree);
         return -1;
     }
+    /* The docstring comes from the original code */
+    if (func_load_doc(op) < 0)
+        return -1;
     Py_INCREF(value);
     Py_XSETREF(op->func_code, value);
     return 0;
@@ -408,6 +462,7 @@ func_set_annotations(PyFunctionObject *op, PyObject *value, void *Py_UNUSED(igno
 
 static PyGetSetDef func_getsetlist[] = {
     {"__code__", (getter)func_get_code, (setter)func_set_code},
+    {"__doc__", (getter)func_get_doc, (setter)func_set_doc},
     {"__defaults__", (getter)func_get_defaults,
      (setter)func_set_defaults},
     {"__kwdefaults__", (getter)func_get_kwdefaults,
@@ -1213,6 +1213,10 @@ struct s_MergeState {
      * of tuples. It may be set to safe_object_compare, but the idea is that hopefully
      * we can assume more, and use one of the special-case compares. */
     int (*tuple_elem_compare)(PyObject *, PyObject *, MergeState *);
+
+    /* True while sorting with the GIL released (see parallel_sort()): the
+     * compare functions and merge_getmem() must not use the C API then. */
+    int nogil;
 };
 
 /* binarysort is the best method for sorting small arrays: it does
@@ -1550,6 +1554,7 @@ merge_init(MergeState *ms, Py_ssize_t list_size, int has_keyfunc)
     ms->a.keys = ms->temparray;
     ms->n = 0;
     ms->min_gallop = MIN_GALLOP;
+    ms->nogil = 0;
 }
 
 /* Free all the temp memory owned by the MergeState.  This must be called
@@ -1561,7 +1566,7 @@ merge_freemem(MergeState *ms)
 {
     assert(ms != NULL);
     if (ms->a.keys != ms->temparray)
-        PyMem_Free(ms->a.keys);
+        PyMem_RawFree(ms->a.keys);
 }
 
 /* Ensure enough temp memory for 'need' array slots is available.
@@ -1582,19 +1587,20 @@ merge_getmem(MergeState *ms, Py_ssize_t need)
      * we don't care what's in the block.
      */
     merge_freemem(ms);
-    if ((size_t)need > PY_SSIZE_T_MAX / sizeof(PyObject *) / multiplier) {
-        PyErr_NoMemory();
-        return -1;
+    ms->a.keys = NULL;
+    if ((size_t)need <= PY_SSIZE_T_MAX / sizeof(PyObject *) / multiplier) {
+        /* The raw allocator doesn't need the GIL. */
+        ms->a.keys = (PyObject **)PyMem_RawMalloc(multiplier * need
+                                                 * sizeof(PyObject *));
     }
-    ms->a.keys = (PyObject **)PyMem_Malloc(multiplier * need
-                                          * sizeof(PyObject *));
     if (ms->a.keys != NULL) {
         ms->alloced = need;
         if (ms->a.values != NULL)
             ms->a.values = &ms->a.keys[need];
         return 0;
     }
-    PyErr_NoMemory();
+    if (!ms->nogil)
+        PyErr_NoMemory();
     return -1;
 }
 #define MERGE_GETMEM(MS, NEED) ((NEED) <= (MS)->alloced ? 0 :   \
@@ -2095,7 +2101,7 @@ unsafe_latin_compare(PyObject *v, PyObject *w, MergeState *ms)
            res < 0 :
            PyUnicode_GET_LENGTH(v) < PyUnicode_GET_LENGTH(w));
 
-    assert(res == PyObject_RichCompareBool(v, w, Py_LT));;
+    assert(ms->nogil || res == PyObject_RichCompareBool(v, w, Py_LT));
     return res;
 }
 
@@ -2123,7 +2129,7 @@ unsafe_long_compare(PyObject *v, PyObject *w, MergeState *ms)
         w0 = -w0;
 
     res = v0 < w0;
-    assert(res == PyObject_RichCompareBool(v, w, Py_LT));
+    assert(ms->nogil || res == PyObject_RichCompareBool(v, w, Py_LT));
     return res;
 }
 
@@ -2138,7 +2144,7 @@ unsafe_float_compare(PyObject *v, PyObject *w, MergeState *ms)
     assert(v->ob_type == &PyFloat_Type);
 
     res = PyFloat_AS_DOUBLE(v) < PyFloat_AS_DOUBLE(w);
-    assert(res == PyObject_RichCompareBool(v, w, Py_LT));
+    assert(ms->nogil || res == PyObject_RichCompareBool(v, w, Py_LT));
     return res;
 }
 
@@ -2184,6 +2190,562 @@ unsafe_tuple_compare(PyObject *v, PyObject *w, MergeState *ms)
         return PyObject_RichCompareBool(vt->ob_item[i], wt->ob_item[i], Py_LT);
 }
 
+/* Radix sort.
+ *
+ * Large lists whose keys are all ints fitting in a machine word, or all
+ * floats, or all tuples of a few such ints and floats (of the same types
+ * at each position), are sorted on the unboxed values rather than by
+ * comparing objects: every key is mapped to unsigned 64-bit integers
+ * ordered the same way as the key, and the (integer, index) pairs are
+ * sorted by a least significant digit radix sort, one byte at a time,
+ * starting from the last item of tuples.  Each pass is a stable counting
+ * sort, so the result is the same stable order timsort would produce.  The
+ * values are then permuted in the order of the sorted indices.
+ *
+ * Timsort is linear on data which is already mostly ordered while a radix
+ * sort is not, so radix_sort() gives up on such lists, as well as on lists
+ * containing a NaN (which timsort leaves in an order the float values
+ * don't determine) and when it can't allocate its buffers.
+ */
+
+/* Lists shorter than this are left to timsort. */
+#define RADIX_SORT_MIN_SIZE 512
+
+/* Lists with fewer than one turn between ascending and descending order
+ * per this many elements are left to timsort. */
+#define RADIX_SORT_MIN_TURNS 16
+
+/* Tuple keys longer than this are left to timsort. */
+#define RADIX_SORT_MAX_WIDTH 4
+
+typedef struct {
+    uint64_t key;
+    Py_ssize_t index;
+} radix_item;
+
+/* Return 1 if the absolute value of the int v is below 2**63. */
+static int
+radix_long_fits(PyObject *v)
+{
+    Py_ssize_t size = Py_ABS(Py_SIZE(v));
+
+    if (size <= 63 / PyLong_SHIFT)
+        return 1;
+    if (size > 63 / PyLong_SHIFT + 1)
+        return 0;
+    return (((PyLongObject *)v)->ob_digit[size - 1]
+            >> (63 % PyLong_SHIFT)) == 0;
+}
+
+/* Map an int for which radix_long_fits() is true, or a float which isn't a
+ * NaN, to an unsigned integer with the same ordering. */
+static uint64_t
+radix_key(PyObject *v)
+{
+    uint64_t key;
+
+    if (PyFloat_CheckExact(v)) {
+        double d = PyFloat_AS_DOUBLE(v);
+
+        assert(!Py_IS_NAN(d));
+        /* -0.0 == 0.0, so they must get the same key */
+        if (d == 0.0)
+            d = 0.0;
+        memcpy(&key, &d, sizeof(key));
+        /* Negative floats are ordered by decreasing magnitude. */
+        if (key >> 63)
+            key = ~key;
+        else
+            key |= (uint64_t)1 << 63;
+    }
+    else {
+        PyLongObject *vl = (PyLongObject *)v;
+        Py_ssize_t i = Py_ABS(Py_SIZE(vl));
+
+        assert(PyLong_CheckExact(v));
+        assert(radix_long_fits(v));
+        key = 0;
+        while (--i >= 0)
+            key = (key << PyLong_SHIFT) | vl->ob_digit[i];
+        if (Py_SIZE(vl) < 0)
+            key = -key;
+        key ^= (uint64_t)1 << 63;
+    }
+    return key;
+}
+
+/* Stable sort of a[0:n] on the bytes of their keys which aren't the same in
+ * all of them.  counts[pass] is the histogram of byte number pass of the
+ * keys, for the nbytes low bytes.  b[0:n] is scratch space.  Return
+ * whichever of a and b holds the result. */
+static radix_item *
+radix_passes(radix_item *a, radix_item *b, Py_ssize_t n,
+             Py_ssize_t counts[][256], int nbytes)
+{
+    Py_ssize_t i;
+    int pass;
+
+    for (pass = 0; pass < nbytes; pass++) {
+        Py_ssize_t *count = counts[pass];
+        Py_ssize_t offset = 0, c;
+        int shift = 8 * pass;
+        radix_item *tmp;
+
+        /* Skip the bytes which are the same in all keys. */
+        if (count[(a[0].key >> shift) & 0xff] == n)
+            continue;
+        for (i = 0; i < 256; i++) {
+            c = count[i];
+            count[i] = offset;
+            offset += c;
+        }
+        for (i = 0; i < n; i++)
+            b[count[(a[i].key >> shift) & 0xff]++] = a[i];
+        tmp = a;
+        a = b;
+        b = tmp;
+    }
+    return a;
+}
+
+/* Sort values[0:n] on keys[0:n], whose types are described above, in place.
+ * keys and values may be the same array; otherwise the keys are left in an
+ * unspecified order.  Return 1 if the values were sorted, 0 if they were
+ * left untouched for timsort. */
+static int
+radix_sort(PyObject **keys, PyObject **values, Py_ssize_t n)
+{
+    PyTypeObject *types[RADIX_SORT_MAX_WIDTH];
+    uint64_t min[RADIX_SORT_MAX_WIDTH], max[RADIX_SORT_MAX_WIDTH];
+    uint64_t cur[RADIX_SORT_MAX_WIDTH], prev[RADIX_SORT_MAX_WIDTH];
+    int nbytes[RADIX_SORT_MAX_WIDTH];
+    Py_ssize_t counts[8][256];
+    radix_item *buf, *a, *b;
+    uint64_t *packed = NULL;
+    PyObject **out;
+    Py_ssize_t i, j, width, turns;
+    int in_tuples, direction, pass;
+
+    in_tuples = PyTuple_CheckExact(keys[0]);
+    width = in_tuples ? PyTuple_GET_SIZE(keys[0]) : 1;
+    if (width < 1 || width > RADIX_SORT_MAX_WIDTH)
+        return 0;
+    for (j = 0; j < width; j++) {
+        types[j] = Py_TYPE(in_tuples ? PyTuple_GET_ITEM(keys[0], j) : keys[0]);
+        if (types[j] != &PyLong_Type && types[j] != &PyFloat_Type)
+            return 0;
+        min[j] = UINT64_MAX;
+        max[j] = prev[j] = 0;
+    }
+
+    /* Look at the keys before allocating anything: check their types,
+     * count the places where they turn from ascending to descending or
+     * back, and find their range. */
+    turns = 0;
+    direction = 0;
+    for (i = 0; i < n; i++) {
+        PyObject *key = keys[i];
+
+        if (in_tuples && (!PyTuple_CheckExact(key) ||
+                          PyTuple_GET_SIZE(key) != width))
+            return 0;
+        for (j = 0; j < width; j++) {
+            PyObject *v = in_tuples ? PyTuple_GET_ITEM(key, j) : key;
+
+            if (Py_TYPE(v) != types[j])
+                return 0;
+            if (types[j] == &PyFloat_Type) {
+                if (Py_IS_NAN(PyFloat_AS_DOUBLE(v)))
+                    return 0;
+            }
+            else if (!radix_long_fits(v))
+                return 0;
+            cur[j] = radix_key(v);
+            if (cur[j] < min[j])
+                min[j] = cur[j];
+            if (cur[j] > max[j])
+                max[j] = cur[j];
+        }
+        if (i > 0) {
+            for (j = 0; j < width && cur[j] == prev[j]; j++)
+                ;
+            if (j < width) {
+                int d = cur[j] > prev[j] ? 1 : -1;
+                turns += d != direction;
+                direction = d;
+            }
+        }
+        memcpy(prev, cur, width * sizeof(cur[0]));
+        /* Give up early on lists which start out mostly ordered. */
+        if (i == n / 8 && turns < i / RADIX_SORT_MIN_TURNS)
+            return 0;
+    }
+    /* Few turns means long runs, which timsort merges in linear time. */
+    if (turns < n / RADIX_SORT_MIN_TURNS)
+        return 0;
+
+    if ((size_t)n > PY_SSIZE_T_MAX / (2 * sizeof(radix_item)))
+        return 0;
+    buf = PyMem_Malloc(2 * n * sizeof(radix_item));
+    if (buf == NULL)
+        return 0;
+    if (width > 1) {
+        /* The keys of all the items but the last of each tuple, kept for
+         * the later rounds. */
+        if ((size_t)n <= PY_SSIZE_T_MAX / ((width - 1) * sizeof(uint64_t)))
+            packed = PyMem_Malloc(n * (width - 1) * sizeof(uint64_t));
+        if (packed == NULL) {
+            PyMem_Free(buf);
+            return 0;
+        }
+    }
+    a = buf;
+    b = buf + n;
+
+    /* Only sort on the bytes in which the keys differ from the minimum. */
+    for (j = 0; j < width; j++) {
+        for (nbytes[j] = 0;
+             nbytes[j] < 8 && (max[j] - min[j]) >> (8 * nbytes[j]);
+             nbytes[j]++)
+            ;
+    }
+
+    /* Sort on the last item of the keys first, then on each of the others
+     * in turn. */
+    for (j = width - 1; j >= 0; j--) {
+        memset(counts, 0, nbytes[j] * sizeof(counts[0]));
+        for (i = 0; i < n; i++) {
+            uint64_t key;
+
+            if (j == width - 1) {
+                a[i].index = i;
+                if (in_tuples) {
+                    Py_ssize_t k;
+                    for (k = 0; k < j; k++)
+                        packed[i * (width - 1) + k] = radix_key(
+                            PyTuple_GET_ITEM(keys[i], k)) - min[k];
+                    key = radix_key(PyTuple_GET_ITEM(keys[i], j));
+                }
+                else
+                    key = radix_key(keys[i]);
+                key -= min[j];
+            }
+            else
+                key = packed[a[i].index * (width - 1) + j];
+            a[i].key = key;
+            for (pass = 0; pass < nbytes[j]; pass++)
+                counts[pass][(key >> (8 * pass)) & 0xff]++;
+        }
+        a = radix_passes(a, b, n, counts, nbytes[j]);
+        b = a == buf ? buf + n : buf;
+    }
+
+    /* b is free again: use it to permute the values. */
+    out = (PyObject **)b;
+    for (i = 0; i < n; i++)
+        out[i] = values[a[i].index];
+    memcpy(values, out, n * sizeof(PyObject *));
+    PyMem_Free(packed);
+    PyMem_Free(buf);
+    return 1;
+}
+
+/* Sort lo[0:n] with timsort, ms having been initialized by merge_init().
+ * Return 0 on success, -1 on error.  On return ms->pending[0] describes the
+ * sorted slice.
+ */
+static int
+timsort(MergeState *ms, sortslice lo, Py_ssize_t n)
+{
+    Py_ssize_t nremaining = n;
+    Py_ssize_t minrun;
+
+    /* March over the array once, left to right, finding natural runs,
+     * and extending short natural runs to minrun elements.
+     */
+    minrun = merge_compute_minrun(nremaining);
+    do {
+        int descending;
+        Py_ssize_t n;
+
+        /* Identify next run. */
+        n = count_run(ms, lo.keys, lo.keys + nremaining, &descending);
+        if (n < 0)
+            return -1;
+        if (descending)
+            reverse_sortslice(&lo, n);
+        /* If short, extend to min(minrun, nremaining). */
+        if (n < minrun) {
+            const Py_ssize_t force = nremaining <= minrun ?
+                              nremaining : minrun;
+            if (binarysort(ms, lo, lo.keys + force, lo.keys + n) < 0)
+                return -1;
+            n = force;
+        }
+        /* Push run onto pending-runs stack, and maybe merge. */
+        assert(ms->n < MAX_MERGE_PENDING);
+        ms->pending[ms->n].base = lo;
+        ms->pending[ms->n].len = n;
+        ++ms->n;
+        if (merge_collapse(ms) < 0)
+            return -1;
+        /* Advance to find next run. */
+        sortslice_advance(&lo, n);
+        nremaining -= n;
+    } while (nremaining);
+
+    if (merge_force_collapse(ms) < 0)
+        return -1;
+    assert(ms->n == 1);
+    assert(ms->pending[0].len == n);
+    return 0;
+}
+
+/* Parallel sort.
+ *
+ * Comparing latin-1 strings, single digit ints or floats with the
+ * unsafe_*_compare() functions never runs Python code nor touches reference
+ * counts, so when the pre-sort check picked one of them, the list can be
+ * sorted by several threads with the GIL released.  This is opt-in, with
+ * sys.setsortthreads(): the list is cut into one slice per thread, each
+ * slice is sorted by timsort, and the slices are then merged pairwise,
+ * every round of merges being split between all the threads.  Merges take
+ * the item of the left slice on ties, so the result is the same stable
+ * order a single timsort would produce.
+ */
+
+/* Slices sorted by a thread are at least this long. */
+#define PARALLEL_SORT_MIN_SLICE (1 << 16)
+
+#define PARALLEL_SORT_MAX_THREADS 256
+
+/* Number of threads list.sort() may use; see sys.setsortthreads(). */
+static int sort_threads = 1;
+
+int
+_PyList_SetSortThreads(int n)
+{
+    if (n < 1 || n > PARALLEL_SORT_MAX_THREADS) {
+        PyErr_Format(PyExc_ValueError,
+                     "number of sort threads must be between 1 and %d",
+                     PARALLEL_SORT_MAX_THREADS);
+        return -1;
+    }
+    sort_threads = n;
+    return 0;
+}
+
+int
+_PyList_GetSortThreads(void)
+{
+    return sort_threads;
+}
+
+/* A slice to sort, or two slices to merge into dest. */
+typedef struct {
+    MergeState ms;
+    sortslice a, b, dest;
+    Py_ssize_t na, nb;
+    int merge;
+    int status;
+    PyThread_type_lock done;
+} sort_task;
+
+static void
+sort_task_run(sort_task *t)
+{
+    MergeState *ms = &t->ms;
+    sortslice a = t->a, b = t->b, dest = t->dest;
+    Py_ssize_t na = t->na, nb = t->nb;
+
+    merge_init(ms, na + nb, a.values != NULL);
+    ms->nogil = 1;
+    if (!t->merge) {
+        t->status = timsort(ms, a, na);
+    }
+    else {
+        /* Copy both runs next to each other, then merge them in place. */
+        sortslice_memcpy(&dest, 0, &a, 0, na);
+        sortslice_memcpy(&dest, na, &b, 0, nb);
+        t->status = 0;
+        if (na > 0 && nb > 0) {
+            ms->pending[0].base = dest;
+            ms->pending[0].len = na;
+            sortslice_advance(&dest, na);
+            ms->pending[1].base = dest;
+            ms->pending[1].len = nb;
+            ms->n = 2;
+            t->status = (int)merge_at(ms, 0);
+        }
+    }
+    merge_freemem(ms);
+}
+
+static void
+sort_task_thread(void *arg)
+{
+    sort_task *t = (sort_task *)arg;
+
+    sort_task_run(t);
+    PyThread_release_lock(t->done);
+}
+
+/* Run tasks[0:ntasks], tasks[0] in the calling thread and the others in
+ * threads of their own (or in the calling thread too, if a thread can't be
+ * started).  Return -1 if any of them failed, else 0. */
+static int
+sort_tasks_run(sort_task *tasks, int ntasks)
+{
+    int i, status = 0;
+
+    for (i = 1; i < ntasks; i++) {
+        PyThread_acquire_lock(tasks[i].done, WAIT_LOCK);
+        if (PyThread_start_new_thread(sort_task_thread, &tasks[i]) ==
+            PYTHREAD_INVALID_THREAD_ID)
+            sort_task_thread(&tasks[i]);
+    }
+    sort_task_run(&tasks[0]);
+    for (i = 0; i < ntasks; i++) {
+        if (i > 0) {
+            PyThread_acquire_lock(tasks[i].done, WAIT_LOCK);
+            PyThread_release_lock(tasks[i].done);
+        }
+        if (tasks[i].status < 0)
+            status = -1;
+    }
+    return status;
+}
+
+/* Return how many of the first k items of the stable merge of a[0:na] and
+ * b[0:nb] come from a. */
+static Py_ssize_t
+merge_corank(MergeState *ms, PyObject **a, Py_ssize_t na,
+             PyObject **b, Py_ssize_t nb, Py_ssize_t k)
+{
+    Py_ssize_t lo = Py_MAX(0, k - nb), hi = Py_MIN(k, na);
+
+    /* Find the smallest i such that b[k-i-1] < a[i], taking the condition
+     * to be true when either index is out of range. */
+    while (lo < hi) {
+        Py_ssize_t i = lo + (hi - lo) / 2;
+
+        if (ISLT(b[k - i - 1], a[i]))
+            hi = i;
+        else
+            lo = i + 1;
+    }
+    return lo;
+}
+
+/* Sort lo[0:n] with nthreads threads, comparing with ms->key_compare,
+ * which must be safe to call without the GIL.  Return 0 if lo was sorted,
+ * -1 with an exception set on error (lo is then a permutation of its
+ * original items), and 1 if lo was left untouched because the threads
+ * couldn't be set up. */
+static int
+parallel_sort(MergeState *ms, sortslice lo, Py_ssize_t n, int nthreads)
+{
+    Py_ssize_t bounds[PARALLEL_SORT_MAX_THREADS + 1];
+    sort_task *tasks;
+    PyObject **buf = NULL;
+    sortslice src, dst, tmp;
+    int multiplier = lo.values != NULL ? 2 : 1;
+    int i, width, status = 0;
+
+    assert(2 <= nthreads && nthreads <= PARALLEL_SORT_MAX_THREADS);
+    tasks = PyMem_RawMalloc(nthreads * sizeof(sort_task));
+    if ((size_t)n <= PY_SSIZE_T_MAX / sizeof(PyObject *) / multiplier)
+        buf = PyMem_RawMalloc(multiplier * n * sizeof(PyObject *));
+    if (tasks == NULL || buf == NULL) {
+        PyMem_RawFree(tasks);
+        PyMem_RawFree(buf);
+        return 1;
+    }
+    for (i = 0; i < nthreads; i++) {
+        tasks[i].done = PyThread_allocate_lock();
+        if (tasks[i].done == NULL) {
+            while (--i >= 0)
+                PyThread_free_lock(tasks[i].done);
+            PyMem_RawFree(tasks);
+            PyMem_RawFree(buf);
+            return 1;
+        }
+        tasks[i].ms.key_compare = ms->key_compare;
+    }
+    src = lo;
+    dst.keys = buf;
+    dst.values = lo.values != NULL ? buf + n : NULL;
+    for (i = 0; i <= nthreads; i++)
+        bounds[i] = (n / nthreads) * i + Py_MIN(i, n % nthreads);
+
+    Py_BEGIN_ALLOW_THREADS
+    ms->nogil = 1;
+
+    /* Sort the slices. */
+    for (i = 0; i < nthreads; i++) {
+        tasks[i].merge = 0;
+        tasks[i].a = src;
+        sortslice_advance(&tasks[i].a, bounds[i]);
+        tasks[i].na = bounds[i + 1] - bounds[i];
+    }
+    status = sort_tasks_run(tasks, nthreads);
+
+    /* Merge them pairwise from src into dst, until one is left. */
+    for (width = 1; status == 0 && width < nthreads; width *= 2) {
+        int npairs = (nthreads + 2 * width - 1) / (2 * width);
+        int npieces = Py_MAX(1, nthreads / npairs);
+        int ntasks = 0;
+
+        for (i = 0; i < nthreads; i += 2 * width) {
+            Py_ssize_t start = bounds[i];
+            Py_ssize_t mid = bounds[Py_MIN(i + width, nthreads)];
+            Py_ssize_t end = bounds[Py_MIN(i + 2 * width, nthreads)];
+            Py_ssize_t na = mid - start, nb = end - mid;
+            Py_ssize_t k0 = 0, ka0 = 0;
+            int p;
+
+            /* Cut the merge into npieces pieces of the same length. */
+            for (p = 1; p <= npieces; p++) {
+                sort_task *t = &tasks[ntasks++];
+                Py_ssize_t k1 = ((na + nb) / npieces) * p +
+                                Py_MIN(p, (na + nb) % npieces);
+                Py_ssize_t ka1 = merge_corank(ms, src.keys + start, na,
+                                              src.keys + mid, nb, k1);
+
+                t->merge = 1;
+                t->a = t->b = t->dest = src;
+                sortslice_advance(&t->a, start + ka0);
+                sortslice_advance(&t->b, mid + k0 - ka0);
+                t->dest = dst;
+                sortslice_advance(&t->dest, start + k0);
+                t->na = ka1 - ka0;
+                t->nb = (k1 - ka1) - (k0 - ka0);
+                k0 = k1;
+                ka0 = ka1;
+            }
+        }
+        status = sort_tasks_run(tasks, ntasks);
+        tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+    if (src.keys != lo.keys)
+        sortslice_memcpy(&lo, 0, &src, 0, n);
+
+    ms->nogil = 0;
+    Py_END_ALLOW_THREADS
+
+    for (i = 0; i < nthreads; i++)
+        PyThread_free_lock(tasks[i].done);
+    PyMem_RawFree(tasks);
+    PyMem_RawFree(buf);
+    if (status < 0) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    return 0;
+}
+
 /* An adaptive, stable, natural mergesort.  See listsort.txt.
  * Returns Py_None on success, NULL on error.  Even in case of error, the
  * list will be some permutation of its input state (nothing is lost or
@@ -2205,7 +2767,6 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
 {
     MergeState ms;
     Py_ssize_t nremaining;
-    Py_ssize_t minrun;
     sortslice lo;
     Py_ssize_t saved_ob_size, saved_allocated;
     PyObject **saved_ob_item;
@@ -2213,6 +2774,7 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
     PyObject *result = NULL;            /* guilty until proved innocent */
     Py_ssize_t i;
     PyObject **keys;
+    int use_radix = 0;
 
     assert(self != NULL);
     assert(PyList_Check(self));
@@ -2281,6 +2843,7 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
         int keys_are_all_same_type = 1;
         int strings_are_latin = 1;
         int ints_are_bounded = 1;
+        int ints_fit_word = 1;
 
         /* Prove that assumption by checking every key. */
         for (i=0; i < saved_ob_size; i++) {
@@ -2307,6 +2870,9 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
             if (key_type == &PyLong_Type) {
                 if (ints_are_bounded && Py_ABS(Py_SIZE(key)) > 1)
                     ints_are_bounded = 0;
+                if (ints_fit_word && !ints_are_bounded &&
+                    !radix_long_fits(key))
+                    ints_fit_word = 0;
             }
             else if (key_type == &PyUnicode_Type){
                 if (strings_are_latin &&
@@ -2345,6 +2911,13 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
 
             ms.key_compare = unsafe_tuple_compare;
         }
+
+        /* Large lists whose keys are machine-size ints or floats, or
+         * tuples starting with one, may be radix sorted. */
+        use_radix = (keys_are_all_same_type &&
+                     saved_ob_size >= RADIX_SORT_MIN_SIZE &&
+                     ((key_type == &PyLong_Type && ints_fit_word) ||
+                      key_type == &PyFloat_Type));
     }
     /* End of pre-sort check: ms is now set properly! */
 
@@ -2362,48 +2935,27 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
         reverse_slice(&saved_ob_item[0], &saved_ob_item[saved_ob_size]);
     }
 
-    /* March over the array once, left to right, finding natural runs,
-     * and extending short natural runs to minrun elements.
-     */
-    minrun = merge_compute_minrun(nremaining);
-    do {
-        int descending;
-        Py_ssize_t n;
+    if (use_radix && radix_sort(lo.keys, saved_ob_item, saved_ob_size))
+        goto succeed;
 
-        /* Identify next run. */
-        n = count_run(&ms, lo.keys, lo.keys + nremaining, &descending);
-        if (n < 0)
-            goto fail;
-        if (descending)
-            reverse_sortslice(&lo, n);
-        /* If short, extend to min(minrun, nremaining). */
-        if (n < minrun) {
-            const Py_ssize_t force = nremaining <= minrun ?
-                              nremaining : minrun;
-            if (binarysort(&ms, lo, lo.keys + force, lo.keys + n) < 0)
-                goto fail;
-            n = force;
-        }
-        /* Push run onto pending-runs stack, and maybe merge. */
-        assert(ms.n < MAX_MERGE_PENDING);
-        ms.pending[ms.n].base = lo;
-        ms.pending[ms.n].len = n;
-        ++ms.n;
-        if (merge_collapse(&ms) < 0)
+    if (saved_ob_size >= 2 * PARALLEL_SORT_MIN_SLICE && sort_threads > 1 &&
+        (ms.key_compare == unsafe_latin_compare ||
+         ms.key_compare == unsafe_long_compare ||
+         ms.key_compare == unsafe_float_compare)) {
+        int nthreads = (int)Py_MIN(sort_threads,
+                                   saved_ob_size / PARALLEL_SORT_MIN_SLICE);
+        int status = parallel_sort(&ms, lo, saved_ob_size, nthreads);
+        if (status < 0)
             goto fail;
-        /* Advance to find next run. */
-        sortslice_advance(&lo, n);
-        nremaining -= n;
-    } while (nremaining);
+        if (status == 0)
+            goto succeed;
+    }
 
-    if (merge_force_collapse(&ms) < 0)
+    if (timsort(&ms, lo, saved_ob_size) < 0)
         goto fail;
-    assert(ms.n == 1);
     assert(keys == NULL
            ? ms.pending[0].base.keys == saved_ob_item
            : ms.pending[0].base.keys == &keys[0]);
-    assert(ms.pending[0].len == saved_ob_size);
-    lo = ms.pending[0].base;
 
 succeed:
     result = Py_None;
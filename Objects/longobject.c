@@ -106,6 +106,34 @@ _PyLong_Negate(PyLongObject **x_p)
 #define KARATSUBA_CUTOFF 70
 #define KARATSUBA_SQUARE_CUTOFF (2 * KARATSUBA_CUTOFF)
 
+/* Above TOOM3_CUTOFF digits, k_mul() switches to Toom-Cook 3-way
+ * multiplication when the operands have balanced sizes.
+ */
+#define TOOM3_CUTOFF 400
+#define TOOM3_SQUARE_CUTOFF 600
+
+/* Divisions where both the divisor and the quotient have more than
+ * BURNIKEL_ZIEGLER_CUTOFF digits use the recursive algorithm of Burnikel
+ * and Ziegler, which does the work with k_mul(), instead of x_divrem().
+ */
+#define BURNIKEL_ZIEGLER_CUTOFF 80
+
+/* Conversions between ints and decimal strings (and strings in other
+ * non-binary bases) use the quadratic schoolbook algorithms for small
+ * values, and divide-and-conquer algorithms built on k_mul() above
+ * TO_DECIMAL_CUTOFF internal digits and FROM_STRING_CUTOFF input
+ * characters, respectively.  The leaves of the recursion are converted by
+ * the schoolbook algorithms, at most TO_DECIMAL_LEAF decimal digits (each
+ * in base _PyLong_DECIMAL_BASE) and FROM_STRING_LEAF input characters at a
+ * time.  Divisions by divisors with more than BARRETT_CUTOFF digits use
+ * Newton reciprocals instead of x_divrem().
+ */
+#define TO_DECIMAL_CUTOFF 2000
+#define TO_DECIMAL_LEAF 128
+#define FROM_STRING_CUTOFF 5000
+#define FROM_STRING_LEAF 1000
+#define BARRETT_CUTOFF 200
+
 /* For exponentiation, use the binary left-to-right algorithm
  * unless the exponent contains more than FIVEARY_CUTOFF digits.
  * In that case, do 5 bits at a time.  The potential drawback is that
@@ -1671,6 +1699,40 @@ divrem1(PyLongObject *a, digit n, digit *prem)
     return long_normalize(z);
 }
 
+/* Convert the size_a digits of pin to base _PyLong_DECIMAL_BASE digits in
+   pout, following Knuth (TAOCP, Volume 2 (3rd edn), section 4.4, Method 1b).
+   Returns the number of digits stored in pout (0 when pin is zero), or -1
+   if a signal handler raised an exception. */
+
+static Py_ssize_t
+long_to_decimal_base(const digit *pin, Py_ssize_t size_a, digit *pout)
+{
+    Py_ssize_t size, i, j;
+
+    size = 0;
+    for (i = size_a; --i >= 0; ) {
+        digit hi = pin[i];
+        for (j = 0; j < size; j++) {
+            twodigits z = (twodigits)pout[j] << PyLong_SHIFT | hi;
+            hi = (digit)(z / _PyLong_DECIMAL_BASE);
+            pout[j] = (digit)(z - (twodigits)hi *
+                              _PyLong_DECIMAL_BASE);
+        }
+        while (hi) {
+            pout[size++] = hi % _PyLong_DECIMAL_BASE;
+            hi /= _PyLong_DECIMAL_BASE;
+        }
+        /* check for keyboard interrupt */
+        SIGCHECK({
+                return -1;
+            });
+    }
+    return size;
+}
+
+static int long_to_decimal_dc(PyLongObject *a, Py_ssize_t size,
+                              PyLongObject **pscratch, Py_ssize_t *psize);
+
 /* Convert an integer to a base 10 string.  Returns a new non-shared
    string.  (Return value is non-shared so that callers can modify the
    returned value if necessary.) */
@@ -1685,7 +1747,7 @@ long_to_decimal_string_internal(PyObject *aa,
     PyLongObject *scratch, *a;
     PyObject *str = NULL;
     Py_ssize_t size, strlen, size_a, i, j;
-    digit *pout, *pin, rem, tenpow;
+    digit *pout, rem, tenpow;
     int negative;
     int d;
     enum PyUnicode_Kind kind;
@@ -1716,33 +1778,22 @@ long_to_decimal_string_internal(PyObject *aa,
         (10 * PyLong_SHIFT - 33 * _PyLong_DECIMAL_SHIFT);
     assert(size_a < PY_SSIZE_T_MAX/2);
     size = 1 + size_a + size_a / d;
-    scratch = _PyLong_New(size);
-    if (scratch == NULL)
-        return -1;
+    if (size_a > TO_DECIMAL_CUTOFF) {
+        if (long_to_decimal_dc(a, size, &scratch, &size) < 0)
+            return -1;
+        pout = scratch->ob_digit;
+    }
+    else {
+        scratch = _PyLong_New(size);
+        if (scratch == NULL)
+            return -1;
 
-    /* convert array of base _PyLong_BASE digits in pin to an array of
-       base _PyLong_DECIMAL_BASE digits in pout, following Knuth (TAOCP,
-       Volume 2 (3rd edn), section 4.4, Method 1b). */
-    pin = a->ob_digit;
-    pout = scratch->ob_digit;
-    size = 0;
-    for (i = size_a; --i >= 0; ) {
-        digit hi = pin[i];
-        for (j = 0; j < size; j++) {
-            twodigits z = (twodigits)pout[j] << PyLong_SHIFT | hi;
-            hi = (digit)(z / _PyLong_DECIMAL_BASE);
-            pout[j] = (digit)(z - (twodigits)hi *
-                              _PyLong_DECIMAL_BASE);
-        }
-        while (hi) {
-            pout[size++] = hi % _PyLong_DECIMAL_BASE;
-            hi /= _PyLong_DECIMAL_BASE;
+        pout = scratch->ob_digit;
+        size = long_to_decimal_base(a->ob_digit, size_a, pout);
+        if (size < 0) {
+            Py_DECREF(scratch);
+            return -1;
         }
-        /* check for keyboard interrupt */
-        SIGCHECK({
-                Py_DECREF(scratch);
-                return -1;
-            });
     }
     /* pout should have at least one digit, so that the case when a = 0
        works correctly */
@@ -2201,6 +2252,11 @@ long_from_binary_base(const char **str, int base, PyLongObject **res)
     return 0;
 }
 
+static PyLongObject *long_from_string_dc(const char *str, const char *end,
+                                         Py_ssize_t digits, int base,
+                                         int convwidth,
+                                         twodigits convmultmax);
+
 /* Parses an int from a bytestring. Leading and trailing whitespace will be
  * ignored.
  *
@@ -2421,11 +2477,6 @@ digit beyond the first.
             goto onError;
         }
 
-        /* Create an int object that can contain the largest possible
-         * integer with this base and length.  Note that there's no
-         * need to initialize z->ob_digit -- no slot is read up before
-         * being stored into.
-         */
         double fsize_z = (double)digits * log_base_BASE[base] + 1.0;
         if (fsize_z > (double)MAX_LONG_DIGITS) {
             /* The same exception as in _PyLong_New(). */
@@ -2434,14 +2485,6 @@ digit beyond the first.
             return NULL;
         }
         size_z = (Py_ssize_t)fsize_z;
-        /* Uncomment next line to test exceedingly rare copy code */
-        /* size_z = 1; */
-        assert(size_z > 0);
-        z = _PyLong_New(size_z);
-        if (z == NULL) {
-            return NULL;
-        }
-        Py_SIZE(z) = 0;
 
         /* `convwidth` consecutive input digits are treated as a single
          * digit in base `convmultmax`.
@@ -2449,6 +2492,31 @@ digit beyond the first.
         convwidth = convwidth_base[base];
         convmultmax = convmultmax_base[base];
 
+        if (digits > FROM_STRING_CUTOFF) {
+            /* Subquadratic conversion; the loop below is skipped. */
+            z = long_from_string_dc(str, scan, digits, base,
+                                    convwidth, convmultmax);
+            if (z == NULL) {
+                return NULL;
+            }
+            str = scan;
+        }
+        else {
+            /* Create an int object that can contain the largest possible
+             * integer with this base and length.  Note that there's no
+             * need to initialize z->ob_digit -- no slot is read up before
+             * being stored into.
+             */
+            /* Uncomment next line to test exceedingly rare copy code */
+            /* size_z = 1; */
+            assert(size_z > 0);
+            z = _PyLong_New(size_z);
+            if (z == NULL) {
+                return NULL;
+            }
+            Py_SIZE(z) = 0;
+        }
+
         /* Work ;-) */
         while (str < scan) {
             if (*str == '_') {
@@ -2634,6 +2702,8 @@ PyLong_FromUnicodeObject(PyObject *u, int base)
 static PyLongObject *x_divrem
     (PyLongObject *, PyLongObject *, PyLongObject **);
 static PyObject *long_long(PyObject *v);
+static int long_divrem_bz(PyLongObject *a, PyLongObject *b,
+                          PyLongObject **pdiv, PyLongObject **prem);
 
 /* Int division with remainder, top-level routine */
 
@@ -2672,6 +2742,11 @@ long_divrem(PyLongObject *a, PyLongObject *b,
             return -1;
         }
     }
+    else if (size_b > BURNIKEL_ZIEGLER_CUTOFF &&
+             size_a - size_b > BURNIKEL_ZIEGLER_CUTOFF) {
+        if (long_divrem_bz(a, b, &z, prem) < 0)
+            return -1;
+    }
     else {
         z = x_divrem(a, b, prem);
         if (z == NULL)
@@ -3361,6 +3436,7 @@ kmul_split(PyLongObject *n,
 }
 
 static PyLongObject *k_lopsided_mul(PyLongObject *a, PyLongObject *b);
+static PyLongObject *toom3_mul(PyLongObject *a, PyLongObject *b);
 
 /* Karatsuba multiplication.  Ignores the input signs, and returns the
  * absolute value of the product (or NULL if error).
@@ -3419,6 +3495,11 @@ k_mul(PyLongObject *a, PyLongObject *b)
     if (2 * asize <= bsize)
         return k_lopsided_mul(a, b);
 
+    /* Toom-3 needs a to have more than two thirds of the digits of b. */
+    i = a == b ? TOOM3_SQUARE_CUTOFF : TOOM3_CUTOFF;
+    if (asize > i && asize > 2 * ((bsize + 2) / 3))
+        return toom3_mul(a, b);
+
     /* Split a & b into hi & lo pieces. */
     shift = bsize >> 1;
     if (kmul_split(a, shift, &ah, &al) < 0) goto fail;
@@ -3579,6 +3660,211 @@ clearly >= each of ah*bh and al*bl, there's always enough room to subtract
 ah*bh and al*bl too.
 */
 
+/* Toom-Cook 3-way multiplication.  a and b are split in three pieces of
+ * shift digits, a = a2*X**2 + a1*X + a0 with X = BASE**shift and likewise
+ * for b, and the product polynomial of degree 4 is recovered from its
+ * values at 0, 1, -1, -2 and infinity, which are the 5 products of pieces
+ * about a third of the size:
+ *
+ *     r(0)   = a0*b0
+ *     r(1)   = (a0+a1+a2)*(b0+b1+b2)
+ *     r(-1)  = (a0-a1+a2)*(b0-b1+b2)
+ *     r(-2)  = (a0-2*a1+4*a2)*(b0-2*b1+4*b2)
+ *     r(inf) = a2*b2
+ *
+ * The interpolation follows Bodrato's sequence, where the only divisions
+ * are the exact ones by 2 and 3.  The values at -1 and -2 can be negative,
+ * so the signed long_add() and long_sub() are used.  When a is b, the
+ * pieces are evaluated once and the 5 products are squares.
+ *
+ * asize <= bsize, and a must have more than 2*shift digits.
+ */
+
+/* Return a / n for a small n which divides a exactly, keeping the sign. */
+static PyLongObject *
+long_divexact1(PyLongObject *a, digit n)
+{
+    PyLongObject *z;
+    digit rem;
+
+    z = divrem1(a, n, &rem);
+    if (z == NULL)
+        return NULL;
+    assert(rem == 0);
+    if (Py_SIZE(a) < 0)
+        Py_SIZE(z) = -Py_SIZE(z);
+    return z;
+}
+
+/* Set p[0..4] to the values at 0, 1, -1, -2 and infinity of the polynomial
+ * with the coefficients x0, x1, x2.  The references to x0 and x2 are stolen.
+ */
+static int
+toom3_evaluate(PyLongObject *x0, PyLongObject *x1, PyLongObject *x2,
+               PyLongObject **p)
+{
+    PyLongObject *t;
+
+    p[0] = x0;
+    p[4] = x2;
+    p[1] = p[2] = p[3] = NULL;
+    t = x_add(x0, x2);
+    if (t == NULL)
+        return -1;
+    p[1] = x_add(t, x1);
+    p[2] = (PyLongObject *)long_sub(t, x1);
+    Py_DECREF(t);
+    if (p[1] == NULL || p[2] == NULL)
+        return -1;
+    /* p[3] = 2*(p[2] + x2) - x0 */
+    t = (PyLongObject *)long_add(p[2], x2);
+    if (t == NULL)
+        return -1;
+    Py_SETREF(t, (PyLongObject *)long_add(t, t));
+    if (t == NULL)
+        return -1;
+    p[3] = (PyLongObject *)long_sub(t, x0);
+    Py_DECREF(t);
+    if (p[3] == NULL)
+        return -1;
+    return 0;
+}
+
+static PyLongObject *
+toom3_mul(PyLongObject *a, PyLongObject *b)
+{
+    const Py_ssize_t asize = Py_ABS(Py_SIZE(a));
+    const Py_ssize_t bsize = Py_ABS(Py_SIZE(b));
+    const Py_ssize_t shift = (bsize + 2) / 3;
+    PyLongObject *pa[5] = {NULL}, *pb[5] = {NULL}, *r[5] = {NULL};
+    PyLongObject *x0 = NULL, *x1 = NULL, *x2 = NULL, *t = NULL;
+    PyLongObject *ret = NULL;
+    int i;
+
+    assert(asize <= bsize && asize > 2 * shift);
+
+    /* Split and evaluate. */
+    if (kmul_split(a, shift, &t, &x0) < 0)
+        goto fail;
+    if (kmul_split(t, shift, &x2, &x1) < 0)
+        goto fail;
+    Py_CLEAR(t);
+    i = toom3_evaluate(x0, x1, x2, pa);
+    x0 = x2 = NULL;
+    Py_CLEAR(x1);
+    if (i < 0)
+        goto fail;
+    if (a == b) {
+        for (i = 0; i < 5; i++) {
+            pb[i] = pa[i];
+            Py_INCREF(pb[i]);
+        }
+    }
+    else {
+        if (kmul_split(b, shift, &t, &x0) < 0)
+            goto fail;
+        if (kmul_split(t, shift, &x2, &x1) < 0)
+            goto fail;
+        Py_CLEAR(t);
+        i = toom3_evaluate(x0, x1, x2, pb);
+        x0 = x2 = NULL;
+        Py_CLEAR(x1);
+        if (i < 0)
+            goto fail;
+    }
+
+    /* The 5 pointwise products. */
+    for (i = 0; i < 5; i++) {
+        r[i] = k_mul(pa[i], pb[i]);
+        if (r[i] == NULL)
+            goto fail;
+        if ((Py_SIZE(pa[i]) ^ Py_SIZE(pb[i])) < 0)
+            Py_SIZE(r[i]) = -Py_SIZE(r[i]);
+        Py_CLEAR(pa[i]);
+        Py_CLEAR(pb[i]);
+    }
+
+    /* Interpolate; afterwards r[i] is the coefficient of X**i.
+     *     r3 = (r(-2) - r(1)) / 3
+     *     r1 = (r(1) - r(-1)) / 2
+     *     r2 = r(-1) - r(0)
+     *     r3 = (r2 - r3) / 2 + 2*r(inf)
+     *     r2 = r2 + r1 - r(inf)
+     *     r1 = r1 - r3
+     */
+    t = (PyLongObject *)long_sub(r[3], r[1]);
+    if (t == NULL)
+        goto fail;
+    Py_SETREF(r[3], long_divexact1(t, 3));
+    Py_CLEAR(t);
+    if (r[3] == NULL)
+        goto fail;
+    t = (PyLongObject *)long_sub(r[1], r[2]);
+    if (t == NULL)
+        goto fail;
+    Py_SETREF(r[1], long_divexact1(t, 2));
+    Py_CLEAR(t);
+    if (r[1] == NULL)
+        goto fail;
+    Py_SETREF(r[2], (PyLongObject *)long_sub(r[2], r[0]));
+    if (r[2] == NULL)
+        goto fail;
+    t = (PyLongObject *)long_sub(r[2], r[3]);
+    if (t == NULL)
+        goto fail;
+    Py_SETREF(r[3], long_divexact1(t, 2));
+    Py_CLEAR(t);
+    if (r[3] == NULL)
+        goto fail;
+    t = x_add(r[4], r[4]);
+    if (t == NULL)
+        goto fail;
+    Py_SETREF(r[3], (PyLongObject *)long_add(r[3], t));
+    Py_CLEAR(t);
+    if (r[3] == NULL)
+        goto fail;
+    Py_SETREF(r[2], (PyLongObject *)long_add(r[2], r[1]));
+    if (r[2] == NULL)
+        goto fail;
+    Py_SETREF(r[2], (PyLongObject *)long_sub(r[2], r[4]));
+    if (r[2] == NULL)
+        goto fail;
+    Py_SETREF(r[1], (PyLongObject *)long_sub(r[1], r[3]));
+    if (r[1] == NULL)
+        goto fail;
+
+    /* The coefficients of the product are non-negative, and each of
+     * r[i]*X**i fits in the asize + bsize digits of the result.
+     */
+    ret = _PyLong_New(asize + bsize);
+    if (ret == NULL)
+        goto fail;
+    memset(ret->ob_digit, 0, (asize + bsize) * sizeof(digit));
+    for (i = 0; i < 5; i++) {
+        assert(Py_SIZE(r[i]) >= 0);
+        if (Py_SIZE(r[i]) > 0) {
+            assert(i * shift + Py_SIZE(r[i]) <= asize + bsize);
+            (void)v_iadd(ret->ob_digit + i * shift,
+                         asize + bsize - i * shift,
+                         r[i]->ob_digit, Py_SIZE(r[i]));
+        }
+        Py_CLEAR(r[i]);
+    }
+    return long_normalize(ret);
+
+  fail:
+    for (i = 0; i < 5; i++) {
+        Py_XDECREF(pa[i]);
+        Py_XDECREF(pb[i]);
+        Py_XDECREF(r[i]);
+    }
+    Py_XDECREF(x0);
+    Py_XDECREF(x1);
+    Py_XDECREF(x2);
+    Py_XDECREF(t);
+    return NULL;
+}
+
 /* b has at least twice the digits of a, and a is big enough that Karatsuba
  * would pay off *if* the inputs had balanced sizes.  View b as a sequence
  * of slices, each with a->ob_size digits, and multiply the slices by a,
@@ -3664,6 +3950,720 @@ long_mul(PyLongObject *a, PyLongObject *b)
     return (PyObject *)z;
 }
 
+/* Divide-and-conquer conversions between ints and strings in non-binary
+ * bases.  All values handled here are non-negative.
+ */
+
+/* Return a * BASE**k for k >= 0, or a // BASE**-k for k < 0. */
+static PyLongObject *
+long_digit_shift(PyLongObject *a, Py_ssize_t k)
+{
+    Py_ssize_t size_a = Py_SIZE(a), size_z;
+    PyLongObject *z;
+
+    assert(size_a >= 0);
+    if (k >= 0) {
+        if (size_a == 0 || k == 0) {
+            Py_INCREF(a);
+            return a;
+        }
+        size_z = size_a + k;
+        z = _PyLong_New(size_z);
+        if (z == NULL)
+            return NULL;
+        memset(z->ob_digit, 0, k * sizeof(digit));
+        memcpy(z->ob_digit + k, a->ob_digit, size_a * sizeof(digit));
+        return z;
+    }
+    size_z = size_a + k;
+    if (size_z <= 0)
+        return (PyLongObject *)PyLong_FromLong(0);
+    z = _PyLong_New(size_z);
+    if (z == NULL)
+        return NULL;
+    memcpy(z->ob_digit, a->ob_digit - k, size_z * sizeof(digit));
+    return z;
+}
+
+/* Return an approximation of floor(BASE**(2*k) / d), where d has exactly k
+ * digits, which is at most a few units off.  It is computed by Newton's
+ * iteration r' = r + r*(BASE**(2*k) - d*r) // BASE**(2*k), starting from
+ * the reciprocal of the high half of d:  that doubles the number of correct
+ * digits, and since the correction term only has about k/2 significant
+ * digits, the cost is a small multiple of that of multiplying two k-digit
+ * ints.
+ */
+static PyLongObject *
+long_reciprocal(PyLongObject *d)
+{
+    Py_ssize_t k = Py_SIZE(d), h;
+    PyLongObject *num, *q, *r, *t, *e;
+    int negative;
+
+    assert(k > 0);
+    if (k <= BARRETT_CUTOFF) {
+        t = (PyLongObject *)PyLong_FromLong(1);
+        if (t == NULL)
+            return NULL;
+        num = long_digit_shift(t, 2 * k);
+        Py_DECREF(t);
+        if (num == NULL)
+            return NULL;
+        if (long_divrem(num, d, &q, &r) < 0) {
+            Py_DECREF(num);
+            return NULL;
+        }
+        Py_DECREF(r);
+        Py_DECREF(num);
+        return q;
+    }
+
+    /* q = reciprocal of the h high digits of d, scaled to BASE**(2*k) */
+    h = k / 2 + 2;
+    t = long_digit_shift(d, h - k);
+    if (t == NULL)
+        return NULL;
+    r = long_reciprocal(t);
+    Py_DECREF(t);
+    if (r == NULL)
+        return NULL;
+    q = long_digit_shift(r, k - h);
+    Py_DECREF(r);
+    if (q == NULL)
+        return NULL;
+
+    /* e = BASE**(2*k) - d*q, computed modulo BASE**(2*k+1), which is
+       plenty since |e| < BASE**(2*k). */
+    t = k_mul(d, q);
+    if (t == NULL)
+        goto error;
+    if (Py_SIZE(t) > 2 * k) {
+        /* d*q >= BASE**(2*k):  e = -(t mod BASE**(2*k)) */
+        assert(Py_SIZE(t) == 2 * k + 1 && t->ob_digit[2 * k] == 1);
+        Py_SIZE(t) = 2 * k;
+        e = long_normalize(t);
+        Py_SIZE(e) = -Py_SIZE(e);
+    }
+    else {
+        num = _PyLong_New(2 * k + 1);
+        if (num == NULL) {
+            Py_DECREF(t);
+            goto error;
+        }
+        memset(num->ob_digit, 0, 2 * k * sizeof(digit));
+        num->ob_digit[2 * k] = 1;
+        e = x_sub(num, t);
+        Py_DECREF(num);
+        Py_DECREF(t);
+    }
+    if (e == NULL)
+        goto error;
+
+    /* q += q*e // BASE**(2*k), rounding towards zero */
+    negative = Py_SIZE(e) < 0;
+    t = k_mul(q, e);
+    Py_DECREF(e);
+    if (t == NULL)
+        goto error;
+    r = long_digit_shift(t, -2 * k);
+    Py_DECREF(t);
+    if (r == NULL)
+        goto error;
+    if (negative)
+        Py_SETREF(q, x_sub(q, r));
+    else
+        Py_SETREF(q, x_add(q, r));
+    Py_DECREF(r);
+    return q;
+
+  error:
+    Py_DECREF(q);
+    return NULL;
+}
+
+/* Compute *pq, *pr = divmod(x, d), where x < d*d.  inv is NULL or
+ * long_reciprocal(d); in the latter case the quotient is estimated by
+ * Barrett's method as (x // BASE**(k-1)) * inv // BASE**(k+1), which is
+ * off by a few units at most, and then corrected.
+ */
+static int
+long_divmod_reciprocal(PyLongObject *x, PyLongObject *d, PyLongObject *inv,
+                       PyLongObject **pq, PyLongObject **pr)
+{
+    Py_ssize_t k = Py_SIZE(d);
+    PyLongObject *q, *r, *t, *u;
+
+    if (inv == NULL)
+        return long_divrem(x, d, pq, pr);
+
+    t = long_digit_shift(x, 1 - k);
+    if (t == NULL)
+        return -1;
+    u = k_mul(t, inv);
+    Py_DECREF(t);
+    if (u == NULL)
+        return -1;
+    q = long_digit_shift(u, -1 - k);
+    Py_DECREF(u);
+    if (q == NULL)
+        return -1;
+    t = k_mul(q, d);
+    if (t == NULL) {
+        Py_DECREF(q);
+        return -1;
+    }
+    r = (PyLongObject *)long_sub(x, t);
+    Py_DECREF(t);
+    if (r == NULL) {
+        Py_DECREF(q);
+        return -1;
+    }
+    while (Py_SIZE(r) < 0) {
+        Py_SETREF(r, (PyLongObject *)long_add(r, d));
+        if (r == NULL) {
+            Py_DECREF(q);
+            return -1;
+        }
+        Py_SETREF(q, (PyLongObject *)long_sub(q, (PyLongObject *)_PyLong_One));
+        if (q == NULL) {
+            Py_DECREF(r);
+            return -1;
+        }
+    }
+    while (long_compare(r, d) >= 0) {
+        Py_SETREF(r, x_sub(r, d));
+        if (r == NULL) {
+            Py_DECREF(q);
+            return -1;
+        }
+        Py_SETREF(q, x_add(q, (PyLongObject *)_PyLong_One));
+        if (q == NULL) {
+            Py_DECREF(r);
+            return -1;
+        }
+    }
+    *pq = q;
+    *pr = r;
+    return 0;
+}
+
+/* Store the leaf << (level + 1) least significant base _PyLong_DECIMAL_BASE
+ * digits of x, which is less than pows[level]**2, in pout.  pows[i] is
+ * _PyLong_DECIMAL_BASE**(leaf << i) and invs[i] is NULL or its reciprocal.
+ */
+static int
+long_to_decimal_rec(PyLongObject *x, int level, Py_ssize_t leaf,
+                    PyLongObject **pows, PyLongObject **invs, digit *pout)
+{
+    Py_ssize_t half, size;
+    PyLongObject *q, *r;
+    int res;
+
+    if (level < 0) {
+        size = long_to_decimal_base(x->ob_digit, Py_SIZE(x), pout);
+        if (size < 0)
+            return -1;
+        assert(size <= leaf);
+        memset(pout + size, 0, (leaf - size) * sizeof(digit));
+        return 0;
+    }
+    half = leaf << level;
+    if (Py_SIZE(x) < Py_SIZE(pows[level])) {
+        memset(pout + half, 0, half * sizeof(digit));
+        return long_to_decimal_rec(x, level - 1, leaf, pows, invs, pout);
+    }
+    if (long_divmod_reciprocal(x, pows[level], invs[level], &q, &r) < 0)
+        return -1;
+    res = long_to_decimal_rec(q, level - 1, leaf, pows, invs, pout + half);
+    if (res == 0)
+        res = long_to_decimal_rec(r, level - 1, leaf, pows, invs, pout);
+    Py_DECREF(q);
+    Py_DECREF(r);
+    return res;
+}
+
+/* Convert a, which has less than size base _PyLong_DECIMAL_BASE digits, to
+ * that base, ignoring its sign.  On success, *pscratch is a new int object
+ * holding the digits in ob_digit (least significant first) and *psize is
+ * their number.
+ */
+static int
+long_to_decimal_dc(PyLongObject *a, Py_ssize_t size,
+                   PyLongObject **pscratch, Py_ssize_t *psize)
+{
+    PyLongObject *pows[8 * SIZEOF_SIZE_T], *invs[8 * SIZEOF_SIZE_T];
+    PyLongObject *x, *scratch = NULL, *base, *exp;
+    Py_ssize_t leaf = TO_DECIMAL_LEAF;
+    int level = 0, i, n = 0, res = -1;
+
+    /* Split the output in 2**(level+1) leaves of equal size, so that the
+       top level divisor is close to the square root of a. */
+    while ((leaf << (level + 1)) < size)
+        level++;
+    leaf = (size + ((Py_ssize_t)1 << (level + 1)) - 1) >> (level + 1);
+
+    x = (PyLongObject *)_PyLong_Copy(a);
+    if (x == NULL)
+        return -1;
+    Py_SIZE(x) = Py_ABS(Py_SIZE(x));
+
+    base = (PyLongObject *)PyLong_FromLong(_PyLong_DECIMAL_BASE);
+    exp = (PyLongObject *)PyLong_FromSsize_t(leaf);
+    if (base != NULL && exp != NULL) {
+        pows[0] = (PyLongObject *)PyNumber_Power((PyObject *)base,
+                                                 (PyObject *)exp, Py_None);
+        invs[0] = NULL;
+        if (pows[0] != NULL)
+            n = 1;
+    }
+    Py_XDECREF(base);
+    Py_XDECREF(exp);
+    if (n == 0)
+        goto done;
+    for (; n <= level; n++) {
+        pows[n] = k_mul(pows[n - 1], pows[n - 1]);
+        invs[n] = NULL;
+        if (pows[n] == NULL)
+            goto done;
+    }
+    for (i = 0; i <= level; i++) {
+        if (Py_SIZE(pows[i]) > BARRETT_CUTOFF) {
+            invs[i] = long_reciprocal(pows[i]);
+            if (invs[i] == NULL)
+                goto done;
+        }
+    }
+
+    size = leaf << (level + 1);
+    scratch = _PyLong_New(size);
+    if (scratch == NULL)
+        goto done;
+    if (long_to_decimal_rec(x, level, leaf, pows, invs,
+                            scratch->ob_digit) < 0) {
+        Py_CLEAR(scratch);
+        goto done;
+    }
+    while (size > 0 && scratch->ob_digit[size - 1] == 0)
+        size--;
+    *pscratch = scratch;
+    *psize = size;
+    res = 0;
+
+  done:
+    for (i = 0; i < n; i++) {
+        Py_XDECREF(pows[i]);
+        Py_XDECREF(invs[i]);
+    }
+    Py_DECREF(x);
+    return res;
+}
+
+/* Convert the n digit values in v (most significant first) with the
+ * quadratic algorithm of PyLong_FromString().
+ */
+static PyLongObject *
+long_from_digit_values(const unsigned char *v, Py_ssize_t n, int base,
+                       int convwidth, twodigits convmultmax)
+{
+    PyLongObject *z;
+    const unsigned char *end = v + n;
+    digit *pz, *pzstop;
+    twodigits c, convmult;
+    int i;
+
+    /* Each group of convwidth digits adds at most one digit to z. */
+    z = _PyLong_New(n / convwidth + 1);
+    if (z == NULL)
+        return NULL;
+    Py_SIZE(z) = 0;
+    while (v < end) {
+        c = *v++;
+        for (i = 1; i < convwidth && v < end; i++)
+            c = c * base + *v++;
+        convmult = convmultmax;
+        if (i != convwidth) {
+            convmult = base;
+            for ( ; i > 1; --i)
+                convmult *= base;
+        }
+        pz = z->ob_digit;
+        pzstop = pz + Py_SIZE(z);
+        for (; pz < pzstop; ++pz) {
+            c += (twodigits)*pz * convmult;
+            *pz = (digit)(c & PyLong_MASK);
+            c >>= PyLong_SHIFT;
+        }
+        if (c) {
+            assert(c < PyLong_BASE);
+            *pz = (digit)c;
+            ++Py_SIZE(z);
+        }
+    }
+    return z;
+}
+
+/* Convert the n digit values in v, where n <= leaf << level.  pows[i] is
+ * base**(leaf << i).
+ */
+static PyLongObject *
+long_from_string_rec(const unsigned char *v, Py_ssize_t n, int level,
+                     Py_ssize_t leaf, int base, int convwidth,
+                     twodigits convmultmax, PyLongObject **pows)
+{
+    PyLongObject *hi, *lo, *z;
+    Py_ssize_t chunk;
+
+    if (level == 0)
+        return long_from_digit_values(v, n, base, convwidth, convmultmax);
+    chunk = leaf << (level - 1);
+    if (n <= chunk)
+        return long_from_string_rec(v, n, level - 1, leaf, base,
+                                    convwidth, convmultmax, pows);
+
+    hi = long_from_string_rec(v, n - chunk, level - 1, leaf, base,
+                              convwidth, convmultmax, pows);
+    if (hi == NULL)
+        return NULL;
+    lo = long_from_string_rec(v + n - chunk, chunk, level - 1, leaf, base,
+                              convwidth, convmultmax, pows);
+    if (lo == NULL) {
+        Py_DECREF(hi);
+        return NULL;
+    }
+    z = k_mul(hi, pows[level - 1]);
+    Py_DECREF(hi);
+    if (z == NULL) {
+        Py_DECREF(lo);
+        return NULL;
+    }
+    Py_SETREF(z, x_add(z, lo));
+    Py_DECREF(lo);
+    return z;
+}
+
+/* Convert the characters from str to end, a valid numeral of `digits`
+ * digits in the given non-binary base, possibly separated by single
+ * underscores.
+ */
+static PyLongObject *
+long_from_string_dc(const char *str, const char *end, Py_ssize_t digits,
+                    int base, int convwidth, twodigits convmultmax)
+{
+    PyLongObject *pows[8 * SIZEOF_SIZE_T], *z = NULL;
+    PyObject *b, *e;
+    Py_ssize_t leaf = FROM_STRING_LEAF;
+    unsigned char *v, *p;
+    int level = 0, i, n = 0;
+
+    /* Split the input in 2**level leaves of equal size. */
+    while ((leaf << level) < digits)
+        level++;
+    leaf = (digits + ((Py_ssize_t)1 << level) - 1) >> level;
+
+    v = PyMem_Malloc(digits);
+    if (v == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    for (p = v; str < end; str++) {
+        if (*str != '_')
+            *p++ = _PyLong_DigitValue[Py_CHARMASK(*str)];
+    }
+    assert(p - v == digits);
+
+    if (level > 0) {
+        b = PyLong_FromLong(base);
+        e = PyLong_FromSsize_t(leaf);
+        if (b != NULL && e != NULL) {
+            pows[0] = (PyLongObject *)PyNumber_Power(b, e, Py_None);
+            if (pows[0] != NULL)
+                n = 1;
+        }
+        Py_XDECREF(b);
+        Py_XDECREF(e);
+        if (n == 0)
+            goto done;
+        for (; n < level; n++) {
+            pows[n] = k_mul(pows[n - 1], pows[n - 1]);
+            if (pows[n] == NULL)
+                goto done;
+        }
+    }
+    z = long_from_string_rec(v, digits, level, leaf, base, convwidth,
+                             convmultmax, pows);
+
+  done:
+    for (i = 0; i < n; i++)
+        Py_XDECREF(pows[i]);
+    PyMem_Free(v);
+    return z;
+}
+
+/* Burnikel-Ziegler recursive division.  Dividing 2n digits by n digits is
+ * reduced to two divisions of 3n/2 digits by n digits, each of which is a
+ * division of n digits by n/2 digits and a multiplication of n/2 by n/2
+ * digits, so that the cost is O(K(n) log n), where K(n) is the cost of a
+ * k_mul() of n digits.  All values are non-negative; divisors are
+ * normalized, i.e. the top bit of their top digit is set.
+ */
+
+/* Return a % BASE**k. */
+static PyLongObject *
+long_digit_low(PyLongObject *a, Py_ssize_t k)
+{
+    Py_ssize_t size = Py_MIN(Py_SIZE(a), k);
+    PyLongObject *z;
+
+    z = _PyLong_New(size);
+    if (z == NULL)
+        return NULL;
+    memcpy(z->ob_digit, a->ob_digit, size * sizeof(digit));
+    return long_normalize(z);
+}
+
+/* Return hi * BASE**k + lo, where lo < BASE**k. */
+static PyLongObject *
+long_digit_join(PyLongObject *hi, Py_ssize_t k, PyLongObject *lo)
+{
+    PyLongObject *z;
+
+    assert(Py_SIZE(lo) <= k);
+    if (Py_SIZE(hi) == 0) {
+        Py_INCREF(lo);
+        return lo;
+    }
+    z = _PyLong_New(Py_SIZE(hi) + k);
+    if (z == NULL)
+        return NULL;
+    memcpy(z->ob_digit, lo->ob_digit, Py_SIZE(lo) * sizeof(digit));
+    memset(z->ob_digit + Py_SIZE(lo), 0,
+           (k - Py_SIZE(lo)) * sizeof(digit));
+    memcpy(z->ob_digit + k, hi->ob_digit, Py_SIZE(hi) * sizeof(digit));
+    return z;
+}
+
+static int bz_div2n1n(PyLongObject *a, PyLongObject *b, Py_ssize_t n,
+                      PyLongObject **pq, PyLongObject **pr);
+
+/* Divide a12 * BASE**n + a3 by b = b1 * BASE**n + b2, where b1 and b2
+ * have n digits, and a12 < b * BASE**n.
+ */
+static int
+bz_div3n2n(PyLongObject *a12, PyLongObject *a3, PyLongObject *b,
+           PyLongObject *b1, PyLongObject *b2, Py_ssize_t n,
+           PyLongObject **pq, PyLongObject **pr)
+{
+    PyLongObject *q = NULL, *r = NULL, *t;
+
+    t = long_digit_shift(a12, -n);
+    if (t == NULL)
+        return -1;
+    if (long_compare(t, b1) == 0) {
+        /* The quotient would not fit in n digits; it is BASE**n - 1 at
+           most, with r = a12 - b1 * (BASE**n - 1) = a12 % BASE**n + b1. */
+        Py_ssize_t i;
+
+        Py_DECREF(t);
+        q = _PyLong_New(n);
+        if (q == NULL)
+            return -1;
+        for (i = 0; i < n; i++)
+            q->ob_digit[i] = PyLong_MASK;
+        t = long_digit_low(a12, n);
+        if (t == NULL)
+            goto error;
+        r = x_add(t, b1);
+        Py_DECREF(t);
+        if (r == NULL)
+            goto error;
+    }
+    else {
+        Py_DECREF(t);
+        if (bz_div2n1n(a12, b1, n, &q, &r) < 0)
+            return -1;
+    }
+
+    /* r = r * BASE**n + a3 - q*b2, corrected to be non-negative */
+    t = long_digit_join(r, n, a3);
+    if (t == NULL)
+        goto error;
+    Py_SETREF(r, t);
+    t = k_mul(q, b2);
+    if (t == NULL)
+        goto error;
+    Py_SETREF(r, (PyLongObject *)long_sub(r, t));
+    Py_DECREF(t);
+    if (r == NULL)
+        goto error;
+    while (Py_SIZE(r) < 0) {
+        Py_SETREF(q, (PyLongObject *)long_sub(q, (PyLongObject *)_PyLong_One));
+        if (q == NULL)
+            goto error;
+        Py_SETREF(r, (PyLongObject *)long_add(r, b));
+        if (r == NULL)
+            goto error;
+    }
+    *pq = q;
+    *pr = r;
+    return 0;
+
+  error:
+    Py_XDECREF(q);
+    Py_XDECREF(r);
+    return -1;
+}
+
+/* Divide a by b, where b has n digits and a < b * BASE**n.  n is
+ * BURNIKEL_ZIEGLER_CUTOFF digits at most, or even.
+ */
+static int
+bz_div2n1n(PyLongObject *a, PyLongObject *b, Py_ssize_t n,
+           PyLongObject **pq, PyLongObject **pr)
+{
+    PyLongObject *b1 = NULL, *b2 = NULL, *q1 = NULL, *q2 = NULL;
+    PyLongObject *r = NULL, *t = NULL, *u = NULL;
+    Py_ssize_t half;
+    int res = -1;
+
+    if (n <= BURNIKEL_ZIEGLER_CUTOFF)
+        return long_divrem(a, b, pq, pr);
+
+    assert((n & 1) == 0);
+    half = n / 2;
+    b1 = long_digit_shift(b, -half);
+    b2 = long_digit_low(b, half);
+    if (b1 == NULL || b2 == NULL)
+        goto done;
+
+    /* q1, r = divmod(a // BASE**half, b), then
+       q2, r = divmod(r * BASE**half + a % BASE**half, b) */
+    t = long_digit_shift(a, -n);
+    if (t == NULL)
+        goto done;
+    u = long_digit_shift(a, -half);
+    if (u == NULL)
+        goto done;
+    Py_SETREF(u, long_digit_low(u, half));
+    if (u == NULL)
+        goto done;
+    if (bz_div3n2n(t, u, b, b1, b2, half, &q1, &r) < 0)
+        goto done;
+    Py_SETREF(u, long_digit_low(a, half));
+    if (u == NULL)
+        goto done;
+    Py_SETREF(t, r);
+    r = NULL;
+    if (bz_div3n2n(t, u, b, b1, b2, half, &q2, &r) < 0)
+        goto done;
+    *pq = long_digit_join(q1, half, q2);
+    if (*pq == NULL)
+        goto done;
+    *pr = r;
+    r = NULL;
+    res = 0;
+
+  done:
+    Py_XDECREF(b1);
+    Py_XDECREF(b2);
+    Py_XDECREF(q1);
+    Py_XDECREF(q2);
+    Py_XDECREF(r);
+    Py_XDECREF(t);
+    Py_XDECREF(u);
+    return res;
+}
+
+/* Compute *pdiv, *prem = divmod(|a|, |b|) for a divisor and a quotient of
+ * more than BURNIKEL_ZIEGLER_CUTOFF digits.  Both are shifted left, so that
+ * the divisor is normalized and has n = m * 2**k digits with m at most
+ * BURNIKEL_ZIEGLER_CUTOFF, and the dividend is divided by 2n/n steps in
+ * blocks of n digits from the top.
+ */
+static int
+long_divrem_bz(PyLongObject *a, PyLongObject *b,
+               PyLongObject **pdiv, PyLongObject **prem)
+{
+    Py_ssize_t size_a = Py_ABS(Py_SIZE(a)), size_b = Py_ABS(Py_SIZE(b));
+    Py_ssize_t n, m, pad, nblocks, i, size;
+    PyLongObject *v = NULL, *w = NULL, *z = NULL, *r = NULL;
+    PyLongObject *block = NULL, *q, *t;
+    int d, k;
+
+    /* Normalize:  w = |b| and v = |a| shifted left by pad digits and d
+       bits. */
+    for (m = size_b, k = 0; m > BURNIKEL_ZIEGLER_CUTOFF; k++)
+        m = (m + 1) / 2;
+    n = m << k;
+    pad = n - size_b;
+    d = PyLong_SHIFT - bits_in_digit(b->ob_digit[size_b-1]);
+    w = _PyLong_New(n);
+    v = _PyLong_New(size_a + 1 + pad);
+    if (w == NULL || v == NULL)
+        goto error;
+    memset(w->ob_digit, 0, pad * sizeof(digit));
+    memset(v->ob_digit, 0, pad * sizeof(digit));
+    (void)v_lshift(w->ob_digit + pad, b->ob_digit, size_b, d);
+    v->ob_digit[size_a + pad] = v_lshift(v->ob_digit + pad, a->ob_digit,
+                                         size_a, d);
+    v = long_normalize(v);
+
+    nblocks = (Py_SIZE(v) + n - 1) / n;
+    z = _PyLong_New(nblocks * n);
+    if (z == NULL)
+        goto error;
+    r = (PyLongObject *)PyLong_FromLong(0);
+    if (r == NULL)
+        goto error;
+    for (i = nblocks; --i >= 0; ) {
+        /* q, r = divmod(r * BASE**n + block i of v, w) */
+        size = Py_MIN(n, Py_SIZE(v) - i * n);
+        block = _PyLong_New(size);
+        if (block == NULL)
+            goto error;
+        memcpy(block->ob_digit, v->ob_digit + i * n, size * sizeof(digit));
+        block = long_normalize(block);
+        t = long_digit_join(r, n, block);
+        Py_CLEAR(block);
+        Py_CLEAR(r);
+        if (t == NULL)
+            goto error;
+        if (bz_div2n1n(t, w, n, &q, &r) < 0) {
+            Py_DECREF(t);
+            goto error;
+        }
+        Py_DECREF(t);
+        assert(Py_SIZE(q) <= n);
+        memcpy(z->ob_digit + i * n, q->ob_digit, Py_SIZE(q) * sizeof(digit));
+        memset(z->ob_digit + i * n + Py_SIZE(q), 0,
+               (n - Py_SIZE(q)) * sizeof(digit));
+        Py_DECREF(q);
+        SIGCHECK({
+                goto error;
+            });
+    }
+
+    /* Undo the normalization of the remainder. */
+    size = Py_MAX(Py_SIZE(r) - pad, 0);
+    t = _PyLong_New(size);
+    if (t == NULL)
+        goto error;
+    (void)v_rshift(t->ob_digit, r->ob_digit + pad, size, d);
+    Py_SETREF(r, long_normalize(t));
+    Py_DECREF(v);
+    Py_DECREF(w);
+    *pdiv = long_normalize(z);
+    *prem = r;
+    return 0;
+
+  error:
+    Py_XDECREF(v);
+    Py_XDECREF(w);
+    Py_XDECREF(z);
+    Py_XDECREF(r);
+    Py_XDECREF(block);
+    return -1;
+}
+
 /* Fast modulo division for single-digit longs. */
 static PyObject *
 fast_mod(PyLongObject *a, PyLongObject *b)
@@ -5615,7 +6615,7 @@ _PyLong_Init(void)
             /* _Py_NewReference sets the ref count to 1 but
              * the ref count might be larger. Set the refcnt
              * to the original refcnt + 1 */
-            Py_REFCNT(op) = refcnt + 1;
+            _Py_SET_REFCNT(op, refcnt + 1);
             assert(Py_SIZE(op) == size);
             assert(v->ob_digit[0] == (digit)abs(ival));
         }
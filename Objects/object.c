@@ -13,6 +13,169 @@ extern "C" {
 /* Defined in tracemalloc.c */
 extern void _PyMem_DumpTraceback(int fd, const void *ptr);
 
+#ifdef Py_BIASED_REFCNT
+#ifndef _Py_INLINE_THREAD_ID
+uintptr_t
+_Py_ThreadId(void)
+{
+    /* Shifted to leave the low bit for _Py_REF_SHARED_FLAG */
+    return (uintptr_t)PyThread_get_thread_ident() << 1;
+}
+#endif
+
+/* The shared counts of biased reference counting, in an open-addressed
+   hash table on object addresses with linear probing.  Each entry fills a
+   cache line, so that threads updating the shared counts of different
+   objects don't write the same line, and none of them writes the line of
+   an object header.  The table is at most half full, and an entry is
+   deleted by moving the following ones of its cluster back.  It is only
+   accessed with the GIL held.
+
+   The memory comes from calloc() rather than PyMem_RawCalloc(), whose
+   hooks may take references (tracemalloc does) and so modify the table
+   while it is being resized. */
+
+#define REF_SHARED_LINE 64
+#define REF_SHARED_MIN_BITS 10
+
+typedef struct {
+    const PyObject *ob;
+    Py_ssize_t count;
+    char pad[REF_SHARED_LINE - sizeof(PyObject *) - sizeof(Py_ssize_t)];
+} ref_shared_entry;
+
+static struct {
+    ref_shared_entry *entries;  /* aligned on REF_SHARED_LINE */
+    void *block;                /* the allocation holding entries */
+    size_t size;                /* 0 or a power of 2 */
+    int shift;                  /* bits of a hash not used for the index */
+    size_t used;
+} ref_shared;
+
+static inline size_t
+ref_shared_index(const PyObject *ob)
+{
+    /* Fibonacci hashing of the address, as objects are allocated at
+       addresses with regular strides */
+#if SIZEOF_SIZE_T > 4
+    size_t h = ((size_t)ob >> 3) * (size_t)0x9E3779B97F4A7C15ULL;
+#else
+    size_t h = ((size_t)ob >> 3) * (size_t)0x9E3779B9UL;
+#endif
+    return h >> ref_shared.shift;
+}
+
+/* Return the entry holding ob, or the empty one where it would go. */
+static ref_shared_entry *
+ref_shared_lookup(const PyObject *ob)
+{
+    size_t mask = ref_shared.size - 1;
+    size_t i = ref_shared_index(ob);
+
+    while (ref_shared.entries[i].ob != NULL && ref_shared.entries[i].ob != ob)
+        i = (i + 1) & mask;
+    return &ref_shared.entries[i];
+}
+
+/* Double the size of the table.  Return -1 on memory error. */
+static int
+ref_shared_grow(void)
+{
+    ref_shared_entry *old = ref_shared.entries;
+    void *old_block = ref_shared.block;
+    size_t old_size = ref_shared.size;
+    size_t size = old_size ? old_size * 2 : (size_t)1 << REF_SHARED_MIN_BITS;
+    size_t i;
+    void *block;
+
+    if (size > PY_SSIZE_T_MAX / sizeof(ref_shared_entry) - 1)
+        return -1;
+    block = calloc(size + 1, sizeof(ref_shared_entry));
+    if (block == NULL)
+        return -1;
+    ref_shared.block = block;
+    ref_shared.entries = (ref_shared_entry *)_Py_ALIGN_UP(block,
+                                                          REF_SHARED_LINE);
+    ref_shared.size = size;
+    ref_shared.shift = old_size ? ref_shared.shift - 1
+                                : 8 * SIZEOF_SIZE_T - REF_SHARED_MIN_BITS;
+    for (i = 0; i < old_size; i++) {
+        if (old[i].ob != NULL)
+            *ref_shared_lookup(old[i].ob) = old[i];
+    }
+    free(old_block);
+    return 0;
+}
+
+Py_ssize_t
+_Py_RefSharedGet(const PyObject *ob)
+{
+    ref_shared_entry *entry;
+
+    assert(ob->ob_tid & _Py_REF_SHARED_FLAG);
+    entry = ref_shared_lookup(ob);
+    assert(entry->ob == ob);
+    return entry->count;
+}
+
+Py_ssize_t
+_Py_RefSharedAdd(PyObject *ob, Py_ssize_t delta)
+{
+    ref_shared_entry *entry;
+
+    if (ob->ob_tid & _Py_REF_SHARED_FLAG) {
+        entry = ref_shared_lookup(ob);
+        assert(entry->ob == ob);
+    }
+    else {
+        if (2 * (ref_shared.used + 1) > ref_shared.size &&
+            ref_shared_grow() < 0) {
+            /* Count it in the object: the GIL makes that just as correct,
+               only slower for the owner thread's cache. */
+            ob->ob_ref_local += delta;
+            return 0;
+        }
+        entry = ref_shared_lookup(ob);
+        /* The entry may be left over by an object at the same address
+           which was freed without its reference count dropping to 0 */
+        if (entry->ob == NULL) {
+            entry->ob = ob;
+            ref_shared.used++;
+        }
+        entry->count = 0;
+        ob->ob_tid |= _Py_REF_SHARED_FLAG;
+    }
+    entry->count += delta;
+    return entry->count;
+}
+
+void
+_Py_RefSharedClear(PyObject *ob)
+{
+    size_t mask = ref_shared.size - 1;
+    size_t i, j, k;
+
+    assert(ob->ob_tid & _Py_REF_SHARED_FLAG);
+    ob->ob_tid &= ~_Py_REF_SHARED_FLAG;
+    i = ref_shared_lookup(ob) - ref_shared.entries;
+    assert(ref_shared.entries[i].ob == ob);
+    for (j = (i + 1) & mask;
+         ref_shared.entries[j].ob != NULL;
+         j = (j + 1) & mask) {
+        /* Move the entry at j to the hole at i unless its home slot k is
+           cyclically in (i, j] */
+        k = ref_shared_index(ref_shared.entries[j].ob);
+        if (i <= j ? (k <= i || k > j) : (k <= i && k > j)) {
+            ref_shared.entries[i] = ref_shared.entries[j];
+            i = j;
+        }
+    }
+    ref_shared.entries[i].ob = NULL;
+    ref_shared.entries[i].count = 0;
+    ref_shared.used--;
+}
+#endif /* Py_BIASED_REFCNT */
+
 _Py_IDENTIFIER(Py_Repr);
 _Py_IDENTIFIER(__bytes__);
 _Py_IDENTIFIER(__dir__);
@@ -28,7 +191,7 @@ _Py_GetRefTotal(void)
     Py_ssize_t total = _Py_RefTotal;
     o = _PySet_Dummy;
     if (o != NULL)
-        total -= o->ob_refcnt;
+        total -= Py_REFCNT(o);
     return total;
 }
 
@@ -292,11 +455,11 @@ PyObject_CallFinalizerFromDealloc(PyObject *self)
     Py_ssize_t refcnt;
 
     /* Temporarily resurrect the object. */
-    if (self->ob_refcnt != 0) {
+    if (Py_REFCNT(self) != 0) {
         Py_FatalError("PyObject_CallFinalizerFromDealloc called on "
                       "object with a non-zero refcount");
     }
-    self->ob_refcnt = 1;
+    _Py_SET_REFCNT(self, 1);
 
     PyObject_CallFinalizer(self);
 
@@ -304,17 +467,18 @@ PyObject_CallFinalizerFromDealloc(PyObject *self)
      * cause a recursive call.
      */
     _PyObject_ASSERT_WITH_MSG(self,
-                              self->ob_refcnt > 0,
+                              Py_REFCNT(self) > 0,
                               "refcount is too small");
-    if (--self->ob_refcnt == 0)
+    _Py_SET_REFCNT(self, Py_REFCNT(self) - 1);
+    if (Py_REFCNT(self) == 0)
         return 0;         /* this is the normal path out */
 
     /* tp_finalize resurrected it!  Make it look like the original Py_DECREF
      * never happened.
      */
-    refcnt = self->ob_refcnt;
+    refcnt = Py_REFCNT(self);
     _Py_NewReference(self);
-    self->ob_refcnt = refcnt;
+    _Py_SET_REFCNT(self, refcnt);
 
     _PyObject_ASSERT(self,
                      (!PyType_IS_GC(Py_TYPE(self))
@@ -354,12 +518,12 @@ PyObject_Print(PyObject *op, FILE *fp, int flags)
         Py_END_ALLOW_THREADS
     }
     else {
-        if (op->ob_refcnt <= 0) {
+        if (Py_REFCNT(op) <= 0) {
             /* XXX(twouters) cast refcount to long until %zd is
                universally available */
             Py_BEGIN_ALLOW_THREADS
             fprintf(fp, "<refcnt %ld at %p>",
-                (long)op->ob_refcnt, op);
+                (long)Py_REFCNT(op), op);
             Py_END_ALLOW_THREADS
         }
         else {
@@ -474,7 +638,7 @@ _PyObject_Dump(PyObject* op)
         "refcount: %ld\n"
         "address : %p\n",
         Py_TYPE(op)==NULL ? "NULL" : Py_TYPE(op)->tp_name,
-        (long)op->ob_refcnt,
+        (long)Py_REFCNT(op),
         op);
     fflush(stderr);
 }
@@ -1027,7 +1191,7 @@ PyObject_SetAttr(PyObject *v, PyObject *name, PyObject *value)
         return err;
     }
     Py_DECREF(name);
-    _PyObject_ASSERT(name, name->ob_refcnt >= 1);
+    _PyObject_ASSERT(name, Py_REFCNT(name) >= 1);
     if (tp->tp_getattr == NULL && tp->tp_getattro == NULL)
         PyErr_Format(PyExc_TypeError,
                      "'%.100s' object has no attributes "
@@ -1628,7 +1792,7 @@ PyTypeObject _PyNone_Type = {
 
 PyObject _Py_NoneStruct = {
   _PyObject_EXTRA_INIT
-  1, &_PyNone_Type
+  _PyObject_REFCNT_INIT(1) &_PyNone_Type
 };
 
 /* NotImplemented is an object that can be used to signal that an
@@ -1713,7 +1877,7 @@ PyTypeObject _PyNotImplemented_Type = {
 
 PyObject _Py_NotImplementedStruct = {
     _PyObject_EXTRA_INIT
-    1, &_PyNotImplemented_Type
+    _PyObject_REFCNT_INIT(1) &_PyNotImplemented_Type
 };
 
 _PyInitError
@@ -1760,6 +1924,8 @@ _PyTypes_Init(void)
     INIT_TYPE(&PyComplex_Type, "complex");
     INIT_TYPE(&PyFloat_Type, "float");
     INIT_TYPE(&PyFrozenSet_Type, "frozenset");
+    INIT_TYPE(&PyFrozenDict_Type, "frozendict");
+    INIT_TYPE(&_PyDictKeysHolder_Type, "dict keys holder");
     INIT_TYPE(&PyProperty_Type, "property");
     INIT_TYPE(&_PyManagedBuffer_Type, "managed buffer");
     INIT_TYPE(&PyMemoryView_Type, "memoryview");
@@ -1805,7 +1971,7 @@ _Py_NewReference(PyObject *op)
         _PyTraceMalloc_NewReference(op);
     }
     _Py_INC_REFTOTAL;
-    op->ob_refcnt = 1;
+    _Py_INIT_REFCNT(op, 1);
     _Py_AddToAllObjects(op, 1);
     _Py_INC_TPALLOCS(op);
 }
@@ -1816,7 +1982,7 @@ _Py_ForgetReference(PyObject *op)
 #ifdef SLOW_UNREF_CHECK
     PyObject *p;
 #endif
-    if (op->ob_refcnt < 0)
+    if (Py_REFCNT(op) < 0)
         Py_FatalError("UNREF negative refcnt");
     if (op == &refchain ||
         op->_ob_prev->_ob_next != op || op->_ob_next->_ob_prev != op) {
@@ -1851,7 +2017,7 @@ _Py_PrintReferences(FILE *fp)
     PyObject *op;
     fprintf(fp, "Remaining objects:\n");
     for (op = refchain._ob_next; op != &refchain; op = op->_ob_next) {
-        fprintf(fp, "%p [%" PY_FORMAT_SIZE_T "d] ", op, op->ob_refcnt);
+        fprintf(fp, "%p [%" PY_FORMAT_SIZE_T "d] ", op, Py_REFCNT(op));
         if (PyObject_Print(op, fp, 0) != 0)
             PyErr_Clear();
         putc('\n', fp);
@@ -1868,7 +2034,7 @@ _Py_PrintReferenceAddresses(FILE *fp)
     fprintf(fp, "Remaining object addresses:\n");
     for (op = refchain._ob_next; op != &refchain; op = op->_ob_next)
         fprintf(fp, "%p [%" PY_FORMAT_SIZE_T "d] %s\n", op,
-            op->ob_refcnt, Py_TYPE(op)->tp_name);
+            Py_REFCNT(op), Py_TYPE(op)->tp_name);
 }
 
 PyObject *
@@ -2005,7 +2171,7 @@ _PyTrash_deposit_object(PyObject *op)
 {
     _PyObject_ASSERT(op, PyObject_IS_GC(op));
     _PyObject_ASSERT(op, !_PyObject_GC_IS_TRACKED(op));
-    _PyObject_ASSERT(op, op->ob_refcnt == 0);
+    _PyObject_ASSERT(op, Py_REFCNT(op) == 0);
     _PyGCHead_SET_PREV(_Py_AS_GC(op), _PyRuntime.gc.trash_delete_later);
     _PyRuntime.gc.trash_delete_later = op;
 }
@@ -2017,7 +2183,7 @@ _PyTrash_thread_deposit_object(PyObject *op)
     PyThreadState *tstate = _PyThreadState_GET();
     _PyObject_ASSERT(op, PyObject_IS_GC(op));
     _PyObject_ASSERT(op, !_PyObject_GC_IS_TRACKED(op));
-    _PyObject_ASSERT(op, op->ob_refcnt == 0);
+    _PyObject_ASSERT(op, Py_REFCNT(op) == 0);
     _PyGCHead_SET_PREV(_Py_AS_GC(op), tstate->trash_delete_later);
     tstate->trash_delete_later = op;
 }
@@ -2041,7 +2207,7 @@ _PyTrash_destroy_chain(void)
          * assorted non-release builds calling Py_DECREF again ends
          * up distorting allocation statistics.
          */
-        _PyObject_ASSERT(op, op->ob_refcnt == 0);
+        _PyObject_ASSERT(op, Py_REFCNT(op) == 0);
         ++_PyRuntime.gc.trash_delete_nesting;
         (*dealloc)(op);
         --_PyRuntime.gc.trash_delete_nesting;
@@ -2079,7 +2245,7 @@ _PyTrash_thread_destroy_chain(void)
          * assorted non-release builds calling Py_DECREF again ends
          * up distorting allocation statistics.
          */
-        _PyObject_ASSERT(op, op->ob_refcnt == 0);
+        _PyObject_ASSERT(op, Py_REFCNT(op) == 0);
         (*dealloc)(op);
         assert(tstate->trash_delete_nesting == 1);
     }
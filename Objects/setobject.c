@@ -2551,6 +2551,6 @@ static PyTypeObject _PySetDummy_Type = {
 
 static PyObject _dummy_struct = {
   _PyObject_EXTRA_INIT
-  2, &_PySetDummy_Type
+  _PyObject_REFCNT_INIT(2) &_PySetDummy_Type
 };
 
@@ -90,7 +90,7 @@ PyTypeObject PyEllipsis_Type = {
 
 PyObject _Py_EllipsisObject = {
     _PyObject_EXTRA_INIT
-    1, &PyEllipsis_Type
+    _PyObject_REFCNT_INIT(1) &PyEllipsis_Type
 };
 
 
@@ -38,6 +38,42 @@ STRINGLIB(utf8_decode)(const char **inptr, const char *end,
                First, check if we can do an aligned read, as most CPUs have
                a penalty for unaligned reads.
             */
+#ifdef _Py_HAVE_SSE2
+            /* With SSE2, check 16 bytes at a time and widen them to
+               STRINGLIB_CHAR with unaligned stores. */
+            while (end - s >= 16) {
+                __m128i v = _mm_loadu_si128((const __m128i *)s);
+                if (_mm_movemask_epi8(v))
+                    break;
+# if STRINGLIB_SIZEOF_CHAR == 1
+                _mm_storeu_si128((__m128i *)p, v);
+# else
+                {
+                    const __m128i zero = _mm_setzero_si128();
+                    __m128i lo = _mm_unpacklo_epi8(v, zero);
+                    __m128i hi = _mm_unpackhi_epi8(v, zero);
+#  if STRINGLIB_SIZEOF_CHAR == 2
+                    _mm_storeu_si128((__m128i *)p, lo);
+                    _mm_storeu_si128((__m128i *)(p + 8), hi);
+#  else
+                    _mm_storeu_si128((__m128i *)p,
+                                     _mm_unpacklo_epi16(lo, zero));
+                    _mm_storeu_si128((__m128i *)(p + 4),
+                                     _mm_unpackhi_epi16(lo, zero));
+                    _mm_storeu_si128((__m128i *)(p + 8),
+                                     _mm_unpacklo_epi16(hi, zero));
+                    _mm_storeu_si128((__m128i *)(p + 12),
+                                     _mm_unpackhi_epi16(hi, zero));
+#  endif
+                }
+# endif
+                s += 16;
+                p += 16;
+            }
+            if (s == end)
+                break;
+            ch = (unsigned char)*s;
+#endif
             if (_Py_IS_ALIGNED(s, SIZEOF_LONG)) {
                 /* Help register allocation */
                 const char *_s = s;
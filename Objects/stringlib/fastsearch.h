@@ -6,6 +6,16 @@
    moore and horspool, with a few more bells and whistles on the top.
    for some more background, see: http://effbot.org/zone/stringlib.htm */
 
+/* forward searches with SSE2 available scan 16 bytes at a time for
+   positions where both the first and the last character of the pattern
+   match, and only verify those.  long patterns start with the horspool
+   loop instead, whose bloom skips can cover more than that, and switch
+   to the filter when the skips turn out shorter.  both loops
+   degrade to O(n*m) on periodic inputs, so they keep track of the work
+   spent verifying candidates and hand the rest of the search over to the
+   linear time two-way algorithm (Crochemore and Perrin, 1991) once it
+   gets out of proportion with the progress made. */
+
 /* note: fastsearch may access s[n], which isn't a problem when using
    Python's ordinary string types, but may cause problems if you're
    using this code in other contexts.  also, the count mode returns -1
@@ -32,6 +42,8 @@
 #define STRINGLIB_BLOOM(mask, ch)     \
     ((mask &  (1UL << ((ch) & (STRINGLIB_BLOOM_WIDTH -1)))))
 
+#include "pycore_simd.h"
+
 #if STRINGLIB_SIZEOF_CHAR == 1
 #  define MEMCHR_CUT_OFF 15
 #else
@@ -160,14 +172,269 @@ STRINGLIB(rfind_char)(const STRINGLIB_CHAR* s, Py_ssize_t n, STRINGLIB_CHAR ch)
 
 #undef MEMCHR_CUT_OFF
 
+/* verifying candidates may cost this many character comparisons more than
+   twice the number of positions scanned before switching to two-way */
+#define TWO_WAY_SLACK(m) (8 * (m) + 256)
+
+/* return the start of the maximal suffix of p[:m] (with the alphabet
+   order reversed if invert is true), and store the period of that
+   suffix in *period */
+Py_LOCAL_INLINE(Py_ssize_t)
+STRINGLIB(_lex_search)(const STRINGLIB_CHAR* p, Py_ssize_t m,
+                       Py_ssize_t *period, int invert)
+{
+    Py_ssize_t suffix = 0, candidate = 1, k = 0, per = 1;
+
+    while (candidate + k < m) {
+        STRINGLIB_CHAR a = p[candidate + k];
+        STRINGLIB_CHAR b = p[suffix + k];
+        if (invert ? (b < a) : (a < b)) {
+            /* the suffix at candidate is smaller: none of the k + 1
+               characters scanned from it can start a maximal suffix */
+            candidate += k + 1;
+            k = 0;
+            per = candidate - suffix;
+        }
+        else if (a == b) {
+            if (k + 1 != per)
+                k++;
+            else {
+                /* matched a whole period */
+                candidate += per;
+                k = 0;
+            }
+        }
+        else {
+            /* the suffix at candidate is larger */
+            suffix = candidate;
+            candidate++;
+            k = 0;
+            per = 1;
+        }
+    }
+    *period = per;
+    return suffix;
+}
+
+/* two-way search/count of p[:m] in s[:n], for FAST_SEARCH and FAST_COUNT
+   only.  never reads past s[n-1], and does at most 2*n comparisons. */
+Py_LOCAL(Py_ssize_t)
+STRINGLIB(_two_way)(const STRINGLIB_CHAR* s, Py_ssize_t n,
+                    const STRINGLIB_CHAR* p, Py_ssize_t m,
+                    Py_ssize_t maxcount, int mode)
+{
+    Py_ssize_t cut, cut2, period, period2, memory, periodic;
+    Py_ssize_t i, j, w, count = 0;
+    unsigned long mask = 0;
+
+    w = n - m;
+    if (w < 0)
+        return mode == FAST_COUNT ? 0 : -1;
+
+    /* critical factorization p = p[:cut] + p[cut:] */
+    cut = STRINGLIB(_lex_search)(p, m, &period, 0);
+    cut2 = STRINGLIB(_lex_search)(p, m, &period2, 1);
+    if (cut2 > cut) {
+        cut = cut2;
+        period = period2;
+    }
+    periodic = (period <= m - cut &&
+                memcmp(p, p + period, cut * sizeof(STRINGLIB_CHAR)) == 0);
+    if (!periodic)
+        period = Py_MAX(cut, m - cut) + 1;
+
+    for (i = 0; i < m; i++)
+        STRINGLIB_BLOOM_ADD(mask, p[i]);
+
+    j = 0;
+    memory = 0;
+    while (j <= w) {
+        /* cheap skip: a window ending in a character that does not occur
+           in the pattern cannot match */
+        if (!STRINGLIB_BLOOM(mask, s[j + m - 1])) {
+            j += m;
+            memory = 0;
+            continue;
+        }
+        /* match the right half */
+        i = Py_MAX(cut, memory);
+        while (i < m && p[i] == s[j + i])
+            i++;
+        if (i < m) {
+            j += i - cut + 1;
+            memory = 0;
+            continue;
+        }
+        /* match the left half, down to what is known to match already */
+        i = cut;
+        while (i > memory && p[i - 1] == s[j + i - 1])
+            i--;
+        if (i <= memory) {
+            /* got a match! */
+            if (mode != FAST_COUNT)
+                return j;
+            count++;
+            if (count == maxcount)
+                break;
+            j += m;
+            memory = 0;
+        }
+        else {
+            j += period;
+            if (periodic)
+                memory = m - period;
+        }
+    }
+
+    if (mode != FAST_COUNT)
+        return -1;
+    return count;
+}
+
+/* continue a forward search at s[start:] with the two-way algorithm,
+   after count matches have been found before start */
+Py_LOCAL_INLINE(Py_ssize_t)
+STRINGLIB(_two_way_tail)(const STRINGLIB_CHAR* s, Py_ssize_t n,
+                         const STRINGLIB_CHAR* p, Py_ssize_t m,
+                         Py_ssize_t maxcount, int mode,
+                         Py_ssize_t start, Py_ssize_t count)
+{
+    Py_ssize_t res;
+
+    if (mode != FAST_COUNT) {
+        res = STRINGLIB(_two_way)(s + start, n - start, p, m, -1, mode);
+        return res < 0 ? -1 : res + start;
+    }
+    res = STRINGLIB(_two_way)(s + start, n - start, p, m,
+                              maxcount - count, mode);
+    return count + res;
+}
+
+#ifdef _Py_HAVE_SSE2
+
+#if STRINGLIB_SIZEOF_CHAR == 1
+#  define STRINGLIB_SSE2_SET1(ch) _mm_set1_epi8((char)(ch))
+#  define STRINGLIB_SSE2_CMPEQ _mm_cmpeq_epi8
+#elif STRINGLIB_SIZEOF_CHAR == 2
+#  define STRINGLIB_SSE2_SET1(ch) _mm_set1_epi16((short)(ch))
+#  define STRINGLIB_SSE2_CMPEQ _mm_cmpeq_epi16
+#else
+#  define STRINGLIB_SSE2_SET1(ch) _mm_set1_epi32((int)(ch))
+#  define STRINGLIB_SSE2_CMPEQ _mm_cmpeq_epi32
+#endif
+
+/* forward search/count for m >= 2: the first and last characters of the
+   pattern are compared against 16 bytes worth of positions at once */
+Py_LOCAL(Py_ssize_t)
+STRINGLIB(_sse2_search)(const STRINGLIB_CHAR* s, Py_ssize_t n,
+                        const STRINGLIB_CHAR* p, Py_ssize_t m,
+                        Py_ssize_t maxcount, int mode)
+{
+    const Py_ssize_t lanes = 16 / STRINGLIB_SIZEOF_CHAR;
+    const unsigned int lane_bits = (1U << STRINGLIB_SIZEOF_CHAR) - 1;
+    const Py_ssize_t mlast = m - 1, w = n - m;
+    const __m128i first = STRINGLIB_SSE2_SET1(p[0]);
+    const __m128i last = STRINGLIB_SSE2_SET1(p[mlast]);
+    Py_ssize_t i, j, k, count = 0, hits = 0;
+    /* in count mode, matches may not overlap: the next one can start at
+       next at the earliest */
+    Py_ssize_t next = 0;
+
+    for (i = 0; i + lanes - 1 <= w; i += lanes) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(s + i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(s + i + mlast));
+        unsigned int bits = (unsigned int)_mm_movemask_epi8(
+            _mm_and_si128(STRINGLIB_SSE2_CMPEQ(a, first),
+                          STRINGLIB_SSE2_CMPEQ(b, last)));
+        while (bits) {
+            int bit = _Py_MASK_FIRST(bits);
+            bits &= ~(lane_bits << bit);
+            k = i + bit / STRINGLIB_SIZEOF_CHAR;
+            if (k < next)
+                continue;
+            /* candidate match */
+            for (j = 1; j < mlast; j++)
+                if (s[k+j] != p[j])
+                    break;
+            hits += j;
+            if (j >= mlast) {
+                /* got a match! */
+                if (mode != FAST_COUNT)
+                    return k;
+                count++;
+                if (count == maxcount)
+                    return maxcount;
+                next = k + m;
+            }
+        }
+        if (hits > 2 * i + TWO_WAY_SLACK(m))
+            return STRINGLIB(_two_way_tail)(s, n, p, m, maxcount, mode,
+                                            Py_MAX(i + lanes, next), count);
+    }
+
+    /* fewer than lanes positions left */
+    for (i = Py_MAX(i, next); i <= w; i++) {
+        if (s[i] != p[0] || s[i+mlast] != p[mlast])
+            continue;
+        for (j = 1; j < mlast; j++)
+            if (s[i+j] != p[j])
+                break;
+        if (j >= mlast) {
+            if (mode != FAST_COUNT)
+                return i;
+            count++;
+            if (count == maxcount)
+                return maxcount;
+            i = i + mlast;
+        }
+    }
+
+    if (mode != FAST_COUNT)
+        return -1;
+    return count;
+}
+
+/* continue a forward search at s[start:] with the SSE2 filter, after
+   count matches have been found before start */
+Py_LOCAL_INLINE(Py_ssize_t)
+STRINGLIB(_sse2_tail)(const STRINGLIB_CHAR* s, Py_ssize_t n,
+                      const STRINGLIB_CHAR* p, Py_ssize_t m,
+                      Py_ssize_t maxcount, int mode,
+                      Py_ssize_t start, Py_ssize_t count)
+{
+    Py_ssize_t res;
+
+    if (mode != FAST_COUNT) {
+        res = STRINGLIB(_sse2_search)(s + start, n - start, p, m, -1, mode);
+        return res < 0 ? -1 : res + start;
+    }
+    res = STRINGLIB(_sse2_search)(s + start, n - start, p, m,
+                                  maxcount - count, mode);
+    return count + res;
+}
+
+/* the horspool loop is used for patterns whose skips can be longer than
+   three steps of the filter, and checks every SKIP_CHECK iterations that
+   they are */
+#define SSE2_MIN_SKIP (48 / STRINGLIB_SIZEOF_CHAR)
+#define SKIP_CHECK 64
+
+#undef STRINGLIB_SSE2_SET1
+#undef STRINGLIB_SSE2_CMPEQ
+
+#endif /* _Py_HAVE_SSE2 */
+
 Py_LOCAL_INLINE(Py_ssize_t)
 FASTSEARCH(const STRINGLIB_CHAR* s, Py_ssize_t n,
            const STRINGLIB_CHAR* p, Py_ssize_t m,
            Py_ssize_t maxcount, int mode)
 {
     unsigned long mask;
-    Py_ssize_t skip, count = 0;
+    Py_ssize_t skip, count = 0, hits = 0;
     Py_ssize_t i, j, mlast, w;
+#ifdef _Py_HAVE_SSE2
+    Py_ssize_t steps = 0, mark = 0;
+#endif
 
     w = n - m;
 
@@ -199,6 +466,11 @@ FASTSEARCH(const STRINGLIB_CHAR* s, Py_ssize_t n,
     skip = mlast - 1;
     mask = 0;
 
+#ifdef _Py_HAVE_SSE2
+    if (mode != FAST_RSEARCH && m < SSE2_MIN_SKIP)
+        return STRINGLIB(_sse2_search)(s, n, p, m, maxcount, mode);
+#endif
+
     if (mode != FAST_RSEARCH) {
         const STRINGLIB_CHAR *ss = s + m - 1;
         const STRINGLIB_CHAR *pp = p + m - 1;
@@ -215,6 +487,15 @@ FASTSEARCH(const STRINGLIB_CHAR* s, Py_ssize_t n,
         STRINGLIB_BLOOM_ADD(mask, p[mlast]);
 
         for (i = 0; i <= w; i++) {
+#ifdef _Py_HAVE_SSE2
+            if (++steps == SKIP_CHECK) {
+                if (i - mark < SKIP_CHECK * SSE2_MIN_SKIP)
+                    return STRINGLIB(_sse2_tail)(s, n, p, m, maxcount, mode,
+                                                 i, count);
+                steps = 0;
+                mark = i;
+            }
+#endif
             /* note: using mlast in the skip path slows things down on x86 */
             if (ss[i] == pp[0]) {
                 /* candidate match */
@@ -231,6 +512,10 @@ FASTSEARCH(const STRINGLIB_CHAR* s, Py_ssize_t n,
                     i = i + mlast;
                     continue;
                 }
+                hits += j + 1;
+                if (hits > 2 * i + TWO_WAY_SLACK(m))
+                    return STRINGLIB(_two_way_tail)(s, n, p, m, maxcount,
+                                                    mode, i + 1, count);
                 /* miss: check if next character is part of pattern */
                 if (!STRINGLIB_BLOOM(mask, ss[i+1]))
                     i = i + m;
@@ -282,3 +567,6 @@ FASTSEARCH(const STRINGLIB_CHAR* s, Py_ssize_t n,
     return count;
 }
 
+#undef TWO_WAY_SLACK
+#undef SSE2_MIN_SKIP
+#undef SKIP_CHECK
@@ -43,6 +43,7 @@ OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 #include "pycore_fileutils.h"
 #include "pycore_object.h"
 #include "pycore_pystate.h"
+#include "pycore_simd.h"
 #include "ucnhash.h"
 #include "bytes_methods.h"
 #include "stringlib/eq.h"
@@ -1810,7 +1811,7 @@ unicode_dealloc(PyObject *unicode)
 
     case SSTATE_INTERNED_MORTAL:
         /* revive dead object temporarily for DelItem */
-        Py_REFCNT(unicode) = 3;
+        _Py_SET_REFCNT(unicode, 3);
         if (PyDict_DelItem(interned, unicode) != 0)
             Py_FatalError(
                 "deletion of interned string failed");
@@ -4749,8 +4750,26 @@ static Py_ssize_t
 ascii_decode(const char *start, const char *end, Py_UCS1 *dest)
 {
     const char *p = start;
+#ifdef _Py_HAVE_SSE2
+    /* Copy 16 bytes at a time until the first non-ASCII byte */
+    while (end - p >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p);
+        int mask = _mm_movemask_epi8(v);
+        if (mask) {
+            Py_ssize_t n = _Py_MASK_FIRST(mask);
+            memcpy(dest + (p - start), p, n);
+            return p - start + n;
+        }
+        _mm_storeu_si128((__m128i *)(dest + (p - start)), v);
+        p += 16;
+    }
+    while (p < end && !((unsigned char)*p & 0x80)) {
+        dest[p - start] = *p;
+        p++;
+    }
+    return p - start;
+#else
     const char *aligned_end = (const char *) _Py_ALIGN_DOWN(end, SIZEOF_LONG);
-
     /*
      * Issue #17237: m68k is a bit different from most architectures in
      * that objects do not use "natural alignment" - for example, int and
@@ -4807,6 +4826,226 @@ ascii_decode(const char *start, const char *end, Py_UCS1 *dest)
     }
     memcpy(dest, start, p - start);
     return p - start;
+#endif
+}
+
+/* Count the code points of the UTF-8 string [p, end), that is, the bytes
+   which are not continuation bytes (10xxxxxx), and store its largest byte
+   in *maxbyte.  The result is only meaningful for valid UTF-8. */
+static Py_ssize_t
+utf8_count_scalar(const unsigned char *p, const unsigned char *end,
+                  unsigned char *maxbyte)
+{
+    const unsigned char *start = p;
+    Py_ssize_t ncont = 0;
+    unsigned char max = *maxbyte;
+
+    for (; p < end; p++) {
+        unsigned char ch = *p;
+        if (ch > max)
+            max = ch;
+        ncont += ((ch & 0xC0) == 0x80);
+    }
+    *maxbyte = max;
+    return (end - start) - ncont;
+}
+
+#ifdef _Py_HAVE_SSE2
+/* Sum of the two 64-bit lanes of v.  The counts can exceed 2**31 for
+   large inputs, so the lanes are not truncated to int. */
+static inline Py_ssize_t
+utf8_sum_epi64(__m128i v)
+{
+    uint64_t lanes[2];
+
+    _mm_storeu_si128((__m128i *)lanes, v);
+    return (Py_ssize_t)(lanes[0] + lanes[1]);
+}
+
+static Py_ssize_t
+utf8_count_sse2(const unsigned char *p, const unsigned char *end,
+                unsigned char *maxbyte)
+{
+    const unsigned char *start = p;
+    /* continuation bytes are the bytes below -64 as signed chars */
+    const __m128i cont_bound = _mm_set1_epi8(-64);
+    const __m128i zero = _mm_setzero_si128();
+    __m128i vmax = zero;
+    __m128i total = zero;
+    Py_ssize_t ncont;
+
+    while (end - p >= 16) {
+        /* per-lane byte counters, flushed before they can overflow */
+        __m128i counts = zero;
+        Py_ssize_t blocks = Py_MIN((end - p) / 16, 255);
+        for (; blocks > 0; blocks--, p += 16) {
+            __m128i v = _mm_loadu_si128((const __m128i *)p);
+            vmax = _mm_max_epu8(vmax, v);
+            counts = _mm_sub_epi8(counts, _mm_cmplt_epi8(v, cont_bound));
+        }
+        total = _mm_add_epi64(total, _mm_sad_epu8(counts, zero));
+    }
+    ncont = utf8_sum_epi64(total);
+
+    /* horizontal maximum */
+    vmax = _mm_max_epu8(vmax, _mm_srli_si128(vmax, 8));
+    vmax = _mm_max_epu8(vmax, _mm_srli_si128(vmax, 4));
+    vmax = _mm_max_epu8(vmax, _mm_srli_si128(vmax, 2));
+    vmax = _mm_max_epu8(vmax, _mm_srli_si128(vmax, 1));
+    *maxbyte = (unsigned char)_mm_cvtsi128_si32(vmax);
+
+    return (p - start) - ncont + utf8_count_scalar(p, end, maxbyte);
+}
+#endif
+
+#ifdef _Py_HAVE_AVX2_DISPATCH
+_Py_TARGET_AVX2 static Py_ssize_t
+utf8_count_avx2(const unsigned char *p, const unsigned char *end,
+                unsigned char *maxbyte)
+{
+    const unsigned char *start = p;
+    const __m256i cont_bound = _mm256_set1_epi8(-64);
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i vmax = zero;
+    __m256i total = zero;
+    __m128i max128, total128;
+    Py_ssize_t ncont;
+
+    while (end - p >= 32) {
+        __m256i counts = zero;
+        Py_ssize_t blocks = Py_MIN((end - p) / 32, 255);
+        for (; blocks > 0; blocks--, p += 32) {
+            __m256i v = _mm256_loadu_si256((const __m256i *)p);
+            vmax = _mm256_max_epu8(vmax, v);
+            counts = _mm256_sub_epi8(counts,
+                                     _mm256_cmpgt_epi8(cont_bound, v));
+        }
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(counts, zero));
+    }
+    total128 = _mm_add_epi64(_mm256_castsi256_si128(total),
+                             _mm256_extracti128_si256(total, 1));
+    ncont = utf8_sum_epi64(total128);
+
+    max128 = _mm_max_epu8(_mm256_castsi256_si128(vmax),
+                          _mm256_extracti128_si256(vmax, 1));
+    max128 = _mm_max_epu8(max128, _mm_srli_si128(max128, 8));
+    max128 = _mm_max_epu8(max128, _mm_srli_si128(max128, 4));
+    max128 = _mm_max_epu8(max128, _mm_srli_si128(max128, 2));
+    max128 = _mm_max_epu8(max128, _mm_srli_si128(max128, 1));
+    *maxbyte = (unsigned char)_mm_cvtsi128_si32(max128);
+
+    return (p - start) - ncont + utf8_count_scalar(p, end, maxbyte);
+}
+#endif
+
+static Py_ssize_t
+utf8_count(const char *start, const char *end, unsigned char *maxbyte)
+{
+    const unsigned char *p = (const unsigned char *)start;
+    const unsigned char *e = (const unsigned char *)end;
+
+    *maxbyte = 0;
+#ifdef _Py_HAVE_AVX2_DISPATCH
+    if (e - p >= 64 && _Py_cpu_has_avx2())
+        return utf8_count_avx2(p, e, maxbyte);
+#endif
+#ifdef _Py_HAVE_SSE2
+    return utf8_count_sse2(p, e, maxbyte);
+#else
+    return utf8_count_scalar(p, e, maxbyte);
+#endif
+}
+
+/* Decode valid UTF-8 straight into a string of the right kind and length,
+   which are computed by a first pass over the data.  Return 1 and set
+   *result on success, return -1 on memory error, and return 0 if the data
+   is not valid UTF-8 (or ends with an incomplete sequence and consumed is
+   NULL); the caller then decodes it with the general code, which handles
+   the errors. */
+static int
+unicode_decode_utf8_exact(const char *s, const char *end,
+                          Py_ssize_t *consumed, PyObject **result)
+{
+    const char *stop = end;
+    const char *p;
+    PyObject *unicode;
+    Py_ssize_t length, pos = 0;
+    unsigned char maxbyte;
+    Py_UCS4 maxchar, ch;
+
+    if (consumed != NULL) {
+        /* Leave out an incomplete sequence at the end, if it is only
+           incomplete (and not invalid) */
+        Py_UCS4 buf[4];
+        Py_ssize_t tailpos = 0;
+        Py_ssize_t need;
+
+        p = end;
+        while (p > s && end - p < 3 && ((unsigned char)p[-1] & 0xC0) == 0x80)
+            p--;
+        if (p > s) {
+            ch = (unsigned char)p[-1];
+            need = ch >= 0xF0 ? 4 : ch >= 0xE0 ? 3 : ch >= 0xC0 ? 2 : 1;
+            if (need > end - (p - 1)) {
+                stop = p - 1;
+                p = stop;
+                if (ucs4lib_utf8_decode(&p, end, buf, &tailpos) != 0 ||
+                    p != stop || tailpos != 0)
+                    return 0;
+            }
+        }
+    }
+
+    length = utf8_count(s, stop, &maxbyte);
+    if (maxbyte < 0x80)
+        maxchar = 0x7F;
+    else if (maxbyte < 0xC4)
+        maxchar = 0xFF;
+    else if (maxbyte < 0xF0)
+        maxchar = 0xFFFF;
+    else
+        maxchar = MAX_UNICODE;
+
+    unicode = PyUnicode_New(length, maxchar);
+    if (unicode == NULL)
+        return -1;
+
+    p = s;
+    switch (PyUnicode_KIND(unicode)) {
+    case PyUnicode_1BYTE_KIND:
+        if (maxchar == 0x7F) {
+            memcpy(PyUnicode_1BYTE_DATA(unicode), s, stop - s);
+            p = stop;
+            pos = length;
+            ch = 0;
+        }
+        else
+            ch = ucs1lib_utf8_decode(&p, stop,
+                                     PyUnicode_1BYTE_DATA(unicode), &pos);
+        break;
+    case PyUnicode_2BYTE_KIND:
+        ch = ucs2lib_utf8_decode(&p, stop,
+                                 PyUnicode_2BYTE_DATA(unicode), &pos);
+        break;
+    default:
+        assert(PyUnicode_KIND(unicode) == PyUnicode_4BYTE_KIND);
+        ch = ucs4lib_utf8_decode(&p, stop,
+                                 PyUnicode_4BYTE_DATA(unicode), &pos);
+        break;
+    }
+    /* Every decoded character starts with a byte counted by utf8_count(),
+       so the string cannot overflow; a shorter result means an error */
+    assert(pos <= length);
+    if (ch != 0 || p != stop || pos != length) {
+        Py_DECREF(unicode);
+        return 0;
+    }
+
+    if (consumed)
+        *consumed = stop - s;
+    assert(_PyUnicode_CheckConsistency(unicode, 1));
+    *result = unicode;
+    return 1;
 }
 
 PyObject *
@@ -4818,6 +5057,7 @@ PyUnicode_DecodeUTF8Stateful(const char *s,
     _PyUnicodeWriter writer;
     const char *starts = s;
     const char *end = s + size;
+    PyObject *res;
 
     Py_ssize_t startinpos;
     Py_ssize_t endinpos;
@@ -4839,6 +5079,13 @@ PyUnicode_DecodeUTF8Stateful(const char *s,
         return get_latin1_char((unsigned char)s[0]);
     }
 
+    switch (unicode_decode_utf8_exact(s, end, consumed, &res)) {
+    case 1:
+        return res;
+    case -1:
+        return NULL;
+    }
+
     _PyUnicodeWriter_Init(&writer);
     writer.min_length = size;
     if (_PyUnicodeWriter_Prepare(&writer, writer.min_length, 127) == -1)
@@ -15302,7 +15549,7 @@ PyUnicode_InternInPlace(PyObject **p)
     }
     /* The two references in interned are not counted by refcnt.
        The deallocator will take care of this */
-    Py_REFCNT(s) -= 2;
+    _Py_SET_REFCNT(s, Py_REFCNT(s) - 2);
     _PyUnicode_STATE(s).interned = SSTATE_INTERNED_MORTAL;
 }
 
@@ -15360,11 +15607,11 @@ _Py_ReleaseInternedUnicodeStrings(void)
             /* XXX Shouldn't happen */
             break;
         case SSTATE_INTERNED_IMMORTAL:
-            Py_REFCNT(s) += 1;
+            _Py_SET_REFCNT(s, Py_REFCNT(s) + 1);
             immortal_size += PyUnicode_GET_LENGTH(s);
             break;
         case SSTATE_INTERNED_MORTAL:
-            Py_REFCNT(s) += 2;
+            _Py_SET_REFCNT(s, Py_REFCNT(s) + 2);
             mortal_size += PyUnicode_GET_LENGTH(s);
             break;
         default:
@@ -1001,6 +1001,18 @@ done:
         return _Py_INIT_NO_MEMORY();
     }
 
+    /* The standard library is in prefix\Lib, unless it only comes
+       from a zip file */
+    if (prefix[0] && gotlandmark(prefix, LANDMARK)) {
+        wchar_t stdlib_dir[MAXPATHLEN+1];
+        wcscpy_s(stdlib_dir, MAXPATHLEN+1, prefix);
+        join(stdlib_dir, L"Lib");
+        config->stdlib_dir = _PyMem_RawWcsdup(stdlib_dir);
+        if (config->stdlib_dir == NULL) {
+            return _Py_INIT_NO_MEMORY();
+        }
+    }
+
     return _Py_INIT_OK();
 }
 
@@ -297,6 +297,87 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(_imp__frozen_stdlib_names__doc__,
+"_frozen_stdlib_names($module, /)\n"
+"--\n"
+"\n"
+"Returns the names of the frozen copies of standard library modules.");
+
+#define _IMP__FROZEN_STDLIB_NAMES_METHODDEF    \
+    {"_frozen_stdlib_names", (PyCFunction)_imp__frozen_stdlib_names, METH_NOARGS, _imp__frozen_stdlib_names__doc__},
+
+static PyObject *
+_imp__frozen_stdlib_names_impl(PyObject *module);
+
+static PyObject *
+_imp__frozen_stdlib_names(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return _imp__frozen_stdlib_names_impl(module);
+}
+
+PyDoc_STRVAR(_imp__frozen_stdlib_source_hash__doc__,
+"_frozen_stdlib_source_hash($module, name, /)\n"
+"--\n"
+"\n"
+"Returns the hash of the source of a frozen copy of a standard library module.\n"
+"\n"
+"This is _imp.source_hash(0, source), with \"\\r\\n\" newlines read as \"\\n\".\n"
+"Returns None if name is not one of the frozen copies.");
+
+#define _IMP__FROZEN_STDLIB_SOURCE_HASH_METHODDEF    \
+    {"_frozen_stdlib_source_hash", (PyCFunction)_imp__frozen_stdlib_source_hash, METH_O, _imp__frozen_stdlib_source_hash__doc__},
+
+static PyObject *
+_imp__frozen_stdlib_source_hash_impl(PyObject *module, PyObject *name);
+
+static PyObject *
+_imp__frozen_stdlib_source_hash(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    PyObject *name;
+
+    if (!PyUnicode_Check(arg)) {
+        _PyArg_BadArgument("_frozen_stdlib_source_hash", 0, "str", arg);
+        goto exit;
+    }
+    if (PyUnicode_READY(arg) == -1) {
+        goto exit;
+    }
+    name = arg;
+    return_value = _imp__frozen_stdlib_source_hash_impl(module, name);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_imp__use_frozen_stdlib__doc__,
+"_use_frozen_stdlib($module, enabled, /)\n"
+"--\n"
+"\n"
+"Sets whether the frozen copies of standard library modules are used.");
+
+#define _IMP__USE_FROZEN_STDLIB_METHODDEF    \
+    {"_use_frozen_stdlib", (PyCFunction)_imp__use_frozen_stdlib, METH_O, _imp__use_frozen_stdlib__doc__},
+
+static PyObject *
+_imp__use_frozen_stdlib_impl(PyObject *module, int enabled);
+
+static PyObject *
+_imp__use_frozen_stdlib(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    int enabled;
+
+    enabled = PyObject_IsTrue(arg);
+    if (enabled < 0) {
+        goto exit;
+    }
+    return_value = _imp__use_frozen_stdlib_impl(module, enabled);
+
+exit:
+    return return_value;
+}
+
 #if defined(HAVE_DYNAMIC_LOADING)
 
 PyDoc_STRVAR(_imp_create_dynamic__doc__,
@@ -437,4 +518,4 @@ exit:
 #ifndef _IMP_EXEC_DYNAMIC_METHODDEF
     #define _IMP_EXEC_DYNAMIC_METHODDEF
 #endif /* !defined(_IMP_EXEC_DYNAMIC_METHODDEF) */
-/*[clinic end generated code: output=2409b8feeafe7c4b input=a9049054013a1b77]*/
+/*[clinic end generated code: output=9034e7a9909e682d input=a9049054013a1b77]*/
@@ -128,34 +128,41 @@ exit:
 }
 
 PyDoc_STRVAR(marshal_loads__doc__,
-"loads($module, bytes, /)\n"
+"loads($module, bytes, /, *, lazy=False)\n"
 "--\n"
 "\n"
 "Convert the bytes-like object to a value.\n"
 "\n"
+"  lazy\n"
+"    Load code objects written with version 5 on first use.\n"
+"\n"
 "If no valid value is found, raise EOFError, ValueError or TypeError.  Extra\n"
-"bytes in the input are ignored.");
+"bytes in the input are ignored.\n"
+"\n"
+"With lazy=True, code objects nested in other code objects are only loaded\n"
+"from a read-only bytes-like object when they are first run or inspected,\n"
+"and keep it alive until then.  A mutable object is always loaded eagerly.");
 
 #define MARSHAL_LOADS_METHODDEF    \
-    {"loads", (PyCFunction)marshal_loads, METH_O, marshal_loads__doc__},
+    {"loads", (PyCFunction)(void(*)(void))marshal_loads, METH_FASTCALL|METH_KEYWORDS, marshal_loads__doc__},
 
 static PyObject *
-marshal_loads_impl(PyObject *module, Py_buffer *bytes);
+marshal_loads_impl(PyObject *module, Py_buffer *bytes, int lazy);
 
 static PyObject *
-marshal_loads(PyObject *module, PyObject *arg)
+marshal_loads(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
+    static const char * const _keywords[] = {"", "lazy", NULL};
+    static _PyArg_Parser _parser = {"y*|$p:loads", _keywords, 0};
     Py_buffer bytes = {NULL, NULL};
+    int lazy = 0;
 
-    if (PyObject_GetBuffer(arg, &bytes, PyBUF_SIMPLE) != 0) {
-        goto exit;
-    }
-    if (!PyBuffer_IsContiguous(&bytes, 'C')) {
-        _PyArg_BadArgument("loads", 0, "contiguous buffer", arg);
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, &_parser,
+        &bytes, &lazy)) {
         goto exit;
     }
-    return_value = marshal_loads_impl(module, &bytes);
+    return_value = marshal_loads_impl(module, &bytes, lazy);
 
 exit:
     /* Cleanup for bytes */
@@ -165,4 +172,4 @@ exit:
 
     return return_value;
 }
-/*[clinic end generated code: output=ae2bca1aa239e095 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=4231d5404b68ebb2 input=a9049054013a1b77]*/
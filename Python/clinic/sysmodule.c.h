@@ -351,6 +351,71 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(sys_setsortthreads__doc__,
+"setsortthreads($module, n, /)\n"
+"--\n"
+"\n"
+"Set the number of threads list.sort() may use.\n"
+"\n"
+"Very large lists of floats, small ints or latin-1 strings are then\n"
+"sorted by up to n threads, with the GIL released.  The default, 1,\n"
+"sorts in the calling thread only.");
+
+#define SYS_SETSORTTHREADS_METHODDEF    \
+    {"setsortthreads", (PyCFunction)sys_setsortthreads, METH_O, sys_setsortthreads__doc__},
+
+static PyObject *
+sys_setsortthreads_impl(PyObject *module, int n);
+
+static PyObject *
+sys_setsortthreads(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    int n;
+
+    if (PyFloat_Check(arg)) {
+        PyErr_SetString(PyExc_TypeError,
+                        "integer argument expected, got float" );
+        goto exit;
+    }
+    n = _PyLong_AsInt(arg);
+    if (n == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = sys_setsortthreads_impl(module, n);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(sys_getsortthreads__doc__,
+"getsortthreads($module, /)\n"
+"--\n"
+"\n"
+"Return the number of threads list.sort() may use; see sys.setsortthreads().");
+
+#define SYS_GETSORTTHREADS_METHODDEF    \
+    {"getsortthreads", (PyCFunction)sys_getsortthreads, METH_NOARGS, sys_getsortthreads__doc__},
+
+static int
+sys_getsortthreads_impl(PyObject *module);
+
+static PyObject *
+sys_getsortthreads(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+    int _return_value;
+
+    _return_value = sys_getsortthreads_impl(module);
+    if ((_return_value == -1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyLong_FromLong((long)_return_value);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(sys_setrecursionlimit__doc__,
 "setrecursionlimit($module, limit, /)\n"
 "--\n"
@@ -776,6 +841,38 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(sys__getsplitdictconversions__doc__,
+"_getsplitdictconversions($module, /)\n"
+"--\n"
+"\n"
+"Return the number of key-sharing dicts converted to regular dicts.\n"
+"\n"
+"Instance dicts share their keys with the other instances of the class.\n"
+"They are converted when a key which is not a string is inserted, or when\n"
+"a new key does not fit in the shared keys.");
+
+#define SYS__GETSPLITDICTCONVERSIONS_METHODDEF    \
+    {"_getsplitdictconversions", (PyCFunction)sys__getsplitdictconversions, METH_NOARGS, sys__getsplitdictconversions__doc__},
+
+static Py_ssize_t
+sys__getsplitdictconversions_impl(PyObject *module);
+
+static PyObject *
+sys__getsplitdictconversions(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+    Py_ssize_t _return_value;
+
+    _return_value = sys__getsplitdictconversions_impl(module);
+    if ((_return_value == -1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyLong_FromSsize_t(_return_value);
+
+exit:
+    return return_value;
+}
+
 #if defined(COUNT_ALLOCS)
 
 PyDoc_STRVAR(sys_getcounts__doc__,
@@ -1050,4 +1147,4 @@ sys_getandroidapilevel(PyObject *module, PyObject *Py_UNUSED(ignored))
 #ifndef SYS_GETANDROIDAPILEVEL_METHODDEF
     #define SYS_GETANDROIDAPILEVEL_METHODDEF
 #endif /* !defined(SYS_GETANDROIDAPILEVEL_METHODDEF) */
-/*[clinic end generated code: output=109787af3401cd27 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=1b7000bf2ec79644 input=a9049054013a1b77]*/
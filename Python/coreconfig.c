@@ -319,6 +319,7 @@ _PyCoreConfig_Clear(_PyCoreConfig *config)
     CLEAR(config->dll_path);
 #endif
     CLEAR(config->base_exec_prefix);
+    CLEAR(config->stdlib_dir);
 
     CLEAR(config->filesystem_encoding);
     CLEAR(config->filesystem_errors);
@@ -402,6 +403,7 @@ _PyCoreConfig_Copy(_PyCoreConfig *config, const _PyCoreConfig *config2)
     COPY_WSTR_ATTR(dll_path);
 #endif
     COPY_WSTR_ATTR(base_exec_prefix);
+    COPY_WSTR_ATTR(stdlib_dir);
 
     COPY_ATTR(isolated);
     COPY_ATTR(site_import);
@@ -1537,6 +1539,7 @@ _PyCoreConfig_AsDict(const _PyCoreConfig *config)
     SET_ITEM_WSTR(base_prefix);
     SET_ITEM_WSTR(exec_prefix);
     SET_ITEM_WSTR(base_exec_prefix);
+    SET_ITEM_WSTR(stdlib_dir);
 #ifdef MS_WINDOWS
     SET_ITEM_WSTR(dll_path);
 #endif
@@ -0,0 +1,1777 @@
+/* Auto-generated by Programs/_freeze_importlib.c */
+const unsigned char _Py_M___collections_abc[] = {
+    99,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,
+    0,64,0,0,0,115,116,4,0,0,100,0,90,0,100,1,
+    100,2,108,1,109,2,90,2,109,3,90,3,1,0,100,1,
+    100,3,108,4,90,4,100,4,100,5,100,6,100,7,100,8,
+    100,9,100,10,100,11,100,12,100,13,100,14,100,15,100,16,
+    100,17,100,18,100,19,100,20,100,21,100,22,100,23,100,24,
+    100,25,100,26,100,27,100,28,103,25,90,5,100,29,90,6,
+    101,7,101,8,100,30,131,1,131,1,90,9,101,7,101,8,
+    101,10,131,0,131,1,131,1,90,11,101,7,101,8,105,0,
+    160,12,161,0,131,1,131,1,90,13,101,7,101,8,105,0,
+    160,14,161,0,131,1,131,1,90,15,101,7,101,8,105,0,
+    160,16,161,0,131,1,131,1,90,17,101,7,101,8,103,0,
+    131,1,131,1,90,18,101,7,101,8,101,19,103,0,131,1,
+    131,1,131,1,90,20,101,7,101,8,101,21,100,1,131,1,
+    131,1,131,1,90,22,101,7,101,8,101,21,100,31,100,32,
+    62,0,131,1,131,1,131,1,90,23,101,7,101,8,101,24,
+    131,0,131,1,131,1,90,25,101,7,101,8,100,33,131,1,
+    131,1,90,26,101,7,101,8,100,34,131,1,131,1,90,27,
+    101,7,101,8,101,28,131,0,131,1,131,1,90,29,101,7,
+    105,0,160,12,161,0,131,1,90,30,101,7,105,0,160,14,
+    161,0,131,1,90,31,101,7,105,0,160,16,161,0,131,1,
+    90,32,101,7,101,7,106,33,131,1,90,34,101,7,100,35,
+    100,36,132,0,131,0,131,1,90,35,100,37,100,38,132,0,
+    90,36,101,36,131,0,90,36,101,7,101,36,131,1,90,37,
+    101,36,160,38,161,0,1,0,91,36,100,39,100,40,132,0,
+    90,39,101,39,131,0,90,39,101,7,101,39,131,1,90,40,
+    91,39,100,41,100,42,132,0,90,41,71,0,100,43,100,9,
+    132,0,100,9,101,2,100,44,141,3,90,42,71,0,100,45,
+    100,4,132,0,100,4,101,2,100,44,141,3,90,43,71,0,
+    100,46,100,5,132,0,100,5,101,43,131,3,90,44,101,44,
+    160,45,101,37,161,1,1,0,71,0,100,47,100,6,132,0,
+    100,6,101,2,100,44,141,3,90,46,71,0,100,48,100,7,
+    132,0,100,7,101,46,131,3,90,47,71,0,100,49,100,8,
+    132,0,100,8,101,47,131,3,90,48,101,48,160,45,101,40,
+    161,1,1,0,71,0,100,50,100,10,132,0,100,10,101,2,
+    100,44,141,3,90,49,71,0,100,51,100,11,132,0,100,11,
+    101,49,131,3,90,50,101,50,160,45,101,9,161,1,1,0,
+    101,50,160,45,101,11,161,1,1,0,101,50,160,45,101,13,
+    161,1,1,0,101,50,160,45,101,15,161,1,1,0,101,50,
+    160,45,101,17,161,1,1,0,101,50,160,45,101,18,161,1,
+    1,0,101,50,160,45,101,20,161,1,1,0,101,50,160,45,
+    101,22,161,1,1,0,101,50,160,45,101,23,161,1,1,0,
+    101,50,160,45,101,25,161,1,1,0,101,50,160,45,101,26,
+    161,1,1,0,101,50,160,45,101,27,161,1,1,0,101,50,
+    160,45,101,29,161,1,1,0,71,0,100,52,100,13,132,0,
+    100,13,101,49,131,3,90,51,71,0,100,53,100,12,132,0,
+    100,12,101,50,131,3,90,52,101,52,160,45,101,35,161,1,
+    1,0,71,0,100,54,100,14,132,0,100,14,101,2,100,44,
+    141,3,90,53,71,0,100,55,100,15,132,0,100,15,101,2,
+    100,44,141,3,90,54,71,0,100,56,100,17,132,0,100,17,
+    101,53,101,49,101,54,131,5,90,55,71,0,100,57,100,16,
+    132,0,100,16,101,2,100,44,141,3,90,56,71,0,100,58,
+    100,18,132,0,100,18,101,55,131,3,90,57,101,57,160,45,
+    101,58,161,1,1,0,71,0,100,59,100,19,132,0,100,19,
+    101,57,131,3,90,59,101,59,160,45,101,24,161,1,1,0,
+    71,0,100,60,100,20,132,0,100,20,101,55,131,3,90,60,
+    101,60,160,45,101,34,161,1,1,0,71,0,100,61,100,22,
+    132,0,100,22,101,53,131,3,90,61,71,0,100,62,100,23,
+    132,0,100,23,101,61,101,57,131,4,90,62,101,62,160,45,
+    101,30,161,1,1,0,71,0,100,63,100,24,132,0,100,24,
+    101,61,101,57,131,4,90,63,101,63,160,45,101,32,161,1,
+    1,0,71,0,100,64,100,25,132,0,100,25,101,61,101,55,
+    131,4,90,64,101,64,160,45,101,31,161,1,1,0,71,0,
+    100,65,100,21,132,0,100,21,101,60,131,3,90,65,101,65,
+    160,45,101,66,161,1,1,0,71,0,100,66,100,26,132,0,
+    100,26,101,51,101,55,131,4,90,67,101,67,160,45,101,68,
+    161,1,1,0,101,67,160,45,101,69,161,1,1,0,101,67,
+    160,45,101,21,161,1,1,0,101,67,160,45,101,70,161,1,
+    1,0,71,0,100,67,100,28,132,0,100,28,101,67,131,3,
+    90,71,101,71,160,45,101,72,161,1,1,0,101,71,160,45,
+    101,10,161,1,1,0,71,0,100,68,100,27,132,0,100,27,
+    101,67,131,3,90,73,101,73,160,45,101,74,161,1,1,0,
+    101,73,160,45,101,10,161,1,1,0,100,3,83,0,41,69,
+    122,106,65,98,115,116,114,97,99,116,32,66,97,115,101,32,
+    67,108,97,115,115,101,115,32,40,65,66,67,115,41,32,102,
+    111,114,32,99,111,108,108,101,99,116,105,111,110,115,44,32,
+    97,99,99,111,114,100,105,110,103,32,116,111,32,80,69,80,
+    32,51,49,49,57,46,10,10,85,110,105,116,32,116,101,115,
+    116,115,32,97,114,101,32,105,110,32,116,101,115,116,95,99,
+    111,108,108,101,99,116,105,111,110,115,46,10,233,0,0,0,
+    0,41,2,218,7,65,66,67,77,101,116,97,218,14,97,98,
+    115,116,114,97,99,116,109,101,116,104,111,100,78,218,9,65,
+    119,97,105,116,97,98,108,101,218,9,67,111,114,111,117,116,
+    105,110,101,218,13,65,115,121,110,99,73,116,101,114,97,98,
+    108,101,218,13,65,115,121,110,99,73,116,101,114,97,116,111,
+    114,218,14,65,115,121,110,99,71,101,110,101,114,97,116,111,
+    114,218,8,72,97,115,104,97,98,108,101,218,8,73,116,101,
+    114,97,98,108,101,218,8,73,116,101,114,97,116,111,114,218,
+    9,71,101,110,101,114,97,116,111,114,218,10,82,101,118,101,
+    114,115,105,98,108,101,218,5,83,105,122,101,100,218,9,67,
+    111,110,116,97,105,110,101,114,218,8,67,97,108,108,97,98,
+    108,101,218,10,67,111,108,108,101,99,116,105,111,110,218,3,
+    83,101,116,218,10,77,117,116,97,98,108,101,83,101,116,218,
+    7,77,97,112,112,105,110,103,218,14,77,117,116,97,98,108,
+    101,77,97,112,112,105,110,103,218,11,77,97,112,112,105,110,
+    103,86,105,101,119,218,8,75,101,121,115,86,105,101,119,218,
+    9,73,116,101,109,115,86,105,101,119,218,10,86,97,108,117,
+    101,115,86,105,101,119,218,8,83,101,113,117,101,110,99,101,
+    218,15,77,117,116,97,98,108,101,83,101,113,117,101,110,99,
+    101,218,10,66,121,116,101,83,116,114,105,110,103,122,15,99,
+    111,108,108,101,99,116,105,111,110,115,46,97,98,99,243,0,
+    0,0,0,233,1,0,0,0,105,232,3,0,0,218,0,169,
+    0,99,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+    0,0,99,0,0,0,115,6,0,0,0,100,0,86,0,83,
+    0,169,1,78,114,31,0,0,0,114,31,0,0,0,114,31,
+    0,0,0,114,31,0,0,0,250,25,60,102,114,111,122,101,
+    110,32,95,99,111,108,108,101,99,116,105,111,110,115,95,97,
+    98,99,62,218,8,60,108,97,109,98,100,97,62,56,0,0,
+    0,114,28,0,0,0,114,34,0,0,0,99,0,0,0,0,
+    0,0,0,0,0,0,0,0,1,0,0,0,195,0,0,0,
+    115,4,0,0,0,100,0,83,0,114,32,0,0,0,114,31,
+    0,0,0,114,31,0,0,0,114,31,0,0,0,114,31,0,
+    0,0,114,33,0,0,0,218,5,95,99,111,114,111,58,0,
+    0,0,114,28,0,0,0,114,35,0,0,0,99,0,0,0,
+    0,0,0,0,0,0,0,0,0,1,0,0,0,67,2,0,
+    0,115,10,0,0,0,100,0,86,0,1,0,100,0,83,0,
+    114,32,0,0,0,114,31,0,0,0,114,31,0,0,0,114,
+    31,0,0,0,114,31,0,0,0,114,33,0,0,0,218,3,
+    95,97,103,64,0,0,0,114,28,0,0,0,114,36,0,0,
+    0,99,1,0,0,0,0,0,0,0,5,0,0,0,4,0,
+    0,0,71,0,0,0,115,78,0,0,0,124,0,106,0,125,
+    2,124,1,68,0,93,62,125,3,124,2,68,0,93,44,125,
+    4,124,3,124,4,106,1,107,6,114,18,124,4,106,1,124,
+    3,25,0,100,0,107,8,114,58,116,2,2,0,1,0,2,
+    0,1,0,83,0,1,0,113,10,113,18,116,2,2,0,1,
+    0,83,0,113,10,100,1,83,0,41,2,78,84,41,3,218,
+    7,95,95,109,114,111,95,95,218,8,95,95,100,105,99,116,
+    95,95,218,14,78,111,116,73,109,112,108,101,109,101,110,116,
+    101,100,41,5,218,1,67,90,7,109,101,116,104,111,100,115,
+    218,3,109,114,111,90,6,109,101,116,104,111,100,218,1,66,
+    114,31,0,0,0,114,31,0,0,0,114,33,0,0,0,218,
+    14,95,99,104,101,99,107,95,109,101,116,104,111,100,115,72,
+    0,0,0,115,18,0,0,0,0,1,6,1,8,1,8,1,
+    10,1,14,1,12,1,6,2,10,1,114,43,0,0,0,99,
+    0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,
+    64,0,0,0,115,40,0,0,0,101,0,90,1,100,0,90,
+    2,100,1,90,3,101,4,100,2,100,3,132,0,131,1,90,
+    5,101,6,100,4,100,5,132,0,131,1,90,7,100,6,83,
+    0,41,7,114,8,0,0,0,114,31,0,0,0,99,1,0,
+    0,0,0,0,0,0,1,0,0,0,1,0,0,0,67,0,
+    0,0,115,4,0,0,0,100,1,83,0,169,2,78,114,0,
+    0,0,0,114,31,0,0,0,169,1,218,4,115,101,108,102,
+    114,31,0,0,0,114,31,0,0,0,114,33,0,0,0,218,
+    8,95,95,104,97,115,104,95,95,88,0,0,0,115,2,0,
+    0,0,0,2,122,17,72,97,115,104,97,98,108,101,46,95,
+    95,104,97,115,104,95,95,99,2,0,0,0,0,0,0,0,
+    2,0,0,0,3,0,0,0,67,0,0,0,115,22,0,0,
+    0,124,0,116,0,107,8,114,18,116,1,124,1,100,1,131,
+    2,83,0,116,2,83,0,41,2,78,114,47,0,0,0,41,
+    3,114,8,0,0,0,114,43,0,0,0,114,39,0,0,0,
+    169,2,218,3,99,108,115,114,40,0,0,0,114,31,0,0,
+    0,114,31,0,0,0,114,33,0,0,0,218,16,95,95,115,
+    117,98,99,108,97,115,115,104,111,111,107,95,95,92,0,0,
+    0,115,6,0,0,0,0,2,8,1,10,1,122,25,72,97,
+    115,104,97,98,108,101,46,95,95,115,117,98,99,108,97,115,
+    115,104,111,111,107,95,95,78,41,8,218,8,95,95,110,97,
+    109,101,95,95,218,10,95,95,109,111,100,117,108,101,95,95,
+    218,12,95,95,113,117,97,108,110,97,109,101,95,95,218,9,
+    95,95,115,108,111,116,115,95,95,114,2,0,0,0,114,47,
+    0,0,0,218,11,99,108,97,115,115,109,101,116,104,111,100,
+    114,50,0,0,0,114,31,0,0,0,114,31,0,0,0,114,
+    31,0,0,0,114,33,0,0,0,114,8,0,0,0,84,0,
+    0,0,115,10,0,0,0,8,2,4,2,2,1,10,3,2,
+    1,41,1,90,9,109,101,116,97,99,108,97,115,115,99,0,
+    0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,64,
+    0,0,0,115,40,0,0,0,101,0,90,1,100,0,90,2,
+    100,1,90,3,101,4,100,2,100,3,132,0,131,1,90,5,
+    101,6,100,4,100,5,132,0,131,1,90,7,100,6,83,0,
+    41,7,114,3,0,0,0,114,31,0,0,0,99,1,0,0,
+    0,0,0,0,0,1,0,0,0,1,0,0,0,99,0,0,
+    0,115,10,0,0,0,100,0,86,0,1,0,100,0,83,0,
+    114,32,0,0,0,114,31,0,0,0,114,45,0,0,0,114,
+    31,0,0,0,114,31,0,0,0,114,33,0,0,0,218,9,
+    95,95,97,119,97,105,116,95,95,103,0,0,0,115,2,0,
+    0,0,0,2,122,19,65,119,97,105,116,97,98,108,101,46,
+    95,95,97,119,97,105,116,95,95,99,2,0,0,0,0,0,
+    0,0,2,0,0,0,3,0,0,0,67,0,0,0,115,22,
+    0,0,0,124,0,116,0,107,8,114,18,116,1,124,1,100,
+    1,131,2,83,0,116,2,83,0,41,2,78,114,56,0,0,
+    0,41,3,114,3,0,0,0,114,43,0,0,0,114,39,0,
+    0,0,114,48,0,0,0,114,31,0,0,0,114,31,0,0,
+    0,114,33,0,0,0,114,50,0,0,0,107,0,0,0,115,
+    6,0,0,0,0,2,8,1,10,1,122,26,65,119,97,105,
+    116,97,98,108,101,46,95,95,115,117,98,99,108,97,115,115,
+    104,111,111,107,95,95,78,41,8,114,51,0,0,0,114,52,
+    0,0,0,114,53,0,0,0,114,54,0,0,0,114,2,0,
+    0,0,114,56,0,0,0,114,55,0,0,0,114,50,0,0,
+    0,114,31,0,0,0,114,31,0,0,0,114,31,0,0,0,
+    114,33,0,0,0,114,3,0,0,0,99,0,0,0,115,10,
+    0,0,0,8,2,4,2,2,1,10,3,2,1,99,0,0,
+    0,0,0,0,0,0,0,0,0,0,4,0,0,0,64,0,
+    0,0,115,62,0,0,0,101,0,90,1,100,0,90,2,100,
+    1,90,3,101,4,100,2,100,3,132,0,131,1,90,5,101,
+    4,100,11,100,5,100,6,132,1,131,1,90,6,100,7,100,
+    8,132,0,90,7,101,8,100,9,100,10,132,0,131,1,90,
+    9,100,4,83,0,41,12,114,4,0,0,0,114,31,0,0,
+    0,99,2,0,0,0,0,0,0,0,2,0,0,0,1,0,
+    0,0,67,0,0,0,115,8,0,0,0,116,0,130,1,100,
+    1,83,0,41,2,122,99,83,101,110,100,32,97,32,118,97,
+    108,117,101,32,105,110,116,111,32,116,104,101,32,99,111,114,
+    111,117,116,105,110,101,46,10,32,32,32,32,32,32,32,32,
+    82,101,116,117,114,110,32,110,101,120,116,32,121,105,101,108,
+    100,101,100,32,118,97,108,117,101,32,111,114,32,114,97,105,
+    115,101,32,83,116,111,112,73,116,101,114,97,116,105,111,110,
+    46,10,32,32,32,32,32,32,32,32,78,169,1,218,13,83,
+    116,111,112,73,116,101,114,97,116,105,111,110,169,2,114,46,
+    0,0,0,218,5,118,97,108,117,101,114,31,0,0,0,114,
+    31,0,0,0,114,33,0,0,0,218,4,115,101,110,100,118,
+    0,0,0,115,2,0,0,0,0,5,122,14,67,111,114,111,
+    117,116,105,110,101,46,115,101,110,100,78,99,4,0,0,0,
+    0,0,0,0,4,0,0,0,3,0,0,0,67,0,0,0,
+    115,52,0,0,0,124,2,100,1,107,8,114,26,124,3,100,
+    1,107,8,114,20,124,1,130,1,124,1,131,0,125,2,124,
+    3,100,1,107,9,114,44,124,2,160,0,124,3,161,1,125,
+    2,124,2,130,1,100,1,83,0,41,2,122,103,82,97,105,
+    115,101,32,97,110,32,101,120,99,101,112,116,105,111,110,32,
+    105,110,32,116,104,101,32,99,111,114,111,117,116,105,110,101,
+    46,10,32,32,32,32,32,32,32,32,82,101,116,117,114,110,
+    32,110,101,120,116,32,121,105,101,108,100,101,100,32,118,97,
+    108,117,101,32,111,114,32,114,97,105,115,101,32,83,116,111,
+    112,73,116,101,114,97,116,105,111,110,46,10,32,32,32,32,
+    32,32,32,32,78,169,1,218,14,119,105,116,104,95,116,114,
+    97,99,101,98,97,99,107,169,4,114,46,0,0,0,90,3,
+    116,121,112,90,3,118,97,108,90,2,116,98,114,31,0,0,
+    0,114,31,0,0,0,114,33,0,0,0,218,5,116,104,114,
+    111,119,125,0,0,0,115,14,0,0,0,0,5,8,1,8,
+    1,4,1,6,1,8,1,10,1,122,15,67,111,114,111,117,
+    116,105,110,101,46,116,104,114,111,119,99,1,0,0,0,0,
+    0,0,0,1,0,0,0,9,0,0,0,67,0,0,0,115,
+    52,0,0,0,122,14,124,0,160,0,116,1,161,1,1,0,
+    87,0,110,24,4,0,116,1,116,2,102,2,107,10,114,38,
+    1,0,1,0,1,0,89,0,110,10,88,0,116,3,100,1,
+    131,1,130,1,100,2,83,0,41,3,250,46,82,97,105,115,
+    101,32,71,101,110,101,114,97,116,111,114,69,120,105,116,32,
+    105,110,115,105,100,101,32,99,111,114,111,117,116,105,110,101,
+    46,10,32,32,32,32,32,32,32,32,122,31,99,111,114,111,
+    117,116,105,110,101,32,105,103,110,111,114,101,100,32,71,101,
+    110,101,114,97,116,111,114,69,120,105,116,78,169,4,114,65,
+    0,0,0,218,13,71,101,110,101,114,97,116,111,114,69,120,
+    105,116,114,58,0,0,0,218,12,82,117,110,116,105,109,101,
+    69,114,114,111,114,114,45,0,0,0,114,31,0,0,0,114,
+    31,0,0,0,114,33,0,0,0,218,5,99,108,111,115,101,
+    138,0,0,0,115,10,0,0,0,0,3,2,1,14,1,18,
+    1,6,2,122,15,67,111,114,111,117,116,105,110,101,46,99,
+    108,111,115,101,99,2,0,0,0,0,0,0,0,2,0,0,
+    0,6,0,0,0,67,0,0,0,115,28,0,0,0,124,0,
+    116,0,107,8,114,24,116,1,124,1,100,1,100,2,100,3,
+    100,4,131,5,83,0,116,2,83,0,41,5,78,114,56,0,
+    0,0,114,61,0,0,0,114,65,0,0,0,114,70,0,0,
+    0,41,3,114,4,0,0,0,114,43,0,0,0,114,39,0,
+    0,0,114,48,0,0,0,114,31,0,0,0,114,31,0,0,
+    0,114,33,0,0,0,114,50,0,0,0,148,0,0,0,115,
+    6,0,0,0,0,2,8,1,16,1,122,26,67,111,114,111,
+    117,116,105,110,101,46,95,95,115,117,98,99,108,97,115,115,
+    104,111,111,107,95,95,41,2,78,78,41,10,114,51,0,0,
+    0,114,52,0,0,0,114,53,0,0,0,114,54,0,0,0,
+    114,2,0,0,0,114,61,0,0,0,114,65,0,0,0,114,
+    70,0,0,0,114,55,0,0,0,114,50,0,0,0,114,31,
+    0,0,0,114,31,0,0,0,114,31,0,0,0,114,33,0,
+    0,0,114,4,0,0,0,114,0,0,0,115,16,0,0,0,
+    8,2,4,2,2,1,10,6,2,1,12,12,8,10,2,1,
+    99,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,
+    0,64,0,0,0,115,40,0,0,0,101,0,90,1,100,0,
+    90,2,100,1,90,3,101,4,100,2,100,3,132,0,131,1,
+    90,5,101,6,100,4,100,5,132,0,131,1,90,7,100,6,
+    83,0,41,7,114,5,0,0,0,114,31,0,0,0,99,1,
+    0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,67,
+    0,0,0,115,6,0,0,0,116,0,131,0,83,0,114,32,
+    0,0,0,41,1,114,6,0,0,0,114,45,0,0,0,114,
+    31,0,0,0,114,31,0,0,0,114,33,0,0,0,218,9,
+    95,95,97,105,116,101,114,95,95,162,0,0,0,115,2,0,
+    0,0,0,2,122,23,65,115,121,110,99,73,116,101,114,97,
+    98,108,101,46,95,95,97,105,116,101,114,95,95,99,2,0,
+    0,0,0,0,0,0,2,0,0,0,3,0,0,0,67,0,
+    0,0,115,22,0,0,0,124,0,116,0,107,8,114,18,116,
+    1,124,1,100,1,131,2,83,0,116,2,83,0,41,2,78,
+    114,71,0,0,0,41,3,114,5,0,0,0,114,43,0,0,
+    0,114,39,0,0,0,114,48,0,0,0,114,31,0,0,0,
+    114,31,0,0,0,114,33,0,0,0,114,50,0,0,0,166,
+    0,0,0,115,6,0,0,0,0,2,8,1,10,1,122,30,
+    65,115,121,110,99,73,116,101,114,97,98,108,101,46,95,95,
+    115,117,98,99,108,97,115,115,104,111,111,107,95,95,78,41,
+    8,114,51,0,0,0,114,52,0,0,0,114,53,0,0,0,
+    114,54,0,0,0,114,2,0,0,0,114,71,0,0,0,114,
+    55,0,0,0,114,50,0,0,0,114,31,0,0,0,114,31,
+    0,0,0,114,31,0,0,0,114,33,0,0,0,114,5,0,
+    0,0,158,0,0,0,115,10,0,0,0,8,2,4,2,2,
+    1,10,3,2,1,99,0,0,0,0,0,0,0,0,0,0,
+    0,0,3,0,0,0,64,0,0,0,115,48,0,0,0,101,
+    0,90,1,100,0,90,2,100,1,90,3,101,4,100,2,100,
+    3,132,0,131,1,90,5,100,4,100,5,132,0,90,6,101,
+    7,100,6,100,7,132,0,131,1,90,8,100,8,83,0,41,
+    9,114,6,0,0,0,114,31,0,0,0,99,1,0,0,0,
+    0,0,0,0,1,0,0,0,1,0,0,0,195,0,0,0,
+    115,8,0,0,0,116,0,130,1,100,1,83,0,41,2,122,
+    64,82,101,116,117,114,110,32,116,104,101,32,110,101,120,116,
+    32,105,116,101,109,32,111,114,32,114,97,105,115,101,32,83,
+    116,111,112,65,115,121,110,99,73,116,101,114,97,116,105,111,
+    110,32,119,104,101,110,32,101,120,104,97,117,115,116,101,100,
+    46,78,169,1,218,18,83,116,111,112,65,115,121,110,99,73,
+    116,101,114,97,116,105,111,110,114,45,0,0,0,114,31,0,
+    0,0,114,31,0,0,0,114,33,0,0,0,218,9,95,95,
+    97,110,101,120,116,95,95,177,0,0,0,115,2,0,0,0,
+    0,3,122,23,65,115,121,110,99,73,116,101,114,97,116,111,
+    114,46,95,95,97,110,101,120,116,95,95,99,1,0,0,0,
+    0,0,0,0,1,0,0,0,1,0,0,0,67,0,0,0,
+    115,4,0,0,0,124,0,83,0,114,32,0,0,0,114,31,
+    0,0,0,114,45,0,0,0,114,31,0,0,0,114,31,0,
+    0,0,114,33,0,0,0,114,71,0,0,0,182,0,0,0,
+    115,2,0,0,0,0,1,122,23,65,115,121,110,99,73,116,
+    101,114,97,116,111,114,46,95,95,97,105,116,101,114,95,95,
+    99,2,0,0,0,0,0,0,0,2,0,0,0,4,0,0,
+    0,67,0,0,0,115,24,0,0,0,124,0,116,0,107,8,
+    114,20,116,1,124,1,100,1,100,2,131,3,83,0,116,2,
+    83,0,41,3,78,114,74,0,0,0,114,71,0,0,0,41,
+    3,114,6,0,0,0,114,43,0,0,0,114,39,0,0,0,
+    114,48,0,0,0,114,31,0,0,0,114,31,0,0,0,114,
+    33,0,0,0,114,50,0,0,0,185,0,0,0,115,6,0,
+    0,0,0,2,8,1,12,1,122,30,65,115,121,110,99,73,
+    116,101,114,97,116,111,114,46,95,95,115,117,98,99,108,97,
+    115,115,104,111,111,107,95,95,78,41,9,114,51,0,0,0,
+    114,52,0,0,0,114,53,0,0,0,114,54,0,0,0,114,
+    2,0,0,0,114,74,0,0,0,114,71,0,0,0,114,55,
+    0,0,0,114,50,0,0,0,114,31,0,0,0,114,31,0,
+    0,0,114,31,0,0,0,114,33,0,0,0,114,6,0,0,
+    0,173,0,0,0,115,12,0,0,0,8,2,4,2,2,1,
+    10,4,8,3,2,1,99,0,0,0,0,0,0,0,0,0,
+    0,0,0,4,0,0,0,64,0,0,0,115,70,0,0,0,
+    101,0,90,1,100,0,90,2,100,1,90,3,100,2,100,3,
+    132,0,90,4,101,5,100,4,100,5,132,0,131,1,90,6,
+    101,5,100,13,100,7,100,8,132,1,131,1,90,7,100,9,
+    100,10,132,0,90,8,101,9,100,11,100,12,132,0,131,1,
+    90,10,100,6,83,0,41,14,114,7,0,0,0,114,31,0,
+    0,0,99,1,0,0,0,0,0,0,0,1,0,0,0,3,
+    0,0,0,195,0,0,0,115,16,0,0,0,124,0,160,0,
+    100,1,161,1,73,0,100,1,72,0,83,0,41,2,122,112,
+    82,101,116,117,114,110,32,116,104,101,32,110,101,120,116,32,
+    105,116,101,109,32,102,114,111,109,32,116,104,101,32,97,115,
+    121,110,99,104,114,111,110,111,117,115,32,103,101,110,101,114,
+    97,116,111,114,46,10,32,32,32,32,32,32,32,32,87,104,
+    101,110,32,101,120,104,97,117,115,116,101,100,44,32,114,97,
+    105,115,101,32,83,116,111,112,65,115,121,110,99,73,116,101,
+    114,97,116,105,111,110,46,10,32,32,32,32,32,32,32,32,
+    78,41,1,218,5,97,115,101,110,100,114,45,0,0,0,114,
+    31,0,0,0,114,31,0,0,0,114,33,0,0,0,114,74,
+    0,0,0,196,0,0,0,115,2,0,0,0,0,4,122,24,
+    65,115,121,110,99,71,101,110,101,114,97,116,111,114,46,95,
+    95,97,110,101,120,116,95,95,99,2,0,0,0,0,0,0,
+    0,2,0,0,0,1,0,0,0,195,0,0,0,115,8,0,
+    0,0,116,0,130,1,100,1,83,0,41,2,122,117,83,101,
+    110,100,32,97,32,118,97,108,117,101,32,105,110,116,111,32,
+    116,104,101,32,97,115,121,110,99,104,114,111,110,111,117,115,
+    32,103,101,110,101,114,97,116,111,114,46,10,32,32,32,32,
+    32,32,32,32,82,101,116,117,114,110,32,110,101,120,116,32,
+    121,105,101,108,100,101,100,32,118,97,108,117,101,32,111,114,
+    32,114,97,105,115,101,32,83,116,111,112,65,115,121,110,99,
+    73,116,101,114,97,116,105,111,110,46,10,32,32,32,32,32,
+    32,32,32,78,114,72,0,0,0,114,59,0,0,0,114,31,
+    0,0,0,114,31,0,0,0,114,33,0,0,0,114,75,0,
+    0,0,202,0,0,0,115,2,0,0,0,0,5,122,20,65,
+    115,121,110,99,71,101,110,101,114,97,116,111,114,46,97,115,
+    101,110,100,78,99,4,0,0,0,0,0,0,0,4,0,0,
+    0,3,0,0,0,195,0,0,0,115,52,0,0,0,124,2,
+    100,1,107,8,114,26,124,3,100,1,107,8,114,20,124,1,
+    130,1,124,1,131,0,125,2,124,3,100,1,107,9,114,44,
+    124,2,160,0,124,3,161,1,125,2,124,2,130,1,100,1,
+    83,0,41,2,122,121,82,97,105,115,101,32,97,110,32,101,
+    120,99,101,112,116,105,111,110,32,105,110,32,116,104,101,32,
+    97,115,121,110,99,104,114,111,110,111,117,115,32,103,101,110,
+    101,114,97,116,111,114,46,10,32,32,32,32,32,32,32,32,
+    82,101,116,117,114,110,32,110,101,120,116,32,121,105,101,108,
+    100,101,100,32,118,97,108,117,101,32,111,114,32,114,97,105,
+    115,101,32,83,116,111,112,65,115,121,110,99,73,116,101,114,
+    97,116,105,111,110,46,10,32,32,32,32,32,32,32,32,78,
+    114,62,0,0,0,114,64,0,0,0,114,31,0,0,0,114,
+    31,0,0,0,114,33,0,0,0,218,6,97,116,104,114,111,
+    119,209,0,0,0,115,14,0,0,0,0,5,8,1,8,1,
+    4,1,6,1,8,1,10,1,122,21,65,115,121,110,99,71,
+    101,110,101,114,97,116,111,114,46,97,116,104,114,111,119,99,
+    1,0,0,0,0,0,0,0,1,0,0,0,9,0,0,0,
+    195,0,0,0,115,58,0,0,0,122,20,124,0,160,0,116,
+    1,161,1,73,0,100,1,72,0,1,0,87,0,110,24,4,
+    0,116,1,116,2,102,2,107,10,114,44,1,0,1,0,1,
+    0,89,0,110,10,88,0,116,3,100,2,131,1,130,1,100,
+    1,83,0,41,3,114,66,0,0,0,78,122,44,97,115,121,
+    110,99,104,114,111,110,111,117,115,32,103,101,110,101,114,97,
+    116,111,114,32,105,103,110,111,114,101,100,32,71,101,110,101,
+    114,97,116,111,114,69,120,105,116,41,4,114,76,0,0,0,
+    114,68,0,0,0,114,73,0,0,0,114,69,0,0,0,114,
+    45,0,0,0,114,31,0,0,0,114,31,0,0,0,114,33,
+    0,0,0,218,6,97,99,108,111,115,101,222,0,0,0,115,
+    10,0,0,0,0,3,2,1,20,1,18,1,6,2,122,21,
+    65,115,121,110,99,71,101,110,101,114,97,116,111,114,46,97,
+    99,108,111,115,101,99,2,0,0,0,0,0,0,0,2,0,
+    0,0,7,0,0,0,67,0,0,0,115,30,0,0,0,124,
+    0,116,0,107,8,114,26,116,1,124,1,100,1,100,2,100,
+    3,100,4,100,5,131,6,83,0,116,2,83,0,41,6,78,
+    114,71,0,0,0,114,74,0,0,0,114,75,0,0,0,114,
+    76,0,0,0,114,77,0,0,0,41,3,114,7,0,0,0,
+    114,43,0,0,0,114,39,0,0,0,114,48,0,0,0,114,
+    31,0,0,0,114,31,0,0,0,114,33,0,0,0,114,50,
+    0,0,0,232,0,0,0,115,14,0,0,0,0,2,8,1,
+    8,1,2,0,2,0,2,255,4,2,122,31,65,115,121,110,
+    99,71,101,110,101,114,97,116,111,114,46,95,95,115,117,98,
+    99,108,97,115,115,104,111,111,107,95,95,41,2,78,78,41,
+    11,114,51,0,0,0,114,52,0,0,0,114,53,0,0,0,
+    114,54,0,0,0,114,74,0,0,0,114,2,0,0,0,114,
+    75,0,0,0,114,76,0,0,0,114,77,0,0,0,114,55,
+    0,0,0,114,50,0,0,0,114,31,0,0,0,114,31,0,
+    0,0,114,31,0,0,0,114,33,0,0,0,114,7,0,0,
+    0,192,0,0,0,115,18,0,0,0,8,2,4,2,8,6,
+    2,1,10,6,2,1,12,12,8,10,2,1,99,0,0,0,
+    0,0,0,0,0,0,0,0,0,3,0,0,0,64,0,0,
+    0,115,40,0,0,0,101,0,90,1,100,0,90,2,100,1,
+    90,3,101,4,100,2,100,3,132,0,131,1,90,5,101,6,
+    100,4,100,5,132,0,131,1,90,7,100,6,83,0,41,7,
+    114,9,0,0,0,114,31,0,0,0,99,1,0,0,0,0,
+    0,0,0,1,0,0,0,1,0,0,0,99,0,0,0,115,
+    4,0,0,0,100,0,83,0,114,32,0,0,0,114,31,0,
+    0,0,114,45,0,0,0,114,31,0,0,0,114,31,0,0,
+    0,114,33,0,0,0,218,8,95,95,105,116,101,114,95,95,
+    247,0,0,0,115,2,0,0,0,0,2,122,17,73,116,101,
+    114,97,98,108,101,46,95,95,105,116,101,114,95,95,99,2,
+    0,0,0,0,0,0,0,2,0,0,0,3,0,0,0,67,
+    0,0,0,115,22,0,0,0,124,0,116,0,107,8,114,18,
+    116,1,124,1,100,1,131,2,83,0,116,2,83,0,41,2,
+    78,114,78,0,0,0,41,3,114,9,0,0,0,114,43,0,
+    0,0,114,39,0,0,0,114,48,0,0,0,114,31,0,0,
+    0,114,31,0,0,0,114,33,0,0,0,114,50,0,0,0,
+    252,0,0,0,115,6,0,0,0,0,2,8,1,10,1,122,
+    25,73,116,101,114,97,98,108,101,46,95,95,115,117,98,99,
+    108,97,115,115,104,111,111,107,95,95,78,41,8,114,51,0,
+    0,0,114,52,0,0,0,114,53,0,0,0,114,54,0,0,
+    0,114,2,0,0,0,114,78,0,0,0,114,55,0,0,0,
+    114,50,0,0,0,114,31,0,0,0,114,31,0,0,0,114,
+    31,0,0,0,114,33,0,0,0,114,9,0,0,0,243,0,
+    0,0,115,10,0,0,0,8,2,4,2,2,1,10,4,2,
+    1,99,0,0,0,0,0,0,0,0,0,0,0,0,3,0,
+    0,0,64,0,0,0,115,48,0,0,0,101,0,90,1,100,
+    0,90,2,100,1,90,3,101,4,100,2,100,3,132,0,131,
+    1,90,5,100,4,100,5,132,0,90,6,101,7,100,6,100,
+    7,132,0,131,1,90,8,100,8,83,0,41,9,114,10,0,
+    0,0,114,31,0,0,0,99,1,0,0,0,0,0,0,0,
+    1,0,0,0,1,0,0,0,67,0,0,0,115,8,0,0,
+    0,116,0,130,1,100,1,83,0,41,2,122,75,82,101,116,
+    117,114,110,32,116,104,101,32,110,101,120,116,32,105,116,101,
+    109,32,102,114,111,109,32,116,104,101,32,105,116,101,114,97,
+    116,111,114,46,32,87,104,101,110,32,101,120,104,97,117,115,
+    116,101,100,44,32,114,97,105,115,101,32,83,116,111,112,73,
+    116,101,114,97,116,105,111,110,78,114,57,0,0,0,114,45,
+    0,0,0,114,31,0,0,0,114,31,0,0,0,114,33,0,
+    0,0,218,8,95,95,110,101,120,116,95,95,7,1,0,0,
+    115,2,0,0,0,0,3,122,17,73,116,101,114,97,116,111,
+    114,46,95,95,110,101,120,116,95,95,99,1,0,0,0,0,
+    0,0,0,1,0,0,0,1,0,0,0,67,0,0,0,115,
+    4,0,0,0,124,0,83,0,114,32,0,0,0,114,31,0,
+    0,0,114,45,0,0,0,114,31,0,0,0,114,31,0,0,
+    0,114,33,0,0,0,114,78,0,0,0,12,1,0,0,115,
+    2,0,0,0,0,1,122,17,73,116,101,114,97,116,111,114,
+    46,95,95,105,116,101,114,95,95,99,2,0,0,0,0,0,
+    0,0,2,0,0,0,4,0,0,0,67,0,0,0,115,24,
+    0,0,0,124,0,116,0,107,8,114,20,116,1,124,1,100,
+    1,100,2,131,3,83,0,116,2,83,0,41,3,78,114,78,
+    0,0,0,114,79,0,0,0,41,3,114,10,0,0,0,114,
+    43,0,0,0,114,39,0,0,0,114,48,0,0,0,114,31,
+    0,0,0,114,31,0,0,0,114,33,0,0,0,114,50,0,
+    0,0,15,1,0,0,115,6,0,0,0,0,2,8,1,12,
+    1,122,25,73,116,101,114,97,116,111,114,46,95,95,115,117,
+    98,99,108,97,115,115,104,111,111,107,95,95,78,41,9,114,
+    51,0,0,0,114,52,0,0,0,114,53,0,0,0,114,54,
+    0,0,0,114,2,0,0,0,114,79,0,0,0,114,78,0,
+    0,0,114,55,0,0,0,114,50,0,0,0,114,31,0,0,
+    0,114,31,0,0,0,114,31,0,0,0,114,33,0,0,0,
+    114,10,0,0,0,3,1,0,0,115,12,0,0,0,8,2,
+    4,2,2,1,10,4,8,3,2,1,99,0,0,0,0,0,
+    0,0,0,0,0,0,0,3,0,0,0,64,0,0,0,115,
+    40,0,0,0,101,0,90,1,100,0,90,2,100,1,90,3,
+    101,4,100,2,100,3,132,0,131,1,90,5,101,6,100,4,
+    100,5,132,0,131,1,90,7,100,6,83,0,41,7,114,12,
+    0,0,0,114,31,0,0,0,99,1,0,0,0,0,0,0,
+    0,1,0,0,0,1,0,0,0,99,0,0,0,115,4,0,
+    0,0,100,0,83,0,114,32,0,0,0,114,31,0,0,0,
+    114,45,0,0,0,114,31,0,0,0,114,31,0,0,0,114,
+    33,0,0,0,218,12,95,95,114,101,118,101,114,115,101,100,
+    95,95,41,1,0,0,115,2,0,0,0,0,2,122,23,82,
+    101,118,101,114,115,105,98,108,101,46,95,95,114,101,118,101,
+    114,115,101,100,95,95,99,2,0,0,0,0,0,0,0,2,
+    0,0,0,4,0,0,0,67,0,0,0,115,24,0,0,0,
+    124,0,116,0,107,8,114,20,116,1,124,1,100,1,100,2,
+    131,3,83,0,116,2,83,0,41,3,78,114,80,0,0,0,
+    114,78,0,0,0,41,3,114,12,0,0,0,114,43,0,0,
+    0,114,39,0,0,0,114,48,0,0,0,114,31,0,0,0,
+    114,31,0,0,0,114,33,0,0,0,114,50,0,0,0,46,
+    1,0,0,115,6,0,0,0,0,2,8,1,12,1,122,27,
+    82,101,118,101,114,115,105,98,108,101,46,95,95,115,117,98,
+    99,108,97,115,115,104,111,111,107,95,95,78,41,8,114,51,
+    0,0,0,114,52,0,0,0,114,53,0,0,0,114,54,0,
+    0,0,114,2,0,0,0,114,80,0,0,0,114,55,0,0,
+    0,114,50,0,0,0,114,31,0,0,0,114,31,0,0,0,
+    114,31,0,0,0,114,33,0,0,0,114,12,0,0,0,37,
+    1,0,0,115,10,0,0,0,8,2,4,2,2,1,10,4,
+    2,1,99,0,0,0,0,0,0,0,0,0,0,0,0,4,
+    0,0,0,64,0,0,0,115,70,0,0,0,101,0,90,1,
+    100,0,90,2,100,1,90,3,100,2,100,3,132,0,90,4,
+    101,5,100,4,100,5,132,0,131,1,90,6,101,5,100,13,
+    100,7,100,8,132,1,131,1,90,7,100,9,100,10,132,0,
+    90,8,101,9,100,11,100,12,132,0,131,1,90,10,100,6,
+    83,0,41,14,114,11,0,0,0,114,31,0,0,0,99,1,
+    0,0,0,0,0,0,0,1,0,0,0,3,0,0,0,67,
+    0,0,0,115,10,0,0,0,124,0,160,0,100,1,161,1,
+    83,0,41,2,122,94,82,101,116,117,114,110,32,116,104,101,
+    32,110,101,120,116,32,105,116,101,109,32,102,114,111,109,32,
+    116,104,101,32,103,101,110,101,114,97,116,111,114,46,10,32,
+    32,32,32,32,32,32,32,87,104,101,110,32,101,120,104,97,
+    117,115,116,101,100,44,32,114,97,105,115,101,32,83,116,111,
+    112,73,116,101,114,97,116,105,111,110,46,10,32,32,32,32,
+    32,32,32,32,78,41,1,114,61,0,0,0,114,45,0,0,
+    0,114,31,0,0,0,114,31,0,0,0,114,33,0,0,0,
+    114,79,0,0,0,57,1,0,0,115,2,0,0,0,0,4,
+    122,18,71,101,110,101,114,97,116,111,114,46,95,95,110,101,
+    120,116,95,95,99,2,0,0,0,0,0,0,0,2,0,0,
+    0,1,0,0,0,67,0,0,0,115,8,0,0,0,116,0,
+    130,1,100,1,83,0,41,2,122,99,83,101,110,100,32,97,
+    32,118,97,108,117,101,32,105,110,116,111,32,116,104,101,32,
+    103,101,110,101,114,97,116,111,114,46,10,32,32,32,32,32,
+    32,32,32,82,101,116,117,114,110,32,110,101,120,116,32,121,
+    105,101,108,100,101,100,32,118,97,108,117,101,32,111,114,32,
+    114,97,105,115,101,32,83,116,111,112,73,116,101,114,97,116,
+    105,111,110,46,10,32,32,32,32,32,32,32,32,78,114,57,
+    0,0,0,114,59,0,0,0,114,31,0,0,0,114,31,0,
+    0,0,114,33,0,0,0,114,61,0,0,0,63,1,0,0,
+    115,2,0,0,0,0,5,122,14,71,101,110,101,114,97,116,
+    111,114,46,115,101,110,100,78,99,4,0,0,0,0,0,0,
+    0,4,0,0,0,3,0,0,0,67,0,0,0,115,52,0,
+    0,0,124,2,100,1,107,8,114,26,124,3,100,1,107,8,
+    114,20,124,1,130,1,124,1,131,0,125,2,124,3,100,1,
+    107,9,114,44,124,2,160,0,124,3,161,1,125,2,124,2,
+    130,1,100,1,83,0,41,2,122,103,82,97,105,115,101,32,
+    97,110,32,101,120,99,101,112,116,105,111,110,32,105,110,32,
+    116,104,101,32,103,101,110,101,114,97,116,111,114,46,10,32,
+    32,32,32,32,32,32,32,82,101,116,117,114,110,32,110,101,
+    120,116,32,121,105,101,108,100,101,100,32,118,97,108,117,101,
+    32,111,114,32,114,97,105,115,101,32,83,116,111,112,73,116,
+    101,114,97,116,105,111,110,46,10,32,32,32,32,32,32,32,
+    32,78,114,62,0,0,0,114,64,0,0,0,114,31,0,0,
+    0,114,31,0,0,0,114,33,0,0,0,114,65,0,0,0,
+    70,1,0,0,115,14,0,0,0,0,5,8,1,8,1,4,
+    1,6,1,8,1,10,1,122,15,71,101,110,101,114,97,116,
+    111,114,46,116,104,114,111,119,99,1,0,0,0,0,0,0,
+    0,1,0,0,0,9,0,0,0,67,0,0,0,115,52,0,
+    0,0,122,14,124,0,160,0,116,1,161,1,1,0,87,0,
+    110,24,4,0,116,1,116,2,102,2,107,10,114,38,1,0,
+    1,0,1,0,89,0,110,10,88,0,116,3,100,1,131,1,
+    130,1,100,2,83,0,41,3,122,46,82,97,105,115,101,32,
+    71,101,110,101,114,97,116,111,114,69,120,105,116,32,105,110,
+    115,105,100,101,32,103,101,110,101,114,97,116,111,114,46,10,
+    32,32,32,32,32,32,32,32,122,31,103,101,110,101,114,97,
+    116,111,114,32,105,103,110,111,114,101,100,32,71,101,110,101,
+    114,97,116,111,114,69,120,105,116,78,114,67,0,0,0,114,
+    45,0,0,0,114,31,0,0,0,114,31,0,0,0,114,33,
+    0,0,0,114,70,0,0,0,83,1,0,0,115,10,0,0,
+    0,0,3,2,1,14,1,18,1,6,2,122,15,71,101,110,
+    101,114,97,116,111,114,46,99,108,111,115,101,99,2,0,0,
+    0,0,0,0,0,2,0,0,0,7,0,0,0,67,0,0,
+    0,115,30,0,0,0,124,0,116,0,107,8,114,26,116,1,
+    124,1,100,1,100,2,100,3,100,4,100,5,131,6,83,0,
+    116,2,83,0,41,6,78,114,78,0,0,0,114,79,0,0,
+    0,114,61,0,0,0,114,65,0,0,0,114,70,0,0,0,
+    41,3,114,11,0,0,0,114,43,0,0,0,114,39,0,0,
+    0,114,48,0,0,0,114,31,0,0,0,114,31,0,0,0,
+    114,33,0,0,0,114,50,0,0,0,93,1,0,0,115,14,
+    0,0,0,0,2,8,1,8,1,2,0,2,0,2,255,4,
+    2,122,26,71,101,110,101,114,97,116,111,114,46,95,95,115,
+    117,98,99,108,97,115,115,104,111,111,107,95,95,41,2,78,
+    78,41,11,114,51,0,0,0,114,52,0,0,0,114,53,0,
+    0,0,114,54,0,0,0,114,79,0,0,0,114,2,0,0,
+    0,114,61,0,0,0,114,65,0,0,0,114,70,0,0,0,
+    114,55,0,0,0,114,50,0,0,0,114,31,0,0,0,114,
+    31,0,0,0,114,31,0,0,0,114,33,0,0,0,114,11,
+    0,0,0,53,1,0,0,115,18,0,0,0,8,2,4,2,
+    8,6,2,1,10,6,2,1,12,12,8,10,2,1,99,0,
+    0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,64,
+    0,0,0,115,40,0,0,0,101,0,90,1,100,0,90,2,
+    100,1,90,3,101,4,100,2,100,3,132,0,131,1,90,5,
+    101,6,100,4,100,5,132,0,131,1,90,7,100,6,83,0,
+    41,7,114,13,0,0,0,114,31,0,0,0,99,1,0,0,
+    0,0,0,0,0,1,0,0,0,1,0,0,0,67,0,0,
+    0,115,4,0,0,0,100,1,83,0,114,44,0,0,0,114,
+    31,0,0,0,114,45,0,0,0,114,31,0,0,0,114,31,
+    0,0,0,114,33,0,0,0,218,7,95,95,108,101,110,95,
+    95,107,1,0,0,115,2,0,0,0,0,2,122,13,83,105,
+    122,101,100,46,95,95,108,101,110,95,95,99,2,0,0,0,
+    0,0,0,0,2,0,0,0,3,0,0,0,67,0,0,0,
+    115,22,0,0,0,124,0,116,0,107,8,114,18,116,1,124,
+    1,100,1,131,2,83,0,116,2,83,0,41,2,78,114,81,
+    0,0,0,41,3,114,13,0,0,0,114,43,0,0,0,114,
+    39,0,0,0,114,48,0,0,0,114,31,0,0,0,114,31,
+    0,0,0,114,33,0,0,0,114,50,0,0,0,111,1,0,
+    0,115,6,0,0,0,0,2,8,1,10,1,122,22,83,105,
+    122,101,100,46,95,95,115,117,98,99,108,97,115,115,104,111,
+    111,107,95,95,78,41,8,114,51,0,0,0,114,52,0,0,
+    0,114,53,0,0,0,114,54,0,0,0,114,2,0,0,0,
+    114,81,0,0,0,114,55,0,0,0,114,50,0,0,0,114,
+    31,0,0,0,114,31,0,0,0,114,31,0,0,0,114,33,
+    0,0,0,114,13,0,0,0,103,1,0,0,115,10,0,0,
+    0,8,2,4,2,2,1,10,3,2,1,99,0,0,0,0,
+    0,0,0,0,0,0,0,0,3,0,0,0,64,0,0,0,
+    115,40,0,0,0,101,0,90,1,100,0,90,2,100,1,90,
+    3,101,4,100,2,100,3,132,0,131,1,90,5,101,6,100,
+    4,100,5,132,0,131,1,90,7,100,6,83,0,41,7,114,
+    14,0,0,0,114,31,0,0,0,99,2,0,0,0,0,0,
+    0,0,2,0,0,0,1,0,0,0,67,0,0,0,115,4,
+    0,0,0,100,1,83,0,169,2,78,70,114,31,0,0,0,
+    41,2,114,46,0,0,0,218,1,120,114,31,0,0,0,114,
+    31,0,0,0,114,33,0,0,0,218,12,95,95,99,111,110,
+    116,97,105,110,115,95,95,122,1,0,0,115,2,0,0,0,
+    0,2,122,22,67,111,110,116,97,105,110,101,114,46,95,95,
+    99,111,110,116,97,105,110,115,95,95,99,2,0,0,0,0,
+    0,0,0,2,0,0,0,3,0,0,0,67,0,0,0,115,
+    22,0,0,0,124,0,116,0,107,8,114,18,116,1,124,1,
+    100,1,131,2,83,0,116,2,83,0,41,2,78,114,84,0,
+    0,0,41,3,114,14,0,0,0,114,43,0,0,0,114,39,
+    0,0,0,114,48,0,0,0,114,31,0,0,0,114,31,0,
+    0,0,114,33,0,0,0,114,50,0,0,0,126,1,0,0,
+    115,6,0,0,0,0,2,8,1,10,1,122,26,67,111,110,
+    116,97,105,110,101,114,46,95,95,115,117,98,99,108,97,115,
+    115,104,111,111,107,95,95,78,41,8,114,51,0,0,0,114,
+    52,0,0,0,114,53,0,0,0,114,54,0,0,0,114,2,
+    0,0,0,114,84,0,0,0,114,55,0,0,0,114,50,0,
+    0,0,114,31,0,0,0,114,31,0,0,0,114,31,0,0,
+    0,114,33,0,0,0,114,14,0,0,0,118,1,0,0,115,
+    10,0,0,0,8,2,4,2,2,1,10,3,2,1,99,0,
+    0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,64,
+    0,0,0,115,28,0,0,0,101,0,90,1,100,0,90,2,
+    100,1,90,3,101,4,100,2,100,3,132,0,131,1,90,5,
+    100,4,83,0,41,5,114,16,0,0,0,114,31,0,0,0,
+    99,2,0,0,0,0,0,0,0,2,0,0,0,5,0,0,
+    0,67,0,0,0,115,26,0,0,0,124,0,116,0,107,8,
+    114,22,116,1,124,1,100,1,100,2,100,3,131,4,83,0,
+    116,2,83,0,41,4,78,114,81,0,0,0,114,78,0,0,
+    0,114,84,0,0,0,41,3,114,16,0,0,0,114,43,0,
+    0,0,114,39,0,0,0,114,48,0,0,0,114,31,0,0,
+    0,114,31,0,0,0,114,33,0,0,0,114,50,0,0,0,
+    136,1,0,0,115,6,0,0,0,0,2,8,1,14,1,122,
+    27,67,111,108,108,101,99,116,105,111,110,46,95,95,115,117,
+    98,99,108,97,115,115,104,111,111,107,95,95,78,41,6,114,
+    51,0,0,0,114,52,0,0,0,114,53,0,0,0,114,54,
+    0,0,0,114,55,0,0,0,114,50,0,0,0,114,31,0,
+    0,0,114,31,0,0,0,114,31,0,0,0,114,33,0,0,
+    0,114,16,0,0,0,132,1,0,0,115,6,0,0,0,8,
+    2,4,2,2,1,99,0,0,0,0,0,0,0,0,0,0,
+    0,0,3,0,0,0,64,0,0,0,115,40,0,0,0,101,
+    0,90,1,100,0,90,2,100,1,90,3,101,4,100,2,100,
+    3,132,0,131,1,90,5,101,6,100,4,100,5,132,0,131,
+    1,90,7,100,6,83,0,41,7,114,15,0,0,0,114,31,
+    0,0,0,99,1,0,0,0,0,0,0,0,3,0,0,0,
+    1,0,0,0,79,0,0,0,115,4,0,0,0,100,1,83,
+    0,114,82,0,0,0,114,31,0,0,0,41,3,114,46,0,
+    0,0,218,4,97,114,103,115,218,4,107,119,100,115,114,31,
+    0,0,0,114,31,0,0,0,114,33,0,0,0,218,8,95,
+    95,99,97,108,108,95,95,146,1,0,0,115,2,0,0,0,
+    0,2,122,17,67,97,108,108,97,98,108,101,46,95,95,99,
+    97,108,108,95,95,99,2,0,0,0,0,0,0,0,2,0,
+    0,0,3,0,0,0,67,0,0,0,115,22,0,0,0,124,
+    0,116,0,107,8,114,18,116,1,124,1,100,1,131,2,83,
+    0,116,2,83,0,41,2,78,114,87,0,0,0,41,3,114,
+    15,0,0,0,114,43,0,0,0,114,39,0,0,0,114,48,
+    0,0,0,114,31,0,0,0,114,31,0,0,0,114,33,0,
+    0,0,114,50,0,0,0,150,1,0,0,115,6,0,0,0,
+    0,2,8,1,10,1,122,25,67,97,108,108,97,98,108,101,
+    46,95,95,115,117,98,99,108,97,115,115,104,111,111,107,95,
+    95,78,41,8,114,51,0,0,0,114,52,0,0,0,114,53,
+    0,0,0,114,54,0,0,0,114,2,0,0,0,114,87,0,
+    0,0,114,55,0,0,0,114,50,0,0,0,114,31,0,0,
+    0,114,31,0,0,0,114,31,0,0,0,114,33,0,0,0,
+    114,15,0,0,0,142,1,0,0,115,10,0,0,0,8,2,
+    4,2,2,1,10,3,2,1,99,0,0,0,0,0,0,0,
+    0,0,0,0,0,3,0,0,0,64,0,0,0,115,140,0,
+    0,0,101,0,90,1,100,0,90,2,100,1,90,3,100,2,
+    90,4,100,3,100,4,132,0,90,5,100,5,100,6,132,0,
+    90,6,100,7,100,8,132,0,90,7,100,9,100,10,132,0,
+    90,8,100,11,100,12,132,0,90,9,101,10,100,13,100,14,
+    132,0,131,1,90,11,100,15,100,16,132,0,90,12,101,12,
+    90,13,100,17,100,18,132,0,90,14,100,19,100,20,132,0,
+    90,15,101,15,90,16,100,21,100,22,132,0,90,17,100,23,
+    100,24,132,0,90,18,100,25,100,26,132,0,90,19,101,19,
+    90,20,100,27,100,28,132,0,90,21,100,29,83,0,41,30,
+    114,17,0,0,0,97,90,1,0,0,65,32,115,101,116,32,
+    105,115,32,97,32,102,105,110,105,116,101,44,32,105,116,101,
+    114,97,98,108,101,32,99,111,110,116,97,105,110,101,114,46,
+    10,10,32,32,32,32,84,104,105,115,32,99,108,97,115,115,
+    32,112,114,111,118,105,100,101,115,32,99,111,110,99,114,101,
+    116,101,32,103,101,110,101,114,105,99,32,105,109,112,108,101,
+    109,101,110,116,97,116,105,111,110,115,32,111,102,32,97,108,
+    108,10,32,32,32,32,109,101,116,104,111,100,115,32,101,120,
+    99,101,112,116,32,102,111,114,32,95,95,99,111,110,116,97,
+    105,110,115,95,95,44,32,95,95,105,116,101,114,95,95,32,
+    97,110,100,32,95,95,108,101,110,95,95,46,10,10,32,32,
+    32,32,84,111,32,111,118,101,114,114,105,100,101,32,116,104,
+    101,32,99,111,109,112,97,114,105,115,111,110,115,32,40,112,
+    114,101,115,117,109,97,98,108,121,32,102,111,114,32,115,112,
+    101,101,100,44,32,97,115,32,116,104,101,10,32,32,32,32,
+    115,101,109,97,110,116,105,99,115,32,97,114,101,32,102,105,
+    120,101,100,41,44,32,114,101,100,101,102,105,110,101,32,95,
+    95,108,101,95,95,32,97,110,100,32,95,95,103,101,95,95,
+    44,10,32,32,32,32,116,104,101,110,32,116,104,101,32,111,
+    116,104,101,114,32,111,112,101,114,97,116,105,111,110,115,32,
+    119,105,108,108,32,97,117,116,111,109,97,116,105,99,97,108,
+    108,121,32,102,111,108,108,111,119,32,115,117,105,116,46,10,
+    32,32,32,32,114,31,0,0,0,99,2,0,0,0,0,0,
+    0,0,3,0,0,0,3,0,0,0,67,0,0,0,115,62,
+    0,0,0,116,0,124,1,116,1,131,2,115,14,116,2,83,
+    0,116,3,124,0,131,1,116,3,124,1,131,1,107,4,114,
+    34,100,1,83,0,124,0,68,0,93,18,125,2,124,2,124,
+    1,107,7,114,38,1,0,100,1,83,0,113,38,100,2,83,
+    0,169,3,78,70,84,169,4,218,10,105,115,105,110,115,116,
+    97,110,99,101,114,17,0,0,0,114,39,0,0,0,218,3,
+    108,101,110,169,3,114,46,0,0,0,218,5,111,116,104,101,
+    114,90,4,101,108,101,109,114,31,0,0,0,114,31,0,0,
+    0,114,33,0,0,0,218,6,95,95,108,101,95,95,174,1,
+    0,0,115,16,0,0,0,0,1,10,1,4,1,16,1,4,
+    1,8,1,8,1,8,1,122,10,83,101,116,46,95,95,108,
+    101,95,95,99,2,0,0,0,0,0,0,0,2,0,0,0,
+    3,0,0,0,67,0,0,0,115,40,0,0,0,116,0,124,
+    1,116,1,131,2,115,14,116,2,83,0,116,3,124,0,131,
+    1,116,3,124,1,131,1,107,0,111,38,124,0,160,4,124,
+    1,161,1,83,0,114,32,0,0,0,169,5,114,90,0,0,
+    0,114,17,0,0,0,114,39,0,0,0,114,91,0,0,0,
+    114,94,0,0,0,169,2,114,46,0,0,0,114,93,0,0,
+    0,114,31,0,0,0,114,31,0,0,0,114,33,0,0,0,
+    218,6,95,95,108,116,95,95,184,1,0,0,115,6,0,0,
+    0,0,1,10,1,4,1,122,10,83,101,116,46,95,95,108,
+    116,95,95,99,2,0,0,0,0,0,0,0,2,0,0,0,
+    3,0,0,0,67,0,0,0,115,40,0,0,0,116,0,124,
+    1,116,1,131,2,115,14,116,2,83,0,116,3,124,0,131,
+    1,116,3,124,1,131,1,107,4,111,38,124,0,160,4,124,
+    1,161,1,83,0,114,32,0,0,0,41,5,114,90,0,0,
+    0,114,17,0,0,0,114,39,0,0,0,114,91,0,0,0,
+    218,6,95,95,103,101,95,95,114,96,0,0,0,114,31,0,
+    0,0,114,31,0,0,0,114,33,0,0,0,218,6,95,95,
+    103,116,95,95,189,1,0,0,115,6,0,0,0,0,1,10,
+    1,4,1,122,10,83,101,116,46,95,95,103,116,95,95,99,
+    2,0,0,0,0,0,0,0,3,0,0,0,3,0,0,0,
+    67,0,0,0,115,62,0,0,0,116,0,124,1,116,1,131,
+    2,115,14,116,2,83,0,116,3,124,0,131,1,116,3,124,
+    1,131,1,107,0,114,34,100,1,83,0,124,1,68,0,93,
+    18,125,2,124,2,124,0,107,7,114,38,1,0,100,1,83,
+    0,113,38,100,2,83,0,114,88,0,0,0,114,89,0,0,
+    0,114,92,0,0,0,114,31,0,0,0,114,31,0,0,0,
+    114,33,0,0,0,114,98,0,0,0,194,1,0,0,115,16,
+    0,0,0,0,1,10,1,4,1,16,1,4,1,8,1,8,
+    1,8,1,122,10,83,101,116,46,95,95,103,101,95,95,99,
+    2,0,0,0,0,0,0,0,2,0,0,0,3,0,0,0,
+    67,0,0,0,115,40,0,0,0,116,0,124,1,116,1,131,
+    2,115,14,116,2,83,0,116,3,124,0,131,1,116,3,124,
+    1,131,1,107,2,111,38,124,0,160,4,124,1,161,1,83,
+    0,114,32,0,0,0,114,95,0,0,0,114,96,0,0,0,
+    114,31,0,0,0,114,31,0,0,0,114,33,0,0,0,218,
+    6,95,95,101,113,95,95,204,1,0,0,115,6,0,0,0,
+    0,1,10,1,4,1,122,10,83,101,116,46,95,95,101,113,
+    95,95,99,2,0,0,0,0,0,0,0,2,0,0,0,2,
+    0,0,0,67,0,0,0,115,8,0,0,0,124,0,124,1,
+    131,1,83,0,41,1,122,188,67,111,110,115,116,114,117,99,
+    116,32,97,110,32,105,110,115,116,97,110,99,101,32,111,102,
+    32,116,104,101,32,99,108,97,115,115,32,102,114,111,109,32,
+    97,110,121,32,105,116,101,114,97,98,108,101,32,105,110,112,
+    117,116,46,10,10,32,32,32,32,32,32,32,32,77,117,115,
+    116,32,111,118,101,114,114,105,100,101,32,116,104,105,115,32,
+    109,101,116,104,111,100,32,105,102,32,116,104,101,32,99,108,
+    97,115,115,32,99,111,110,115,116,114,117,99,116,111,114,32,
+    115,105,103,110,97,116,117,114,101,10,32,32,32,32,32,32,
+    32,32,100,111,101,115,32,110,111,116,32,97,99,99,101,112,
+    116,32,97,110,32,105,116,101,114,97,98,108,101,32,102,111,
+    114,32,97,110,32,105,110,112,117,116,46,10,32,32,32,32,
+    32,32,32,32,114,31,0,0,0,41,2,114,49,0,0,0,
+    218,2,105,116,114,31,0,0,0,114,31,0,0,0,114,33,
+    0,0,0,218,14,95,102,114,111,109,95,105,116,101,114,97,
+    98,108,101,209,1,0,0,115,2,0,0,0,0,7,122,18,
+    83,101,116,46,95,102,114,111,109,95,105,116,101,114,97,98,
+    108,101,99,2,0,0,0,0,0,0,0,2,0,0,0,5,
+    0,0,0,3,0,0,0,115,38,0,0,0,116,0,124,1,
+    116,1,131,2,115,14,116,2,83,0,136,0,160,3,135,0,
+    102,1,100,1,100,2,132,8,124,1,68,0,131,1,161,1,
+    83,0,41,3,78,99,1,0,0,0,0,0,0,0,2,0,
+    0,0,3,0,0,0,51,0,0,0,115,26,0,0,0,124,
+    0,93,18,125,1,124,1,136,0,107,6,114,2,124,1,86,
+    0,1,0,113,2,100,0,83,0,114,32,0,0,0,114,31,
+    0,0,0,169,2,218,2,46,48,114,60,0,0,0,114,45,
+    0,0,0,114,31,0,0,0,114,33,0,0,0,218,9,60,
+    103,101,110,101,120,112,114,62,221,1,0,0,115,6,0,0,
+    0,4,0,2,0,8,0,122,30,83,101,116,46,95,95,97,
+    110,100,95,95,46,60,108,111,99,97,108,115,62,46,60,103,
+    101,110,101,120,112,114,62,169,4,114,90,0,0,0,114,9,
+    0,0,0,114,39,0,0,0,114,102,0,0,0,114,96,0,
+    0,0,114,31,0,0,0,114,45,0,0,0,114,33,0,0,
+    0,218,7,95,95,97,110,100,95,95,218,1,0,0,115,6,
+    0,0,0,0,1,10,1,4,1,122,11,83,101,116,46,95,
+    95,97,110,100,95,95,99,2,0,0,0,0,0,0,0,3,
+    0,0,0,3,0,0,0,67,0,0,0,115,28,0,0,0,
+    124,1,68,0,93,18,125,2,124,2,124,0,107,6,114,4,
+    1,0,100,1,83,0,113,4,100,2,83,0,41,3,122,49,
+    82,101,116,117,114,110,32,84,114,117,101,32,105,102,32,116,
+    119,111,32,115,101,116,115,32,104,97,118,101,32,97,32,110,
+    117,108,108,32,105,110,116,101,114,115,101,99,116,105,111,110,
+    46,70,84,114,31,0,0,0,41,3,114,46,0,0,0,114,
+    93,0,0,0,114,60,0,0,0,114,31,0,0,0,114,31,
+    0,0,0,114,33,0,0,0,218,10,105,115,100,105,115,106,
+    111,105,110,116,225,1,0,0,115,8,0,0,0,0,2,8,
+    1,8,1,8,1,122,14,83,101,116,46,105,115,100,105,115,
+    106,111,105,110,116,99,2,0,0,0,0,0,0,0,3,0,
+    0,0,3,0,0,0,67,0,0,0,115,42,0,0,0,116,
+    0,124,1,116,1,131,2,115,14,116,2,83,0,100,1,100,
+    2,132,0,124,0,124,1,102,2,68,0,131,1,125,2,124,
+    0,160,3,124,2,161,1,83,0,41,3,78,99,1,0,0,
+    0,0,0,0,0,3,0,0,0,3,0,0,0,115,0,0,
+    0,115,28,0,0,0,124,0,93,20,125,1,124,1,68,0,
+    93,10,125,2,124,2,86,0,1,0,113,10,113,2,100,0,
+    83,0,114,32,0,0,0,114,31,0,0,0,41,3,114,104,
+    0,0,0,218,1,115,218,1,101,114,31,0,0,0,114,31,
+    0,0,0,114,33,0,0,0,114,105,0,0,0,235,1,0,
+    0,115,8,0,0,0,4,0,2,0,6,0,2,0,122,29,
+    83,101,116,46,95,95,111,114,95,95,46,60,108,111,99,97,
+    108,115,62,46,60,103,101,110,101,120,112,114,62,114,106,0,
+    0,0,41,3,114,46,0,0,0,114,93,0,0,0,90,5,
+    99,104,97,105,110,114,31,0,0,0,114,31,0,0,0,114,
+    33,0,0,0,218,6,95,95,111,114,95,95,232,1,0,0,
+    115,8,0,0,0,0,1,10,1,4,1,18,1,122,10,83,
+    101,116,46,95,95,111,114,95,95,99,2,0,0,0,0,0,
+    0,0,2,0,0,0,5,0,0,0,3,0,0,0,115,58,
+    0,0,0,116,0,136,0,116,1,131,2,115,34,116,0,136,
+    0,116,2,131,2,115,24,116,3,83,0,124,0,160,4,136,
+    0,161,1,137,0,124,0,160,4,135,0,102,1,100,1,100,
+    2,132,8,124,0,68,0,131,1,161,1,83,0,41,3,78,
+    99,1,0,0,0,0,0,0,0,2,0,0,0,3,0,0,
+    0,51,0,0,0,115,26,0,0,0,124,0,93,18,125,1,
+    124,1,136,0,107,7,114,20,124,1,86,0,1,0,113,2,
+    100,0,83,0,114,32,0,0,0,114,31,0,0,0,114,103,
+    0,0,0,169,1,114,93,0,0,0,114,31,0,0,0,114,
+    33,0,0,0,114,105,0,0,0,245,1,0,0,115,6,0,
+    0,0,4,0,2,1,8,255,122,30,83,101,116,46,95,95,
+    115,117,98,95,95,46,60,108,111,99,97,108,115,62,46,60,
+    103,101,110,101,120,112,114,62,169,5,114,90,0,0,0,114,
+    17,0,0,0,114,9,0,0,0,114,39,0,0,0,114,102,
+    0,0,0,114,96,0,0,0,114,31,0,0,0,114,112,0,
+    0,0,114,33,0,0,0,218,7,95,95,115,117,98,95,95,
+    240,1,0,0,115,10,0,0,0,0,1,10,1,10,1,4,
+    1,10,1,122,11,83,101,116,46,95,95,115,117,98,95,95,
+    99,2,0,0,0,0,0,0,0,2,0,0,0,5,0,0,
+    0,3,0,0,0,115,58,0,0,0,116,0,124,1,116,1,
+    131,2,115,34,116,0,124,1,116,2,131,2,115,24,116,3,
+    83,0,136,0,160,4,124,1,161,1,125,1,136,0,160,4,
+    135,0,102,1,100,1,100,2,132,8,124,1,68,0,131,1,
+    161,1,83,0,41,3,78,99,1,0,0,0,0,0,0,0,
+    2,0,0,0,3,0,0,0,51,0,0,0,115,26,0,0,
+    0,124,0,93,18,125,1,124,1,136,0,107,7,114,20,124,
+    1,86,0,1,0,113,2,100,0,83,0,114,32,0,0,0,
+    114,31,0,0,0,114,103,0,0,0,114,45,0,0,0,114,
+    31,0,0,0,114,33,0,0,0,114,105,0,0,0,253,1,
+    0,0,115,6,0,0,0,4,0,2,1,8,255,122,31,83,
+    101,116,46,95,95,114,115,117,98,95,95,46,60,108,111,99,
+    97,108,115,62,46,60,103,101,110,101,120,112,114,62,114,113,
+    0,0,0,114,96,0,0,0,114,31,0,0,0,114,45,0,
+    0,0,114,33,0,0,0,218,8,95,95,114,115,117,98,95,
+    95,248,1,0,0,115,10,0,0,0,0,1,10,1,10,1,
+    4,1,10,1,122,12,83,101,116,46,95,95,114,115,117,98,
+    95,95,99,2,0,0,0,0,0,0,0,2,0,0,0,3,
+    0,0,0,67,0,0,0,115,50,0,0,0,116,0,124,1,
+    116,1,131,2,115,34,116,0,124,1,116,2,131,2,115,24,
+    116,3,83,0,124,0,160,4,124,1,161,1,125,1,124,0,
+    124,1,24,0,124,1,124,0,24,0,66,0,83,0,114,32,
+    0,0,0,114,113,0,0,0,114,96,0,0,0,114,31,0,
+    0,0,114,31,0,0,0,114,33,0,0,0,218,7,95,95,
+    120,111,114,95,95,0,2,0,0,115,10,0,0,0,0,1,
+    10,1,10,1,4,1,10,1,122,11,83,101,116,46,95,95,
+    120,111,114,95,95,99,1,0,0,0,0,0,0,0,7,0,
+    0,0,5,0,0,0,67,0,0,0,115,152,0,0,0,116,
+    0,106,1,125,1,100,1,124,1,20,0,100,2,23,0,125,
+    2,116,2,124,0,131,1,125,3,100,3,124,3,100,2,23,
+    0,20,0,125,4,124,4,124,2,77,0,125,4,124,0,68,
+    0,93,44,125,5,116,3,124,5,131,1,125,6,124,4,124,
+    6,124,6,100,4,62,0,65,0,100,5,65,0,100,6,20,
+    0,78,0,125,4,124,4,124,2,77,0,125,4,113,50,124,
+    4,100,7,20,0,100,8,23,0,125,4,124,4,124,2,77,
+    0,125,4,124,4,124,1,107,4,114,136,124,4,124,2,100,
+    2,23,0,56,0,125,4,124,4,100,9,107,2,114,148,100,
+    10,125,4,124,4,83,0,41,11,97,43,2,0,0,67,111,
+    109,112,117,116,101,32,116,104,101,32,104,97,115,104,32,118,
+    97,108,117,101,32,111,102,32,97,32,115,101,116,46,10,10,
+    32,32,32,32,32,32,32,32,78,111,116,101,32,116,104,97,
+    116,32,119,101,32,100,111,110,39,116,32,100,101,102,105,110,
+    101,32,95,95,104,97,115,104,95,95,58,32,110,111,116,32,
+    97,108,108,32,115,101,116,115,32,97,114,101,32,104,97,115,
+    104,97,98,108,101,46,10,32,32,32,32,32,32,32,32,66,
+    117,116,32,105,102,32,121,111,117,32,100,101,102,105,110,101,
+    32,97,32,104,97,115,104,97,98,108,101,32,115,101,116,32,
+    116,121,112,101,44,32,105,116,115,32,95,95,104,97,115,104,
+    95,95,32,115,104,111,117,108,100,10,32,32,32,32,32,32,
+    32,32,99,97,108,108,32,116,104,105,115,32,102,117,110,99,
+    116,105,111,110,46,10,10,32,32,32,32,32,32,32,32,84,
+    104,105,115,32,109,117,115,116,32,98,101,32,99,111,109,112,
+    97,116,105,98,108,101,32,95,95,101,113,95,95,46,10,10,
+    32,32,32,32,32,32,32,32,65,108,108,32,115,101,116,115,
+    32,111,117,103,104,116,32,116,111,32,99,111,109,112,97,114,
+    101,32,101,113,117,97,108,32,105,102,32,116,104,101,121,32,
+    99,111,110,116,97,105,110,32,116,104,101,32,115,97,109,101,
+    10,32,32,32,32,32,32,32,32,101,108,101,109,101,110,116,
+    115,44,32,114,101,103,97,114,100,108,101,115,115,32,111,102,
+    32,104,111,119,32,116,104,101,121,32,97,114,101,32,105,109,
+    112,108,101,109,101,110,116,101,100,44,32,97,110,100,10,32,
+    32,32,32,32,32,32,32,114,101,103,97,114,100,108,101,115,
+    115,32,111,102,32,116,104,101,32,111,114,100,101,114,32,111,
+    102,32,116,104,101,32,101,108,101,109,101,110,116,115,59,32,
+    115,111,32,116,104,101,114,101,39,115,32,110,111,116,32,109,
+    117,99,104,10,32,32,32,32,32,32,32,32,102,114,101,101,
+    100,111,109,32,102,111,114,32,95,95,101,113,95,95,32,111,
+    114,32,95,95,104,97,115,104,95,95,46,32,32,87,101,32,
+    109,97,116,99,104,32,116,104,101,32,97,108,103,111,114,105,
+    116,104,109,32,117,115,101,100,10,32,32,32,32,32,32,32,
+    32,98,121,32,116,104,101,32,98,117,105,108,116,45,105,110,
+    32,102,114,111,122,101,110,115,101,116,32,116,121,112,101,46,
+    10,32,32,32,32,32,32,32,32,233,2,0,0,0,114,29,
+    0,0,0,105,77,239,232,114,233,16,0,0,0,105,179,77,
+    91,5,108,3,0,0,0,215,52,126,50,3,0,105,205,13,
+    1,0,105,227,195,17,54,233,255,255,255,255,105,193,199,56,
+    35,41,4,218,3,115,121,115,218,7,109,97,120,115,105,122,
+    101,114,91,0,0,0,218,4,104,97,115,104,41,7,114,46,
+    0,0,0,90,3,77,65,88,90,4,77,65,83,75,218,1,
+    110,218,1,104,114,83,0,0,0,90,2,104,120,114,31,0,
+    0,0,114,31,0,0,0,114,33,0,0,0,218,5,95,104,
+    97,115,104,9,2,0,0,115,32,0,0,0,0,15,6,1,
+    12,1,8,1,12,1,8,1,8,1,8,1,24,1,10,1,
+    12,1,8,1,8,1,12,1,8,1,4,1,122,9,83,101,
+    116,46,95,104,97,115,104,78,41,22,114,51,0,0,0,114,
+    52,0,0,0,114,53,0,0,0,218,7,95,95,100,111,99,
+    95,95,114,54,0,0,0,114,94,0,0,0,114,97,0,0,
+    0,114,99,0,0,0,114,98,0,0,0,114,100,0,0,0,
+    114,55,0,0,0,114,102,0,0,0,114,107,0,0,0,218,
+    8,95,95,114,97,110,100,95,95,114,108,0,0,0,114,111,
+    0,0,0,218,7,95,95,114,111,114,95,95,114,114,0,0,
+    0,114,115,0,0,0,114,116,0,0,0,218,8,95,95,114,
+    120,111,114,95,95,114,125,0,0,0,114,31,0,0,0,114,
+    31,0,0,0,114,31,0,0,0,114,33,0,0,0,114,17,
+    0,0,0,160,1,0,0,115,38,0,0,0,8,2,4,10,
+    4,2,8,10,8,5,8,5,8,10,8,5,2,1,10,8,
+    8,5,4,2,8,7,8,6,4,2,8,8,8,8,8,7,
+    4,2,99,0,0,0,0,0,0,0,0,0,0,0,0,3,
+    0,0,0,64,0,0,0,115,100,0,0,0,101,0,90,1,
+    100,0,90,2,100,1,90,3,100,2,90,4,101,5,100,3,
+    100,4,132,0,131,1,90,6,101,5,100,5,100,6,132,0,
+    131,1,90,7,100,7,100,8,132,0,90,8,100,9,100,10,
+    132,0,90,9,100,11,100,12,132,0,90,10,100,13,100,14,
+    132,0,90,11,100,15,100,16,132,0,90,12,100,17,100,18,
+    132,0,90,13,100,19,100,20,132,0,90,14,100,21,83,0,
+    41,22,114,18,0,0,0,97,135,1,0,0,65,32,109,117,
+    116,97,98,108,101,32,115,101,116,32,105,115,32,97,32,102,
+    105,110,105,116,101,44,32,105,116,101,114,97,98,108,101,32,
+    99,111,110,116,97,105,110,101,114,46,10,10,32,32,32,32,
+    84,104,105,115,32,99,108,97,115,115,32,112,114,111,118,105,
+    100,101,115,32,99,111,110,99,114,101,116,101,32,103,101,110,
+    101,114,105,99,32,105,109,112,108,101,109,101,110,116,97,116,
+    105,111,110,115,32,111,102,32,97,108,108,10,32,32,32,32,
+    109,101,116,104,111,100,115,32,101,120,99,101,112,116,32,102,
+    111,114,32,95,95,99,111,110,116,97,105,110,115,95,95,44,
+    32,95,95,105,116,101,114,95,95,44,32,95,95,108,101,110,
+    95,95,44,10,32,32,32,32,97,100,100,40,41,44,32,97,
+    110,100,32,100,105,115,99,97,114,100,40,41,46,10,10,32,
+    32,32,32,84,111,32,111,118,101,114,114,105,100,101,32,116,
+    104,101,32,99,111,109,112,97,114,105,115,111,110,115,32,40,
+    112,114,101,115,117,109,97,98,108,121,32,102,111,114,32,115,
+    112,101,101,100,44,32,97,115,32,116,104,101,10,32,32,32,
+    32,115,101,109,97,110,116,105,99,115,32,97,114,101,32,102,
+    105,120,101,100,41,44,32,97,108,108,32,121,111,117,32,104,
+    97,118,101,32,116,111,32,100,111,32,105,115,32,114,101,100,
+    101,102,105,110,101,32,95,95,108,101,95,95,32,97,110,100,
+    10,32,32,32,32,116,104,101,110,32,116,104,101,32,111,116,
+    104,101,114,32,111,112,101,114,97,116,105,111,110,115,32,119,
+    105,108,108,32,97,117,116,111,109,97,116,105,99,97,108,108,
+    121,32,102,111,108,108,111,119,32,115,117,105,116,46,10,32,
+    32,32,32,114,31,0,0,0,99,2,0,0,0,0,0,0,
+    0,2,0,0,0,1,0,0,0,67,0,0,0,115,8,0,
+    0,0,116,0,130,1,100,1,83,0,41,2,122,15,65,100,
+    100,32,97,110,32,101,108,101,109,101,110,116,46,78,169,1,
+    218,19,78,111,116,73,109,112,108,101,109,101,110,116,101,100,
+    69,114,114,111,114,114,59,0,0,0,114,31,0,0,0,114,
+    31,0,0,0,114,33,0,0,0,218,3,97,100,100,58,2,
+    0,0,115,2,0,0,0,0,3,122,14,77,117,116,97,98,
+    108,101,83,101,116,46,97,100,100,99,2,0,0,0,0,0,
+    0,0,2,0,0,0,1,0,0,0,67,0,0,0,115,8,
+    0,0,0,116,0,130,1,100,1,83,0,41,2,122,56,82,
+    101,109,111,118,101,32,97,110,32,101,108,101,109,101,110,116,
+    46,32,32,68,111,32,110,111,116,32,114,97,105,115,101,32,
+    97,110,32,101,120,99,101,112,116,105,111,110,32,105,102,32,
+    97,98,115,101,110,116,46,78,114,130,0,0,0,114,59,0,
+    0,0,114,31,0,0,0,114,31,0,0,0,114,33,0,0,
+    0,218,7,100,105,115,99,97,114,100,63,2,0,0,115,2,
+    0,0,0,0,3,122,18,77,117,116,97,98,108,101,83,101,
+    116,46,100,105,115,99,97,114,100,99,2,0,0,0,0,0,
+    0,0,2,0,0,0,3,0,0,0,67,0,0,0,115,30,
+    0,0,0,124,1,124,0,107,7,114,16,116,0,124,1,131,
+    1,130,1,124,0,160,1,124,1,161,1,1,0,100,1,83,
+    0,41,2,122,53,82,101,109,111,118,101,32,97,110,32,101,
+    108,101,109,101,110,116,46,32,73,102,32,110,111,116,32,97,
+    32,109,101,109,98,101,114,44,32,114,97,105,115,101,32,97,
+    32,75,101,121,69,114,114,111,114,46,78,41,2,218,8,75,
+    101,121,69,114,114,111,114,114,133,0,0,0,114,59,0,0,
+    0,114,31,0,0,0,114,31,0,0,0,114,33,0,0,0,
+    218,6,114,101,109,111,118,101,68,2,0,0,115,6,0,0,
+    0,0,2,8,1,8,1,122,17,77,117,116,97,98,108,101,
+    83,101,116,46,114,101,109,111,118,101,99,1,0,0,0,0,
+    0,0,0,3,0,0,0,8,0,0,0,67,0,0,0,115,
+    62,0,0,0,116,0,124,0,131,1,125,1,122,12,116,1,
+    124,1,131,1,125,2,87,0,110,26,4,0,116,2,107,10,
+    114,46,1,0,1,0,1,0,116,3,100,1,130,2,89,0,
+    110,2,88,0,124,0,160,4,124,2,161,1,1,0,124,2,
+    83,0,41,2,122,50,82,101,116,117,114,110,32,116,104,101,
+    32,112,111,112,112,101,100,32,118,97,108,117,101,46,32,32,
+    82,97,105,115,101,32,75,101,121,69,114,114,111,114,32,105,
+    102,32,101,109,112,116,121,46,78,41,5,218,4,105,116,101,
+    114,218,4,110,101,120,116,114,58,0,0,0,114,134,0,0,
+    0,114,133,0,0,0,169,3,114,46,0,0,0,114,101,0,
+    0,0,114,60,0,0,0,114,31,0,0,0,114,31,0,0,
+    0,114,33,0,0,0,218,3,112,111,112,74,2,0,0,115,
+    14,0,0,0,0,2,8,1,2,1,12,1,14,1,12,1,
+    10,1,122,14,77,117,116,97,98,108,101,83,101,116,46,112,
+    111,112,99,1,0,0,0,0,0,0,0,1,0,0,0,8,
+    0,0,0,67,0,0,0,115,40,0,0,0,122,14,124,0,
+    160,0,161,0,1,0,113,2,87,0,110,20,4,0,116,1,
+    107,10,114,34,1,0,1,0,1,0,89,0,110,2,88,0,
+    100,1,83,0,41,2,122,54,84,104,105,115,32,105,115,32,
+    115,108,111,119,32,40,99,114,101,97,116,101,115,32,78,32,
+    110,101,119,32,105,116,101,114,97,116,111,114,115,33,41,32,
+    98,117,116,32,101,102,102,101,99,116,105,118,101,46,78,41,
+    2,114,139,0,0,0,114,134,0,0,0,114,45,0,0,0,
+    114,31,0,0,0,114,31,0,0,0,114,33,0,0,0,218,
+    5,99,108,101,97,114,84,2,0,0,115,8,0,0,0,0,
+    2,2,2,14,1,14,1,122,16,77,117,116,97,98,108,101,
+    83,101,116,46,99,108,101,97,114,99,2,0,0,0,0,0,
+    0,0,3,0,0,0,4,0,0,0,67,0,0,0,115,24,
+    0,0,0,124,1,68,0,93,14,125,2,124,0,160,0,124,
+    2,161,1,1,0,113,4,124,0,83,0,114,32,0,0,0,
+    41,1,114,132,0,0,0,114,138,0,0,0,114,31,0,0,
+    0,114,31,0,0,0,114,33,0,0,0,218,7,95,95,105,
+    111,114,95,95,92,2,0,0,115,6,0,0,0,0,1,8,
+    1,12,1,122,18,77,117,116,97,98,108,101,83,101,116,46,
+    95,95,105,111,114,95,95,99,2,0,0,0,0,0,0,0,
+    3,0,0,0,4,0,0,0,67,0,0,0,115,28,0,0,
+    0,124,0,124,1,24,0,68,0,93,14,125,2,124,0,160,
+    0,124,2,161,1,1,0,113,8,124,0,83,0,114,32,0,
+    0,0,41,1,114,133,0,0,0,114,138,0,0,0,114,31,
+    0,0,0,114,31,0,0,0,114,33,0,0,0,218,8,95,
+    95,105,97,110,100,95,95,97,2,0,0,115,6,0,0,0,
+    0,1,12,1,12,1,122,19,77,117,116,97,98,108,101,83,
+    101,116,46,95,95,105,97,110,100,95,95,99,2,0,0,0,
+    0,0,0,0,3,0,0,0,4,0,0,0,67,0,0,0,
+    115,82,0,0,0,124,1,124,0,107,8,114,18,124,0,160,
+    0,161,0,1,0,110,60,116,1,124,1,116,2,131,2,115,
+    38,124,0,160,3,124,1,161,1,125,1,124,1,68,0,93,
+    34,125,2,124,2,124,0,107,6,114,66,124,0,160,4,124,
+    2,161,1,1,0,113,42,124,0,160,5,124,2,161,1,1,
+    0,113,42,124,0,83,0,114,32,0,0,0,41,6,114,140,
+    0,0,0,114,90,0,0,0,114,17,0,0,0,114,102,0,
+    0,0,114,133,0,0,0,114,132,0,0,0,114,138,0,0,
+    0,114,31,0,0,0,114,31,0,0,0,114,33,0,0,0,
+    218,8,95,95,105,120,111,114,95,95,102,2,0,0,115,18,
+    0,0,0,0,1,8,1,10,2,10,1,10,1,8,1,8,
+    1,12,2,12,1,122,19,77,117,116,97,98,108,101,83,101,
+    116,46,95,95,105,120,111,114,95,95,99,2,0,0,0,0,
+    0,0,0,3,0,0,0,4,0,0,0,67,0,0,0,115,
+    42,0,0,0,124,1,124,0,107,8,114,18,124,0,160,0,
+    161,0,1,0,110,20,124,1,68,0,93,14,125,2,124,0,
+    160,1,124,2,161,1,1,0,113,22,124,0,83,0,114,32,
+    0,0,0,41,2,114,140,0,0,0,114,133,0,0,0,114,
+    138,0,0,0,114,31,0,0,0,114,31,0,0,0,114,33,
+    0,0,0,218,8,95,95,105,115,117,98,95,95,115,2,0,
+    0,115,10,0,0,0,0,1,8,1,10,2,8,1,12,1,
+    122,19,77,117,116,97,98,108,101,83,101,116,46,95,95,105,
+    115,117,98,95,95,78,41,15,114,51,0,0,0,114,52,0,
+    0,0,114,53,0,0,0,114,126,0,0,0,114,54,0,0,
+    0,114,2,0,0,0,114,132,0,0,0,114,133,0,0,0,
+    114,135,0,0,0,114,139,0,0,0,114,140,0,0,0,114,
+    141,0,0,0,114,142,0,0,0,114,143,0,0,0,114,144,
+    0,0,0,114,31,0,0,0,114,31,0,0,0,114,31,0,
+    0,0,114,33,0,0,0,114,18,0,0,0,44,2,0,0,
+    115,26,0,0,0,8,1,4,11,4,2,2,1,10,4,2,
+    1,10,4,8,6,8,10,8,8,8,5,8,5,8,13,99,
+    0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,
+    64,0,0,0,115,82,0,0,0,101,0,90,1,100,0,90,
+    2,100,1,90,3,101,4,100,2,100,3,132,0,131,1,90,
+    5,100,17,100,5,100,6,132,1,90,6,100,7,100,8,132,
+    0,90,7,100,9,100,10,132,0,90,8,100,11,100,12,132,
+    0,90,9,100,13,100,14,132,0,90,10,100,15,100,16,132,
+    0,90,11,100,4,90,12,100,4,83,0,41,18,114,19,0,
+    0,0,114,31,0,0,0,99,2,0,0,0,0,0,0,0,
+    2,0,0,0,1,0,0,0,67,0,0,0,115,8,0,0,
+    0,116,0,130,1,100,0,83,0,114,32,0,0,0,169,1,
+    114,134,0,0,0,169,2,114,46,0,0,0,218,3,107,101,
+    121,114,31,0,0,0,114,31,0,0,0,114,33,0,0,0,
+    218,11,95,95,103,101,116,105,116,101,109,95,95,141,2,0,
+    0,115,2,0,0,0,0,2,122,19,77,97,112,112,105,110,
+    103,46,95,95,103,101,116,105,116,101,109,95,95,78,99,3,
+    0,0,0,0,0,0,0,3,0,0,0,8,0,0,0,67,
+    0,0,0,115,40,0,0,0,122,10,124,0,124,1,25,0,
+    87,0,83,0,4,0,116,0,107,10,114,34,1,0,1,0,
+    1,0,124,2,6,0,89,0,83,0,88,0,100,1,83,0,
+    41,2,122,60,68,46,103,101,116,40,107,91,44,100,93,41,
+    32,45,62,32,68,91,107,93,32,105,102,32,107,32,105,110,
+    32,68,44,32,101,108,115,101,32,100,46,32,32,100,32,100,
+    101,102,97,117,108,116,115,32,116,111,32,78,111,110,101,46,
+    78,114,145,0,0,0,169,3,114,46,0,0,0,114,147,0,
+    0,0,218,7,100,101,102,97,117,108,116,114,31,0,0,0,
+    114,31,0,0,0,114,33,0,0,0,218,3,103,101,116,145,
+    2,0,0,115,8,0,0,0,0,2,2,1,10,1,14,1,
+    122,11,77,97,112,112,105,110,103,46,103,101,116,99,2,0,
+    0,0,0,0,0,0,2,0,0,0,8,0,0,0,67,0,
+    0,0,115,44,0,0,0,122,12,124,0,124,1,25,0,1,
+    0,87,0,110,22,4,0,116,0,107,10,114,34,1,0,1,
+    0,1,0,89,0,100,1,83,0,88,0,100,2,83,0,100,
+    0,83,0,114,88,0,0,0,114,145,0,0,0,114,146,0,
+    0,0,114,31,0,0,0,114,31,0,0,0,114,33,0,0,
+    0,114,84,0,0,0,152,2,0,0,115,10,0,0,0,0,
+    1,2,1,12,1,14,1,8,2,122,20,77,97,112,112,105,
+    110,103,46,95,95,99,111,110,116,97,105,110,115,95,95,99,
+    1,0,0,0,0,0,0,0,1,0,0,0,2,0,0,0,
+    67,0,0,0,115,8,0,0,0,116,0,124,0,131,1,83,
+    0,41,1,122,58,68,46,107,101,121,115,40,41,32,45,62,
+    32,97,32,115,101,116,45,108,105,107,101,32,111,98,106,101,
+    99,116,32,112,114,111,118,105,100,105,110,103,32,97,32,118,
+    105,101,119,32,111,110,32,68,39,115,32,107,101,121,115,41,
+    1,114,22,0,0,0,114,45,0,0,0,114,31,0,0,0,
+    114,31,0,0,0,114,33,0,0,0,218,4,107,101,121,115,
+    160,2,0,0,115,2,0,0,0,0,2,122,12,77,97,112,
+    112,105,110,103,46,107,101,121,115,99,1,0,0,0,0,0,
+    0,0,1,0,0,0,2,0,0,0,67,0,0,0,115,8,
+    0,0,0,116,0,124,0,131,1,83,0,41,1,122,60,68,
+    46,105,116,101,109,115,40,41,32,45,62,32,97,32,115,101,
+    116,45,108,105,107,101,32,111,98,106,101,99,116,32,112,114,
+    111,118,105,100,105,110,103,32,97,32,118,105,101,119,32,111,
+    110,32,68,39,115,32,105,116,101,109,115,41,1,114,23,0,
+    0,0,114,45,0,0,0,114,31,0,0,0,114,31,0,0,
+    0,114,33,0,0,0,218,5,105,116,101,109,115,164,2,0,
+    0,115,2,0,0,0,0,2,122,13,77,97,112,112,105,110,
+    103,46,105,116,101,109,115,99,1,0,0,0,0,0,0,0,
+    1,0,0,0,2,0,0,0,67,0,0,0,115,8,0,0,
+    0,116,0,124,0,131,1,83,0,41,1,122,54,68,46,118,
+    97,108,117,101,115,40,41,32,45,62,32,97,110,32,111,98,
+    106,101,99,116,32,112,114,111,118,105,100,105,110,103,32,97,
+    32,118,105,101,119,32,111,110,32,68,39,115,32,118,97,108,
+    117,101,115,41,1,114,24,0,0,0,114,45,0,0,0,114,
+    31,0,0,0,114,31,0,0,0,114,33,0,0,0,218,6,
+    118,97,108,117,101,115,168,2,0,0,115,2,0,0,0,0,
+    2,122,14,77,97,112,112,105,110,103,46,118,97,108,117,101,
+    115,99,2,0,0,0,0,0,0,0,2,0,0,0,4,0,
+    0,0,67,0,0,0,115,38,0,0,0,116,0,124,1,116,
+    1,131,2,115,14,116,2,83,0,116,3,124,0,160,4,161,
+    0,131,1,116,3,124,1,160,4,161,0,131,1,107,2,83,
+    0,114,32,0,0,0,41,5,114,90,0,0,0,114,19,0,
+    0,0,114,39,0,0,0,218,4,100,105,99,116,114,153,0,
+    0,0,114,96,0,0,0,114,31,0,0,0,114,31,0,0,
+    0,114,33,0,0,0,114,100,0,0,0,172,2,0,0,115,
+    6,0,0,0,0,1,10,1,4,1,122,14,77,97,112,112,
+    105,110,103,46,95,95,101,113,95,95,41,1,78,41,13,114,
+    51,0,0,0,114,52,0,0,0,114,53,0,0,0,114,54,
+    0,0,0,114,2,0,0,0,114,148,0,0,0,114,151,0,
+    0,0,114,84,0,0,0,114,152,0,0,0,114,153,0,0,
+    0,114,154,0,0,0,114,100,0,0,0,114,80,0,0,0,
+    114,31,0,0,0,114,31,0,0,0,114,31,0,0,0,114,
+    33,0,0,0,114,19,0,0,0,129,2,0,0,115,20,0,
+    0,0,8,2,4,10,2,1,10,3,10,7,8,8,8,4,
+    8,4,8,4,8,5,99,0,0,0,0,0,0,0,0,0,
+    0,0,0,2,0,0,0,64,0,0,0,115,40,0,0,0,
+    101,0,90,1,100,0,90,2,100,1,90,3,100,2,100,3,
+    132,0,90,4,100,4,100,5,132,0,90,5,100,6,100,7,
+    132,0,90,6,100,8,83,0,41,9,114,21,0,0,0,169,
+    1,218,8,95,109,97,112,112,105,110,103,99,2,0,0,0,
+    0,0,0,0,2,0,0,0,2,0,0,0,67,0,0,0,
+    115,10,0,0,0,124,1,124,0,95,0,100,0,83,0,114,
+    32,0,0,0,114,156,0,0,0,41,2,114,46,0,0,0,
+    90,7,109,97,112,112,105,110,103,114,31,0,0,0,114,31,
+    0,0,0,114,33,0,0,0,218,8,95,95,105,110,105,116,
+    95,95,186,2,0,0,115,2,0,0,0,0,1,122,20,77,
+    97,112,112,105,110,103,86,105,101,119,46,95,95,105,110,105,
+    116,95,95,99,1,0,0,0,0,0,0,0,1,0,0,0,
+    2,0,0,0,67,0,0,0,115,10,0,0,0,116,0,124,
+    0,106,1,131,1,83,0,114,32,0,0,0,41,2,114,91,
+    0,0,0,114,157,0,0,0,114,45,0,0,0,114,31,0,
+    0,0,114,31,0,0,0,114,33,0,0,0,114,81,0,0,
+    0,189,2,0,0,115,2,0,0,0,0,1,122,19,77,97,
+    112,112,105,110,103,86,105,101,119,46,95,95,108,101,110,95,
+    95,99,1,0,0,0,0,0,0,0,1,0,0,0,3,0,
+    0,0,67,0,0,0,115,10,0,0,0,100,1,160,0,124,
+    0,161,1,83,0,41,2,78,122,38,123,48,46,95,95,99,
+    108,97,115,115,95,95,46,95,95,110,97,109,101,95,95,125,
+    40,123,48,46,95,109,97,112,112,105,110,103,33,114,125,41,
+    41,1,218,6,102,111,114,109,97,116,114,45,0,0,0,114,
+    31,0,0,0,114,31,0,0,0,114,33,0,0,0,218,8,
+    95,95,114,101,112,114,95,95,192,2,0,0,115,2,0,0,
+    0,0,1,122,20,77,97,112,112,105,110,103,86,105,101,119,
+    46,95,95,114,101,112,114,95,95,78,41,7,114,51,0,0,
+    0,114,52,0,0,0,114,53,0,0,0,114,54,0,0,0,
+    114,158,0,0,0,114,81,0,0,0,114,160,0,0,0,114,
+    31,0,0,0,114,31,0,0,0,114,31,0,0,0,114,33,
+    0,0,0,114,21,0,0,0,182,2,0,0,115,8,0,0,
+    0,8,2,4,2,8,3,8,3,99,0,0,0,0,0,0,
+    0,0,0,0,0,0,3,0,0,0,64,0,0,0,115,44,
+    0,0,0,101,0,90,1,100,0,90,2,100,1,90,3,101,
+    4,100,2,100,3,132,0,131,1,90,5,100,4,100,5,132,
+    0,90,6,100,6,100,7,132,0,90,7,100,8,83,0,41,
+    9,114,22,0,0,0,114,31,0,0,0,99,2,0,0,0,
+    0,0,0,0,2,0,0,0,2,0,0,0,67,0,0,0,
+    115,8,0,0,0,116,0,124,1,131,1,83,0,114,32,0,
+    0,0,169,1,218,3,115,101,116,169,2,114,46,0,0,0,
+    114,101,0,0,0,114,31,0,0,0,114,31,0,0,0,114,
+    33,0,0,0,114,102,0,0,0,200,2,0,0,115,2,0,
+    0,0,0,2,122,23,75,101,121,115,86,105,101,119,46,95,
+    102,114,111,109,95,105,116,101,114,97,98,108,101,99,2,0,
+    0,0,0,0,0,0,2,0,0,0,2,0,0,0,67,0,
+    0,0,115,10,0,0,0,124,1,124,0,106,0,107,6,83,
+    0,114,32,0,0,0,114,156,0,0,0,114,146,0,0,0,
+    114,31,0,0,0,114,31,0,0,0,114,33,0,0,0,114,
+    84,0,0,0,204,2,0,0,115,2,0,0,0,0,1,122,
+    21,75,101,121,115,86,105,101,119,46,95,95,99,111,110,116,
+    97,105,110,115,95,95,99,1,0,0,0,0,0,0,0,1,
+    0,0,0,2,0,0,0,99,0,0,0,115,16,0,0,0,
+    124,0,106,0,69,0,100,0,72,0,1,0,100,0,83,0,
+    114,32,0,0,0,114,156,0,0,0,114,45,0,0,0,114,
+    31,0,0,0,114,31,0,0,0,114,33,0,0,0,114,78,
+    0,0,0,207,2,0,0,115,2,0,0,0,0,1,122,17,
+    75,101,121,115,86,105,101,119,46,95,95,105,116,101,114,95,
+    95,78,169,8,114,51,0,0,0,114,52,0,0,0,114,53,
+    0,0,0,114,54,0,0,0,114,55,0,0,0,114,102,0,
+    0,0,114,84,0,0,0,114,78,0,0,0,114,31,0,0,
+    0,114,31,0,0,0,114,31,0,0,0,114,33,0,0,0,
+    114,22,0,0,0,196,2,0,0,115,10,0,0,0,8,2,
+    4,2,2,1,10,3,8,3,99,0,0,0,0,0,0,0,
+    0,0,0,0,0,3,0,0,0,64,0,0,0,115,44,0,
+    0,0,101,0,90,1,100,0,90,2,100,1,90,3,101,4,
+    100,2,100,3,132,0,131,1,90,5,100,4,100,5,132,0,
+    90,6,100,6,100,7,132,0,90,7,100,8,83,0,41,9,
+    114,23,0,0,0,114,31,0,0,0,99,2,0,0,0,0,
+    0,0,0,2,0,0,0,2,0,0,0,67,0,0,0,115,
+    8,0,0,0,116,0,124,1,131,1,83,0,114,32,0,0,
+    0,114,161,0,0,0,114,163,0,0,0,114,31,0,0,0,
+    114,31,0,0,0,114,33,0,0,0,114,102,0,0,0,217,
+    2,0,0,115,2,0,0,0,0,2,122,24,73,116,101,109,
+    115,86,105,101,119,46,95,102,114,111,109,95,105,116,101,114,
+    97,98,108,101,99,2,0,0,0,0,0,0,0,5,0,0,
+    0,8,0,0,0,67,0,0,0,115,66,0,0,0,124,1,
+    92,2,125,2,125,3,122,14,124,0,106,0,124,2,25,0,
+    125,4,87,0,110,22,4,0,116,1,107,10,114,44,1,0,
+    1,0,1,0,89,0,100,1,83,0,88,0,124,4,124,3,
+    107,8,112,60,124,4,124,3,107,2,83,0,100,0,83,0,
+    114,82,0,0,0,41,2,114,157,0,0,0,114,134,0,0,
+    0,41,5,114,46,0,0,0,90,4,105,116,101,109,114,147,
+    0,0,0,114,60,0,0,0,218,1,118,114,31,0,0,0,
+    114,31,0,0,0,114,33,0,0,0,114,84,0,0,0,221,
+    2,0,0,115,12,0,0,0,0,1,8,1,2,1,14,1,
+    14,1,8,2,122,22,73,116,101,109,115,86,105,101,119,46,
+    95,95,99,111,110,116,97,105,110,115,95,95,99,1,0,0,
+    0,0,0,0,0,2,0,0,0,4,0,0,0,99,0,0,
+    0,115,32,0,0,0,124,0,106,0,68,0,93,20,125,1,
+    124,1,124,0,106,0,124,1,25,0,102,2,86,0,1,0,
+    113,6,100,0,83,0,114,32,0,0,0,114,156,0,0,0,
+    114,146,0,0,0,114,31,0,0,0,114,31,0,0,0,114,
+    33,0,0,0,114,78,0,0,0,230,2,0,0,115,4,0,
+    0,0,0,1,10,1,122,18,73,116,101,109,115,86,105,101,
+    119,46,95,95,105,116,101,114,95,95,78,114,164,0,0,0,
+    114,31,0,0,0,114,31,0,0,0,114,31,0,0,0,114,
+    33,0,0,0,114,23,0,0,0,213,2,0,0,115,10,0,
+    0,0,8,2,4,2,2,1,10,3,8,9,99,0,0,0,
+    0,0,0,0,0,0,0,0,0,2,0,0,0,64,0,0,
+    0,115,32,0,0,0,101,0,90,1,100,0,90,2,100,1,
+    90,3,100,2,100,3,132,0,90,4,100,4,100,5,132,0,
+    90,5,100,6,83,0,41,7,114,24,0,0,0,114,31,0,
+    0,0,99,2,0,0,0,0,0,0,0,4,0,0,0,3,
+    0,0,0,67,0,0,0,115,48,0,0,0,124,0,106,0,
+    68,0,93,36,125,2,124,0,106,0,124,2,25,0,125,3,
+    124,3,124,1,107,8,115,36,124,3,124,1,107,2,114,6,
+    1,0,100,1,83,0,113,6,100,2,83,0,169,3,78,84,
+    70,114,156,0,0,0,41,4,114,46,0,0,0,114,60,0,
+    0,0,114,147,0,0,0,114,165,0,0,0,114,31,0,0,
+    0,114,31,0,0,0,114,33,0,0,0,114,84,0,0,0,
+    241,2,0,0,115,10,0,0,0,0,1,10,1,10,1,16,
+    1,8,1,122,23,86,97,108,117,101,115,86,105,101,119,46,
+    95,95,99,111,110,116,97,105,110,115,95,95,99,1,0,0,
+    0,0,0,0,0,2,0,0,0,3,0,0,0,99,0,0,
+    0,115,28,0,0,0,124,0,106,0,68,0,93,16,125,1,
+    124,0,106,0,124,1,25,0,86,0,1,0,113,6,100,0,
+    83,0,114,32,0,0,0,114,156,0,0,0,114,146,0,0,
+    0,114,31,0,0,0,114,31,0,0,0,114,33,0,0,0,
+    114,78,0,0,0,248,2,0,0,115,4,0,0,0,0,1,
+    10,1,122,19,86,97,108,117,101,115,86,105,101,119,46,95,
+    95,105,116,101,114,95,95,78,41,6,114,51,0,0,0,114,
+    52,0,0,0,114,53,0,0,0,114,54,0,0,0,114,84,
+    0,0,0,114,78,0,0,0,114,31,0,0,0,114,31,0,
+    0,0,114,31,0,0,0,114,33,0,0,0,114,24,0,0,
+    0,237,2,0,0,115,6,0,0,0,8,2,4,2,8,7,
+    99,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,
+    0,64,0,0,0,115,92,0,0,0,101,0,90,1,100,0,
+    90,2,100,1,90,3,101,4,100,2,100,3,132,0,131,1,
+    90,5,101,4,100,4,100,5,132,0,131,1,90,6,101,7,
+    131,0,90,8,101,8,102,1,100,6,100,7,132,1,90,9,
+    100,8,100,9,132,0,90,10,100,10,100,11,132,0,90,11,
+    100,12,100,13,132,0,90,12,100,17,100,15,100,16,132,1,
+    90,13,100,14,83,0,41,18,114,20,0,0,0,114,31,0,
+    0,0,99,3,0,0,0,0,0,0,0,3,0,0,0,1,
+    0,0,0,67,0,0,0,115,8,0,0,0,116,0,130,1,
+    100,0,83,0,114,32,0,0,0,114,145,0,0,0,169,3,
+    114,46,0,0,0,114,147,0,0,0,114,60,0,0,0,114,
+    31,0,0,0,114,31,0,0,0,114,33,0,0,0,218,11,
+    95,95,115,101,116,105,116,101,109,95,95,12,3,0,0,115,
+    2,0,0,0,0,2,122,26,77,117,116,97,98,108,101,77,
+    97,112,112,105,110,103,46,95,95,115,101,116,105,116,101,109,
+    95,95,99,2,0,0,0,0,0,0,0,2,0,0,0,1,
+    0,0,0,67,0,0,0,115,8,0,0,0,116,0,130,1,
+    100,0,83,0,114,32,0,0,0,114,145,0,0,0,114,146,
+    0,0,0,114,31,0,0,0,114,31,0,0,0,114,33,0,
+    0,0,218,11,95,95,100,101,108,105,116,101,109,95,95,16,
+    3,0,0,115,2,0,0,0,0,2,122,26,77,117,116,97,
+    98,108,101,77,97,112,112,105,110,103,46,95,95,100,101,108,
+    105,116,101,109,95,95,99,3,0,0,0,0,0,0,0,4,
+    0,0,0,8,0,0,0,67,0,0,0,115,64,0,0,0,
+    122,12,124,0,124,1,25,0,125,3,87,0,110,36,4,0,
+    116,0,107,10,114,48,1,0,1,0,1,0,124,2,124,0,
+    106,1,107,8,114,40,130,0,124,2,6,0,89,0,83,0,
+    88,0,124,0,124,1,61,0,124,3,83,0,100,1,83,0,
+    41,2,122,169,68,46,112,111,112,40,107,91,44,100,93,41,
+    32,45,62,32,118,44,32,114,101,109,111,118,101,32,115,112,
+    101,99,105,102,105,101,100,32,107,101,121,32,97,110,100,32,
+    114,101,116,117,114,110,32,116,104,101,32,99,111,114,114,101,
+    115,112,111,110,100,105,110,103,32,118,97,108,117,101,46,10,
+    32,32,32,32,32,32,32,32,32,32,73,102,32,107,101,121,
+    32,105,115,32,110,111,116,32,102,111,117,110,100,44,32,100,
+    32,105,115,32,114,101,116,117,114,110,101,100,32,105,102,32,
+    103,105,118,101,110,44,32,111,116,104,101,114,119,105,115,101,
+    32,75,101,121,69,114,114,111,114,32,105,115,32,114,97,105,
+    115,101,100,46,10,32,32,32,32,32,32,32,32,78,41,2,
+    114,134,0,0,0,218,23,95,77,117,116,97,98,108,101,77,
+    97,112,112,105,110,103,95,95,109,97,114,107,101,114,41,4,
+    114,46,0,0,0,114,147,0,0,0,114,150,0,0,0,114,
+    60,0,0,0,114,31,0,0,0,114,31,0,0,0,114,33,
+    0,0,0,114,139,0,0,0,22,3,0,0,115,16,0,0,
+    0,0,4,2,1,12,1,14,1,10,1,2,1,10,2,6,
+    1,122,18,77,117,116,97,98,108,101,77,97,112,112,105,110,
+    103,46,112,111,112,99,1,0,0,0,0,0,0,0,3,0,
+    0,0,8,0,0,0,67,0,0,0,115,66,0,0,0,122,
+    16,116,0,116,1,124,0,131,1,131,1,125,1,87,0,110,
+    26,4,0,116,2,107,10,114,42,1,0,1,0,1,0,116,
+    3,100,1,130,2,89,0,110,2,88,0,124,0,124,1,25,
+    0,125,2,124,0,124,1,61,0,124,1,124,2,102,2,83,
+    0,41,2,122,131,68,46,112,111,112,105,116,101,109,40,41,
+    32,45,62,32,40,107,44,32,118,41,44,32,114,101,109,111,
+    118,101,32,97,110,100,32,114,101,116,117,114,110,32,115,111,
+    109,101,32,40,107,101,121,44,32,118,97,108,117,101,41,32,
+    112,97,105,114,10,32,32,32,32,32,32,32,32,32,32,32,
+    97,115,32,97,32,50,45,116,117,112,108,101,59,32,98,117,
+    116,32,114,97,105,115,101,32,75,101,121,69,114,114,111,114,
+    32,105,102,32,68,32,105,115,32,101,109,112,116,121,46,10,
+    32,32,32,32,32,32,32,32,78,41,4,114,137,0,0,0,
+    114,136,0,0,0,114,58,0,0,0,114,134,0,0,0,114,
+    167,0,0,0,114,31,0,0,0,114,31,0,0,0,114,33,
+    0,0,0,218,7,112,111,112,105,116,101,109,36,3,0,0,
+    115,14,0,0,0,0,4,2,1,16,1,14,1,12,1,8,
+    1,6,1,122,22,77,117,116,97,98,108,101,77,97,112,112,
+    105,110,103,46,112,111,112,105,116,101,109,99,1,0,0,0,
+    0,0,0,0,1,0,0,0,8,0,0,0,67,0,0,0,
+    115,40,0,0,0,122,14,124,0,160,0,161,0,1,0,113,
+    2,87,0,110,20,4,0,116,1,107,10,114,34,1,0,1,
+    0,1,0,89,0,110,2,88,0,100,1,83,0,41,2,122,
+    44,68,46,99,108,101,97,114,40,41,32,45,62,32,78,111,
+    110,101,46,32,32,82,101,109,111,118,101,32,97,108,108,32,
+    105,116,101,109,115,32,102,114,111,109,32,68,46,78,41,2,
+    114,171,0,0,0,114,134,0,0,0,114,45,0,0,0,114,
+    31,0,0,0,114,31,0,0,0,114,33,0,0,0,114,140,
+    0,0,0,48,3,0,0,115,8,0,0,0,0,2,2,2,
+    14,1,14,1,122,20,77,117,116,97,98,108,101,77,97,112,
+    112,105,110,103,46,99,108,101,97,114,99,0,0,0,0,0,
+    0,0,0,6,0,0,0,4,0,0,0,79,0,0,0,115,
+    184,0,0,0,124,0,115,12,116,0,100,1,131,1,130,1,
+    124,0,94,1,125,2,125,0,116,1,124,0,131,1,100,2,
+    107,4,114,48,116,0,100,3,116,1,124,0,131,1,22,0,
+    131,1,130,1,124,0,114,154,124,0,100,4,25,0,125,3,
+    116,2,124,3,116,3,131,2,114,94,124,3,68,0,93,16,
+    125,4,124,3,124,4,25,0,124,2,124,4,60,0,113,74,
+    110,60,116,4,124,3,100,5,131,2,114,132,124,3,160,5,
+    161,0,68,0,93,16,125,4,124,3,124,4,25,0,124,2,
+    124,4,60,0,113,112,110,22,124,3,68,0,93,16,92,2,
+    125,4,125,5,124,5,124,2,124,4,60,0,113,136,124,1,
+    160,6,161,0,68,0,93,16,92,2,125,4,125,5,124,5,
+    124,2,124,4,60,0,113,162,100,6,83,0,41,7,97,75,
+    1,0,0,32,68,46,117,112,100,97,116,101,40,91,69,44,
+    32,93,42,42,70,41,32,45,62,32,78,111,110,101,46,32,
+    32,85,112,100,97,116,101,32,68,32,102,114,111,109,32,109,
+    97,112,112,105,110,103,47,105,116,101,114,97,98,108,101,32,
+    69,32,97,110,100,32,70,46,10,32,32,32,32,32,32,32,
+    32,32,32,32,32,73,102,32,69,32,112,114,101,115,101,110,
+    116,32,97,110,100,32,104,97,115,32,97,32,46,107,101,121,
+    115,40,41,32,109,101,116,104,111,100,44,32,100,111,101,115,
+    58,32,32,32,32,32,102,111,114,32,107,32,105,110,32,69,
+    58,32,68,91,107,93,32,61,32,69,91,107,93,10,32,32,
+    32,32,32,32,32,32,32,32,32,32,73,102,32,69,32,112,
+    114,101,115,101,110,116,32,97,110,100,32,108,97,99,107,115,
+    32,46,107,101,121,115,40,41,32,109,101,116,104,111,100,44,
+    32,100,111,101,115,58,32,32,32,32,32,102,111,114,32,40,
+    107,44,32,118,41,32,105,110,32,69,58,32,68,91,107,93,
+    32,61,32,118,10,32,32,32,32,32,32,32,32,32,32,32,
+    32,73,110,32,101,105,116,104,101,114,32,99,97,115,101,44,
+    32,116,104,105,115,32,105,115,32,102,111,108,108,111,119,101,
+    100,32,98,121,58,32,102,111,114,32,107,44,32,118,32,105,
+    110,32,70,46,105,116,101,109,115,40,41,58,32,68,91,107,
+    93,32,61,32,118,10,32,32,32,32,32,32,32,32,122,64,
+    100,101,115,99,114,105,112,116,111,114,32,39,117,112,100,97,
+    116,101,39,32,111,102,32,39,77,117,116,97,98,108,101,77,
+    97,112,112,105,110,103,39,32,111,98,106,101,99,116,32,110,
+    101,101,100,115,32,97,110,32,97,114,103,117,109,101,110,116,
+    114,29,0,0,0,122,43,117,112,100,97,116,101,32,101,120,
+    112,101,99,116,101,100,32,97,116,32,109,111,115,116,32,49,
+    32,97,114,103,117,109,101,110,116,115,44,32,103,111,116,32,
+    37,100,114,0,0,0,0,114,152,0,0,0,78,41,7,218,
+    9,84,121,112,101,69,114,114,111,114,114,91,0,0,0,114,
+    90,0,0,0,114,19,0,0,0,218,7,104,97,115,97,116,
+    116,114,114,152,0,0,0,114,153,0,0,0,41,6,114,85,
+    0,0,0,114,86,0,0,0,114,46,0,0,0,114,93,0,
+    0,0,114,147,0,0,0,114,60,0,0,0,114,31,0,0,
+    0,114,31,0,0,0,114,33,0,0,0,218,6,117,112,100,
+    97,116,101,56,3,0,0,115,38,0,0,0,0,6,4,1,
+    8,2,8,1,12,1,4,1,6,255,6,2,4,1,8,1,
+    10,1,8,1,16,1,10,1,12,1,16,2,12,1,10,1,
+    16,1,122,21,77,117,116,97,98,108,101,77,97,112,112,105,
+    110,103,46,117,112,100,97,116,101,78,99,3,0,0,0,0,
+    0,0,0,3,0,0,0,8,0,0,0,67,0,0,0,115,
+    44,0,0,0,122,10,124,0,124,1,25,0,87,0,83,0,
+    4,0,116,0,107,10,114,38,1,0,1,0,1,0,124,2,
+    124,0,124,1,60,0,89,0,110,2,88,0,124,2,83,0,
+    41,1,122,64,68,46,115,101,116,100,101,102,97,117,108,116,
+    40,107,91,44,100,93,41,32,45,62,32,68,46,103,101,116,
+    40,107,44,100,41,44,32,97,108,115,111,32,115,101,116,32,
+    68,91,107,93,61,100,32,105,102,32,107,32,110,111,116,32,
+    105,110,32,68,114,145,0,0,0,114,149,0,0,0,114,31,
+    0,0,0,114,31,0,0,0,114,33,0,0,0,218,10,115,
+    101,116,100,101,102,97,117,108,116,83,3,0,0,115,10,0,
+    0,0,0,2,2,1,10,1,14,1,14,1,122,25,77,117,
+    116,97,98,108,101,77,97,112,112,105,110,103,46,115,101,116,
+    100,101,102,97,117,108,116,41,1,78,41,14,114,51,0,0,
+    0,114,52,0,0,0,114,53,0,0,0,114,54,0,0,0,
+    114,2,0,0,0,114,168,0,0,0,114,169,0,0,0,218,
+    6,111,98,106,101,99,116,114,170,0,0,0,114,139,0,0,
+    0,114,171,0,0,0,114,140,0,0,0,114,174,0,0,0,
+    114,175,0,0,0,114,31,0,0,0,114,31,0,0,0,114,
+    31,0,0,0,114,33,0,0,0,114,20,0,0,0,255,2,
+    0,0,115,22,0,0,0,8,2,4,11,2,1,10,3,2,
+    1,10,3,6,2,12,14,8,12,8,8,8,27,99,0,0,
+    0,0,0,0,0,0,0,0,0,0,3,0,0,0,64,0,
+    0,0,115,74,0,0,0,101,0,90,1,100,0,90,2,100,
+    1,90,3,100,2,90,4,101,5,100,3,100,4,132,0,131,
+    1,90,6,100,5,100,6,132,0,90,7,100,7,100,8,132,
+    0,90,8,100,9,100,10,132,0,90,9,100,17,100,13,100,
+    14,132,1,90,10,100,15,100,16,132,0,90,11,100,12,83,
+    0,41,18,114,25,0,0,0,122,138,65,108,108,32,116,104,
+    101,32,111,112,101,114,97,116,105,111,110,115,32,111,110,32,
+    97,32,114,101,97,100,45,111,110,108,121,32,115,101,113,117,
+    101,110,99,101,46,10,10,32,32,32,32,67,111,110,99,114,
+    101,116,101,32,115,117,98,99,108,97,115,115,101,115,32,109,
+    117,115,116,32,111,118,101,114,114,105,100,101,32,95,95,110,
+    101,119,95,95,32,111,114,32,95,95,105,110,105,116,95,95,
+    44,10,32,32,32,32,95,95,103,101,116,105,116,101,109,95,
+    95,44,32,97,110,100,32,95,95,108,101,110,95,95,46,10,
+    32,32,32,32,114,31,0,0,0,99,2,0,0,0,0,0,
+    0,0,2,0,0,0,1,0,0,0,67,0,0,0,115,8,
+    0,0,0,116,0,130,1,100,0,83,0,114,32,0,0,0,
+    169,1,218,10,73,110,100,101,120,69,114,114,111,114,169,2,
+    114,46,0,0,0,218,5,105,110,100,101,120,114,31,0,0,
+    0,114,31,0,0,0,114,33,0,0,0,114,148,0,0,0,
+    107,3,0,0,115,2,0,0,0,0,2,122,20,83,101,113,
+    117,101,110,99,101,46,95,95,103,101,116,105,116,101,109,95,
+    95,99,1,0,0,0,0,0,0,0,3,0,0,0,8,0,
+    0,0,99,0,0,0,115,60,0,0,0,100,1,125,1,122,
+    28,124,0,124,1,25,0,125,2,124,2,86,0,1,0,124,
+    1,100,2,55,0,125,1,113,6,87,0,110,22,4,0,116,
+    0,107,10,114,54,1,0,1,0,1,0,89,0,100,0,83,
+    0,88,0,100,0,83,0,41,3,78,114,0,0,0,0,114,
+    29,0,0,0,114,177,0,0,0,41,3,114,46,0,0,0,
+    218,1,105,114,165,0,0,0,114,31,0,0,0,114,31,0,
+    0,0,114,33,0,0,0,114,78,0,0,0,111,3,0,0,
+    115,14,0,0,0,0,1,4,1,2,2,8,1,6,1,14,
+    1,14,1,122,17,83,101,113,117,101,110,99,101,46,95,95,
+    105,116,101,114,95,95,99,2,0,0,0,0,0,0,0,3,
+    0,0,0,3,0,0,0,67,0,0,0,115,36,0,0,0,
+    124,0,68,0,93,26,125,2,124,2,124,1,107,8,115,24,
+    124,2,124,1,107,2,114,4,1,0,100,1,83,0,113,4,
+    100,2,83,0,114,166,0,0,0,114,31,0,0,0,41,3,
+    114,46,0,0,0,114,60,0,0,0,114,165,0,0,0,114,
+    31,0,0,0,114,31,0,0,0,114,33,0,0,0,114,84,
+    0,0,0,121,3,0,0,115,8,0,0,0,0,1,8,1,
+    16,1,8,1,122,21,83,101,113,117,101,110,99,101,46,95,
+    95,99,111,110,116,97,105,110,115,95,95,99,1,0,0,0,
+    0,0,0,0,2,0,0,0,4,0,0,0,99,0,0,0,
+    115,36,0,0,0,116,0,116,1,116,2,124,0,131,1,131,
+    1,131,1,68,0,93,14,125,1,124,0,124,1,25,0,86,
+    0,1,0,113,16,100,0,83,0,114,32,0,0,0,41,3,
+    218,8,114,101,118,101,114,115,101,100,218,5,114,97,110,103,
+    101,114,91,0,0,0,41,2,114,46,0,0,0,114,181,0,
+    0,0,114,31,0,0,0,114,31,0,0,0,114,33,0,0,
+    0,114,80,0,0,0,127,3,0,0,115,4,0,0,0,0,
+    1,20,1,122,21,83,101,113,117,101,110,99,101,46,95,95,
+    114,101,118,101,114,115,101,100,95,95,114,0,0,0,0,78,
+    99,4,0,0,0,0,0,0,0,6,0,0,0,8,0,0,
+    0,67,0,0,0,115,160,0,0,0,124,2,100,1,107,9,
+    114,34,124,2,100,2,107,0,114,34,116,0,116,1,124,0,
+    131,1,124,2,23,0,100,2,131,2,125,2,124,3,100,1,
+    107,9,114,62,124,3,100,2,107,0,114,62,124,3,116,1,
+    124,0,131,1,55,0,125,3,124,2,125,4,124,3,100,1,
+    107,8,115,82,124,4,124,3,107,0,114,152,122,34,124,0,
+    124,4,25,0,125,5,124,5,124,1,107,8,115,108,124,5,
+    124,1,107,2,114,114,124,4,87,0,83,0,87,0,110,24,
+    4,0,116,2,107,10,114,140,1,0,1,0,1,0,89,0,
+    113,152,89,0,110,2,88,0,124,4,100,3,55,0,125,4,
+    113,66,116,3,130,1,100,1,83,0,41,4,122,230,83,46,
+    105,110,100,101,120,40,118,97,108,117,101,44,32,91,115,116,
+    97,114,116,44,32,91,115,116,111,112,93,93,41,32,45,62,
+    32,105,110,116,101,103,101,114,32,45,45,32,114,101,116,117,
+    114,110,32,102,105,114,115,116,32,105,110,100,101,120,32,111,
+    102,32,118,97,108,117,101,46,10,32,32,32,32,32,32,32,
+    32,32,32,32,82,97,105,115,101,115,32,86,97,108,117,101,
+    69,114,114,111,114,32,105,102,32,116,104,101,32,118,97,108,
+    117,101,32,105,115,32,110,111,116,32,112,114,101,115,101,110,
+    116,46,10,10,32,32,32,32,32,32,32,32,32,32,32,83,
+    117,112,112,111,114,116,105,110,103,32,115,116,97,114,116,32,
+    97,110,100,32,115,116,111,112,32,97,114,103,117,109,101,110,
+    116,115,32,105,115,32,111,112,116,105,111,110,97,108,44,32,
+    98,117,116,10,32,32,32,32,32,32,32,32,32,32,32,114,
+    101,99,111,109,109,101,110,100,101,100,46,10,32,32,32,32,
+    32,32,32,32,78,114,0,0,0,0,114,29,0,0,0,41,
+    4,218,3,109,97,120,114,91,0,0,0,114,178,0,0,0,
+    218,10,86,97,108,117,101,69,114,114,111,114,41,6,114,46,
+    0,0,0,114,60,0,0,0,218,5,115,116,97,114,116,218,
+    4,115,116,111,112,114,181,0,0,0,114,165,0,0,0,114,
+    31,0,0,0,114,31,0,0,0,114,33,0,0,0,114,180,
+    0,0,0,131,3,0,0,115,28,0,0,0,0,7,16,1,
+    18,1,16,1,12,2,4,1,16,1,2,1,8,1,16,1,
+    10,1,14,1,10,1,10,1,122,14,83,101,113,117,101,110,
+    99,101,46,105,110,100,101,120,99,2,0,0,0,0,0,0,
+    0,2,0,0,0,4,0,0,0,3,0,0,0,115,22,0,
+    0,0,116,0,135,0,102,1,100,1,100,2,132,8,124,0,
+    68,0,131,1,131,1,83,0,41,3,122,66,83,46,99,111,
+    117,110,116,40,118,97,108,117,101,41,32,45,62,32,105,110,
+    116,101,103,101,114,32,45,45,32,114,101,116,117,114,110,32,
+    110,117,109,98,101,114,32,111,102,32,111,99,99,117,114,114,
+    101,110,99,101,115,32,111,102,32,118,97,108,117,101,99,1,
+    0,0,0,0,0,0,0,2,0,0,0,3,0,0,0,51,
+    0,0,0,115,34,0,0,0,124,0,93,26,125,1,124,1,
+    136,0,107,8,115,22,124,1,136,0,107,2,114,2,100,0,
+    86,0,1,0,113,2,100,1,83,0,41,2,114,29,0,0,
+    0,78,114,31,0,0,0,41,2,114,104,0,0,0,114,165,
+    0,0,0,169,1,114,60,0,0,0,114,31,0,0,0,114,
+    33,0,0,0,114,105,0,0,0,156,3,0,0,115,8,0,
+    0,0,4,0,2,0,8,0,8,0,122,33,83,101,113,117,
+    101,110,99,101,46,99,111,117,110,116,46,60,108,111,99,97,
+    108,115,62,46,60,103,101,110,101,120,112,114,62,41,1,218,
+    3,115,117,109,114,59,0,0,0,114,31,0,0,0,114,188,
+    0,0,0,114,33,0,0,0,218,5,99,111,117,110,116,154,
+    3,0,0,115,2,0,0,0,0,2,122,14,83,101,113,117,
+    101,110,99,101,46,99,111,117,110,116,41,2,114,0,0,0,
+    0,78,41,12,114,51,0,0,0,114,52,0,0,0,114,53,
+    0,0,0,114,126,0,0,0,114,54,0,0,0,114,2,0,
+    0,0,114,148,0,0,0,114,78,0,0,0,114,84,0,0,
+    0,114,80,0,0,0,114,180,0,0,0,114,190,0,0,0,
+    114,31,0,0,0,114,31,0,0,0,114,31,0,0,0,114,
+    33,0,0,0,114,25,0,0,0,97,3,0,0,115,18,0,
+    0,0,8,2,4,6,4,2,2,1,10,3,8,10,8,6,
+    8,4,10,23,99,0,0,0,0,0,0,0,0,0,0,0,
+    0,1,0,0,0,64,0,0,0,115,20,0,0,0,101,0,
+    90,1,100,0,90,2,100,1,90,3,100,2,90,4,100,3,
+    83,0,41,4,114,27,0,0,0,122,77,84,104,105,115,32,
+    117,110,105,102,105,101,115,32,98,121,116,101,115,32,97,110,
+    100,32,98,121,116,101,97,114,114,97,121,46,10,10,32,32,
+    32,32,88,88,88,32,83,104,111,117,108,100,32,97,100,100,
+    32,97,108,108,32,116,104,101,105,114,32,109,101,116,104,111,
+    100,115,46,10,32,32,32,32,114,31,0,0,0,78,41,5,
+    114,51,0,0,0,114,52,0,0,0,114,53,0,0,0,114,
+    126,0,0,0,114,54,0,0,0,114,31,0,0,0,114,31,
+    0,0,0,114,31,0,0,0,114,33,0,0,0,114,27,0,
+    0,0,164,3,0,0,115,4,0,0,0,8,2,4,5,99,
+    0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,
+    64,0,0,0,115,110,0,0,0,101,0,90,1,100,0,90,
+    2,100,1,90,3,101,4,100,2,100,3,132,0,131,1,90,
+    5,101,4,100,4,100,5,132,0,131,1,90,6,101,4,100,
+    6,100,7,132,0,131,1,90,7,100,8,100,9,132,0,90,
+    8,100,10,100,11,132,0,90,9,100,12,100,13,132,0,90,
+    10,100,14,100,15,132,0,90,11,100,24,100,17,100,18,132,
+    1,90,12,100,19,100,20,132,0,90,13,100,21,100,22,132,
+    0,90,14,100,23,83,0,41,25,114,26,0,0,0,114,31,
+    0,0,0,99,3,0,0,0,0,0,0,0,3,0,0,0,
+    1,0,0,0,67,0,0,0,115,8,0,0,0,116,0,130,
+    1,100,0,83,0,114,32,0,0,0,114,177,0,0,0,169,
+    3,114,46,0,0,0,114,180,0,0,0,114,60,0,0,0,
+    114,31,0,0,0,114,31,0,0,0,114,33,0,0,0,114,
+    168,0,0,0,188,3,0,0,115,2,0,0,0,0,2,122,
+    27,77,117,116,97,98,108,101,83,101,113,117,101,110,99,101,
+    46,95,95,115,101,116,105,116,101,109,95,95,99,2,0,0,
+    0,0,0,0,0,2,0,0,0,1,0,0,0,67,0,0,
+    0,115,8,0,0,0,116,0,130,1,100,0,83,0,114,32,
+    0,0,0,114,177,0,0,0,114,179,0,0,0,114,31,0,
+    0,0,114,31,0,0,0,114,33,0,0,0,114,169,0,0,
+    0,192,3,0,0,115,2,0,0,0,0,2,122,27,77,117,
+    116,97,98,108,101,83,101,113,117,101,110,99,101,46,95,95,
+    100,101,108,105,116,101,109,95,95,99,3,0,0,0,0,0,
+    0,0,3,0,0,0,1,0,0,0,67,0,0,0,115,8,
+    0,0,0,116,0,130,1,100,1,83,0,41,2,122,51,83,
+    46,105,110,115,101,114,116,40,105,110,100,101,120,44,32,118,
+    97,108,117,101,41,32,45,45,32,105,110,115,101,114,116,32,
+    118,97,108,117,101,32,98,101,102,111,114,101,32,105,110,100,
+    101,120,78,114,177,0,0,0,114,191,0,0,0,114,31,0,
+    0,0,114,31,0,0,0,114,33,0,0,0,218,6,105,110,
+    115,101,114,116,196,3,0,0,115,2,0,0,0,0,3,122,
+    22,77,117,116,97,98,108,101,83,101,113,117,101,110,99,101,
+    46,105,110,115,101,114,116,99,2,0,0,0,0,0,0,0,
+    2,0,0,0,4,0,0,0,67,0,0,0,115,20,0,0,
+    0,124,0,160,0,116,1,124,0,131,1,124,1,161,2,1,
+    0,100,1,83,0,41,2,122,58,83,46,97,112,112,101,110,
+    100,40,118,97,108,117,101,41,32,45,45,32,97,112,112,101,
+    110,100,32,118,97,108,117,101,32,116,111,32,116,104,101,32,
+    101,110,100,32,111,102,32,116,104,101,32,115,101,113,117,101,
+    110,99,101,78,41,2,114,192,0,0,0,114,91,0,0,0,
+    114,59,0,0,0,114,31,0,0,0,114,31,0,0,0,114,
+    33,0,0,0,218,6,97,112,112,101,110,100,201,3,0,0,
+    115,2,0,0,0,0,2,122,22,77,117,116,97,98,108,101,
+    83,101,113,117,101,110,99,101,46,97,112,112,101,110,100,99,
+    1,0,0,0,0,0,0,0,1,0,0,0,8,0,0,0,
+    67,0,0,0,115,40,0,0,0,122,14,124,0,160,0,161,
+    0,1,0,113,2,87,0,110,20,4,0,116,1,107,10,114,
+    34,1,0,1,0,1,0,89,0,110,2,88,0,100,1,83,
+    0,41,2,122,44,83,46,99,108,101,97,114,40,41,32,45,
+    62,32,78,111,110,101,32,45,45,32,114,101,109,111,118,101,
+    32,97,108,108,32,105,116,101,109,115,32,102,114,111,109,32,
+    83,78,41,2,114,139,0,0,0,114,178,0,0,0,114,45,
+    0,0,0,114,31,0,0,0,114,31,0,0,0,114,33,0,
+    0,0,114,140,0,0,0,205,3,0,0,115,8,0,0,0,
+    0,2,2,2,14,1,14,1,122,21,77,117,116,97,98,108,
+    101,83,101,113,117,101,110,99,101,46,99,108,101,97,114,99,
+    1,0,0,0,0,0,0,0,3,0,0,0,5,0,0,0,
+    67,0,0,0,115,72,0,0,0,116,0,124,0,131,1,125,
+    1,116,1,124,1,100,1,26,0,131,1,68,0,93,46,125,
+    2,124,0,124,1,124,2,24,0,100,2,24,0,25,0,124,
+    0,124,2,25,0,2,0,124,0,124,2,60,0,124,0,124,
+    1,124,2,24,0,100,2,24,0,60,0,113,20,100,3,83,
+    0,41,4,122,33,83,46,114,101,118,101,114,115,101,40,41,
+    32,45,45,32,114,101,118,101,114,115,101,32,42,73,78,32,
+    80,76,65,67,69,42,114,117,0,0,0,114,29,0,0,0,
+    78,41,2,114,91,0,0,0,114,183,0,0,0,41,3,114,
+    46,0,0,0,114,123,0,0,0,114,181,0,0,0,114,31,
+    0,0,0,114,31,0,0,0,114,33,0,0,0,218,7,114,
+    101,118,101,114,115,101,213,3,0,0,115,6,0,0,0,0,
+    2,8,1,16,1,122,23,77,117,116,97,98,108,101,83,101,
+    113,117,101,110,99,101,46,114,101,118,101,114,115,101,99,2,
+    0,0,0,0,0,0,0,3,0,0,0,4,0,0,0,67,
+    0,0,0,115,40,0,0,0,124,1,124,0,107,8,114,16,
+    116,0,124,1,131,1,125,1,124,1,68,0,93,14,125,2,
+    124,0,160,1,124,2,161,1,1,0,113,20,100,1,83,0,
+    41,2,122,77,83,46,101,120,116,101,110,100,40,105,116,101,
+    114,97,98,108,101,41,32,45,45,32,101,120,116,101,110,100,
+    32,115,101,113,117,101,110,99,101,32,98,121,32,97,112,112,
+    101,110,100,105,110,103,32,101,108,101,109,101,110,116,115,32,
+    102,114,111,109,32,116,104,101,32,105,116,101,114,97,98,108,
+    101,78,41,2,218,4,108,105,115,116,114,193,0,0,0,41,
+    3,114,46,0,0,0,114,154,0,0,0,114,165,0,0,0,
+    114,31,0,0,0,114,31,0,0,0,114,33,0,0,0,218,
+    6,101,120,116,101,110,100,219,3,0,0,115,8,0,0,0,
+    0,2,8,1,8,1,8,1,122,22,77,117,116,97,98,108,
+    101,83,101,113,117,101,110,99,101,46,101,120,116,101,110,100,
+    114,119,0,0,0,99,2,0,0,0,0,0,0,0,3,0,
+    0,0,2,0,0,0,67,0,0,0,115,18,0,0,0,124,
+    0,124,1,25,0,125,2,124,0,124,1,61,0,124,2,83,
+    0,41,1,122,153,83,46,112,111,112,40,91,105,110,100,101,
+    120,93,41,32,45,62,32,105,116,101,109,32,45,45,32,114,
+    101,109,111,118,101,32,97,110,100,32,114,101,116,117,114,110,
+    32,105,116,101,109,32,97,116,32,105,110,100,101,120,32,40,
+    100,101,102,97,117,108,116,32,108,97,115,116,41,46,10,32,
+    32,32,32,32,32,32,32,32,32,32,82,97,105,115,101,32,
+    73,110,100,101,120,69,114,114,111,114,32,105,102,32,108,105,
+    115,116,32,105,115,32,101,109,112,116,121,32,111,114,32,105,
+    110,100,101,120,32,105,115,32,111,117,116,32,111,102,32,114,
+    97,110,103,101,46,10,32,32,32,32,32,32,32,32,114,31,
+    0,0,0,41,3,114,46,0,0,0,114,180,0,0,0,114,
+    165,0,0,0,114,31,0,0,0,114,31,0,0,0,114,33,
+    0,0,0,114,139,0,0,0,226,3,0,0,115,6,0,0,
+    0,0,4,8,1,6,1,122,19,77,117,116,97,98,108,101,
+    83,101,113,117,101,110,99,101,46,112,111,112,99,2,0,0,
+    0,0,0,0,0,2,0,0,0,4,0,0,0,67,0,0,
+    0,115,16,0,0,0,124,0,124,0,160,0,124,1,161,1,
+    61,0,100,1,83,0,41,2,122,118,83,46,114,101,109,111,
+    118,101,40,118,97,108,117,101,41,32,45,45,32,114,101,109,
+    111,118,101,32,102,105,114,115,116,32,111,99,99,117,114,114,
+    101,110,99,101,32,111,102,32,118,97,108,117,101,46,10,32,
+    32,32,32,32,32,32,32,32,32,32,82,97,105,115,101,32,
+    86,97,108,117,101,69,114,114,111,114,32,105,102,32,116,104,
+    101,32,118,97,108,117,101,32,105,115,32,110,111,116,32,112,
+    114,101,115,101,110,116,46,10,32,32,32,32,32,32,32,32,
+    78,41,1,114,180,0,0,0,114,59,0,0,0,114,31,0,
+    0,0,114,31,0,0,0,114,33,0,0,0,114,135,0,0,
+    0,234,3,0,0,115,2,0,0,0,0,4,122,22,77,117,
+    116,97,98,108,101,83,101,113,117,101,110,99,101,46,114,101,
+    109,111,118,101,99,2,0,0,0,0,0,0,0,2,0,0,
+    0,3,0,0,0,67,0,0,0,115,14,0,0,0,124,0,
+    160,0,124,1,161,1,1,0,124,0,83,0,114,32,0,0,
+    0,41,1,114,196,0,0,0,41,2,114,46,0,0,0,114,
+    154,0,0,0,114,31,0,0,0,114,31,0,0,0,114,33,
+    0,0,0,218,8,95,95,105,97,100,100,95,95,240,3,0,
+    0,115,4,0,0,0,0,1,10,1,122,24,77,117,116,97,
+    98,108,101,83,101,113,117,101,110,99,101,46,95,95,105,97,
+    100,100,95,95,78,41,1,114,119,0,0,0,41,15,114,51,
+    0,0,0,114,52,0,0,0,114,53,0,0,0,114,54,0,
+    0,0,114,2,0,0,0,114,168,0,0,0,114,169,0,0,
+    0,114,192,0,0,0,114,193,0,0,0,114,140,0,0,0,
+    114,194,0,0,0,114,196,0,0,0,114,139,0,0,0,114,
+    135,0,0,0,114,197,0,0,0,114,31,0,0,0,114,31,
+    0,0,0,114,31,0,0,0,114,33,0,0,0,114,26,0,
+    0,0,177,3,0,0,115,28,0,0,0,8,2,4,9,2,
+    1,10,3,2,1,10,3,2,1,10,4,8,4,8,8,8,
+    6,8,7,10,8,8,6,41,75,114,126,0,0,0,90,3,
+    97,98,99,114,1,0,0,0,114,2,0,0,0,114,120,0,
+    0,0,90,7,95,95,97,108,108,95,95,114,51,0,0,0,
+    218,4,116,121,112,101,114,136,0,0,0,90,14,98,121,116,
+    101,115,95,105,116,101,114,97,116,111,114,218,9,98,121,116,
+    101,97,114,114,97,121,90,18,98,121,116,101,97,114,114,97,
+    121,95,105,116,101,114,97,116,111,114,114,152,0,0,0,90,
+    16,100,105,99,116,95,107,101,121,105,116,101,114,97,116,111,
+    114,114,154,0,0,0,90,18,100,105,99,116,95,118,97,108,
+    117,101,105,116,101,114,97,116,111,114,114,153,0,0,0,90,
+    17,100,105,99,116,95,105,116,101,109,105,116,101,114,97,116,
+    111,114,90,13,108,105,115,116,95,105,116,101,114,97,116,111,
+    114,114,182,0,0,0,90,20,108,105,115,116,95,114,101,118,
+    101,114,115,101,105,116,101,114,97,116,111,114,114,183,0,0,
+    0,90,14,114,97,110,103,101,95,105,116,101,114,97,116,111,
+    114,90,18,108,111,110,103,114,97,110,103,101,95,105,116,101,
+    114,97,116,111,114,114,162,0,0,0,90,12,115,101,116,95,
+    105,116,101,114,97,116,111,114,90,12,115,116,114,95,105,116,
+    101,114,97,116,111,114,90,14,116,117,112,108,101,95,105,116,
+    101,114,97,116,111,114,218,3,122,105,112,90,12,122,105,112,
+    95,105,116,101,114,97,116,111,114,90,9,100,105,99,116,95,
+    107,101,121,115,90,11,100,105,99,116,95,118,97,108,117,101,
+    115,90,10,100,105,99,116,95,105,116,101,109,115,114,38,0,
+    0,0,90,12,109,97,112,112,105,110,103,112,114,111,120,121,
+    90,9,103,101,110,101,114,97,116,111,114,114,35,0,0,0,
+    90,9,99,111,114,111,117,116,105,110,101,114,70,0,0,0,
+    114,36,0,0,0,90,15,97,115,121,110,99,95,103,101,110,
+    101,114,97,116,111,114,114,43,0,0,0,114,8,0,0,0,
+    114,3,0,0,0,114,4,0,0,0,90,8,114,101,103,105,
+    115,116,101,114,114,5,0,0,0,114,6,0,0,0,114,7,
+    0,0,0,114,9,0,0,0,114,10,0,0,0,114,12,0,
+    0,0,114,11,0,0,0,114,13,0,0,0,114,14,0,0,
+    0,114,16,0,0,0,114,15,0,0,0,114,17,0,0,0,
+    218,9,102,114,111,122,101,110,115,101,116,114,18,0,0,0,
+    114,19,0,0,0,114,21,0,0,0,114,22,0,0,0,114,
+    23,0,0,0,114,24,0,0,0,114,20,0,0,0,114,155,
+    0,0,0,114,25,0,0,0,218,5,116,117,112,108,101,218,
+    3,115,116,114,218,10,109,101,109,111,114,121,118,105,101,119,
+    114,27,0,0,0,218,5,98,121,116,101,115,114,26,0,0,
+    0,114,195,0,0,0,114,31,0,0,0,114,31,0,0,0,
+    114,31,0,0,0,114,33,0,0,0,218,8,60,109,111,100,
+    117,108,101,62,4,0,0,0,115,226,0,0,0,4,5,16,
+    1,8,2,4,1,2,0,2,0,2,1,2,0,2,0,2,
+    0,2,0,2,1,2,0,2,0,2,0,2,1,2,0,2,
+    1,2,0,2,1,2,0,2,0,2,0,2,1,2,0,2,
+    1,2,248,4,15,4,9,12,1,14,2,16,1,16,1,16,
+    1,12,1,16,1,16,1,20,1,14,1,12,1,12,1,14,
+    2,12,1,12,1,12,2,10,1,14,2,8,1,6,1,8,
+    1,8,1,2,2,8,1,6,1,8,1,2,5,8,12,18,
+    15,18,15,16,41,10,3,18,15,16,19,16,48,10,3,18,
+    16,16,18,10,1,10,2,10,1,10,1,10,1,10,1,10,
+    1,10,1,10,1,10,1,10,1,10,1,10,3,16,16,16,
+    47,10,3,18,15,18,14,20,10,18,18,16,127,0,10,10,
+    3,16,79,10,6,16,50,10,3,16,14,18,14,10,3,18,
+    21,10,3,18,15,10,3,16,92,10,6,18,61,10,1,10,
+    1,10,1,10,3,16,9,10,1,10,3,16,67,10,1,
+};
@@ -0,0 +1,216 @@
+/* Auto-generated by Programs/_freeze_importlib.c */
+const unsigned char _Py_M___sitebuiltins[] = {
+    99,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,
+    0,64,0,0,0,115,64,0,0,0,100,0,90,0,100,1,
+    100,2,108,1,90,1,71,0,100,3,100,4,132,0,100,4,
+    101,2,131,3,90,3,71,0,100,5,100,6,132,0,100,6,
+    101,2,131,3,90,4,71,0,100,7,100,8,132,0,100,8,
+    101,2,131,3,90,5,100,2,83,0,41,9,122,61,10,84,
+    104,101,32,111,98,106,101,99,116,115,32,117,115,101,100,32,
+    98,121,32,116,104,101,32,115,105,116,101,32,109,111,100,117,
+    108,101,32,116,111,32,97,100,100,32,99,117,115,116,111,109,
+    32,98,117,105,108,116,105,110,115,46,10,233,0,0,0,0,
+    78,99,0,0,0,0,0,0,0,0,0,0,0,0,3,0,
+    0,0,64,0,0,0,115,38,0,0,0,101,0,90,1,100,
+    0,90,2,100,1,100,2,132,0,90,3,100,3,100,4,132,
+    0,90,4,100,8,100,6,100,7,132,1,90,5,100,5,83,
+    0,41,9,218,7,81,117,105,116,116,101,114,99,3,0,0,
+    0,0,0,0,0,3,0,0,0,2,0,0,0,67,0,0,
+    0,115,16,0,0,0,124,1,124,0,95,0,124,2,124,0,
+    95,1,100,0,83,0,169,1,78,169,2,218,4,110,97,109,
+    101,218,3,101,111,102,41,3,218,4,115,101,108,102,114,4,
+    0,0,0,114,5,0,0,0,169,0,114,7,0,0,0,250,
+    22,60,102,114,111,122,101,110,32,95,115,105,116,101,98,117,
+    105,108,116,105,110,115,62,218,8,95,95,105,110,105,116,95,
+    95,14,0,0,0,115,4,0,0,0,0,1,6,1,122,16,
+    81,117,105,116,116,101,114,46,95,95,105,110,105,116,95,95,
+    99,1,0,0,0,0,0,0,0,1,0,0,0,3,0,0,
+    0,67,0,0,0,115,16,0,0,0,100,1,124,0,106,0,
+    124,0,106,1,102,2,22,0,83,0,41,2,78,122,22,85,
+    115,101,32,37,115,40,41,32,111,114,32,37,115,32,116,111,
+    32,101,120,105,116,114,3,0,0,0,169,1,114,6,0,0,
+    0,114,7,0,0,0,114,7,0,0,0,114,8,0,0,0,
+    218,8,95,95,114,101,112,114,95,95,17,0,0,0,115,2,
+    0,0,0,0,1,122,16,81,117,105,116,116,101,114,46,95,
+    95,114,101,112,114,95,95,78,99,2,0,0,0,0,0,0,
+    0,2,0,0,0,6,0,0,0,67,0,0,0,115,40,0,
+    0,0,122,14,116,0,106,1,160,2,161,0,1,0,87,0,
+    110,12,1,0,1,0,1,0,89,0,110,2,88,0,116,3,
+    124,1,131,1,130,1,100,0,83,0,114,2,0,0,0,41,
+    4,218,3,115,121,115,90,5,115,116,100,105,110,218,5,99,
+    108,111,115,101,218,10,83,121,115,116,101,109,69,120,105,116,
+    41,2,114,6,0,0,0,218,4,99,111,100,101,114,7,0,
+    0,0,114,7,0,0,0,114,8,0,0,0,218,8,95,95,
+    99,97,108,108,95,95,19,0,0,0,115,10,0,0,0,0,
+    3,2,1,14,1,6,1,6,1,122,16,81,117,105,116,116,
+    101,114,46,95,95,99,97,108,108,95,95,41,1,78,41,6,
+    218,8,95,95,110,97,109,101,95,95,218,10,95,95,109,111,
+    100,117,108,101,95,95,218,12,95,95,113,117,97,108,110,97,
+    109,101,95,95,114,9,0,0,0,114,11,0,0,0,114,16,
+    0,0,0,114,7,0,0,0,114,7,0,0,0,114,7,0,
+    0,0,114,8,0,0,0,114,1,0,0,0,13,0,0,0,
+    115,6,0,0,0,8,1,8,3,8,2,114,1,0,0,0,
+    99,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,
+    0,64,0,0,0,115,54,0,0,0,101,0,90,1,100,0,
+    90,2,100,1,90,3,100,2,90,4,100,13,100,4,100,5,
+    132,1,90,5,100,6,100,7,132,0,90,6,100,8,100,9,
+    132,0,90,7,100,10,100,11,132,0,90,8,100,12,83,0,
+    41,14,218,8,95,80,114,105,110,116,101,114,122,110,105,110,
+    116,101,114,97,99,116,105,118,101,32,112,114,111,109,112,116,
+    32,111,98,106,101,99,116,115,32,102,111,114,32,112,114,105,
+    110,116,105,110,103,32,116,104,101,32,108,105,99,101,110,115,
+    101,32,116,101,120,116,44,32,97,32,108,105,115,116,32,111,
+    102,10,32,32,32,32,99,111,110,116,114,105,98,117,116,111,
+    114,115,32,97,110,100,32,116,104,101,32,99,111,112,121,114,
+    105,103,104,116,32,110,111,116,105,99,101,46,233,23,0,0,
+    0,114,7,0,0,0,99,5,0,0,0,0,0,0,0,5,
+    0,0,0,3,0,0,0,3,0,0,0,115,52,0,0,0,
+    100,1,100,0,108,0,137,1,124,1,124,0,95,1,124,2,
+    124,0,95,2,100,0,124,0,95,3,135,0,135,1,102,2,
+    100,2,100,3,132,8,124,4,68,0,131,1,124,0,95,4,
+    100,0,83,0,41,4,78,114,0,0,0,0,99,1,0,0,
+    0,0,0,0,0,3,0,0,0,7,0,0,0,19,0,0,
+    0,115,36,0,0,0,103,0,124,0,93,28,125,1,136,0,
+    68,0,93,18,125,2,136,1,106,0,160,1,124,1,124,2,
+    161,2,145,3,113,12,113,4,83,0,114,7,0,0,0,41,
+    2,218,4,112,97,116,104,218,4,106,111,105,110,41,3,90,
+    2,46,48,218,3,100,105,114,218,8,102,105,108,101,110,97,
+    109,101,169,2,218,5,102,105,108,101,115,218,2,111,115,114,
+    7,0,0,0,114,8,0,0,0,218,10,60,108,105,115,116,
+    99,111,109,112,62,40,0,0,0,115,8,0,0,0,6,1,
+    2,1,6,0,2,254,122,37,95,80,114,105,110,116,101,114,
+    46,95,95,105,110,105,116,95,95,46,60,108,111,99,97,108,
+    115,62,46,60,108,105,115,116,99,111,109,112,62,41,5,114,
+    28,0,0,0,218,14,95,80,114,105,110,116,101,114,95,95,
+    110,97,109,101,218,14,95,80,114,105,110,116,101,114,95,95,
+    100,97,116,97,218,15,95,80,114,105,110,116,101,114,95,95,
+    108,105,110,101,115,218,19,95,80,114,105,110,116,101,114,95,
+    95,102,105,108,101,110,97,109,101,115,41,5,114,6,0,0,
+    0,114,4,0,0,0,218,4,100,97,116,97,114,27,0,0,
+    0,90,4,100,105,114,115,114,7,0,0,0,114,26,0,0,
+    0,114,8,0,0,0,114,9,0,0,0,35,0,0,0,115,
+    14,0,0,0,0,1,8,1,6,1,6,1,6,1,12,1,
+    2,255,122,17,95,80,114,105,110,116,101,114,46,95,95,105,
+    110,105,116,95,95,99,1,0,0,0,0,0,0,0,4,0,
+    0,0,10,0,0,0,67,0,0,0,115,126,0,0,0,124,
+    0,106,0,114,10,100,0,83,0,100,0,125,1,124,0,106,
+    1,68,0,93,66,125,2,122,40,116,2,124,2,100,1,131,
+    2,143,14,125,3,124,3,160,3,161,0,125,1,87,0,53,
+    0,81,0,82,0,88,0,87,0,1,0,113,88,87,0,113,
+    20,4,0,116,4,107,10,114,84,1,0,1,0,1,0,89,
+    0,113,20,88,0,113,20,124,1,115,98,124,0,106,5,125,
+    1,124,1,160,6,100,2,161,1,124,0,95,0,116,7,124,
+    0,106,0,131,1,124,0,95,8,100,0,83,0,41,3,78,
+    218,1,114,250,1,10,41,9,114,32,0,0,0,114,33,0,
+    0,0,90,4,111,112,101,110,90,4,114,101,97,100,218,7,
+    79,83,69,114,114,111,114,114,31,0,0,0,218,5,115,112,
+    108,105,116,218,3,108,101,110,90,17,95,80,114,105,110,116,
+    101,114,95,95,108,105,110,101,99,110,116,41,4,114,6,0,
+    0,0,114,34,0,0,0,114,25,0,0,0,90,2,102,112,
+    114,7,0,0,0,114,7,0,0,0,114,8,0,0,0,90,
+    7,95,95,115,101,116,117,112,44,0,0,0,115,28,0,0,
+    0,0,1,6,1,4,1,4,1,10,1,2,1,12,1,18,
+    1,10,1,14,1,8,1,4,1,6,1,12,1,122,16,95,
+    80,114,105,110,116,101,114,46,95,95,115,101,116,117,112,99,
+    1,0,0,0,0,0,0,0,1,0,0,0,3,0,0,0,
+    67,0,0,0,115,56,0,0,0,124,0,160,0,161,0,1,
+    0,116,1,124,0,106,2,131,1,124,0,106,3,107,1,114,
+    36,100,1,160,4,124,0,106,2,161,1,83,0,100,2,124,
+    0,106,5,102,1,100,3,20,0,22,0,83,0,100,0,83,
+    0,41,4,78,114,36,0,0,0,122,33,84,121,112,101,32,
+    37,115,40,41,32,116,111,32,115,101,101,32,116,104,101,32,
+    102,117,108,108,32,37,115,32,116,101,120,116,233,2,0,0,
+    0,41,6,218,15,95,80,114,105,110,116,101,114,95,95,115,
+    101,116,117,112,114,39,0,0,0,114,32,0,0,0,218,8,
+    77,65,88,76,73,78,69,83,114,23,0,0,0,114,30,0,
+    0,0,114,10,0,0,0,114,7,0,0,0,114,7,0,0,
+    0,114,8,0,0,0,114,11,0,0,0,60,0,0,0,115,
+    8,0,0,0,0,1,8,1,16,1,12,2,122,17,95,80,
+    114,105,110,116,101,114,46,95,95,114,101,112,114,95,95,99,
+    1,0,0,0,0,0,0,0,5,0,0,0,8,0,0,0,
+    67,0,0,0,115,142,0,0,0,124,0,160,0,161,0,1,
+    0,100,1,125,1,100,2,125,2,122,40,116,1,124,2,124,
+    2,124,0,106,2,23,0,131,2,68,0,93,18,125,3,116,
+    3,124,0,106,4,124,3,25,0,131,1,1,0,113,34,87,
+    0,110,24,4,0,116,5,107,10,114,80,1,0,1,0,1,
+    0,89,0,113,138,89,0,113,16,88,0,124,2,124,0,106,
+    2,55,0,125,2,100,0,125,4,124,4,100,0,107,8,114,
+    126,116,6,124,1,131,1,125,4,124,4,100,3,107,7,114,
+    96,100,0,125,4,113,96,124,4,100,4,107,2,114,16,113,
+    138,113,16,100,0,83,0,41,5,78,122,48,72,105,116,32,
+    82,101,116,117,114,110,32,102,111,114,32,109,111,114,101,44,
+    32,111,114,32,113,32,40,97,110,100,32,82,101,116,117,114,
+    110,41,32,116,111,32,113,117,105,116,58,32,114,0,0,0,
+    0,41,2,218,0,218,1,113,114,44,0,0,0,41,7,114,
+    41,0,0,0,218,5,114,97,110,103,101,114,42,0,0,0,
+    218,5,112,114,105,110,116,114,32,0,0,0,218,10,73,110,
+    100,101,120,69,114,114,111,114,218,5,105,110,112,117,116,41,
+    5,114,6,0,0,0,90,6,112,114,111,109,112,116,218,6,
+    108,105,110,101,110,111,218,1,105,90,3,107,101,121,114,7,
+    0,0,0,114,7,0,0,0,114,8,0,0,0,114,16,0,
+    0,0,67,0,0,0,115,32,0,0,0,0,1,8,1,4,
+    1,4,2,2,1,20,1,20,1,14,1,10,2,10,1,4,
+    1,8,1,8,1,8,1,6,1,8,1,122,17,95,80,114,
+    105,110,116,101,114,46,95,95,99,97,108,108,95,95,78,41,
+    2,114,7,0,0,0,114,7,0,0,0,41,9,114,17,0,
+    0,0,114,18,0,0,0,114,19,0,0,0,218,7,95,95,
+    100,111,99,95,95,114,42,0,0,0,114,9,0,0,0,114,
+    41,0,0,0,114,11,0,0,0,114,16,0,0,0,114,7,
+    0,0,0,114,7,0,0,0,114,7,0,0,0,114,8,0,
+    0,0,114,20,0,0,0,29,0,0,0,115,12,0,0,0,
+    8,1,4,3,4,2,10,9,8,16,8,7,114,20,0,0,
+    0,99,0,0,0,0,0,0,0,0,0,0,0,0,2,0,
+    0,0,64,0,0,0,115,32,0,0,0,101,0,90,1,100,
+    0,90,2,100,1,90,3,100,2,100,3,132,0,90,4,100,
+    4,100,5,132,0,90,5,100,6,83,0,41,7,218,7,95,
+    72,101,108,112,101,114,97,51,1,0,0,68,101,102,105,110,
+    101,32,116,104,101,32,98,117,105,108,116,105,110,32,39,104,
+    101,108,112,39,46,10,10,32,32,32,32,84,104,105,115,32,
+    105,115,32,97,32,119,114,97,112,112,101,114,32,97,114,111,
+    117,110,100,32,112,121,100,111,99,46,104,101,108,112,32,116,
+    104,97,116,32,112,114,111,118,105,100,101,115,32,97,32,104,
+    101,108,112,102,117,108,32,109,101,115,115,97,103,101,10,32,
+    32,32,32,119,104,101,110,32,39,104,101,108,112,39,32,105,
+    115,32,116,121,112,101,100,32,97,116,32,116,104,101,32,80,
+    121,116,104,111,110,32,105,110,116,101,114,97,99,116,105,118,
+    101,32,112,114,111,109,112,116,46,10,10,32,32,32,32,67,
+    97,108,108,105,110,103,32,104,101,108,112,40,41,32,97,116,
+    32,116,104,101,32,80,121,116,104,111,110,32,112,114,111,109,
+    112,116,32,115,116,97,114,116,115,32,97,110,32,105,110,116,
+    101,114,97,99,116,105,118,101,32,104,101,108,112,32,115,101,
+    115,115,105,111,110,46,10,32,32,32,32,67,97,108,108,105,
+    110,103,32,104,101,108,112,40,116,104,105,110,103,41,32,112,
+    114,105,110,116,115,32,104,101,108,112,32,102,111,114,32,116,
+    104,101,32,112,121,116,104,111,110,32,111,98,106,101,99,116,
+    32,39,116,104,105,110,103,39,46,10,32,32,32,32,99,1,
+    0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,67,
+    0,0,0,115,4,0,0,0,100,1,83,0,41,2,78,122,
+    72,84,121,112,101,32,104,101,108,112,40,41,32,102,111,114,
+    32,105,110,116,101,114,97,99,116,105,118,101,32,104,101,108,
+    112,44,32,111,114,32,104,101,108,112,40,111,98,106,101,99,
+    116,41,32,102,111,114,32,104,101,108,112,32,97,98,111,117,
+    116,32,111,98,106,101,99,116,46,114,7,0,0,0,114,10,
+    0,0,0,114,7,0,0,0,114,7,0,0,0,114,8,0,
+    0,0,114,11,0,0,0,98,0,0,0,115,2,0,0,0,
+    0,1,122,16,95,72,101,108,112,101,114,46,95,95,114,101,
+    112,114,95,95,99,1,0,0,0,0,0,0,0,4,0,0,
+    0,3,0,0,0,79,0,0,0,115,20,0,0,0,100,1,
+    100,0,108,0,125,3,124,3,106,1,124,1,124,2,142,1,
+    83,0,41,2,78,114,0,0,0,0,41,2,218,5,112,121,
+    100,111,99,90,4,104,101,108,112,41,4,114,6,0,0,0,
+    218,4,97,114,103,115,90,4,107,119,100,115,114,53,0,0,
+    0,114,7,0,0,0,114,7,0,0,0,114,8,0,0,0,
+    114,16,0,0,0,101,0,0,0,115,4,0,0,0,0,1,
+    8,1,122,16,95,72,101,108,112,101,114,46,95,95,99,97,
+    108,108,95,95,78,41,6,114,17,0,0,0,114,18,0,0,
+    0,114,19,0,0,0,114,51,0,0,0,114,11,0,0,0,
+    114,16,0,0,0,114,7,0,0,0,114,7,0,0,0,114,
+    7,0,0,0,114,8,0,0,0,114,52,0,0,0,88,0,
+    0,0,115,6,0,0,0,8,1,4,9,8,3,114,52,0,
+    0,0,41,6,114,51,0,0,0,114,12,0,0,0,218,6,
+    111,98,106,101,99,116,114,1,0,0,0,114,20,0,0,0,
+    114,52,0,0,0,114,7,0,0,0,114,7,0,0,0,114,
+    7,0,0,0,114,8,0,0,0,218,8,60,109,111,100,117,
+    108,101,62,1,0,0,0,115,8,0,0,0,4,10,8,2,
+    16,16,16,59,
+};
@@ -0,0 +1,331 @@
+/* Auto-generated by Programs/_freeze_importlib.c */
+const unsigned char _Py_M__abc[] = {
+    99,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,
+    0,64,0,0,0,115,186,0,0,0,100,0,90,0,100,1,
+    100,2,132,0,90,1,71,0,100,3,100,4,132,0,100,4,
+    101,2,131,3,90,3,71,0,100,5,100,6,132,0,100,6,
+    101,4,131,3,90,5,71,0,100,7,100,8,132,0,100,8,
+    101,6,131,3,90,7,122,44,100,9,100,10,108,8,109,9,
+    90,9,109,10,90,10,109,11,90,11,109,12,90,12,109,13,
+    90,13,109,14,90,14,109,15,90,15,109,16,90,16,1,0,
+    87,0,110,42,4,0,101,17,107,10,114,146,1,0,1,0,
+    1,0,100,9,100,11,108,18,109,19,90,19,109,9,90,9,
+    1,0,100,12,101,19,95,20,89,0,110,18,88,0,71,0,
+    100,13,100,14,132,0,100,14,101,21,131,3,90,19,71,0,
+    100,15,100,16,132,0,100,16,101,19,100,17,141,3,90,22,
+    100,18,83,0,41,19,122,51,65,98,115,116,114,97,99,116,
+    32,66,97,115,101,32,67,108,97,115,115,101,115,32,40,65,
+    66,67,115,41,32,97,99,99,111,114,100,105,110,103,32,116,
+    111,32,80,69,80,32,51,49,49,57,46,99,1,0,0,0,
+    0,0,0,0,1,0,0,0,2,0,0,0,67,0,0,0,
+    115,10,0,0,0,100,1,124,0,95,0,124,0,83,0,41,
+    2,97,60,2,0,0,65,32,100,101,99,111,114,97,116,111,
+    114,32,105,110,100,105,99,97,116,105,110,103,32,97,98,115,
+    116,114,97,99,116,32,109,101,116,104,111,100,115,46,10,10,
+    32,32,32,32,82,101,113,117,105,114,101,115,32,116,104,97,
+    116,32,116,104,101,32,109,101,116,97,99,108,97,115,115,32,
+    105,115,32,65,66,67,77,101,116,97,32,111,114,32,100,101,
+    114,105,118,101,100,32,102,114,111,109,32,105,116,46,32,32,
+    65,10,32,32,32,32,99,108,97,115,115,32,116,104,97,116,
+    32,104,97,115,32,97,32,109,101,116,97,99,108,97,115,115,
+    32,100,101,114,105,118,101,100,32,102,114,111,109,32,65,66,
+    67,77,101,116,97,32,99,97,110,110,111,116,32,98,101,10,
+    32,32,32,32,105,110,115,116,97,110,116,105,97,116,101,100,
+    32,117,110,108,101,115,115,32,97,108,108,32,111,102,32,105,
+    116,115,32,97,98,115,116,114,97,99,116,32,109,101,116,104,
+    111,100,115,32,97,114,101,32,111,118,101,114,114,105,100,100,
+    101,110,46,10,32,32,32,32,84,104,101,32,97,98,115,116,
+    114,97,99,116,32,109,101,116,104,111,100,115,32,99,97,110,
+    32,98,101,32,99,97,108,108,101,100,32,117,115,105,110,103,
+    32,97,110,121,32,111,102,32,116,104,101,32,110,111,114,109,
+    97,108,10,32,32,32,32,39,115,117,112,101,114,39,32,99,
+    97,108,108,32,109,101,99,104,97,110,105,115,109,115,46,32,
+    32,97,98,115,116,114,97,99,116,109,101,116,104,111,100,40,
+    41,32,109,97,121,32,98,101,32,117,115,101,100,32,116,111,
+    32,100,101,99,108,97,114,101,10,32,32,32,32,97,98,115,
+    116,114,97,99,116,32,109,101,116,104,111,100,115,32,102,111,
+    114,32,112,114,111,112,101,114,116,105,101,115,32,97,110,100,
+    32,100,101,115,99,114,105,112,116,111,114,115,46,10,10,32,
+    32,32,32,85,115,97,103,101,58,10,10,32,32,32,32,32,
+    32,32,32,99,108,97,115,115,32,67,40,109,101,116,97,99,
+    108,97,115,115,61,65,66,67,77,101,116,97,41,58,10,32,
+    32,32,32,32,32,32,32,32,32,32,32,64,97,98,115,116,
+    114,97,99,116,109,101,116,104,111,100,10,32,32,32,32,32,
+    32,32,32,32,32,32,32,100,101,102,32,109,121,95,97,98,
+    115,116,114,97,99,116,95,109,101,116,104,111,100,40,115,101,
+    108,102,44,32,46,46,46,41,58,10,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,46,46,46,10,32,32,
+    32,32,84,41,1,218,20,95,95,105,115,97,98,115,116,114,
+    97,99,116,109,101,116,104,111,100,95,95,41,1,90,7,102,
+    117,110,99,111,98,106,169,0,114,1,0,0,0,250,12,60,
+    102,114,111,122,101,110,32,97,98,99,62,218,14,97,98,115,
+    116,114,97,99,116,109,101,116,104,111,100,7,0,0,0,115,
+    4,0,0,0,0,17,6,1,114,3,0,0,0,99,0,0,
+    0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,
+    0,0,115,36,0,0,0,101,0,90,1,100,0,90,2,100,
+    1,90,3,100,2,90,4,135,0,102,1,100,3,100,4,132,
+    8,90,5,135,0,4,0,90,6,83,0,41,5,218,19,97,
+    98,115,116,114,97,99,116,99,108,97,115,115,109,101,116,104,
+    111,100,122,116,65,32,100,101,99,111,114,97,116,111,114,32,
+    105,110,100,105,99,97,116,105,110,103,32,97,98,115,116,114,
+    97,99,116,32,99,108,97,115,115,109,101,116,104,111,100,115,
+    46,10,10,32,32,32,32,68,101,112,114,101,99,97,116,101,
+    100,44,32,117,115,101,32,39,99,108,97,115,115,109,101,116,
+    104,111,100,39,32,119,105,116,104,32,39,97,98,115,116,114,
+    97,99,116,109,101,116,104,111,100,39,32,105,110,115,116,101,
+    97,100,46,10,32,32,32,32,84,99,2,0,0,0,0,0,
+    0,0,2,0,0,0,3,0,0,0,3,0,0,0,115,22,
+    0,0,0,100,1,124,1,95,0,116,1,131,0,160,2,124,
+    1,161,1,1,0,100,0,83,0,169,2,78,84,169,3,114,
+    0,0,0,0,218,5,115,117,112,101,114,218,8,95,95,105,
+    110,105,116,95,95,169,2,90,4,115,101,108,102,218,8,99,
+    97,108,108,97,98,108,101,169,1,218,9,95,95,99,108,97,
+    115,115,95,95,114,1,0,0,0,114,2,0,0,0,114,8,
+    0,0,0,36,0,0,0,115,4,0,0,0,0,1,6,1,
+    122,28,97,98,115,116,114,97,99,116,99,108,97,115,115,109,
+    101,116,104,111,100,46,95,95,105,110,105,116,95,95,169,7,
+    218,8,95,95,110,97,109,101,95,95,218,10,95,95,109,111,
+    100,117,108,101,95,95,218,12,95,95,113,117,97,108,110,97,
+    109,101,95,95,218,7,95,95,100,111,99,95,95,114,0,0,
+    0,0,114,8,0,0,0,218,13,95,95,99,108,97,115,115,
+    99,101,108,108,95,95,114,1,0,0,0,114,1,0,0,0,
+    114,11,0,0,0,114,2,0,0,0,114,4,0,0,0,28,
+    0,0,0,115,6,0,0,0,8,1,4,5,4,2,114,4,
+    0,0,0,99,0,0,0,0,0,0,0,0,0,0,0,0,
+    3,0,0,0,0,0,0,0,115,36,0,0,0,101,0,90,
+    1,100,0,90,2,100,1,90,3,100,2,90,4,135,0,102,
+    1,100,3,100,4,132,8,90,5,135,0,4,0,90,6,83,
+    0,41,5,218,20,97,98,115,116,114,97,99,116,115,116,97,
+    116,105,99,109,101,116,104,111,100,122,118,65,32,100,101,99,
+    111,114,97,116,111,114,32,105,110,100,105,99,97,116,105,110,
+    103,32,97,98,115,116,114,97,99,116,32,115,116,97,116,105,
+    99,109,101,116,104,111,100,115,46,10,10,32,32,32,32,68,
+    101,112,114,101,99,97,116,101,100,44,32,117,115,101,32,39,
+    115,116,97,116,105,99,109,101,116,104,111,100,39,32,119,105,
+    116,104,32,39,97,98,115,116,114,97,99,116,109,101,116,104,
+    111,100,39,32,105,110,115,116,101,97,100,46,10,32,32,32,
+    32,84,99,2,0,0,0,0,0,0,0,2,0,0,0,3,
+    0,0,0,3,0,0,0,115,22,0,0,0,100,1,124,1,
+    95,0,116,1,131,0,160,2,124,1,161,1,1,0,100,0,
+    83,0,114,5,0,0,0,114,6,0,0,0,114,9,0,0,
+    0,114,11,0,0,0,114,1,0,0,0,114,2,0,0,0,
+    114,8,0,0,0,49,0,0,0,115,4,0,0,0,0,1,
+    6,1,122,29,97,98,115,116,114,97,99,116,115,116,97,116,
+    105,99,109,101,116,104,111,100,46,95,95,105,110,105,116,95,
+    95,114,13,0,0,0,114,1,0,0,0,114,1,0,0,0,
+    114,11,0,0,0,114,2,0,0,0,114,19,0,0,0,41,
+    0,0,0,115,6,0,0,0,8,1,4,5,4,2,114,19,
+    0,0,0,99,0,0,0,0,0,0,0,0,0,0,0,0,
+    1,0,0,0,64,0,0,0,115,20,0,0,0,101,0,90,
+    1,100,0,90,2,100,1,90,3,100,2,90,4,100,3,83,
+    0,41,4,218,16,97,98,115,116,114,97,99,116,112,114,111,
+    112,101,114,116,121,122,111,65,32,100,101,99,111,114,97,116,
+    111,114,32,105,110,100,105,99,97,116,105,110,103,32,97,98,
+    115,116,114,97,99,116,32,112,114,111,112,101,114,116,105,101,
+    115,46,10,10,32,32,32,32,68,101,112,114,101,99,97,116,
+    101,100,44,32,117,115,101,32,39,112,114,111,112,101,114,116,
+    121,39,32,119,105,116,104,32,39,97,98,115,116,114,97,99,
+    116,109,101,116,104,111,100,39,32,105,110,115,116,101,97,100,
+    46,10,32,32,32,32,84,78,41,5,114,14,0,0,0,114,
+    15,0,0,0,114,16,0,0,0,114,17,0,0,0,114,0,
+    0,0,0,114,1,0,0,0,114,1,0,0,0,114,1,0,
+    0,0,114,2,0,0,0,114,20,0,0,0,54,0,0,0,
+    115,4,0,0,0,8,1,4,5,114,20,0,0,0,233,0,
+    0,0,0,41,8,218,15,103,101,116,95,99,97,99,104,101,
+    95,116,111,107,101,110,218,9,95,97,98,99,95,105,110,105,
+    116,218,13,95,97,98,99,95,114,101,103,105,115,116,101,114,
+    218,18,95,97,98,99,95,105,110,115,116,97,110,99,101,99,
+    104,101,99,107,218,18,95,97,98,99,95,115,117,98,99,108,
+    97,115,115,99,104,101,99,107,218,9,95,103,101,116,95,100,
+    117,109,112,218,15,95,114,101,115,101,116,95,114,101,103,105,
+    115,116,114,121,218,13,95,114,101,115,101,116,95,99,97,99,
+    104,101,115,41,2,218,7,65,66,67,77,101,116,97,114,22,
+    0,0,0,90,3,97,98,99,99,0,0,0,0,0,0,0,
+    0,0,0,0,0,3,0,0,0,0,0,0,0,115,82,0,
+    0,0,101,0,90,1,100,0,90,2,100,1,90,3,135,0,
+    102,1,100,2,100,3,132,8,90,4,100,4,100,5,132,0,
+    90,5,100,6,100,7,132,0,90,6,100,8,100,9,132,0,
+    90,7,100,17,100,11,100,12,132,1,90,8,100,13,100,14,
+    132,0,90,9,100,15,100,16,132,0,90,10,135,0,4,0,
+    90,11,83,0,41,18,114,30,0,0,0,97,144,2,0,0,
+    77,101,116,97,99,108,97,115,115,32,102,111,114,32,100,101,
+    102,105,110,105,110,103,32,65,98,115,116,114,97,99,116,32,
+    66,97,115,101,32,67,108,97,115,115,101,115,32,40,65,66,
+    67,115,41,46,10,10,32,32,32,32,32,32,32,32,85,115,
+    101,32,116,104,105,115,32,109,101,116,97,99,108,97,115,115,
+    32,116,111,32,99,114,101,97,116,101,32,97,110,32,65,66,
+    67,46,32,32,65,110,32,65,66,67,32,99,97,110,32,98,
+    101,32,115,117,98,99,108,97,115,115,101,100,10,32,32,32,
+    32,32,32,32,32,100,105,114,101,99,116,108,121,44,32,97,
+    110,100,32,116,104,101,110,32,97,99,116,115,32,97,115,32,
+    97,32,109,105,120,45,105,110,32,99,108,97,115,115,46,32,
+    32,89,111,117,32,99,97,110,32,97,108,115,111,32,114,101,
+    103,105,115,116,101,114,10,32,32,32,32,32,32,32,32,117,
+    110,114,101,108,97,116,101,100,32,99,111,110,99,114,101,116,
+    101,32,99,108,97,115,115,101,115,32,40,101,118,101,110,32,
+    98,117,105,108,116,45,105,110,32,99,108,97,115,115,101,115,
+    41,32,97,110,100,32,117,110,114,101,108,97,116,101,100,10,
+    32,32,32,32,32,32,32,32,65,66,67,115,32,97,115,32,
+    39,118,105,114,116,117,97,108,32,115,117,98,99,108,97,115,
+    115,101,115,39,32,45,45,32,116,104,101,115,101,32,97,110,
+    100,32,116,104,101,105,114,32,100,101,115,99,101,110,100,97,
+    110,116,115,32,119,105,108,108,10,32,32,32,32,32,32,32,
+    32,98,101,32,99,111,110,115,105,100,101,114,101,100,32,115,
+    117,98,99,108,97,115,115,101,115,32,111,102,32,116,104,101,
+    32,114,101,103,105,115,116,101,114,105,110,103,32,65,66,67,
+    32,98,121,32,116,104,101,32,98,117,105,108,116,45,105,110,
+    10,32,32,32,32,32,32,32,32,105,115,115,117,98,99,108,
+    97,115,115,40,41,32,102,117,110,99,116,105,111,110,44,32,
+    98,117,116,32,116,104,101,32,114,101,103,105,115,116,101,114,
+    105,110,103,32,65,66,67,32,119,111,110,39,116,32,115,104,
+    111,119,32,117,112,32,105,110,10,32,32,32,32,32,32,32,
+    32,116,104,101,105,114,32,77,82,79,32,40,77,101,116,104,
+    111,100,32,82,101,115,111,108,117,116,105,111,110,32,79,114,
+    100,101,114,41,32,110,111,114,32,119,105,108,108,32,109,101,
+    116,104,111,100,10,32,32,32,32,32,32,32,32,105,109,112,
+    108,101,109,101,110,116,97,116,105,111,110,115,32,100,101,102,
+    105,110,101,100,32,98,121,32,116,104,101,32,114,101,103,105,
+    115,116,101,114,105,110,103,32,65,66,67,32,98,101,32,99,
+    97,108,108,97,98,108,101,32,40,110,111,116,10,32,32,32,
+    32,32,32,32,32,101,118,101,110,32,118,105,97,32,115,117,
+    112,101,114,40,41,41,46,10,32,32,32,32,32,32,32,32,
+    99,4,0,0,0,0,0,0,0,6,0,0,0,5,0,0,
+    0,11,0,0,0,115,34,0,0,0,116,0,131,0,106,1,
+    124,0,124,1,124,2,124,3,102,4,124,4,142,1,125,5,
+    116,2,124,5,131,1,1,0,124,5,83,0,41,1,78,41,
+    3,114,7,0,0,0,218,7,95,95,110,101,119,95,95,114,
+    23,0,0,0,41,6,90,4,109,99,108,115,218,4,110,97,
+    109,101,90,5,98,97,115,101,115,90,9,110,97,109,101,115,
+    112,97,99,101,90,6,107,119,97,114,103,115,218,3,99,108,
+    115,114,11,0,0,0,114,1,0,0,0,114,2,0,0,0,
+    114,31,0,0,0,84,0,0,0,115,6,0,0,0,0,1,
+    22,1,8,1,122,15,65,66,67,77,101,116,97,46,95,95,
+    110,101,119,95,95,99,2,0,0,0,0,0,0,0,2,0,
+    0,0,3,0,0,0,67,0,0,0,115,10,0,0,0,116,
+    0,124,0,124,1,131,2,83,0,41,1,122,123,82,101,103,
+    105,115,116,101,114,32,97,32,118,105,114,116,117,97,108,32,
+    115,117,98,99,108,97,115,115,32,111,102,32,97,110,32,65,
+    66,67,46,10,10,32,32,32,32,32,32,32,32,32,32,32,
+    32,82,101,116,117,114,110,115,32,116,104,101,32,115,117,98,
+    99,108,97,115,115,44,32,116,111,32,97,108,108,111,119,32,
+    117,115,97,103,101,32,97,115,32,97,32,99,108,97,115,115,
+    32,100,101,99,111,114,97,116,111,114,46,10,32,32,32,32,
+    32,32,32,32,32,32,32,32,41,1,114,24,0,0,0,169,
+    2,114,33,0,0,0,90,8,115,117,98,99,108,97,115,115,
+    114,1,0,0,0,114,1,0,0,0,114,2,0,0,0,218,
+    8,114,101,103,105,115,116,101,114,89,0,0,0,115,2,0,
+    0,0,0,5,122,16,65,66,67,77,101,116,97,46,114,101,
+    103,105,115,116,101,114,99,2,0,0,0,0,0,0,0,2,
+    0,0,0,3,0,0,0,67,0,0,0,115,10,0,0,0,
+    116,0,124,0,124,1,131,2,83,0,41,1,122,39,79,118,
+    101,114,114,105,100,101,32,102,111,114,32,105,115,105,110,115,
+    116,97,110,99,101,40,105,110,115,116,97,110,99,101,44,32,
+    99,108,115,41,46,41,1,114,25,0,0,0,41,2,114,33,
+    0,0,0,90,8,105,110,115,116,97,110,99,101,114,1,0,
+    0,0,114,1,0,0,0,114,2,0,0,0,218,17,95,95,
+    105,110,115,116,97,110,99,101,99,104,101,99,107,95,95,96,
+    0,0,0,115,2,0,0,0,0,2,122,25,65,66,67,77,
+    101,116,97,46,95,95,105,110,115,116,97,110,99,101,99,104,
+    101,99,107,95,95,99,2,0,0,0,0,0,0,0,2,0,
+    0,0,3,0,0,0,67,0,0,0,115,10,0,0,0,116,
+    0,124,0,124,1,131,2,83,0,41,1,122,39,79,118,101,
+    114,114,105,100,101,32,102,111,114,32,105,115,115,117,98,99,
+    108,97,115,115,40,115,117,98,99,108,97,115,115,44,32,99,
+    108,115,41,46,41,1,114,26,0,0,0,114,34,0,0,0,
+    114,1,0,0,0,114,1,0,0,0,114,2,0,0,0,218,
+    17,95,95,115,117,98,99,108,97,115,115,99,104,101,99,107,
+    95,95,100,0,0,0,115,2,0,0,0,0,2,122,25,65,
+    66,67,77,101,116,97,46,95,95,115,117,98,99,108,97,115,
+    115,99,104,101,99,107,95,95,78,99,2,0,0,0,0,0,
+    0,0,6,0,0,0,5,0,0,0,67,0,0,0,115,140,
+    0,0,0,116,0,100,1,124,0,106,1,155,0,100,2,124,
+    0,106,2,155,0,157,4,124,1,100,3,141,2,1,0,116,
+    0,100,4,116,3,131,0,155,0,157,2,124,1,100,3,141,
+    2,1,0,116,4,124,0,131,1,92,4,125,2,125,3,125,
+    4,125,5,116,0,100,5,124,2,155,2,157,2,124,1,100,
+    3,141,2,1,0,116,0,100,6,124,3,155,2,157,2,124,
+    1,100,3,141,2,1,0,116,0,100,7,124,4,155,2,157,
+    2,124,1,100,3,141,2,1,0,116,0,100,8,124,5,155,
+    2,157,2,124,1,100,3,141,2,1,0,100,9,83,0,41,
+    10,122,39,68,101,98,117,103,32,104,101,108,112,101,114,32,
+    116,111,32,112,114,105,110,116,32,116,104,101,32,65,66,67,
+    32,114,101,103,105,115,116,114,121,46,122,7,67,108,97,115,
+    115,58,32,218,1,46,41,1,218,4,102,105,108,101,122,14,
+    73,110,118,46,32,99,111,117,110,116,101,114,58,32,122,15,
+    95,97,98,99,95,114,101,103,105,115,116,114,121,58,32,122,
+    12,95,97,98,99,95,99,97,99,104,101,58,32,122,21,95,
+    97,98,99,95,110,101,103,97,116,105,118,101,95,99,97,99,
+    104,101,58,32,122,29,95,97,98,99,95,110,101,103,97,116,
+    105,118,101,95,99,97,99,104,101,95,118,101,114,115,105,111,
+    110,58,32,78,41,5,218,5,112,114,105,110,116,114,15,0,
+    0,0,114,16,0,0,0,114,22,0,0,0,114,27,0,0,
+    0,41,6,114,33,0,0,0,114,39,0,0,0,90,13,95,
+    97,98,99,95,114,101,103,105,115,116,114,121,90,10,95,97,
+    98,99,95,99,97,99,104,101,90,19,95,97,98,99,95,110,
+    101,103,97,116,105,118,101,95,99,97,99,104,101,90,27,95,
+    97,98,99,95,110,101,103,97,116,105,118,101,95,99,97,99,
+    104,101,95,118,101,114,115,105,111,110,114,1,0,0,0,114,
+    1,0,0,0,114,2,0,0,0,218,14,95,100,117,109,112,
+    95,114,101,103,105,115,116,114,121,104,0,0,0,115,22,0,
+    0,0,0,2,28,1,20,2,6,255,8,1,2,1,18,1,
+    18,1,18,1,10,1,2,255,122,22,65,66,67,77,101,116,
+    97,46,95,100,117,109,112,95,114,101,103,105,115,116,114,121,
+    99,1,0,0,0,0,0,0,0,1,0,0,0,2,0,0,
+    0,67,0,0,0,115,12,0,0,0,116,0,124,0,131,1,
+    1,0,100,1,83,0,41,2,122,46,67,108,101,97,114,32,
+    116,104,101,32,114,101,103,105,115,116,114,121,32,40,102,111,
+    114,32,100,101,98,117,103,103,105,110,103,32,111,114,32,116,
+    101,115,116,105,110,103,41,46,78,41,1,114,28,0,0,0,
+    169,1,114,33,0,0,0,114,1,0,0,0,114,1,0,0,
+    0,114,2,0,0,0,218,19,95,97,98,99,95,114,101,103,
+    105,115,116,114,121,95,99,108,101,97,114,116,0,0,0,115,
+    2,0,0,0,0,2,122,27,65,66,67,77,101,116,97,46,
+    95,97,98,99,95,114,101,103,105,115,116,114,121,95,99,108,
+    101,97,114,99,1,0,0,0,0,0,0,0,1,0,0,0,
+    2,0,0,0,67,0,0,0,115,12,0,0,0,116,0,124,
+    0,131,1,1,0,100,1,83,0,41,2,122,44,67,108,101,
+    97,114,32,116,104,101,32,99,97,99,104,101,115,32,40,102,
+    111,114,32,100,101,98,117,103,103,105,110,103,32,111,114,32,
+    116,101,115,116,105,110,103,41,46,78,41,1,114,29,0,0,
+    0,114,42,0,0,0,114,1,0,0,0,114,1,0,0,0,
+    114,2,0,0,0,218,17,95,97,98,99,95,99,97,99,104,
+    101,115,95,99,108,101,97,114,120,0,0,0,115,2,0,0,
+    0,0,2,122,25,65,66,67,77,101,116,97,46,95,97,98,
+    99,95,99,97,99,104,101,115,95,99,108,101,97,114,41,1,
+    78,41,12,114,14,0,0,0,114,15,0,0,0,114,16,0,
+    0,0,114,17,0,0,0,114,31,0,0,0,114,35,0,0,
+    0,114,36,0,0,0,114,37,0,0,0,114,41,0,0,0,
+    114,43,0,0,0,114,44,0,0,0,114,18,0,0,0,114,
+    1,0,0,0,114,1,0,0,0,114,11,0,0,0,114,2,
+    0,0,0,114,30,0,0,0,71,0,0,0,115,16,0,0,
+    0,8,1,4,12,12,5,8,7,8,4,8,4,10,12,8,
+    4,114,30,0,0,0,99,0,0,0,0,0,0,0,0,0,
+    0,0,0,1,0,0,0,64,0,0,0,115,20,0,0,0,
+    101,0,90,1,100,0,90,2,100,1,90,3,100,2,90,4,
+    100,3,83,0,41,4,218,3,65,66,67,122,86,72,101,108,
+    112,101,114,32,99,108,97,115,115,32,116,104,97,116,32,112,
+    114,111,118,105,100,101,115,32,97,32,115,116,97,110,100,97,
+    114,100,32,119,97,121,32,116,111,32,99,114,101,97,116,101,
+    32,97,110,32,65,66,67,32,117,115,105,110,103,10,32,32,
+    32,32,105,110,104,101,114,105,116,97,110,99,101,46,10,32,
+    32,32,32,114,1,0,0,0,78,41,5,114,14,0,0,0,
+    114,15,0,0,0,114,16,0,0,0,114,17,0,0,0,90,
+    9,95,95,115,108,111,116,115,95,95,114,1,0,0,0,114,
+    1,0,0,0,114,1,0,0,0,114,2,0,0,0,114,45,
+    0,0,0,125,0,0,0,115,4,0,0,0,8,1,4,3,
+    114,45,0,0,0,41,1,90,9,109,101,116,97,99,108,97,
+    115,115,78,41,23,114,17,0,0,0,114,3,0,0,0,218,
+    11,99,108,97,115,115,109,101,116,104,111,100,114,4,0,0,
+    0,218,12,115,116,97,116,105,99,109,101,116,104,111,100,114,
+    19,0,0,0,218,8,112,114,111,112,101,114,116,121,114,20,
+    0,0,0,90,4,95,97,98,99,114,22,0,0,0,114,23,
+    0,0,0,114,24,0,0,0,114,25,0,0,0,114,26,0,
+    0,0,114,27,0,0,0,114,28,0,0,0,114,29,0,0,
+    0,218,11,73,109,112,111,114,116,69,114,114,111,114,90,7,
+    95,112,121,95,97,98,99,114,30,0,0,0,114,15,0,0,
+    0,218,4,116,121,112,101,114,45,0,0,0,114,1,0,0,
+    0,114,1,0,0,0,114,1,0,0,0,114,2,0,0,0,
+    218,8,60,109,111,100,117,108,101,62,4,0,0,0,115,22,
+    0,0,0,4,3,8,21,16,13,16,13,16,9,2,1,44,
+    3,14,1,16,1,12,2,16,54,
+};
@@ -0,0 +1,2083 @@
+/* Auto-generated by Programs/_freeze_importlib.c */
+const unsigned char _Py_M__codecs[] = {
+    99,0,0,0,0,0,0,0,0,0,0,0,0,44,0,0,
+    0,64,0,0,0,115,162,2,0,0,100,0,90,0,100,1,
+    100,2,108,1,90,1,100,1,100,2,108,2,90,2,122,12,
+    100,1,100,3,108,3,84,0,87,0,110,46,4,0,101,4,
+    107,10,114,78,1,0,90,5,1,0,122,16,101,6,100,4,
+    101,5,22,0,131,1,130,1,87,0,53,0,100,2,90,5,
+    91,5,88,0,89,0,110,2,88,0,100,5,100,6,100,7,
+    100,8,100,9,100,10,100,11,100,12,100,13,100,14,100,15,
+    100,16,100,17,100,18,100,19,100,20,100,21,100,22,100,23,
+    100,24,100,25,100,26,100,27,100,28,100,29,100,30,100,31,
+    100,32,100,33,100,34,100,35,100,36,100,37,100,38,100,39,
+    100,40,100,41,100,42,100,43,100,44,100,45,100,46,100,47,
+    100,48,103,44,90,7,100,49,90,8,100,50,4,0,90,9,
+    90,10,100,51,4,0,90,11,90,12,100,52,90,13,100,53,
+    90,14,101,2,106,15,100,54,107,2,114,224,101,10,4,0,
+    90,16,90,17,101,13,90,18,110,12,101,12,4,0,90,16,
+    90,17,101,14,90,18,101,10,90,19,101,12,90,20,101,13,
+    90,21,101,14,90,22,71,0,100,55,100,23,132,0,100,23,
+    101,23,131,3,90,24,71,0,100,56,100,24,132,0,100,24,
+    131,2,90,25,71,0,100,57,100,25,132,0,100,25,101,26,
+    131,3,90,27,71,0,100,58,100,59,132,0,100,59,101,27,
+    131,3,90,28,71,0,100,60,100,26,132,0,100,26,101,26,
+    131,3,90,29,71,0,100,61,100,62,132,0,100,62,101,29,
+    131,3,90,30,71,0,100,63,100,28,132,0,100,28,101,25,
+    131,3,90,31,71,0,100,64,100,27,132,0,100,27,101,25,
+    131,3,90,32,71,0,100,65,100,29,132,0,100,29,131,2,
+    90,33,71,0,100,66,100,30,132,0,100,30,131,2,90,34,
+    100,92,100,70,100,7,132,1,90,35,100,93,100,71,100,8,
+    132,1,90,36,100,72,100,31,132,0,90,37,100,73,100,32,
+    132,0,90,38,100,74,100,33,132,0,90,39,100,75,100,34,
+    132,0,90,40,100,76,100,35,132,0,90,41,100,77,100,36,
+    132,0,90,42,100,94,100,78,100,39,132,1,90,43,100,95,
+    100,79,100,40,132,1,90,44,100,80,100,81,132,0,90,45,
+    100,82,100,83,132,0,90,46,122,52,101,47,100,68,131,1,
+    90,48,101,47,100,84,131,1,90,49,101,47,100,85,131,1,
+    90,50,101,47,100,86,131,1,90,51,101,47,100,87,131,1,
+    90,52,101,47,100,88,131,1,90,53,87,0,110,46,4,0,
+    101,54,107,10,144,2,114,96,1,0,1,0,1,0,100,2,
+    90,48,100,2,90,49,100,2,90,50,100,2,90,51,100,2,
+    90,52,100,2,90,53,89,0,110,2,88,0,100,1,90,55,
+    101,55,144,2,114,116,100,1,100,2,108,56,90,56,101,57,
+    100,89,107,2,144,2,114,158,101,36,101,2,106,58,100,90,
+    100,91,131,3,101,2,95,58,101,36,101,2,106,59,100,91,
+    100,90,131,3,101,2,95,59,100,2,83,0,41,96,122,158,
+    32,99,111,100,101,99,115,32,45,45,32,80,121,116,104,111,
+    110,32,67,111,100,101,99,32,82,101,103,105,115,116,114,121,
+    44,32,65,80,73,32,97,110,100,32,104,101,108,112,101,114,
+    115,46,10,10,10,87,114,105,116,116,101,110,32,98,121,32,
+    77,97,114,99,45,65,110,100,114,101,32,76,101,109,98,117,
+    114,103,32,40,109,97,108,64,108,101,109,98,117,114,103,46,
+    99,111,109,41,46,10,10,40,99,41,32,67,111,112,121,114,
+    105,103,104,116,32,67,78,82,73,44,32,65,108,108,32,82,
+    105,103,104,116,115,32,82,101,115,101,114,118,101,100,46,32,
+    78,79,32,87,65,82,82,65,78,84,89,46,10,10,233,0,
+    0,0,0,78,41,1,218,1,42,122,37,70,97,105,108,101,
+    100,32,116,111,32,108,111,97,100,32,116,104,101,32,98,117,
+    105,108,116,105,110,32,99,111,100,101,99,115,58,32,37,115,
+    90,8,114,101,103,105,115,116,101,114,218,6,108,111,111,107,
+    117,112,218,4,111,112,101,110,218,11,69,110,99,111,100,101,
+    100,70,105,108,101,218,3,66,79,77,218,6,66,79,77,95,
+    66,69,218,6,66,79,77,95,76,69,218,8,66,79,77,51,
+    50,95,66,69,218,8,66,79,77,51,50,95,76,69,218,8,
+    66,79,77,54,52,95,66,69,218,8,66,79,77,54,52,95,
+    76,69,218,8,66,79,77,95,85,84,70,56,218,9,66,79,
+    77,95,85,84,70,49,54,218,12,66,79,77,95,85,84,70,
+    49,54,95,76,69,218,12,66,79,77,95,85,84,70,49,54,
+    95,66,69,218,9,66,79,77,95,85,84,70,51,50,218,12,
+    66,79,77,95,85,84,70,51,50,95,76,69,218,12,66,79,
+    77,95,85,84,70,51,50,95,66,69,218,9,67,111,100,101,
+    99,73,110,102,111,218,5,67,111,100,101,99,218,18,73,110,
+    99,114,101,109,101,110,116,97,108,69,110,99,111,100,101,114,
+    218,18,73,110,99,114,101,109,101,110,116,97,108,68,101,99,
+    111,100,101,114,218,12,83,116,114,101,97,109,82,101,97,100,
+    101,114,218,12,83,116,114,101,97,109,87,114,105,116,101,114,
+    218,18,83,116,114,101,97,109,82,101,97,100,101,114,87,114,
+    105,116,101,114,218,13,83,116,114,101,97,109,82,101,99,111,
+    100,101,114,218,10,103,101,116,101,110,99,111,100,101,114,218,
+    10,103,101,116,100,101,99,111,100,101,114,218,21,103,101,116,
+    105,110,99,114,101,109,101,110,116,97,108,101,110,99,111,100,
+    101,114,218,21,103,101,116,105,110,99,114,101,109,101,110,116,
+    97,108,100,101,99,111,100,101,114,218,9,103,101,116,114,101,
+    97,100,101,114,218,9,103,101,116,119,114,105,116,101,114,218,
+    6,101,110,99,111,100,101,218,6,100,101,99,111,100,101,218,
+    10,105,116,101,114,101,110,99,111,100,101,218,10,105,116,101,
+    114,100,101,99,111,100,101,218,13,115,116,114,105,99,116,95,
+    101,114,114,111,114,115,218,13,105,103,110,111,114,101,95,101,
+    114,114,111,114,115,218,14,114,101,112,108,97,99,101,95,101,
+    114,114,111,114,115,218,24,120,109,108,99,104,97,114,114,101,
+    102,114,101,112,108,97,99,101,95,101,114,114,111,114,115,218,
+    23,98,97,99,107,115,108,97,115,104,114,101,112,108,97,99,
+    101,95,101,114,114,111,114,115,218,18,110,97,109,101,114,101,
+    112,108,97,99,101,95,101,114,114,111,114,115,90,14,114,101,
+    103,105,115,116,101,114,95,101,114,114,111,114,218,12,108,111,
+    111,107,117,112,95,101,114,114,111,114,115,3,0,0,0,239,
+    187,191,115,2,0,0,0,255,254,115,2,0,0,0,254,255,
+    115,4,0,0,0,255,254,0,0,115,4,0,0,0,0,0,
+    254,255,90,6,108,105,116,116,108,101,99,0,0,0,0,0,
+    0,0,0,0,0,0,0,5,0,0,0,64,0,0,0,115,
+    54,0,0,0,101,0,90,1,100,0,90,2,100,1,90,3,
+    100,2,90,4,100,3,100,3,100,3,100,3,100,3,102,5,
+    100,3,100,4,156,1,100,5,100,6,132,3,90,5,100,7,
+    100,8,132,0,90,6,100,3,83,0,41,9,114,19,0,0,
+    0,122,48,67,111,100,101,99,32,100,101,116,97,105,108,115,
+    32,119,104,101,110,32,108,111,111,107,105,110,103,32,117,112,
+    32,116,104,101,32,99,111,100,101,99,32,114,101,103,105,115,
+    116,114,121,84,78,41,1,218,17,95,105,115,95,116,101,120,
+    116,95,101,110,99,111,100,105,110,103,99,8,0,0,0,1,
+    0,0,0,10,0,0,0,7,0,0,0,67,0,0,0,115,
+    80,0,0,0,116,0,160,1,124,0,124,1,124,2,124,3,
+    124,4,102,4,161,2,125,9,124,7,124,9,95,2,124,1,
+    124,9,95,3,124,2,124,9,95,4,124,5,124,9,95,5,
+    124,6,124,9,95,6,124,4,124,9,95,7,124,3,124,9,
+    95,8,124,8,100,0,107,9,114,76,124,8,124,9,95,9,
+    124,9,83,0,169,1,78,41,10,218,5,116,117,112,108,101,
+    218,7,95,95,110,101,119,95,95,218,4,110,97,109,101,114,
+    33,0,0,0,114,34,0,0,0,218,18,105,110,99,114,101,
+    109,101,110,116,97,108,101,110,99,111,100,101,114,218,18,105,
+    110,99,114,101,109,101,110,116,97,108,100,101,99,111,100,101,
+    114,218,12,115,116,114,101,97,109,119,114,105,116,101,114,218,
+    12,115,116,114,101,97,109,114,101,97,100,101,114,114,44,0,
+    0,0,41,10,90,3,99,108,115,114,33,0,0,0,114,34,
+    0,0,0,114,52,0,0,0,114,51,0,0,0,114,49,0,
+    0,0,114,50,0,0,0,114,48,0,0,0,114,44,0,0,
+    0,218,4,115,101,108,102,169,0,114,54,0,0,0,250,15,
+    60,102,114,111,122,101,110,32,99,111,100,101,99,115,62,114,
+    47,0,0,0,94,0,0,0,115,22,0,0,0,0,3,20,
+    1,6,1,6,1,6,1,6,1,6,1,6,1,6,1,8,
+    1,6,1,122,17,67,111,100,101,99,73,110,102,111,46,95,
+    95,110,101,119,95,95,99,1,0,0,0,0,0,0,0,1,
+    0,0,0,6,0,0,0,67,0,0,0,115,30,0,0,0,
+    100,1,124,0,106,0,106,1,124,0,106,0,106,2,124,0,
+    106,3,116,4,124,0,131,1,102,4,22,0,83,0,41,2,
+    78,122,37,60,37,115,46,37,115,32,111,98,106,101,99,116,
+    32,102,111,114,32,101,110,99,111,100,105,110,103,32,37,115,
+    32,97,116,32,37,35,120,62,41,5,218,9,95,95,99,108,
+    97,115,115,95,95,218,10,95,95,109,111,100,117,108,101,95,
+    95,218,12,95,95,113,117,97,108,110,97,109,101,95,95,114,
+    48,0,0,0,218,2,105,100,169,1,114,53,0,0,0,114,
+    54,0,0,0,114,54,0,0,0,114,55,0,0,0,218,8,
+    95,95,114,101,112,114,95,95,109,0,0,0,115,12,0,0,
+    0,0,1,2,1,12,1,4,0,6,255,2,255,122,18,67,
+    111,100,101,99,73,110,102,111,46,95,95,114,101,112,114,95,
+    95,41,7,218,8,95,95,110,97,109,101,95,95,114,57,0,
+    0,0,114,58,0,0,0,218,7,95,95,100,111,99,95,95,
+    114,44,0,0,0,114,47,0,0,0,114,61,0,0,0,114,
+    54,0,0,0,114,54,0,0,0,114,54,0,0,0,114,55,
+    0,0,0,114,19,0,0,0,83,0,0,0,115,20,0,0,
+    0,8,1,4,8,4,2,4,1,2,0,2,0,2,255,2,
+    2,2,254,12,15,99,0,0,0,0,0,0,0,0,0,0,
+    0,0,3,0,0,0,64,0,0,0,115,36,0,0,0,101,
+    0,90,1,100,0,90,2,100,1,90,3,100,8,100,3,100,
+    4,132,1,90,4,100,9,100,5,100,6,132,1,90,5,100,
+    7,83,0,41,10,114,20,0,0,0,97,57,4,0,0,32,
+    68,101,102,105,110,101,115,32,116,104,101,32,105,110,116,101,
+    114,102,97,99,101,32,102,111,114,32,115,116,97,116,101,108,
+    101,115,115,32,101,110,99,111,100,101,114,115,47,100,101,99,
+    111,100,101,114,115,46,10,10,32,32,32,32,32,32,32,32,
+    84,104,101,32,46,101,110,99,111,100,101,40,41,47,46,100,
+    101,99,111,100,101,40,41,32,109,101,116,104,111,100,115,32,
+    109,97,121,32,117,115,101,32,100,105,102,102,101,114,101,110,
+    116,32,101,114,114,111,114,10,32,32,32,32,32,32,32,32,
+    104,97,110,100,108,105,110,103,32,115,99,104,101,109,101,115,
+    32,98,121,32,112,114,111,118,105,100,105,110,103,32,116,104,
+    101,32,101,114,114,111,114,115,32,97,114,103,117,109,101,110,
+    116,46,32,84,104,101,115,101,10,32,32,32,32,32,32,32,
+    32,115,116,114,105,110,103,32,118,97,108,117,101,115,32,97,
+    114,101,32,112,114,101,100,101,102,105,110,101,100,58,10,10,
+    32,32,32,32,32,32,32,32,32,39,115,116,114,105,99,116,
+    39,32,45,32,114,97,105,115,101,32,97,32,86,97,108,117,
+    101,69,114,114,111,114,32,101,114,114,111,114,32,40,111,114,
+    32,97,32,115,117,98,99,108,97,115,115,41,10,32,32,32,
+    32,32,32,32,32,32,39,105,103,110,111,114,101,39,32,45,
+    32,105,103,110,111,114,101,32,116,104,101,32,99,104,97,114,
+    97,99,116,101,114,32,97,110,100,32,99,111,110,116,105,110,
+    117,101,32,119,105,116,104,32,116,104,101,32,110,101,120,116,
+    10,32,32,32,32,32,32,32,32,32,39,114,101,112,108,97,
+    99,101,39,32,45,32,114,101,112,108,97,99,101,32,119,105,
+    116,104,32,97,32,115,117,105,116,97,98,108,101,32,114,101,
+    112,108,97,99,101,109,101,110,116,32,99,104,97,114,97,99,
+    116,101,114,59,10,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,80,121,116,104,111,110,32,
+    119,105,108,108,32,117,115,101,32,116,104,101,32,111,102,102,
+    105,99,105,97,108,32,85,43,70,70,70,68,32,82,69,80,
+    76,65,67,69,77,69,78,84,10,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,67,72,65,
+    82,65,67,84,69,82,32,102,111,114,32,116,104,101,32,98,
+    117,105,108,116,105,110,32,85,110,105,99,111,100,101,32,99,
+    111,100,101,99,115,32,111,110,10,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,100,101,99,
+    111,100,105,110,103,32,97,110,100,32,39,63,39,32,111,110,
+    32,101,110,99,111,100,105,110,103,46,10,32,32,32,32,32,
+    32,32,32,32,39,115,117,114,114,111,103,97,116,101,101,115,
+    99,97,112,101,39,32,45,32,114,101,112,108,97,99,101,32,
+    119,105,116,104,32,112,114,105,118,97,116,101,32,99,111,100,
+    101,32,112,111,105,110,116,115,32,85,43,68,67,110,110,46,
+    10,32,32,32,32,32,32,32,32,32,39,120,109,108,99,104,
+    97,114,114,101,102,114,101,112,108,97,99,101,39,32,45,32,
+    82,101,112,108,97,99,101,32,119,105,116,104,32,116,104,101,
+    32,97,112,112,114,111,112,114,105,97,116,101,32,88,77,76,
+    10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    99,104,97,114,97,99,116,101,114,32,114,101,102,101,114,101,
+    110,99,101,32,40,111,110,108,121,32,102,111,114,32,101,110,
+    99,111,100,105,110,103,41,46,10,32,32,32,32,32,32,32,
+    32,32,39,98,97,99,107,115,108,97,115,104,114,101,112,108,
+    97,99,101,39,32,32,45,32,82,101,112,108,97,99,101,32,
+    119,105,116,104,32,98,97,99,107,115,108,97,115,104,101,100,
+    32,101,115,99,97,112,101,32,115,101,113,117,101,110,99,101,
+    115,46,10,32,32,32,32,32,32,32,32,32,39,110,97,109,
+    101,114,101,112,108,97,99,101,39,32,32,32,32,32,32,32,
+    45,32,82,101,112,108,97,99,101,32,119,105,116,104,32,92,
+    78,123,46,46,46,125,32,101,115,99,97,112,101,32,115,101,
+    113,117,101,110,99,101,115,10,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,40,111,110,108,121,32,102,111,114,
+    32,101,110,99,111,100,105,110,103,41,46,10,10,32,32,32,
+    32,32,32,32,32,84,104,101,32,115,101,116,32,111,102,32,
+    97,108,108,111,119,101,100,32,118,97,108,117,101,115,32,99,
+    97,110,32,98,101,32,101,120,116,101,110,100,101,100,32,118,
+    105,97,32,114,101,103,105,115,116,101,114,95,101,114,114,111,
+    114,46,10,10,32,32,32,32,218,6,115,116,114,105,99,116,
+    99,3,0,0,0,0,0,0,0,3,0,0,0,1,0,0,
+    0,67,0,0,0,115,8,0,0,0,116,0,130,1,100,1,
+    83,0,41,2,97,35,2,0,0,32,69,110,99,111,100,101,
+    115,32,116,104,101,32,111,98,106,101,99,116,32,105,110,112,
+    117,116,32,97,110,100,32,114,101,116,117,114,110,115,32,97,
+    32,116,117,112,108,101,32,40,111,117,116,112,117,116,10,32,
+    32,32,32,32,32,32,32,32,32,32,32,111,98,106,101,99,
+    116,44,32,108,101,110,103,116,104,32,99,111,110,115,117,109,
+    101,100,41,46,10,10,32,32,32,32,32,32,32,32,32,32,
+    32,32,101,114,114,111,114,115,32,100,101,102,105,110,101,115,
+    32,116,104,101,32,101,114,114,111,114,32,104,97,110,100,108,
+    105,110,103,32,116,111,32,97,112,112,108,121,46,32,73,116,
+    32,100,101,102,97,117,108,116,115,32,116,111,10,32,32,32,
+    32,32,32,32,32,32,32,32,32,39,115,116,114,105,99,116,
+    39,32,104,97,110,100,108,105,110,103,46,10,10,32,32,32,
+    32,32,32,32,32,32,32,32,32,84,104,101,32,109,101,116,
+    104,111,100,32,109,97,121,32,110,111,116,32,115,116,111,114,
+    101,32,115,116,97,116,101,32,105,110,32,116,104,101,32,67,
+    111,100,101,99,32,105,110,115,116,97,110,99,101,46,32,85,
+    115,101,10,32,32,32,32,32,32,32,32,32,32,32,32,83,
+    116,114,101,97,109,87,114,105,116,101,114,32,102,111,114,32,
+    99,111,100,101,99,115,32,119,104,105,99,104,32,104,97,118,
+    101,32,116,111,32,107,101,101,112,32,115,116,97,116,101,32,
+    105,110,32,111,114,100,101,114,32,116,111,10,32,32,32,32,
+    32,32,32,32,32,32,32,32,109,97,107,101,32,101,110,99,
+    111,100,105,110,103,32,101,102,102,105,99,105,101,110,116,46,
+    10,10,32,32,32,32,32,32,32,32,32,32,32,32,84,104,
+    101,32,101,110,99,111,100,101,114,32,109,117,115,116,32,98,
+    101,32,97,98,108,101,32,116,111,32,104,97,110,100,108,101,
+    32,122,101,114,111,32,108,101,110,103,116,104,32,105,110,112,
+    117,116,32,97,110,100,10,32,32,32,32,32,32,32,32,32,
+    32,32,32,114,101,116,117,114,110,32,97,110,32,101,109,112,
+    116,121,32,111,98,106,101,99,116,32,111,102,32,116,104,101,
+    32,111,117,116,112,117,116,32,111,98,106,101,99,116,32,116,
+    121,112,101,32,105,110,32,116,104,105,115,10,32,32,32,32,
+    32,32,32,32,32,32,32,32,115,105,116,117,97,116,105,111,
+    110,46,10,10,32,32,32,32,32,32,32,32,78,169,1,218,
+    19,78,111,116,73,109,112,108,101,109,101,110,116,101,100,69,
+    114,114,111,114,169,3,114,53,0,0,0,218,5,105,110,112,
+    117,116,218,6,101,114,114,111,114,115,114,54,0,0,0,114,
+    54,0,0,0,114,55,0,0,0,114,33,0,0,0,138,0,
+    0,0,115,2,0,0,0,0,17,122,12,67,111,100,101,99,
+    46,101,110,99,111,100,101,99,3,0,0,0,0,0,0,0,
+    3,0,0,0,1,0,0,0,67,0,0,0,115,8,0,0,
+    0,116,0,130,1,100,1,83,0,41,2,97,242,2,0,0,
+    32,68,101,99,111,100,101,115,32,116,104,101,32,111,98,106,
+    101,99,116,32,105,110,112,117,116,32,97,110,100,32,114,101,
+    116,117,114,110,115,32,97,32,116,117,112,108,101,32,40,111,
+    117,116,112,117,116,10,32,32,32,32,32,32,32,32,32,32,
+    32,32,111,98,106,101,99,116,44,32,108,101,110,103,116,104,
+    32,99,111,110,115,117,109,101,100,41,46,10,10,32,32,32,
+    32,32,32,32,32,32,32,32,32,105,110,112,117,116,32,109,
+    117,115,116,32,98,101,32,97,110,32,111,98,106,101,99,116,
+    32,119,104,105,99,104,32,112,114,111,118,105,100,101,115,32,
+    116,104,101,32,98,102,95,103,101,116,114,101,97,100,98,117,
+    102,10,32,32,32,32,32,32,32,32,32,32,32,32,98,117,
+    102,102,101,114,32,115,108,111,116,46,32,80,121,116,104,111,
+    110,32,115,116,114,105,110,103,115,44,32,98,117,102,102,101,
+    114,32,111,98,106,101,99,116,115,32,97,110,100,32,109,101,
+    109,111,114,121,10,32,32,32,32,32,32,32,32,32,32,32,
+    32,109,97,112,112,101,100,32,102,105,108,101,115,32,97,114,
+    101,32,101,120,97,109,112,108,101,115,32,111,102,32,111,98,
+    106,101,99,116,115,32,112,114,111,118,105,100,105,110,103,32,
+    116,104,105,115,32,115,108,111,116,46,10,10,32,32,32,32,
+    32,32,32,32,32,32,32,32,101,114,114,111,114,115,32,100,
+    101,102,105,110,101,115,32,116,104,101,32,101,114,114,111,114,
+    32,104,97,110,100,108,105,110,103,32,116,111,32,97,112,112,
+    108,121,46,32,73,116,32,100,101,102,97,117,108,116,115,32,
+    116,111,10,32,32,32,32,32,32,32,32,32,32,32,32,39,
+    115,116,114,105,99,116,39,32,104,97,110,100,108,105,110,103,
+    46,10,10,32,32,32,32,32,32,32,32,32,32,32,32,84,
+    104,101,32,109,101,116,104,111,100,32,109,97,121,32,110,111,
+    116,32,115,116,111,114,101,32,115,116,97,116,101,32,105,110,
+    32,116,104,101,32,67,111,100,101,99,32,105,110,115,116,97,
+    110,99,101,46,32,85,115,101,10,32,32,32,32,32,32,32,
+    32,32,32,32,32,83,116,114,101,97,109,82,101,97,100,101,
+    114,32,102,111,114,32,99,111,100,101,99,115,32,119,104,105,
+    99,104,32,104,97,118,101,32,116,111,32,107,101,101,112,32,
+    115,116,97,116,101,32,105,110,32,111,114,100,101,114,32,116,
+    111,10,32,32,32,32,32,32,32,32,32,32,32,32,109,97,
+    107,101,32,100,101,99,111,100,105,110,103,32,101,102,102,105,
+    99,105,101,110,116,46,10,10,32,32,32,32,32,32,32,32,
+    32,32,32,32,84,104,101,32,100,101,99,111,100,101,114,32,
+    109,117,115,116,32,98,101,32,97,98,108,101,32,116,111,32,
+    104,97,110,100,108,101,32,122,101,114,111,32,108,101,110,103,
+    116,104,32,105,110,112,117,116,32,97,110,100,10,32,32,32,
+    32,32,32,32,32,32,32,32,32,114,101,116,117,114,110,32,
+    97,110,32,101,109,112,116,121,32,111,98,106,101,99,116,32,
+    111,102,32,116,104,101,32,111,117,116,112,117,116,32,111,98,
+    106,101,99,116,32,116,121,112,101,32,105,110,32,116,104,105,
+    115,10,32,32,32,32,32,32,32,32,32,32,32,32,115,105,
+    116,117,97,116,105,111,110,46,10,10,32,32,32,32,32,32,
+    32,32,78,114,65,0,0,0,114,67,0,0,0,114,54,0,
+    0,0,114,54,0,0,0,114,55,0,0,0,114,34,0,0,
+    0,157,0,0,0,115,2,0,0,0,0,21,122,12,67,111,
+    100,101,99,46,100,101,99,111,100,101,78,41,1,114,64,0,
+    0,0,41,1,114,64,0,0,0,41,6,114,62,0,0,0,
+    114,57,0,0,0,114,58,0,0,0,114,63,0,0,0,114,
+    33,0,0,0,114,34,0,0,0,114,54,0,0,0,114,54,
+    0,0,0,114,54,0,0,0,114,55,0,0,0,114,20,0,
+    0,0,114,0,0,0,115,6,0,0,0,8,2,4,22,10,
+    19,99,0,0,0,0,0,0,0,0,0,0,0,0,3,0,
+    0,0,64,0,0,0,115,60,0,0,0,101,0,90,1,100,
+    0,90,2,100,1,90,3,100,15,100,3,100,4,132,1,90,
+    4,100,16,100,6,100,7,132,1,90,5,100,8,100,9,132,
+    0,90,6,100,10,100,11,132,0,90,7,100,12,100,13,132,
+    0,90,8,100,14,83,0,41,17,114,21,0,0,0,122,232,
+    10,32,32,32,32,65,110,32,73,110,99,114,101,109,101,110,
+    116,97,108,69,110,99,111,100,101,114,32,101,110,99,111,100,
+    101,115,32,97,110,32,105,110,112,117,116,32,105,110,32,109,
+    117,108,116,105,112,108,101,32,115,116,101,112,115,46,32,84,
+    104,101,32,105,110,112,117,116,32,99,97,110,10,32,32,32,
+    32,98,101,32,112,97,115,115,101,100,32,112,105,101,99,101,
+    32,98,121,32,112,105,101,99,101,32,116,111,32,116,104,101,
+    32,101,110,99,111,100,101,40,41,32,109,101,116,104,111,100,
+    46,32,84,104,101,32,73,110,99,114,101,109,101,110,116,97,
+    108,69,110,99,111,100,101,114,10,32,32,32,32,114,101,109,
+    101,109,98,101,114,115,32,116,104,101,32,115,116,97,116,101,
+    32,111,102,32,116,104,101,32,101,110,99,111,100,105,110,103,
+    32,112,114,111,99,101,115,115,32,98,101,116,119,101,101,110,
+    32,99,97,108,108,115,32,116,111,32,101,110,99,111,100,101,
+    40,41,46,10,32,32,32,32,114,64,0,0,0,99,2,0,
+    0,0,0,0,0,0,2,0,0,0,2,0,0,0,67,0,
+    0,0,115,16,0,0,0,124,1,124,0,95,0,100,1,124,
+    0,95,1,100,2,83,0,41,3,122,244,10,32,32,32,32,
+    32,32,32,32,67,114,101,97,116,101,115,32,97,110,32,73,
+    110,99,114,101,109,101,110,116,97,108,69,110,99,111,100,101,
+    114,32,105,110,115,116,97,110,99,101,46,10,10,32,32,32,
+    32,32,32,32,32,84,104,101,32,73,110,99,114,101,109,101,
+    110,116,97,108,69,110,99,111,100,101,114,32,109,97,121,32,
+    117,115,101,32,100,105,102,102,101,114,101,110,116,32,101,114,
+    114,111,114,32,104,97,110,100,108,105,110,103,32,115,99,104,
+    101,109,101,115,32,98,121,10,32,32,32,32,32,32,32,32,
+    112,114,111,118,105,100,105,110,103,32,116,104,101,32,101,114,
+    114,111,114,115,32,107,101,121,119,111,114,100,32,97,114,103,
+    117,109,101,110,116,46,32,83,101,101,32,116,104,101,32,109,
+    111,100,117,108,101,32,100,111,99,115,116,114,105,110,103,10,
+    32,32,32,32,32,32,32,32,102,111,114,32,97,32,108,105,
+    115,116,32,111,102,32,112,111,115,115,105,98,108,101,32,118,
+    97,108,117,101,115,46,10,32,32,32,32,32,32,32,32,218,
+    0,78,41,2,114,69,0,0,0,218,6,98,117,102,102,101,
+    114,169,2,114,53,0,0,0,114,69,0,0,0,114,54,0,
+    0,0,114,54,0,0,0,114,55,0,0,0,218,8,95,95,
+    105,110,105,116,95,95,186,0,0,0,115,4,0,0,0,0,
+    8,6,1,122,27,73,110,99,114,101,109,101,110,116,97,108,
+    69,110,99,111,100,101,114,46,95,95,105,110,105,116,95,95,
+    70,99,3,0,0,0,0,0,0,0,3,0,0,0,1,0,
+    0,0,67,0,0,0,115,8,0,0,0,116,0,130,1,100,
+    1,83,0,41,2,122,65,10,32,32,32,32,32,32,32,32,
+    69,110,99,111,100,101,115,32,105,110,112,117,116,32,97,110,
+    100,32,114,101,116,117,114,110,115,32,116,104,101,32,114,101,
+    115,117,108,116,105,110,103,32,111,98,106,101,99,116,46,10,
+    32,32,32,32,32,32,32,32,78,114,65,0,0,0,169,3,
+    114,53,0,0,0,114,68,0,0,0,218,5,102,105,110,97,
+    108,114,54,0,0,0,114,54,0,0,0,114,55,0,0,0,
+    114,33,0,0,0,197,0,0,0,115,2,0,0,0,0,4,
+    122,25,73,110,99,114,101,109,101,110,116,97,108,69,110,99,
+    111,100,101,114,46,101,110,99,111,100,101,99,1,0,0,0,
+    0,0,0,0,1,0,0,0,1,0,0,0,67,0,0,0,
+    115,4,0,0,0,100,1,83,0,41,2,122,58,10,32,32,
+    32,32,32,32,32,32,82,101,115,101,116,115,32,116,104,101,
+    32,101,110,99,111,100,101,114,32,116,111,32,116,104,101,32,
+    105,110,105,116,105,97,108,32,115,116,97,116,101,46,10,32,
+    32,32,32,32,32,32,32,78,114,54,0,0,0,114,60,0,
+    0,0,114,54,0,0,0,114,54,0,0,0,114,55,0,0,
+    0,218,5,114,101,115,101,116,203,0,0,0,115,2,0,0,
+    0,0,1,122,24,73,110,99,114,101,109,101,110,116,97,108,
+    69,110,99,111,100,101,114,46,114,101,115,101,116,99,1,0,
+    0,0,0,0,0,0,1,0,0,0,1,0,0,0,67,0,
+    0,0,115,4,0,0,0,100,1,83,0,41,2,122,58,10,
+    32,32,32,32,32,32,32,32,82,101,116,117,114,110,32,116,
+    104,101,32,99,117,114,114,101,110,116,32,115,116,97,116,101,
+    32,111,102,32,116,104,101,32,101,110,99,111,100,101,114,46,
+    10,32,32,32,32,32,32,32,32,114,0,0,0,0,114,54,
+    0,0,0,114,60,0,0,0,114,54,0,0,0,114,54,0,
+    0,0,114,55,0,0,0,218,8,103,101,116,115,116,97,116,
+    101,208,0,0,0,115,2,0,0,0,0,4,122,27,73,110,
+    99,114,101,109,101,110,116,97,108,69,110,99,111,100,101,114,
+    46,103,101,116,115,116,97,116,101,99,2,0,0,0,0,0,
+    0,0,2,0,0,0,1,0,0,0,67,0,0,0,115,4,
+    0,0,0,100,1,83,0,41,2,122,108,10,32,32,32,32,
+    32,32,32,32,83,101,116,32,116,104,101,32,99,117,114,114,
+    101,110,116,32,115,116,97,116,101,32,111,102,32,116,104,101,
+    32,101,110,99,111,100,101,114,46,32,115,116,97,116,101,32,
+    109,117,115,116,32,104,97,118,101,32,98,101,101,110,10,32,
+    32,32,32,32,32,32,32,114,101,116,117,114,110,101,100,32,
+    98,121,32,103,101,116,115,116,97,116,101,40,41,46,10,32,
+    32,32,32,32,32,32,32,78,114,54,0,0,0,169,2,114,
+    53,0,0,0,90,5,115,116,97,116,101,114,54,0,0,0,
+    114,54,0,0,0,114,55,0,0,0,218,8,115,101,116,115,
+    116,97,116,101,214,0,0,0,115,2,0,0,0,0,1,122,
+    27,73,110,99,114,101,109,101,110,116,97,108,69,110,99,111,
+    100,101,114,46,115,101,116,115,116,97,116,101,78,41,1,114,
+    64,0,0,0,41,1,70,41,9,114,62,0,0,0,114,57,
+    0,0,0,114,58,0,0,0,114,63,0,0,0,114,73,0,
+    0,0,114,33,0,0,0,114,76,0,0,0,114,77,0,0,
+    0,114,79,0,0,0,114,54,0,0,0,114,54,0,0,0,
+    114,54,0,0,0,114,55,0,0,0,114,21,0,0,0,180,
+    0,0,0,115,12,0,0,0,8,1,4,5,10,11,10,6,
+    8,5,8,6,99,0,0,0,0,0,0,0,0,0,0,0,
+    0,3,0,0,0,64,0,0,0,115,68,0,0,0,101,0,
+    90,1,100,0,90,2,100,1,90,3,100,17,100,3,100,4,
+    132,1,90,4,100,5,100,6,132,0,90,5,100,18,100,8,
+    100,9,132,1,90,6,100,10,100,11,132,0,90,7,100,12,
+    100,13,132,0,90,8,100,14,100,15,132,0,90,9,100,16,
+    83,0,41,19,218,26,66,117,102,102,101,114,101,100,73,110,
+    99,114,101,109,101,110,116,97,108,69,110,99,111,100,101,114,
+    122,192,10,32,32,32,32,84,104,105,115,32,115,117,98,99,
+    108,97,115,115,32,111,102,32,73,110,99,114,101,109,101,110,
+    116,97,108,69,110,99,111,100,101,114,32,99,97,110,32,98,
+    101,32,117,115,101,100,32,97,115,32,116,104,101,32,98,97,
+    115,101,99,108,97,115,115,32,102,111,114,32,97,110,10,32,
+    32,32,32,105,110,99,114,101,109,101,110,116,97,108,32,101,
+    110,99,111,100,101,114,32,105,102,32,116,104,101,32,101,110,
+    99,111,100,101,114,32,109,117,115,116,32,107,101,101,112,32,
+    115,111,109,101,32,111,102,32,116,104,101,32,111,117,116,112,
+    117,116,32,105,110,32,97,10,32,32,32,32,98,117,102,102,
+    101,114,32,98,101,116,119,101,101,110,32,99,97,108,108,115,
+    32,116,111,32,101,110,99,111,100,101,40,41,46,10,32,32,
+    32,32,114,64,0,0,0,99,2,0,0,0,0,0,0,0,
+    2,0,0,0,4,0,0,0,67,0,0,0,115,22,0,0,
+    0,116,0,160,1,124,0,124,1,161,2,1,0,100,1,124,
+    0,95,2,100,0,83,0,169,2,78,114,70,0,0,0,41,
+    3,114,21,0,0,0,114,73,0,0,0,114,71,0,0,0,
+    114,72,0,0,0,114,54,0,0,0,114,54,0,0,0,114,
+    55,0,0,0,114,73,0,0,0,226,0,0,0,115,4,0,
+    0,0,0,1,12,2,122,35,66,117,102,102,101,114,101,100,
+    73,110,99,114,101,109,101,110,116,97,108,69,110,99,111,100,
+    101,114,46,95,95,105,110,105,116,95,95,99,4,0,0,0,
+    0,0,0,0,4,0,0,0,1,0,0,0,67,0,0,0,
+    115,8,0,0,0,116,0,130,1,100,0,83,0,114,45,0,
+    0,0,114,65,0,0,0,169,4,114,53,0,0,0,114,68,
+    0,0,0,114,69,0,0,0,114,75,0,0,0,114,54,0,
+    0,0,114,54,0,0,0,114,55,0,0,0,218,14,95,98,
+    117,102,102,101,114,95,101,110,99,111,100,101,231,0,0,0,
+    115,2,0,0,0,0,3,122,41,66,117,102,102,101,114,101,
+    100,73,110,99,114,101,109,101,110,116,97,108,69,110,99,111,
+    100,101,114,46,95,98,117,102,102,101,114,95,101,110,99,111,
+    100,101,70,99,3,0,0,0,0,0,0,0,6,0,0,0,
+    5,0,0,0,67,0,0,0,115,48,0,0,0,124,0,106,
+    0,124,1,23,0,125,3,124,0,160,1,124,3,124,0,106,
+    2,124,2,161,3,92,2,125,4,125,5,124,3,124,5,100,
+    0,133,2,25,0,124,0,95,0,124,4,83,0,114,45,0,
+    0,0,41,3,114,71,0,0,0,114,83,0,0,0,114,69,
+    0,0,0,169,6,114,53,0,0,0,114,68,0,0,0,114,
+    75,0,0,0,218,4,100,97,116,97,218,6,114,101,115,117,
+    108,116,218,8,99,111,110,115,117,109,101,100,114,54,0,0,
+    0,114,54,0,0,0,114,55,0,0,0,114,33,0,0,0,
+    236,0,0,0,115,8,0,0,0,0,2,10,1,20,2,14,
+    1,122,33,66,117,102,102,101,114,101,100,73,110,99,114,101,
+    109,101,110,116,97,108,69,110,99,111,100,101,114,46,101,110,
+    99,111,100,101,99,1,0,0,0,0,0,0,0,1,0,0,
+    0,3,0,0,0,67,0,0,0,115,20,0,0,0,116,0,
+    160,1,124,0,161,1,1,0,100,1,124,0,95,2,100,0,
+    83,0,114,81,0,0,0,41,3,114,21,0,0,0,114,76,
+    0,0,0,114,71,0,0,0,114,60,0,0,0,114,54,0,
+    0,0,114,54,0,0,0,114,55,0,0,0,114,76,0,0,
+    0,244,0,0,0,115,4,0,0,0,0,1,10,1,122,32,
+    66,117,102,102,101,114,101,100,73,110,99,114,101,109,101,110,
+    116,97,108,69,110,99,111,100,101,114,46,114,101,115,101,116,
+    99,1,0,0,0,0,0,0,0,1,0,0,0,1,0,0,
+    0,67,0,0,0,115,10,0,0,0,124,0,106,0,112,8,
+    100,1,83,0,169,2,78,114,0,0,0,0,169,1,114,71,
+    0,0,0,114,60,0,0,0,114,54,0,0,0,114,54,0,
+    0,0,114,55,0,0,0,114,77,0,0,0,248,0,0,0,
+    115,2,0,0,0,0,1,122,35,66,117,102,102,101,114,101,
+    100,73,110,99,114,101,109,101,110,116,97,108,69,110,99,111,
+    100,101,114,46,103,101,116,115,116,97,116,101,99,2,0,0,
+    0,0,0,0,0,2,0,0,0,2,0,0,0,67,0,0,
+    0,115,14,0,0,0,124,1,112,6,100,1,124,0,95,0,
+    100,0,83,0,114,81,0,0,0,114,89,0,0,0,114,78,
+    0,0,0,114,54,0,0,0,114,54,0,0,0,114,55,0,
+    0,0,114,79,0,0,0,251,0,0,0,115,2,0,0,0,
+    0,1,122,35,66,117,102,102,101,114,101,100,73,110,99,114,
+    101,109,101,110,116,97,108,69,110,99,111,100,101,114,46,115,
+    101,116,115,116,97,116,101,78,41,1,114,64,0,0,0,41,
+    1,70,41,10,114,62,0,0,0,114,57,0,0,0,114,58,
+    0,0,0,114,63,0,0,0,114,73,0,0,0,114,83,0,
+    0,0,114,33,0,0,0,114,76,0,0,0,114,77,0,0,
+    0,114,79,0,0,0,114,54,0,0,0,114,54,0,0,0,
+    114,54,0,0,0,114,55,0,0,0,114,80,0,0,0,220,
+    0,0,0,115,14,0,0,0,8,1,4,5,10,5,8,5,
+    10,8,8,4,8,3,114,80,0,0,0,99,0,0,0,0,
+    0,0,0,0,0,0,0,0,3,0,0,0,64,0,0,0,
+    115,60,0,0,0,101,0,90,1,100,0,90,2,100,1,90,
+    3,100,15,100,3,100,4,132,1,90,4,100,16,100,6,100,
+    7,132,1,90,5,100,8,100,9,132,0,90,6,100,10,100,
+    11,132,0,90,7,100,12,100,13,132,0,90,8,100,14,83,
+    0,41,17,114,22,0,0,0,122,232,10,32,32,32,32,65,
+    110,32,73,110,99,114,101,109,101,110,116,97,108,68,101,99,
+    111,100,101,114,32,100,101,99,111,100,101,115,32,97,110,32,
+    105,110,112,117,116,32,105,110,32,109,117,108,116,105,112,108,
+    101,32,115,116,101,112,115,46,32,84,104,101,32,105,110,112,
+    117,116,32,99,97,110,10,32,32,32,32,98,101,32,112,97,
+    115,115,101,100,32,112,105,101,99,101,32,98,121,32,112,105,
+    101,99,101,32,116,111,32,116,104,101,32,100,101,99,111,100,
+    101,40,41,32,109,101,116,104,111,100,46,32,84,104,101,32,
+    73,110,99,114,101,109,101,110,116,97,108,68,101,99,111,100,
+    101,114,10,32,32,32,32,114,101,109,101,109,98,101,114,115,
+    32,116,104,101,32,115,116,97,116,101,32,111,102,32,116,104,
+    101,32,100,101,99,111,100,105,110,103,32,112,114,111,99,101,
+    115,115,32,98,101,116,119,101,101,110,32,99,97,108,108,115,
+    32,116,111,32,100,101,99,111,100,101,40,41,46,10,32,32,
+    32,32,114,64,0,0,0,99,2,0,0,0,0,0,0,0,
+    2,0,0,0,2,0,0,0,67,0,0,0,115,10,0,0,
+    0,124,1,124,0,95,0,100,1,83,0,41,2,122,243,10,
+    32,32,32,32,32,32,32,32,67,114,101,97,116,101,32,97,
+    110,32,73,110,99,114,101,109,101,110,116,97,108,68,101,99,
+    111,100,101,114,32,105,110,115,116,97,110,99,101,46,10,10,
+    32,32,32,32,32,32,32,32,84,104,101,32,73,110,99,114,
+    101,109,101,110,116,97,108,68,101,99,111,100,101,114,32,109,
+    97,121,32,117,115,101,32,100,105,102,102,101,114,101,110,116,
+    32,101,114,114,111,114,32,104,97,110,100,108,105,110,103,32,
+    115,99,104,101,109,101,115,32,98,121,10,32,32,32,32,32,
+    32,32,32,112,114,111,118,105,100,105,110,103,32,116,104,101,
+    32,101,114,114,111,114,115,32,107,101,121,119,111,114,100,32,
+    97,114,103,117,109,101,110,116,46,32,83,101,101,32,116,104,
+    101,32,109,111,100,117,108,101,32,100,111,99,115,116,114,105,
+    110,103,10,32,32,32,32,32,32,32,32,102,111,114,32,97,
+    32,108,105,115,116,32,111,102,32,112,111,115,115,105,98,108,
+    101,32,118,97,108,117,101,115,46,10,32,32,32,32,32,32,
+    32,32,78,41,1,114,69,0,0,0,114,72,0,0,0,114,
+    54,0,0,0,114,54,0,0,0,114,55,0,0,0,114,73,
+    0,0,0,4,1,0,0,115,2,0,0,0,0,8,122,27,
+    73,110,99,114,101,109,101,110,116,97,108,68,101,99,111,100,
+    101,114,46,95,95,105,110,105,116,95,95,70,99,3,0,0,
+    0,0,0,0,0,3,0,0,0,1,0,0,0,67,0,0,
+    0,115,8,0,0,0,116,0,130,1,100,1,83,0,41,2,
+    122,64,10,32,32,32,32,32,32,32,32,68,101,99,111,100,
+    101,32,105,110,112,117,116,32,97,110,100,32,114,101,116,117,
+    114,110,115,32,116,104,101,32,114,101,115,117,108,116,105,110,
+    103,32,111,98,106,101,99,116,46,10,32,32,32,32,32,32,
+    32,32,78,114,65,0,0,0,114,74,0,0,0,114,54,0,
+    0,0,114,54,0,0,0,114,55,0,0,0,114,34,0,0,
+    0,14,1,0,0,115,2,0,0,0,0,4,122,25,73,110,
+    99,114,101,109,101,110,116,97,108,68,101,99,111,100,101,114,
+    46,100,101,99,111,100,101,99,1,0,0,0,0,0,0,0,
+    1,0,0,0,1,0,0,0,67,0,0,0,115,4,0,0,
+    0,100,1,83,0,41,2,122,57,10,32,32,32,32,32,32,
+    32,32,82,101,115,101,116,32,116,104,101,32,100,101,99,111,
+    100,101,114,32,116,111,32,116,104,101,32,105,110,105,116,105,
+    97,108,32,115,116,97,116,101,46,10,32,32,32,32,32,32,
+    32,32,78,114,54,0,0,0,114,60,0,0,0,114,54,0,
+    0,0,114,54,0,0,0,114,55,0,0,0,114,76,0,0,
+    0,20,1,0,0,115,2,0,0,0,0,1,122,24,73,110,
+    99,114,101,109,101,110,116,97,108,68,101,99,111,100,101,114,
+    46,114,101,115,101,116,99,1,0,0,0,0,0,0,0,1,
+    0,0,0,1,0,0,0,67,0,0,0,115,4,0,0,0,
+    100,1,83,0,41,2,97,9,2,0,0,10,32,32,32,32,
+    32,32,32,32,82,101,116,117,114,110,32,116,104,101,32,99,
+    117,114,114,101,110,116,32,115,116,97,116,101,32,111,102,32,
+    116,104,101,32,100,101,99,111,100,101,114,46,10,10,32,32,
+    32,32,32,32,32,32,84,104,105,115,32,109,117,115,116,32,
+    98,101,32,97,32,40,98,117,102,102,101,114,101,100,95,105,
+    110,112,117,116,44,32,97,100,100,105,116,105,111,110,97,108,
+    95,115,116,97,116,101,95,105,110,102,111,41,32,116,117,112,
+    108,101,46,10,32,32,32,32,32,32,32,32,98,117,102,102,
+    101,114,101,100,95,105,110,112,117,116,32,109,117,115,116,32,
+    98,101,32,97,32,98,121,116,101,115,32,111,98,106,101,99,
+    116,32,99,111,110,116,97,105,110,105,110,103,32,98,121,116,
+    101,115,32,116,104,97,116,10,32,32,32,32,32,32,32,32,
+    119,101,114,101,32,112,97,115,115,101,100,32,116,111,32,100,
+    101,99,111,100,101,40,41,32,116,104,97,116,32,104,97,118,
+    101,32,110,111,116,32,121,101,116,32,98,101,101,110,32,99,
+    111,110,118,101,114,116,101,100,46,10,32,32,32,32,32,32,
+    32,32,97,100,100,105,116,105,111,110,97,108,95,115,116,97,
+    116,101,95,105,110,102,111,32,109,117,115,116,32,98,101,32,
+    97,32,110,111,110,45,110,101,103,97,116,105,118,101,32,105,
+    110,116,101,103,101,114,10,32,32,32,32,32,32,32,32,114,
+    101,112,114,101,115,101,110,116,105,110,103,32,116,104,101,32,
+    115,116,97,116,101,32,111,102,32,116,104,101,32,100,101,99,
+    111,100,101,114,32,87,73,84,72,79,85,84,32,121,101,116,
+    32,104,97,118,105,110,103,10,32,32,32,32,32,32,32,32,
+    112,114,111,99,101,115,115,101,100,32,116,104,101,32,99,111,
+    110,116,101,110,116,115,32,111,102,32,98,117,102,102,101,114,
+    101,100,95,105,110,112,117,116,46,32,32,73,110,32,116,104,
+    101,32,105,110,105,116,105,97,108,32,115,116,97,116,101,10,
+    32,32,32,32,32,32,32,32,97,110,100,32,97,102,116,101,
+    114,32,114,101,115,101,116,40,41,44,32,103,101,116,115,116,
+    97,116,101,40,41,32,109,117,115,116,32,114,101,116,117,114,
+    110,32,40,98,34,34,44,32,48,41,46,10,32,32,32,32,
+    32,32,32,32,41,2,243,0,0,0,0,114,0,0,0,0,
+    114,54,0,0,0,114,60,0,0,0,114,54,0,0,0,114,
+    54,0,0,0,114,55,0,0,0,114,77,0,0,0,25,1,
+    0,0,115,2,0,0,0,0,12,122,27,73,110,99,114,101,
+    109,101,110,116,97,108,68,101,99,111,100,101,114,46,103,101,
+    116,115,116,97,116,101,99,2,0,0,0,0,0,0,0,2,
+    0,0,0,1,0,0,0,67,0,0,0,115,4,0,0,0,
+    100,1,83,0,41,2,122,182,10,32,32,32,32,32,32,32,
+    32,83,101,116,32,116,104,101,32,99,117,114,114,101,110,116,
+    32,115,116,97,116,101,32,111,102,32,116,104,101,32,100,101,
+    99,111,100,101,114,46,10,10,32,32,32,32,32,32,32,32,
+    115,116,97,116,101,32,109,117,115,116,32,104,97,118,101,32,
+    98,101,101,110,32,114,101,116,117,114,110,101,100,32,98,121,
+    32,103,101,116,115,116,97,116,101,40,41,46,32,32,84,104,
+    101,32,101,102,102,101,99,116,32,111,102,10,32,32,32,32,
+    32,32,32,32,115,101,116,115,116,97,116,101,40,40,98,34,
+    34,44,32,48,41,41,32,109,117,115,116,32,98,101,32,101,
+    113,117,105,118,97,108,101,110,116,32,116,111,32,114,101,115,
+    101,116,40,41,46,10,32,32,32,32,32,32,32,32,78,114,
+    54,0,0,0,114,78,0,0,0,114,54,0,0,0,114,54,
+    0,0,0,114,55,0,0,0,114,79,0,0,0,39,1,0,
+    0,115,2,0,0,0,0,1,122,27,73,110,99,114,101,109,
+    101,110,116,97,108,68,101,99,111,100,101,114,46,115,101,116,
+    115,116,97,116,101,78,41,1,114,64,0,0,0,41,1,70,
+    41,9,114,62,0,0,0,114,57,0,0,0,114,58,0,0,
+    0,114,63,0,0,0,114,73,0,0,0,114,34,0,0,0,
+    114,76,0,0,0,114,77,0,0,0,114,79,0,0,0,114,
+    54,0,0,0,114,54,0,0,0,114,54,0,0,0,114,55,
+    0,0,0,114,22,0,0,0,254,0,0,0,115,12,0,0,
+    0,8,1,4,5,10,10,10,6,8,5,8,14,99,0,0,
+    0,0,0,0,0,0,0,0,0,0,3,0,0,0,64,0,
+    0,0,115,68,0,0,0,101,0,90,1,100,0,90,2,100,
+    1,90,3,100,17,100,3,100,4,132,1,90,4,100,5,100,
+    6,132,0,90,5,100,18,100,8,100,9,132,1,90,6,100,
+    10,100,11,132,0,90,7,100,12,100,13,132,0,90,8,100,
+    14,100,15,132,0,90,9,100,16,83,0,41,19,218,26,66,
+    117,102,102,101,114,101,100,73,110,99,114,101,109,101,110,116,
+    97,108,68,101,99,111,100,101,114,122,174,10,32,32,32,32,
+    84,104,105,115,32,115,117,98,99,108,97,115,115,32,111,102,
+    32,73,110,99,114,101,109,101,110,116,97,108,68,101,99,111,
+    100,101,114,32,99,97,110,32,98,101,32,117,115,101,100,32,
+    97,115,32,116,104,101,32,98,97,115,101,99,108,97,115,115,
+    32,102,111,114,32,97,110,10,32,32,32,32,105,110,99,114,
+    101,109,101,110,116,97,108,32,100,101,99,111,100,101,114,32,
+    105,102,32,116,104,101,32,100,101,99,111,100,101,114,32,109,
+    117,115,116,32,98,101,32,97,98,108,101,32,116,111,32,104,
+    97,110,100,108,101,32,105,110,99,111,109,112,108,101,116,101,
+    10,32,32,32,32,98,121,116,101,32,115,101,113,117,101,110,
+    99,101,115,46,10,32,32,32,32,114,64,0,0,0,99,2,
+    0,0,0,0,0,0,0,2,0,0,0,4,0,0,0,67,
+    0,0,0,115,22,0,0,0,116,0,160,1,124,0,124,1,
+    161,2,1,0,100,1,124,0,95,2,100,0,83,0,169,2,
+    78,114,90,0,0,0,41,3,114,22,0,0,0,114,73,0,
+    0,0,114,71,0,0,0,114,72,0,0,0,114,54,0,0,
+    0,114,54,0,0,0,114,55,0,0,0,114,73,0,0,0,
+    53,1,0,0,115,4,0,0,0,0,1,12,2,122,35,66,
+    117,102,102,101,114,101,100,73,110,99,114,101,109,101,110,116,
+    97,108,68,101,99,111,100,101,114,46,95,95,105,110,105,116,
+    95,95,99,4,0,0,0,0,0,0,0,4,0,0,0,1,
+    0,0,0,67,0,0,0,115,8,0,0,0,116,0,130,1,
+    100,0,83,0,114,45,0,0,0,114,65,0,0,0,114,82,
+    0,0,0,114,54,0,0,0,114,54,0,0,0,114,55,0,
+    0,0,218,14,95,98,117,102,102,101,114,95,100,101,99,111,
+    100,101,58,1,0,0,115,2,0,0,0,0,3,122,41,66,
+    117,102,102,101,114,101,100,73,110,99,114,101,109,101,110,116,
+    97,108,68,101,99,111,100,101,114,46,95,98,117,102,102,101,
+    114,95,100,101,99,111,100,101,70,99,3,0,0,0,0,0,
+    0,0,6,0,0,0,5,0,0,0,67,0,0,0,115,48,
+    0,0,0,124,0,106,0,124,1,23,0,125,3,124,0,160,
+    1,124,3,124,0,106,2,124,2,161,3,92,2,125,4,125,
+    5,124,3,124,5,100,0,133,2,25,0,124,0,95,0,124,
+    4,83,0,114,45,0,0,0,41,3,114,71,0,0,0,114,
+    93,0,0,0,114,69,0,0,0,114,84,0,0,0,114,54,
+    0,0,0,114,54,0,0,0,114,55,0,0,0,114,34,0,
+    0,0,63,1,0,0,115,8,0,0,0,0,2,10,1,20,
+    2,14,1,122,33,66,117,102,102,101,114,101,100,73,110,99,
+    114,101,109,101,110,116,97,108,68,101,99,111,100,101,114,46,
+    100,101,99,111,100,101,99,1,0,0,0,0,0,0,0,1,
+    0,0,0,3,0,0,0,67,0,0,0,115,20,0,0,0,
+    116,0,160,1,124,0,161,1,1,0,100,1,124,0,95,2,
+    100,0,83,0,114,92,0,0,0,41,3,114,22,0,0,0,
+    114,76,0,0,0,114,71,0,0,0,114,60,0,0,0,114,
+    54,0,0,0,114,54,0,0,0,114,55,0,0,0,114,76,
+    0,0,0,71,1,0,0,115,4,0,0,0,0,1,10,1,
+    122,32,66,117,102,102,101,114,101,100,73,110,99,114,101,109,
+    101,110,116,97,108,68,101,99,111,100,101,114,46,114,101,115,
+    101,116,99,1,0,0,0,0,0,0,0,1,0,0,0,2,
+    0,0,0,67,0,0,0,115,10,0,0,0,124,0,106,0,
+    100,1,102,2,83,0,114,88,0,0,0,114,89,0,0,0,
+    114,60,0,0,0,114,54,0,0,0,114,54,0,0,0,114,
+    55,0,0,0,114,77,0,0,0,75,1,0,0,115,2,0,
+    0,0,0,2,122,35,66,117,102,102,101,114,101,100,73,110,
+    99,114,101,109,101,110,116,97,108,68,101,99,111,100,101,114,
+    46,103,101,116,115,116,97,116,101,99,2,0,0,0,0,0,
+    0,0,2,0,0,0,2,0,0,0,67,0,0,0,115,14,
+    0,0,0,124,1,100,1,25,0,124,0,95,0,100,0,83,
+    0,114,88,0,0,0,114,89,0,0,0,114,78,0,0,0,
+    114,54,0,0,0,114,54,0,0,0,114,55,0,0,0,114,
+    79,0,0,0,79,1,0,0,115,2,0,0,0,0,2,122,
+    35,66,117,102,102,101,114,101,100,73,110,99,114,101,109,101,
+    110,116,97,108,68,101,99,111,100,101,114,46,115,101,116,115,
+    116,97,116,101,78,41,1,114,64,0,0,0,41,1,70,41,
+    10,114,62,0,0,0,114,57,0,0,0,114,58,0,0,0,
+    114,63,0,0,0,114,73,0,0,0,114,93,0,0,0,114,
+    34,0,0,0,114,76,0,0,0,114,77,0,0,0,114,79,
+    0,0,0,114,54,0,0,0,114,54,0,0,0,114,54,0,
+    0,0,114,55,0,0,0,114,91,0,0,0,47,1,0,0,
+    115,14,0,0,0,8,1,4,5,10,5,8,5,10,8,8,
+    4,8,4,114,91,0,0,0,99,0,0,0,0,0,0,0,
+    0,0,0,0,0,3,0,0,0,64,0,0,0,115,88,0,
+    0,0,101,0,90,1,100,0,90,2,100,1,102,1,100,2,
+    100,3,132,1,90,3,100,4,100,5,132,0,90,4,100,6,
+    100,7,132,0,90,5,100,8,100,9,132,0,90,6,100,10,
+    102,1,100,11,100,12,132,1,90,7,101,8,102,1,100,13,
+    100,14,132,1,90,9,100,15,100,16,132,0,90,10,100,17,
+    100,18,132,0,90,11,100,19,83,0,41,20,114,24,0,0,
+    0,114,64,0,0,0,99,3,0,0,0,0,0,0,0,3,
+    0,0,0,2,0,0,0,67,0,0,0,115,16,0,0,0,
+    124,1,124,0,95,0,124,2,124,0,95,1,100,1,83,0,
+    41,2,97,119,3,0,0,32,67,114,101,97,116,101,115,32,
+    97,32,83,116,114,101,97,109,87,114,105,116,101,114,32,105,
+    110,115,116,97,110,99,101,46,10,10,32,32,32,32,32,32,
+    32,32,32,32,32,32,115,116,114,101,97,109,32,109,117,115,
+    116,32,98,101,32,97,32,102,105,108,101,45,108,105,107,101,
+    32,111,98,106,101,99,116,32,111,112,101,110,32,102,111,114,
+    32,119,114,105,116,105,110,103,46,10,10,32,32,32,32,32,
+    32,32,32,32,32,32,32,84,104,101,32,83,116,114,101,97,
+    109,87,114,105,116,101,114,32,109,97,121,32,117,115,101,32,
+    100,105,102,102,101,114,101,110,116,32,101,114,114,111,114,32,
+    104,97,110,100,108,105,110,103,10,32,32,32,32,32,32,32,
+    32,32,32,32,32,115,99,104,101,109,101,115,32,98,121,32,
+    112,114,111,118,105,100,105,110,103,32,116,104,101,32,101,114,
+    114,111,114,115,32,107,101,121,119,111,114,100,32,97,114,103,
+    117,109,101,110,116,46,32,84,104,101,115,101,10,32,32,32,
+    32,32,32,32,32,32,32,32,32,112,97,114,97,109,101,116,
+    101,114,115,32,97,114,101,32,112,114,101,100,101,102,105,110,
+    101,100,58,10,10,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,39,115,116,114,105,99,116,39,32,45,32,114,97,105,
+    115,101,32,97,32,86,97,108,117,101,69,114,114,111,114,32,
+    40,111,114,32,97,32,115,117,98,99,108,97,115,115,41,10,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,39,105,103,
+    110,111,114,101,39,32,45,32,105,103,110,111,114,101,32,116,
+    104,101,32,99,104,97,114,97,99,116,101,114,32,97,110,100,
+    32,99,111,110,116,105,110,117,101,32,119,105,116,104,32,116,
+    104,101,32,110,101,120,116,10,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,39,114,101,112,108,97,99,101,39,45,32,
+    114,101,112,108,97,99,101,32,119,105,116,104,32,97,32,115,
+    117,105,116,97,98,108,101,32,114,101,112,108,97,99,101,109,
+    101,110,116,32,99,104,97,114,97,99,116,101,114,10,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,39,120,109,108,99,
+    104,97,114,114,101,102,114,101,112,108,97,99,101,39,32,45,
+    32,82,101,112,108,97,99,101,32,119,105,116,104,32,116,104,
+    101,32,97,112,112,114,111,112,114,105,97,116,101,32,88,77,
+    76,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,99,104,97,114,97,99,116,101,114,32,114,
+    101,102,101,114,101,110,99,101,46,10,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,39,98,97,99,107,115,108,97,115,
+    104,114,101,112,108,97,99,101,39,32,32,45,32,82,101,112,
+    108,97,99,101,32,119,105,116,104,32,98,97,99,107,115,108,
+    97,115,104,101,100,32,101,115,99,97,112,101,10,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    115,101,113,117,101,110,99,101,115,46,10,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,39,110,97,109,101,114,101,112,
+    108,97,99,101,39,32,32,32,32,32,32,32,45,32,82,101,
+    112,108,97,99,101,32,119,105,116,104,32,92,78,123,46,46,
+    46,125,32,101,115,99,97,112,101,32,115,101,113,117,101,110,
+    99,101,115,46,10,10,32,32,32,32,32,32,32,32,32,32,
+    32,32,84,104,101,32,115,101,116,32,111,102,32,97,108,108,
+    111,119,101,100,32,112,97,114,97,109,101,116,101,114,32,118,
+    97,108,117,101,115,32,99,97,110,32,98,101,32,101,120,116,
+    101,110,100,101,100,32,118,105,97,10,32,32,32,32,32,32,
+    32,32,32,32,32,32,114,101,103,105,115,116,101,114,95,101,
+    114,114,111,114,46,10,32,32,32,32,32,32,32,32,78,41,
+    2,218,6,115,116,114,101,97,109,114,69,0,0,0,169,3,
+    114,53,0,0,0,114,94,0,0,0,114,69,0,0,0,114,
+    54,0,0,0,114,54,0,0,0,114,55,0,0,0,114,73,
+    0,0,0,92,1,0,0,115,4,0,0,0,0,22,6,1,
+    122,21,83,116,114,101,97,109,87,114,105,116,101,114,46,95,
+    95,105,110,105,116,95,95,99,2,0,0,0,0,0,0,0,
+    4,0,0,0,4,0,0,0,67,0,0,0,115,34,0,0,
+    0,124,0,160,0,124,1,124,0,106,1,161,2,92,2,125,
+    2,125,3,124,0,106,2,160,3,124,2,161,1,1,0,100,
+    1,83,0,41,2,122,62,32,87,114,105,116,101,115,32,116,
+    104,101,32,111,98,106,101,99,116,39,115,32,99,111,110,116,
+    101,110,116,115,32,101,110,99,111,100,101,100,32,116,111,32,
+    115,101,108,102,46,115,116,114,101,97,109,46,10,32,32,32,
+    32,32,32,32,32,78,41,4,114,33,0,0,0,114,69,0,
+    0,0,114,94,0,0,0,218,5,119,114,105,116,101,41,4,
+    114,53,0,0,0,218,6,111,98,106,101,99,116,114,85,0,
+    0,0,114,87,0,0,0,114,54,0,0,0,114,54,0,0,
+    0,114,55,0,0,0,114,96,0,0,0,117,1,0,0,115,
+    4,0,0,0,0,4,18,1,122,18,83,116,114,101,97,109,
+    87,114,105,116,101,114,46,119,114,105,116,101,99,2,0,0,
+    0,0,0,0,0,2,0,0,0,5,0,0,0,67,0,0,
+    0,115,20,0,0,0,124,0,160,0,100,1,160,1,124,1,
+    161,1,161,1,1,0,100,2,83,0,41,3,122,91,32,87,
+    114,105,116,101,115,32,116,104,101,32,99,111,110,99,97,116,
+    101,110,97,116,101,100,32,108,105,115,116,32,111,102,32,115,
+    116,114,105,110,103,115,32,116,111,32,116,104,101,32,115,116,
+    114,101,97,109,10,32,32,32,32,32,32,32,32,32,32,32,
+    32,117,115,105,110,103,32,46,119,114,105,116,101,40,41,46,
+    10,32,32,32,32,32,32,32,32,114,70,0,0,0,78,41,
+    2,114,96,0,0,0,218,4,106,111,105,110,169,2,114,53,
+    0,0,0,218,4,108,105,115,116,114,54,0,0,0,114,54,
+    0,0,0,114,55,0,0,0,218,10,119,114,105,116,101,108,
+    105,110,101,115,124,1,0,0,115,2,0,0,0,0,5,122,
+    23,83,116,114,101,97,109,87,114,105,116,101,114,46,119,114,
+    105,116,101,108,105,110,101,115,99,1,0,0,0,0,0,0,
+    0,1,0,0,0,1,0,0,0,67,0,0,0,115,4,0,
+    0,0,100,1,83,0,41,2,97,53,1,0,0,32,70,108,
+    117,115,104,101,115,32,97,110,100,32,114,101,115,101,116,115,
+    32,116,104,101,32,99,111,100,101,99,32,98,117,102,102,101,
+    114,115,32,117,115,101,100,32,102,111,114,32,107,101,101,112,
+    105,110,103,32,115,116,97,116,101,46,10,10,32,32,32,32,
+    32,32,32,32,32,32,32,32,67,97,108,108,105,110,103,32,
+    116,104,105,115,32,109,101,116,104,111,100,32,115,104,111,117,
+    108,100,32,101,110,115,117,114,101,32,116,104,97,116,32,116,
+    104,101,32,100,97,116,97,32,111,110,32,116,104,101,10,32,
+    32,32,32,32,32,32,32,32,32,32,32,111,117,116,112,117,
+    116,32,105,115,32,112,117,116,32,105,110,116,111,32,97,32,
+    99,108,101,97,110,32,115,116,97,116,101,44,32,116,104,97,
+    116,32,97,108,108,111,119,115,32,97,112,112,101,110,100,105,
+    110,103,10,32,32,32,32,32,32,32,32,32,32,32,32,111,
+    102,32,110,101,119,32,102,114,101,115,104,32,100,97,116,97,
+    32,119,105,116,104,111,117,116,32,104,97,118,105,110,103,32,
+    116,111,32,114,101,115,99,97,110,32,116,104,101,32,119,104,
+    111,108,101,10,32,32,32,32,32,32,32,32,32,32,32,32,
+    115,116,114,101,97,109,32,116,111,32,114,101,99,111,118,101,
+    114,32,115,116,97,116,101,46,10,10,32,32,32,32,32,32,
+    32,32,78,114,54,0,0,0,114,60,0,0,0,114,54,0,
+    0,0,114,54,0,0,0,114,55,0,0,0,114,76,0,0,
+    0,131,1,0,0,115,2,0,0,0,0,10,122,18,83,116,
+    114,101,97,109,87,114,105,116,101,114,46,114,101,115,101,116,
+    114,0,0,0,0,99,3,0,0,0,0,0,0,0,3,0,
+    0,0,4,0,0,0,67,0,0,0,115,42,0,0,0,124,
+    0,106,0,160,1,124,1,124,2,161,2,1,0,124,2,100,
+    1,107,2,114,38,124,1,100,1,107,2,114,38,124,0,160,
+    2,161,0,1,0,100,0,83,0,114,88,0,0,0,169,3,
+    114,94,0,0,0,218,4,115,101,101,107,114,76,0,0,0,
+    169,3,114,53,0,0,0,218,6,111,102,102,115,101,116,90,
+    6,119,104,101,110,99,101,114,54,0,0,0,114,54,0,0,
+    0,114,55,0,0,0,114,103,0,0,0,143,1,0,0,115,
+    6,0,0,0,0,1,14,1,16,1,122,17,83,116,114,101,
+    97,109,87,114,105,116,101,114,46,115,101,101,107,99,3,0,
+    0,0,0,0,0,0,3,0,0,0,3,0,0,0,67,0,
+    0,0,115,12,0,0,0,124,2,124,0,106,0,124,1,131,
+    2,83,0,169,1,122,63,32,73,110,104,101,114,105,116,32,
+    97,108,108,32,111,116,104,101,114,32,109,101,116,104,111,100,
+    115,32,102,114,111,109,32,116,104,101,32,117,110,100,101,114,
+    108,121,105,110,103,32,115,116,114,101,97,109,46,10,32,32,
+    32,32,32,32,32,32,169,1,114,94,0,0,0,169,3,114,
+    53,0,0,0,114,48,0,0,0,218,7,103,101,116,97,116,
+    116,114,114,54,0,0,0,114,54,0,0,0,114,55,0,0,
+    0,218,11,95,95,103,101,116,97,116,116,114,95,95,148,1,
+    0,0,115,2,0,0,0,0,5,122,24,83,116,114,101,97,
+    109,87,114,105,116,101,114,46,95,95,103,101,116,97,116,116,
+    114,95,95,99,1,0,0,0,0,0,0,0,1,0,0,0,
+    1,0,0,0,67,0,0,0,115,4,0,0,0,124,0,83,
+    0,114,45,0,0,0,114,54,0,0,0,114,60,0,0,0,
+    114,54,0,0,0,114,54,0,0,0,114,55,0,0,0,218,
+    9,95,95,101,110,116,101,114,95,95,155,1,0,0,115,2,
+    0,0,0,0,1,122,22,83,116,114,101,97,109,87,114,105,
+    116,101,114,46,95,95,101,110,116,101,114,95,95,99,4,0,
+    0,0,0,0,0,0,4,0,0,0,2,0,0,0,67,0,
+    0,0,115,14,0,0,0,124,0,106,0,160,1,161,0,1,
+    0,100,0,83,0,114,45,0,0,0,169,2,114,94,0,0,
+    0,218,5,99,108,111,115,101,169,4,114,53,0,0,0,218,
+    4,116,121,112,101,218,5,118,97,108,117,101,90,2,116,98,
+    114,54,0,0,0,114,54,0,0,0,114,55,0,0,0,218,
+    8,95,95,101,120,105,116,95,95,158,1,0,0,115,2,0,
+    0,0,0,1,122,21,83,116,114,101,97,109,87,114,105,116,
+    101,114,46,95,95,101,120,105,116,95,95,78,41,12,114,62,
+    0,0,0,114,57,0,0,0,114,58,0,0,0,114,73,0,
+    0,0,114,96,0,0,0,114,101,0,0,0,114,76,0,0,
+    0,114,103,0,0,0,114,109,0,0,0,114,110,0,0,0,
+    114,111,0,0,0,114,117,0,0,0,114,54,0,0,0,114,
+    54,0,0,0,114,54,0,0,0,114,55,0,0,0,114,24,
+    0,0,0,90,1,0,0,115,18,0,0,0,8,2,12,25,
+    8,7,8,7,8,12,12,6,2,255,10,7,8,3,99,0,
+    0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,64,
+    0,0,0,115,148,0,0,0,101,0,90,1,100,0,90,2,
+    101,3,90,4,100,1,102,1,100,2,100,3,132,1,90,5,
+    100,1,102,1,100,4,100,5,132,1,90,6,100,6,100,6,
+    100,7,102,3,100,8,100,9,132,1,90,7,100,10,100,11,
+    102,2,100,12,100,13,132,1,90,8,100,10,100,11,102,2,
+    100,14,100,15,132,1,90,9,100,16,100,17,132,0,90,10,
+    100,18,102,1,100,19,100,20,132,1,90,11,100,21,100,22,
+    132,0,90,12,100,23,100,24,132,0,90,13,101,14,102,1,
+    100,25,100,26,132,1,90,15,100,27,100,28,132,0,90,16,
+    100,29,100,30,132,0,90,17,100,10,83,0,41,31,114,23,
+    0,0,0,114,64,0,0,0,99,3,0,0,0,0,0,0,
+    0,3,0,0,0,2,0,0,0,67,0,0,0,115,46,0,
+    0,0,124,1,124,0,95,0,124,2,124,0,95,1,100,1,
+    124,0,95,2,124,0,160,3,161,0,124,0,95,4,124,0,
+    106,4,124,0,95,5,100,2,124,0,95,6,100,2,83,0,
+    41,3,97,141,2,0,0,32,67,114,101,97,116,101,115,32,
+    97,32,83,116,114,101,97,109,82,101,97,100,101,114,32,105,
+    110,115,116,97,110,99,101,46,10,10,32,32,32,32,32,32,
+    32,32,32,32,32,32,115,116,114,101,97,109,32,109,117,115,
+    116,32,98,101,32,97,32,102,105,108,101,45,108,105,107,101,
+    32,111,98,106,101,99,116,32,111,112,101,110,32,102,111,114,
+    32,114,101,97,100,105,110,103,46,10,10,32,32,32,32,32,
+    32,32,32,32,32,32,32,84,104,101,32,83,116,114,101,97,
+    109,82,101,97,100,101,114,32,109,97,121,32,117,115,101,32,
+    100,105,102,102,101,114,101,110,116,32,101,114,114,111,114,32,
+    104,97,110,100,108,105,110,103,10,32,32,32,32,32,32,32,
+    32,32,32,32,32,115,99,104,101,109,101,115,32,98,121,32,
+    112,114,111,118,105,100,105,110,103,32,116,104,101,32,101,114,
+    114,111,114,115,32,107,101,121,119,111,114,100,32,97,114,103,
+    117,109,101,110,116,46,32,84,104,101,115,101,10,32,32,32,
+    32,32,32,32,32,32,32,32,32,112,97,114,97,109,101,116,
+    101,114,115,32,97,114,101,32,112,114,101,100,101,102,105,110,
+    101,100,58,10,10,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,39,115,116,114,105,99,116,39,32,45,32,114,97,105,
+    115,101,32,97,32,86,97,108,117,101,69,114,114,111,114,32,
+    40,111,114,32,97,32,115,117,98,99,108,97,115,115,41,10,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,39,105,103,
+    110,111,114,101,39,32,45,32,105,103,110,111,114,101,32,116,
+    104,101,32,99,104,97,114,97,99,116,101,114,32,97,110,100,
+    32,99,111,110,116,105,110,117,101,32,119,105,116,104,32,116,
+    104,101,32,110,101,120,116,10,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,39,114,101,112,108,97,99,101,39,45,32,
+    114,101,112,108,97,99,101,32,119,105,116,104,32,97,32,115,
+    117,105,116,97,98,108,101,32,114,101,112,108,97,99,101,109,
+    101,110,116,32,99,104,97,114,97,99,116,101,114,10,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,39,98,97,99,107,
+    115,108,97,115,104,114,101,112,108,97,99,101,39,32,45,32,
+    82,101,112,108,97,99,101,32,119,105,116,104,32,98,97,99,
+    107,115,108,97,115,104,101,100,32,101,115,99,97,112,101,32,
+    115,101,113,117,101,110,99,101,115,59,10,10,32,32,32,32,
+    32,32,32,32,32,32,32,32,84,104,101,32,115,101,116,32,
+    111,102,32,97,108,108,111,119,101,100,32,112,97,114,97,109,
+    101,116,101,114,32,118,97,108,117,101,115,32,99,97,110,32,
+    98,101,32,101,120,116,101,110,100,101,100,32,118,105,97,10,
+    32,32,32,32,32,32,32,32,32,32,32,32,114,101,103,105,
+    115,116,101,114,95,101,114,114,111,114,46,10,32,32,32,32,
+    32,32,32,32,114,90,0,0,0,78,41,7,114,94,0,0,
+    0,114,69,0,0,0,218,10,98,121,116,101,98,117,102,102,
+    101,114,218,14,99,104,97,114,98,117,102,102,101,114,116,121,
+    112,101,218,17,95,101,109,112,116,121,95,99,104,97,114,98,
+    117,102,102,101,114,218,10,99,104,97,114,98,117,102,102,101,
+    114,218,10,108,105,110,101,98,117,102,102,101,114,114,95,0,
+    0,0,114,54,0,0,0,114,54,0,0,0,114,55,0,0,
+    0,114,73,0,0,0,167,1,0,0,115,12,0,0,0,0,
+    18,6,1,6,1,6,1,10,1,8,1,122,21,83,116,114,
+    101,97,109,82,101,97,100,101,114,46,95,95,105,110,105,116,
+    95,95,99,3,0,0,0,0,0,0,0,3,0,0,0,1,
+    0,0,0,67,0,0,0,115,8,0,0,0,116,0,130,1,
+    100,0,83,0,114,45,0,0,0,114,65,0,0,0,114,67,
+    0,0,0,114,54,0,0,0,114,54,0,0,0,114,55,0,
+    0,0,114,34,0,0,0,192,1,0,0,115,2,0,0,0,
+    0,1,122,19,83,116,114,101,97,109,82,101,97,100,101,114,
+    46,100,101,99,111,100,101,233,255,255,255,255,70,99,4,0,
+    0,0,0,0,0,0,11,0,0,0,10,0,0,0,67,0,
+    0,0,115,80,1,0,0,124,0,106,0,114,28,124,0,106,
+    1,160,2,124,0,106,0,161,1,124,0,95,3,100,1,124,
+    0,95,0,124,2,100,2,107,0,114,40,124,1,125,2,124,
+    2,100,2,107,5,114,66,116,4,124,0,106,3,131,1,124,
+    2,107,5,114,66,144,1,113,20,124,1,100,2,107,0,114,
+    86,124,0,106,5,160,6,161,0,125,4,110,12,124,0,106,
+    5,160,6,124,1,161,1,125,4,124,0,106,7,124,4,23,
+    0,125,5,124,5,115,116,144,1,113,20,122,22,124,0,160,
+    8,124,5,124,0,106,9,161,2,92,2,125,6,125,7,87,
+    0,110,96,4,0,116,10,107,10,114,234,1,0,125,8,1,
+    0,122,66,124,3,114,216,124,0,160,8,124,5,100,1,124,
+    8,106,11,133,2,25,0,124,0,106,9,161,2,92,2,125,
+    6,125,7,124,6,106,12,100,3,100,4,141,1,125,9,116,
+    4,124,9,131,1,100,5,107,1,114,214,130,0,110,2,130,
+    0,87,0,53,0,100,1,125,8,126,8,88,0,89,0,110,
+    2,88,0,124,5,124,7,100,1,133,2,25,0,124,0,95,
+    7,124,0,4,0,106,3,124,6,55,0,2,0,95,3,124,
+    4,144,1,115,18,144,1,113,20,113,40,124,2,100,2,107,
+    0,144,1,114,46,124,0,106,3,125,10,124,0,106,1,124,
+    0,95,3,110,30,124,0,106,3,100,1,124,2,133,2,25,
+    0,125,10,124,0,106,3,124,2,100,1,133,2,25,0,124,
+    0,95,3,124,10,83,0,41,6,97,236,4,0,0,32,68,
+    101,99,111,100,101,115,32,100,97,116,97,32,102,114,111,109,
+    32,116,104,101,32,115,116,114,101,97,109,32,115,101,108,102,
+    46,115,116,114,101,97,109,32,97,110,100,32,114,101,116,117,
+    114,110,115,32,116,104,101,10,32,32,32,32,32,32,32,32,
+    32,32,32,32,114,101,115,117,108,116,105,110,103,32,111,98,
+    106,101,99,116,46,10,10,32,32,32,32,32,32,32,32,32,
+    32,32,32,99,104,97,114,115,32,105,110,100,105,99,97,116,
+    101,115,32,116,104,101,32,110,117,109,98,101,114,32,111,102,
+    32,100,101,99,111,100,101,100,32,99,111,100,101,32,112,111,
+    105,110,116,115,32,111,114,32,98,121,116,101,115,32,116,111,
+    10,32,32,32,32,32,32,32,32,32,32,32,32,114,101,116,
+    117,114,110,46,32,114,101,97,100,40,41,32,119,105,108,108,
+    32,110,101,118,101,114,32,114,101,116,117,114,110,32,109,111,
+    114,101,32,100,97,116,97,32,116,104,97,110,32,114,101,113,
+    117,101,115,116,101,100,44,10,32,32,32,32,32,32,32,32,
+    32,32,32,32,98,117,116,32,105,116,32,109,105,103,104,116,
+    32,114,101,116,117,114,110,32,108,101,115,115,44,32,105,102,
+    32,116,104,101,114,101,32,105,115,32,110,111,116,32,101,110,
+    111,117,103,104,32,97,118,97,105,108,97,98,108,101,46,10,
+    10,32,32,32,32,32,32,32,32,32,32,32,32,115,105,122,
+    101,32,105,110,100,105,99,97,116,101,115,32,116,104,101,32,
+    97,112,112,114,111,120,105,109,97,116,101,32,109,97,120,105,
+    109,117,109,32,110,117,109,98,101,114,32,111,102,32,100,101,
+    99,111,100,101,100,10,32,32,32,32,32,32,32,32,32,32,
+    32,32,98,121,116,101,115,32,111,114,32,99,111,100,101,32,
+    112,111,105,110,116,115,32,116,111,32,114,101,97,100,32,102,
+    111,114,32,100,101,99,111,100,105,110,103,46,32,84,104,101,
+    32,100,101,99,111,100,101,114,10,32,32,32,32,32,32,32,
+    32,32,32,32,32,99,97,110,32,109,111,100,105,102,121,32,
+    116,104,105,115,32,115,101,116,116,105,110,103,32,97,115,32,
+    97,112,112,114,111,112,114,105,97,116,101,46,32,84,104,101,
+    32,100,101,102,97,117,108,116,32,118,97,108,117,101,10,32,
+    32,32,32,32,32,32,32,32,32,32,32,45,49,32,105,110,
+    100,105,99,97,116,101,115,32,116,111,32,114,101,97,100,32,
+    97,110,100,32,100,101,99,111,100,101,32,97,115,32,109,117,
+    99,104,32,97,115,32,112,111,115,115,105,98,108,101,46,32,
+    32,115,105,122,101,10,32,32,32,32,32,32,32,32,32,32,
+    32,32,105,115,32,105,110,116,101,110,100,101,100,32,116,111,
+    32,112,114,101,118,101,110,116,32,104,97,118,105,110,103,32,
+    116,111,32,100,101,99,111,100,101,32,104,117,103,101,32,102,
+    105,108,101,115,32,105,110,32,111,110,101,10,32,32,32,32,
+    32,32,32,32,32,32,32,32,115,116,101,112,46,10,10,32,
+    32,32,32,32,32,32,32,32,32,32,32,73,102,32,102,105,
+    114,115,116,108,105,110,101,32,105,115,32,116,114,117,101,44,
+    32,97,110,100,32,97,32,85,110,105,99,111,100,101,68,101,
+    99,111,100,101,69,114,114,111,114,32,104,97,112,112,101,110,
+    115,10,32,32,32,32,32,32,32,32,32,32,32,32,97,102,
+    116,101,114,32,116,104,101,32,102,105,114,115,116,32,108,105,
+    110,101,32,116,101,114,109,105,110,97,116,111,114,32,105,110,
+    32,116,104,101,32,105,110,112,117,116,32,111,110,108,121,32,
+    116,104,101,32,102,105,114,115,116,32,108,105,110,101,10,32,
+    32,32,32,32,32,32,32,32,32,32,32,119,105,108,108,32,
+    98,101,32,114,101,116,117,114,110,101,100,44,32,116,104,101,
+    32,114,101,115,116,32,111,102,32,116,104,101,32,105,110,112,
+    117,116,32,119,105,108,108,32,98,101,32,107,101,112,116,32,
+    117,110,116,105,108,32,116,104,101,10,32,32,32,32,32,32,
+    32,32,32,32,32,32,110,101,120,116,32,99,97,108,108,32,
+    116,111,32,114,101,97,100,40,41,46,10,10,32,32,32,32,
+    32,32,32,32,32,32,32,32,84,104,101,32,109,101,116,104,
+    111,100,32,115,104,111,117,108,100,32,117,115,101,32,97,32,
+    103,114,101,101,100,121,32,114,101,97,100,32,115,116,114,97,
+    116,101,103,121,44,32,109,101,97,110,105,110,103,32,116,104,
+    97,116,10,32,32,32,32,32,32,32,32,32,32,32,32,105,
+    116,32,115,104,111,117,108,100,32,114,101,97,100,32,97,115,
+    32,109,117,99,104,32,100,97,116,97,32,97,115,32,105,115,
+    32,97,108,108,111,119,101,100,32,119,105,116,104,105,110,32,
+    116,104,101,10,32,32,32,32,32,32,32,32,32,32,32,32,
+    100,101,102,105,110,105,116,105,111,110,32,111,102,32,116,104,
+    101,32,101,110,99,111,100,105,110,103,32,97,110,100,32,116,
+    104,101,32,103,105,118,101,110,32,115,105,122,101,44,32,101,
+    46,103,46,32,32,105,102,10,32,32,32,32,32,32,32,32,
+    32,32,32,32,111,112,116,105,111,110,97,108,32,101,110,99,
+    111,100,105,110,103,32,101,110,100,105,110,103,115,32,111,114,
+    32,115,116,97,116,101,32,109,97,114,107,101,114,115,32,97,
+    114,101,32,97,118,97,105,108,97,98,108,101,10,32,32,32,
+    32,32,32,32,32,32,32,32,32,111,110,32,116,104,101,32,
+    115,116,114,101,97,109,44,32,116,104,101,115,101,32,115,104,
+    111,117,108,100,32,98,101,32,114,101,97,100,32,116,111,111,
+    46,10,32,32,32,32,32,32,32,32,78,114,0,0,0,0,
+    84,169,1,218,8,107,101,101,112,101,110,100,115,233,1,0,
+    0,0,41,13,114,122,0,0,0,114,120,0,0,0,114,98,
+    0,0,0,114,121,0,0,0,218,3,108,101,110,114,94,0,
+    0,0,218,4,114,101,97,100,114,118,0,0,0,114,34,0,
+    0,0,114,69,0,0,0,218,18,85,110,105,99,111,100,101,
+    68,101,99,111,100,101,69,114,114,111,114,218,5,115,116,97,
+    114,116,218,10,115,112,108,105,116,108,105,110,101,115,41,11,
+    114,53,0,0,0,218,4,115,105,122,101,218,5,99,104,97,
+    114,115,218,9,102,105,114,115,116,108,105,110,101,90,7,110,
+    101,119,100,97,116,97,114,85,0,0,0,90,8,110,101,119,
+    99,104,97,114,115,90,12,100,101,99,111,100,101,100,98,121,
+    116,101,115,90,3,101,120,99,218,5,108,105,110,101,115,114,
+    86,0,0,0,114,54,0,0,0,114,54,0,0,0,114,55,
+    0,0,0,114,128,0,0,0,195,1,0,0,115,68,0,0,
+    0,0,28,6,1,16,1,6,2,8,3,4,5,8,1,14,
+    1,4,2,8,1,12,2,12,2,10,1,4,1,4,1,2,
+    1,22,1,16,1,4,2,22,255,6,2,12,1,12,1,4,
+    2,20,2,14,2,14,2,6,1,6,1,10,2,6,1,10,
+    3,14,1,16,1,122,17,83,116,114,101,97,109,82,101,97,
+    100,101,114,46,114,101,97,100,78,84,99,3,0,0,0,0,
+    0,0,0,9,0,0,0,5,0,0,0,67,0,0,0,115,
+    214,1,0,0,124,0,106,0,114,80,124,0,106,0,100,1,
+    25,0,125,3,124,0,106,0,100,1,61,0,116,1,124,0,
+    106,0,131,1,100,2,107,2,114,56,124,0,106,0,100,1,
+    25,0,124,0,95,2,100,3,124,0,95,0,124,2,115,76,
+    124,3,106,3,100,4,100,5,141,1,100,1,25,0,125,3,
+    124,3,83,0,124,1,112,86,100,6,125,4,124,0,106,4,
+    125,3,124,0,106,5,124,4,100,7,100,8,141,2,125,5,
+    124,5,114,170,116,6,124,5,116,7,131,2,114,132,124,5,
+    160,8,100,9,161,1,115,152,116,6,124,5,116,9,131,2,
+    114,170,124,5,160,8,100,10,161,1,114,170,124,5,124,0,
+    106,5,100,2,100,2,100,11,141,2,55,0,125,5,124,3,
+    124,5,55,0,125,3,124,3,106,3,100,7,100,5,141,1,
+    125,6,124,6,144,1,114,142,116,1,124,6,131,1,100,2,
+    107,4,144,1,114,56,124,6,100,1,25,0,125,3,124,6,
+    100,1,61,0,116,1,124,6,131,1,100,2,107,4,144,1,
+    114,14,124,6,100,12,5,0,25,0,124,0,106,2,55,0,
+    3,0,60,0,124,6,124,0,95,0,100,3,124,0,95,2,
+    110,16,124,6,100,1,25,0,124,0,106,2,23,0,124,0,
+    95,2,124,2,144,1,115,52,124,3,106,3,100,4,100,5,
+    141,1,100,1,25,0,125,3,144,1,113,210,124,6,100,1,
+    25,0,125,7,124,6,100,1,25,0,106,3,100,4,100,5,
+    141,1,100,1,25,0,125,8,124,7,124,8,107,3,144,1,
+    114,142,124,0,106,4,160,10,124,6,100,2,100,3,133,2,
+    25,0,161,1,124,0,106,2,23,0,124,0,95,2,124,2,
+    144,1,114,134,124,7,125,3,110,4,124,8,125,3,144,1,
+    113,210,124,5,144,1,114,158,124,1,100,3,107,9,144,1,
+    114,190,124,3,144,1,114,186,124,2,144,1,115,186,124,3,
+    106,3,100,4,100,5,141,1,100,1,25,0,125,3,144,1,
+    113,210,124,4,100,13,107,0,144,1,114,208,124,4,100,14,
+    57,0,125,4,113,94,124,3,83,0,41,15,122,177,32,82,
+    101,97,100,32,111,110,101,32,108,105,110,101,32,102,114,111,
+    109,32,116,104,101,32,105,110,112,117,116,32,115,116,114,101,
+    97,109,32,97,110,100,32,114,101,116,117,114,110,32,116,104,
+    101,10,32,32,32,32,32,32,32,32,32,32,32,32,100,101,
+    99,111,100,101,100,32,100,97,116,97,46,10,10,32,32,32,
+    32,32,32,32,32,32,32,32,32,115,105,122,101,44,32,105,
+    102,32,103,105,118,101,110,44,32,105,115,32,112,97,115,115,
+    101,100,32,97,115,32,115,105,122,101,32,97,114,103,117,109,
+    101,110,116,32,116,111,32,116,104,101,10,32,32,32,32,32,
+    32,32,32,32,32,32,32,114,101,97,100,40,41,32,109,101,
+    116,104,111,100,46,10,10,32,32,32,32,32,32,32,32,114,
+    0,0,0,0,114,126,0,0,0,78,70,114,124,0,0,0,
+    233,72,0,0,0,84,41,1,114,134,0,0,0,250,1,13,
+    243,1,0,0,0,13,41,2,114,132,0,0,0,114,133,0,
+    0,0,114,123,0,0,0,105,64,31,0,0,233,2,0,0,
+    0,41,11,114,122,0,0,0,114,127,0,0,0,114,121,0,
+    0,0,114,131,0,0,0,114,120,0,0,0,114,128,0,0,
+    0,218,10,105,115,105,110,115,116,97,110,99,101,218,3,115,
+    116,114,218,8,101,110,100,115,119,105,116,104,218,5,98,121,
+    116,101,115,114,98,0,0,0,41,9,114,53,0,0,0,114,
+    132,0,0,0,114,125,0,0,0,218,4,108,105,110,101,90,
+    8,114,101,97,100,115,105,122,101,114,85,0,0,0,114,135,
+    0,0,0,90,12,108,105,110,101,48,119,105,116,104,101,110,
+    100,90,15,108,105,110,101,48,119,105,116,104,111,117,116,101,
+    110,100,114,54,0,0,0,114,54,0,0,0,114,55,0,0,
+    0,218,8,114,101,97,100,108,105,110,101,19,2,0,0,115,
+    100,0,0,0,0,11,6,1,10,1,8,1,14,3,12,1,
+    6,1,4,1,16,1,4,2,8,1,6,3,14,1,4,4,
+    20,1,8,255,2,1,8,255,2,2,18,2,8,1,12,1,
+    6,1,14,3,8,1,6,1,14,2,18,1,6,1,8,3,
+    16,1,6,1,16,1,4,1,8,1,20,1,10,2,18,1,
+    4,255,6,2,6,1,6,2,4,1,4,2,16,1,12,1,
+    16,1,4,1,10,1,10,1,122,21,83,116,114,101,97,109,
+    82,101,97,100,101,114,46,114,101,97,100,108,105,110,101,99,
+    3,0,0,0,0,0,0,0,4,0,0,0,3,0,0,0,
+    67,0,0,0,115,18,0,0,0,124,0,160,0,161,0,125,
+    3,124,3,160,1,124,2,161,1,83,0,41,1,97,83,1,
+    0,0,32,82,101,97,100,32,97,108,108,32,108,105,110,101,
+    115,32,97,118,97,105,108,97,98,108,101,32,111,110,32,116,
+    104,101,32,105,110,112,117,116,32,115,116,114,101,97,109,10,
+    32,32,32,32,32,32,32,32,32,32,32,32,97,110,100,32,
+    114,101,116,117,114,110,32,116,104,101,109,32,97,115,32,97,
+    32,108,105,115,116,46,10,10,32,32,32,32,32,32,32,32,
+    32,32,32,32,76,105,110,101,32,98,114,101,97,107,115,32,
+    97,114,101,32,105,109,112,108,101,109,101,110,116,101,100,32,
+    117,115,105,110,103,32,116,104,101,32,99,111,100,101,99,39,
+    115,32,100,101,99,111,100,101,114,10,32,32,32,32,32,32,
+    32,32,32,32,32,32,109,101,116,104,111,100,32,97,110,100,
+    32,97,114,101,32,105,110,99,108,117,100,101,100,32,105,110,
+    32,116,104,101,32,108,105,115,116,32,101,110,116,114,105,101,
+    115,46,10,10,32,32,32,32,32,32,32,32,32,32,32,32,
+    115,105,122,101,104,105,110,116,44,32,105,102,32,103,105,118,
+    101,110,44,32,105,115,32,105,103,110,111,114,101,100,32,115,
+    105,110,99,101,32,116,104,101,114,101,32,105,115,32,110,111,
+    32,101,102,102,105,99,105,101,110,116,10,32,32,32,32,32,
+    32,32,32,32,32,32,32,119,97,121,32,116,111,32,102,105,
+    110,100,105,110,103,32,116,104,101,32,116,114,117,101,32,101,
+    110,100,45,111,102,45,108,105,110,101,46,10,10,32,32,32,
+    32,32,32,32,32,41,2,114,128,0,0,0,114,131,0,0,
+    0,41,4,114,53,0,0,0,218,8,115,105,122,101,104,105,
+    110,116,114,125,0,0,0,114,85,0,0,0,114,54,0,0,
+    0,114,54,0,0,0,114,55,0,0,0,218,9,114,101,97,
+    100,108,105,110,101,115,94,2,0,0,115,4,0,0,0,0,
+    12,8,1,122,22,83,116,114,101,97,109,82,101,97,100,101,
+    114,46,114,101,97,100,108,105,110,101,115,99,1,0,0,0,
+    0,0,0,0,1,0,0,0,2,0,0,0,67,0,0,0,
+    115,24,0,0,0,100,1,124,0,95,0,124,0,106,1,124,
+    0,95,2,100,2,124,0,95,3,100,2,83,0,41,3,122,
+    227,32,82,101,115,101,116,115,32,116,104,101,32,99,111,100,
+    101,99,32,98,117,102,102,101,114,115,32,117,115,101,100,32,
+    102,111,114,32,107,101,101,112,105,110,103,32,115,116,97,116,
+    101,46,10,10,32,32,32,32,32,32,32,32,32,32,32,32,
+    78,111,116,101,32,116,104,97,116,32,110,111,32,115,116,114,
+    101,97,109,32,114,101,112,111,115,105,116,105,111,110,105,110,
+    103,32,115,104,111,117,108,100,32,116,97,107,101,32,112,108,
+    97,99,101,46,10,32,32,32,32,32,32,32,32,32,32,32,
+    32,84,104,105,115,32,109,101,116,104,111,100,32,105,115,32,
+    112,114,105,109,97,114,105,108,121,32,105,110,116,101,110,100,
+    101,100,32,116,111,32,98,101,32,97,98,108,101,32,116,111,
+    32,114,101,99,111,118,101,114,10,32,32,32,32,32,32,32,
+    32,32,32,32,32,102,114,111,109,32,100,101,99,111,100,105,
+    110,103,32,101,114,114,111,114,115,46,10,10,32,32,32,32,
+    32,32,32,32,114,90,0,0,0,78,41,4,114,118,0,0,
+    0,114,120,0,0,0,114,121,0,0,0,114,122,0,0,0,
+    114,60,0,0,0,114,54,0,0,0,114,54,0,0,0,114,
+    55,0,0,0,114,76,0,0,0,109,2,0,0,115,6,0,
+    0,0,0,9,6,1,8,1,122,18,83,116,114,101,97,109,
+    82,101,97,100,101,114,46,114,101,115,101,116,114,0,0,0,
+    0,99,3,0,0,0,0,0,0,0,3,0,0,0,4,0,
+    0,0,67,0,0,0,115,26,0,0,0,124,0,106,0,160,
+    1,124,1,124,2,161,2,1,0,124,0,160,2,161,0,1,
+    0,100,1,83,0,41,2,122,112,32,83,101,116,32,116,104,
+    101,32,105,110,112,117,116,32,115,116,114,101,97,109,39,115,
+    32,99,117,114,114,101,110,116,32,112,111,115,105,116,105,111,
+    110,46,10,10,32,32,32,32,32,32,32,32,32,32,32,32,
+    82,101,115,101,116,115,32,116,104,101,32,99,111,100,101,99,
+    32,98,117,102,102,101,114,115,32,117,115,101,100,32,102,111,
+    114,32,107,101,101,112,105,110,103,32,115,116,97,116,101,46,
+    10,32,32,32,32,32,32,32,32,78,114,102,0,0,0,114,
+    104,0,0,0,114,54,0,0,0,114,54,0,0,0,114,55,
+    0,0,0,114,103,0,0,0,122,2,0,0,115,4,0,0,
+    0,0,5,14,1,122,17,83,116,114,101,97,109,82,101,97,
+    100,101,114,46,115,101,101,107,99,1,0,0,0,0,0,0,
+    0,2,0,0,0,2,0,0,0,67,0,0,0,115,24,0,
+    0,0,124,0,160,0,161,0,125,1,124,1,114,16,124,1,
+    83,0,116,1,130,1,100,1,83,0,41,2,250,52,32,82,
+    101,116,117,114,110,32,116,104,101,32,110,101,120,116,32,100,
+    101,99,111,100,101,100,32,108,105,110,101,32,102,114,111,109,
+    32,116,104,101,32,105,110,112,117,116,32,115,116,114,101,97,
+    109,46,78,41,2,114,145,0,0,0,218,13,83,116,111,112,
+    73,116,101,114,97,116,105,111,110,41,2,114,53,0,0,0,
+    114,144,0,0,0,114,54,0,0,0,114,54,0,0,0,114,
+    55,0,0,0,218,8,95,95,110,101,120,116,95,95,130,2,
+    0,0,115,8,0,0,0,0,3,8,1,4,1,4,1,122,
+    21,83,116,114,101,97,109,82,101,97,100,101,114,46,95,95,
+    110,101,120,116,95,95,99,1,0,0,0,0,0,0,0,1,
+    0,0,0,1,0,0,0,67,0,0,0,115,4,0,0,0,
+    124,0,83,0,114,45,0,0,0,114,54,0,0,0,114,60,
+    0,0,0,114,54,0,0,0,114,54,0,0,0,114,55,0,
+    0,0,218,8,95,95,105,116,101,114,95,95,138,2,0,0,
+    115,2,0,0,0,0,1,122,21,83,116,114,101,97,109,82,
+    101,97,100,101,114,46,95,95,105,116,101,114,95,95,99,3,
+    0,0,0,0,0,0,0,3,0,0,0,3,0,0,0,67,
+    0,0,0,115,12,0,0,0,124,2,124,0,106,0,124,1,
+    131,2,83,0,114,106,0,0,0,114,107,0,0,0,114,108,
+    0,0,0,114,54,0,0,0,114,54,0,0,0,114,55,0,
+    0,0,114,110,0,0,0,141,2,0,0,115,2,0,0,0,
+    0,5,122,24,83,116,114,101,97,109,82,101,97,100,101,114,
+    46,95,95,103,101,116,97,116,116,114,95,95,99,1,0,0,
+    0,0,0,0,0,1,0,0,0,1,0,0,0,67,0,0,
+    0,115,4,0,0,0,124,0,83,0,114,45,0,0,0,114,
+    54,0,0,0,114,60,0,0,0,114,54,0,0,0,114,54,
+    0,0,0,114,55,0,0,0,114,111,0,0,0,148,2,0,
+    0,115,2,0,0,0,0,1,122,22,83,116,114,101,97,109,
+    82,101,97,100,101,114,46,95,95,101,110,116,101,114,95,95,
+    99,4,0,0,0,0,0,0,0,4,0,0,0,2,0,0,
+    0,67,0,0,0,115,14,0,0,0,124,0,106,0,160,1,
+    161,0,1,0,100,0,83,0,114,45,0,0,0,114,112,0,
+    0,0,114,114,0,0,0,114,54,0,0,0,114,54,0,0,
+    0,114,55,0,0,0,114,117,0,0,0,151,2,0,0,115,
+    2,0,0,0,0,1,122,21,83,116,114,101,97,109,82,101,
+    97,100,101,114,46,95,95,101,120,105,116,95,95,41,18,114,
+    62,0,0,0,114,57,0,0,0,114,58,0,0,0,114,141,
+    0,0,0,114,119,0,0,0,114,73,0,0,0,114,34,0,
+    0,0,114,128,0,0,0,114,145,0,0,0,114,147,0,0,
+    0,114,76,0,0,0,114,103,0,0,0,114,150,0,0,0,
+    114,151,0,0,0,114,109,0,0,0,114,110,0,0,0,114,
+    111,0,0,0,114,117,0,0,0,114,54,0,0,0,114,54,
+    0,0,0,114,54,0,0,0,114,55,0,0,0,114,23,0,
+    0,0,163,1,0,0,115,28,0,0,0,8,2,4,2,12,
+    25,12,3,16,80,14,75,14,15,8,13,12,8,8,8,8,
+    4,2,255,10,7,8,3,99,0,0,0,0,0,0,0,0,
+    0,0,0,0,3,0,0,0,64,0,0,0,115,148,0,0,
+    0,101,0,90,1,100,0,90,2,100,1,90,3,100,2,90,
+    4,100,3,102,1,100,4,100,5,132,1,90,5,100,6,102,
+    1,100,7,100,8,132,1,90,6,100,9,102,1,100,10,100,
+    11,132,1,90,7,100,9,102,1,100,12,100,13,132,1,90,
+    8,100,14,100,15,132,0,90,9,100,16,100,17,132,0,90,
+    10,100,18,100,19,132,0,90,11,100,20,100,21,132,0,90,
+    12,100,22,100,23,132,0,90,13,100,24,102,1,100,25,100,
+    26,132,1,90,14,101,15,102,1,100,27,100,28,132,1,90,
+    16,100,29,100,30,132,0,90,17,100,31,100,32,132,0,90,
+    18,100,9,83,0,41,33,114,25,0,0,0,97,1,1,0,
+    0,32,83,116,114,101,97,109,82,101,97,100,101,114,87,114,
+    105,116,101,114,32,105,110,115,116,97,110,99,101,115,32,97,
+    108,108,111,119,32,119,114,97,112,112,105,110,103,32,115,116,
+    114,101,97,109,115,32,119,104,105,99,104,10,32,32,32,32,
+    32,32,32,32,119,111,114,107,32,105,110,32,98,111,116,104,
+    32,114,101,97,100,32,97,110,100,32,119,114,105,116,101,32,
+    109,111,100,101,115,46,10,10,32,32,32,32,32,32,32,32,
+    84,104,101,32,100,101,115,105,103,110,32,105,115,32,115,117,
+    99,104,32,116,104,97,116,32,111,110,101,32,99,97,110,32,
+    117,115,101,32,116,104,101,32,102,97,99,116,111,114,121,32,
+    102,117,110,99,116,105,111,110,115,10,32,32,32,32,32,32,
+    32,32,114,101,116,117,114,110,101,100,32,98,121,32,116,104,
+    101,32,99,111,100,101,99,46,108,111,111,107,117,112,40,41,
+    32,102,117,110,99,116,105,111,110,32,116,111,32,99,111,110,
+    115,116,114,117,99,116,32,116,104,101,10,32,32,32,32,32,
+    32,32,32,105,110,115,116,97,110,99,101,46,10,10,32,32,
+    32,32,218,7,117,110,107,110,111,119,110,114,64,0,0,0,
+    99,5,0,0,0,0,0,0,0,5,0,0,0,3,0,0,
+    0,67,0,0,0,115,40,0,0,0,124,1,124,0,95,0,
+    124,2,124,1,124,4,131,2,124,0,95,1,124,3,124,1,
+    124,4,131,2,124,0,95,2,124,4,124,0,95,3,100,1,
+    83,0,41,2,97,82,1,0,0,32,67,114,101,97,116,101,
+    115,32,97,32,83,116,114,101,97,109,82,101,97,100,101,114,
+    87,114,105,116,101,114,32,105,110,115,116,97,110,99,101,46,
+    10,10,32,32,32,32,32,32,32,32,32,32,32,32,115,116,
+    114,101,97,109,32,109,117,115,116,32,98,101,32,97,32,83,
+    116,114,101,97,109,45,108,105,107,101,32,111,98,106,101,99,
+    116,46,10,10,32,32,32,32,32,32,32,32,32,32,32,32,
+    82,101,97,100,101,114,44,32,87,114,105,116,101,114,32,109,
+    117,115,116,32,98,101,32,102,97,99,116,111,114,121,32,102,
+    117,110,99,116,105,111,110,115,32,111,114,32,99,108,97,115,
+    115,101,115,10,32,32,32,32,32,32,32,32,32,32,32,32,
+    112,114,111,118,105,100,105,110,103,32,116,104,101,32,83,116,
+    114,101,97,109,82,101,97,100,101,114,44,32,83,116,114,101,
+    97,109,87,114,105,116,101,114,32,105,110,116,101,114,102,97,
+    99,101,32,114,101,115,112,46,10,10,32,32,32,32,32,32,
+    32,32,32,32,32,32,69,114,114,111,114,32,104,97,110,100,
+    108,105,110,103,32,105,115,32,100,111,110,101,32,105,110,32,
+    116,104,101,32,115,97,109,101,32,119,97,121,32,97,115,32,
+    100,101,102,105,110,101,100,32,102,111,114,32,116,104,101,10,
+    32,32,32,32,32,32,32,32,32,32,32,32,83,116,114,101,
+    97,109,87,114,105,116,101,114,47,82,101,97,100,101,114,115,
+    46,10,10,32,32,32,32,32,32,32,32,78,41,4,114,94,
+    0,0,0,218,6,114,101,97,100,101,114,218,6,119,114,105,
+    116,101,114,114,69,0,0,0,41,5,114,53,0,0,0,114,
+    94,0,0,0,218,6,82,101,97,100,101,114,218,6,87,114,
+    105,116,101,114,114,69,0,0,0,114,54,0,0,0,114,54,
+    0,0,0,114,55,0,0,0,114,73,0,0,0,169,2,0,
+    0,115,8,0,0,0,0,13,6,1,12,1,12,1,122,27,
+    83,116,114,101,97,109,82,101,97,100,101,114,87,114,105,116,
+    101,114,46,95,95,105,110,105,116,95,95,114,123,0,0,0,
+    99,2,0,0,0,0,0,0,0,2,0,0,0,3,0,0,
+    0,67,0,0,0,115,12,0,0,0,124,0,106,0,160,1,
+    124,1,161,1,83,0,114,45,0,0,0,41,2,114,153,0,
+    0,0,114,128,0,0,0,169,2,114,53,0,0,0,114,132,
+    0,0,0,114,54,0,0,0,114,54,0,0,0,114,55,0,
+    0,0,114,128,0,0,0,187,2,0,0,115,2,0,0,0,
+    0,2,122,23,83,116,114,101,97,109,82,101,97,100,101,114,
+    87,114,105,116,101,114,46,114,101,97,100,78,99,2,0,0,
+    0,0,0,0,0,2,0,0,0,3,0,0,0,67,0,0,
+    0,115,12,0,0,0,124,0,106,0,160,1,124,1,161,1,
+    83,0,114,45,0,0,0,41,2,114,153,0,0,0,114,145,
+    0,0,0,114,157,0,0,0,114,54,0,0,0,114,54,0,
+    0,0,114,55,0,0,0,114,145,0,0,0,191,2,0,0,
+    115,2,0,0,0,0,2,122,27,83,116,114,101,97,109,82,
+    101,97,100,101,114,87,114,105,116,101,114,46,114,101,97,100,
+    108,105,110,101,99,2,0,0,0,0,0,0,0,2,0,0,
+    0,3,0,0,0,67,0,0,0,115,12,0,0,0,124,0,
+    106,0,160,1,124,1,161,1,83,0,114,45,0,0,0,41,
+    2,114,153,0,0,0,114,147,0,0,0,41,2,114,53,0,
+    0,0,114,146,0,0,0,114,54,0,0,0,114,54,0,0,
+    0,114,55,0,0,0,114,147,0,0,0,195,2,0,0,115,
+    2,0,0,0,0,2,122,28,83,116,114,101,97,109,82,101,
+    97,100,101,114,87,114,105,116,101,114,46,114,101,97,100,108,
+    105,110,101,115,99,1,0,0,0,0,0,0,0,1,0,0,
+    0,2,0,0,0,67,0,0,0,115,10,0,0,0,116,0,
+    124,0,106,1,131,1,83,0,169,1,114,148,0,0,0,41,
+    2,218,4,110,101,120,116,114,153,0,0,0,114,60,0,0,
+    0,114,54,0,0,0,114,54,0,0,0,114,55,0,0,0,
+    114,150,0,0,0,199,2,0,0,115,2,0,0,0,0,3,
+    122,27,83,116,114,101,97,109,82,101,97,100,101,114,87,114,
+    105,116,101,114,46,95,95,110,101,120,116,95,95,99,1,0,
+    0,0,0,0,0,0,1,0,0,0,1,0,0,0,67,0,
+    0,0,115,4,0,0,0,124,0,83,0,114,45,0,0,0,
+    114,54,0,0,0,114,60,0,0,0,114,54,0,0,0,114,
+    54,0,0,0,114,55,0,0,0,114,151,0,0,0,204,2,
+    0,0,115,2,0,0,0,0,1,122,27,83,116,114,101,97,
+    109,82,101,97,100,101,114,87,114,105,116,101,114,46,95,95,
+    105,116,101,114,95,95,99,2,0,0,0,0,0,0,0,2,
+    0,0,0,3,0,0,0,67,0,0,0,115,12,0,0,0,
+    124,0,106,0,160,1,124,1,161,1,83,0,114,45,0,0,
+    0,41,2,114,154,0,0,0,114,96,0,0,0,41,2,114,
+    53,0,0,0,114,85,0,0,0,114,54,0,0,0,114,54,
+    0,0,0,114,55,0,0,0,114,96,0,0,0,207,2,0,
+    0,115,2,0,0,0,0,2,122,24,83,116,114,101,97,109,
+    82,101,97,100,101,114,87,114,105,116,101,114,46,119,114,105,
+    116,101,99,2,0,0,0,0,0,0,0,2,0,0,0,3,
+    0,0,0,67,0,0,0,115,12,0,0,0,124,0,106,0,
+    160,1,124,1,161,1,83,0,114,45,0,0,0,41,2,114,
+    154,0,0,0,114,101,0,0,0,114,99,0,0,0,114,54,
+    0,0,0,114,54,0,0,0,114,55,0,0,0,114,101,0,
+    0,0,211,2,0,0,115,2,0,0,0,0,2,122,29,83,
+    116,114,101,97,109,82,101,97,100,101,114,87,114,105,116,101,
+    114,46,119,114,105,116,101,108,105,110,101,115,99,1,0,0,
+    0,0,0,0,0,1,0,0,0,2,0,0,0,67,0,0,
+    0,115,24,0,0,0,124,0,106,0,160,1,161,0,1,0,
+    124,0,106,2,160,1,161,0,1,0,100,0,83,0,114,45,
+    0,0,0,169,3,114,153,0,0,0,114,76,0,0,0,114,
+    154,0,0,0,114,60,0,0,0,114,54,0,0,0,114,54,
+    0,0,0,114,55,0,0,0,114,76,0,0,0,215,2,0,
+    0,115,4,0,0,0,0,2,10,1,122,24,83,116,114,101,
+    97,109,82,101,97,100,101,114,87,114,105,116,101,114,46,114,
+    101,115,101,116,114,0,0,0,0,99,3,0,0,0,0,0,
+    0,0,3,0,0,0,4,0,0,0,67,0,0,0,115,54,
+    0,0,0,124,0,106,0,160,1,124,1,124,2,161,2,1,
+    0,124,0,106,2,160,3,161,0,1,0,124,2,100,1,107,
+    2,114,50,124,1,100,1,107,2,114,50,124,0,106,4,160,
+    3,161,0,1,0,100,0,83,0,114,88,0,0,0,41,5,
+    114,94,0,0,0,114,103,0,0,0,114,153,0,0,0,114,
+    76,0,0,0,114,154,0,0,0,114,104,0,0,0,114,54,
+    0,0,0,114,54,0,0,0,114,55,0,0,0,114,103,0,
+    0,0,220,2,0,0,115,8,0,0,0,0,1,14,1,10,
+    1,16,1,122,23,83,116,114,101,97,109,82,101,97,100,101,
+    114,87,114,105,116,101,114,46,115,101,101,107,99,3,0,0,
+    0,0,0,0,0,3,0,0,0,3,0,0,0,67,0,0,
+    0,115,12,0,0,0,124,2,124,0,106,0,124,1,131,2,
+    83,0,114,106,0,0,0,114,107,0,0,0,114,108,0,0,
+    0,114,54,0,0,0,114,54,0,0,0,114,55,0,0,0,
+    114,110,0,0,0,226,2,0,0,115,2,0,0,0,0,5,
+    122,30,83,116,114,101,97,109,82,101,97,100,101,114,87,114,
+    105,116,101,114,46,95,95,103,101,116,97,116,116,114,95,95,
+    99,1,0,0,0,0,0,0,0,1,0,0,0,1,0,0,
+    0,67,0,0,0,115,4,0,0,0,124,0,83,0,114,45,
+    0,0,0,114,54,0,0,0,114,60,0,0,0,114,54,0,
+    0,0,114,54,0,0,0,114,55,0,0,0,114,111,0,0,
+    0,235,2,0,0,115,2,0,0,0,0,1,122,28,83,116,
+    114,101,97,109,82,101,97,100,101,114,87,114,105,116,101,114,
+    46,95,95,101,110,116,101,114,95,95,99,4,0,0,0,0,
+    0,0,0,4,0,0,0,2,0,0,0,67,0,0,0,115,
+    14,0,0,0,124,0,106,0,160,1,161,0,1,0,100,0,
+    83,0,114,45,0,0,0,114,112,0,0,0,114,114,0,0,
+    0,114,54,0,0,0,114,54,0,0,0,114,55,0,0,0,
+    114,117,0,0,0,238,2,0,0,115,2,0,0,0,0,1,
+    122,27,83,116,114,101,97,109,82,101,97,100,101,114,87,114,
+    105,116,101,114,46,95,95,101,120,105,116,95,95,41,19,114,
+    62,0,0,0,114,57,0,0,0,114,58,0,0,0,114,63,
+    0,0,0,218,8,101,110,99,111,100,105,110,103,114,73,0,
+    0,0,114,128,0,0,0,114,145,0,0,0,114,147,0,0,
+    0,114,150,0,0,0,114,151,0,0,0,114,96,0,0,0,
+    114,101,0,0,0,114,76,0,0,0,114,103,0,0,0,114,
+    109,0,0,0,114,110,0,0,0,114,111,0,0,0,114,117,
+    0,0,0,114,54,0,0,0,114,54,0,0,0,114,54,0,
+    0,0,114,55,0,0,0,114,25,0,0,0,156,2,0,0,
+    115,32,0,0,0,8,2,4,9,4,2,12,18,12,4,12,
+    4,12,4,8,5,8,3,8,4,8,4,8,5,12,7,2,
+    255,10,9,8,3,99,0,0,0,0,0,0,0,0,0,0,
+    0,0,3,0,0,0,64,0,0,0,115,140,0,0,0,101,
+    0,90,1,100,0,90,2,100,1,90,3,100,2,90,4,100,
+    2,90,5,100,3,102,1,100,4,100,5,132,1,90,6,100,
+    6,102,1,100,7,100,8,132,1,90,7,100,9,102,1,100,
+    10,100,11,132,1,90,8,100,9,102,1,100,12,100,13,132,
+    1,90,9,100,14,100,15,132,0,90,10,100,16,100,17,132,
+    0,90,11,100,18,100,19,132,0,90,12,100,20,100,21,132,
+    0,90,13,100,22,100,23,132,0,90,14,101,15,102,1,100,
+    24,100,25,132,1,90,16,100,26,100,27,132,0,90,17,100,
+    28,100,29,132,0,90,18,100,9,83,0,41,30,114,26,0,
+    0,0,97,66,2,0,0,32,83,116,114,101,97,109,82,101,
+    99,111,100,101,114,32,105,110,115,116,97,110,99,101,115,32,
+    116,114,97,110,115,108,97,116,101,32,100,97,116,97,32,102,
+    114,111,109,32,111,110,101,32,101,110,99,111,100,105,110,103,
+    32,116,111,32,97,110,111,116,104,101,114,46,10,10,32,32,
+    32,32,32,32,32,32,84,104,101,121,32,117,115,101,32,116,
+    104,101,32,99,111,109,112,108,101,116,101,32,115,101,116,32,
+    111,102,32,65,80,73,115,32,114,101,116,117,114,110,101,100,
+    32,98,121,32,116,104,101,10,32,32,32,32,32,32,32,32,
+    99,111,100,101,99,115,46,108,111,111,107,117,112,40,41,32,
+    102,117,110,99,116,105,111,110,32,116,111,32,105,109,112,108,
+    101,109,101,110,116,32,116,104,101,105,114,32,116,97,115,107,
+    46,10,10,32,32,32,32,32,32,32,32,68,97,116,97,32,
+    119,114,105,116,116,101,110,32,116,111,32,116,104,101,32,83,
+    116,114,101,97,109,82,101,99,111,100,101,114,32,105,115,32,
+    102,105,114,115,116,32,100,101,99,111,100,101,100,32,105,110,
+    116,111,32,97,110,10,32,32,32,32,32,32,32,32,105,110,
+    116,101,114,109,101,100,105,97,116,101,32,102,111,114,109,97,
+    116,32,40,100,101,112,101,110,100,105,110,103,32,111,110,32,
+    116,104,101,32,34,100,101,99,111,100,101,34,32,99,111,100,
+    101,99,41,32,97,110,100,32,116,104,101,110,10,32,32,32,
+    32,32,32,32,32,119,114,105,116,116,101,110,32,116,111,32,
+    116,104,101,32,117,110,100,101,114,108,121,105,110,103,32,115,
+    116,114,101,97,109,32,117,115,105,110,103,32,97,110,32,105,
+    110,115,116,97,110,99,101,32,111,102,32,116,104,101,32,112,
+    114,111,118,105,100,101,100,10,32,32,32,32,32,32,32,32,
+    87,114,105,116,101,114,32,99,108,97,115,115,46,10,10,32,
+    32,32,32,32,32,32,32,73,110,32,116,104,101,32,111,116,
+    104,101,114,32,100,105,114,101,99,116,105,111,110,44,32,100,
+    97,116,97,32,105,115,32,114,101,97,100,32,102,114,111,109,
+    32,116,104,101,32,117,110,100,101,114,108,121,105,110,103,32,
+    115,116,114,101,97,109,32,117,115,105,110,103,10,32,32,32,
+    32,32,32,32,32,97,32,82,101,97,100,101,114,32,105,110,
+    115,116,97,110,99,101,32,97,110,100,32,116,104,101,110,32,
+    101,110,99,111,100,101,100,32,97,110,100,32,114,101,116,117,
+    114,110,101,100,32,116,111,32,116,104,101,32,99,97,108,108,
+    101,114,46,10,10,32,32,32,32,114,152,0,0,0,114,64,
+    0,0,0,99,7,0,0,0,0,0,0,0,7,0,0,0,
+    3,0,0,0,67,0,0,0,115,52,0,0,0,124,1,124,
+    0,95,0,124,2,124,0,95,1,124,3,124,0,95,2,124,
+    4,124,1,124,6,131,2,124,0,95,3,124,5,124,1,124,
+    6,131,2,124,0,95,4,124,6,124,0,95,5,100,1,83,
+    0,41,2,97,233,2,0,0,32,67,114,101,97,116,101,115,
+    32,97,32,83,116,114,101,97,109,82,101,99,111,100,101,114,
+    32,105,110,115,116,97,110,99,101,32,119,104,105,99,104,32,
+    105,109,112,108,101,109,101,110,116,115,32,97,32,116,119,111,
+    45,119,97,121,10,32,32,32,32,32,32,32,32,32,32,32,
+    32,99,111,110,118,101,114,115,105,111,110,58,32,101,110,99,
+    111,100,101,32,97,110,100,32,100,101,99,111,100,101,32,119,
+    111,114,107,32,111,110,32,116,104,101,32,102,114,111,110,116,
+    101,110,100,32,40,116,104,101,10,32,32,32,32,32,32,32,
+    32,32,32,32,32,100,97,116,97,32,118,105,115,105,98,108,
+    101,32,116,111,32,46,114,101,97,100,40,41,32,97,110,100,
+    32,46,119,114,105,116,101,40,41,41,32,119,104,105,108,101,
+    32,82,101,97,100,101,114,32,97,110,100,32,87,114,105,116,
+    101,114,10,32,32,32,32,32,32,32,32,32,32,32,32,119,
+    111,114,107,32,111,110,32,116,104,101,32,98,97,99,107,101,
+    110,100,32,40,116,104,101,32,100,97,116,97,32,105,110,32,
+    115,116,114,101,97,109,41,46,10,10,32,32,32,32,32,32,
+    32,32,32,32,32,32,89,111,117,32,99,97,110,32,117,115,
+    101,32,116,104,101,115,101,32,111,98,106,101,99,116,115,32,
+    116,111,32,100,111,32,116,114,97,110,115,112,97,114,101,110,
+    116,10,32,32,32,32,32,32,32,32,32,32,32,32,116,114,
+    97,110,115,99,111,100,105,110,103,115,32,102,114,111,109,32,
+    101,46,103,46,32,108,97,116,105,110,45,49,32,116,111,32,
+    117,116,102,45,56,32,97,110,100,32,98,97,99,107,46,10,
+    10,32,32,32,32,32,32,32,32,32,32,32,32,115,116,114,
+    101,97,109,32,109,117,115,116,32,98,101,32,97,32,102,105,
+    108,101,45,108,105,107,101,32,111,98,106,101,99,116,46,10,
+    10,32,32,32,32,32,32,32,32,32,32,32,32,101,110,99,
+    111,100,101,32,97,110,100,32,100,101,99,111,100,101,32,109,
+    117,115,116,32,97,100,104,101,114,101,32,116,111,32,116,104,
+    101,32,67,111,100,101,99,32,105,110,116,101,114,102,97,99,
+    101,59,32,82,101,97,100,101,114,32,97,110,100,10,32,32,
+    32,32,32,32,32,32,32,32,32,32,87,114,105,116,101,114,
+    32,109,117,115,116,32,98,101,32,102,97,99,116,111,114,121,
+    32,102,117,110,99,116,105,111,110,115,32,111,114,32,99,108,
+    97,115,115,101,115,32,112,114,111,118,105,100,105,110,103,32,
+    116,104,101,10,32,32,32,32,32,32,32,32,32,32,32,32,
+    83,116,114,101,97,109,82,101,97,100,101,114,32,97,110,100,
+    32,83,116,114,101,97,109,87,114,105,116,101,114,32,105,110,
+    116,101,114,102,97,99,101,115,32,114,101,115,112,46,10,10,
+    32,32,32,32,32,32,32,32,32,32,32,32,69,114,114,111,
+    114,32,104,97,110,100,108,105,110,103,32,105,115,32,100,111,
+    110,101,32,105,110,32,116,104,101,32,115,97,109,101,32,119,
+    97,121,32,97,115,32,100,101,102,105,110,101,100,32,102,111,
+    114,32,116,104,101,10,32,32,32,32,32,32,32,32,32,32,
+    32,32,83,116,114,101,97,109,87,114,105,116,101,114,47,82,
+    101,97,100,101,114,115,46,10,10,32,32,32,32,32,32,32,
+    32,78,41,6,114,94,0,0,0,114,33,0,0,0,114,34,
+    0,0,0,114,153,0,0,0,114,154,0,0,0,114,69,0,
+    0,0,41,7,114,53,0,0,0,114,94,0,0,0,114,33,
+    0,0,0,114,34,0,0,0,114,155,0,0,0,114,156,0,
+    0,0,114,69,0,0,0,114,54,0,0,0,114,54,0,0,
+    0,114,55,0,0,0,114,73,0,0,0,7,3,0,0,115,
+    12,0,0,0,0,21,6,1,6,1,6,1,12,1,12,1,
+    122,22,83,116,114,101,97,109,82,101,99,111,100,101,114,46,
+    95,95,105,110,105,116,95,95,114,123,0,0,0,99,2,0,
+    0,0,0,0,0,0,4,0,0,0,4,0,0,0,67,0,
+    0,0,115,34,0,0,0,124,0,106,0,160,1,124,1,161,
+    1,125,2,124,0,160,2,124,2,124,0,106,3,161,2,92,
+    2,125,2,125,3,124,2,83,0,114,45,0,0,0,41,4,
+    114,153,0,0,0,114,128,0,0,0,114,33,0,0,0,114,
+    69,0,0,0,169,4,114,53,0,0,0,114,132,0,0,0,
+    114,85,0,0,0,218,12,98,121,116,101,115,101,110,99,111,
+    100,101,100,114,54,0,0,0,114,54,0,0,0,114,55,0,
+    0,0,114,128,0,0,0,35,3,0,0,115,6,0,0,0,
+    0,2,12,1,18,1,122,18,83,116,114,101,97,109,82,101,
+    99,111,100,101,114,46,114,101,97,100,78,99,2,0,0,0,
+    0,0,0,0,4,0,0,0,4,0,0,0,67,0,0,0,
+    115,54,0,0,0,124,1,100,0,107,8,114,20,124,0,106,
+    0,160,1,161,0,125,2,110,12,124,0,106,0,160,1,124,
+    1,161,1,125,2,124,0,160,2,124,2,124,0,106,3,161,
+    2,92,2,125,2,125,3,124,2,83,0,114,45,0,0,0,
+    41,4,114,153,0,0,0,114,145,0,0,0,114,33,0,0,
+    0,114,69,0,0,0,114,162,0,0,0,114,54,0,0,0,
+    114,54,0,0,0,114,55,0,0,0,114,145,0,0,0,41,
+    3,0,0,115,10,0,0,0,0,2,8,1,12,2,12,1,
+    18,1,122,22,83,116,114,101,97,109,82,101,99,111,100,101,
+    114,46,114,101,97,100,108,105,110,101,99,2,0,0,0,0,
+    0,0,0,4,0,0,0,4,0,0,0,67,0,0,0,115,
+    40,0,0,0,124,0,106,0,160,1,161,0,125,2,124,0,
+    160,2,124,2,124,0,106,3,161,2,92,2,125,2,125,3,
+    124,2,106,4,100,1,100,2,141,1,83,0,41,3,78,84,
+    114,124,0,0,0,41,5,114,153,0,0,0,114,128,0,0,
+    0,114,33,0,0,0,114,69,0,0,0,114,131,0,0,0,
+    41,4,114,53,0,0,0,114,146,0,0,0,114,85,0,0,
+    0,114,163,0,0,0,114,54,0,0,0,114,54,0,0,0,
+    114,55,0,0,0,114,147,0,0,0,50,3,0,0,115,6,
+    0,0,0,0,2,10,1,18,1,122,23,83,116,114,101,97,
+    109,82,101,99,111,100,101,114,46,114,101,97,100,108,105,110,
+    101,115,99,1,0,0,0,0,0,0,0,3,0,0,0,4,
+    0,0,0,67,0,0,0,115,32,0,0,0,116,0,124,0,
+    106,1,131,1,125,1,124,0,160,2,124,1,124,0,106,3,
+    161,2,92,2,125,1,125,2,124,1,83,0,114,158,0,0,
+    0,41,4,114,159,0,0,0,114,153,0,0,0,114,33,0,
+    0,0,114,69,0,0,0,41,3,114,53,0,0,0,114,85,
+    0,0,0,114,163,0,0,0,114,54,0,0,0,114,54,0,
+    0,0,114,55,0,0,0,114,150,0,0,0,56,3,0,0,
+    115,6,0,0,0,0,3,10,1,18,1,122,22,83,116,114,
+    101,97,109,82,101,99,111,100,101,114,46,95,95,110,101,120,
+    116,95,95,99,1,0,0,0,0,0,0,0,1,0,0,0,
+    1,0,0,0,67,0,0,0,115,4,0,0,0,124,0,83,
+    0,114,45,0,0,0,114,54,0,0,0,114,60,0,0,0,
+    114,54,0,0,0,114,54,0,0,0,114,55,0,0,0,114,
+    151,0,0,0,63,3,0,0,115,2,0,0,0,0,1,122,
+    22,83,116,114,101,97,109,82,101,99,111,100,101,114,46,95,
+    95,105,116,101,114,95,95,99,2,0,0,0,0,0,0,0,
+    3,0,0,0,4,0,0,0,67,0,0,0,115,30,0,0,
+    0,124,0,160,0,124,1,124,0,106,1,161,2,92,2,125,
+    1,125,2,124,0,106,2,160,3,124,1,161,1,83,0,114,
+    45,0,0,0,41,4,114,34,0,0,0,114,69,0,0,0,
+    114,154,0,0,0,114,96,0,0,0,41,3,114,53,0,0,
+    0,114,85,0,0,0,218,12,98,121,116,101,115,100,101,99,
+    111,100,101,100,114,54,0,0,0,114,54,0,0,0,114,55,
+    0,0,0,114,96,0,0,0,66,3,0,0,115,4,0,0,
+    0,0,2,18,1,122,19,83,116,114,101,97,109,82,101,99,
+    111,100,101,114,46,119,114,105,116,101,99,2,0,0,0,0,
+    0,0,0,4,0,0,0,4,0,0,0,67,0,0,0,115,
+    40,0,0,0,100,1,160,0,124,1,161,1,125,2,124,0,
+    160,1,124,2,124,0,106,2,161,2,92,2,125,2,125,3,
+    124,0,106,3,160,4,124,2,161,1,83,0,114,81,0,0,
+    0,41,5,114,98,0,0,0,114,34,0,0,0,114,69,0,
+    0,0,114,154,0,0,0,114,96,0,0,0,41,4,114,53,
+    0,0,0,114,100,0,0,0,114,85,0,0,0,114,164,0,
+    0,0,114,54,0,0,0,114,54,0,0,0,114,55,0,0,
+    0,114,101,0,0,0,71,3,0,0,115,6,0,0,0,0,
+    2,10,1,18,1,122,24,83,116,114,101,97,109,82,101,99,
+    111,100,101,114,46,119,114,105,116,101,108,105,110,101,115,99,
+    1,0,0,0,0,0,0,0,1,0,0,0,2,0,0,0,
+    67,0,0,0,115,24,0,0,0,124,0,106,0,160,1,161,
+    0,1,0,124,0,106,2,160,1,161,0,1,0,100,0,83,
+    0,114,45,0,0,0,114,160,0,0,0,114,60,0,0,0,
+    114,54,0,0,0,114,54,0,0,0,114,55,0,0,0,114,
+    76,0,0,0,77,3,0,0,115,4,0,0,0,0,2,10,
+    1,122,19,83,116,114,101,97,109,82,101,99,111,100,101,114,
+    46,114,101,115,101,116,99,3,0,0,0,0,0,0,0,3,
+    0,0,0,3,0,0,0,67,0,0,0,115,12,0,0,0,
+    124,2,124,0,106,0,124,1,131,2,83,0,114,106,0,0,
+    0,114,107,0,0,0,114,108,0,0,0,114,54,0,0,0,
+    114,54,0,0,0,114,55,0,0,0,114,110,0,0,0,82,
+    3,0,0,115,2,0,0,0,0,5,122,25,83,116,114,101,
+    97,109,82,101,99,111,100,101,114,46,95,95,103,101,116,97,
+    116,116,114,95,95,99,1,0,0,0,0,0,0,0,1,0,
+    0,0,1,0,0,0,67,0,0,0,115,4,0,0,0,124,
+    0,83,0,114,45,0,0,0,114,54,0,0,0,114,60,0,
+    0,0,114,54,0,0,0,114,54,0,0,0,114,55,0,0,
+    0,114,111,0,0,0,89,3,0,0,115,2,0,0,0,0,
+    1,122,23,83,116,114,101,97,109,82,101,99,111,100,101,114,
+    46,95,95,101,110,116,101,114,95,95,99,4,0,0,0,0,
+    0,0,0,4,0,0,0,2,0,0,0,67,0,0,0,115,
+    14,0,0,0,124,0,106,0,160,1,161,0,1,0,100,0,
+    83,0,114,45,0,0,0,114,112,0,0,0,114,114,0,0,
+    0,114,54,0,0,0,114,54,0,0,0,114,55,0,0,0,
+    114,117,0,0,0,92,3,0,0,115,2,0,0,0,0,1,
+    122,22,83,116,114,101,97,109,82,101,99,111,100,101,114,46,
+    95,95,101,120,105,116,95,95,41,19,114,62,0,0,0,114,
+    57,0,0,0,114,58,0,0,0,114,63,0,0,0,218,13,
+    100,97,116,97,95,101,110,99,111,100,105,110,103,218,13,102,
+    105,108,101,95,101,110,99,111,100,105,110,103,114,73,0,0,
+    0,114,128,0,0,0,114,145,0,0,0,114,147,0,0,0,
+    114,150,0,0,0,114,151,0,0,0,114,96,0,0,0,114,
+    101,0,0,0,114,76,0,0,0,114,109,0,0,0,114,110,
+    0,0,0,114,111,0,0,0,114,117,0,0,0,114,54,0,
+    0,0,114,54,0,0,0,114,54,0,0,0,114,55,0,0,
+    0,114,26,0,0,0,243,2,0,0,115,34,0,0,0,8,
+    2,4,15,4,1,4,3,2,255,10,28,12,6,12,9,12,
+    6,8,7,8,3,8,5,8,6,8,6,2,255,10,7,8,
+    3,218,1,114,114,64,0,0,0,114,123,0,0,0,99,5,
+    0,0,0,0,0,0,0,8,0,0,0,5,0,0,0,67,
+    0,0,0,115,86,0,0,0,124,2,100,1,107,9,114,24,
+    100,2,124,1,107,7,114,24,124,1,100,2,23,0,125,1,
+    116,0,160,1,124,0,124,1,124,4,161,3,125,5,124,2,
+    100,1,107,8,114,50,124,5,83,0,116,2,124,2,131,1,
+    125,6,116,3,124,5,124,6,106,4,124,6,106,5,124,3,
+    131,4,125,7,124,2,124,7,95,6,124,7,83,0,41,3,
+    97,113,4,0,0,32,79,112,101,110,32,97,110,32,101,110,
+    99,111,100,101,100,32,102,105,108,101,32,117,115,105,110,103,
+    32,116,104,101,32,103,105,118,101,110,32,109,111,100,101,32,
+    97,110,100,32,114,101,116,117,114,110,10,32,32,32,32,32,
+    32,32,32,97,32,119,114,97,112,112,101,100,32,118,101,114,
+    115,105,111,110,32,112,114,111,118,105,100,105,110,103,32,116,
+    114,97,110,115,112,97,114,101,110,116,32,101,110,99,111,100,
+    105,110,103,47,100,101,99,111,100,105,110,103,46,10,10,32,
+    32,32,32,32,32,32,32,78,111,116,101,58,32,84,104,101,
+    32,119,114,97,112,112,101,100,32,118,101,114,115,105,111,110,
+    32,119,105,108,108,32,111,110,108,121,32,97,99,99,101,112,
+    116,32,116,104,101,32,111,98,106,101,99,116,32,102,111,114,
+    109,97,116,10,32,32,32,32,32,32,32,32,100,101,102,105,
+    110,101,100,32,98,121,32,116,104,101,32,99,111,100,101,99,
+    115,44,32,105,46,101,46,32,85,110,105,99,111,100,101,32,
+    111,98,106,101,99,116,115,32,102,111,114,32,109,111,115,116,
+    32,98,117,105,108,116,105,110,10,32,32,32,32,32,32,32,
+    32,99,111,100,101,99,115,46,32,79,117,116,112,117,116,32,
+    105,115,32,97,108,115,111,32,99,111,100,101,99,32,100,101,
+    112,101,110,100,101,110,116,32,97,110,100,32,119,105,108,108,
+    32,117,115,117,97,108,108,121,32,98,101,10,32,32,32,32,
+    32,32,32,32,85,110,105,99,111,100,101,32,97,115,32,119,
+    101,108,108,46,10,10,32,32,32,32,32,32,32,32,85,110,
+    100,101,114,108,121,105,110,103,32,101,110,99,111,100,101,100,
+    32,102,105,108,101,115,32,97,114,101,32,97,108,119,97,121,
+    115,32,111,112,101,110,101,100,32,105,110,32,98,105,110,97,
+    114,121,32,109,111,100,101,46,10,32,32,32,32,32,32,32,
+    32,84,104,101,32,100,101,102,97,117,108,116,32,102,105,108,
+    101,32,109,111,100,101,32,105,115,32,39,114,39,44,32,109,
+    101,97,110,105,110,103,32,116,111,32,111,112,101,110,32,116,
+    104,101,32,102,105,108,101,32,105,110,32,114,101,97,100,32,
+    109,111,100,101,46,10,10,32,32,32,32,32,32,32,32,101,
+    110,99,111,100,105,110,103,32,115,112,101,99,105,102,105,101,
+    115,32,116,104,101,32,101,110,99,111,100,105,110,103,32,119,
+    104,105,99,104,32,105,115,32,116,111,32,98,101,32,117,115,
+    101,100,32,102,111,114,32,116,104,101,10,32,32,32,32,32,
+    32,32,32,102,105,108,101,46,10,10,32,32,32,32,32,32,
+    32,32,101,114,114,111,114,115,32,109,97,121,32,98,101,32,
+    103,105,118,101,110,32,116,111,32,100,101,102,105,110,101,32,
+    116,104,101,32,101,114,114,111,114,32,104,97,110,100,108,105,
+    110,103,46,32,73,116,32,100,101,102,97,117,108,116,115,10,
+    32,32,32,32,32,32,32,32,116,111,32,39,115,116,114,105,
+    99,116,39,32,119,104,105,99,104,32,99,97,117,115,101,115,
+    32,86,97,108,117,101,69,114,114,111,114,115,32,116,111,32,
+    98,101,32,114,97,105,115,101,100,32,105,110,32,99,97,115,
+    101,32,97,110,10,32,32,32,32,32,32,32,32,101,110,99,
+    111,100,105,110,103,32,101,114,114,111,114,32,111,99,99,117,
+    114,115,46,10,10,32,32,32,32,32,32,32,32,98,117,102,
+    102,101,114,105,110,103,32,104,97,115,32,116,104,101,32,115,
+    97,109,101,32,109,101,97,110,105,110,103,32,97,115,32,102,
+    111,114,32,116,104,101,32,98,117,105,108,116,105,110,32,111,
+    112,101,110,40,41,32,65,80,73,46,10,32,32,32,32,32,
+    32,32,32,73,116,32,100,101,102,97,117,108,116,115,32,116,
+    111,32,45,49,32,119,104,105,99,104,32,109,101,97,110,115,
+    32,116,104,97,116,32,116,104,101,32,100,101,102,97,117,108,
+    116,32,98,117,102,102,101,114,32,115,105,122,101,32,119,105,
+    108,108,10,32,32,32,32,32,32,32,32,98,101,32,117,115,
+    101,100,46,10,10,32,32,32,32,32,32,32,32,84,104,101,
+    32,114,101,116,117,114,110,101,100,32,119,114,97,112,112,101,
+    100,32,102,105,108,101,32,111,98,106,101,99,116,32,112,114,
+    111,118,105,100,101,115,32,97,110,32,101,120,116,114,97,32,
+    97,116,116,114,105,98,117,116,101,10,32,32,32,32,32,32,
+    32,32,46,101,110,99,111,100,105,110,103,32,119,104,105,99,
+    104,32,97,108,108,111,119,115,32,113,117,101,114,121,105,110,
+    103,32,116,104,101,32,117,115,101,100,32,101,110,99,111,100,
+    105,110,103,46,32,84,104,105,115,10,32,32,32,32,32,32,
+    32,32,97,116,116,114,105,98,117,116,101,32,105,115,32,111,
+    110,108,121,32,97,118,97,105,108,97,98,108,101,32,105,102,
+    32,97,110,32,101,110,99,111,100,105,110,103,32,119,97,115,
+    32,115,112,101,99,105,102,105,101,100,32,97,115,10,32,32,
+    32,32,32,32,32,32,112,97,114,97,109,101,116,101,114,46,
+    10,10,32,32,32,32,78,218,1,98,41,7,218,8,98,117,
+    105,108,116,105,110,115,114,3,0,0,0,114,2,0,0,0,
+    114,25,0,0,0,114,52,0,0,0,114,51,0,0,0,114,
+    161,0,0,0,41,8,218,8,102,105,108,101,110,97,109,101,
+    218,4,109,111,100,101,114,161,0,0,0,114,69,0,0,0,
+    90,9,98,117,102,102,101,114,105,110,103,218,4,102,105,108,
+    101,90,4,105,110,102,111,90,3,115,114,119,114,54,0,0,
+    0,114,54,0,0,0,114,55,0,0,0,114,3,0,0,0,
+    97,3,0,0,115,22,0,0,0,0,30,8,1,6,255,2,
+    3,8,1,14,1,8,1,4,1,8,1,18,2,6,1,99,
+    4,0,0,0,0,0,0,0,7,0,0,0,7,0,0,0,
+    67,0,0,0,115,70,0,0,0,124,2,100,1,107,8,114,
+    12,124,1,125,2,116,0,124,1,131,1,125,4,116,0,124,
+    2,131,1,125,5,116,1,124,0,124,4,106,2,124,4,106,
+    3,124,5,106,4,124,5,106,5,124,3,131,6,125,6,124,
+    1,124,6,95,6,124,2,124,6,95,7,124,6,83,0,41,
+    2,97,218,3,0,0,32,82,101,116,117,114,110,32,97,32,
+    119,114,97,112,112,101,100,32,118,101,114,115,105,111,110,32,
+    111,102,32,102,105,108,101,32,119,104,105,99,104,32,112,114,
+    111,118,105,100,101,115,32,116,114,97,110,115,112,97,114,101,
+    110,116,10,32,32,32,32,32,32,32,32,101,110,99,111,100,
+    105,110,103,32,116,114,97,110,115,108,97,116,105,111,110,46,
+    10,10,32,32,32,32,32,32,32,32,68,97,116,97,32,119,
+    114,105,116,116,101,110,32,116,111,32,116,104,101,32,119,114,
+    97,112,112,101,100,32,102,105,108,101,32,105,115,32,100,101,
+    99,111,100,101,100,32,97,99,99,111,114,100,105,110,103,10,
+    32,32,32,32,32,32,32,32,116,111,32,116,104,101,32,103,
+    105,118,101,110,32,100,97,116,97,95,101,110,99,111,100,105,
+    110,103,32,97,110,100,32,116,104,101,110,32,101,110,99,111,
+    100,101,100,32,116,111,32,116,104,101,32,117,110,100,101,114,
+    108,121,105,110,103,10,32,32,32,32,32,32,32,32,102,105,
+    108,101,32,117,115,105,110,103,32,102,105,108,101,95,101,110,
+    99,111,100,105,110,103,46,32,84,104,101,32,105,110,116,101,
+    114,109,101,100,105,97,116,101,32,100,97,116,97,32,116,121,
+    112,101,10,32,32,32,32,32,32,32,32,119,105,108,108,32,
+    117,115,117,97,108,108,121,32,98,101,32,85,110,105,99,111,
+    100,101,32,98,117,116,32,100,101,112,101,110,100,115,32,111,
+    110,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,
+    99,111,100,101,99,115,46,10,10,32,32,32,32,32,32,32,
+    32,66,121,116,101,115,32,114,101,97,100,32,102,114,111,109,
+    32,116,104,101,32,102,105,108,101,32,97,114,101,32,100,101,
+    99,111,100,101,100,32,117,115,105,110,103,32,102,105,108,101,
+    95,101,110,99,111,100,105,110,103,32,97,110,100,32,116,104,
+    101,110,10,32,32,32,32,32,32,32,32,112,97,115,115,101,
+    100,32,98,97,99,107,32,116,111,32,116,104,101,32,99,97,
+    108,108,101,114,32,101,110,99,111,100,101,100,32,117,115,105,
+    110,103,32,100,97,116,97,95,101,110,99,111,100,105,110,103,
+    46,10,10,32,32,32,32,32,32,32,32,73,102,32,102,105,
+    108,101,95,101,110,99,111,100,105,110,103,32,105,115,32,110,
+    111,116,32,103,105,118,101,110,44,32,105,116,32,100,101,102,
+    97,117,108,116,115,32,116,111,32,100,97,116,97,95,101,110,
+    99,111,100,105,110,103,46,10,10,32,32,32,32,32,32,32,
+    32,101,114,114,111,114,115,32,109,97,121,32,98,101,32,103,
+    105,118,101,110,32,116,111,32,100,101,102,105,110,101,32,116,
+    104,101,32,101,114,114,111,114,32,104,97,110,100,108,105,110,
+    103,46,32,73,116,32,100,101,102,97,117,108,116,115,10,32,
+    32,32,32,32,32,32,32,116,111,32,39,115,116,114,105,99,
+    116,39,32,119,104,105,99,104,32,99,97,117,115,101,115,32,
+    86,97,108,117,101,69,114,114,111,114,115,32,116,111,32,98,
+    101,32,114,97,105,115,101,100,32,105,110,32,99,97,115,101,
+    32,97,110,10,32,32,32,32,32,32,32,32,101,110,99,111,
+    100,105,110,103,32,101,114,114,111,114,32,111,99,99,117,114,
+    115,46,10,10,32,32,32,32,32,32,32,32,84,104,101,32,
+    114,101,116,117,114,110,101,100,32,119,114,97,112,112,101,100,
+    32,102,105,108,101,32,111,98,106,101,99,116,32,112,114,111,
+    118,105,100,101,115,32,116,119,111,32,101,120,116,114,97,32,
+    97,116,116,114,105,98,117,116,101,115,10,32,32,32,32,32,
+    32,32,32,46,100,97,116,97,95,101,110,99,111,100,105,110,
+    103,32,97,110,100,32,46,102,105,108,101,95,101,110,99,111,
+    100,105,110,103,32,119,104,105,99,104,32,114,101,102,108,101,
+    99,116,32,116,104,101,32,103,105,118,101,110,10,32,32,32,
+    32,32,32,32,32,112,97,114,97,109,101,116,101,114,115,32,
+    111,102,32,116,104,101,32,115,97,109,101,32,110,97,109,101,
+    46,32,84,104,101,32,97,116,116,114,105,98,117,116,101,115,
+    32,99,97,110,32,98,101,32,117,115,101,100,32,102,111,114,
+    10,32,32,32,32,32,32,32,32,105,110,116,114,111,115,112,
+    101,99,116,105,111,110,32,98,121,32,80,121,116,104,111,110,
+    32,112,114,111,103,114,97,109,115,46,10,10,32,32,32,32,
+    78,41,8,114,2,0,0,0,114,26,0,0,0,114,33,0,
+    0,0,114,34,0,0,0,114,52,0,0,0,114,51,0,0,
+    0,114,165,0,0,0,114,166,0,0,0,41,7,114,172,0,
+    0,0,114,165,0,0,0,114,166,0,0,0,114,69,0,0,
+    0,90,9,100,97,116,97,95,105,110,102,111,90,9,102,105,
+    108,101,95,105,110,102,111,90,2,115,114,114,54,0,0,0,
+    114,54,0,0,0,114,55,0,0,0,114,4,0,0,0,140,
+    3,0,0,115,24,0,0,0,0,25,8,1,4,1,8,1,
+    8,1,12,1,4,0,4,0,2,255,4,3,6,1,6,1,
+    99,1,0,0,0,0,0,0,0,1,0,0,0,2,0,0,
+    0,67,0,0,0,115,10,0,0,0,116,0,124,0,131,1,
+    106,1,83,0,41,1,122,158,32,76,111,111,107,117,112,32,
+    117,112,32,116,104,101,32,99,111,100,101,99,32,102,111,114,
+    32,116,104,101,32,103,105,118,101,110,32,101,110,99,111,100,
+    105,110,103,32,97,110,100,32,114,101,116,117,114,110,10,32,
+    32,32,32,32,32,32,32,105,116,115,32,101,110,99,111,100,
+    101,114,32,102,117,110,99,116,105,111,110,46,10,10,32,32,
+    32,32,32,32,32,32,82,97,105,115,101,115,32,97,32,76,
+    111,111,107,117,112,69,114,114,111,114,32,105,110,32,99,97,
+    115,101,32,116,104,101,32,101,110,99,111,100,105,110,103,32,
+    99,97,110,110,111,116,32,98,101,32,102,111,117,110,100,46,
+    10,10,32,32,32,32,41,2,114,2,0,0,0,114,33,0,
+    0,0,169,1,114,161,0,0,0,114,54,0,0,0,114,54,
+    0,0,0,114,55,0,0,0,114,27,0,0,0,178,3,0,
+    0,115,2,0,0,0,0,8,99,1,0,0,0,0,0,0,
+    0,1,0,0,0,2,0,0,0,67,0,0,0,115,10,0,
+    0,0,116,0,124,0,131,1,106,1,83,0,41,1,122,158,
+    32,76,111,111,107,117,112,32,117,112,32,116,104,101,32,99,
+    111,100,101,99,32,102,111,114,32,116,104,101,32,103,105,118,
+    101,110,32,101,110,99,111,100,105,110,103,32,97,110,100,32,
+    114,101,116,117,114,110,10,32,32,32,32,32,32,32,32,105,
+    116,115,32,100,101,99,111,100,101,114,32,102,117,110,99,116,
+    105,111,110,46,10,10,32,32,32,32,32,32,32,32,82,97,
+    105,115,101,115,32,97,32,76,111,111,107,117,112,69,114,114,
+    111,114,32,105,110,32,99,97,115,101,32,116,104,101,32,101,
+    110,99,111,100,105,110,103,32,99,97,110,110,111,116,32,98,
+    101,32,102,111,117,110,100,46,10,10,32,32,32,32,41,2,
+    114,2,0,0,0,114,34,0,0,0,114,173,0,0,0,114,
+    54,0,0,0,114,54,0,0,0,114,55,0,0,0,114,28,
+    0,0,0,188,3,0,0,115,2,0,0,0,0,8,99,1,
+    0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,67,
+    0,0,0,115,30,0,0,0,116,0,124,0,131,1,106,1,
+    125,1,124,1,100,1,107,8,114,26,116,2,124,0,131,1,
+    130,1,124,1,83,0,41,2,122,247,32,76,111,111,107,117,
+    112,32,117,112,32,116,104,101,32,99,111,100,101,99,32,102,
+    111,114,32,116,104,101,32,103,105,118,101,110,32,101,110,99,
+    111,100,105,110,103,32,97,110,100,32,114,101,116,117,114,110,
+    10,32,32,32,32,32,32,32,32,105,116,115,32,73,110,99,
+    114,101,109,101,110,116,97,108,69,110,99,111,100,101,114,32,
+    99,108,97,115,115,32,111,114,32,102,97,99,116,111,114,121,
+    32,102,117,110,99,116,105,111,110,46,10,10,32,32,32,32,
+    32,32,32,32,82,97,105,115,101,115,32,97,32,76,111,111,
+    107,117,112,69,114,114,111,114,32,105,110,32,99,97,115,101,
+    32,116,104,101,32,101,110,99,111,100,105,110,103,32,99,97,
+    110,110,111,116,32,98,101,32,102,111,117,110,100,10,32,32,
+    32,32,32,32,32,32,111,114,32,116,104,101,32,99,111,100,
+    101,99,115,32,100,111,101,115,110,39,116,32,112,114,111,118,
+    105,100,101,32,97,110,32,105,110,99,114,101,109,101,110,116,
+    97,108,32,101,110,99,111,100,101,114,46,10,10,32,32,32,
+    32,78,41,3,114,2,0,0,0,114,49,0,0,0,218,11,
+    76,111,111,107,117,112,69,114,114,111,114,41,2,114,161,0,
+    0,0,218,7,101,110,99,111,100,101,114,114,54,0,0,0,
+    114,54,0,0,0,114,55,0,0,0,114,29,0,0,0,198,
+    3,0,0,115,8,0,0,0,0,9,10,1,8,1,8,1,
+    99,1,0,0,0,0,0,0,0,2,0,0,0,2,0,0,
+    0,67,0,0,0,115,30,0,0,0,116,0,124,0,131,1,
+    106,1,125,1,124,1,100,1,107,8,114,26,116,2,124,0,
+    131,1,130,1,124,1,83,0,41,2,122,247,32,76,111,111,
+    107,117,112,32,117,112,32,116,104,101,32,99,111,100,101,99,
+    32,102,111,114,32,116,104,101,32,103,105,118,101,110,32,101,
+    110,99,111,100,105,110,103,32,97,110,100,32,114,101,116,117,
+    114,110,10,32,32,32,32,32,32,32,32,105,116,115,32,73,
+    110,99,114,101,109,101,110,116,97,108,68,101,99,111,100,101,
+    114,32,99,108,97,115,115,32,111,114,32,102,97,99,116,111,
+    114,121,32,102,117,110,99,116,105,111,110,46,10,10,32,32,
+    32,32,32,32,32,32,82,97,105,115,101,115,32,97,32,76,
+    111,111,107,117,112,69,114,114,111,114,32,105,110,32,99,97,
+    115,101,32,116,104,101,32,101,110,99,111,100,105,110,103,32,
+    99,97,110,110,111,116,32,98,101,32,102,111,117,110,100,10,
+    32,32,32,32,32,32,32,32,111,114,32,116,104,101,32,99,
+    111,100,101,99,115,32,100,111,101,115,110,39,116,32,112,114,
+    111,118,105,100,101,32,97,110,32,105,110,99,114,101,109,101,
+    110,116,97,108,32,100,101,99,111,100,101,114,46,10,10,32,
+    32,32,32,78,41,3,114,2,0,0,0,114,50,0,0,0,
+    114,174,0,0,0,41,2,114,161,0,0,0,218,7,100,101,
+    99,111,100,101,114,114,54,0,0,0,114,54,0,0,0,114,
+    55,0,0,0,114,30,0,0,0,212,3,0,0,115,8,0,
+    0,0,0,9,10,1,8,1,8,1,99,1,0,0,0,0,
+    0,0,0,1,0,0,0,2,0,0,0,67,0,0,0,115,
+    10,0,0,0,116,0,124,0,131,1,106,1,83,0,41,1,
+    122,180,32,76,111,111,107,117,112,32,117,112,32,116,104,101,
+    32,99,111,100,101,99,32,102,111,114,32,116,104,101,32,103,
+    105,118,101,110,32,101,110,99,111,100,105,110,103,32,97,110,
+    100,32,114,101,116,117,114,110,10,32,32,32,32,32,32,32,
+    32,105,116,115,32,83,116,114,101,97,109,82,101,97,100,101,
+    114,32,99,108,97,115,115,32,111,114,32,102,97,99,116,111,
+    114,121,32,102,117,110,99,116,105,111,110,46,10,10,32,32,
+    32,32,32,32,32,32,82,97,105,115,101,115,32,97,32,76,
+    111,111,107,117,112,69,114,114,111,114,32,105,110,32,99,97,
+    115,101,32,116,104,101,32,101,110,99,111,100,105,110,103,32,
+    99,97,110,110,111,116,32,98,101,32,102,111,117,110,100,46,
+    10,10,32,32,32,32,41,2,114,2,0,0,0,114,52,0,
+    0,0,114,173,0,0,0,114,54,0,0,0,114,54,0,0,
+    0,114,55,0,0,0,114,31,0,0,0,226,3,0,0,115,
+    2,0,0,0,0,8,99,1,0,0,0,0,0,0,0,1,
+    0,0,0,2,0,0,0,67,0,0,0,115,10,0,0,0,
+    116,0,124,0,131,1,106,1,83,0,41,1,122,180,32,76,
+    111,111,107,117,112,32,117,112,32,116,104,101,32,99,111,100,
+    101,99,32,102,111,114,32,116,104,101,32,103,105,118,101,110,
+    32,101,110,99,111,100,105,110,103,32,97,110,100,32,114,101,
+    116,117,114,110,10,32,32,32,32,32,32,32,32,105,116,115,
+    32,83,116,114,101,97,109,87,114,105,116,101,114,32,99,108,
+    97,115,115,32,111,114,32,102,97,99,116,111,114,121,32,102,
+    117,110,99,116,105,111,110,46,10,10,32,32,32,32,32,32,
+    32,32,82,97,105,115,101,115,32,97,32,76,111,111,107,117,
+    112,69,114,114,111,114,32,105,110,32,99,97,115,101,32,116,
+    104,101,32,101,110,99,111,100,105,110,103,32,99,97,110,110,
+    111,116,32,98,101,32,102,111,117,110,100,46,10,10,32,32,
+    32,32,41,2,114,2,0,0,0,114,51,0,0,0,114,173,
+    0,0,0,114,54,0,0,0,114,54,0,0,0,114,55,0,
+    0,0,114,32,0,0,0,236,3,0,0,115,2,0,0,0,
+    0,8,99,3,0,0,0,0,0,0,0,7,0,0,0,4,
+    0,0,0,107,0,0,0,115,72,0,0,0,116,0,124,1,
+    131,1,124,2,102,1,124,3,142,1,125,4,124,0,68,0,
+    93,24,125,5,124,4,160,1,124,5,161,1,125,6,124,6,
+    114,20,124,6,86,0,1,0,113,20,124,4,160,1,100,1,
+    100,2,161,2,125,6,124,6,114,68,124,6,86,0,1,0,
+    100,3,83,0,41,4,122,191,10,32,32,32,32,69,110,99,
+    111,100,105,110,103,32,105,116,101,114,97,116,111,114,46,10,
+    10,32,32,32,32,69,110,99,111,100,101,115,32,116,104,101,
+    32,105,110,112,117,116,32,115,116,114,105,110,103,115,32,102,
+    114,111,109,32,116,104,101,32,105,116,101,114,97,116,111,114,
+    32,117,115,105,110,103,32,97,110,32,73,110,99,114,101,109,
+    101,110,116,97,108,69,110,99,111,100,101,114,46,10,10,32,
+    32,32,32,101,114,114,111,114,115,32,97,110,100,32,107,119,
+    97,114,103,115,32,97,114,101,32,112,97,115,115,101,100,32,
+    116,104,114,111,117,103,104,32,116,111,32,116,104,101,32,73,
+    110,99,114,101,109,101,110,116,97,108,69,110,99,111,100,101,
+    114,10,32,32,32,32,99,111,110,115,116,114,117,99,116,111,
+    114,46,10,32,32,32,32,114,70,0,0,0,84,78,41,2,
+    114,29,0,0,0,114,33,0,0,0,41,7,218,8,105,116,
+    101,114,97,116,111,114,114,161,0,0,0,114,69,0,0,0,
+    218,6,107,119,97,114,103,115,114,175,0,0,0,114,68,0,
+    0,0,218,6,111,117,116,112,117,116,114,54,0,0,0,114,
+    54,0,0,0,114,55,0,0,0,114,35,0,0,0,246,3,
+    0,0,115,16,0,0,0,0,9,16,1,8,1,10,1,4,
+    1,8,1,12,1,4,1,99,3,0,0,0,0,0,0,0,
+    7,0,0,0,4,0,0,0,107,0,0,0,115,72,0,0,
+    0,116,0,124,1,131,1,124,2,102,1,124,3,142,1,125,
+    4,124,0,68,0,93,24,125,5,124,4,160,1,124,5,161,
+    1,125,6,124,6,114,20,124,6,86,0,1,0,113,20,124,
+    4,160,1,100,1,100,2,161,2,125,6,124,6,114,68,124,
+    6,86,0,1,0,100,3,83,0,41,4,122,191,10,32,32,
+    32,32,68,101,99,111,100,105,110,103,32,105,116,101,114,97,
+    116,111,114,46,10,10,32,32,32,32,68,101,99,111,100,101,
+    115,32,116,104,101,32,105,110,112,117,116,32,115,116,114,105,
+    110,103,115,32,102,114,111,109,32,116,104,101,32,105,116,101,
+    114,97,116,111,114,32,117,115,105,110,103,32,97,110,32,73,
+    110,99,114,101,109,101,110,116,97,108,68,101,99,111,100,101,
+    114,46,10,10,32,32,32,32,101,114,114,111,114,115,32,97,
+    110,100,32,107,119,97,114,103,115,32,97,114,101,32,112,97,
+    115,115,101,100,32,116,104,114,111,117,103,104,32,116,111,32,
+    116,104,101,32,73,110,99,114,101,109,101,110,116,97,108,68,
+    101,99,111,100,101,114,10,32,32,32,32,99,111,110,115,116,
+    114,117,99,116,111,114,46,10,32,32,32,32,114,90,0,0,
+    0,84,78,41,2,114,30,0,0,0,114,34,0,0,0,41,
+    7,114,177,0,0,0,114,161,0,0,0,114,69,0,0,0,
+    114,178,0,0,0,114,176,0,0,0,114,68,0,0,0,114,
+    179,0,0,0,114,54,0,0,0,114,54,0,0,0,114,55,
+    0,0,0,114,36,0,0,0,8,4,0,0,115,16,0,0,
+    0,0,9,16,1,8,1,10,1,4,1,8,1,12,1,4,
+    1,99,1,0,0,0,0,0,0,0,1,0,0,0,2,0,
+    0,0,67,0,0,0,115,14,0,0,0,100,1,100,2,132,
+    0,124,0,68,0,131,1,83,0,41,3,122,136,32,109,97,
+    107,101,95,105,100,101,110,116,105,116,121,95,100,105,99,116,
+    40,114,110,103,41,32,45,62,32,100,105,99,116,10,10,32,
+    32,32,32,32,32,32,32,82,101,116,117,114,110,32,97,32,
+    100,105,99,116,105,111,110,97,114,121,32,119,104,101,114,101,
+    32,101,108,101,109,101,110,116,115,32,111,102,32,116,104,101,
+    32,114,110,103,32,115,101,113,117,101,110,99,101,32,97,114,
+    101,10,32,32,32,32,32,32,32,32,109,97,112,112,101,100,
+    32,116,111,32,116,104,101,109,115,101,108,118,101,115,46,10,
+    10,32,32,32,32,99,1,0,0,0,0,0,0,0,2,0,
+    0,0,4,0,0,0,83,0,0,0,115,18,0,0,0,105,
+    0,124,0,93,10,125,1,124,1,124,1,147,2,113,4,83,
+    0,114,54,0,0,0,114,54,0,0,0,41,2,90,2,46,
+    48,218,1,105,114,54,0,0,0,114,54,0,0,0,114,55,
+    0,0,0,218,10,60,100,105,99,116,99,111,109,112,62,36,
+    4,0,0,115,6,0,0,0,6,0,2,0,2,0,122,38,
+    109,97,107,101,95,105,100,101,110,116,105,116,121,95,100,105,
+    99,116,46,60,108,111,99,97,108,115,62,46,60,100,105,99,
+    116,99,111,109,112,62,114,54,0,0,0,41,1,90,3,114,
+    110,103,114,54,0,0,0,114,54,0,0,0,114,55,0,0,
+    0,218,18,109,97,107,101,95,105,100,101,110,116,105,116,121,
+    95,100,105,99,116,28,4,0,0,115,2,0,0,0,0,8,
+    114,182,0,0,0,99,1,0,0,0,0,0,0,0,4,0,
+    0,0,4,0,0,0,67,0,0,0,115,52,0,0,0,105,
+    0,125,1,124,0,160,0,161,0,68,0,93,34,92,2,125,
+    2,125,3,124,3,124,1,107,7,114,38,124,2,124,1,124,
+    3,60,0,113,12,100,1,124,1,124,3,60,0,113,12,124,
+    1,83,0,41,2,97,130,1,0,0,32,67,114,101,97,116,
+    101,115,32,97,110,32,101,110,99,111,100,105,110,103,32,109,
+    97,112,32,102,114,111,109,32,97,32,100,101,99,111,100,105,
+    110,103,32,109,97,112,46,10,10,32,32,32,32,32,32,32,
+    32,73,102,32,97,32,116,97,114,103,101,116,32,109,97,112,
+    112,105,110,103,32,105,110,32,116,104,101,32,100,101,99,111,
+    100,105,110,103,32,109,97,112,32,111,99,99,117,114,115,32,
+    109,117,108,116,105,112,108,101,10,32,32,32,32,32,32,32,
+    32,116,105,109,101,115,44,32,116,104,101,110,32,116,104,97,
+    116,32,116,97,114,103,101,116,32,105,115,32,109,97,112,112,
+    101,100,32,116,111,32,78,111,110,101,32,40,117,110,100,101,
+    102,105,110,101,100,32,109,97,112,112,105,110,103,41,44,10,
+    32,32,32,32,32,32,32,32,99,97,117,115,105,110,103,32,
+    97,110,32,101,120,99,101,112,116,105,111,110,32,119,104,101,
+    110,32,101,110,99,111,117,110,116,101,114,101,100,32,98,121,
+    32,116,104,101,32,99,104,97,114,109,97,112,32,99,111,100,
+    101,99,10,32,32,32,32,32,32,32,32,100,117,114,105,110,
+    103,32,116,114,97,110,115,108,97,116,105,111,110,46,10,10,
+    32,32,32,32,32,32,32,32,79,110,101,32,101,120,97,109,
+    112,108,101,32,119,104,101,114,101,32,116,104,105,115,32,104,
+    97,112,112,101,110,115,32,105,115,32,99,112,56,55,53,46,
+    112,121,32,119,104,105,99,104,32,100,101,99,111,100,101,115,
+    10,32,32,32,32,32,32,32,32,109,117,108,116,105,112,108,
+    101,32,99,104,97,114,97,99,116,101,114,32,116,111,32,92,
+    117,48,48,49,97,46,10,10,32,32,32,32,78,41,1,218,
+    5,105,116,101,109,115,41,4,90,12,100,101,99,111,100,105,
+    110,103,95,109,97,112,218,1,109,218,1,107,218,1,118,114,
+    54,0,0,0,114,54,0,0,0,114,55,0,0,0,218,17,
+    109,97,107,101,95,101,110,99,111,100,105,110,103,95,109,97,
+    112,38,4,0,0,115,12,0,0,0,0,13,4,1,16,1,
+    8,1,10,2,10,1,114,187,0,0,0,90,6,105,103,110,
+    111,114,101,218,7,114,101,112,108,97,99,101,90,17,120,109,
+    108,99,104,97,114,114,101,102,114,101,112,108,97,99,101,90,
+    16,98,97,99,107,115,108,97,115,104,114,101,112,108,97,99,
+    101,90,11,110,97,109,101,114,101,112,108,97,99,101,90,8,
+    95,95,109,97,105,110,95,95,122,7,108,97,116,105,110,45,
+    49,122,5,117,116,102,45,56,41,4,114,167,0,0,0,78,
+    114,64,0,0,0,114,123,0,0,0,41,2,78,114,64,0,
+    0,0,41,1,114,64,0,0,0,41,1,114,64,0,0,0,
+    41,60,114,63,0,0,0,114,169,0,0,0,218,3,115,121,
+    115,90,7,95,99,111,100,101,99,115,218,11,73,109,112,111,
+    114,116,69,114,114,111,114,90,3,119,104,121,218,11,83,121,
+    115,116,101,109,69,114,114,111,114,90,7,95,95,97,108,108,
+    95,95,114,12,0,0,0,114,7,0,0,0,114,14,0,0,
+    0,114,6,0,0,0,114,15,0,0,0,114,17,0,0,0,
+    114,18,0,0,0,218,9,98,121,116,101,111,114,100,101,114,
+    114,5,0,0,0,114,13,0,0,0,114,16,0,0,0,114,
+    9,0,0,0,114,8,0,0,0,114,11,0,0,0,114,10,
+    0,0,0,114,46,0,0,0,114,19,0,0,0,114,20,0,
+    0,0,114,97,0,0,0,114,21,0,0,0,114,80,0,0,
+    0,114,22,0,0,0,114,91,0,0,0,114,24,0,0,0,
+    114,23,0,0,0,114,25,0,0,0,114,26,0,0,0,114,
+    3,0,0,0,114,4,0,0,0,114,27,0,0,0,114,28,
+    0,0,0,114,29,0,0,0,114,30,0,0,0,114,31,0,
+    0,0,114,32,0,0,0,114,35,0,0,0,114,36,0,0,
+    0,114,182,0,0,0,114,187,0,0,0,114,43,0,0,0,
+    114,37,0,0,0,114,38,0,0,0,114,39,0,0,0,114,
+    40,0,0,0,114,41,0,0,0,114,42,0,0,0,114,174,
+    0,0,0,90,6,95,102,97,108,115,101,90,9,101,110,99,
+    111,100,105,110,103,115,114,62,0,0,0,90,6,115,116,100,
+    111,117,116,90,5,115,116,100,105,110,114,54,0,0,0,114,
+    54,0,0,0,114,54,0,0,0,114,55,0,0,0,218,8,
+    60,109,111,100,117,108,101,62,1,0,0,0,115,206,0,0,
+    0,4,9,8,1,8,4,2,1,12,1,16,1,30,2,12,
+    1,2,0,2,0,2,0,2,0,2,1,2,0,2,0,2,
+    0,2,1,2,0,2,0,2,1,2,0,2,0,2,0,2,
+    1,2,0,2,1,2,0,2,1,2,0,2,0,2,1,2,
+    0,2,0,2,1,2,0,2,0,2,0,2,1,2,0,2,
+    0,2,1,2,1,2,0,2,1,2,0,2,243,4,24,4,
+    3,8,3,8,3,4,3,4,2,10,3,8,3,6,5,8,
+    3,4,3,4,1,4,1,4,1,4,5,16,31,14,66,16,
+    40,16,34,16,49,16,43,16,73,16,127,0,122,14,87,14,
+    110,10,43,10,38,8,10,8,10,8,14,8,14,8,10,8,
+    10,10,18,10,20,8,10,8,23,2,1,8,1,8,1,8,
+    1,8,1,8,1,12,1,16,2,4,1,4,1,4,1,4,
+    1,4,1,10,4,4,1,6,1,8,4,10,3,16,3,
+};
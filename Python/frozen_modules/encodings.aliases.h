@@ -0,0 +1,395 @@
+/* Auto-generated by Programs/_freeze_importlib.c */
+const unsigned char _Py_M__encodingsaliases[] = {
+    99,0,0,0,0,0,0,0,0,0,0,0,0,68,1,0,
+    0,64,0,0,0,115,150,2,0,0,100,0,90,0,100,1,
+    100,1,100,1,100,1,100,1,100,1,100,1,100,1,100,1,
+    100,1,100,1,100,1,100,2,100,2,100,3,100,3,100,4,
+    100,4,100,5,100,6,100,6,100,6,100,6,100,6,100,6,
+    100,6,100,6,100,7,100,7,100,7,100,8,100,8,100,8,
+    100,8,100,9,100,9,100,10,100,10,100,11,100,11,100,12,
+    100,12,100,13,100,13,100,14,100,14,100,15,100,15,100,16,
+    100,16,100,17,100,17,100,18,100,18,100,19,100,19,100,19,
+    100,20,100,20,100,20,100,20,100,21,100,21,100,21,100,22,
+    100,22,100,22,100,22,100,22,100,23,100,23,100,23,100,24,
+    100,24,100,24,100,25,100,25,100,25,100,26,100,26,100,26,
+    100,27,100,27,100,27,100,28,100,28,100,28,100,29,100,29,
+    100,29,100,30,100,30,100,30,100,30,100,31,100,31,100,31,
+    100,32,100,32,100,32,100,33,100,33,100,33,100,34,100,34,
+    100,34,100,35,100,35,100,35,100,36,100,36,100,36,100,36,
+    100,37,100,37,100,37,100,37,100,38,100,38,100,38,100,39,
+    100,39,100,40,100,40,100,40,100,41,100,42,100,42,100,42,
+    100,43,100,43,100,43,100,43,100,43,100,43,100,43,100,44,
+    100,45,100,45,100,45,100,45,100,45,100,45,100,45,100,45,
+    100,46,100,46,100,46,100,47,100,48,100,48,100,48,100,49,
+    100,49,100,49,100,50,100,50,100,50,100,51,100,51,100,52,
+    100,52,100,53,100,53,100,54,100,54,100,55,100,55,100,56,
+    100,56,100,56,100,57,100,57,100,57,100,57,100,57,100,57,
+    100,58,100,58,100,58,100,59,100,59,100,59,100,60,100,60,
+    100,60,100,60,100,60,100,60,100,61,100,61,100,61,100,62,
+    100,62,100,62,100,62,100,62,100,63,100,63,100,63,100,63,
+    100,63,100,63,100,64,100,64,100,64,100,64,100,64,100,64,
+    100,65,100,65,100,65,100,65,100,65,100,65,100,66,100,66,
+    100,66,100,66,100,66,100,67,100,67,100,67,100,67,100,67,
+    100,67,100,67,100,68,100,68,100,68,100,68,100,68,100,68,
+    100,68,100,68,100,69,100,69,100,69,100,69,100,69,100,70,
+    100,70,100,70,100,70,100,70,100,70,100,71,100,71,100,72,
+    100,73,100,73,100,73,100,74,100,74,100,74,100,74,100,74,
+    100,74,100,74,100,74,100,74,100,74,100,74,100,74,100,75,
+    100,76,100,77,100,78,100,78,100,79,100,79,100,80,100,81,
+    100,81,100,82,100,82,100,82,100,82,100,83,100,83,100,83,
+    100,84,100,85,100,85,100,85,100,85,100,86,100,86,100,86,
+    100,87,100,87,100,87,100,88,100,89,100,89,100,89,100,89,
+    100,89,100,90,100,90,100,91,100,91,100,92,100,92,100,93,
+    100,93,100,94,100,95,100,96,100,96,100,96,100,97,100,97,
+    100,97,100,97,100,97,100,98,100,99,100,99,100,85,100,43,
+    100,45,100,3,100,100,144,1,156,67,90,1,100,101,83,0,
+    41,102,97,60,2,0,0,32,69,110,99,111,100,105,110,103,
+    32,65,108,105,97,115,101,115,32,83,117,112,112,111,114,116,
+    10,10,32,32,32,32,84,104,105,115,32,109,111,100,117,108,
+    101,32,105,115,32,117,115,101,100,32,98,121,32,116,104,101,
+    32,101,110,99,111,100,105,110,103,115,32,112,97,99,107,97,
+    103,101,32,115,101,97,114,99,104,32,102,117,110,99,116,105,
+    111,110,32,116,111,10,32,32,32,32,109,97,112,32,101,110,
+    99,111,100,105,110,103,115,32,110,97,109,101,115,32,116,111,
+    32,109,111,100,117,108,101,32,110,97,109,101,115,46,10,10,
+    32,32,32,32,78,111,116,101,32,116,104,97,116,32,116,104,
+    101,32,115,101,97,114,99,104,32,102,117,110,99,116,105,111,
+    110,32,110,111,114,109,97,108,105,122,101,115,32,116,104,101,
+    32,101,110,99,111,100,105,110,103,32,110,97,109,101,115,32,
+    98,101,102,111,114,101,10,32,32,32,32,100,111,105,110,103,
+    32,116,104,101,32,108,111,111,107,117,112,44,32,115,111,32,
+    116,104,101,32,109,97,112,112,105,110,103,32,119,105,108,108,
+    32,104,97,118,101,32,116,111,32,109,97,112,32,110,111,114,
+    109,97,108,105,122,101,100,10,32,32,32,32,101,110,99,111,
+    100,105,110,103,32,110,97,109,101,115,32,116,111,32,109,111,
+    100,117,108,101,32,110,97,109,101,115,46,10,10,32,32,32,
+    32,67,111,110,116,101,110,116,115,58,10,10,32,32,32,32,
+    32,32,32,32,84,104,101,32,102,111,108,108,111,119,105,110,
+    103,32,97,108,105,97,115,101,115,32,100,105,99,116,105,111,
+    110,97,114,121,32,99,111,110,116,97,105,110,115,32,109,97,
+    112,112,105,110,103,115,32,111,102,32,97,108,108,32,73,65,
+    78,65,10,32,32,32,32,32,32,32,32,99,104,97,114,97,
+    99,116,101,114,32,115,101,116,32,110,97,109,101,115,32,102,
+    111,114,32,119,104,105,99,104,32,116,104,101,32,80,121,116,
+    104,111,110,32,99,111,114,101,32,108,105,98,114,97,114,121,
+    32,112,114,111,118,105,100,101,115,10,32,32,32,32,32,32,
+    32,32,99,111,100,101,99,115,46,32,73,110,32,97,100,100,
+    105,116,105,111,110,32,116,111,32,116,104,101,115,101,44,32,
+    97,32,102,101,119,32,80,121,116,104,111,110,32,115,112,101,
+    99,105,102,105,99,32,99,111,100,101,99,10,32,32,32,32,
+    32,32,32,32,97,108,105,97,115,101,115,32,104,97,118,101,
+    32,97,108,115,111,32,98,101,101,110,32,97,100,100,101,100,
+    46,10,10,218,5,97,115,99,105,105,90,12,98,97,115,101,
+    54,52,95,99,111,100,101,99,90,4,98,105,103,53,90,9,
+    98,105,103,53,104,107,115,99,115,90,9,98,122,50,95,99,
+    111,100,101,99,90,5,99,112,48,51,55,90,6,99,112,49,
+    48,50,54,90,6,99,112,49,49,50,53,90,6,99,112,49,
+    49,52,48,90,6,99,112,49,50,53,48,90,6,99,112,49,
+    50,53,49,90,6,99,112,49,50,53,50,90,6,99,112,49,
+    50,53,51,90,6,99,112,49,50,53,52,90,6,99,112,49,
+    50,53,53,90,6,99,112,49,50,53,54,90,6,99,112,49,
+    50,53,55,90,6,99,112,49,50,53,56,90,5,99,112,50,
+    55,51,90,5,99,112,52,50,52,90,5,99,112,52,51,55,
+    90,5,99,112,53,48,48,90,5,99,112,55,55,53,90,5,
+    99,112,56,53,48,90,5,99,112,56,53,50,90,5,99,112,
+    56,53,53,90,5,99,112,56,53,55,90,5,99,112,56,53,
+    56,90,5,99,112,56,54,48,90,5,99,112,56,54,49,90,
+    5,99,112,56,54,50,90,5,99,112,56,54,51,90,5,99,
+    112,56,54,52,90,5,99,112,56,54,53,90,5,99,112,56,
+    54,54,90,5,99,112,56,54,57,90,5,99,112,57,51,50,
+    90,5,99,112,57,52,57,90,5,99,112,57,53,48,90,12,
+    101,117,99,95,106,105,115,95,50,48,48,52,90,12,101,117,
+    99,95,106,105,115,120,48,50,49,51,90,6,101,117,99,95,
+    106,112,90,6,101,117,99,95,107,114,90,7,103,98,49,56,
+    48,51,48,90,6,103,98,50,51,49,50,90,3,103,98,107,
+    90,9,104,101,120,95,99,111,100,101,99,90,9,104,112,95,
+    114,111,109,97,110,56,90,2,104,122,90,10,105,115,111,50,
+    48,50,50,95,106,112,90,12,105,115,111,50,48,50,50,95,
+    106,112,95,49,90,12,105,115,111,50,48,50,50,95,106,112,
+    95,50,90,15,105,115,111,50,48,50,50,95,106,112,95,50,
+    48,48,52,90,12,105,115,111,50,48,50,50,95,106,112,95,
+    51,90,14,105,115,111,50,48,50,50,95,106,112,95,101,120,
+    116,90,10,105,115,111,50,48,50,50,95,107,114,90,10,105,
+    115,111,56,56,53,57,95,49,48,90,10,105,115,111,56,56,
+    53,57,95,49,49,90,10,105,115,111,56,56,53,57,95,49,
+    51,90,10,105,115,111,56,56,53,57,95,49,52,90,10,105,
+    115,111,56,56,53,57,95,49,53,90,10,105,115,111,56,56,
+    53,57,95,49,54,90,9,105,115,111,56,56,53,57,95,50,
+    90,9,105,115,111,56,56,53,57,95,51,90,9,105,115,111,
+    56,56,53,57,95,52,90,9,105,115,111,56,56,53,57,95,
+    53,90,9,105,115,111,56,56,53,57,95,54,90,9,105,115,
+    111,56,56,53,57,95,55,90,9,105,115,111,56,56,53,57,
+    95,56,90,9,105,115,111,56,56,53,57,95,57,90,5,106,
+    111,104,97,98,90,6,107,111,105,56,95,114,90,6,107,122,
+    49,48,52,56,90,7,108,97,116,105,110,95,49,90,12,109,
+    97,99,95,99,121,114,105,108,108,105,99,90,9,109,97,99,
+    95,103,114,101,101,107,90,11,109,97,99,95,105,99,101,108,
+    97,110,100,90,10,109,97,99,95,108,97,116,105,110,50,90,
+    9,109,97,99,95,114,111,109,97,110,90,11,109,97,99,95,
+    116,117,114,107,105,115,104,90,4,109,98,99,115,90,7,112,
+    116,99,112,49,53,52,90,12,113,117,111,112,114,105,95,99,
+    111,100,101,99,90,6,114,111,116,95,49,51,90,9,115,104,
+    105,102,116,95,106,105,115,90,14,115,104,105,102,116,95,106,
+    105,115,95,50,48,48,52,90,14,115,104,105,102,116,95,106,
+    105,115,120,48,50,49,51,90,6,116,97,99,116,105,115,90,
+    7,116,105,115,95,54,50,48,90,6,117,116,102,95,49,54,
+    90,9,117,116,102,95,49,54,95,98,101,90,9,117,116,102,
+    95,49,54,95,108,101,90,6,117,116,102,95,51,50,90,9,
+    117,116,102,95,51,50,95,98,101,90,9,117,116,102,95,51,
+    50,95,108,101,90,5,117,116,102,95,55,90,5,117,116,102,
+    95,56,90,8,117,117,95,99,111,100,101,99,90,10,122,108,
+    105,98,95,99,111,100,101,99,40,67,1,0,0,90,3,54,
+    52,54,122,14,97,110,115,105,95,120,51,46,52,95,49,57,
+    54,56,90,14,97,110,115,105,95,120,51,95,52,95,49,57,
+    54,56,122,14,97,110,115,105,95,120,51,46,52,95,49,57,
+    56,54,90,5,99,112,51,54,55,90,7,99,115,97,115,99,
+    105,105,90,6,105,98,109,51,54,55,90,9,105,115,111,54,
+    52,54,95,117,115,122,16,105,115,111,95,54,52,54,46,105,
+    114,118,95,49,57,57,49,90,8,105,115,111,95,105,114,95,
+    54,90,2,117,115,90,8,117,115,95,97,115,99,105,105,90,
+    6,98,97,115,101,54,52,90,7,98,97,115,101,95,54,52,
+    90,7,98,105,103,53,95,116,119,90,6,99,115,98,105,103,
+    53,90,10,98,105,103,53,95,104,107,115,99,115,90,5,104,
+    107,115,99,115,90,3,98,122,50,90,3,48,51,55,90,8,
+    99,115,105,98,109,48,51,55,90,12,101,98,99,100,105,99,
+    95,99,112,95,99,97,90,12,101,98,99,100,105,99,95,99,
+    112,95,110,108,90,12,101,98,99,100,105,99,95,99,112,95,
+    117,115,90,12,101,98,99,100,105,99,95,99,112,95,119,116,
+    90,6,105,98,109,48,51,55,90,6,105,98,109,48,51,57,
+    90,4,49,48,50,54,90,9,99,115,105,98,109,49,48,50,
+    54,90,7,105,98,109,49,48,50,54,90,4,49,49,50,53,
+    90,7,105,98,109,49,49,50,53,90,6,99,112,56,54,54,
+    117,90,6,114,117,115,99,105,105,90,4,49,49,52,48,90,
+    7,105,98,109,49,49,52,48,90,4,49,50,53,48,90,12,
+    119,105,110,100,111,119,115,95,49,50,53,48,90,4,49,50,
+    53,49,90,12,119,105,110,100,111,119,115,95,49,50,53,49,
+    90,4,49,50,53,50,90,12,119,105,110,100,111,119,115,95,
+    49,50,53,50,90,4,49,50,53,51,90,12,119,105,110,100,
+    111,119,115,95,49,50,53,51,90,4,49,50,53,52,90,12,
+    119,105,110,100,111,119,115,95,49,50,53,52,90,4,49,50,
+    53,53,90,12,119,105,110,100,111,119,115,95,49,50,53,53,
+    90,4,49,50,53,54,90,12,119,105,110,100,111,119,115,95,
+    49,50,53,54,90,4,49,50,53,55,90,12,119,105,110,100,
+    111,119,115,95,49,50,53,55,90,4,49,50,53,56,90,12,
+    119,105,110,100,111,119,115,95,49,50,53,56,90,3,50,55,
+    51,90,6,105,98,109,50,55,51,90,8,99,115,105,98,109,
+    50,55,51,90,3,52,50,52,90,8,99,115,105,98,109,52,
+    50,52,90,12,101,98,99,100,105,99,95,99,112,95,104,101,
+    90,6,105,98,109,52,50,52,90,3,52,51,55,90,16,99,
+    115,112,99,56,99,111,100,101,112,97,103,101,52,51,55,90,
+    6,105,98,109,52,51,55,90,3,53,48,48,90,8,99,115,
+    105,98,109,53,48,48,90,12,101,98,99,100,105,99,95,99,
+    112,95,98,101,90,12,101,98,99,100,105,99,95,99,112,95,
+    99,104,90,6,105,98,109,53,48,48,90,3,55,55,53,90,
+    13,99,115,112,99,55,55,53,98,97,108,116,105,99,90,6,
+    105,98,109,55,55,53,90,3,56,53,48,90,19,99,115,112,
+    99,56,53,48,109,117,108,116,105,108,105,110,103,117,97,108,
+    90,6,105,98,109,56,53,48,90,3,56,53,50,90,8,99,
+    115,112,99,112,56,53,50,90,6,105,98,109,56,53,50,90,
+    3,56,53,53,90,8,99,115,105,98,109,56,53,53,90,6,
+    105,98,109,56,53,53,90,3,56,53,55,90,8,99,115,105,
+    98,109,56,53,55,90,6,105,98,109,56,53,55,90,3,56,
+    53,56,90,8,99,115,105,98,109,56,53,56,90,6,105,98,
+    109,56,53,56,90,3,56,54,48,90,8,99,115,105,98,109,
+    56,54,48,90,6,105,98,109,56,54,48,90,3,56,54,49,
+    90,5,99,112,95,105,115,90,8,99,115,105,98,109,56,54,
+    49,90,6,105,98,109,56,54,49,90,3,56,54,50,90,18,
+    99,115,112,99,56,54,50,108,97,116,105,110,104,101,98,114,
+    101,119,90,6,105,98,109,56,54,50,90,3,56,54,51,90,
+    8,99,115,105,98,109,56,54,51,90,6,105,98,109,56,54,
+    51,90,3,56,54,52,90,8,99,115,105,98,109,56,54,52,
+    90,6,105,98,109,56,54,52,90,3,56,54,53,90,8,99,
+    115,105,98,109,56,54,53,90,6,105,98,109,56,54,53,90,
+    3,56,54,54,90,8,99,115,105,98,109,56,54,54,90,6,
+    105,98,109,56,54,54,90,3,56,54,57,90,5,99,112,95,
+    103,114,90,8,99,115,105,98,109,56,54,57,90,6,105,98,
+    109,56,54,57,90,3,57,51,50,90,5,109,115,57,51,50,
+    90,7,109,115,107,97,110,106,105,90,8,109,115,95,107,97,
+    110,106,105,90,3,57,52,57,90,5,109,115,57,52,57,90,
+    3,117,104,99,90,3,57,53,48,90,5,109,115,57,53,48,
+    90,8,106,105,115,120,48,50,49,51,90,10,101,117,99,106,
+    105,115,50,48,48,52,90,11,101,117,99,95,106,105,115,50,
+    48,48,52,90,11,101,117,99,106,105,115,120,48,50,49,51,
+    90,5,101,117,99,106,112,90,4,117,106,105,115,90,5,117,
+    95,106,105,115,90,5,101,117,99,107,114,90,6,107,111,114,
+    101,97,110,90,7,107,115,99,53,54,48,49,90,9,107,115,
+    95,99,95,53,54,48,49,90,14,107,115,95,99,95,53,54,
+    48,49,95,49,57,56,55,90,7,107,115,120,49,48,48,49,
+    90,9,107,115,95,120,95,49,48,48,49,90,12,103,98,49,
+    56,48,51,48,95,50,48,48,48,90,7,99,104,105,110,101,
+    115,101,90,15,99,115,105,115,111,53,56,103,98,50,51,49,
+    50,56,48,90,6,101,117,99,95,99,110,90,5,101,117,99,
+    99,110,90,12,101,117,99,103,98,50,51,49,50,95,99,110,
+    90,11,103,98,50,51,49,50,95,49,57,56,48,90,9,103,
+    98,50,51,49,50,95,56,48,90,9,105,115,111,95,105,114,
+    95,53,56,90,3,57,51,54,90,5,99,112,57,51,54,90,
+    5,109,115,57,51,54,218,3,104,101,120,90,6,114,111,109,
+    97,110,56,90,2,114,56,90,10,99,115,72,80,82,111,109,
+    97,110,56,90,4,104,122,103,98,90,5,104,122,95,103,98,
+    90,10,104,122,95,103,98,95,50,51,49,50,90,11,99,115,
+    105,115,111,50,48,50,50,106,112,90,9,105,115,111,50,48,
+    50,50,106,112,90,11,105,115,111,95,50,48,50,50,95,106,
+    112,90,11,105,115,111,50,48,50,50,106,112,95,49,90,13,
+    105,115,111,95,50,48,50,50,95,106,112,95,49,90,11,105,
+    115,111,50,48,50,50,106,112,95,50,90,13,105,115,111,95,
+    50,48,50,50,95,106,112,95,50,90,16,105,115,111,95,50,
+    48,50,50,95,106,112,95,50,48,48,52,90,14,105,115,111,
+    50,48,50,50,106,112,95,50,48,48,52,90,11,105,115,111,
+    50,48,50,50,106,112,95,51,90,13,105,115,111,95,50,48,
+    50,50,95,106,112,95,51,90,13,105,115,111,50,48,50,50,
+    106,112,95,101,120,116,90,15,105,115,111,95,50,48,50,50,
+    95,106,112,95,101,120,116,90,11,99,115,105,115,111,50,48,
+    50,50,107,114,90,9,105,115,111,50,48,50,50,107,114,90,
+    11,105,115,111,95,50,48,50,50,95,107,114,90,11,99,115,
+    105,115,111,108,97,116,105,110,54,90,11,105,115,111,95,56,
+    56,53,57,95,49,48,90,16,105,115,111,95,56,56,53,57,
+    95,49,48,95,49,57,57,50,90,10,105,115,111,95,105,114,
+    95,49,53,55,90,2,108,54,90,6,108,97,116,105,110,54,
+    90,4,116,104,97,105,90,11,105,115,111,95,56,56,53,57,
+    95,49,49,90,16,105,115,111,95,56,56,53,57,95,49,49,
+    95,50,48,48,49,90,11,105,115,111,95,56,56,53,57,95,
+    49,51,90,2,108,55,90,6,108,97,116,105,110,55,90,11,
+    105,115,111,95,56,56,53,57,95,49,52,90,16,105,115,111,
+    95,56,56,53,57,95,49,52,95,49,57,57,56,90,10,105,
+    115,111,95,99,101,108,116,105,99,90,10,105,115,111,95,105,
+    114,95,49,57,57,90,2,108,56,90,6,108,97,116,105,110,
+    56,90,11,105,115,111,95,56,56,53,57,95,49,53,90,2,
+    108,57,90,6,108,97,116,105,110,57,90,11,105,115,111,95,
+    56,56,53,57,95,49,54,90,16,105,115,111,95,56,56,53,
+    57,95,49,54,95,50,48,48,49,90,10,105,115,111,95,105,
+    114,95,50,50,54,90,3,108,49,48,90,7,108,97,116,105,
+    110,49,48,90,11,99,115,105,115,111,108,97,116,105,110,50,
+    90,10,105,115,111,95,56,56,53,57,95,50,90,15,105,115,
+    111,95,56,56,53,57,95,50,95,49,57,56,55,90,10,105,
+    115,111,95,105,114,95,49,48,49,90,2,108,50,90,6,108,
+    97,116,105,110,50,90,11,99,115,105,115,111,108,97,116,105,
+    110,51,90,10,105,115,111,95,56,56,53,57,95,51,90,15,
+    105,115,111,95,56,56,53,57,95,51,95,49,57,56,56,90,
+    10,105,115,111,95,105,114,95,49,48,57,90,2,108,51,90,
+    6,108,97,116,105,110,51,90,11,99,115,105,115,111,108,97,
+    116,105,110,52,90,10,105,115,111,95,56,56,53,57,95,52,
+    90,15,105,115,111,95,56,56,53,57,95,52,95,49,57,56,
+    56,90,10,105,115,111,95,105,114,95,49,49,48,90,2,108,
+    52,90,6,108,97,116,105,110,52,90,18,99,115,105,115,111,
+    108,97,116,105,110,99,121,114,105,108,108,105,99,90,8,99,
+    121,114,105,108,108,105,99,90,10,105,115,111,95,56,56,53,
+    57,95,53,90,15,105,115,111,95,56,56,53,57,95,53,95,
+    49,57,56,56,90,10,105,115,111,95,105,114,95,49,52,52,
+    90,6,97,114,97,98,105,99,90,8,97,115,109,111,95,55,
+    48,56,90,16,99,115,105,115,111,108,97,116,105,110,97,114,
+    97,98,105,99,90,8,101,99,109,97,95,49,49,52,90,10,
+    105,115,111,95,56,56,53,57,95,54,90,15,105,115,111,95,
+    56,56,53,57,95,54,95,49,57,56,55,90,10,105,115,111,
+    95,105,114,95,49,50,55,90,15,99,115,105,115,111,108,97,
+    116,105,110,103,114,101,101,107,90,8,101,99,109,97,95,49,
+    49,56,90,8,101,108,111,116,95,57,50,56,90,5,103,114,
+    101,101,107,90,6,103,114,101,101,107,56,90,10,105,115,111,
+    95,56,56,53,57,95,55,90,15,105,115,111,95,56,56,53,
+    57,95,55,95,49,57,56,55,90,10,105,115,111,95,105,114,
+    95,49,50,54,90,16,99,115,105,115,111,108,97,116,105,110,
+    104,101,98,114,101,119,90,6,104,101,98,114,101,119,90,10,
+    105,115,111,95,56,56,53,57,95,56,90,15,105,115,111,95,
+    56,56,53,57,95,56,95,49,57,56,56,90,10,105,115,111,
+    95,105,114,95,49,51,56,90,11,99,115,105,115,111,108,97,
+    116,105,110,53,90,10,105,115,111,95,56,56,53,57,95,57,
+    90,15,105,115,111,95,56,56,53,57,95,57,95,49,57,56,
+    57,90,10,105,115,111,95,105,114,95,49,52,56,90,2,108,
+    53,90,6,108,97,116,105,110,53,90,6,99,112,49,51,54,
+    49,90,6,109,115,49,51,54,49,90,7,99,115,107,111,105,
+    56,114,90,7,107,122,95,49,48,52,56,90,6,114,107,49,
+    48,52,56,90,13,115,116,114,107,49,48,52,56,95,50,48,
+    48,50,90,4,56,56,53,57,90,5,99,112,56,49,57,90,
+    11,99,115,105,115,111,108,97,116,105,110,49,90,6,105,98,
+    109,56,49,57,90,7,105,115,111,56,56,53,57,90,9,105,
+    115,111,56,56,53,57,95,49,90,10,105,115,111,95,56,56,
+    53,57,95,49,90,15,105,115,111,95,56,56,53,57,95,49,
+    95,49,57,56,55,90,10,105,115,111,95,105,114,95,49,48,
+    48,90,2,108,49,90,5,108,97,116,105,110,90,6,108,97,
+    116,105,110,49,90,11,109,97,99,99,121,114,105,108,108,105,
+    99,90,8,109,97,99,103,114,101,101,107,90,10,109,97,99,
+    105,99,101,108,97,110,100,90,16,109,97,99,99,101,110,116,
+    114,97,108,101,117,114,111,112,101,90,9,109,97,99,108,97,
+    116,105,110,50,90,9,109,97,99,105,110,116,111,115,104,90,
+    8,109,97,99,114,111,109,97,110,90,10,109,97,99,116,117,
+    114,107,105,115,104,90,4,97,110,115,105,90,4,100,98,99,
+    115,90,9,99,115,112,116,99,112,49,53,52,90,5,112,116,
+    49,53,52,90,5,99,112,49,53,52,90,14,99,121,114,105,
+    108,108,105,99,95,97,115,105,97,110,90,6,113,117,111,112,
+    114,105,90,16,113,117,111,116,101,100,95,112,114,105,110,116,
+    97,98,108,101,90,15,113,117,111,116,101,100,112,114,105,110,
+    116,97,98,108,101,90,5,114,111,116,49,51,90,10,99,115,
+    115,104,105,102,116,106,105,115,90,8,115,104,105,102,116,106,
+    105,115,90,4,115,106,105,115,90,5,115,95,106,105,115,90,
+    12,115,104,105,102,116,106,105,115,50,48,48,52,90,9,115,
+    106,105,115,95,50,48,48,52,90,10,115,95,106,105,115,95,
+    50,48,48,52,90,13,115,104,105,102,116,106,105,115,120,48,
+    50,49,51,90,9,115,106,105,115,120,48,50,49,51,90,10,
+    115,95,106,105,115,120,48,50,49,51,90,6,116,105,115,50,
+    54,48,90,6,116,105,115,54,50,48,90,9,116,105,115,95,
+    54,50,48,95,48,90,14,116,105,115,95,54,50,48,95,50,
+    53,50,57,95,48,90,14,116,105,115,95,54,50,48,95,50,
+    53,50,57,95,49,90,10,105,115,111,95,105,114,95,49,54,
+    54,90,3,117,49,54,90,5,117,116,102,49,54,90,18,117,
+    110,105,99,111,100,101,98,105,103,117,110,109,97,114,107,101,
+    100,90,8,117,116,102,95,49,54,98,101,90,21,117,110,105,
+    99,111,100,101,108,105,116,116,108,101,117,110,109,97,114,107,
+    101,100,90,8,117,116,102,95,49,54,108,101,90,3,117,51,
+    50,90,5,117,116,102,51,50,90,8,117,116,102,95,51,50,
+    98,101,90,8,117,116,102,95,51,50,108,101,90,2,117,55,
+    90,4,117,116,102,55,90,17,117,110,105,99,111,100,101,95,
+    49,95,49,95,117,116,102,95,55,90,2,117,56,90,3,117,
+    116,102,90,4,117,116,102,56,90,9,117,116,102,56,95,117,
+    99,115,50,90,9,117,116,102,56,95,117,99,115,52,90,2,
+    117,117,218,3,122,105,112,90,4,122,108,105,98,90,14,120,
+    95,109,97,99,95,106,97,112,97,110,101,115,101,90,12,120,
+    95,109,97,99,95,107,111,114,101,97,110,90,18,120,95,109,
+    97,99,95,115,105,109,112,95,99,104,105,110,101,115,101,90,
+    18,120,95,109,97,99,95,116,114,97,100,95,99,104,105,110,
+    101,115,101,78,41,2,218,7,95,95,100,111,99,95,95,90,
+    7,97,108,105,97,115,101,115,169,0,114,4,0,0,0,114,
+    4,0,0,0,122,26,60,102,114,111,122,101,110,32,101,110,
+    99,111,100,105,110,103,115,46,97,108,105,97,115,101,115,62,
+    218,8,60,109,111,100,117,108,101,62,1,0,0,0,115,144,
+    2,0,0,4,22,2,1,2,1,2,1,2,1,2,1,2,
+    1,2,1,2,1,2,1,2,1,2,1,2,3,2,1,2,
+    3,2,1,2,3,2,1,2,3,2,3,2,1,2,1,2,
+    1,2,1,2,1,2,1,2,1,2,3,2,1,2,1,2,
+    3,2,1,2,1,2,1,2,3,2,1,2,3,2,1,2,
+    3,2,1,2,3,2,1,2,3,2,1,2,3,2,1,2,
+    3,2,1,2,3,2,1,2,3,2,1,2,3,2,1,2,
+    3,2,1,2,1,2,3,2,1,2,1,2,1,2,3,2,
+    1,2,1,2,3,2,1,2,1,2,1,2,1,2,3,2,
+    1,2,1,2,3,2,1,2,1,2,3,2,1,2,1,2,
+    3,2,1,2,1,2,3,2,1,2,1,2,3,2,1,2,
+    1,2,3,2,1,2,1,2,3,2,1,2,1,2,1,2,
+    3,2,1,2,1,2,3,2,1,2,1,2,3,2,1,2,
+    1,2,3,2,1,2,1,2,3,2,1,2,1,2,3,2,
+    1,2,1,2,1,2,3,2,1,2,1,2,1,2,3,2,
+    1,2,1,2,3,2,1,2,3,2,1,2,1,2,3,2,
+    3,2,1,2,1,2,3,2,1,2,1,2,1,2,1,2,
+    1,2,1,2,3,2,3,2,1,2,1,2,1,2,1,2,
+    1,2,1,2,1,2,3,2,1,2,1,2,3,2,3,2,
+    1,2,1,2,3,2,1,2,1,2,3,2,1,2,1,2,
+    3,2,1,2,3,2,1,2,3,2,1,2,3,2,1,2,
+    3,2,1,2,3,2,1,2,1,2,3,2,1,2,1,2,
+    1,2,1,2,1,2,3,2,1,2,1,2,3,2,1,2,
+    1,2,3,2,1,2,1,2,1,2,1,2,1,2,3,2,
+    1,2,1,2,3,2,1,2,1,2,1,2,1,2,3,2,
+    1,2,1,2,1,2,1,2,1,2,3,2,1,2,1,2,
+    1,2,1,2,1,2,3,2,1,2,1,2,1,2,1,2,
+    1,2,3,2,1,2,1,2,1,2,1,2,3,2,1,2,
+    1,2,1,2,1,2,1,2,1,2,3,2,1,2,1,2,
+    1,2,1,2,1,2,1,2,1,2,3,2,1,2,1,2,
+    1,2,1,2,3,2,1,2,1,2,1,2,1,2,1,2,
+    3,2,1,2,3,2,3,2,1,2,1,2,9,2,1,2,
+    1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+    1,2,1,2,3,2,3,2,3,2,3,2,1,2,3,2,
+    1,2,3,2,3,2,1,2,3,2,1,2,1,2,1,2,
+    3,2,1,2,1,2,3,2,3,2,1,2,1,2,1,2,
+    3,2,1,2,1,2,3,2,1,2,1,2,3,2,3,2,
+    1,2,1,2,1,2,1,2,3,2,1,2,3,2,1,2,
+    3,2,1,2,3,2,1,2,3,2,3,2,3,2,1,2,
+    1,2,3,2,1,2,1,2,1,2,1,2,3,2,3,2,
+    1,2,3,2,1,2,1,2,1,2,128,0,128,0,128,0,
+    128,0,237,
+};
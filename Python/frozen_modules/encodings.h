@@ -0,0 +1,244 @@
+/* Auto-generated by Programs/_freeze_importlib.c */
+const unsigned char _Py_M__encodings[] = {
+    99,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,
+    0,64,0,0,0,115,128,0,0,0,100,0,90,0,100,1,
+    100,2,108,1,90,1,100,1,100,2,108,2,90,2,100,3,
+    100,4,108,3,109,4,90,4,1,0,105,0,90,5,100,5,
+    90,6,100,6,103,1,90,7,101,4,106,4,90,8,71,0,
+    100,7,100,8,132,0,100,8,101,9,101,10,131,4,90,11,
+    100,9,100,10,132,0,90,12,100,11,100,12,132,0,90,13,
+    101,1,160,14,101,13,161,1,1,0,101,2,106,15,100,13,
+    107,2,114,124,100,14,100,15,132,0,90,16,101,1,160,14,
+    101,16,161,1,1,0,100,2,83,0,41,16,97,51,4,0,
+    0,32,83,116,97,110,100,97,114,100,32,34,101,110,99,111,
+    100,105,110,103,115,34,32,80,97,99,107,97,103,101,10,10,
+    32,32,32,32,83,116,97,110,100,97,114,100,32,80,121,116,
+    104,111,110,32,101,110,99,111,100,105,110,103,32,109,111,100,
+    117,108,101,115,32,97,114,101,32,115,116,111,114,101,100,32,
+    105,110,32,116,104,105,115,32,112,97,99,107,97,103,101,10,
+    32,32,32,32,100,105,114,101,99,116,111,114,121,46,10,10,
+    32,32,32,32,67,111,100,101,99,32,109,111,100,117,108,101,
+    115,32,109,117,115,116,32,104,97,118,101,32,110,97,109,101,
+    115,32,99,111,114,114,101,115,112,111,110,100,105,110,103,32,
+    116,111,32,110,111,114,109,97,108,105,122,101,100,32,101,110,
+    99,111,100,105,110,103,10,32,32,32,32,110,97,109,101,115,
+    32,97,115,32,100,101,102,105,110,101,100,32,105,110,32,116,
+    104,101,32,110,111,114,109,97,108,105,122,101,95,101,110,99,
+    111,100,105,110,103,40,41,32,102,117,110,99,116,105,111,110,
+    32,98,101,108,111,119,44,32,101,46,103,46,10,32,32,32,
+    32,39,117,116,102,45,56,39,32,109,117,115,116,32,98,101,
+    32,105,109,112,108,101,109,101,110,116,101,100,32,98,121,32,
+    116,104,101,32,109,111,100,117,108,101,32,39,117,116,102,95,
+    56,46,112,121,39,46,10,10,32,32,32,32,69,97,99,104,
+    32,99,111,100,101,99,32,109,111,100,117,108,101,32,109,117,
+    115,116,32,101,120,112,111,114,116,32,116,104,101,32,102,111,
+    108,108,111,119,105,110,103,32,105,110,116,101,114,102,97,99,
+    101,58,10,10,32,32,32,32,42,32,103,101,116,114,101,103,
+    101,110,116,114,121,40,41,32,45,62,32,99,111,100,101,99,
+    115,46,67,111,100,101,99,73,110,102,111,32,111,98,106,101,
+    99,116,10,32,32,32,32,84,104,101,32,103,101,116,114,101,
+    103,101,110,116,114,121,40,41,32,65,80,73,32,109,117,115,
+    116,32,114,101,116,117,114,110,32,97,32,67,111,100,101,99,
+    73,110,102,111,32,111,98,106,101,99,116,32,119,105,116,104,
+    32,101,110,99,111,100,101,114,44,32,100,101,99,111,100,101,
+    114,44,10,32,32,32,32,105,110,99,114,101,109,101,110,116,
+    97,108,101,110,99,111,100,101,114,44,32,105,110,99,114,101,
+    109,101,110,116,97,108,100,101,99,111,100,101,114,44,32,115,
+    116,114,101,97,109,119,114,105,116,101,114,32,97,110,100,32,
+    115,116,114,101,97,109,114,101,97,100,101,114,10,32,32,32,
+    32,97,116,116,116,114,105,98,117,116,101,115,32,119,104,105,
+    99,104,32,97,100,104,101,114,101,32,116,111,32,116,104,101,
+    32,80,121,116,104,111,110,32,67,111,100,101,99,32,73,110,
+    116,101,114,102,97,99,101,32,83,116,97,110,100,97,114,100,
+    46,10,10,32,32,32,32,73,110,32,97,100,100,105,116,105,
+    111,110,44,32,97,32,109,111,100,117,108,101,32,109,97,121,
+    32,111,112,116,105,111,110,97,108,108,121,32,97,108,115,111,
+    32,100,101,102,105,110,101,32,116,104,101,32,102,111,108,108,
+    111,119,105,110,103,10,32,32,32,32,65,80,73,115,32,119,
+    104,105,99,104,32,97,114,101,32,116,104,101,110,32,117,115,
+    101,100,32,98,121,32,116,104,101,32,112,97,99,107,97,103,
+    101,39,115,32,99,111,100,101,99,32,115,101,97,114,99,104,
+    32,102,117,110,99,116,105,111,110,58,10,10,32,32,32,32,
+    42,32,103,101,116,97,108,105,97,115,101,115,40,41,32,45,
+    62,32,115,101,113,117,101,110,99,101,32,111,102,32,101,110,
+    99,111,100,105,110,103,32,110,97,109,101,32,115,116,114,105,
+    110,103,115,32,116,111,32,117,115,101,32,97,115,32,97,108,
+    105,97,115,101,115,10,10,32,32,32,32,65,108,105,97,115,
+    32,110,97,109,101,115,32,114,101,116,117,114,110,101,100,32,
+    98,121,32,103,101,116,97,108,105,97,115,101,115,40,41,32,
+    109,117,115,116,32,98,101,32,110,111,114,109,97,108,105,122,
+    101,100,32,101,110,99,111,100,105,110,103,10,32,32,32,32,
+    110,97,109,101,115,32,97,115,32,100,101,102,105,110,101,100,
+    32,98,121,32,110,111,114,109,97,108,105,122,101,95,101,110,
+    99,111,100,105,110,103,40,41,46,10,10,87,114,105,116,116,
+    101,110,32,98,121,32,77,97,114,99,45,65,110,100,114,101,
+    32,76,101,109,98,117,114,103,32,40,109,97,108,64,108,101,
+    109,98,117,114,103,46,99,111,109,41,46,10,10,40,99,41,
+    32,67,111,112,121,114,105,103,104,116,32,67,78,82,73,44,
+    32,65,108,108,32,82,105,103,104,116,115,32,82,101,115,101,
+    114,118,101,100,46,32,78,79,32,87,65,82,82,65,78,84,
+    89,46,10,10,233,0,0,0,0,78,233,1,0,0,0,41,
+    1,218,7,97,108,105,97,115,101,115,122,11,45,45,117,110,
+    107,110,111,119,110,45,45,250,1,42,99,0,0,0,0,0,
+    0,0,0,0,0,0,0,1,0,0,0,64,0,0,0,115,
+    12,0,0,0,101,0,90,1,100,0,90,2,100,1,83,0,
+    41,2,218,18,67,111,100,101,99,82,101,103,105,115,116,114,
+    121,69,114,114,111,114,78,41,3,218,8,95,95,110,97,109,
+    101,95,95,218,10,95,95,109,111,100,117,108,101,95,95,218,
+    12,95,95,113,117,97,108,110,97,109,101,95,95,169,0,114,
+    8,0,0,0,114,8,0,0,0,250,18,60,102,114,111,122,
+    101,110,32,101,110,99,111,100,105,110,103,115,62,114,4,0,
+    0,0,40,0,0,0,115,2,0,0,0,8,1,114,4,0,
+    0,0,99,1,0,0,0,0,0,0,0,4,0,0,0,4,
+    0,0,0,67,0,0,0,115,102,0,0,0,116,0,124,0,
+    116,1,131,2,114,20,116,2,124,0,100,1,131,2,125,0,
+    103,0,125,1,100,2,125,2,124,0,68,0,93,58,125,3,
+    124,3,160,3,161,0,115,52,124,3,100,3,107,2,114,86,
+    124,2,114,70,124,1,114,70,124,1,160,4,100,4,161,1,
+    1,0,124,1,160,4,124,3,161,1,1,0,100,2,125,2,
+    113,32,100,5,125,2,113,32,100,6,160,5,124,1,161,1,
+    83,0,41,7,97,101,1,0,0,32,78,111,114,109,97,108,
+    105,122,101,32,97,110,32,101,110,99,111,100,105,110,103,32,
+    110,97,109,101,46,10,10,32,32,32,32,32,32,32,32,78,
+    111,114,109,97,108,105,122,97,116,105,111,110,32,119,111,114,
+    107,115,32,97,115,32,102,111,108,108,111,119,115,58,32,97,
+    108,108,32,110,111,110,45,97,108,112,104,97,110,117,109,101,
+    114,105,99,10,32,32,32,32,32,32,32,32,99,104,97,114,
+    97,99,116,101,114,115,32,101,120,99,101,112,116,32,116,104,
+    101,32,100,111,116,32,117,115,101,100,32,102,111,114,32,80,
+    121,116,104,111,110,32,112,97,99,107,97,103,101,32,110,97,
+    109,101,115,32,97,114,101,10,32,32,32,32,32,32,32,32,
+    99,111,108,108,97,112,115,101,100,32,97,110,100,32,114,101,
+    112,108,97,99,101,100,32,119,105,116,104,32,97,32,115,105,
+    110,103,108,101,32,117,110,100,101,114,115,99,111,114,101,44,
+    32,101,46,103,46,32,39,32,32,45,59,35,39,10,32,32,
+    32,32,32,32,32,32,98,101,99,111,109,101,115,32,39,95,
+    39,46,32,76,101,97,100,105,110,103,32,97,110,100,32,116,
+    114,97,105,108,105,110,103,32,117,110,100,101,114,115,99,111,
+    114,101,115,32,97,114,101,32,114,101,109,111,118,101,100,46,
+    10,10,32,32,32,32,32,32,32,32,78,111,116,101,32,116,
+    104,97,116,32,101,110,99,111,100,105,110,103,32,110,97,109,
+    101,115,32,115,104,111,117,108,100,32,98,101,32,65,83,67,
+    73,73,32,111,110,108,121,46,10,10,32,32,32,32,218,5,
+    97,115,99,105,105,70,250,1,46,218,1,95,84,218,0,41,
+    6,218,10,105,115,105,110,115,116,97,110,99,101,218,5,98,
+    121,116,101,115,218,3,115,116,114,218,7,105,115,97,108,110,
+    117,109,218,6,97,112,112,101,110,100,218,4,106,111,105,110,
+    41,4,218,8,101,110,99,111,100,105,110,103,90,5,99,104,
+    97,114,115,90,5,112,117,110,99,116,218,1,99,114,8,0,
+    0,0,114,8,0,0,0,114,9,0,0,0,218,18,110,111,
+    114,109,97,108,105,122,101,95,101,110,99,111,100,105,110,103,
+    43,0,0,0,115,24,0,0,0,0,12,10,1,10,2,4,
+    1,4,1,8,1,16,1,8,1,10,1,10,1,6,2,6,
+    1,114,22,0,0,0,99,1,0,0,0,0,0,0,0,10,
+    0,0,0,9,0,0,0,67,0,0,0,115,118,2,0,0,
+    116,0,160,1,124,0,116,2,161,2,125,1,124,1,116,2,
+    107,9,114,24,124,1,83,0,116,3,124,0,131,1,125,2,
+    116,4,160,1,124,2,161,1,112,58,116,4,160,1,124,2,
+    160,5,100,1,100,2,161,2,161,1,125,3,124,3,100,0,
+    107,9,114,78,124,3,124,2,103,2,125,4,110,6,124,2,
+    103,1,125,4,124,4,68,0,93,66,125,5,124,5,114,104,
+    100,1,124,5,107,6,114,106,113,88,122,22,116,6,100,3,
+    124,5,23,0,116,7,100,4,100,5,141,3,125,6,87,0,
+    110,20,4,0,116,8,107,10,114,148,1,0,1,0,1,0,
+    89,0,110,6,88,0,1,0,113,160,113,88,100,0,125,6,
+    122,10,124,6,106,9,125,7,87,0,110,24,4,0,116,10,
+    107,10,114,194,1,0,1,0,1,0,100,0,125,6,89,0,
+    110,2,88,0,124,6,100,0,107,8,114,216,100,0,116,0,
+    124,0,60,0,100,0,83,0,124,7,131,0,125,1,116,11,
+    124,1,116,12,106,13,131,2,144,2,115,40,100,6,116,14,
+    124,1,131,1,4,0,3,0,107,1,144,1,114,8,100,7,
+    107,1,144,1,115,30,110,2,1,0,116,15,100,8,124,6,
+    106,16,124,6,106,17,102,2,22,0,131,1,130,1,116,18,
+    124,1,100,4,25,0,131,1,144,1,114,198,116,18,124,1,
+    100,9,25,0,131,1,144,1,114,198,124,1,100,10,25,0,
+    100,0,107,9,144,1,114,86,116,18,124,1,100,10,25,0,
+    131,1,144,1,114,198,124,1,100,11,25,0,100,0,107,9,
+    144,1,114,114,116,18,124,1,100,11,25,0,131,1,144,1,
+    114,198,116,14,124,1,131,1,100,6,107,4,144,1,114,156,
+    124,1,100,6,25,0,100,0,107,9,144,1,114,156,116,18,
+    124,1,100,6,25,0,131,1,144,1,114,198,116,14,124,1,
+    131,1,100,12,107,4,144,1,114,218,124,1,100,12,25,0,
+    100,0,107,9,144,1,114,218,116,18,124,1,100,12,25,0,
+    131,1,144,1,115,218,116,15,100,13,124,6,106,16,124,6,
+    106,17,102,2,22,0,131,1,130,1,116,14,124,1,131,1,
+    100,7,107,0,144,1,115,246,124,1,100,14,25,0,100,0,
+    107,8,144,2,114,30,124,1,100,15,100,14,116,14,124,1,
+    131,1,24,0,20,0,124,6,106,16,160,19,100,1,100,9,
+    161,2,100,9,25,0,102,1,23,0,55,0,125,1,116,12,
+    106,13,124,1,142,0,125,1,124,1,116,0,124,0,60,0,
+    122,12,124,6,160,20,161,0,125,8,87,0,110,22,4,0,
+    116,10,107,10,144,2,114,82,1,0,1,0,1,0,89,0,
+    110,32,88,0,124,8,68,0,93,24,125,9,124,9,116,4,
+    107,7,144,2,114,110,124,5,116,4,124,9,60,0,144,2,
+    113,88,124,1,83,0,41,16,78,114,11,0,0,0,114,12,
+    0,0,0,122,10,101,110,99,111,100,105,110,103,115,46,114,
+    0,0,0,0,41,2,90,8,102,114,111,109,108,105,115,116,
+    90,5,108,101,118,101,108,233,4,0,0,0,233,7,0,0,
+    0,122,35,109,111,100,117,108,101,32,34,37,115,34,32,40,
+    37,115,41,32,102,97,105,108,101,100,32,116,111,32,114,101,
+    103,105,115,116,101,114,114,1,0,0,0,233,2,0,0,0,
+    233,3,0,0,0,233,5,0,0,0,122,39,105,110,99,111,
+    109,112,97,116,105,98,108,101,32,99,111,100,101,99,115,32,
+    105,110,32,109,111,100,117,108,101,32,34,37,115,34,32,40,
+    37,115,41,233,6,0,0,0,41,1,78,41,21,218,6,95,
+    99,97,99,104,101,218,3,103,101,116,218,8,95,117,110,107,
+    110,111,119,110,114,22,0,0,0,218,8,95,97,108,105,97,
+    115,101,115,218,7,114,101,112,108,97,99,101,218,10,95,95,
+    105,109,112,111,114,116,95,95,218,12,95,105,109,112,111,114,
+    116,95,116,97,105,108,218,11,73,109,112,111,114,116,69,114,
+    114,111,114,218,11,103,101,116,114,101,103,101,110,116,114,121,
+    218,14,65,116,116,114,105,98,117,116,101,69,114,114,111,114,
+    114,14,0,0,0,218,6,99,111,100,101,99,115,90,9,67,
+    111,100,101,99,73,110,102,111,218,3,108,101,110,114,4,0,
+    0,0,114,5,0,0,0,90,8,95,95,102,105,108,101,95,
+    95,218,8,99,97,108,108,97,98,108,101,218,5,115,112,108,
+    105,116,90,10,103,101,116,97,108,105,97,115,101,115,41,10,
+    114,20,0,0,0,90,5,101,110,116,114,121,90,13,110,111,
+    114,109,95,101,110,99,111,100,105,110,103,90,16,97,108,105,
+    97,115,101,100,95,101,110,99,111,100,105,110,103,90,8,109,
+    111,100,110,97,109,101,115,90,7,109,111,100,110,97,109,101,
+    90,3,109,111,100,114,37,0,0,0,90,12,99,111,100,101,
+    99,97,108,105,97,115,101,115,90,5,97,108,105,97,115,114,
+    8,0,0,0,114,8,0,0,0,114,9,0,0,0,218,15,
+    115,101,97,114,99,104,95,102,117,110,99,116,105,111,110,70,
+    0,0,0,115,144,0,0,0,0,3,12,1,8,1,4,9,
+    8,1,10,1,16,255,2,2,8,1,2,1,2,255,6,3,
+    6,1,8,1,12,1,2,1,2,3,10,1,2,255,10,2,
+    14,3,6,2,6,2,4,2,2,1,10,1,14,2,10,2,
+    8,2,8,1,4,3,6,1,14,1,30,1,4,1,10,255,
+    6,2,28,1,10,255,4,1,10,255,4,2,10,254,4,2,
+    10,254,4,3,10,253,4,3,10,253,4,3,10,253,4,4,
+    10,252,4,4,10,252,4,4,10,252,4,5,4,1,10,255,
+    6,2,28,1,40,1,10,3,8,4,2,1,12,1,16,1,
+    6,2,8,1,10,1,12,3,114,43,0,0,0,90,5,119,
+    105,110,51,50,99,1,0,0,0,0,0,0,0,4,0,0,
+    0,8,0,0,0,67,0,0,0,115,78,0,0,0,122,52,
+    100,1,100,0,108,0,125,1,100,2,124,1,160,1,161,0,
+    22,0,125,2,124,0,124,2,107,2,114,50,100,1,100,0,
+    108,2,125,3,124,3,106,3,160,4,161,0,87,0,83,0,
+    87,0,110,20,4,0,116,5,107,10,114,72,1,0,1,0,
+    1,0,89,0,110,2,88,0,100,0,83,0,41,3,78,114,
+    0,0,0,0,122,4,99,112,37,115,41,6,218,7,95,119,
+    105,110,97,112,105,90,6,71,101,116,65,67,80,90,14,101,
+    110,99,111,100,105,110,103,115,46,109,98,99,115,90,4,109,
+    98,99,115,114,37,0,0,0,114,36,0,0,0,41,4,114,
+    20,0,0,0,114,44,0,0,0,90,14,97,110,115,105,95,
+    99,111,100,101,95,112,97,103,101,90,9,101,110,99,111,100,
+    105,110,103,115,114,8,0,0,0,114,8,0,0,0,114,9,
+    0,0,0,218,11,95,97,108,105,97,115,95,109,98,99,115,
+    158,0,0,0,115,16,0,0,0,0,1,2,1,8,1,12,
+    1,8,1,8,1,16,1,14,2,114,45,0,0,0,41,17,
+    218,7,95,95,100,111,99,95,95,114,39,0,0,0,218,3,
+    115,121,115,114,13,0,0,0,114,2,0,0,0,114,29,0,
+    0,0,114,31,0,0,0,114,35,0,0,0,114,32,0,0,
+    0,218,11,76,111,111,107,117,112,69,114,114,111,114,218,11,
+    83,121,115,116,101,109,69,114,114,111,114,114,4,0,0,0,
+    114,22,0,0,0,114,43,0,0,0,90,8,114,101,103,105,
+    115,116,101,114,218,8,112,108,97,116,102,111,114,109,114,45,
+    0,0,0,114,8,0,0,0,114,8,0,0,0,114,8,0,
+    0,0,114,9,0,0,0,218,8,60,109,111,100,117,108,101,
+    62,1,0,0,0,115,28,0,0,0,4,30,8,1,8,1,
+    12,2,4,1,4,1,6,1,6,2,18,3,8,27,8,85,
+    10,2,10,1,8,11,
+};
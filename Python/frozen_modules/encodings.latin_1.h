@@ -0,0 +1,117 @@
+/* Auto-generated by Programs/_freeze_importlib.c */
+const unsigned char _Py_M__encodingslatin_1[] = {
+    99,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,
+    0,64,0,0,0,115,136,0,0,0,100,0,90,0,100,1,
+    100,2,108,1,90,1,71,0,100,3,100,4,132,0,100,4,
+    101,1,106,2,131,3,90,2,71,0,100,5,100,6,132,0,
+    100,6,101,1,106,3,131,3,90,3,71,0,100,7,100,8,
+    132,0,100,8,101,1,106,4,131,3,90,4,71,0,100,9,
+    100,10,132,0,100,10,101,2,101,1,106,5,131,4,90,5,
+    71,0,100,11,100,12,132,0,100,12,101,2,101,1,106,6,
+    131,4,90,6,71,0,100,13,100,14,132,0,100,14,101,5,
+    101,6,131,4,90,7,100,15,100,16,132,0,90,8,100,2,
+    83,0,41,17,122,131,32,80,121,116,104,111,110,32,39,108,
+    97,116,105,110,45,49,39,32,67,111,100,101,99,10,10,10,
+    87,114,105,116,116,101,110,32,98,121,32,77,97,114,99,45,
+    65,110,100,114,101,32,76,101,109,98,117,114,103,32,40,109,
+    97,108,64,108,101,109,98,117,114,103,46,99,111,109,41,46,
+    10,10,40,99,41,32,67,111,112,121,114,105,103,104,116,32,
+    67,78,82,73,44,32,65,108,108,32,82,105,103,104,116,115,
+    32,82,101,115,101,114,118,101,100,46,32,78,79,32,87,65,
+    82,82,65,78,84,89,46,10,10,233,0,0,0,0,78,99,
+    0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+    64,0,0,0,115,24,0,0,0,101,0,90,1,100,0,90,
+    2,101,3,106,4,90,5,101,3,106,6,90,7,100,1,83,
+    0,41,2,218,5,67,111,100,101,99,78,41,8,218,8,95,
+    95,110,97,109,101,95,95,218,10,95,95,109,111,100,117,108,
+    101,95,95,218,12,95,95,113,117,97,108,110,97,109,101,95,
+    95,218,6,99,111,100,101,99,115,218,14,108,97,116,105,110,
+    95,49,95,101,110,99,111,100,101,218,6,101,110,99,111,100,
+    101,218,14,108,97,116,105,110,95,49,95,100,101,99,111,100,
+    101,218,6,100,101,99,111,100,101,169,0,114,10,0,0,0,
+    114,10,0,0,0,250,26,60,102,114,111,122,101,110,32,101,
+    110,99,111,100,105,110,103,115,46,108,97,116,105,110,95,49,
+    62,114,1,0,0,0,13,0,0,0,115,4,0,0,0,8,
+    4,6,1,114,1,0,0,0,99,0,0,0,0,0,0,0,
+    0,0,0,0,0,3,0,0,0,64,0,0,0,115,22,0,
+    0,0,101,0,90,1,100,0,90,2,100,5,100,2,100,3,
+    132,1,90,3,100,4,83,0,41,6,218,18,73,110,99,114,
+    101,109,101,110,116,97,108,69,110,99,111,100,101,114,70,99,
+    3,0,0,0,0,0,0,0,3,0,0,0,4,0,0,0,
+    67,0,0,0,115,18,0,0,0,116,0,160,1,124,1,124,
+    0,106,2,161,2,100,1,25,0,83,0,169,2,78,114,0,
+    0,0,0,41,3,114,5,0,0,0,114,6,0,0,0,218,
+    6,101,114,114,111,114,115,169,3,90,4,115,101,108,102,218,
+    5,105,110,112,117,116,90,5,102,105,110,97,108,114,10,0,
+    0,0,114,10,0,0,0,114,11,0,0,0,114,7,0,0,
+    0,21,0,0,0,115,2,0,0,0,0,1,122,25,73,110,
+    99,114,101,109,101,110,116,97,108,69,110,99,111,100,101,114,
+    46,101,110,99,111,100,101,78,41,1,70,41,4,114,2,0,
+    0,0,114,3,0,0,0,114,4,0,0,0,114,7,0,0,
+    0,114,10,0,0,0,114,10,0,0,0,114,10,0,0,0,
+    114,11,0,0,0,114,12,0,0,0,20,0,0,0,115,2,
+    0,0,0,8,1,114,12,0,0,0,99,0,0,0,0,0,
+    0,0,0,0,0,0,0,3,0,0,0,64,0,0,0,115,
+    22,0,0,0,101,0,90,1,100,0,90,2,100,5,100,2,
+    100,3,132,1,90,3,100,4,83,0,41,6,218,18,73,110,
+    99,114,101,109,101,110,116,97,108,68,101,99,111,100,101,114,
+    70,99,3,0,0,0,0,0,0,0,3,0,0,0,4,0,
+    0,0,67,0,0,0,115,18,0,0,0,116,0,160,1,124,
+    1,124,0,106,2,161,2,100,1,25,0,83,0,114,13,0,
+    0,0,41,3,114,5,0,0,0,114,8,0,0,0,114,14,
+    0,0,0,114,15,0,0,0,114,10,0,0,0,114,10,0,
+    0,0,114,11,0,0,0,114,9,0,0,0,25,0,0,0,
+    115,2,0,0,0,0,1,122,25,73,110,99,114,101,109,101,
+    110,116,97,108,68,101,99,111,100,101,114,46,100,101,99,111,
+    100,101,78,41,1,70,41,4,114,2,0,0,0,114,3,0,
+    0,0,114,4,0,0,0,114,9,0,0,0,114,10,0,0,
+    0,114,10,0,0,0,114,10,0,0,0,114,11,0,0,0,
+    114,17,0,0,0,24,0,0,0,115,2,0,0,0,8,1,
+    114,17,0,0,0,99,0,0,0,0,0,0,0,0,0,0,
+    0,0,1,0,0,0,64,0,0,0,115,12,0,0,0,101,
+    0,90,1,100,0,90,2,100,1,83,0,41,2,218,12,83,
+    116,114,101,97,109,87,114,105,116,101,114,78,169,3,114,2,
+    0,0,0,114,3,0,0,0,114,4,0,0,0,114,10,0,
+    0,0,114,10,0,0,0,114,10,0,0,0,114,11,0,0,
+    0,114,18,0,0,0,28,0,0,0,115,2,0,0,0,8,
+    1,114,18,0,0,0,99,0,0,0,0,0,0,0,0,0,
+    0,0,0,1,0,0,0,64,0,0,0,115,12,0,0,0,
+    101,0,90,1,100,0,90,2,100,1,83,0,41,2,218,12,
+    83,116,114,101,97,109,82,101,97,100,101,114,78,114,19,0,
+    0,0,114,10,0,0,0,114,10,0,0,0,114,10,0,0,
+    0,114,11,0,0,0,114,20,0,0,0,31,0,0,0,115,
+    2,0,0,0,8,1,114,20,0,0,0,99,0,0,0,0,
+    0,0,0,0,0,0,0,0,1,0,0,0,64,0,0,0,
+    115,24,0,0,0,101,0,90,1,100,0,90,2,101,3,106,
+    4,90,5,101,3,106,6,90,7,100,1,83,0,41,2,218,
+    15,83,116,114,101,97,109,67,111,110,118,101,114,116,101,114,
+    78,41,8,114,2,0,0,0,114,3,0,0,0,114,4,0,
+    0,0,114,5,0,0,0,114,8,0,0,0,114,7,0,0,
+    0,114,6,0,0,0,114,9,0,0,0,114,10,0,0,0,
+    114,10,0,0,0,114,10,0,0,0,114,11,0,0,0,114,
+    21,0,0,0,34,0,0,0,115,4,0,0,0,8,2,6,
+    1,114,21,0,0,0,99,0,0,0,0,0,0,0,0,0,
+    0,0,0,9,0,0,0,67,0,0,0,115,28,0,0,0,
+    116,0,106,1,100,1,116,2,106,3,116,2,106,4,116,5,
+    116,6,116,7,116,8,100,2,141,7,83,0,41,3,78,122,
+    9,105,115,111,56,56,53,57,45,49,41,7,218,4,110,97,
+    109,101,114,7,0,0,0,114,9,0,0,0,90,18,105,110,
+    99,114,101,109,101,110,116,97,108,101,110,99,111,100,101,114,
+    90,18,105,110,99,114,101,109,101,110,116,97,108,100,101,99,
+    111,100,101,114,90,12,115,116,114,101,97,109,114,101,97,100,
+    101,114,90,12,115,116,114,101,97,109,119,114,105,116,101,114,
+    41,9,114,5,0,0,0,90,9,67,111,100,101,99,73,110,
+    102,111,114,1,0,0,0,114,7,0,0,0,114,9,0,0,
+    0,114,12,0,0,0,114,17,0,0,0,114,20,0,0,0,
+    114,18,0,0,0,114,10,0,0,0,114,10,0,0,0,114,
+    10,0,0,0,114,11,0,0,0,218,11,103,101,116,114,101,
+    103,101,110,116,114,121,41,0,0,0,115,18,0,0,0,0,
+    1,4,1,2,1,4,1,4,1,2,1,2,1,2,1,2,
+    249,114,23,0,0,0,41,9,218,7,95,95,100,111,99,95,
+    95,114,5,0,0,0,114,1,0,0,0,114,12,0,0,0,
+    114,17,0,0,0,114,18,0,0,0,114,20,0,0,0,114,
+    21,0,0,0,114,23,0,0,0,114,10,0,0,0,114,10,
+    0,0,0,114,10,0,0,0,114,11,0,0,0,218,8,60,
+    109,111,100,117,108,101,62,1,0,0,0,115,16,0,0,0,
+    4,8,8,4,18,7,18,4,18,4,20,3,20,3,18,7,
+};
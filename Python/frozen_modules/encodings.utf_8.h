@@ -0,0 +1,102 @@
+/* Auto-generated by Programs/_freeze_importlib.c */
+const unsigned char _Py_M__encodingsutf_8[] = {
+    99,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,
+    0,64,0,0,0,115,112,0,0,0,100,0,90,0,100,1,
+    100,2,108,1,90,1,101,1,106,2,90,3,100,16,100,4,
+    100,5,132,1,90,4,71,0,100,6,100,7,132,0,100,7,
+    101,1,106,5,131,3,90,5,71,0,100,8,100,9,132,0,
+    100,9,101,1,106,6,131,3,90,7,71,0,100,10,100,11,
+    132,0,100,11,101,1,106,8,131,3,90,8,71,0,100,12,
+    100,13,132,0,100,13,101,1,106,9,131,3,90,9,100,14,
+    100,15,132,0,90,10,100,2,83,0,41,17,122,129,32,80,
+    121,116,104,111,110,32,39,117,116,102,45,56,39,32,67,111,
+    100,101,99,10,10,10,87,114,105,116,116,101,110,32,98,121,
+    32,77,97,114,99,45,65,110,100,114,101,32,76,101,109,98,
+    117,114,103,32,40,109,97,108,64,108,101,109,98,117,114,103,
+    46,99,111,109,41,46,10,10,40,99,41,32,67,111,112,121,
+    114,105,103,104,116,32,67,78,82,73,44,32,65,108,108,32,
+    82,105,103,104,116,115,32,82,101,115,101,114,118,101,100,46,
+    32,78,79,32,87,65,82,82,65,78,84,89,46,10,10,233,
+    0,0,0,0,78,218,6,115,116,114,105,99,116,99,2,0,
+    0,0,0,0,0,0,2,0,0,0,5,0,0,0,67,0,
+    0,0,115,14,0,0,0,116,0,160,1,124,0,124,1,100,
+    1,161,3,83,0,41,2,78,84,41,2,218,6,99,111,100,
+    101,99,115,218,12,117,116,102,95,56,95,100,101,99,111,100,
+    101,41,2,218,5,105,110,112,117,116,218,6,101,114,114,111,
+    114,115,169,0,114,6,0,0,0,250,24,60,102,114,111,122,
+    101,110,32,101,110,99,111,100,105,110,103,115,46,117,116,102,
+    95,56,62,218,6,100,101,99,111,100,101,15,0,0,0,115,
+    2,0,0,0,0,1,114,8,0,0,0,99,0,0,0,0,
+    0,0,0,0,0,0,0,0,3,0,0,0,64,0,0,0,
+    115,22,0,0,0,101,0,90,1,100,0,90,2,100,5,100,
+    2,100,3,132,1,90,3,100,4,83,0,41,6,218,18,73,
+    110,99,114,101,109,101,110,116,97,108,69,110,99,111,100,101,
+    114,70,99,3,0,0,0,0,0,0,0,3,0,0,0,4,
+    0,0,0,67,0,0,0,115,18,0,0,0,116,0,160,1,
+    124,1,124,0,106,2,161,2,100,1,25,0,83,0,41,2,
+    78,114,0,0,0,0,41,3,114,2,0,0,0,218,12,117,
+    116,102,95,56,95,101,110,99,111,100,101,114,5,0,0,0,
+    41,3,90,4,115,101,108,102,114,4,0,0,0,90,5,102,
+    105,110,97,108,114,6,0,0,0,114,6,0,0,0,114,7,
+    0,0,0,218,6,101,110,99,111,100,101,19,0,0,0,115,
+    2,0,0,0,0,1,122,25,73,110,99,114,101,109,101,110,
+    116,97,108,69,110,99,111,100,101,114,46,101,110,99,111,100,
+    101,78,41,1,70,41,4,218,8,95,95,110,97,109,101,95,
+    95,218,10,95,95,109,111,100,117,108,101,95,95,218,12,95,
+    95,113,117,97,108,110,97,109,101,95,95,114,11,0,0,0,
+    114,6,0,0,0,114,6,0,0,0,114,6,0,0,0,114,
+    7,0,0,0,114,9,0,0,0,18,0,0,0,115,2,0,
+    0,0,8,1,114,9,0,0,0,99,0,0,0,0,0,0,
+    0,0,0,0,0,0,1,0,0,0,64,0,0,0,115,18,
+    0,0,0,101,0,90,1,100,0,90,2,101,3,106,4,90,
+    5,100,1,83,0,41,2,218,18,73,110,99,114,101,109,101,
+    110,116,97,108,68,101,99,111,100,101,114,78,41,6,114,12,
+    0,0,0,114,13,0,0,0,114,14,0,0,0,114,2,0,
+    0,0,114,3,0,0,0,90,14,95,98,117,102,102,101,114,
+    95,100,101,99,111,100,101,114,6,0,0,0,114,6,0,0,
+    0,114,6,0,0,0,114,7,0,0,0,114,15,0,0,0,
+    22,0,0,0,115,2,0,0,0,8,1,114,15,0,0,0,
+    99,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
+    0,64,0,0,0,115,18,0,0,0,101,0,90,1,100,0,
+    90,2,101,3,106,4,90,5,100,1,83,0,41,2,218,12,
+    83,116,114,101,97,109,87,114,105,116,101,114,78,41,6,114,
+    12,0,0,0,114,13,0,0,0,114,14,0,0,0,114,2,
+    0,0,0,114,10,0,0,0,114,11,0,0,0,114,6,0,
+    0,0,114,6,0,0,0,114,6,0,0,0,114,7,0,0,
+    0,114,16,0,0,0,25,0,0,0,115,2,0,0,0,8,
+    1,114,16,0,0,0,99,0,0,0,0,0,0,0,0,0,
+    0,0,0,1,0,0,0,64,0,0,0,115,18,0,0,0,
+    101,0,90,1,100,0,90,2,101,3,106,4,90,5,100,1,
+    83,0,41,2,218,12,83,116,114,101,97,109,82,101,97,100,
+    101,114,78,41,6,114,12,0,0,0,114,13,0,0,0,114,
+    14,0,0,0,114,2,0,0,0,114,3,0,0,0,114,8,
+    0,0,0,114,6,0,0,0,114,6,0,0,0,114,6,0,
+    0,0,114,7,0,0,0,114,17,0,0,0,28,0,0,0,
+    115,2,0,0,0,8,1,114,17,0,0,0,99,0,0,0,
+    0,0,0,0,0,0,0,0,0,9,0,0,0,67,0,0,
+    0,115,24,0,0,0,116,0,106,1,100,1,116,2,116,3,
+    116,4,116,5,116,6,116,7,100,2,141,7,83,0,41,3,
+    78,122,5,117,116,102,45,56,41,7,218,4,110,97,109,101,
+    114,11,0,0,0,114,8,0,0,0,90,18,105,110,99,114,
+    101,109,101,110,116,97,108,101,110,99,111,100,101,114,90,18,
+    105,110,99,114,101,109,101,110,116,97,108,100,101,99,111,100,
+    101,114,90,12,115,116,114,101,97,109,114,101,97,100,101,114,
+    90,12,115,116,114,101,97,109,119,114,105,116,101,114,41,8,
+    114,2,0,0,0,90,9,67,111,100,101,99,73,110,102,111,
+    114,11,0,0,0,114,8,0,0,0,114,9,0,0,0,114,
+    15,0,0,0,114,17,0,0,0,114,16,0,0,0,114,6,
+    0,0,0,114,6,0,0,0,114,6,0,0,0,114,7,0,
+    0,0,218,11,103,101,116,114,101,103,101,110,116,114,121,33,
+    0,0,0,115,18,0,0,0,0,1,4,1,2,1,2,1,
+    2,1,2,1,2,1,2,1,2,249,114,19,0,0,0,41,
+    1,114,1,0,0,0,41,11,218,7,95,95,100,111,99,95,
+    95,114,2,0,0,0,114,10,0,0,0,114,11,0,0,0,
+    114,8,0,0,0,114,9,0,0,0,90,26,66,117,102,102,
+    101,114,101,100,73,110,99,114,101,109,101,110,116,97,108,68,
+    101,99,111,100,101,114,114,15,0,0,0,114,16,0,0,0,
+    114,17,0,0,0,114,19,0,0,0,114,6,0,0,0,114,
+    6,0,0,0,114,6,0,0,0,114,7,0,0,0,218,8,
+    60,109,111,100,117,108,101,62,1,0,0,0,115,16,0,0,
+    0,4,8,8,4,6,2,10,3,18,4,18,3,18,3,18,
+    5,
+};
@@ -0,0 +1,238 @@
+/* Auto-generated by Programs/_freeze_importlib.c */
+const unsigned char _Py_M__genericpath[] = {
+    99,0,0,0,0,0,0,0,0,0,0,0,0,11,0,0,
+    0,64,0,0,0,115,154,0,0,0,100,0,90,0,100,1,
+    100,2,108,1,90,1,100,1,100,2,108,2,90,2,100,3,
+    100,4,100,5,100,6,100,7,100,8,100,9,100,10,100,11,
+    100,12,100,13,103,11,90,3,100,14,100,4,132,0,90,4,
+    100,15,100,10,132,0,90,5,100,16,100,9,132,0,90,6,
+    100,17,100,8,132,0,90,7,100,18,100,7,132,0,90,8,
+    100,19,100,5,132,0,90,9,100,20,100,6,132,0,90,10,
+    100,21,100,3,132,0,90,11,100,22,100,13,132,0,90,12,
+    100,23,100,11,132,0,90,13,100,24,100,12,132,0,90,14,
+    100,25,100,26,132,0,90,15,100,27,100,28,132,0,90,16,
+    100,2,83,0,41,29,122,152,10,80,97,116,104,32,111,112,
+    101,114,97,116,105,111,110,115,32,99,111,109,109,111,110,32,
+    116,111,32,109,111,114,101,32,116,104,97,110,32,111,110,101,
+    32,79,83,10,68,111,32,110,111,116,32,117,115,101,32,100,
+    105,114,101,99,116,108,121,46,32,32,84,104,101,32,79,83,
+    32,115,112,101,99,105,102,105,99,32,109,111,100,117,108,101,
+    115,32,105,109,112,111,114,116,32,116,104,101,32,97,112,112,
+    114,111,112,114,105,97,116,101,10,102,117,110,99,116,105,111,
+    110,115,32,102,114,111,109,32,116,104,105,115,32,109,111,100,
+    117,108,101,32,116,104,101,109,115,101,108,118,101,115,46,10,
+    233,0,0,0,0,78,218,12,99,111,109,109,111,110,112,114,
+    101,102,105,120,218,6,101,120,105,115,116,115,218,8,103,101,
+    116,97,116,105,109,101,218,8,103,101,116,99,116,105,109,101,
+    218,8,103,101,116,109,116,105,109,101,218,7,103,101,116,115,
+    105,122,101,218,5,105,115,100,105,114,218,6,105,115,102,105,
+    108,101,218,8,115,97,109,101,102,105,108,101,218,12,115,97,
+    109,101,111,112,101,110,102,105,108,101,218,8,115,97,109,101,
+    115,116,97,116,99,1,0,0,0,0,0,0,0,1,0,0,
+    0,9,0,0,0,67,0,0,0,115,46,0,0,0,122,14,
+    116,0,160,1,124,0,161,1,1,0,87,0,110,26,4,0,
+    116,2,116,3,102,2,107,10,114,40,1,0,1,0,1,0,
+    89,0,100,1,83,0,88,0,100,2,83,0,41,3,122,68,
+    84,101,115,116,32,119,104,101,116,104,101,114,32,97,32,112,
+    97,116,104,32,101,120,105,115,116,115,46,32,32,82,101,116,
+    117,114,110,115,32,70,97,108,115,101,32,102,111,114,32,98,
+    114,111,107,101,110,32,115,121,109,98,111,108,105,99,32,108,
+    105,110,107,115,70,84,41,4,218,2,111,115,218,4,115,116,
+    97,116,218,7,79,83,69,114,114,111,114,218,10,86,97,108,
+    117,101,69,114,114,111,114,41,1,218,4,112,97,116,104,169,
+    0,114,17,0,0,0,250,20,60,102,114,111,122,101,110,32,
+    103,101,110,101,114,105,99,112,97,116,104,62,114,2,0,0,
+    0,16,0,0,0,115,10,0,0,0,0,2,2,1,14,1,
+    18,1,8,1,99,1,0,0,0,0,0,0,0,2,0,0,
+    0,9,0,0,0,67,0,0,0,115,54,0,0,0,122,14,
+    116,0,160,1,124,0,161,1,125,1,87,0,110,26,4,0,
+    116,2,116,3,102,2,107,10,114,40,1,0,1,0,1,0,
+    89,0,100,1,83,0,88,0,116,1,160,4,124,1,106,5,
+    161,1,83,0,41,2,122,37,84,101,115,116,32,119,104,101,
+    116,104,101,114,32,97,32,112,97,116,104,32,105,115,32,97,
+    32,114,101,103,117,108,97,114,32,102,105,108,101,70,41,6,
+    114,12,0,0,0,114,13,0,0,0,114,14,0,0,0,114,
+    15,0,0,0,90,7,83,95,73,83,82,69,71,218,7,115,
+    116,95,109,111,100,101,41,2,114,16,0,0,0,218,2,115,
+    116,114,17,0,0,0,114,17,0,0,0,114,18,0,0,0,
+    114,8,0,0,0,27,0,0,0,115,10,0,0,0,0,2,
+    2,1,14,1,18,1,8,1,99,1,0,0,0,0,0,0,
+    0,2,0,0,0,9,0,0,0,67,0,0,0,115,54,0,
+    0,0,122,14,116,0,160,1,124,0,161,1,125,1,87,0,
+    110,26,4,0,116,2,116,3,102,2,107,10,114,40,1,0,
+    1,0,1,0,89,0,100,1,83,0,88,0,116,1,160,4,
+    124,1,106,5,161,1,83,0,41,2,122,60,82,101,116,117,
+    114,110,32,116,114,117,101,32,105,102,32,116,104,101,32,112,
+    97,116,104,110,97,109,101,32,114,101,102,101,114,115,32,116,
+    111,32,97,110,32,101,120,105,115,116,105,110,103,32,100,105,
+    114,101,99,116,111,114,121,46,70,41,6,114,12,0,0,0,
+    114,13,0,0,0,114,14,0,0,0,114,15,0,0,0,90,
+    7,83,95,73,83,68,73,82,114,19,0,0,0,41,2,218,
+    1,115,114,20,0,0,0,114,17,0,0,0,114,17,0,0,
+    0,114,18,0,0,0,114,7,0,0,0,39,0,0,0,115,
+    10,0,0,0,0,2,2,1,14,1,18,1,8,1,99,1,
+    0,0,0,0,0,0,0,1,0,0,0,3,0,0,0,67,
+    0,0,0,115,12,0,0,0,116,0,160,1,124,0,161,1,
+    106,2,83,0,41,1,122,49,82,101,116,117,114,110,32,116,
+    104,101,32,115,105,122,101,32,111,102,32,97,32,102,105,108,
+    101,44,32,114,101,112,111,114,116,101,100,32,98,121,32,111,
+    115,46,115,116,97,116,40,41,46,41,3,114,12,0,0,0,
+    114,13,0,0,0,90,7,115,116,95,115,105,122,101,169,1,
+    218,8,102,105,108,101,110,97,109,101,114,17,0,0,0,114,
+    17,0,0,0,114,18,0,0,0,114,6,0,0,0,48,0,
+    0,0,115,2,0,0,0,0,2,99,1,0,0,0,0,0,
+    0,0,1,0,0,0,3,0,0,0,67,0,0,0,115,12,
+    0,0,0,116,0,160,1,124,0,161,1,106,2,83,0,41,
+    1,122,67,82,101,116,117,114,110,32,116,104,101,32,108,97,
+    115,116,32,109,111,100,105,102,105,99,97,116,105,111,110,32,
+    116,105,109,101,32,111,102,32,97,32,102,105,108,101,44,32,
+    114,101,112,111,114,116,101,100,32,98,121,32,111,115,46,115,
+    116,97,116,40,41,46,41,3,114,12,0,0,0,114,13,0,
+    0,0,90,8,115,116,95,109,116,105,109,101,114,22,0,0,
+    0,114,17,0,0,0,114,17,0,0,0,114,18,0,0,0,
+    114,5,0,0,0,53,0,0,0,115,2,0,0,0,0,2,
+    99,1,0,0,0,0,0,0,0,1,0,0,0,3,0,0,
+    0,67,0,0,0,115,12,0,0,0,116,0,160,1,124,0,
+    161,1,106,2,83,0,41,1,122,61,82,101,116,117,114,110,
+    32,116,104,101,32,108,97,115,116,32,97,99,99,101,115,115,
+    32,116,105,109,101,32,111,102,32,97,32,102,105,108,101,44,
+    32,114,101,112,111,114,116,101,100,32,98,121,32,111,115,46,
+    115,116,97,116,40,41,46,41,3,114,12,0,0,0,114,13,
+    0,0,0,90,8,115,116,95,97,116,105,109,101,114,22,0,
+    0,0,114,17,0,0,0,114,17,0,0,0,114,18,0,0,
+    0,114,3,0,0,0,58,0,0,0,115,2,0,0,0,0,
+    2,99,1,0,0,0,0,0,0,0,1,0,0,0,3,0,
+    0,0,67,0,0,0,115,12,0,0,0,116,0,160,1,124,
+    0,161,1,106,2,83,0,41,1,122,65,82,101,116,117,114,
+    110,32,116,104,101,32,109,101,116,97,100,97,116,97,32,99,
+    104,97,110,103,101,32,116,105,109,101,32,111,102,32,97,32,
+    102,105,108,101,44,32,114,101,112,111,114,116,101,100,32,98,
+    121,32,111,115,46,115,116,97,116,40,41,46,41,3,114,12,
+    0,0,0,114,13,0,0,0,90,8,115,116,95,99,116,105,
+    109,101,114,22,0,0,0,114,17,0,0,0,114,17,0,0,
+    0,114,18,0,0,0,114,4,0,0,0,63,0,0,0,115,
+    2,0,0,0,0,2,99,1,0,0,0,0,0,0,0,5,
+    0,0,0,4,0,0,0,67,0,0,0,115,108,0,0,0,
+    124,0,115,8,100,1,83,0,116,0,124,0,100,2,25,0,
+    116,1,116,2,102,2,131,2,115,42,116,2,116,3,116,4,
+    106,5,124,0,131,2,131,1,125,0,116,6,124,0,131,1,
+    125,1,116,7,124,0,131,1,125,2,116,8,124,1,131,1,
+    68,0,93,36,92,2,125,3,125,4,124,4,124,2,124,3,
+    25,0,107,3,114,66,124,1,100,3,124,3,133,2,25,0,
+    2,0,1,0,83,0,113,66,124,1,83,0,41,4,122,71,
+    71,105,118,101,110,32,97,32,108,105,115,116,32,111,102,32,
+    112,97,116,104,110,97,109,101,115,44,32,114,101,116,117,114,
+    110,115,32,116,104,101,32,108,111,110,103,101,115,116,32,99,
+    111,109,109,111,110,32,108,101,97,100,105,110,103,32,99,111,
+    109,112,111,110,101,110,116,218,0,114,0,0,0,0,78,41,
+    9,218,10,105,115,105,110,115,116,97,110,99,101,218,4,108,
+    105,115,116,218,5,116,117,112,108,101,218,3,109,97,112,114,
+    12,0,0,0,90,6,102,115,112,97,116,104,218,3,109,105,
+    110,218,3,109,97,120,218,9,101,110,117,109,101,114,97,116,
+    101,41,5,218,1,109,218,2,115,49,218,2,115,50,218,1,
+    105,218,1,99,114,17,0,0,0,114,17,0,0,0,114,18,
+    0,0,0,114,1,0,0,0,69,0,0,0,115,20,0,0,
+    0,0,2,4,0,4,5,18,1,16,1,8,1,8,1,16,
+    1,12,1,18,1,99,2,0,0,0,0,0,0,0,2,0,
+    0,0,2,0,0,0,67,0,0,0,115,24,0,0,0,124,
+    0,106,0,124,1,106,0,107,2,111,22,124,0,106,1,124,
+    1,106,1,107,2,83,0,41,1,122,53,84,101,115,116,32,
+    119,104,101,116,104,101,114,32,116,119,111,32,115,116,97,116,
+    32,98,117,102,102,101,114,115,32,114,101,102,101,114,101,110,
+    99,101,32,116,104,101,32,115,97,109,101,32,102,105,108,101,
+    41,2,90,6,115,116,95,105,110,111,90,6,115,116,95,100,
+    101,118,41,2,114,33,0,0,0,114,34,0,0,0,114,17,
+    0,0,0,114,17,0,0,0,114,18,0,0,0,114,11,0,
+    0,0,87,0,0,0,115,6,0,0,0,0,2,12,1,10,
+    255,99,2,0,0,0,0,0,0,0,4,0,0,0,3,0,
+    0,0,67,0,0,0,115,30,0,0,0,116,0,160,1,124,
+    0,161,1,125,2,116,0,160,1,124,1,161,1,125,3,116,
+    2,124,2,124,3,131,2,83,0,41,1,122,57,84,101,115,
+    116,32,119,104,101,116,104,101,114,32,116,119,111,32,112,97,
+    116,104,110,97,109,101,115,32,114,101,102,101,114,101,110,99,
+    101,32,116,104,101,32,115,97,109,101,32,97,99,116,117,97,
+    108,32,102,105,108,101,41,3,114,12,0,0,0,114,13,0,
+    0,0,114,11,0,0,0,41,4,90,2,102,49,90,2,102,
+    50,114,33,0,0,0,114,34,0,0,0,114,17,0,0,0,
+    114,17,0,0,0,114,18,0,0,0,114,9,0,0,0,94,
+    0,0,0,115,6,0,0,0,0,2,10,1,10,1,99,2,
+    0,0,0,0,0,0,0,4,0,0,0,3,0,0,0,67,
+    0,0,0,115,30,0,0,0,116,0,160,1,124,0,161,1,
+    125,2,116,0,160,1,124,1,161,1,125,3,116,2,124,2,
+    124,3,131,2,83,0,41,1,122,58,84,101,115,116,32,119,
+    104,101,116,104,101,114,32,116,119,111,32,111,112,101,110,32,
+    102,105,108,101,32,111,98,106,101,99,116,115,32,114,101,102,
+    101,114,101,110,99,101,32,116,104,101,32,115,97,109,101,32,
+    102,105,108,101,41,3,114,12,0,0,0,90,5,102,115,116,
+    97,116,114,11,0,0,0,41,4,90,3,102,112,49,90,3,
+    102,112,50,114,33,0,0,0,114,34,0,0,0,114,17,0,
+    0,0,114,17,0,0,0,114,18,0,0,0,114,10,0,0,
+    0,103,0,0,0,115,6,0,0,0,0,2,10,1,10,1,
+    99,4,0,0,0,0,0,0,0,8,0,0,0,4,0,0,
+    0,67,0,0,0,115,138,0,0,0,124,0,160,0,124,1,
+    161,1,125,4,124,2,114,34,124,0,160,0,124,2,161,1,
+    125,5,116,1,124,4,124,5,131,2,125,4,124,0,160,0,
+    124,3,161,1,125,6,124,6,124,4,107,4,114,122,124,4,
+    100,1,23,0,125,7,124,7,124,6,107,0,114,122,124,0,
+    124,7,124,7,100,1,23,0,133,2,25,0,124,3,107,3,
+    114,112,124,0,100,2,124,6,133,2,25,0,124,0,124,6,
+    100,2,133,2,25,0,102,2,83,0,124,7,100,1,55,0,
+    125,7,113,60,124,0,124,0,100,2,100,3,133,2,25,0,
+    102,2,83,0,41,4,122,164,83,112,108,105,116,32,116,104,
+    101,32,101,120,116,101,110,115,105,111,110,32,102,114,111,109,
+    32,97,32,112,97,116,104,110,97,109,101,46,10,10,32,32,
+    32,32,69,120,116,101,110,115,105,111,110,32,105,115,32,101,
+    118,101,114,121,116,104,105,110,103,32,102,114,111,109,32,116,
+    104,101,32,108,97,115,116,32,100,111,116,32,116,111,32,116,
+    104,101,32,101,110,100,44,32,105,103,110,111,114,105,110,103,
+    10,32,32,32,32,108,101,97,100,105,110,103,32,100,111,116,
+    115,46,32,32,82,101,116,117,114,110,115,32,34,40,114,111,
+    111,116,44,32,101,120,116,41,34,59,32,101,120,116,32,109,
+    97,121,32,98,101,32,101,109,112,116,121,46,233,1,0,0,
+    0,78,114,0,0,0,0,41,2,218,5,114,102,105,110,100,
+    114,30,0,0,0,41,8,218,1,112,90,3,115,101,112,90,
+    6,97,108,116,115,101,112,90,6,101,120,116,115,101,112,90,
+    8,115,101,112,73,110,100,101,120,90,11,97,108,116,115,101,
+    112,73,110,100,101,120,90,8,100,111,116,73,110,100,101,120,
+    90,13,102,105,108,101,110,97,109,101,73,110,100,101,120,114,
+    17,0,0,0,114,17,0,0,0,114,18,0,0,0,218,9,
+    95,115,112,108,105,116,101,120,116,117,0,0,0,115,24,0,
+    0,0,0,7,10,1,4,1,10,1,10,2,10,1,8,2,
+    8,1,8,1,20,1,24,1,10,2,114,40,0,0,0,99,
+    1,0,0,0,0,0,0,0,5,0,0,0,5,0,0,0,
+    71,0,0,0,115,94,0,0,0,100,1,4,0,125,2,125,
+    3,124,1,68,0,93,58,125,4,116,0,124,4,116,1,131,
+    2,114,32,100,2,125,2,110,38,116,0,124,4,116,2,131,
+    2,114,48,100,2,125,3,110,22,116,3,100,3,124,0,124,
+    4,106,4,106,5,102,2,22,0,131,1,100,0,130,2,113,
+    12,124,2,114,90,124,3,114,90,116,3,100,4,131,1,100,
+    0,130,2,100,0,83,0,41,5,78,70,84,122,42,37,115,
+    40,41,32,97,114,103,117,109,101,110,116,32,109,117,115,116,
+    32,98,101,32,115,116,114,32,111,114,32,98,121,116,101,115,
+    44,32,110,111,116,32,37,114,122,46,67,97,110,39,116,32,
+    109,105,120,32,115,116,114,105,110,103,115,32,97,110,100,32,
+    98,121,116,101,115,32,105,110,32,112,97,116,104,32,99,111,
+    109,112,111,110,101,110,116,115,41,6,114,25,0,0,0,218,
+    3,115,116,114,218,5,98,121,116,101,115,218,9,84,121,112,
+    101,69,114,114,111,114,218,9,95,95,99,108,97,115,115,95,
+    95,218,8,95,95,110,97,109,101,95,95,41,5,90,8,102,
+    117,110,99,110,97,109,101,218,4,97,114,103,115,90,6,104,
+    97,115,115,116,114,90,8,104,97,115,98,121,116,101,115,114,
+    21,0,0,0,114,17,0,0,0,114,17,0,0,0,114,18,
+    0,0,0,218,16,95,99,104,101,99,107,95,97,114,103,95,
+    116,121,112,101,115,140,0,0,0,115,26,0,0,0,0,1,
+    8,1,8,1,10,1,6,1,10,1,6,2,4,1,10,255,
+    4,1,2,255,4,2,8,1,114,47,0,0,0,41,17,218,
+    7,95,95,100,111,99,95,95,114,12,0,0,0,114,13,0,
+    0,0,90,7,95,95,97,108,108,95,95,114,2,0,0,0,
+    114,8,0,0,0,114,7,0,0,0,114,6,0,0,0,114,
+    5,0,0,0,114,3,0,0,0,114,4,0,0,0,114,1,
+    0,0,0,114,11,0,0,0,114,9,0,0,0,114,10,0,
+    0,0,114,40,0,0,0,114,47,0,0,0,114,17,0,0,
+    0,114,17,0,0,0,114,17,0,0,0,114,18,0,0,0,
+    218,8,60,109,111,100,117,108,101,62,1,0,0,0,115,46,
+    0,0,0,4,5,8,1,8,2,10,1,2,0,2,0,2,
+    0,2,0,2,1,2,254,4,7,8,11,8,12,8,9,8,
+    5,8,5,8,5,8,6,8,18,8,7,8,9,8,14,8,
+    23,
+};
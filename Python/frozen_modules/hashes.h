@@ -0,0 +1,21 @@
+/* Auto-generated by Tools/scripts/generate_frozen_hashes.py */
+
+/* The _imp.source_hash(0, source) of the source of each module in
+   Python/frozen_stdlib.c, with "\r\n" newlines read as "\n".  A frozen
+   copy is only used if the source it was made from is unchanged. */
+
+#define _Py_H___collections_abc "\x09\xd9\x67\x86\xae\xce\xa1\xf6"
+#define _Py_H___sitebuiltins "\x8d\x82\x61\x1e\x8b\x2d\xa3\xe0"
+#define _Py_H__abc "\xf8\x40\x72\xe2\x29\x9a\x57\x7a"
+#define _Py_H__codecs "\x67\xb0\x15\x6c\x6f\x03\xa8\x70"
+#define _Py_H__encodings "\xfb\xa1\x69\x37\x6b\x50\xa0\x9d"
+#define _Py_H__encodingsaliases "\x9a\xb7\xfe\x3e\x91\xc2\xdf\x55"
+#define _Py_H__encodingslatin_1 "\x39\x6d\xc2\xfa\x47\xc4\x53\x68"
+#define _Py_H__encodingsutf_8 "\xe0\x19\x3e\xbd\x2f\x15\x66\xe1"
+#define _Py_H__genericpath "\x55\x3d\x72\xe0\xb6\x1b\x45\x38"
+#define _Py_H__io "\x60\x42\xc6\x9b\x63\x2f\x18\xae"
+#define _Py_H__ntpath "\xe5\x77\xab\x49\xb1\x01\xfa\xae"
+#define _Py_H__os "\x57\x13\xa2\x5d\x35\x97\xf6\x51"
+#define _Py_H__posixpath "\x99\x3b\xfb\x52\x70\x3e\x2e\x24"
+#define _Py_H__site "\x8c\x4b\x71\x66\xf4\x94\x2a\xaf"
+#define _Py_H__stat "\xfc\xfe\x79\xe9\x8f\x3e\x45\xf8"
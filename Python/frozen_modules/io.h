@@ -0,0 +1,214 @@
+/* Auto-generated by Programs/_freeze_importlib.c */
+const unsigned char _Py_M__io[] = {
+    99,0,0,0,0,0,0,0,0,0,0,0,0,18,0,0,
+    0,64,0,0,0,115,100,1,0,0,100,0,90,0,100,1,
+    90,1,100,2,100,3,100,4,100,5,100,6,100,7,100,8,
+    100,9,100,10,100,11,100,12,100,13,100,14,100,15,100,16,
+    100,17,100,18,100,19,103,18,90,2,100,20,100,21,108,3,
+    90,3,100,20,100,21,108,4,90,4,100,20,100,22,108,3,
+    109,5,90,5,109,6,90,6,109,7,90,7,109,8,90,8,
+    109,9,90,9,109,10,90,10,109,11,90,11,109,12,90,12,
+    109,13,90,13,109,14,90,14,109,15,90,15,109,16,90,16,
+    109,17,90,17,1,0,101,3,106,8,90,18,100,23,101,7,
+    95,19,100,20,90,20,100,24,90,21,100,25,90,22,71,0,
+    100,26,100,4,132,0,100,4,101,3,106,23,101,4,106,24,
+    100,27,141,4,90,25,71,0,100,28,100,5,132,0,100,5,
+    101,3,106,26,101,25,131,4,90,27,71,0,100,29,100,9,
+    132,0,100,9,101,3,106,28,101,25,131,4,90,29,71,0,
+    100,30,100,14,132,0,100,14,101,3,106,30,101,25,131,4,
+    90,31,101,27,160,32,101,9,161,1,1,0,101,10,101,12,
+    101,13,101,15,101,14,102,5,68,0,93,16,90,33,101,29,
+    160,32,101,33,161,1,1,0,144,1,113,0,101,11,101,17,
+    102,2,68,0,93,16,90,33,101,31,160,32,101,33,161,1,
+    1,0,144,1,113,26,91,33,122,16,100,20,100,31,108,3,
+    109,34,90,34,1,0,87,0,110,22,4,0,101,35,107,10,
+    144,1,114,84,1,0,1,0,1,0,89,0,110,12,88,0,
+    101,27,160,32,101,34,161,1,1,0,100,21,83,0,41,32,
+    97,193,5,0,0,84,104,101,32,105,111,32,109,111,100,117,
+    108,101,32,112,114,111,118,105,100,101,115,32,116,104,101,32,
+    80,121,116,104,111,110,32,105,110,116,101,114,102,97,99,101,
+    115,32,116,111,32,115,116,114,101,97,109,32,104,97,110,100,
+    108,105,110,103,46,32,84,104,101,10,98,117,105,108,116,105,
+    110,32,111,112,101,110,32,102,117,110,99,116,105,111,110,32,
+    105,115,32,100,101,102,105,110,101,100,32,105,110,32,116,104,
+    105,115,32,109,111,100,117,108,101,46,10,10,65,116,32,116,
+    104,101,32,116,111,112,32,111,102,32,116,104,101,32,73,47,
+    79,32,104,105,101,114,97,114,99,104,121,32,105,115,32,116,
+    104,101,32,97,98,115,116,114,97,99,116,32,98,97,115,101,
+    32,99,108,97,115,115,32,73,79,66,97,115,101,46,32,73,
+    116,10,100,101,102,105,110,101,115,32,116,104,101,32,98,97,
+    115,105,99,32,105,110,116,101,114,102,97,99,101,32,116,111,
+    32,97,32,115,116,114,101,97,109,46,32,78,111,116,101,44,
+    32,104,111,119,101,118,101,114,44,32,116,104,97,116,32,116,
+    104,101,114,101,32,105,115,32,110,111,10,115,101,112,97,114,
+    97,116,105,111,110,32,98,101,116,119,101,101,110,32,114,101,
+    97,100,105,110,103,32,97,110,100,32,119,114,105,116,105,110,
+    103,32,116,111,32,115,116,114,101,97,109,115,59,32,105,109,
+    112,108,101,109,101,110,116,97,116,105,111,110,115,32,97,114,
+    101,10,97,108,108,111,119,101,100,32,116,111,32,114,97,105,
+    115,101,32,97,110,32,79,83,69,114,114,111,114,32,105,102,
+    32,116,104,101,121,32,100,111,32,110,111,116,32,115,117,112,
+    112,111,114,116,32,97,32,103,105,118,101,110,32,111,112,101,
+    114,97,116,105,111,110,46,10,10,69,120,116,101,110,100,105,
+    110,103,32,73,79,66,97,115,101,32,105,115,32,82,97,119,
+    73,79,66,97,115,101,32,119,104,105,99,104,32,100,101,97,
+    108,115,32,115,105,109,112,108,121,32,119,105,116,104,32,116,
+    104,101,32,114,101,97,100,105,110,103,32,97,110,100,10,119,
+    114,105,116,105,110,103,32,111,102,32,114,97,119,32,98,121,
+    116,101,115,32,116,111,32,97,32,115,116,114,101,97,109,46,
+    32,70,105,108,101,73,79,32,115,117,98,99,108,97,115,115,
+    101,115,32,82,97,119,73,79,66,97,115,101,32,116,111,32,
+    112,114,111,118,105,100,101,10,97,110,32,105,110,116,101,114,
+    102,97,99,101,32,116,111,32,79,83,32,102,105,108,101,115,
+    46,10,10,66,117,102,102,101,114,101,100,73,79,66,97,115,
+    101,32,100,101,97,108,115,32,119,105,116,104,32,98,117,102,
+    102,101,114,105,110,103,32,111,110,32,97,32,114,97,119,32,
+    98,121,116,101,32,115,116,114,101,97,109,32,40,82,97,119,
+    73,79,66,97,115,101,41,46,32,73,116,115,10,115,117,98,
+    99,108,97,115,115,101,115,44,32,66,117,102,102,101,114,101,
+    100,87,114,105,116,101,114,44,32,66,117,102,102,101,114,101,
+    100,82,101,97,100,101,114,44,32,97,110,100,32,66,117,102,
+    102,101,114,101,100,82,87,80,97,105,114,32,98,117,102,102,
+    101,114,10,115,116,114,101,97,109,115,32,116,104,97,116,32,
+    97,114,101,32,114,101,97,100,97,98,108,101,44,32,119,114,
+    105,116,97,98,108,101,44,32,97,110,100,32,98,111,116,104,
+    32,114,101,115,112,101,99,116,105,118,101,108,121,46,10,66,
+    117,102,102,101,114,101,100,82,97,110,100,111,109,32,112,114,
+    111,118,105,100,101,115,32,97,32,98,117,102,102,101,114,101,
+    100,32,105,110,116,101,114,102,97,99,101,32,116,111,32,114,
+    97,110,100,111,109,32,97,99,99,101,115,115,10,115,116,114,
+    101,97,109,115,46,32,66,121,116,101,115,73,79,32,105,115,
+    32,97,32,115,105,109,112,108,101,32,115,116,114,101,97,109,
+    32,111,102,32,105,110,45,109,101,109,111,114,121,32,98,121,
+    116,101,115,46,10,10,65,110,111,116,104,101,114,32,73,79,
+    66,97,115,101,32,115,117,98,99,108,97,115,115,44,32,84,
+    101,120,116,73,79,66,97,115,101,44,32,100,101,97,108,115,
+    32,119,105,116,104,32,116,104,101,32,101,110,99,111,100,105,
+    110,103,32,97,110,100,32,100,101,99,111,100,105,110,103,10,
+    111,102,32,115,116,114,101,97,109,115,32,105,110,116,111,32,
+    116,101,120,116,46,32,84,101,120,116,73,79,87,114,97,112,
+    112,101,114,44,32,119,104,105,99,104,32,101,120,116,101,110,
+    100,115,32,105,116,44,32,105,115,32,97,32,98,117,102,102,
+    101,114,101,100,32,116,101,120,116,10,105,110,116,101,114,102,
+    97,99,101,32,116,111,32,97,32,98,117,102,102,101,114,101,
+    100,32,114,97,119,32,115,116,114,101,97,109,32,40,96,66,
+    117,102,102,101,114,101,100,73,79,66,97,115,101,96,41,46,
+    32,70,105,110,97,108,108,121,44,32,83,116,114,105,110,103,
+    73,79,10,105,115,32,97,110,32,105,110,45,109,101,109,111,
+    114,121,32,115,116,114,101,97,109,32,102,111,114,32,116,101,
+    120,116,46,10,10,65,114,103,117,109,101,110,116,32,110,97,
+    109,101,115,32,97,114,101,32,110,111,116,32,112,97,114,116,
+    32,111,102,32,116,104,101,32,115,112,101,99,105,102,105,99,
+    97,116,105,111,110,44,32,97,110,100,32,111,110,108,121,32,
+    116,104,101,32,97,114,103,117,109,101,110,116,115,10,111,102,
+    32,111,112,101,110,40,41,32,97,114,101,32,105,110,116,101,
+    110,100,101,100,32,116,111,32,98,101,32,117,115,101,100,32,
+    97,115,32,107,101,121,119,111,114,100,32,97,114,103,117,109,
+    101,110,116,115,46,10,10,100,97,116,97,58,10,10,68,69,
+    70,65,85,76,84,95,66,85,70,70,69,82,95,83,73,90,
+    69,10,10,32,32,32,65,110,32,105,110,116,32,99,111,110,
+    116,97,105,110,105,110,103,32,116,104,101,32,100,101,102,97,
+    117,108,116,32,98,117,102,102,101,114,32,115,105,122,101,32,
+    117,115,101,100,32,98,121,32,116,104,101,32,109,111,100,117,
+    108,101,39,115,32,98,117,102,102,101,114,101,100,10,32,32,
+    32,73,47,79,32,99,108,97,115,115,101,115,46,32,111,112,
+    101,110,40,41,32,117,115,101,115,32,116,104,101,32,102,105,
+    108,101,39,115,32,98,108,107,115,105,122,101,32,40,97,115,
+    32,111,98,116,97,105,110,101,100,32,98,121,32,111,115,46,
+    115,116,97,116,41,32,105,102,10,32,32,32,112,111,115,115,
+    105,98,108,101,46,10,122,235,71,117,105,100,111,32,118,97,
+    110,32,82,111,115,115,117,109,32,60,103,117,105,100,111,64,
+    112,121,116,104,111,110,46,111,114,103,62,44,32,77,105,107,
+    101,32,86,101,114,100,111,110,101,32,60,109,105,107,101,46,
+    118,101,114,100,111,110,101,64,103,109,97,105,108,46,99,111,
+    109,62,44,32,77,97,114,107,32,82,117,115,115,101,108,108,
+    32,60,109,97,114,107,46,114,117,115,115,101,108,108,64,122,
+    101,110,46,99,111,46,117,107,62,44,32,65,110,116,111,105,
+    110,101,32,80,105,116,114,111,117,32,60,115,111,108,105,112,
+    115,105,115,64,112,105,116,114,111,117,46,110,101,116,62,44,
+    32,65,109,97,117,114,121,32,70,111,114,103,101,111,116,32,
+    100,39,65,114,99,32,60,97,109,97,117,114,121,102,97,64,
+    103,109,97,105,108,46,99,111,109,62,44,32,66,101,110,106,
+    97,109,105,110,32,80,101,116,101,114,115,111,110,32,60,98,
+    101,110,106,97,109,105,110,64,112,121,116,104,111,110,46,111,
+    114,103,62,218,15,66,108,111,99,107,105,110,103,73,79,69,
+    114,114,111,114,218,4,111,112,101,110,218,6,73,79,66,97,
+    115,101,218,9,82,97,119,73,79,66,97,115,101,218,6,70,
+    105,108,101,73,79,218,7,66,121,116,101,115,73,79,218,8,
+    83,116,114,105,110,103,73,79,218,14,66,117,102,102,101,114,
+    101,100,73,79,66,97,115,101,218,14,66,117,102,102,101,114,
+    101,100,82,101,97,100,101,114,218,14,66,117,102,102,101,114,
+    101,100,87,114,105,116,101,114,218,14,66,117,102,102,101,114,
+    101,100,82,87,80,97,105,114,218,14,66,117,102,102,101,114,
+    101,100,82,97,110,100,111,109,218,10,84,101,120,116,73,79,
+    66,97,115,101,218,13,84,101,120,116,73,79,87,114,97,112,
+    112,101,114,218,20,85,110,115,117,112,112,111,114,116,101,100,
+    79,112,101,114,97,116,105,111,110,218,8,83,69,69,75,95,
+    83,69,84,218,8,83,69,69,75,95,67,85,82,218,8,83,
+    69,69,75,95,69,78,68,233,0,0,0,0,78,41,13,218,
+    19,68,69,70,65,85,76,84,95,66,85,70,70,69,82,95,
+    83,73,90,69,114,0,0,0,0,114,14,0,0,0,114,1,
+    0,0,0,114,4,0,0,0,114,5,0,0,0,114,6,0,
+    0,0,114,8,0,0,0,114,9,0,0,0,114,10,0,0,
+    0,114,11,0,0,0,218,25,73,110,99,114,101,109,101,110,
+    116,97,108,78,101,119,108,105,110,101,68,101,99,111,100,101,
+    114,114,13,0,0,0,90,2,105,111,233,1,0,0,0,233,
+    2,0,0,0,99,0,0,0,0,0,0,0,0,0,0,0,
+    0,1,0,0,0,64,0,0,0,115,20,0,0,0,101,0,
+    90,1,100,0,90,2,101,3,106,4,106,5,90,5,100,1,
+    83,0,41,2,114,2,0,0,0,78,41,6,218,8,95,95,
+    110,97,109,101,95,95,218,10,95,95,109,111,100,117,108,101,
+    95,95,218,12,95,95,113,117,97,108,110,97,109,101,95,95,
+    218,3,95,105,111,218,7,95,73,79,66,97,115,101,218,7,
+    95,95,100,111,99,95,95,169,0,114,29,0,0,0,114,29,
+    0,0,0,250,11,60,102,114,111,122,101,110,32,105,111,62,
+    114,2,0,0,0,72,0,0,0,115,2,0,0,0,8,1,
+    41,1,90,9,109,101,116,97,99,108,97,115,115,99,0,0,
+    0,0,0,0,0,0,0,0,0,0,1,0,0,0,64,0,
+    0,0,115,20,0,0,0,101,0,90,1,100,0,90,2,101,
+    3,106,4,106,5,90,5,100,1,83,0,41,2,114,3,0,
+    0,0,78,41,6,114,23,0,0,0,114,24,0,0,0,114,
+    25,0,0,0,114,26,0,0,0,218,10,95,82,97,119,73,
+    79,66,97,115,101,114,28,0,0,0,114,29,0,0,0,114,
+    29,0,0,0,114,29,0,0,0,114,30,0,0,0,114,3,
+    0,0,0,75,0,0,0,115,2,0,0,0,8,1,99,0,
+    0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,64,
+    0,0,0,115,20,0,0,0,101,0,90,1,100,0,90,2,
+    101,3,106,4,106,5,90,5,100,1,83,0,41,2,114,7,
+    0,0,0,78,41,6,114,23,0,0,0,114,24,0,0,0,
+    114,25,0,0,0,114,26,0,0,0,218,15,95,66,117,102,
+    102,101,114,101,100,73,79,66,97,115,101,114,28,0,0,0,
+    114,29,0,0,0,114,29,0,0,0,114,29,0,0,0,114,
+    30,0,0,0,114,7,0,0,0,78,0,0,0,115,2,0,
+    0,0,8,1,99,0,0,0,0,0,0,0,0,0,0,0,
+    0,1,0,0,0,64,0,0,0,115,20,0,0,0,101,0,
+    90,1,100,0,90,2,101,3,106,4,106,5,90,5,100,1,
+    83,0,41,2,114,12,0,0,0,78,41,6,114,23,0,0,
+    0,114,24,0,0,0,114,25,0,0,0,114,26,0,0,0,
+    218,11,95,84,101,120,116,73,79,66,97,115,101,114,28,0,
+    0,0,114,29,0,0,0,114,29,0,0,0,114,29,0,0,
+    0,114,30,0,0,0,114,12,0,0,0,81,0,0,0,115,
+    2,0,0,0,8,1,41,1,218,17,95,87,105,110,100,111,
+    119,115,67,111,110,115,111,108,101,73,79,41,36,114,28,0,
+    0,0,90,10,95,95,97,117,116,104,111,114,95,95,90,7,
+    95,95,97,108,108,95,95,114,26,0,0,0,90,3,97,98,
+    99,114,19,0,0,0,114,0,0,0,0,114,14,0,0,0,
+    114,1,0,0,0,114,4,0,0,0,114,5,0,0,0,114,
+    6,0,0,0,114,8,0,0,0,114,9,0,0,0,114,10,
+    0,0,0,114,11,0,0,0,114,20,0,0,0,114,13,0,
+    0,0,90,11,79,112,101,110,87,114,97,112,112,101,114,114,
+    24,0,0,0,114,15,0,0,0,114,16,0,0,0,114,17,
+    0,0,0,114,27,0,0,0,90,7,65,66,67,77,101,116,
+    97,114,2,0,0,0,114,31,0,0,0,114,3,0,0,0,
+    114,32,0,0,0,114,7,0,0,0,114,33,0,0,0,114,
+    12,0,0,0,90,8,114,101,103,105,115,116,101,114,90,5,
+    107,108,97,115,115,114,34,0,0,0,218,11,73,109,112,111,
+    114,116,69,114,114,111,114,114,29,0,0,0,114,29,0,0,
+    0,114,29,0,0,0,114,30,0,0,0,218,8,60,109,111,
+    100,117,108,101,62,1,0,0,0,115,82,0,0,0,4,36,
+    4,7,10,1,2,0,2,0,2,1,2,0,2,0,2,1,
+    2,0,2,0,2,1,2,0,2,0,2,0,2,252,4,7,
+    8,1,8,2,60,5,6,3,6,3,4,1,4,1,4,5,
+    24,3,20,3,20,3,20,3,10,2,8,1,2,255,8,2,
+    14,2,12,1,14,1,2,2,2,1,16,1,16,1,6,2,
+};
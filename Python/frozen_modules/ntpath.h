@@ -0,0 +1,817 @@
+/* Auto-generated by Programs/_freeze_importlib.c */
+const unsigned char _Py_M__ntpath[] = {
+    99,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,
+    0,64,0,0,0,115,54,2,0,0,100,0,90,0,100,1,
+    90,1,100,2,90,2,100,1,90,3,100,3,90,4,100,4,
+    90,5,100,5,90,6,100,6,90,7,100,7,90,8,100,8,
+    100,9,108,9,90,9,100,8,100,9,108,10,90,10,100,8,
+    100,9,108,11,90,11,100,8,100,9,108,12,90,12,100,8,
+    100,10,108,12,84,0,100,11,100,12,100,13,100,14,100,15,
+    100,16,100,17,100,18,100,19,100,20,100,21,100,22,100,23,
+    100,24,100,25,100,26,100,27,100,28,100,29,100,30,100,31,
+    100,32,100,33,100,34,100,35,100,36,100,37,100,38,100,39,
+    100,40,100,41,100,42,100,43,100,44,100,45,100,46,100,47,
+    100,48,103,38,90,13,100,49,100,50,132,0,90,14,100,51,
+    100,11,132,0,90,15,100,52,100,12,132,0,90,16,100,53,
+    100,13,132,0,90,17,100,54,100,14,132,0,90,18,100,55,
+    100,15,132,0,90,19,100,56,100,16,132,0,90,20,101,12,
+    106,21,106,0,101,20,95,0,100,57,100,17,132,0,90,22,
+    100,58,100,18,132,0,90,23,100,59,100,24,132,0,90,24,
+    100,60,100,26,132,0,90,25,122,16,100,8,100,61,108,26,
+    109,27,90,27,1,0,87,0,110,26,4,0,101,28,107,10,
+    144,1,114,40,1,0,1,0,1,0,100,9,90,27,89,0,
+    110,2,88,0,100,62,100,29,132,0,90,29,100,63,100,30,
+    132,0,90,30,100,64,100,31,132,0,90,31,100,65,100,32,
+    132,0,90,32,100,66,100,67,132,0,90,33,122,16,100,8,
+    100,68,108,26,109,34,90,34,1,0,87,0,110,26,4,0,
+    101,28,107,10,144,1,114,124,1,0,1,0,1,0,101,33,
+    90,35,89,0,110,10,88,0,100,69,100,33,132,0,90,35,
+    101,35,90,36,101,37,101,10,100,70,131,2,144,1,111,164,
+    101,10,160,38,161,0,100,71,25,0,100,72,107,5,90,39,
+    100,9,102,1,100,73,100,44,132,1,90,40,100,74,100,48,
+    132,0,90,41,122,44,101,10,160,38,161,0,100,9,100,72,
+    133,2,25,0,100,75,107,5,144,1,114,224,100,8,100,76,
+    108,26,109,42,90,42,1,0,110,4,101,28,130,1,87,0,
+    110,34,4,0,101,43,101,28,102,2,107,10,144,2,114,8,
+    1,0,1,0,1,0,100,77,100,78,132,0,90,42,89,0,
+    110,2,88,0,122,16,100,8,100,79,108,26,109,44,90,45,
+    1,0,87,0,110,22,4,0,101,28,107,10,144,2,114,48,
+    1,0,1,0,1,0,89,0,110,2,88,0,100,9,83,0,
+    41,80,122,144,67,111,109,109,111,110,32,112,97,116,104,110,
+    97,109,101,32,109,97,110,105,112,117,108,97,116,105,111,110,
+    115,44,32,87,105,110,100,111,119,115,78,84,47,57,53,32,
+    118,101,114,115,105,111,110,46,10,10,73,110,115,116,101,97,
+    100,32,111,102,32,105,109,112,111,114,116,105,110,103,32,116,
+    104,105,115,32,109,111,100,117,108,101,32,100,105,114,101,99,
+    116,108,121,44,32,105,109,112,111,114,116,32,111,115,32,97,
+    110,100,32,114,101,102,101,114,32,116,111,32,116,104,105,115,
+    10,109,111,100,117,108,101,32,97,115,32,111,115,46,112,97,
+    116,104,46,10,218,1,46,250,2,46,46,250,1,92,250,1,
+    59,250,1,47,122,8,46,59,67,58,92,98,105,110,90,3,
+    110,117,108,233,0,0,0,0,78,41,1,218,1,42,218,8,
+    110,111,114,109,99,97,115,101,218,5,105,115,97,98,115,218,
+    4,106,111,105,110,218,10,115,112,108,105,116,100,114,105,118,
+    101,218,5,115,112,108,105,116,218,8,115,112,108,105,116,101,
+    120,116,218,8,98,97,115,101,110,97,109,101,218,7,100,105,
+    114,110,97,109,101,90,12,99,111,109,109,111,110,112,114,101,
+    102,105,120,90,7,103,101,116,115,105,122,101,90,8,103,101,
+    116,109,116,105,109,101,90,8,103,101,116,97,116,105,109,101,
+    90,8,103,101,116,99,116,105,109,101,218,6,105,115,108,105,
+    110,107,90,6,101,120,105,115,116,115,218,7,108,101,120,105,
+    115,116,115,218,5,105,115,100,105,114,90,6,105,115,102,105,
+    108,101,218,7,105,115,109,111,117,110,116,218,10,101,120,112,
+    97,110,100,117,115,101,114,218,10,101,120,112,97,110,100,118,
+    97,114,115,218,8,110,111,114,109,112,97,116,104,218,7,97,
+    98,115,112,97,116,104,218,6,99,117,114,100,105,114,218,6,
+    112,97,114,100,105,114,218,3,115,101,112,218,7,112,97,116,
+    104,115,101,112,218,7,100,101,102,112,97,116,104,218,6,97,
+    108,116,115,101,112,218,6,101,120,116,115,101,112,218,7,100,
+    101,118,110,117,108,108,218,8,114,101,97,108,112,97,116,104,
+    218,26,115,117,112,112,111,114,116,115,95,117,110,105,99,111,
+    100,101,95,102,105,108,101,110,97,109,101,115,218,7,114,101,
+    108,112,97,116,104,90,8,115,97,109,101,102,105,108,101,90,
+    12,115,97,109,101,111,112,101,110,102,105,108,101,90,8,115,
+    97,109,101,115,116,97,116,218,10,99,111,109,109,111,110,112,
+    97,116,104,99,1,0,0,0,0,0,0,0,1,0,0,0,
+    3,0,0,0,67,0,0,0,115,22,0,0,0,116,0,124,
+    0,116,1,131,2,114,14,100,1,83,0,100,2,83,0,100,
+    0,83,0,41,3,78,243,2,0,0,0,92,47,250,2,92,
+    47,41,2,218,10,105,115,105,110,115,116,97,110,99,101,218,
+    5,98,121,116,101,115,169,1,218,4,112,97,116,104,169,0,
+    114,41,0,0,0,250,15,60,102,114,111,122,101,110,32,110,
+    116,112,97,116,104,62,218,13,95,103,101,116,95,98,111,116,
+    104,115,101,112,115,34,0,0,0,115,6,0,0,0,0,1,
+    10,1,4,2,114,43,0,0,0,99,1,0,0,0,0,0,
+    0,0,1,0,0,0,9,0,0,0,67,0,0,0,115,126,
+    0,0,0,116,0,160,1,124,0,161,1,125,0,122,52,116,
+    2,124,0,116,3,131,2,114,42,124,0,160,4,100,1,100,
+    2,161,2,160,5,161,0,87,0,83,0,110,18,124,0,160,
+    4,100,3,100,4,161,2,160,5,161,0,87,0,83,0,87,
+    0,110,58,4,0,116,6,116,7,102,2,107,10,114,120,1,
+    0,1,0,1,0,116,2,124,0,116,3,116,8,102,2,131,
+    2,115,114,116,6,100,5,124,0,106,9,106,10,22,0,131,
+    1,100,6,130,2,130,0,89,0,110,2,88,0,100,6,83,
+    0,41,7,122,97,78,111,114,109,97,108,105,122,101,32,99,
+    97,115,101,32,111,102,32,112,97,116,104,110,97,109,101,46,
+    10,10,32,32,32,32,77,97,107,101,115,32,97,108,108,32,
+    99,104,97,114,97,99,116,101,114,115,32,108,111,119,101,114,
+    99,97,115,101,32,97,110,100,32,97,108,108,32,115,108,97,
+    115,104,101,115,32,105,110,116,111,32,98,97,99,107,115,108,
+    97,115,104,101,115,46,243,1,0,0,0,47,243,1,0,0,
+    0,92,114,4,0,0,0,114,2,0,0,0,122,48,110,111,
+    114,109,99,97,115,101,40,41,32,97,114,103,117,109,101,110,
+    116,32,109,117,115,116,32,98,101,32,115,116,114,32,111,114,
+    32,98,121,116,101,115,44,32,110,111,116,32,37,114,78,41,
+    11,218,2,111,115,218,6,102,115,112,97,116,104,114,37,0,
+    0,0,114,38,0,0,0,218,7,114,101,112,108,97,99,101,
+    218,5,108,111,119,101,114,218,9,84,121,112,101,69,114,114,
+    111,114,218,14,65,116,116,114,105,98,117,116,101,69,114,114,
+    111,114,218,3,115,116,114,218,9,95,95,99,108,97,115,115,
+    95,95,218,8,95,95,110,97,109,101,95,95,169,1,218,1,
+    115,114,41,0,0,0,114,41,0,0,0,114,42,0,0,0,
+    114,7,0,0,0,44,0,0,0,115,26,0,0,0,0,4,
+    10,1,2,1,10,1,20,2,22,1,18,1,14,1,4,1,
+    6,255,4,1,2,255,2,2,99,1,0,0,0,0,0,0,
+    0,1,0,0,0,3,0,0,0,67,0,0,0,115,50,0,
+    0,0,116,0,160,1,124,0,161,1,125,0,116,2,124,0,
+    131,1,100,1,25,0,125,0,116,3,124,0,131,1,100,2,
+    107,4,111,48,124,0,100,2,25,0,116,4,124,0,131,1,
+    107,6,83,0,41,3,122,31,84,101,115,116,32,119,104,101,
+    116,104,101,114,32,97,32,112,97,116,104,32,105,115,32,97,
+    98,115,111,108,117,116,101,233,1,0,0,0,114,5,0,0,
+    0,41,5,114,46,0,0,0,114,47,0,0,0,114,10,0,
+    0,0,218,3,108,101,110,114,43,0,0,0,114,55,0,0,
+    0,114,41,0,0,0,114,41,0,0,0,114,42,0,0,0,
+    114,8,0,0,0,67,0,0,0,115,6,0,0,0,0,2,
+    10,1,12,1,99,1,0,0,0,0,0,0,0,10,0,0,
+    0,10,0,0,0,71,0,0,0,115,88,1,0,0,116,0,
+    160,1,124,0,161,1,125,0,116,2,124,0,116,3,131,2,
+    114,34,100,1,125,2,100,2,125,3,100,3,125,4,110,12,
+    100,4,125,2,100,5,125,3,100,6,125,4,122,244,124,1,
+    115,68,124,0,100,0,100,7,133,2,25,0,124,2,23,0,
+    1,0,116,4,124,0,131,1,92,2,125,5,125,6,116,5,
+    116,0,106,1,124,1,131,2,68,0,93,126,125,7,116,4,
+    124,7,131,1,92,2,125,8,125,9,124,9,114,144,124,9,
+    100,7,25,0,124,3,107,6,114,144,124,8,115,132,124,5,
+    115,136,124,8,125,5,124,9,125,6,113,92,110,42,124,8,
+    114,186,124,8,124,5,107,3,114,186,124,8,160,6,161,0,
+    124,5,160,6,161,0,107,3,114,182,124,8,125,5,124,9,
+    125,6,113,92,124,8,125,5,124,6,114,210,124,6,100,8,
+    25,0,124,3,107,7,114,210,124,6,124,2,23,0,125,6,
+    124,6,124,9,23,0,125,6,113,92,124,6,144,1,114,22,
+    124,6,100,7,25,0,124,3,107,7,144,1,114,22,124,5,
+    144,1,114,22,124,5,100,8,100,0,133,2,25,0,124,4,
+    107,3,144,1,114,22,124,5,124,2,23,0,124,6,23,0,
+    87,0,83,0,124,5,124,6,23,0,87,0,83,0,87,0,
+    110,48,4,0,116,7,116,8,116,9,102,3,107,10,144,1,
+    114,82,1,0,1,0,1,0,116,10,106,11,100,9,124,0,
+    102,2,124,1,158,2,142,0,1,0,130,0,89,0,110,2,
+    88,0,100,0,83,0,41,10,78,114,45,0,0,0,114,35,
+    0,0,0,243,1,0,0,0,58,114,2,0,0,0,114,36,
+    0,0,0,250,1,58,114,5,0,0,0,233,255,255,255,255,
+    114,9,0,0,0,41,12,114,46,0,0,0,114,47,0,0,
+    0,114,37,0,0,0,114,38,0,0,0,114,10,0,0,0,
+    218,3,109,97,112,114,49,0,0,0,114,50,0,0,0,114,
+    51,0,0,0,218,12,66,121,116,101,115,87,97,114,110,105,
+    110,103,218,11,103,101,110,101,114,105,99,112,97,116,104,218,
+    16,95,99,104,101,99,107,95,97,114,103,95,116,121,112,101,
+    115,41,10,114,40,0,0,0,218,5,112,97,116,104,115,114,
+    25,0,0,0,218,4,115,101,112,115,218,5,99,111,108,111,
+    110,90,12,114,101,115,117,108,116,95,100,114,105,118,101,90,
+    11,114,101,115,117,108,116,95,112,97,116,104,218,1,112,90,
+    7,112,95,100,114,105,118,101,90,6,112,95,112,97,116,104,
+    114,41,0,0,0,114,41,0,0,0,114,42,0,0,0,114,
+    9,0,0,0,75,0,0,0,115,76,0,0,0,0,1,10,
+    1,10,1,4,1,4,1,6,2,4,1,4,1,4,1,2,
+    1,4,1,16,1,12,1,16,1,12,1,16,2,8,1,4,
+    1,4,1,4,1,12,1,16,2,4,1,4,1,2,2,4,
+    2,16,1,8,1,10,2,20,1,2,255,4,1,14,255,4,
+    2,14,1,14,1,22,1,18,1,99,1,0,0,0,0,0,
+    0,0,7,0,0,0,5,0,0,0,67,0,0,0,115,30,
+    1,0,0,116,0,160,1,124,0,161,1,125,0,116,2,124,
+    0,131,1,100,1,107,5,144,1,114,14,116,3,124,0,116,
+    4,131,2,114,48,100,2,125,1,100,3,125,2,100,4,125,
+    3,110,12,100,5,125,1,100,6,125,2,100,7,125,3,124,
+    0,160,5,124,2,124,1,161,2,125,4,124,4,100,8,100,
+    1,133,2,25,0,124,1,100,1,20,0,107,2,114,228,124,
+    4,100,1,100,9,133,2,25,0,124,1,107,3,114,228,124,
+    4,160,6,124,1,100,1,161,2,125,5,124,5,100,10,107,
+    2,114,144,124,0,100,11,100,8,133,2,25,0,124,0,102,
+    2,83,0,124,4,160,6,124,1,124,5,100,12,23,0,161,
+    2,125,6,124,6,124,5,100,12,23,0,107,2,114,188,124,
+    0,100,11,100,8,133,2,25,0,124,0,102,2,83,0,124,
+    6,100,10,107,2,114,204,116,2,124,0,131,1,125,6,124,
+    0,100,11,124,6,133,2,25,0,124,0,124,6,100,11,133,
+    2,25,0,102,2,83,0,124,4,100,12,100,1,133,2,25,
+    0,124,3,107,2,144,1,114,14,124,0,100,11,100,1,133,
+    2,25,0,124,0,100,1,100,11,133,2,25,0,102,2,83,
+    0,124,0,100,11,100,8,133,2,25,0,124,0,102,2,83,
+    0,41,13,97,218,2,0,0,83,112,108,105,116,32,97,32,
+    112,97,116,104,110,97,109,101,32,105,110,116,111,32,100,114,
+    105,118,101,47,85,78,67,32,115,104,97,114,101,112,111,105,
+    110,116,32,97,110,100,32,114,101,108,97,116,105,118,101,32,
+    112,97,116,104,32,115,112,101,99,105,102,105,101,114,115,46,
+    10,32,32,32,32,82,101,116,117,114,110,115,32,97,32,50,
+    45,116,117,112,108,101,32,40,100,114,105,118,101,95,111,114,
+    95,117,110,99,44,32,112,97,116,104,41,59,32,101,105,116,
+    104,101,114,32,112,97,114,116,32,109,97,121,32,98,101,32,
+    101,109,112,116,121,46,10,10,32,32,32,32,73,102,32,121,
+    111,117,32,97,115,115,105,103,110,10,32,32,32,32,32,32,
+    32,32,114,101,115,117,108,116,32,61,32,115,112,108,105,116,
+    100,114,105,118,101,40,112,41,10,32,32,32,32,73,116,32,
+    105,115,32,97,108,119,97,121,115,32,116,114,117,101,32,116,
+    104,97,116,58,10,32,32,32,32,32,32,32,32,114,101,115,
+    117,108,116,91,48,93,32,43,32,114,101,115,117,108,116,91,
+    49,93,32,61,61,32,112,10,10,32,32,32,32,73,102,32,
+    116,104,101,32,112,97,116,104,32,99,111,110,116,97,105,110,
+    101,100,32,97,32,100,114,105,118,101,32,108,101,116,116,101,
+    114,44,32,100,114,105,118,101,95,111,114,95,117,110,99,32,
+    119,105,108,108,32,99,111,110,116,97,105,110,32,101,118,101,
+    114,121,116,104,105,110,103,10,32,32,32,32,117,112,32,116,
+    111,32,97,110,100,32,105,110,99,108,117,100,105,110,103,32,
+    116,104,101,32,99,111,108,111,110,46,32,32,101,46,103,46,
+    32,115,112,108,105,116,100,114,105,118,101,40,34,99,58,47,
+    100,105,114,34,41,32,114,101,116,117,114,110,115,32,40,34,
+    99,58,34,44,32,34,47,100,105,114,34,41,10,10,32,32,
+    32,32,73,102,32,116,104,101,32,112,97,116,104,32,99,111,
+    110,116,97,105,110,101,100,32,97,32,85,78,67,32,112,97,
+    116,104,44,32,116,104,101,32,100,114,105,118,101,95,111,114,
+    95,117,110,99,32,119,105,108,108,32,99,111,110,116,97,105,
+    110,32,116,104,101,32,104,111,115,116,32,110,97,109,101,10,
+    32,32,32,32,97,110,100,32,115,104,97,114,101,32,117,112,
+    32,116,111,32,98,117,116,32,110,111,116,32,105,110,99,108,
+    117,100,105,110,103,32,116,104,101,32,102,111,117,114,116,104,
+    32,100,105,114,101,99,116,111,114,121,32,115,101,112,97,114,
+    97,116,111,114,32,99,104,97,114,97,99,116,101,114,46,10,
+    32,32,32,32,101,46,103,46,32,115,112,108,105,116,100,114,
+    105,118,101,40,34,47,47,104,111,115,116,47,99,111,109,112,
+    117,116,101,114,47,100,105,114,34,41,32,114,101,116,117,114,
+    110,115,32,40,34,47,47,104,111,115,116,47,99,111,109,112,
+    117,116,101,114,34,44,32,34,47,100,105,114,34,41,10,10,
+    32,32,32,32,80,97,116,104,115,32,99,97,110,110,111,116,
+    32,99,111,110,116,97,105,110,32,98,111,116,104,32,97,32,
+    100,114,105,118,101,32,108,101,116,116,101,114,32,97,110,100,
+    32,97,32,85,78,67,32,112,97,116,104,46,10,10,32,32,
+    32,32,233,2,0,0,0,114,45,0,0,0,114,44,0,0,
+    0,114,59,0,0,0,114,2,0,0,0,114,4,0,0,0,
+    114,60,0,0,0,114,5,0,0,0,233,3,0,0,0,114,
+    61,0,0,0,78,114,57,0,0,0,41,7,114,46,0,0,
+    0,114,47,0,0,0,114,58,0,0,0,114,37,0,0,0,
+    114,38,0,0,0,114,48,0,0,0,218,4,102,105,110,100,
+    41,7,114,69,0,0,0,114,25,0,0,0,114,28,0,0,
+    0,114,68,0,0,0,90,5,110,111,114,109,112,218,5,105,
+    110,100,101,120,90,6,105,110,100,101,120,50,114,41,0,0,
+    0,114,41,0,0,0,114,42,0,0,0,114,10,0,0,0,
+    122,0,0,0,115,46,0,0,0,0,19,10,1,14,1,10,
+    1,4,1,4,1,6,2,4,1,4,1,4,1,12,1,36,
+    5,12,1,8,1,16,1,16,3,12,1,16,1,8,1,8,
+    1,24,1,18,1,24,1,99,1,0,0,0,0,0,0,0,
+    6,0,0,0,4,0,0,0,67,0,0,0,115,120,0,0,
+    0,116,0,160,1,124,0,161,1,125,0,116,2,124,0,131,
+    1,125,1,116,3,124,0,131,1,92,2,125,2,125,0,116,
+    4,124,0,131,1,125,3,124,3,114,68,124,0,124,3,100,
+    1,24,0,25,0,124,1,107,7,114,68,124,3,100,1,56,
+    0,125,3,113,38,124,0,100,2,124,3,133,2,25,0,124,
+    0,124,3,100,2,133,2,25,0,2,0,125,4,125,5,124,
+    4,160,5,124,1,161,1,112,106,124,4,125,4,124,2,124,
+    4,23,0,124,5,102,2,83,0,41,3,122,126,83,112,108,
+    105,116,32,97,32,112,97,116,104,110,97,109,101,46,10,10,
+    32,32,32,32,82,101,116,117,114,110,32,116,117,112,108,101,
+    32,40,104,101,97,100,44,32,116,97,105,108,41,32,119,104,
+    101,114,101,32,116,97,105,108,32,105,115,32,101,118,101,114,
+    121,116,104,105,110,103,32,97,102,116,101,114,32,116,104,101,
+    32,102,105,110,97,108,32,115,108,97,115,104,46,10,32,32,
+    32,32,69,105,116,104,101,114,32,112,97,114,116,32,109,97,
+    121,32,98,101,32,101,109,112,116,121,46,114,57,0,0,0,
+    78,41,6,114,46,0,0,0,114,47,0,0,0,114,43,0,
+    0,0,114,10,0,0,0,114,58,0,0,0,218,6,114,115,
+    116,114,105,112,41,6,114,69,0,0,0,114,67,0,0,0,
+    218,1,100,218,1,105,90,4,104,101,97,100,90,4,116,97,
+    105,108,114,41,0,0,0,114,41,0,0,0,114,42,0,0,
+    0,114,11,0,0,0,178,0,0,0,115,18,0,0,0,0,
+    5,10,1,8,1,12,2,8,1,20,1,10,1,26,2,14,
+    1,99,1,0,0,0,0,0,0,0,1,0,0,0,6,0,
+    0,0,67,0,0,0,115,56,0,0,0,116,0,160,1,124,
+    0,161,1,125,0,116,2,124,0,116,3,131,2,114,36,116,
+    4,160,5,124,0,100,1,100,2,100,3,161,4,83,0,116,
+    4,160,5,124,0,100,4,100,5,100,6,161,4,83,0,100,
+    0,83,0,41,7,78,114,45,0,0,0,114,44,0,0,0,
+    243,1,0,0,0,46,114,2,0,0,0,114,4,0,0,0,
+    114,0,0,0,0,41,6,114,46,0,0,0,114,47,0,0,
+    0,114,37,0,0,0,114,38,0,0,0,114,64,0,0,0,
+    218,9,95,115,112,108,105,116,101,120,116,169,1,114,69,0,
+    0,0,114,41,0,0,0,114,41,0,0,0,114,42,0,0,
+    0,114,12,0,0,0,201,0,0,0,115,8,0,0,0,0,
+    1,10,1,10,1,16,2,99,1,0,0,0,0,0,0,0,
+    1,0,0,0,2,0,0,0,67,0,0,0,115,12,0,0,
+    0,116,0,124,0,131,1,100,1,25,0,83,0,41,2,122,
+    41,82,101,116,117,114,110,115,32,116,104,101,32,102,105,110,
+    97,108,32,99,111,109,112,111,110,101,110,116,32,111,102,32,
+    97,32,112,97,116,104,110,97,109,101,114,57,0,0,0,169,
+    1,114,11,0,0,0,114,79,0,0,0,114,41,0,0,0,
+    114,41,0,0,0,114,42,0,0,0,114,13,0,0,0,212,
+    0,0,0,115,2,0,0,0,0,2,99,1,0,0,0,0,
+    0,0,0,1,0,0,0,2,0,0,0,67,0,0,0,115,
+    12,0,0,0,116,0,124,0,131,1,100,1,25,0,83,0,
+    41,2,122,45,82,101,116,117,114,110,115,32,116,104,101,32,
+    100,105,114,101,99,116,111,114,121,32,99,111,109,112,111,110,
+    101,110,116,32,111,102,32,97,32,112,97,116,104,110,97,109,
+    101,114,5,0,0,0,114,80,0,0,0,114,79,0,0,0,
+    114,41,0,0,0,114,41,0,0,0,114,42,0,0,0,114,
+    14,0,0,0,219,0,0,0,115,2,0,0,0,0,2,99,
+    1,0,0,0,0,0,0,0,2,0,0,0,10,0,0,0,
+    67,0,0,0,115,56,0,0,0,122,14,116,0,160,1,124,
+    0,161,1,125,1,87,0,110,28,4,0,116,2,116,3,116,
+    4,102,3,107,10,114,42,1,0,1,0,1,0,89,0,100,
+    1,83,0,88,0,116,5,160,6,124,1,106,7,161,1,83,
+    0,41,2,122,104,84,101,115,116,32,119,104,101,116,104,101,
+    114,32,97,32,112,97,116,104,32,105,115,32,97,32,115,121,
+    109,98,111,108,105,99,32,108,105,110,107,46,10,32,32,32,
+    32,84,104,105,115,32,119,105,108,108,32,97,108,119,97,121,
+    115,32,114,101,116,117,114,110,32,102,97,108,115,101,32,102,
+    111,114,32,87,105,110,100,111,119,115,32,112,114,105,111,114,
+    32,116,111,32,54,46,48,46,10,32,32,32,32,70,41,8,
+    114,46,0,0,0,218,5,108,115,116,97,116,218,7,79,83,
+    69,114,114,111,114,218,10,86,97,108,117,101,69,114,114,111,
+    114,114,51,0,0,0,218,4,115,116,97,116,90,7,83,95,
+    73,83,76,78,75,90,7,115,116,95,109,111,100,101,169,2,
+    114,40,0,0,0,90,2,115,116,114,41,0,0,0,114,41,
+    0,0,0,114,42,0,0,0,114,15,0,0,0,226,0,0,
+    0,115,10,0,0,0,0,4,2,1,14,1,20,1,8,1,
+    99,1,0,0,0,0,0,0,0,2,0,0,0,9,0,0,
+    0,67,0,0,0,115,46,0,0,0,122,14,116,0,160,1,
+    124,0,161,1,125,1,87,0,110,26,4,0,116,2,116,3,
+    102,2,107,10,114,40,1,0,1,0,1,0,89,0,100,1,
+    83,0,88,0,100,2,83,0,41,3,122,67,84,101,115,116,
+    32,119,104,101,116,104,101,114,32,97,32,112,97,116,104,32,
+    101,120,105,115,116,115,46,32,32,82,101,116,117,114,110,115,
+    32,84,114,117,101,32,102,111,114,32,98,114,111,107,101,110,
+    32,115,121,109,98,111,108,105,99,32,108,105,110,107,115,70,
+    84,41,4,114,46,0,0,0,114,81,0,0,0,114,82,0,
+    0,0,114,83,0,0,0,114,85,0,0,0,114,41,0,0,
+    0,114,41,0,0,0,114,42,0,0,0,114,16,0,0,0,
+    238,0,0,0,115,10,0,0,0,0,2,2,1,14,1,18,
+    1,8,1,41,1,218,18,95,103,101,116,118,111,108,117,109,
+    101,112,97,116,104,110,97,109,101,99,1,0,0,0,0,0,
+    0,0,4,0,0,0,4,0,0,0,67,0,0,0,115,116,
+    0,0,0,116,0,160,1,124,0,161,1,125,0,116,2,124,
+    0,131,1,125,1,116,3,124,0,131,1,125,0,116,4,124,
+    0,131,1,92,2,125,2,125,3,124,2,114,68,124,2,100,
+    1,25,0,124,1,107,6,114,68,124,3,12,0,112,66,124,
+    3,124,1,107,6,83,0,124,3,124,1,107,6,114,80,100,
+    2,83,0,116,5,114,108,124,0,160,6,124,1,161,1,116,
+    5,124,0,131,1,160,6,124,1,161,1,107,2,83,0,100,
+    3,83,0,100,4,83,0,41,5,122,97,84,101,115,116,32,
+    119,104,101,116,104,101,114,32,97,32,112,97,116,104,32,105,
+    115,32,97,32,109,111,117,110,116,32,112,111,105,110,116,32,
+    40,97,32,100,114,105,118,101,32,114,111,111,116,44,32,116,
+    104,101,32,114,111,111,116,32,111,102,32,97,10,32,32,32,
+    32,115,104,97,114,101,44,32,111,114,32,97,32,109,111,117,
+    110,116,101,100,32,118,111,108,117,109,101,41,114,5,0,0,
+    0,84,70,78,41,7,114,46,0,0,0,114,47,0,0,0,
+    114,43,0,0,0,114,22,0,0,0,114,10,0,0,0,114,
+    86,0,0,0,114,74,0,0,0,41,4,114,40,0,0,0,
+    114,67,0,0,0,90,4,114,111,111,116,90,4,114,101,115,
+    116,114,41,0,0,0,114,41,0,0,0,114,42,0,0,0,
+    114,18,0,0,0,4,1,0,0,115,22,0,0,0,0,3,
+    10,1,8,1,8,1,12,1,16,1,14,1,8,1,4,2,
+    4,1,24,2,99,1,0,0,0,0,0,0,0,6,0,0,
+    0,8,0,0,0,67,0,0,0,115,18,1,0,0,116,0,
+    160,1,124,0,161,1,125,0,116,2,124,0,116,3,131,2,
+    114,26,100,1,125,1,110,4,100,2,125,1,124,0,160,4,
+    124,1,161,1,115,44,124,0,83,0,100,3,116,5,124,0,
+    131,1,2,0,125,2,125,3,124,2,124,3,107,0,114,92,
+    124,0,124,2,25,0,116,6,124,0,131,1,107,7,114,92,
+    124,2,100,3,55,0,125,2,113,58,100,4,116,0,106,7,
+    107,6,114,114,116,0,106,7,100,4,25,0,125,4,110,92,
+    100,5,116,0,106,7,107,6,114,136,116,0,106,7,100,5,
+    25,0,125,4,110,70,100,6,116,0,106,7,107,7,114,150,
+    124,0,83,0,122,14,116,0,106,7,100,7,25,0,125,5,
+    87,0,110,24,4,0,116,8,107,10,114,188,1,0,1,0,
+    1,0,100,8,125,5,89,0,110,2,88,0,116,9,124,5,
+    116,0,106,7,100,6,25,0,131,2,125,4,116,2,124,0,
+    116,3,131,2,114,226,116,0,160,10,124,4,161,1,125,4,
+    124,2,100,3,107,3,144,1,114,2,116,9,116,11,124,4,
+    131,1,124,0,100,3,124,2,133,2,25,0,131,2,125,4,
+    124,4,124,0,124,2,100,9,133,2,25,0,23,0,83,0,
+    41,10,122,76,69,120,112,97,110,100,32,126,32,97,110,100,
+    32,126,117,115,101,114,32,99,111,110,115,116,114,117,99,116,
+    115,46,10,10,32,32,32,32,73,102,32,117,115,101,114,32,
+    111,114,32,36,72,79,77,69,32,105,115,32,117,110,107,110,
+    111,119,110,44,32,100,111,32,110,111,116,104,105,110,103,46,
+    243,1,0,0,0,126,250,1,126,114,57,0,0,0,90,4,
+    72,79,77,69,90,11,85,83,69,82,80,82,79,70,73,76,
+    69,90,8,72,79,77,69,80,65,84,72,90,9,72,79,77,
+    69,68,82,73,86,69,218,0,78,41,12,114,46,0,0,0,
+    114,47,0,0,0,114,37,0,0,0,114,38,0,0,0,218,
+    10,115,116,97,114,116,115,119,105,116,104,114,58,0,0,0,
+    114,43,0,0,0,218,7,101,110,118,105,114,111,110,218,8,
+    75,101,121,69,114,114,111,114,114,9,0,0,0,218,8,102,
+    115,101,110,99,111,100,101,114,14,0,0,0,41,6,114,40,
+    0,0,0,90,5,116,105,108,100,101,114,76,0,0,0,218,
+    1,110,90,8,117,115,101,114,104,111,109,101,218,5,100,114,
+    105,118,101,114,41,0,0,0,114,41,0,0,0,114,42,0,
+    0,0,114,19,0,0,0,31,1,0,0,115,50,0,0,0,
+    0,4,10,1,10,1,6,2,4,1,10,1,4,1,14,1,
+    24,1,10,2,10,1,12,1,10,1,12,1,10,1,4,2,
+    2,1,14,1,14,1,10,1,16,2,10,1,10,2,10,1,
+    22,2,99,1,0,0,0,0,0,0,0,15,0,0,0,8,
+    0,0,0,67,0,0,0,115,50,4,0,0,116,0,160,1,
+    124,0,161,1,125,0,116,2,124,0,116,3,131,2,114,104,
+    100,1,124,0,107,7,114,40,100,2,124,0,107,7,114,40,
+    124,0,83,0,100,3,100,4,108,4,125,1,116,3,124,1,
+    106,5,124,1,106,6,23,0,100,5,23,0,100,6,131,2,
+    125,2,100,7,125,3,100,2,125,4,100,8,125,5,100,9,
+    125,6,100,1,125,7,116,7,116,0,100,10,100,4,131,3,
+    125,8,110,70,100,11,124,0,107,7,114,124,100,12,124,0,
+    107,7,114,124,124,0,83,0,100,3,100,4,108,4,125,1,
+    124,1,106,5,124,1,106,6,23,0,100,5,23,0,125,2,
+    100,13,125,3,100,12,125,4,100,14,125,5,100,15,125,6,
+    100,11,125,7,116,0,106,8,125,8,124,0,100,4,100,3,
+    133,2,25,0,125,9,100,3,125,10,116,9,124,0,131,1,
+    125,11,124,10,124,11,107,0,144,4,114,46,124,0,124,10,
+    124,10,100,16,23,0,133,2,25,0,125,12,124,12,124,3,
+    107,2,144,1,114,88,124,0,124,10,100,16,23,0,100,4,
+    133,2,25,0,125,0,116,9,124,0,131,1,125,11,122,38,
+    124,0,160,10,124,12,161,1,125,10,124,9,124,12,124,0,
+    100,4,124,10,100,16,23,0,133,2,25,0,23,0,55,0,
+    125,9,87,0,110,42,4,0,116,11,107,10,144,1,114,82,
+    1,0,1,0,1,0,124,9,124,12,124,0,23,0,55,0,
+    125,9,124,11,100,16,24,0,125,10,89,0,110,2,88,0,
+    144,2,110,204,124,12,124,4,107,2,144,2,114,74,124,0,
+    124,10,100,16,23,0,124,10,100,17,23,0,133,2,25,0,
+    124,4,107,2,144,1,114,142,124,9,124,12,55,0,125,9,
+    124,10,100,16,55,0,125,10,110,184,124,0,124,10,100,16,
+    23,0,100,4,133,2,25,0,125,0,116,9,124,0,131,1,
+    125,11,122,14,124,0,160,10,124,4,161,1,125,10,87,0,
+    110,42,4,0,116,11,107,10,144,1,114,222,1,0,1,0,
+    1,0,124,9,124,4,124,0,23,0,55,0,125,9,124,11,
+    100,16,24,0,125,10,89,0,110,104,88,0,124,0,100,4,
+    124,10,133,2,25,0,125,13,122,46,124,8,100,4,107,8,
+    144,2,114,16,116,0,160,12,116,0,106,8,116,0,160,13,
+    124,13,161,1,25,0,161,1,125,14,110,8,124,8,124,13,
+    25,0,125,14,87,0,110,34,4,0,116,14,107,10,144,2,
+    114,60,1,0,1,0,1,0,124,4,124,13,23,0,124,4,
+    23,0,125,14,89,0,110,2,88,0,124,9,124,14,55,0,
+    125,9,144,1,110,218,124,12,124,7,107,2,144,4,114,28,
+    124,0,124,10,100,16,23,0,124,10,100,17,23,0,133,2,
+    25,0,124,7,107,2,144,2,114,130,124,9,124,12,55,0,
+    125,9,124,10,100,16,55,0,125,10,144,4,113,36,124,0,
+    124,10,100,16,23,0,124,10,100,17,23,0,133,2,25,0,
+    124,5,107,2,144,3,114,94,124,0,124,10,100,17,23,0,
+    100,4,133,2,25,0,125,0,116,9,124,0,131,1,125,11,
+    122,14,124,0,160,10,124,6,161,1,125,10,87,0,110,46,
+    4,0,116,11,107,10,144,2,114,240,1,0,1,0,1,0,
+    124,9,124,7,124,5,23,0,124,0,23,0,55,0,125,9,
+    124,11,100,16,24,0,125,10,89,0,110,108,88,0,124,0,
+    100,4,124,10,133,2,25,0,125,13,122,46,124,8,100,4,
+    107,8,144,3,114,34,116,0,160,12,116,0,106,8,116,0,
+    160,13,124,13,161,1,25,0,161,1,125,14,110,8,124,8,
+    124,13,25,0,125,14,87,0,110,38,4,0,116,14,107,10,
+    144,3,114,82,1,0,1,0,1,0,124,7,124,5,23,0,
+    124,13,23,0,124,6,23,0,125,14,89,0,110,2,88,0,
+    124,9,124,14,55,0,125,9,110,188,124,0,100,4,100,3,
+    133,2,25,0,125,13,124,10,100,16,55,0,125,10,124,0,
+    124,10,124,10,100,16,23,0,133,2,25,0,125,12,124,12,
+    144,3,114,182,124,12,124,2,107,6,144,3,114,182,124,13,
+    124,12,55,0,125,13,124,10,100,16,55,0,125,10,124,0,
+    124,10,124,10,100,16,23,0,133,2,25,0,125,12,144,3,
+    113,130,122,46,124,8,100,4,107,8,144,3,114,218,116,0,
+    160,12,116,0,106,8,116,0,160,13,124,13,161,1,25,0,
+    161,1,125,14,110,8,124,8,124,13,25,0,125,14,87,0,
+    110,30,4,0,116,14,107,10,144,4,114,2,1,0,1,0,
+    1,0,124,7,124,13,23,0,125,14,89,0,110,2,88,0,
+    124,9,124,14,55,0,125,9,124,12,144,4,114,36,124,10,
+    100,16,56,0,125,10,110,8,124,9,124,12,55,0,125,9,
+    124,10,100,16,55,0,125,10,113,198,124,9,83,0,41,18,
+    122,102,69,120,112,97,110,100,32,115,104,101,108,108,32,118,
+    97,114,105,97,98,108,101,115,32,111,102,32,116,104,101,32,
+    102,111,114,109,115,32,36,118,97,114,44,32,36,123,118,97,
+    114,125,32,97,110,100,32,37,118,97,114,37,46,10,10,32,
+    32,32,32,85,110,107,110,111,119,110,32,118,97,114,105,97,
+    98,108,101,115,32,97,114,101,32,108,101,102,116,32,117,110,
+    99,104,97,110,103,101,100,46,243,1,0,0,0,36,243,1,
+    0,0,0,37,114,5,0,0,0,78,122,2,95,45,218,5,
+    97,115,99,105,105,243,1,0,0,0,39,243,1,0,0,0,
+    123,243,1,0,0,0,125,90,8,101,110,118,105,114,111,110,
+    98,250,1,36,250,1,37,250,1,39,250,1,123,250,1,125,
+    114,57,0,0,0,114,70,0,0,0,41,15,114,46,0,0,
+    0,114,47,0,0,0,114,37,0,0,0,114,38,0,0,0,
+    218,6,115,116,114,105,110,103,90,13,97,115,99,105,105,95,
+    108,101,116,116,101,114,115,90,6,100,105,103,105,116,115,218,
+    7,103,101,116,97,116,116,114,114,91,0,0,0,114,58,0,
+    0,0,114,73,0,0,0,114,83,0,0,0,114,93,0,0,
+    0,90,8,102,115,100,101,99,111,100,101,114,92,0,0,0,
+    41,15,114,40,0,0,0,114,107,0,0,0,90,8,118,97,
+    114,99,104,97,114,115,90,5,113,117,111,116,101,90,7,112,
+    101,114,99,101,110,116,90,5,98,114,97,99,101,90,6,114,
+    98,114,97,99,101,90,6,100,111,108,108,97,114,114,91,0,
+    0,0,90,3,114,101,115,114,73,0,0,0,90,7,112,97,
+    116,104,108,101,110,218,1,99,218,3,118,97,114,218,5,118,
+    97,108,117,101,114,41,0,0,0,114,41,0,0,0,114,42,
+    0,0,0,114,20,0,0,0,81,1,0,0,115,188,0,0,
+    0,0,4,10,1,10,1,16,1,4,1,8,1,22,1,4,
+    1,4,1,4,1,4,1,4,1,14,2,16,1,4,1,8,
+    1,16,1,4,1,4,1,4,1,4,1,4,1,6,1,12,
+    1,4,1,8,1,10,1,16,1,10,1,16,1,8,1,2,
+    1,10,1,28,1,16,1,12,1,18,1,10,1,26,1,8,
+    1,10,2,16,1,8,1,2,1,14,1,16,1,12,1,14,
+    2,12,1,2,1,10,1,24,2,12,1,16,1,18,1,12,
+    1,10,1,26,1,8,1,12,1,26,1,16,1,8,1,2,
+    1,14,1,16,1,16,1,14,2,12,1,2,1,10,1,24,
+    2,12,1,16,1,22,1,10,2,12,1,8,1,16,1,16,
+    1,8,1,8,1,20,1,2,1,10,1,24,2,12,1,16,
+    1,14,1,8,1,6,1,10,2,8,1,10,1,99,1,0,
+    0,0,0,0,0,0,9,0,0,0,4,0,0,0,67,0,
+    0,0,115,80,1,0,0,116,0,160,1,124,0,161,1,125,
+    0,116,2,124,0,116,3,131,2,114,42,100,1,125,1,100,
+    2,125,2,100,3,125,3,100,4,125,4,100,5,125,5,110,
+    20,100,6,125,1,100,7,125,2,100,8,125,3,100,9,125,
+    4,100,10,125,5,124,0,160,4,124,5,161,1,114,76,124,
+    0,83,0,124,0,160,5,124,2,124,1,161,2,125,0,116,
+    6,124,0,131,1,92,2,125,6,125,0,124,0,160,4,124,
+    1,161,1,114,128,124,6,124,1,55,0,125,6,124,0,160,
+    7,124,1,161,1,125,0,124,0,160,8,124,1,161,1,125,
+    7,100,11,125,8,124,8,116,9,124,7,131,1,107,0,144,
+    1,114,44,124,7,124,8,25,0,114,176,124,7,124,8,25,
+    0,124,3,107,2,114,184,124,7,124,8,61,0,113,142,124,
+    7,124,8,25,0,124,4,107,2,144,1,114,34,124,8,100,
+    11,107,4,114,250,124,7,124,8,100,12,24,0,25,0,124,
+    4,107,3,114,250,124,7,124,8,100,12,24,0,124,8,100,
+    12,23,0,133,2,61,0,124,8,100,12,56,0,125,8,110,
+    38,124,8,100,11,107,2,144,1,114,24,124,6,160,10,124,
+    1,161,1,144,1,114,24,124,7,124,8,61,0,110,8,124,
+    8,100,12,55,0,125,8,113,142,124,8,100,12,55,0,125,
+    8,113,142,124,6,144,1,115,66,124,7,144,1,115,66,124,
+    7,160,11,124,3,161,1,1,0,124,6,124,1,160,12,124,
+    7,161,1,23,0,83,0,41,13,122,48,78,111,114,109,97,
+    108,105,122,101,32,112,97,116,104,44,32,101,108,105,109,105,
+    110,97,116,105,110,103,32,100,111,117,98,108,101,32,115,108,
+    97,115,104,101,115,44,32,101,116,99,46,114,45,0,0,0,
+    114,44,0,0,0,114,77,0,0,0,243,2,0,0,0,46,
+    46,41,2,115,4,0,0,0,92,92,46,92,115,4,0,0,
+    0,92,92,63,92,114,2,0,0,0,114,4,0,0,0,114,
+    0,0,0,0,114,1,0,0,0,41,2,122,4,92,92,46,
+    92,122,4,92,92,63,92,114,5,0,0,0,114,57,0,0,
+    0,41,13,114,46,0,0,0,114,47,0,0,0,114,37,0,
+    0,0,114,38,0,0,0,114,90,0,0,0,114,48,0,0,
+    0,114,10,0,0,0,218,6,108,115,116,114,105,112,114,11,
+    0,0,0,114,58,0,0,0,218,8,101,110,100,115,119,105,
+    116,104,218,6,97,112,112,101,110,100,114,9,0,0,0,41,
+    9,114,40,0,0,0,114,25,0,0,0,114,28,0,0,0,
+    114,23,0,0,0,114,24,0,0,0,90,16,115,112,101,99,
+    105,97,108,95,112,114,101,102,105,120,101,115,218,6,112,114,
+    101,102,105,120,90,5,99,111,109,112,115,114,76,0,0,0,
+    114,41,0,0,0,114,41,0,0,0,114,42,0,0,0,114,
+    21,0,0,0,194,1,0,0,115,70,0,0,0,0,2,10,
+    1,10,1,4,1,4,1,4,1,4,1,6,2,4,1,4,
+    1,4,1,4,1,4,1,10,5,4,1,12,1,12,3,10,
+    1,8,1,10,2,10,1,4,1,14,1,20,1,8,1,14,
+    1,24,1,18,1,10,1,22,1,8,2,10,2,10,2,12,
+    1,10,1,99,1,0,0,0,0,0,0,0,2,0,0,0,
+    3,0,0,0,67,0,0,0,115,64,0,0,0,116,0,160,
+    1,124,0,161,1,125,0,116,2,124,0,131,1,115,56,116,
+    3,124,0,116,4,131,2,114,38,116,0,160,5,161,0,125,
+    1,110,8,116,0,160,6,161,0,125,1,116,7,124,1,124,
+    0,131,2,125,0,116,8,124,0,131,1,83,0,41,1,122,
+    164,82,101,116,117,114,110,32,116,104,101,32,97,98,115,111,
+    108,117,116,101,32,118,101,114,115,105,111,110,32,111,102,32,
+    97,32,112,97,116,104,32,97,115,32,97,32,102,97,108,108,
+    98,97,99,107,32,102,117,110,99,116,105,111,110,32,105,110,
+    32,99,97,115,101,10,32,32,32,32,96,110,116,46,95,103,
+    101,116,102,117,108,108,112,97,116,104,110,97,109,101,96,32,
+    105,115,32,110,111,116,32,97,118,97,105,108,97,98,108,101,
+    32,111,114,32,114,97,105,115,101,115,32,79,83,69,114,114,
+    111,114,46,32,83,101,101,32,98,112,111,45,51,49,48,52,
+    55,32,102,111,114,10,32,32,32,32,109,111,114,101,46,10,
+    10,32,32,32,32,41,9,114,46,0,0,0,114,47,0,0,
+    0,114,8,0,0,0,114,37,0,0,0,114,38,0,0,0,
+    90,7,103,101,116,99,119,100,98,90,6,103,101,116,99,119,
+    100,114,9,0,0,0,114,21,0,0,0,41,2,114,40,0,
+    0,0,90,3,99,119,100,114,41,0,0,0,114,41,0,0,
+    0,114,42,0,0,0,218,17,95,97,98,115,112,97,116,104,
+    95,102,97,108,108,98,97,99,107,243,1,0,0,115,14,0,
+    0,0,0,7,10,1,8,1,10,1,10,2,8,1,10,1,
+    114,117,0,0,0,41,1,218,16,95,103,101,116,102,117,108,
+    108,112,97,116,104,110,97,109,101,99,1,0,0,0,0,0,
+    0,0,1,0,0,0,9,0,0,0,67,0,0,0,115,52,
+    0,0,0,122,14,116,0,116,1,124,0,131,1,131,1,87,
+    0,83,0,4,0,116,2,116,3,102,2,107,10,114,46,1,
+    0,1,0,1,0,116,4,124,0,131,1,6,0,89,0,83,
+    0,88,0,100,1,83,0,41,2,122,38,82,101,116,117,114,
+    110,32,116,104,101,32,97,98,115,111,108,117,116,101,32,118,
+    101,114,115,105,111,110,32,111,102,32,97,32,112,97,116,104,
+    46,78,41,5,114,21,0,0,0,114,118,0,0,0,114,82,
+    0,0,0,114,83,0,0,0,114,117,0,0,0,114,39,0,
+    0,0,114,41,0,0,0,114,41,0,0,0,114,42,0,0,
+    0,114,22,0,0,0,11,2,0,0,115,8,0,0,0,0,
+    2,2,1,14,1,18,1,218,17,103,101,116,119,105,110,100,
+    111,119,115,118,101,114,115,105,111,110,114,71,0,0,0,114,
+    70,0,0,0,99,2,0,0,0,0,0,0,0,17,0,0,
+    0,12,0,0,0,67,0,0,0,115,106,1,0,0,116,0,
+    160,1,124,0,161,1,125,0,116,2,124,0,116,3,131,2,
+    114,34,100,1,125,2,100,2,125,3,100,3,125,4,110,12,
+    100,4,125,2,100,5,125,3,100,6,125,4,124,1,100,7,
+    107,8,114,58,124,3,125,1,124,0,115,70,116,4,100,8,
+    131,1,130,1,116,0,160,1,124,1,161,1,125,1,122,228,
+    116,5,116,6,124,1,131,1,131,1,125,5,116,5,116,6,
+    124,0,131,1,131,1,125,6,116,7,124,5,131,1,92,2,
+    125,7,125,8,116,7,124,6,131,1,92,2,125,9,125,10,
+    116,8,124,7,131,1,116,8,124,9,131,1,107,3,114,162,
+    116,4,100,9,124,9,124,7,102,2,22,0,131,1,130,1,
+    100,10,100,11,132,0,124,8,160,9,124,2,161,1,68,0,
+    131,1,125,11,100,12,100,11,132,0,124,10,160,9,124,2,
+    161,1,68,0,131,1,125,12,100,13,125,13,116,10,124,11,
+    124,12,131,2,68,0,93,36,92,2,125,14,125,15,116,8,
+    124,14,131,1,116,8,124,15,131,1,107,3,114,244,1,0,
+    113,254,124,13,100,14,55,0,125,13,113,216,124,4,103,1,
+    116,11,124,11,131,1,124,13,24,0,20,0,124,12,124,13,
+    100,7,133,2,25,0,23,0,125,16,124,16,144,1,115,40,
+    124,3,87,0,83,0,116,12,124,16,142,0,87,0,83,0,
+    87,0,110,48,4,0,116,13,116,4,116,14,116,15,116,16,
+    102,5,107,10,144,1,114,100,1,0,1,0,1,0,116,17,
+    160,18,100,15,124,0,124,1,161,3,1,0,130,0,89,0,
+    110,2,88,0,100,7,83,0,41,16,122,35,82,101,116,117,
+    114,110,32,97,32,114,101,108,97,116,105,118,101,32,118,101,
+    114,115,105,111,110,32,111,102,32,97,32,112,97,116,104,114,
+    45,0,0,0,114,77,0,0,0,114,112,0,0,0,114,2,
+    0,0,0,114,0,0,0,0,114,1,0,0,0,78,122,17,
+    110,111,32,112,97,116,104,32,115,112,101,99,105,102,105,101,
+    100,122,38,112,97,116,104,32,105,115,32,111,110,32,109,111,
+    117,110,116,32,37,114,44,32,115,116,97,114,116,32,111,110,
+    32,109,111,117,110,116,32,37,114,99,1,0,0,0,0,0,
+    0,0,2,0,0,0,3,0,0,0,83,0,0,0,115,20,
+    0,0,0,103,0,124,0,93,12,125,1,124,1,114,4,124,
+    1,145,2,113,4,83,0,114,41,0,0,0,114,41,0,0,
+    0,169,2,218,2,46,48,218,1,120,114,41,0,0,0,114,
+    41,0,0,0,114,42,0,0,0,218,10,60,108,105,115,116,
+    99,111,109,112,62,52,2,0,0,115,6,0,0,0,6,0,
+    2,0,4,0,122,27,114,101,108,112,97,116,104,46,60,108,
+    111,99,97,108,115,62,46,60,108,105,115,116,99,111,109,112,
+    62,99,1,0,0,0,0,0,0,0,2,0,0,0,3,0,
+    0,0,83,0,0,0,115,20,0,0,0,103,0,124,0,93,
+    12,125,1,124,1,114,4,124,1,145,2,113,4,83,0,114,
+    41,0,0,0,114,41,0,0,0,114,120,0,0,0,114,41,
+    0,0,0,114,41,0,0,0,114,42,0,0,0,114,123,0,
+    0,0,53,2,0,0,115,6,0,0,0,6,0,2,0,4,
+    0,114,5,0,0,0,114,57,0,0,0,114,33,0,0,0,
+    41,19,114,46,0,0,0,114,47,0,0,0,114,37,0,0,
+    0,114,38,0,0,0,114,83,0,0,0,114,22,0,0,0,
+    114,21,0,0,0,114,10,0,0,0,114,7,0,0,0,114,
+    11,0,0,0,218,3,122,105,112,114,58,0,0,0,114,9,
+    0,0,0,114,50,0,0,0,114,51,0,0,0,114,63,0,
+    0,0,218,18,68,101,112,114,101,99,97,116,105,111,110,87,
+    97,114,110,105,110,103,114,64,0,0,0,114,65,0,0,0,
+    41,17,114,40,0,0,0,218,5,115,116,97,114,116,114,25,
+    0,0,0,114,23,0,0,0,114,24,0,0,0,90,9,115,
+    116,97,114,116,95,97,98,115,90,8,112,97,116,104,95,97,
+    98,115,90,11,115,116,97,114,116,95,100,114,105,118,101,90,
+    10,115,116,97,114,116,95,114,101,115,116,90,10,112,97,116,
+    104,95,100,114,105,118,101,90,9,112,97,116,104,95,114,101,
+    115,116,90,10,115,116,97,114,116,95,108,105,115,116,90,9,
+    112,97,116,104,95,108,105,115,116,114,76,0,0,0,90,2,
+    101,49,90,2,101,50,90,8,114,101,108,95,108,105,115,116,
+    114,41,0,0,0,114,41,0,0,0,114,42,0,0,0,114,
+    33,0,0,0,24,2,0,0,115,74,0,0,0,0,2,10,
+    1,10,1,4,1,4,1,6,2,4,1,4,1,4,2,8,
+    1,4,2,4,1,8,2,10,1,2,1,12,1,12,1,12,
+    1,12,1,16,1,4,1,2,0,2,255,8,3,20,1,20,
+    2,4,1,18,1,16,1,4,1,10,2,30,1,6,1,6,
+    1,14,1,26,1,14,1,99,1,0,0,0,0,0,0,0,
+    12,0,0,0,9,0,0,0,3,0,0,0,115,182,1,0,
+    0,124,0,115,12,116,0,100,1,131,1,130,1,116,1,116,
+    2,116,3,106,4,124,0,131,2,131,1,125,0,116,5,124,
+    0,100,2,25,0,116,6,131,2,114,56,100,3,137,2,100,
+    4,137,0,100,5,137,1,110,12,100,6,137,2,100,7,137,
+    0,100,8,137,1,144,1,122,64,135,0,135,2,102,2,100,
+    9,100,10,132,8,124,0,68,0,131,1,125,1,135,2,102,
+    1,100,11,100,10,132,8,124,1,68,0,131,1,125,2,122,
+    28,116,7,135,2,102,1,100,12,100,13,132,8,124,1,68,
+    0,131,1,131,1,92,1,125,3,87,0,110,30,4,0,116,
+    0,107,10,114,168,1,0,1,0,1,0,116,0,100,14,131,
+    1,100,15,130,2,89,0,110,2,88,0,116,8,116,7,100,
+    16,100,13,132,0,124,1,68,0,131,1,131,1,131,1,100,
+    17,107,3,114,204,116,0,100,18,131,1,130,1,116,9,124,
+    0,100,2,25,0,160,10,136,0,136,2,161,2,131,1,92,
+    2,125,4,125,5,124,5,160,11,136,2,161,1,125,6,135,
+    1,102,1,100,19,100,10,132,8,124,6,68,0,131,1,125,
+    6,135,1,102,1,100,20,100,10,132,8,124,2,68,0,131,
+    1,125,2,116,12,124,2,131,1,125,7,116,13,124,2,131,
+    1,125,8,116,14,124,7,131,1,68,0,93,42,92,2,125,
+    9,125,10,124,10,124,8,124,9,25,0,107,3,144,1,114,
+    42,124,6,100,15,124,9,133,2,25,0,125,6,1,0,144,
+    1,113,102,144,1,113,42,124,6,100,15,116,8,124,7,131,
+    1,133,2,25,0,125,6,124,3,144,1,114,116,124,4,136,
+    2,23,0,110,2,124,4,125,11,124,11,136,2,160,15,124,
+    6,161,1,23,0,87,0,83,0,4,0,116,16,116,17,102,
+    2,107,10,144,1,114,176,1,0,1,0,1,0,116,18,106,
+    19,100,22,124,0,158,2,142,0,1,0,130,0,89,0,110,
+    2,88,0,100,15,83,0,41,23,122,68,71,105,118,101,110,
+    32,97,32,115,101,113,117,101,110,99,101,32,111,102,32,112,
+    97,116,104,32,110,97,109,101,115,44,32,114,101,116,117,114,
+    110,115,32,116,104,101,32,108,111,110,103,101,115,116,32,99,
+    111,109,109,111,110,32,115,117,98,45,112,97,116,104,46,122,
+    37,99,111,109,109,111,110,112,97,116,104,40,41,32,97,114,
+    103,32,105,115,32,97,110,32,101,109,112,116,121,32,115,101,
+    113,117,101,110,99,101,114,5,0,0,0,114,45,0,0,0,
+    114,44,0,0,0,114,77,0,0,0,114,2,0,0,0,114,
+    4,0,0,0,114,0,0,0,0,99,1,0,0,0,0,0,
+    0,0,2,0,0,0,7,0,0,0,19,0,0,0,115,32,
+    0,0,0,103,0,124,0,93,24,125,1,116,0,124,1,160,
+    1,136,0,136,1,161,2,160,2,161,0,131,1,145,2,113,
+    4,83,0,114,41,0,0,0,41,3,114,10,0,0,0,114,
+    48,0,0,0,114,49,0,0,0,41,2,114,121,0,0,0,
+    114,69,0,0,0,41,2,114,28,0,0,0,114,25,0,0,
+    0,114,41,0,0,0,114,42,0,0,0,114,123,0,0,0,
+    97,2,0,0,115,4,0,0,0,6,0,2,0,122,30,99,
+    111,109,109,111,110,112,97,116,104,46,60,108,111,99,97,108,
+    115,62,46,60,108,105,115,116,99,111,109,112,62,99,1,0,
+    0,0,0,0,0,0,3,0,0,0,5,0,0,0,19,0,
+    0,0,115,26,0,0,0,103,0,124,0,93,18,92,2,125,
+    1,125,2,124,2,160,0,136,0,161,1,145,2,113,4,83,
+    0,114,41,0,0,0,114,80,0,0,0,169,3,114,121,0,
+    0,0,114,75,0,0,0,114,69,0,0,0,169,1,114,25,
+    0,0,0,114,41,0,0,0,114,42,0,0,0,114,123,0,
+    0,0,98,2,0,0,115,4,0,0,0,6,0,6,0,99,
+    1,0,0,0,0,0,0,0,3,0,0,0,4,0,0,0,
+    51,0,0,0,115,34,0,0,0,124,0,93,26,92,2,125,
+    1,125,2,124,2,100,0,100,1,133,2,25,0,136,0,107,
+    2,86,0,1,0,113,2,100,0,83,0,41,2,78,114,57,
+    0,0,0,114,41,0,0,0,114,127,0,0,0,114,128,0,
+    0,0,114,41,0,0,0,114,42,0,0,0,218,9,60,103,
+    101,110,101,120,112,114,62,101,2,0,0,115,4,0,0,0,
+    4,0,6,0,122,29,99,111,109,109,111,110,112,97,116,104,
+    46,60,108,111,99,97,108,115,62,46,60,103,101,110,101,120,
+    112,114,62,122,37,67,97,110,39,116,32,109,105,120,32,97,
+    98,115,111,108,117,116,101,32,97,110,100,32,114,101,108,97,
+    116,105,118,101,32,112,97,116,104,115,78,99,1,0,0,0,
+    0,0,0,0,3,0,0,0,3,0,0,0,115,0,0,0,
+    115,22,0,0,0,124,0,93,14,92,2,125,1,125,2,124,
+    1,86,0,1,0,113,2,100,0,83,0,169,1,78,114,41,
+    0,0,0,114,127,0,0,0,114,41,0,0,0,114,41,0,
+    0,0,114,42,0,0,0,114,129,0,0,0,108,2,0,0,
+    115,4,0,0,0,4,0,6,0,114,57,0,0,0,122,31,
+    80,97,116,104,115,32,100,111,110,39,116,32,104,97,118,101,
+    32,116,104,101,32,115,97,109,101,32,100,114,105,118,101,99,
+    1,0,0,0,0,0,0,0,2,0,0,0,4,0,0,0,
+    19,0,0,0,115,28,0,0,0,103,0,124,0,93,20,125,
+    1,124,1,114,4,124,1,136,0,107,3,114,4,124,1,145,
+    2,113,4,83,0,114,41,0,0,0,114,41,0,0,0,169,
+    2,114,121,0,0,0,114,109,0,0,0,169,1,114,23,0,
+    0,0,114,41,0,0,0,114,42,0,0,0,114,123,0,0,
+    0,113,2,0,0,115,8,0,0,0,6,0,2,0,4,0,
+    8,0,99,1,0,0,0,0,0,0,0,2,0,0,0,5,
+    0,0,0,19,0,0,0,115,30,0,0,0,103,0,124,0,
+    93,22,125,1,135,0,102,1,100,0,100,1,132,8,124,1,
+    68,0,131,1,145,2,113,4,83,0,41,2,99,1,0,0,
+    0,0,0,0,0,2,0,0,0,4,0,0,0,19,0,0,
+    0,115,28,0,0,0,103,0,124,0,93,20,125,1,124,1,
+    114,4,124,1,136,0,107,3,114,4,124,1,145,2,113,4,
+    83,0,114,41,0,0,0,114,41,0,0,0,114,131,0,0,
+    0,114,132,0,0,0,114,41,0,0,0,114,42,0,0,0,
+    114,123,0,0,0,115,2,0,0,115,8,0,0,0,6,0,
+    2,0,4,0,8,0,122,41,99,111,109,109,111,110,112,97,
+    116,104,46,60,108,111,99,97,108,115,62,46,60,108,105,115,
+    116,99,111,109,112,62,46,60,108,105,115,116,99,111,109,112,
+    62,114,41,0,0,0,41,2,114,121,0,0,0,114,56,0,
+    0,0,114,132,0,0,0,114,41,0,0,0,114,42,0,0,
+    0,114,123,0,0,0,115,2,0,0,115,4,0,0,0,6,
+    0,2,0,114,34,0,0,0,41,1,114,34,0,0,0,41,
+    20,114,83,0,0,0,218,5,116,117,112,108,101,114,62,0,
+    0,0,114,46,0,0,0,114,47,0,0,0,114,37,0,0,
+    0,114,38,0,0,0,218,3,115,101,116,114,58,0,0,0,
+    114,10,0,0,0,114,48,0,0,0,114,11,0,0,0,218,
+    3,109,105,110,218,3,109,97,120,218,9,101,110,117,109,101,
+    114,97,116,101,114,9,0,0,0,114,50,0,0,0,114,51,
+    0,0,0,114,64,0,0,0,114,65,0,0,0,41,12,114,
+    66,0,0,0,90,11,100,114,105,118,101,115,112,108,105,116,
+    115,90,11,115,112,108,105,116,95,112,97,116,104,115,114,8,
+    0,0,0,114,95,0,0,0,114,40,0,0,0,90,6,99,
+    111,109,109,111,110,90,2,115,49,90,2,115,50,114,76,0,
+    0,0,114,109,0,0,0,114,116,0,0,0,114,41,0,0,
+    0,41,3,114,28,0,0,0,114,23,0,0,0,114,25,0,
+    0,0,114,42,0,0,0,114,34,0,0,0,80,2,0,0,
+    115,70,0,0,0,0,3,4,1,8,2,16,1,14,1,4,
+    1,4,1,6,2,4,1,4,1,4,2,4,1,20,1,18,
+    2,2,1,28,1,14,1,16,5,26,1,8,2,24,1,10,
+    1,18,2,18,1,8,1,8,1,16,1,14,1,12,1,10,
+    2,16,2,18,1,16,1,20,1,14,1,41,2,233,6,0,
+    0,0,114,5,0,0,0,41,1,218,17,95,103,101,116,102,
+    105,110,97,108,112,97,116,104,110,97,109,101,99,1,0,0,
+    0,0,0,0,0,1,0,0,0,3,0,0,0,67,0,0,
+    0,115,12,0,0,0,116,0,116,1,124,0,131,1,131,1,
+    83,0,114,130,0,0,0,41,2,114,7,0,0,0,114,22,
+    0,0,0,41,1,218,1,102,114,41,0,0,0,114,41,0,
+    0,0,114,42,0,0,0,114,139,0,0,0,145,2,0,0,
+    115,2,0,0,0,0,1,114,139,0,0,0,41,1,218,6,
+    95,105,115,100,105,114,41,46,218,7,95,95,100,111,99,95,
+    95,114,23,0,0,0,114,24,0,0,0,114,29,0,0,0,
+    114,25,0,0,0,114,26,0,0,0,114,28,0,0,0,114,
+    27,0,0,0,114,30,0,0,0,114,46,0,0,0,218,3,
+    115,121,115,114,84,0,0,0,114,64,0,0,0,90,7,95,
+    95,97,108,108,95,95,114,43,0,0,0,114,7,0,0,0,
+    114,8,0,0,0,114,9,0,0,0,114,10,0,0,0,114,
+    11,0,0,0,114,12,0,0,0,114,78,0,0,0,114,13,
+    0,0,0,114,14,0,0,0,114,15,0,0,0,114,16,0,
+    0,0,90,2,110,116,114,86,0,0,0,218,11,73,109,112,
+    111,114,116,69,114,114,111,114,114,18,0,0,0,114,19,0,
+    0,0,114,20,0,0,0,114,21,0,0,0,114,117,0,0,
+    0,114,118,0,0,0,114,22,0,0,0,114,31,0,0,0,
+    218,7,104,97,115,97,116,116,114,114,119,0,0,0,114,32,
+    0,0,0,114,33,0,0,0,114,34,0,0,0,114,139,0,
+    0,0,114,51,0,0,0,114,141,0,0,0,114,17,0,0,
+    0,114,41,0,0,0,114,41,0,0,0,114,41,0,0,0,
+    114,42,0,0,0,218,8,60,109,111,100,117,108,101,62,2,
+    0,0,0,115,178,0,0,0,4,9,4,1,4,1,4,1,
+    4,1,4,1,4,1,4,1,4,2,8,1,8,1,8,1,
+    8,1,8,2,12,1,2,0,2,0,2,0,2,0,2,1,
+    2,0,2,0,2,0,2,0,2,0,2,0,2,1,2,0,
+    2,0,2,0,2,0,2,1,2,0,2,0,2,0,2,0,
+    2,0,2,1,2,0,2,0,2,0,2,0,2,1,2,0,
+    2,0,2,0,2,250,4,8,8,10,8,23,8,8,8,47,
+    8,56,8,23,8,6,10,5,8,7,8,7,8,12,8,18,
+    2,1,16,1,16,1,10,1,8,27,8,50,8,113,8,49,
+    8,17,2,1,16,2,16,1,10,3,8,8,4,2,12,1,
+    14,255,2,3,12,56,8,53,2,3,22,1,14,2,8,1,
+    20,5,14,4,2,5,16,1,16,2,
+};
@@ -0,0 +1,1846 @@
+/* Auto-generated by Programs/_freeze_importlib.c */
+const unsigned char _Py_M__os[] = {
+    99,0,0,0,0,0,0,0,0,0,0,0,0,19,0,0,
+    0,64,0,0,0,115,198,6,0,0,100,0,90,0,100,1,
+    100,2,108,1,90,1,100,1,100,2,108,2,90,2,100,1,
+    100,2,108,3,90,4,101,2,106,5,90,6,100,3,100,4,
+    100,5,100,6,100,7,100,8,100,9,100,10,100,11,100,12,
+    100,13,100,14,100,15,100,16,100,17,100,18,100,19,100,20,
+    100,21,103,19,90,7,100,22,100,23,132,0,90,8,100,24,
+    100,25,132,0,90,9,100,26,101,6,107,6,114,236,100,26,
+    90,10,100,27,90,11,100,1,100,28,108,12,84,0,122,26,
+    100,1,100,29,108,12,109,13,90,13,1,0,101,7,160,14,
+    100,30,161,1,1,0,87,0,110,20,4,0,101,15,107,10,
+    114,162,1,0,1,0,1,0,89,0,110,2,88,0,100,1,
+    100,2,108,16,90,17,122,16,100,1,100,31,108,12,109,18,
+    90,18,1,0,87,0,110,20,4,0,101,15,107,10,114,208,
+    1,0,1,0,1,0,89,0,110,2,88,0,100,1,100,2,
+    108,12,90,12,101,7,160,19,101,9,101,12,131,1,161,1,
+    1,0,91,12,110,158,100,32,101,6,107,6,144,1,114,130,
+    100,32,90,10,100,33,90,11,100,1,100,28,108,20,84,0,
+    122,26,100,1,100,29,108,20,109,13,90,13,1,0,101,7,
+    160,14,100,30,161,1,1,0,87,0,110,22,4,0,101,15,
+    107,10,144,1,114,54,1,0,1,0,1,0,89,0,110,2,
+    88,0,100,1,100,2,108,21,90,17,100,1,100,2,108,20,
+    90,20,101,7,160,19,101,9,101,20,131,1,161,1,1,0,
+    91,20,122,16,100,1,100,31,108,20,109,18,90,18,1,0,
+    87,0,110,22,4,0,101,15,107,10,144,1,114,126,1,0,
+    1,0,1,0,89,0,110,2,88,0,110,8,101,15,100,34,
+    131,1,130,1,101,17,101,2,106,22,100,35,60,0,100,1,
+    100,36,108,23,109,24,90,24,109,25,90,25,109,26,90,26,
+    109,27,90,27,109,28,90,28,109,29,90,29,109,30,90,30,
+    109,31,90,31,1,0,91,6,101,8,100,37,131,1,144,3,
+    114,190,101,32,131,0,90,33,100,38,100,39,132,0,90,34,
+    101,35,131,0,90,36,101,34,100,40,100,41,131,2,1,0,
+    101,34,100,42,100,43,131,2,1,0,101,34,100,44,100,45,
+    131,2,1,0,101,34,100,46,100,47,131,2,1,0,101,34,
+    100,48,100,49,131,2,1,0,101,34,100,50,100,51,131,2,
+    1,0,101,34,100,52,100,53,131,2,1,0,101,34,100,54,
+    100,55,131,2,1,0,101,34,100,56,100,57,131,2,1,0,
+    101,34,100,58,100,59,131,2,1,0,101,34,100,60,100,61,
+    131,2,1,0,101,34,100,62,100,63,131,2,1,0,101,34,
+    100,64,100,65,131,2,1,0,101,34,100,66,100,67,131,2,
+    1,0,101,34,100,66,100,68,131,2,1,0,101,34,100,69,
+    100,49,131,2,1,0,101,36,90,37,101,35,131,0,90,36,
+    101,34,100,40,100,41,131,2,1,0,101,36,90,38,101,35,
+    131,0,90,36,101,34,100,70,100,71,131,2,1,0,101,34,
+    100,72,100,43,131,2,1,0,101,34,100,73,100,45,131,2,
+    1,0,101,34,100,74,100,75,131,2,1,0,101,34,100,74,
+    100,76,131,2,1,0,101,34,100,77,100,78,131,2,1,0,
+    101,36,160,39,101,3,161,1,1,0,101,34,100,79,100,80,
+    131,2,1,0,101,34,100,81,100,49,131,2,1,0,101,34,
+    100,82,100,49,131,2,1,0,101,34,100,83,100,84,131,2,
+    1,0,101,8,100,85,131,1,144,3,114,38,101,8,100,86,
+    131,1,144,3,114,38,101,34,100,87,100,85,131,2,1,0,
+    101,36,90,40,101,35,131,0,90,36,101,34,100,40,100,41,
+    131,2,1,0,101,34,100,44,100,45,131,2,1,0,101,34,
+    100,46,100,47,131,2,1,0,101,34,100,88,100,89,131,2,
+    1,0,101,34,100,90,100,43,131,2,1,0,101,8,100,91,
+    131,1,144,3,114,118,101,34,100,92,100,45,131,2,1,0,
+    101,34,100,50,100,51,131,2,1,0,101,34,100,93,100,49,
+    131,2,1,0,101,34,100,94,100,47,131,2,1,0,101,34,
+    100,46,100,47,131,2,1,0,101,34,100,69,100,49,131,2,
+    1,0,101,34,100,95,100,47,131,2,1,0,101,36,90,41,
+    91,36,91,18,91,33,91,34,100,1,90,42,100,96,90,43,
+    100,97,90,44,100,184,100,100,100,101,132,1,90,45,100,102,
+    100,103,132,0,90,46,100,104,100,105,132,0,90,47,101,7,
+    160,19,100,101,100,103,100,105,103,3,161,1,1,0,100,185,
+    100,107,100,108,132,1,90,48,101,7,160,14,100,108,161,1,
+    1,0,101,49,101,3,104,2,101,37,107,1,144,4,114,72,
+    101,50,101,3,104,2,101,40,107,1,144,4,114,72,100,186,
+    100,99,100,2,100,110,156,2,100,111,100,112,132,3,90,51,
+    100,113,100,114,132,0,90,52,101,7,160,14,100,112,161,1,
+    1,0,100,115,100,116,132,0,90,53,100,117,100,118,132,0,
+    90,54,100,119,100,120,132,0,90,55,100,121,100,122,132,0,
+    90,56,100,123,100,124,132,0,90,57,100,125,100,126,132,0,
+    90,58,101,7,160,19,100,116,100,118,100,120,100,122,100,124,
+    100,126,103,6,161,1,1,0,100,187,100,127,100,128,132,1,
+    90,59,100,188,100,129,100,18,132,1,90,60,100,1,100,130,
+    108,61,109,62,90,62,1,0,71,0,100,131,100,132,132,0,
+    100,132,101,62,131,3,90,63,122,8,101,64,90,65,87,0,
+    110,30,4,0,101,66,107,10,144,4,114,228,1,0,1,0,
+    1,0,100,133,100,134,132,0,90,65,89,0,110,22,88,0,
+    100,135,101,7,107,7,144,4,114,250,101,7,160,14,100,135,
+    161,1,1,0,122,8,101,67,90,68,87,0,110,30,4,0,
+    101,66,107,10,144,5,114,32,1,0,1,0,1,0,100,136,
+    100,134,132,0,90,68,89,0,110,22,88,0,100,137,101,7,
+    107,7,144,5,114,54,101,7,160,14,100,137,161,1,1,0,
+    100,138,100,139,132,0,90,69,101,69,131,0,90,70,91,69,
+    100,189,100,140,100,141,132,1,90,71,101,10,100,32,107,3,
+    90,72,101,7,160,19,100,142,161,1,1,0,101,72,144,5,
+    114,156,100,143,100,144,132,0,90,73,101,63,101,70,106,74,
+    101,73,101,75,101,73,101,75,101,65,101,68,131,7,90,76,
+    91,73,100,190,100,145,100,146,132,1,90,77,101,7,160,19,
+    100,147,161,1,1,0,100,148,100,149,132,0,90,78,101,78,
+    131,0,92,2,90,79,90,80,91,78,101,8,100,150,131,1,
+    144,6,114,36,101,8,100,151,131,1,144,6,115,36,101,8,
+    100,152,131,1,144,6,114,36,100,1,90,81,100,96,4,0,
+    90,82,90,83,101,7,160,19,100,153,100,154,100,155,103,3,
+    161,1,1,0,100,156,100,157,132,0,90,84,100,158,100,151,
+    132,0,90,85,100,159,100,160,132,0,90,86,100,161,100,162,
+    132,0,90,87,100,163,100,164,132,0,90,88,101,7,160,19,
+    100,151,100,160,100,162,100,164,103,4,161,1,1,0,101,8,
+    100,151,131,1,144,6,114,76,100,165,100,166,132,0,90,89,
+    100,167,100,168,132,0,90,90,101,7,160,19,100,166,100,168,
+    103,2,161,1,1,0,101,8,100,162,131,1,144,6,114,116,
+    100,169,100,170,132,0,90,91,100,171,100,172,132,0,90,92,
+    101,7,160,19,100,170,100,172,103,2,161,1,1,0,100,191,
+    100,175,100,20,132,1,90,93,71,0,100,176,100,177,132,0,
+    100,177,131,2,90,94,100,178,100,19,132,0,90,95,100,179,
+    100,180,132,0,90,96,101,8,100,181,131,1,144,6,115,176,
+    101,96,90,97,100,181,101,97,95,98,71,0,100,182,100,183,
+    132,0,100,183,101,1,106,99,131,3,90,100,100,2,83,0,
+    41,192,97,78,4,0,0,79,83,32,114,111,117,116,105,110,
+    101,115,32,102,111,114,32,78,84,32,111,114,32,80,111,115,
+    105,120,32,100,101,112,101,110,100,105,110,103,32,111,110,32,
+    119,104,97,116,32,115,121,115,116,101,109,32,119,101,39,114,
+    101,32,111,110,46,10,10,84,104,105,115,32,101,120,112,111,
+    114,116,115,58,10,32,32,45,32,97,108,108,32,102,117,110,
+    99,116,105,111,110,115,32,102,114,111,109,32,112,111,115,105,
+    120,32,111,114,32,110,116,44,32,101,46,103,46,32,117,110,
+    108,105,110,107,44,32,115,116,97,116,44,32,101,116,99,46,
+    10,32,32,45,32,111,115,46,112,97,116,104,32,105,115,32,
+    101,105,116,104,101,114,32,112,111,115,105,120,112,97,116,104,
+    32,111,114,32,110,116,112,97,116,104,10,32,32,45,32,111,
+    115,46,110,97,109,101,32,105,115,32,101,105,116,104,101,114,
+    32,39,112,111,115,105,120,39,32,111,114,32,39,110,116,39,
+    10,32,32,45,32,111,115,46,99,117,114,100,105,114,32,105,
+    115,32,97,32,115,116,114,105,110,103,32,114,101,112,114,101,
+    115,101,110,116,105,110,103,32,116,104,101,32,99,117,114,114,
+    101,110,116,32,100,105,114,101,99,116,111,114,121,32,40,97,
+    108,119,97,121,115,32,39,46,39,41,10,32,32,45,32,111,
+    115,46,112,97,114,100,105,114,32,105,115,32,97,32,115,116,
+    114,105,110,103,32,114,101,112,114,101,115,101,110,116,105,110,
+    103,32,116,104,101,32,112,97,114,101,110,116,32,100,105,114,
+    101,99,116,111,114,121,32,40,97,108,119,97,121,115,32,39,
+    46,46,39,41,10,32,32,45,32,111,115,46,115,101,112,32,
+    105,115,32,116,104,101,32,40,111,114,32,97,32,109,111,115,
+    116,32,99,111,109,109,111,110,41,32,112,97,116,104,110,97,
+    109,101,32,115,101,112,97,114,97,116,111,114,32,40,39,47,
+    39,32,111,114,32,39,92,92,39,41,10,32,32,45,32,111,
+    115,46,101,120,116,115,101,112,32,105,115,32,116,104,101,32,
+    101,120,116,101,110,115,105,111,110,32,115,101,112,97,114,97,
+    116,111,114,32,40,97,108,119,97,121,115,32,39,46,39,41,
+    10,32,32,45,32,111,115,46,97,108,116,115,101,112,32,105,
+    115,32,116,104,101,32,97,108,116,101,114,110,97,116,101,32,
+    112,97,116,104,110,97,109,101,32,115,101,112,97,114,97,116,
+    111,114,32,40,78,111,110,101,32,111,114,32,39,47,39,41,
+    10,32,32,45,32,111,115,46,112,97,116,104,115,101,112,32,
+    105,115,32,116,104,101,32,99,111,109,112,111,110,101,110,116,
+    32,115,101,112,97,114,97,116,111,114,32,117,115,101,100,32,
+    105,110,32,36,80,65,84,72,32,101,116,99,10,32,32,45,
+    32,111,115,46,108,105,110,101,115,101,112,32,105,115,32,116,
+    104,101,32,108,105,110,101,32,115,101,112,97,114,97,116,111,
+    114,32,105,110,32,116,101,120,116,32,102,105,108,101,115,32,
+    40,39,92,114,39,32,111,114,32,39,92,110,39,32,111,114,
+    32,39,92,114,92,110,39,41,10,32,32,45,32,111,115,46,
+    100,101,102,112,97,116,104,32,105,115,32,116,104,101,32,100,
+    101,102,97,117,108,116,32,115,101,97,114,99,104,32,112,97,
+    116,104,32,102,111,114,32,101,120,101,99,117,116,97,98,108,
+    101,115,10,32,32,45,32,111,115,46,100,101,118,110,117,108,
+    108,32,105,115,32,116,104,101,32,102,105,108,101,32,112,97,
+    116,104,32,111,102,32,116,104,101,32,110,117,108,108,32,100,
+    101,118,105,99,101,32,40,39,47,100,101,118,47,110,117,108,
+    108,39,44,32,101,116,99,46,41,10,10,80,114,111,103,114,
+    97,109,115,32,116,104,97,116,32,105,109,112,111,114,116,32,
+    97,110,100,32,117,115,101,32,39,111,115,39,32,115,116,97,
+    110,100,32,97,32,98,101,116,116,101,114,32,99,104,97,110,
+    99,101,32,111,102,32,98,101,105,110,103,10,112,111,114,116,
+    97,98,108,101,32,98,101,116,119,101,101,110,32,100,105,102,
+    102,101,114,101,110,116,32,112,108,97,116,102,111,114,109,115,
+    46,32,32,79,102,32,99,111,117,114,115,101,44,32,116,104,
+    101,121,32,109,117,115,116,32,116,104,101,110,10,111,110,108,
+    121,32,117,115,101,32,102,117,110,99,116,105,111,110,115,32,
+    116,104,97,116,32,97,114,101,32,100,101,102,105,110,101,100,
+    32,98,121,32,97,108,108,32,112,108,97,116,102,111,114,109,
+    115,32,40,101,46,103,46,44,32,117,110,108,105,110,107,10,
+    97,110,100,32,111,112,101,110,100,105,114,41,44,32,97,110,
+    100,32,108,101,97,118,101,32,97,108,108,32,112,97,116,104,
+    110,97,109,101,32,109,97,110,105,112,117,108,97,116,105,111,
+    110,32,116,111,32,111,115,46,112,97,116,104,10,40,101,46,
+    103,46,44,32,115,112,108,105,116,32,97,110,100,32,106,111,
+    105,110,41,46,10,233,0,0,0,0,78,218,6,97,108,116,
+    115,101,112,218,6,99,117,114,100,105,114,218,6,112,97,114,
+    100,105,114,218,3,115,101,112,218,7,112,97,116,104,115,101,
+    112,218,7,108,105,110,101,115,101,112,218,7,100,101,102,112,
+    97,116,104,218,4,110,97,109,101,218,4,112,97,116,104,218,
+    7,100,101,118,110,117,108,108,218,8,83,69,69,75,95,83,
+    69,84,218,8,83,69,69,75,95,67,85,82,218,8,83,69,
+    69,75,95,69,78,68,218,8,102,115,101,110,99,111,100,101,
+    218,8,102,115,100,101,99,111,100,101,218,13,103,101,116,95,
+    101,120,101,99,95,112,97,116,104,218,6,102,100,111,112,101,
+    110,218,5,112,111,112,101,110,218,6,101,120,116,115,101,112,
+    99,1,0,0,0,0,0,0,0,1,0,0,0,2,0,0,
+    0,67,0,0,0,115,10,0,0,0,124,0,116,0,131,0,
+    107,6,83,0,169,1,78,41,1,218,7,103,108,111,98,97,
+    108,115,41,1,114,8,0,0,0,169,0,114,22,0,0,0,
+    250,11,60,102,114,111,122,101,110,32,111,115,62,218,7,95,
+    101,120,105,115,116,115,37,0,0,0,115,2,0,0,0,0,
+    1,114,24,0,0,0,99,1,0,0,0,0,0,0,0,1,
+    0,0,0,8,0,0,0,67,0,0,0,115,56,0,0,0,
+    122,12,116,0,124,0,106,1,131,1,87,0,83,0,4,0,
+    116,2,107,10,114,50,1,0,1,0,1,0,100,1,100,2,
+    132,0,116,3,124,0,131,1,68,0,131,1,6,0,89,0,
+    83,0,88,0,100,0,83,0,41,3,78,99,1,0,0,0,
+    0,0,0,0,2,0,0,0,4,0,0,0,83,0,0,0,
+    115,28,0,0,0,103,0,124,0,93,20,125,1,124,1,100,
+    0,25,0,100,1,107,3,114,4,124,1,145,2,113,4,83,
+    0,41,2,114,0,0,0,0,218,1,95,114,22,0,0,0,
+    41,2,218,2,46,48,218,1,110,114,22,0,0,0,114,22,
+    0,0,0,114,23,0,0,0,218,10,60,108,105,115,116,99,
+    111,109,112,62,44,0,0,0,115,6,0,0,0,6,0,2,
+    0,12,0,122,37,95,103,101,116,95,101,120,112,111,114,116,
+    115,95,108,105,115,116,46,60,108,111,99,97,108,115,62,46,
+    60,108,105,115,116,99,111,109,112,62,41,4,218,4,108,105,
+    115,116,218,7,95,95,97,108,108,95,95,218,14,65,116,116,
+    114,105,98,117,116,101,69,114,114,111,114,218,3,100,105,114,
+    41,1,90,6,109,111,100,117,108,101,114,22,0,0,0,114,
+    22,0,0,0,114,23,0,0,0,218,17,95,103,101,116,95,
+    101,120,112,111,114,116,115,95,108,105,115,116,40,0,0,0,
+    115,8,0,0,0,0,1,2,1,12,1,14,1,114,33,0,
+    0,0,218,5,112,111,115,105,120,250,1,10,41,1,218,1,
+    42,41,1,218,5,95,101,120,105,116,114,37,0,0,0,41,
+    1,218,15,95,104,97,118,101,95,102,117,110,99,116,105,111,
+    110,115,218,2,110,116,122,2,13,10,122,27,110,111,32,111,
+    115,32,115,112,101,99,105,102,105,99,32,109,111,100,117,108,
+    101,32,102,111,117,110,100,122,7,111,115,46,112,97,116,104,
+    41,8,114,2,0,0,0,114,3,0,0,0,114,4,0,0,
+    0,114,5,0,0,0,114,7,0,0,0,114,19,0,0,0,
+    114,1,0,0,0,114,10,0,0,0,114,38,0,0,0,99,
+    2,0,0,0,0,0,0,0,2,0,0,0,4,0,0,0,
+    67,0,0,0,115,34,0,0,0,124,1,116,0,107,6,114,
+    30,124,0,116,1,107,6,114,30,116,2,160,3,116,0,124,
+    1,25,0,161,1,1,0,100,0,83,0,114,20,0,0,0,
+    41,4,218,8,95,103,108,111,98,97,108,115,114,38,0,0,
+    0,218,4,95,115,101,116,218,3,97,100,100,41,2,218,3,
+    115,116,114,90,2,102,110,114,22,0,0,0,114,22,0,0,
+    0,114,23,0,0,0,218,4,95,97,100,100,100,0,0,0,
+    115,4,0,0,0,0,1,16,1,114,44,0,0,0,90,14,
+    72,65,86,69,95,70,65,67,67,69,83,83,65,84,90,6,
+    97,99,99,101,115,115,90,13,72,65,86,69,95,70,67,72,
+    77,79,68,65,84,90,5,99,104,109,111,100,90,13,72,65,
+    86,69,95,70,67,72,79,87,78,65,84,90,5,99,104,111,
+    119,110,90,12,72,65,86,69,95,70,83,84,65,84,65,84,
+    218,4,115,116,97,116,90,14,72,65,86,69,95,70,85,84,
+    73,77,69,83,65,84,90,5,117,116,105,109,101,90,11,72,
+    65,86,69,95,76,73,78,75,65,84,90,4,108,105,110,107,
+    90,12,72,65,86,69,95,77,75,68,73,82,65,84,218,5,
+    109,107,100,105,114,90,13,72,65,86,69,95,77,75,70,73,
+    70,79,65,84,90,6,109,107,102,105,102,111,90,12,72,65,
+    86,69,95,77,75,78,79,68,65,84,90,5,109,107,110,111,
+    100,90,11,72,65,86,69,95,79,80,69,78,65,84,218,4,
+    111,112,101,110,90,15,72,65,86,69,95,82,69,65,68,76,
+    73,78,75,65,84,90,8,114,101,97,100,108,105,110,107,90,
+    13,72,65,86,69,95,82,69,78,65,77,69,65,84,218,6,
+    114,101,110,97,109,101,90,14,72,65,86,69,95,83,89,77,
+    76,73,78,75,65,84,90,7,115,121,109,108,105,110,107,90,
+    13,72,65,86,69,95,85,78,76,73,78,75,65,84,90,6,
+    117,110,108,105,110,107,218,5,114,109,100,105,114,90,14,72,
+    65,86,69,95,85,84,73,77,69,78,83,65,84,90,11,72,
+    65,86,69,95,70,67,72,68,73,82,90,5,99,104,100,105,
+    114,90,11,72,65,86,69,95,70,67,72,77,79,68,90,11,
+    72,65,86,69,95,70,67,72,79,87,78,90,14,72,65,86,
+    69,95,70,68,79,80,69,78,68,73,82,90,7,108,105,115,
+    116,100,105,114,218,7,115,99,97,110,100,105,114,90,12,72,
+    65,86,69,95,70,69,88,69,67,86,69,218,6,101,120,101,
+    99,118,101,90,14,72,65,86,69,95,70,84,82,85,78,67,
+    65,84,69,90,8,116,114,117,110,99,97,116,101,90,13,72,
+    65,86,69,95,70,85,84,73,77,69,78,83,90,12,72,65,
+    86,69,95,70,85,84,73,77,69,83,90,14,72,65,86,69,
+    95,70,80,65,84,72,67,79,78,70,90,8,112,97,116,104,
+    99,111,110,102,90,7,115,116,97,116,118,102,115,90,8,102,
+    115,116,97,116,118,102,115,90,13,72,65,86,69,95,70,83,
+    84,65,84,86,70,83,90,13,72,65,86,69,95,76,67,72,
+    70,76,65,71,83,90,7,99,104,102,108,97,103,115,90,11,
+    72,65,86,69,95,76,67,72,77,79,68,90,6,108,99,104,
+    111,119,110,90,11,72,65,86,69,95,76,67,72,79,87,78,
+    90,12,72,65,86,69,95,76,85,84,73,77,69,83,90,10,
+    72,65,86,69,95,76,83,84,65,84,90,10,77,83,95,87,
+    73,78,68,79,87,83,233,1,0,0,0,233,2,0,0,0,
+    233,255,1,0,0,70,99,3,0,0,0,0,0,0,0,6,
+    0,0,0,8,0,0,0,67,0,0,0,115,180,0,0,0,
+    116,0,160,1,124,0,161,1,92,2,125,3,125,4,124,4,
+    115,32,116,0,160,1,124,3,161,1,92,2,125,3,125,4,
+    124,3,114,124,124,4,114,124,116,0,160,2,124,3,161,1,
+    115,124,122,16,116,3,124,3,124,2,100,1,141,2,1,0,
+    87,0,110,20,4,0,116,4,107,10,114,86,1,0,1,0,
+    1,0,89,0,110,2,88,0,116,5,125,5,116,6,124,4,
+    116,7,131,2,114,112,116,7,116,5,100,2,131,2,125,5,
+    124,4,124,5,107,2,114,124,100,3,83,0,122,14,116,8,
+    124,0,124,1,131,2,1,0,87,0,110,36,4,0,116,9,
+    107,10,114,174,1,0,1,0,1,0,124,2,114,168,116,0,
+    160,10,124,0,161,1,115,170,130,0,89,0,110,2,88,0,
+    100,3,83,0,41,4,97,139,1,0,0,109,97,107,101,100,
+    105,114,115,40,110,97,109,101,32,91,44,32,109,111,100,101,
+    61,48,111,55,55,55,93,91,44,32,101,120,105,115,116,95,
+    111,107,61,70,97,108,115,101,93,41,10,10,32,32,32,32,
+    83,117,112,101,114,45,109,107,100,105,114,59,32,99,114,101,
+    97,116,101,32,97,32,108,101,97,102,32,100,105,114,101,99,
+    116,111,114,121,32,97,110,100,32,97,108,108,32,105,110,116,
+    101,114,109,101,100,105,97,116,101,32,111,110,101,115,46,32,
+    32,87,111,114,107,115,32,108,105,107,101,10,32,32,32,32,
+    109,107,100,105,114,44,32,101,120,99,101,112,116,32,116,104,
+    97,116,32,97,110,121,32,105,110,116,101,114,109,101,100,105,
+    97,116,101,32,112,97,116,104,32,115,101,103,109,101,110,116,
+    32,40,110,111,116,32,106,117,115,116,32,116,104,101,32,114,
+    105,103,104,116,109,111,115,116,41,10,32,32,32,32,119,105,
+    108,108,32,98,101,32,99,114,101,97,116,101,100,32,105,102,
+    32,105,116,32,100,111,101,115,32,110,111,116,32,101,120,105,
+    115,116,46,32,73,102,32,116,104,101,32,116,97,114,103,101,
+    116,32,100,105,114,101,99,116,111,114,121,32,97,108,114,101,
+    97,100,121,10,32,32,32,32,101,120,105,115,116,115,44,32,
+    114,97,105,115,101,32,97,110,32,79,83,69,114,114,111,114,
+    32,105,102,32,101,120,105,115,116,95,111,107,32,105,115,32,
+    70,97,108,115,101,46,32,79,116,104,101,114,119,105,115,101,
+    32,110,111,32,101,120,99,101,112,116,105,111,110,32,105,115,
+    10,32,32,32,32,114,97,105,115,101,100,46,32,32,84,104,
+    105,115,32,105,115,32,114,101,99,117,114,115,105,118,101,46,
+    10,10,32,32,32,32,41,1,218,8,101,120,105,115,116,95,
+    111,107,90,5,65,83,67,73,73,78,41,11,114,9,0,0,
+    0,218,5,115,112,108,105,116,218,6,101,120,105,115,116,115,
+    218,8,109,97,107,101,100,105,114,115,218,15,70,105,108,101,
+    69,120,105,115,116,115,69,114,114,111,114,114,2,0,0,0,
+    218,10,105,115,105,110,115,116,97,110,99,101,218,5,98,121,
+    116,101,115,114,46,0,0,0,218,7,79,83,69,114,114,111,
+    114,90,5,105,115,100,105,114,41,6,114,8,0,0,0,218,
+    4,109,111,100,101,114,55,0,0,0,218,4,104,101,97,100,
+    218,4,116,97,105,108,90,4,99,100,105,114,114,22,0,0,
+    0,114,22,0,0,0,114,23,0,0,0,114,58,0,0,0,
+    196,0,0,0,115,36,0,0,0,0,10,14,1,4,1,14,
+    1,18,1,2,1,16,1,14,2,6,1,4,1,10,1,10,
+    1,8,1,4,1,2,1,14,1,14,3,14,1,114,58,0,
+    0,0,99,1,0,0,0,0,0,0,0,3,0,0,0,8,
+    0,0,0,67,0,0,0,115,106,0,0,0,116,0,124,0,
+    131,1,1,0,116,1,160,2,124,0,161,1,92,2,125,1,
+    125,2,124,2,115,40,116,1,160,2,124,1,161,1,92,2,
+    125,1,125,2,124,1,114,102,124,2,114,102,122,12,116,0,
+    124,1,131,1,1,0,87,0,110,24,4,0,116,3,107,10,
+    114,84,1,0,1,0,1,0,89,0,113,102,89,0,110,2,
+    88,0,116,1,160,2,124,1,161,1,92,2,125,1,125,2,
+    113,40,100,1,83,0,41,2,97,172,1,0,0,114,101,109,
+    111,118,101,100,105,114,115,40,110,97,109,101,41,10,10,32,
+    32,32,32,83,117,112,101,114,45,114,109,100,105,114,59,32,
+    114,101,109,111,118,101,32,97,32,108,101,97,102,32,100,105,
+    114,101,99,116,111,114,121,32,97,110,100,32,97,108,108,32,
+    101,109,112,116,121,32,105,110,116,101,114,109,101,100,105,97,
+    116,101,10,32,32,32,32,111,110,101,115,46,32,32,87,111,
+    114,107,115,32,108,105,107,101,32,114,109,100,105,114,32,101,
+    120,99,101,112,116,32,116,104,97,116,44,32,105,102,32,116,
+    104,101,32,108,101,97,102,32,100,105,114,101,99,116,111,114,
+    121,32,105,115,10,32,32,32,32,115,117,99,99,101,115,115,
+    102,117,108,108,121,32,114,101,109,111,118,101,100,44,32,100,
+    105,114,101,99,116,111,114,105,101,115,32,99,111,114,114,101,
+    115,112,111,110,100,105,110,103,32,116,111,32,114,105,103,104,
+    116,109,111,115,116,32,112,97,116,104,10,32,32,32,32,115,
+    101,103,109,101,110,116,115,32,119,105,108,108,32,98,101,32,
+    112,114,117,110,101,100,32,97,119,97,121,32,117,110,116,105,
+    108,32,101,105,116,104,101,114,32,116,104,101,32,119,104,111,
+    108,101,32,112,97,116,104,32,105,115,10,32,32,32,32,99,
+    111,110,115,117,109,101,100,32,111,114,32,97,110,32,101,114,
+    114,111,114,32,111,99,99,117,114,115,46,32,32,69,114,114,
+    111,114,115,32,100,117,114,105,110,103,32,116,104,105,115,32,
+    108,97,116,116,101,114,32,112,104,97,115,101,32,97,114,101,
+    10,32,32,32,32,105,103,110,111,114,101,100,32,45,45,32,
+    116,104,101,121,32,103,101,110,101,114,97,108,108,121,32,109,
+    101,97,110,32,116,104,97,116,32,97,32,100,105,114,101,99,
+    116,111,114,121,32,119,97,115,32,110,111,116,32,101,109,112,
+    116,121,46,10,10,32,32,32,32,78,41,4,114,49,0,0,
+    0,114,9,0,0,0,114,56,0,0,0,114,62,0,0,0,
+    41,3,114,8,0,0,0,114,64,0,0,0,114,65,0,0,
+    0,114,22,0,0,0,114,22,0,0,0,114,23,0,0,0,
+    218,10,114,101,109,111,118,101,100,105,114,115,228,0,0,0,
+    115,20,0,0,0,0,11,8,1,14,1,4,1,14,1,8,
+    1,2,1,12,1,14,1,10,1,114,66,0,0,0,99,2,
+    0,0,0,0,0,0,0,4,0,0,0,8,0,0,0,67,
+    0,0,0,115,110,0,0,0,116,0,160,1,124,1,161,1,
+    92,2,125,2,125,3,124,2,114,40,124,3,114,40,116,0,
+    160,2,124,2,161,1,115,40,116,3,124,2,131,1,1,0,
+    116,4,124,0,124,1,131,2,1,0,116,0,160,1,124,0,
+    161,1,92,2,125,2,125,3,124,2,114,106,124,3,114,106,
+    122,12,116,5,124,2,131,1,1,0,87,0,110,20,4,0,
+    116,6,107,10,114,104,1,0,1,0,1,0,89,0,110,2,
+    88,0,100,1,83,0,41,2,97,60,2,0,0,114,101,110,
+    97,109,101,115,40,111,108,100,44,32,110,101,119,41,10,10,
+    32,32,32,32,83,117,112,101,114,45,114,101,110,97,109,101,
+    59,32,99,114,101,97,116,101,32,100,105,114,101,99,116,111,
+    114,105,101,115,32,97,115,32,110,101,99,101,115,115,97,114,
+    121,32,97,110,100,32,100,101,108,101,116,101,32,97,110,121,
+    32,108,101,102,116,10,32,32,32,32,101,109,112,116,121,46,
+    32,32,87,111,114,107,115,32,108,105,107,101,32,114,101,110,
+    97,109,101,44,32,101,120,99,101,112,116,32,99,114,101,97,
+    116,105,111,110,32,111,102,32,97,110,121,32,105,110,116,101,
+    114,109,101,100,105,97,116,101,10,32,32,32,32,100,105,114,
+    101,99,116,111,114,105,101,115,32,110,101,101,100,101,100,32,
+    116,111,32,109,97,107,101,32,116,104,101,32,110,101,119,32,
+    112,97,116,104,110,97,109,101,32,103,111,111,100,32,105,115,
+    32,97,116,116,101,109,112,116,101,100,10,32,32,32,32,102,
+    105,114,115,116,46,32,32,65,102,116,101,114,32,116,104,101,
+    32,114,101,110,97,109,101,44,32,100,105,114,101,99,116,111,
+    114,105,101,115,32,99,111,114,114,101,115,112,111,110,100,105,
+    110,103,32,116,111,32,114,105,103,104,116,109,111,115,116,10,
+    32,32,32,32,112,97,116,104,32,115,101,103,109,101,110,116,
+    115,32,111,102,32,116,104,101,32,111,108,100,32,110,97,109,
+    101,32,119,105,108,108,32,98,101,32,112,114,117,110,101,100,
+    32,117,110,116,105,108,32,101,105,116,104,101,114,32,116,104,
+    101,10,32,32,32,32,119,104,111,108,101,32,112,97,116,104,
+    32,105,115,32,99,111,110,115,117,109,101,100,32,111,114,32,
+    97,32,110,111,110,101,109,112,116,121,32,100,105,114,101,99,
+    116,111,114,121,32,105,115,32,102,111,117,110,100,46,10,10,
+    32,32,32,32,78,111,116,101,58,32,116,104,105,115,32,102,
+    117,110,99,116,105,111,110,32,99,97,110,32,102,97,105,108,
+    32,119,105,116,104,32,116,104,101,32,110,101,119,32,100,105,
+    114,101,99,116,111,114,121,32,115,116,114,117,99,116,117,114,
+    101,32,109,97,100,101,10,32,32,32,32,105,102,32,121,111,
+    117,32,108,97,99,107,32,112,101,114,109,105,115,115,105,111,
+    110,115,32,110,101,101,100,101,100,32,116,111,32,117,110,108,
+    105,110,107,32,116,104,101,32,108,101,97,102,32,100,105,114,
+    101,99,116,111,114,121,32,111,114,10,32,32,32,32,102,105,
+    108,101,46,10,10,32,32,32,32,78,41,7,114,9,0,0,
+    0,114,56,0,0,0,114,57,0,0,0,114,58,0,0,0,
+    114,48,0,0,0,114,66,0,0,0,114,62,0,0,0,41,
+    4,90,3,111,108,100,90,3,110,101,119,114,64,0,0,0,
+    114,65,0,0,0,114,22,0,0,0,114,22,0,0,0,114,
+    23,0,0,0,218,7,114,101,110,97,109,101,115,250,0,0,
+    0,115,20,0,0,0,0,15,14,1,18,1,8,1,10,1,
+    14,1,8,1,2,1,12,1,14,1,114,67,0,0,0,84,
+    99,4,0,0,0,0,0,0,0,17,0,0,0,11,0,0,
+    0,99,0,0,0,115,6,2,0,0,116,0,124,0,131,1,
+    125,0,103,0,125,4,103,0,125,5,103,0,125,6,122,12,
+    116,1,124,0,131,1,125,7,87,0,110,56,4,0,116,2,
+    107,10,114,88,1,0,125,8,1,0,122,26,124,2,100,1,
+    107,9,114,66,124,2,124,8,131,1,1,0,87,0,89,0,
+    162,4,100,1,83,0,100,1,125,8,126,8,88,0,89,0,
+    110,2,88,0,124,7,144,1,143,20,1,0,122,46,122,12,
+    116,3,124,7,131,1,125,9,87,0,110,28,4,0,116,4,
+    107,10,114,140,1,0,1,0,1,0,89,0,87,0,144,1,
+    113,112,89,0,110,2,88,0,87,0,110,66,4,0,116,2,
+    107,10,114,210,1,0,125,8,1,0,122,36,124,2,100,1,
+    107,9,114,178,124,2,124,8,131,1,1,0,87,0,89,0,
+    162,14,87,0,53,0,81,0,82,0,163,0,100,1,83,0,
+    100,1,125,8,126,8,88,0,89,0,110,2,88,0,122,12,
+    124,9,160,5,161,0,125,10,87,0,110,26,4,0,116,2,
+    107,10,144,0,114,250,1,0,1,0,1,0,100,2,125,10,
+    89,0,110,2,88,0,124,10,144,1,114,16,124,4,160,6,
+    124,9,106,7,161,1,1,0,110,12,124,5,160,6,124,9,
+    106,7,161,1,1,0,124,1,115,98,124,10,114,98,124,3,
+    144,1,114,48,100,3,125,11,110,46,122,12,124,9,160,8,
+    161,0,125,12,87,0,110,26,4,0,116,2,107,10,144,1,
+    114,86,1,0,1,0,1,0,100,2,125,12,89,0,110,2,
+    88,0,124,12,12,0,125,11,124,11,114,98,124,6,160,6,
+    124,9,106,9,161,1,1,0,113,98,87,0,53,0,81,0,
+    82,0,88,0,124,1,144,1,114,214,124,0,124,4,124,5,
+    102,3,86,0,1,0,116,9,106,10,116,9,106,11,2,0,
+    125,13,125,14,124,4,68,0,93,52,125,15,124,14,124,0,
+    124,15,131,2,125,16,124,3,144,1,115,188,124,13,124,16,
+    131,1,144,1,115,158,116,12,124,16,124,1,124,2,124,3,
+    131,4,69,0,100,1,72,0,1,0,144,1,113,158,110,44,
+    124,6,68,0,93,26,125,16,116,12,124,16,124,1,124,2,
+    124,3,131,4,69,0,100,1,72,0,1,0,144,1,113,218,
+    124,0,124,4,124,5,102,3,86,0,1,0,100,1,83,0,
+    41,4,97,225,10,0,0,68,105,114,101,99,116,111,114,121,
+    32,116,114,101,101,32,103,101,110,101,114,97,116,111,114,46,
+    10,10,32,32,32,32,70,111,114,32,101,97,99,104,32,100,
+    105,114,101,99,116,111,114,121,32,105,110,32,116,104,101,32,
+    100,105,114,101,99,116,111,114,121,32,116,114,101,101,32,114,
+    111,111,116,101,100,32,97,116,32,116,111,112,32,40,105,110,
+    99,108,117,100,105,110,103,32,116,111,112,10,32,32,32,32,
+    105,116,115,101,108,102,44,32,98,117,116,32,101,120,99,108,
+    117,100,105,110,103,32,39,46,39,32,97,110,100,32,39,46,
+    46,39,41,44,32,121,105,101,108,100,115,32,97,32,51,45,
+    116,117,112,108,101,10,10,32,32,32,32,32,32,32,32,100,
+    105,114,112,97,116,104,44,32,100,105,114,110,97,109,101,115,
+    44,32,102,105,108,101,110,97,109,101,115,10,10,32,32,32,
+    32,100,105,114,112,97,116,104,32,105,115,32,97,32,115,116,
+    114,105,110,103,44,32,116,104,101,32,112,97,116,104,32,116,
+    111,32,116,104,101,32,100,105,114,101,99,116,111,114,121,46,
+    32,32,100,105,114,110,97,109,101,115,32,105,115,32,97,32,
+    108,105,115,116,32,111,102,10,32,32,32,32,116,104,101,32,
+    110,97,109,101,115,32,111,102,32,116,104,101,32,115,117,98,
+    100,105,114,101,99,116,111,114,105,101,115,32,105,110,32,100,
+    105,114,112,97,116,104,32,40,101,120,99,108,117,100,105,110,
+    103,32,39,46,39,32,97,110,100,32,39,46,46,39,41,46,
+    10,32,32,32,32,102,105,108,101,110,97,109,101,115,32,105,
+    115,32,97,32,108,105,115,116,32,111,102,32,116,104,101,32,
+    110,97,109,101,115,32,111,102,32,116,104,101,32,110,111,110,
+    45,100,105,114,101,99,116,111,114,121,32,102,105,108,101,115,
+    32,105,110,32,100,105,114,112,97,116,104,46,10,32,32,32,
+    32,78,111,116,101,32,116,104,97,116,32,116,104,101,32,110,
+    97,109,101,115,32,105,110,32,116,104,101,32,108,105,115,116,
+    115,32,97,114,101,32,106,117,115,116,32,110,97,109,101,115,
+    44,32,119,105,116,104,32,110,111,32,112,97,116,104,32,99,
+    111,109,112,111,110,101,110,116,115,46,10,32,32,32,32,84,
+    111,32,103,101,116,32,97,32,102,117,108,108,32,112,97,116,
+    104,32,40,119,104,105,99,104,32,98,101,103,105,110,115,32,
+    119,105,116,104,32,116,111,112,41,32,116,111,32,97,32,102,
+    105,108,101,32,111,114,32,100,105,114,101,99,116,111,114,121,
+    32,105,110,10,32,32,32,32,100,105,114,112,97,116,104,44,
+    32,100,111,32,111,115,46,112,97,116,104,46,106,111,105,110,
+    40,100,105,114,112,97,116,104,44,32,110,97,109,101,41,46,
+    10,10,32,32,32,32,73,102,32,111,112,116,105,111,110,97,
+    108,32,97,114,103,32,39,116,111,112,100,111,119,110,39,32,
+    105,115,32,116,114,117,101,32,111,114,32,110,111,116,32,115,
+    112,101,99,105,102,105,101,100,44,32,116,104,101,32,116,114,
+    105,112,108,101,32,102,111,114,32,97,10,32,32,32,32,100,
+    105,114,101,99,116,111,114,121,32,105,115,32,103,101,110,101,
+    114,97,116,101,100,32,98,101,102,111,114,101,32,116,104,101,
+    32,116,114,105,112,108,101,115,32,102,111,114,32,97,110,121,
+    32,111,102,32,105,116,115,32,115,117,98,100,105,114,101,99,
+    116,111,114,105,101,115,10,32,32,32,32,40,100,105,114,101,
+    99,116,111,114,105,101,115,32,97,114,101,32,103,101,110,101,
+    114,97,116,101,100,32,116,111,112,32,100,111,119,110,41,46,
+    32,32,73,102,32,116,111,112,100,111,119,110,32,105,115,32,
+    102,97,108,115,101,44,32,116,104,101,32,116,114,105,112,108,
+    101,10,32,32,32,32,102,111,114,32,97,32,100,105,114,101,
+    99,116,111,114,121,32,105,115,32,103,101,110,101,114,97,116,
+    101,100,32,97,102,116,101,114,32,116,104,101,32,116,114,105,
+    112,108,101,115,32,102,111,114,32,97,108,108,32,111,102,32,
+    105,116,115,10,32,32,32,32,115,117,98,100,105,114,101,99,
+    116,111,114,105,101,115,32,40,100,105,114,101,99,116,111,114,
+    105,101,115,32,97,114,101,32,103,101,110,101,114,97,116,101,
+    100,32,98,111,116,116,111,109,32,117,112,41,46,10,10,32,
+    32,32,32,87,104,101,110,32,116,111,112,100,111,119,110,32,
+    105,115,32,116,114,117,101,44,32,116,104,101,32,99,97,108,
+    108,101,114,32,99,97,110,32,109,111,100,105,102,121,32,116,
+    104,101,32,100,105,114,110,97,109,101,115,32,108,105,115,116,
+    32,105,110,45,112,108,97,99,101,10,32,32,32,32,40,101,
+    46,103,46,44,32,118,105,97,32,100,101,108,32,111,114,32,
+    115,108,105,99,101,32,97,115,115,105,103,110,109,101,110,116,
+    41,44,32,97,110,100,32,119,97,108,107,32,119,105,108,108,
+    32,111,110,108,121,32,114,101,99,117,114,115,101,32,105,110,
+    116,111,32,116,104,101,10,32,32,32,32,115,117,98,100,105,
+    114,101,99,116,111,114,105,101,115,32,119,104,111,115,101,32,
+    110,97,109,101,115,32,114,101,109,97,105,110,32,105,110,32,
+    100,105,114,110,97,109,101,115,59,32,116,104,105,115,32,99,
+    97,110,32,98,101,32,117,115,101,100,32,116,111,32,112,114,
+    117,110,101,32,116,104,101,10,32,32,32,32,115,101,97,114,
+    99,104,44,32,111,114,32,116,111,32,105,109,112,111,115,101,
+    32,97,32,115,112,101,99,105,102,105,99,32,111,114,100,101,
+    114,32,111,102,32,118,105,115,105,116,105,110,103,46,32,32,
+    77,111,100,105,102,121,105,110,103,32,100,105,114,110,97,109,
+    101,115,32,119,104,101,110,10,32,32,32,32,116,111,112,100,
+    111,119,110,32,105,115,32,102,97,108,115,101,32,105,115,32,
+    105,110,101,102,102,101,99,116,105,118,101,44,32,115,105,110,
+    99,101,32,116,104,101,32,100,105,114,101,99,116,111,114,105,
+    101,115,32,105,110,32,100,105,114,110,97,109,101,115,32,104,
+    97,118,101,10,32,32,32,32,97,108,114,101,97,100,121,32,
+    98,101,101,110,32,103,101,110,101,114,97,116,101,100,32,98,
+    121,32,116,104,101,32,116,105,109,101,32,100,105,114,110,97,
+    109,101,115,32,105,116,115,101,108,102,32,105,115,32,103,101,
+    110,101,114,97,116,101,100,46,32,78,111,32,109,97,116,116,
+    101,114,10,32,32,32,32,116,104,101,32,118,97,108,117,101,
+    32,111,102,32,116,111,112,100,111,119,110,44,32,116,104,101,
+    32,108,105,115,116,32,111,102,32,115,117,98,100,105,114,101,
+    99,116,111,114,105,101,115,32,105,115,32,114,101,116,114,105,
+    101,118,101,100,32,98,101,102,111,114,101,32,116,104,101,10,
+    32,32,32,32,116,117,112,108,101,115,32,102,111,114,32,116,
+    104,101,32,100,105,114,101,99,116,111,114,121,32,97,110,100,
+    32,105,116,115,32,115,117,98,100,105,114,101,99,116,111,114,
+    105,101,115,32,97,114,101,32,103,101,110,101,114,97,116,101,
+    100,46,10,10,32,32,32,32,66,121,32,100,101,102,97,117,
+    108,116,32,101,114,114,111,114,115,32,102,114,111,109,32,116,
+    104,101,32,111,115,46,115,99,97,110,100,105,114,40,41,32,
+    99,97,108,108,32,97,114,101,32,105,103,110,111,114,101,100,
+    46,32,32,73,102,10,32,32,32,32,111,112,116,105,111,110,
+    97,108,32,97,114,103,32,39,111,110,101,114,114,111,114,39,
+    32,105,115,32,115,112,101,99,105,102,105,101,100,44,32,105,
+    116,32,115,104,111,117,108,100,32,98,101,32,97,32,102,117,
+    110,99,116,105,111,110,59,32,105,116,10,32,32,32,32,119,
+    105,108,108,32,98,101,32,99,97,108,108,101,100,32,119,105,
+    116,104,32,111,110,101,32,97,114,103,117,109,101,110,116,44,
+    32,97,110,32,79,83,69,114,114,111,114,32,105,110,115,116,
+    97,110,99,101,46,32,32,73,116,32,99,97,110,10,32,32,
+    32,32,114,101,112,111,114,116,32,116,104,101,32,101,114,114,
+    111,114,32,116,111,32,99,111,110,116,105,110,117,101,32,119,
+    105,116,104,32,116,104,101,32,119,97,108,107,44,32,111,114,
+    32,114,97,105,115,101,32,116,104,101,32,101,120,99,101,112,
+    116,105,111,110,10,32,32,32,32,116,111,32,97,98,111,114,
+    116,32,116,104,101,32,119,97,108,107,46,32,32,78,111,116,
+    101,32,116,104,97,116,32,116,104,101,32,102,105,108,101,110,
+    97,109,101,32,105,115,32,97,118,97,105,108,97,98,108,101,
+    32,97,115,32,116,104,101,10,32,32,32,32,102,105,108,101,
+    110,97,109,101,32,97,116,116,114,105,98,117,116,101,32,111,
+    102,32,116,104,101,32,101,120,99,101,112,116,105,111,110,32,
+    111,98,106,101,99,116,46,10,10,32,32,32,32,66,121,32,
+    100,101,102,97,117,108,116,44,32,111,115,46,119,97,108,107,
+    32,100,111,101,115,32,110,111,116,32,102,111,108,108,111,119,
+    32,115,121,109,98,111,108,105,99,32,108,105,110,107,115,32,
+    116,111,32,115,117,98,100,105,114,101,99,116,111,114,105,101,
+    115,32,111,110,10,32,32,32,32,115,121,115,116,101,109,115,
+    32,116,104,97,116,32,115,117,112,112,111,114,116,32,116,104,
+    101,109,46,32,32,73,110,32,111,114,100,101,114,32,116,111,
+    32,103,101,116,32,116,104,105,115,32,102,117,110,99,116,105,
+    111,110,97,108,105,116,121,44,32,115,101,116,32,116,104,101,
+    10,32,32,32,32,111,112,116,105,111,110,97,108,32,97,114,
+    103,117,109,101,110,116,32,39,102,111,108,108,111,119,108,105,
+    110,107,115,39,32,116,111,32,116,114,117,101,46,10,10,32,
+    32,32,32,67,97,117,116,105,111,110,58,32,32,105,102,32,
+    121,111,117,32,112,97,115,115,32,97,32,114,101,108,97,116,
+    105,118,101,32,112,97,116,104,110,97,109,101,32,102,111,114,
+    32,116,111,112,44,32,100,111,110,39,116,32,99,104,97,110,
+    103,101,32,116,104,101,10,32,32,32,32,99,117,114,114,101,
+    110,116,32,119,111,114,107,105,110,103,32,100,105,114,101,99,
+    116,111,114,121,32,98,101,116,119,101,101,110,32,114,101,115,
+    117,109,112,116,105,111,110,115,32,111,102,32,119,97,108,107,
+    46,32,32,119,97,108,107,32,110,101,118,101,114,10,32,32,
+    32,32,99,104,97,110,103,101,115,32,116,104,101,32,99,117,
+    114,114,101,110,116,32,100,105,114,101,99,116,111,114,121,44,
+    32,97,110,100,32,97,115,115,117,109,101,115,32,116,104,97,
+    116,32,116,104,101,32,99,108,105,101,110,116,32,100,111,101,
+    115,110,39,116,10,32,32,32,32,101,105,116,104,101,114,46,
+    10,10,32,32,32,32,69,120,97,109,112,108,101,58,10,10,
+    32,32,32,32,105,109,112,111,114,116,32,111,115,10,32,32,
+    32,32,102,114,111,109,32,111,115,46,112,97,116,104,32,105,
+    109,112,111,114,116,32,106,111,105,110,44,32,103,101,116,115,
+    105,122,101,10,32,32,32,32,102,111,114,32,114,111,111,116,
+    44,32,100,105,114,115,44,32,102,105,108,101,115,32,105,110,
+    32,111,115,46,119,97,108,107,40,39,112,121,116,104,111,110,
+    47,76,105,98,47,101,109,97,105,108,39,41,58,10,32,32,
+    32,32,32,32,32,32,112,114,105,110,116,40,114,111,111,116,
+    44,32,34,99,111,110,115,117,109,101,115,34,44,32,101,110,
+    100,61,34,34,41,10,32,32,32,32,32,32,32,32,112,114,
+    105,110,116,40,115,117,109,40,103,101,116,115,105,122,101,40,
+    106,111,105,110,40,114,111,111,116,44,32,110,97,109,101,41,
+    41,32,102,111,114,32,110,97,109,101,32,105,110,32,102,105,
+    108,101,115,41,44,32,101,110,100,61,34,34,41,10,32,32,
+    32,32,32,32,32,32,112,114,105,110,116,40,34,98,121,116,
+    101,115,32,105,110,34,44,32,108,101,110,40,102,105,108,101,
+    115,41,44,32,34,110,111,110,45,100,105,114,101,99,116,111,
+    114,121,32,102,105,108,101,115,34,41,10,32,32,32,32,32,
+    32,32,32,105,102,32,39,67,86,83,39,32,105,110,32,100,
+    105,114,115,58,10,32,32,32,32,32,32,32,32,32,32,32,
+    32,100,105,114,115,46,114,101,109,111,118,101,40,39,67,86,
+    83,39,41,32,32,35,32,100,111,110,39,116,32,118,105,115,
+    105,116,32,67,86,83,32,100,105,114,101,99,116,111,114,105,
+    101,115,10,10,32,32,32,32,78,70,84,41,13,218,6,102,
+    115,112,97,116,104,114,50,0,0,0,114,62,0,0,0,218,
+    4,110,101,120,116,218,13,83,116,111,112,73,116,101,114,97,
+    116,105,111,110,218,6,105,115,95,100,105,114,218,6,97,112,
+    112,101,110,100,114,8,0,0,0,218,10,105,115,95,115,121,
+    109,108,105,110,107,114,9,0,0,0,218,6,105,115,108,105,
+    110,107,218,4,106,111,105,110,218,4,119,97,108,107,41,17,
+    218,3,116,111,112,218,7,116,111,112,100,111,119,110,218,7,
+    111,110,101,114,114,111,114,90,11,102,111,108,108,111,119,108,
+    105,110,107,115,218,4,100,105,114,115,218,7,110,111,110,100,
+    105,114,115,90,9,119,97,108,107,95,100,105,114,115,218,10,
+    115,99,97,110,100,105,114,95,105,116,90,5,101,114,114,111,
+    114,218,5,101,110,116,114,121,114,71,0,0,0,90,9,119,
+    97,108,107,95,105,110,116,111,114,73,0,0,0,114,74,0,
+    0,0,114,75,0,0,0,218,7,100,105,114,110,97,109,101,
+    90,8,110,101,119,95,112,97,116,104,114,22,0,0,0,114,
+    22,0,0,0,114,23,0,0,0,114,76,0,0,0,22,1,
+    0,0,115,94,0,0,0,0,58,8,1,4,1,4,1,4,
+    7,2,3,12,1,16,1,8,1,8,1,24,2,8,2,2,
+    1,2,1,12,1,14,1,18,1,16,1,8,1,8,1,34,
+    2,2,1,12,1,16,3,10,2,6,1,14,2,12,2,8,
+    3,6,1,6,2,2,1,12,1,16,4,10,1,6,2,4,
+    1,24,3,6,1,12,3,14,1,8,1,10,5,16,1,26,
+    3,8,1,24,2,114,76,0,0,0,218,1,46,169,2,218,
+    15,102,111,108,108,111,119,95,115,121,109,108,105,110,107,115,
+    218,6,100,105,114,95,102,100,99,3,0,0,0,2,0,0,
+    0,7,0,0,0,8,0,0,0,99,0,0,0,115,142,0,
+    0,0,116,0,124,0,116,1,131,2,114,20,116,2,124,0,
+    100,1,131,2,115,28,116,3,124,0,131,1,125,0,124,3,
+    115,46,116,4,124,0,100,2,124,4,100,3,141,3,125,5,
+    116,5,124,0,116,6,124,4,100,4,141,3,125,6,122,66,
+    124,3,115,94,116,7,160,8,124,5,106,9,161,1,114,124,
+    116,10,160,11,124,5,116,4,124,6,131,1,161,2,114,124,
+    116,12,124,6,124,0,116,0,124,0,116,13,131,2,124,1,
+    124,2,124,3,131,6,69,0,100,5,72,0,1,0,87,0,
+    53,0,116,14,124,6,131,1,1,0,88,0,100,5,83,0,
+    41,6,97,2,5,0,0,68,105,114,101,99,116,111,114,121,
+    32,116,114,101,101,32,103,101,110,101,114,97,116,111,114,46,
+    10,10,32,32,32,32,32,32,32,32,84,104,105,115,32,98,
+    101,104,97,118,101,115,32,101,120,97,99,116,108,121,32,108,
+    105,107,101,32,119,97,108,107,40,41,44,32,101,120,99,101,
+    112,116,32,116,104,97,116,32,105,116,32,121,105,101,108,100,
+    115,32,97,32,52,45,116,117,112,108,101,10,10,32,32,32,
+    32,32,32,32,32,32,32,32,32,100,105,114,112,97,116,104,
+    44,32,100,105,114,110,97,109,101,115,44,32,102,105,108,101,
+    110,97,109,101,115,44,32,100,105,114,102,100,10,10,32,32,
+    32,32,32,32,32,32,96,100,105,114,112,97,116,104,96,44,
+    32,96,100,105,114,110,97,109,101,115,96,32,97,110,100,32,
+    96,102,105,108,101,110,97,109,101,115,96,32,97,114,101,32,
+    105,100,101,110,116,105,99,97,108,32,116,111,32,119,97,108,
+    107,40,41,32,111,117,116,112,117,116,44,10,32,32,32,32,
+    32,32,32,32,97,110,100,32,96,100,105,114,102,100,96,32,
+    105,115,32,97,32,102,105,108,101,32,100,101,115,99,114,105,
+    112,116,111,114,32,114,101,102,101,114,114,105,110,103,32,116,
+    111,32,116,104,101,32,100,105,114,101,99,116,111,114,121,32,
+    96,100,105,114,112,97,116,104,96,46,10,10,32,32,32,32,
+    32,32,32,32,84,104,101,32,97,100,118,97,110,116,97,103,
+    101,32,111,102,32,102,119,97,108,107,40,41,32,111,118,101,
+    114,32,119,97,108,107,40,41,32,105,115,32,116,104,97,116,
+    32,105,116,39,115,32,115,97,102,101,32,97,103,97,105,110,
+    115,116,32,115,121,109,108,105,110,107,10,32,32,32,32,32,
+    32,32,32,114,97,99,101,115,32,40,119,104,101,110,32,102,
+    111,108,108,111,119,95,115,121,109,108,105,110,107,115,32,105,
+    115,32,70,97,108,115,101,41,46,10,10,32,32,32,32,32,
+    32,32,32,73,102,32,100,105,114,95,102,100,32,105,115,32,
+    110,111,116,32,78,111,110,101,44,32,105,116,32,115,104,111,
+    117,108,100,32,98,101,32,97,32,102,105,108,101,32,100,101,
+    115,99,114,105,112,116,111,114,32,111,112,101,110,32,116,111,
+    32,97,32,100,105,114,101,99,116,111,114,121,44,10,32,32,
+    32,32,32,32,32,32,32,32,97,110,100,32,116,111,112,32,
+    115,104,111,117,108,100,32,98,101,32,114,101,108,97,116,105,
+    118,101,59,32,116,111,112,32,119,105,108,108,32,116,104,101,
+    110,32,98,101,32,114,101,108,97,116,105,118,101,32,116,111,
+    32,116,104,97,116,32,100,105,114,101,99,116,111,114,121,46,
+    10,32,32,32,32,32,32,32,32,32,32,40,100,105,114,95,
+    102,100,32,105,115,32,97,108,119,97,121,115,32,115,117,112,
+    112,111,114,116,101,100,32,102,111,114,32,102,119,97,108,107,
+    46,41,10,10,32,32,32,32,32,32,32,32,67,97,117,116,
+    105,111,110,58,10,32,32,32,32,32,32,32,32,83,105,110,
+    99,101,32,102,119,97,108,107,40,41,32,121,105,101,108,100,
+    115,32,102,105,108,101,32,100,101,115,99,114,105,112,116,111,
+    114,115,44,32,116,104,111,115,101,32,97,114,101,32,111,110,
+    108,121,32,118,97,108,105,100,32,117,110,116,105,108,32,116,
+    104,101,10,32,32,32,32,32,32,32,32,110,101,120,116,32,
+    105,116,101,114,97,116,105,111,110,32,115,116,101,112,44,32,
+    115,111,32,121,111,117,32,115,104,111,117,108,100,32,100,117,
+    112,40,41,32,116,104,101,109,32,105,102,32,121,111,117,32,
+    119,97,110,116,32,116,111,32,107,101,101,112,32,116,104,101,
+    109,10,32,32,32,32,32,32,32,32,102,111,114,32,97,32,
+    108,111,110,103,101,114,32,112,101,114,105,111,100,46,10,10,
+    32,32,32,32,32,32,32,32,69,120,97,109,112,108,101,58,
+    10,10,32,32,32,32,32,32,32,32,105,109,112,111,114,116,
+    32,111,115,10,32,32,32,32,32,32,32,32,102,111,114,32,
+    114,111,111,116,44,32,100,105,114,115,44,32,102,105,108,101,
+    115,44,32,114,111,111,116,102,100,32,105,110,32,111,115,46,
+    102,119,97,108,107,40,39,112,121,116,104,111,110,47,76,105,
+    98,47,101,109,97,105,108,39,41,58,10,32,32,32,32,32,
+    32,32,32,32,32,32,32,112,114,105,110,116,40,114,111,111,
+    116,44,32,34,99,111,110,115,117,109,101,115,34,44,32,101,
+    110,100,61,34,34,41,10,32,32,32,32,32,32,32,32,32,
+    32,32,32,112,114,105,110,116,40,115,117,109,40,111,115,46,
+    115,116,97,116,40,110,97,109,101,44,32,100,105,114,95,102,
+    100,61,114,111,111,116,102,100,41,46,115,116,95,115,105,122,
+    101,32,102,111,114,32,110,97,109,101,32,105,110,32,102,105,
+    108,101,115,41,44,10,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,101,110,100,61,34,34,41,10,
+    32,32,32,32,32,32,32,32,32,32,32,32,112,114,105,110,
+    116,40,34,98,121,116,101,115,32,105,110,34,44,32,108,101,
+    110,40,102,105,108,101,115,41,44,32,34,110,111,110,45,100,
+    105,114,101,99,116,111,114,121,32,102,105,108,101,115,34,41,
+    10,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,
+    39,67,86,83,39,32,105,110,32,100,105,114,115,58,10,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,
+    105,114,115,46,114,101,109,111,118,101,40,39,67,86,83,39,
+    41,32,32,35,32,100,111,110,39,116,32,118,105,115,105,116,
+    32,67,86,83,32,100,105,114,101,99,116,111,114,105,101,115,
+    10,32,32,32,32,32,32,32,32,218,9,95,95,105,110,100,
+    101,120,95,95,70,114,86,0,0,0,169,1,114,88,0,0,
+    0,78,41,15,114,60,0,0,0,218,3,105,110,116,218,7,
+    104,97,115,97,116,116,114,114,68,0,0,0,114,45,0,0,
+    0,114,47,0,0,0,218,8,79,95,82,68,79,78,76,89,
+    218,2,115,116,90,7,83,95,73,83,68,73,82,90,7,115,
+    116,95,109,111,100,101,114,9,0,0,0,218,8,115,97,109,
+    101,115,116,97,116,218,6,95,102,119,97,108,107,114,61,0,
+    0,0,218,5,99,108,111,115,101,41,7,114,77,0,0,0,
+    114,78,0,0,0,114,79,0,0,0,114,87,0,0,0,114,
+    88,0,0,0,218,7,111,114,105,103,95,115,116,218,5,116,
+    111,112,102,100,114,22,0,0,0,114,22,0,0,0,114,23,
+    0,0,0,218,5,102,119,97,108,107,166,1,0,0,115,30,
+    0,0,0,0,33,20,1,8,3,4,1,14,1,14,1,2,
+    1,16,1,14,255,2,2,14,1,2,0,2,0,2,255,14,
+    3,114,100,0,0,0,99,6,0,0,0,0,0,0,0,16,
+    0,0,0,12,0,0,0,99,0,0,0,115,210,1,0,0,
+    116,0,124,0,131,1,125,6,103,0,125,7,103,0,125,8,
+    124,3,115,24,124,5,114,28,100,0,110,2,103,0,125,9,
+    124,6,68,0,93,140,125,10,124,10,106,1,125,11,124,2,
+    114,58,116,2,124,11,131,1,125,11,122,52,124,10,160,3,
+    161,0,114,98,124,7,160,4,124,11,161,1,1,0,124,9,
+    100,0,107,9,114,96,124,9,160,4,124,10,161,1,1,0,
+    110,10,124,8,160,4,124,11,161,1,1,0,87,0,110,64,
+    4,0,116,5,107,10,114,174,1,0,1,0,1,0,122,22,
+    124,10,160,6,161,0,114,146,124,8,160,4,124,11,161,1,
+    1,0,87,0,110,20,4,0,116,5,107,10,114,168,1,0,
+    1,0,1,0,89,0,110,2,88,0,89,0,110,2,88,0,
+    113,36,124,3,114,196,124,1,124,7,124,8,124,0,102,4,
+    86,0,1,0,124,9,100,0,107,8,114,208,124,7,110,8,
+    116,7,124,7,124,9,131,2,68,0,93,222,125,11,122,78,
+    124,5,144,1,115,28,124,3,114,250,116,8,124,11,124,0,
+    100,1,100,2,141,3,125,12,110,34,124,9,100,0,107,9,
+    144,1,115,8,116,9,130,1,124,11,92,2,125,11,125,10,
+    124,10,106,8,100,1,100,3,141,1,125,12,116,10,124,11,
+    116,11,124,0,100,4,141,3,125,13,87,0,110,62,4,0,
+    116,5,107,10,144,1,114,106,1,0,125,14,1,0,122,30,
+    124,4,100,0,107,9,144,1,114,82,124,4,124,14,131,1,
+    1,0,87,0,89,0,162,6,113,218,87,0,53,0,100,0,
+    125,14,126,14,88,0,89,0,110,2,88,0,122,64,124,5,
+    144,1,115,134,116,12,160,13,124,12,116,8,124,13,131,1,
+    161,2,144,1,114,170,116,12,160,14,124,1,124,11,161,2,
+    125,15,116,15,124,13,124,15,124,2,124,3,124,4,124,5,
+    131,6,69,0,100,0,72,0,1,0,87,0,53,0,116,16,
+    124,13,131,1,1,0,88,0,113,218,124,3,144,1,115,206,
+    124,1,124,7,124,8,124,0,102,4,86,0,1,0,100,0,
+    83,0,41,5,78,70,41,2,114,88,0,0,0,114,87,0,
+    0,0,41,1,114,87,0,0,0,114,90,0,0,0,41,17,
+    114,50,0,0,0,114,8,0,0,0,114,14,0,0,0,114,
+    71,0,0,0,114,72,0,0,0,114,62,0,0,0,114,73,
+    0,0,0,218,3,122,105,112,114,45,0,0,0,218,14,65,
+    115,115,101,114,116,105,111,110,69,114,114,111,114,114,47,0,
+    0,0,114,93,0,0,0,114,9,0,0,0,114,95,0,0,
+    0,114,75,0,0,0,114,96,0,0,0,114,97,0,0,0,
+    41,16,114,99,0,0,0,90,7,116,111,112,112,97,116,104,
+    90,7,105,115,98,121,116,101,115,114,78,0,0,0,114,79,
+    0,0,0,114,87,0,0,0,114,82,0,0,0,114,80,0,
+    0,0,114,81,0,0,0,90,7,101,110,116,114,105,101,115,
+    114,83,0,0,0,114,8,0,0,0,114,98,0,0,0,90,
+    5,100,105,114,102,100,90,3,101,114,114,90,7,100,105,114,
+    112,97,116,104,114,22,0,0,0,114,22,0,0,0,114,23,
+    0,0,0,114,96,0,0,0,214,1,0,0,115,92,0,0,
+    0,0,5,8,1,4,1,4,1,16,1,8,1,6,1,4,
+    1,8,1,2,1,8,1,10,1,8,1,12,2,14,1,14,
+    1,2,2,8,1,14,1,14,1,14,2,4,1,14,2,26,
+    1,2,1,6,1,4,1,16,2,14,1,8,1,12,1,18,
+    1,18,1,10,1,8,1,26,1,2,1,24,1,12,1,8,
+    1,2,0,2,0,2,255,14,3,12,2,6,1,114,96,0,
+    0,0,99,1,0,0,0,0,0,0,0,2,0,0,0,3,
+    0,0,0,71,0,0,0,115,14,0,0,0,116,0,124,0,
+    124,1,131,2,1,0,100,1,83,0,41,2,122,112,101,120,
+    101,99,108,40,102,105,108,101,44,32,42,97,114,103,115,41,
+    10,10,32,32,32,32,69,120,101,99,117,116,101,32,116,104,
+    101,32,101,120,101,99,117,116,97,98,108,101,32,102,105,108,
+    101,32,119,105,116,104,32,97,114,103,117,109,101,110,116,32,
+    108,105,115,116,32,97,114,103,115,44,32,114,101,112,108,97,
+    99,105,110,103,32,116,104,101,10,32,32,32,32,99,117,114,
+    114,101,110,116,32,112,114,111,99,101,115,115,46,32,78,41,
+    1,218,5,101,120,101,99,118,169,2,218,4,102,105,108,101,
+    218,4,97,114,103,115,114,22,0,0,0,114,22,0,0,0,
+    114,23,0,0,0,218,5,101,120,101,99,108,16,2,0,0,
+    115,2,0,0,0,0,5,114,107,0,0,0,99,1,0,0,
+    0,0,0,0,0,3,0,0,0,5,0,0,0,71,0,0,
+    0,115,32,0,0,0,124,1,100,1,25,0,125,2,116,0,
+    124,0,124,1,100,2,100,1,133,2,25,0,124,2,131,3,
+    1,0,100,2,83,0,41,3,122,138,101,120,101,99,108,101,
+    40,102,105,108,101,44,32,42,97,114,103,115,44,32,101,110,
+    118,41,10,10,32,32,32,32,69,120,101,99,117,116,101,32,
+    116,104,101,32,101,120,101,99,117,116,97,98,108,101,32,102,
+    105,108,101,32,119,105,116,104,32,97,114,103,117,109,101,110,
+    116,32,108,105,115,116,32,97,114,103,115,32,97,110,100,10,
+    32,32,32,32,101,110,118,105,114,111,110,109,101,110,116,32,
+    101,110,118,44,32,114,101,112,108,97,99,105,110,103,32,116,
+    104,101,32,99,117,114,114,101,110,116,32,112,114,111,99,101,
+    115,115,46,32,233,255,255,255,255,78,41,1,114,51,0,0,
+    0,169,3,114,105,0,0,0,114,106,0,0,0,218,3,101,
+    110,118,114,22,0,0,0,114,22,0,0,0,114,23,0,0,
+    0,218,6,101,120,101,99,108,101,23,2,0,0,115,4,0,
+    0,0,0,5,8,1,114,111,0,0,0,99,1,0,0,0,
+    0,0,0,0,2,0,0,0,3,0,0,0,71,0,0,0,
+    115,14,0,0,0,116,0,124,0,124,1,131,2,1,0,100,
+    1,83,0,41,2,122,149,101,120,101,99,108,112,40,102,105,
+    108,101,44,32,42,97,114,103,115,41,10,10,32,32,32,32,
+    69,120,101,99,117,116,101,32,116,104,101,32,101,120,101,99,
+    117,116,97,98,108,101,32,102,105,108,101,32,40,119,104,105,
+    99,104,32,105,115,32,115,101,97,114,99,104,101,100,32,102,
+    111,114,32,97,108,111,110,103,32,36,80,65,84,72,41,10,
+    32,32,32,32,119,105,116,104,32,97,114,103,117,109,101,110,
+    116,32,108,105,115,116,32,97,114,103,115,44,32,114,101,112,
+    108,97,99,105,110,103,32,116,104,101,32,99,117,114,114,101,
+    110,116,32,112,114,111,99,101,115,115,46,32,78,41,1,218,
+    6,101,120,101,99,118,112,114,104,0,0,0,114,22,0,0,
+    0,114,22,0,0,0,114,23,0,0,0,218,6,101,120,101,
+    99,108,112,31,2,0,0,115,2,0,0,0,0,5,114,113,
+    0,0,0,99,1,0,0,0,0,0,0,0,3,0,0,0,
+    5,0,0,0,71,0,0,0,115,32,0,0,0,124,1,100,
+    1,25,0,125,2,116,0,124,0,124,1,100,2,100,1,133,
+    2,25,0,124,2,131,3,1,0,100,2,83,0,41,3,122,
+    179,101,120,101,99,108,112,101,40,102,105,108,101,44,32,42,
+    97,114,103,115,44,32,101,110,118,41,10,10,32,32,32,32,
+    69,120,101,99,117,116,101,32,116,104,101,32,101,120,101,99,
+    117,116,97,98,108,101,32,102,105,108,101,32,40,119,104,105,
+    99,104,32,105,115,32,115,101,97,114,99,104,101,100,32,102,
+    111,114,32,97,108,111,110,103,32,36,80,65,84,72,41,10,
+    32,32,32,32,119,105,116,104,32,97,114,103,117,109,101,110,
+    116,32,108,105,115,116,32,97,114,103,115,32,97,110,100,32,
+    101,110,118,105,114,111,110,109,101,110,116,32,101,110,118,44,
+    32,114,101,112,108,97,99,105,110,103,32,116,104,101,32,99,
+    117,114,114,101,110,116,10,32,32,32,32,112,114,111,99,101,
+    115,115,46,32,114,108,0,0,0,78,41,1,218,7,101,120,
+    101,99,118,112,101,114,109,0,0,0,114,22,0,0,0,114,
+    22,0,0,0,114,23,0,0,0,218,7,101,120,101,99,108,
+    112,101,38,2,0,0,115,4,0,0,0,0,6,8,1,114,
+    115,0,0,0,99,2,0,0,0,0,0,0,0,2,0,0,
+    0,3,0,0,0,67,0,0,0,115,14,0,0,0,116,0,
+    124,0,124,1,131,2,1,0,100,1,83,0,41,2,122,192,
+    101,120,101,99,118,112,40,102,105,108,101,44,32,97,114,103,
+    115,41,10,10,32,32,32,32,69,120,101,99,117,116,101,32,
+    116,104,101,32,101,120,101,99,117,116,97,98,108,101,32,102,
+    105,108,101,32,40,119,104,105,99,104,32,105,115,32,115,101,
+    97,114,99,104,101,100,32,102,111,114,32,97,108,111,110,103,
+    32,36,80,65,84,72,41,10,32,32,32,32,119,105,116,104,
+    32,97,114,103,117,109,101,110,116,32,108,105,115,116,32,97,
+    114,103,115,44,32,114,101,112,108,97,99,105,110,103,32,116,
+    104,101,32,99,117,114,114,101,110,116,32,112,114,111,99,101,
+    115,115,46,10,32,32,32,32,97,114,103,115,32,109,97,121,
+    32,98,101,32,97,32,108,105,115,116,32,111,114,32,116,117,
+    112,108,101,32,111,102,32,115,116,114,105,110,103,115,46,32,
+    78,169,1,218,8,95,101,120,101,99,118,112,101,114,104,0,
+    0,0,114,22,0,0,0,114,22,0,0,0,114,23,0,0,
+    0,114,112,0,0,0,47,2,0,0,115,2,0,0,0,0,
+    6,114,112,0,0,0,99,3,0,0,0,0,0,0,0,3,
+    0,0,0,4,0,0,0,67,0,0,0,115,16,0,0,0,
+    116,0,124,0,124,1,124,2,131,3,1,0,100,1,83,0,
+    41,2,122,223,101,120,101,99,118,112,101,40,102,105,108,101,
+    44,32,97,114,103,115,44,32,101,110,118,41,10,10,32,32,
+    32,32,69,120,101,99,117,116,101,32,116,104,101,32,101,120,
+    101,99,117,116,97,98,108,101,32,102,105,108,101,32,40,119,
+    104,105,99,104,32,105,115,32,115,101,97,114,99,104,101,100,
+    32,102,111,114,32,97,108,111,110,103,32,36,80,65,84,72,
+    41,10,32,32,32,32,119,105,116,104,32,97,114,103,117,109,
+    101,110,116,32,108,105,115,116,32,97,114,103,115,32,97,110,
+    100,32,101,110,118,105,114,111,110,109,101,110,116,32,101,110,
+    118,32,44,32,114,101,112,108,97,99,105,110,103,32,116,104,
+    101,10,32,32,32,32,99,117,114,114,101,110,116,32,112,114,
+    111,99,101,115,115,46,10,32,32,32,32,97,114,103,115,32,
+    109,97,121,32,98,101,32,97,32,108,105,115,116,32,111,114,
+    32,116,117,112,108,101,32,111,102,32,115,116,114,105,110,103,
+    115,46,32,78,114,116,0,0,0,114,109,0,0,0,114,22,
+    0,0,0,114,22,0,0,0,114,23,0,0,0,114,114,0,
+    0,0,55,2,0,0,115,2,0,0,0,0,7,114,114,0,
+    0,0,99,3,0,0,0,0,0,0,0,11,0,0,0,11,
+    0,0,0,67,0,0,0,115,254,0,0,0,124,2,100,0,
+    107,9,114,22,116,0,125,3,124,1,124,2,102,2,125,4,
+    110,14,116,1,125,3,124,1,102,1,125,4,116,2,125,2,
+    116,3,160,4,124,0,161,1,114,64,124,3,124,0,102,1,
+    124,4,158,2,142,0,1,0,100,0,83,0,100,0,125,5,
+    116,5,124,2,131,1,125,6,116,6,100,1,107,3,114,102,
+    116,7,124,0,131,1,125,0,116,8,116,7,124,6,131,2,
+    125,6,124,6,68,0,93,126,125,7,116,3,160,9,124,7,
+    124,0,161,2,125,8,122,18,124,3,124,8,102,1,124,4,
+    158,2,142,0,1,0,87,0,113,106,4,0,116,10,116,11,
+    102,2,107,10,114,182,1,0,125,9,1,0,122,8,124,9,
+    125,10,87,0,53,0,100,0,125,9,126,9,88,0,89,0,
+    113,106,4,0,116,12,107,10,114,230,1,0,125,9,1,0,
+    122,20,124,9,125,10,124,5,100,0,107,8,114,214,124,9,
+    125,5,87,0,53,0,100,0,125,9,126,9,88,0,89,0,
+    113,106,88,0,113,106,124,5,100,0,107,9,114,246,124,5,
+    130,1,124,10,130,1,100,0,83,0,41,2,78,114,39,0,
+    0,0,41,13,114,51,0,0,0,114,103,0,0,0,218,7,
+    101,110,118,105,114,111,110,114,9,0,0,0,114,84,0,0,
+    0,114,16,0,0,0,114,8,0,0,0,114,14,0,0,0,
+    218,3,109,97,112,114,75,0,0,0,218,17,70,105,108,101,
+    78,111,116,70,111,117,110,100,69,114,114,111,114,218,18,78,
+    111,116,65,68,105,114,101,99,116,111,114,121,69,114,114,111,
+    114,114,62,0,0,0,41,11,114,105,0,0,0,114,106,0,
+    0,0,114,110,0,0,0,90,9,101,120,101,99,95,102,117,
+    110,99,90,7,97,114,103,114,101,115,116,90,9,115,97,118,
+    101,100,95,101,120,99,218,9,112,97,116,104,95,108,105,115,
+    116,114,32,0,0,0,90,8,102,117,108,108,110,97,109,101,
+    218,1,101,90,8,108,97,115,116,95,101,120,99,114,22,0,
+    0,0,114,22,0,0,0,114,23,0,0,0,114,117,0,0,
+    0,66,2,0,0,115,54,0,0,0,0,1,8,1,4,1,
+    10,2,4,1,6,1,4,2,10,1,14,1,4,1,4,1,
+    8,1,8,1,8,1,10,1,8,1,12,1,2,1,18,1,
+    20,1,20,1,16,1,4,1,8,1,24,1,8,1,4,1,
+    114,117,0,0,0,99,1,0,0,0,0,0,0,0,4,0,
+    0,0,10,0,0,0,67,0,0,0,115,202,0,0,0,100,
+    1,100,2,108,0,125,1,124,0,100,2,107,8,114,20,116,
+    1,125,0,124,1,160,2,161,0,143,146,1,0,124,1,160,
+    3,100,3,116,4,161,2,1,0,122,14,124,0,160,5,100,
+    4,161,1,125,2,87,0,110,24,4,0,116,6,107,10,114,
+    80,1,0,1,0,1,0,100,2,125,2,89,0,110,2,88,
+    0,116,7,114,170,122,12,124,0,100,5,25,0,125,3,87,
+    0,110,24,4,0,116,8,116,6,102,2,107,10,114,122,1,
+    0,1,0,1,0,89,0,110,22,88,0,124,2,100,2,107,
+    9,114,140,116,9,100,6,131,1,130,1,124,3,125,2,124,
+    2,100,2,107,9,114,170,116,10,124,2,116,11,131,2,114,
+    170,116,12,124,2,131,1,125,2,87,0,53,0,81,0,82,
+    0,88,0,124,2,100,2,107,8,114,192,116,13,125,2,124,
+    2,160,14,116,15,161,1,83,0,41,7,122,243,82,101,116,
+    117,114,110,115,32,116,104,101,32,115,101,113,117,101,110,99,
+    101,32,111,102,32,100,105,114,101,99,116,111,114,105,101,115,
+    32,116,104,97,116,32,119,105,108,108,32,98,101,32,115,101,
+    97,114,99,104,101,100,32,102,111,114,32,116,104,101,10,32,
+    32,32,32,110,97,109,101,100,32,101,120,101,99,117,116,97,
+    98,108,101,32,40,115,105,109,105,108,97,114,32,116,111,32,
+    97,32,115,104,101,108,108,41,32,119,104,101,110,32,108,97,
+    117,110,99,104,105,110,103,32,97,32,112,114,111,99,101,115,
+    115,46,10,10,32,32,32,32,42,101,110,118,42,32,109,117,
+    115,116,32,98,101,32,97,110,32,101,110,118,105,114,111,110,
+    109,101,110,116,32,118,97,114,105,97,98,108,101,32,100,105,
+    99,116,32,111,114,32,78,111,110,101,46,32,32,73,102,32,
+    42,101,110,118,42,32,105,115,32,78,111,110,101,44,10,32,
+    32,32,32,111,115,46,101,110,118,105,114,111,110,32,119,105,
+    108,108,32,98,101,32,117,115,101,100,46,10,32,32,32,32,
+    114,0,0,0,0,78,90,6,105,103,110,111,114,101,90,4,
+    80,65,84,72,115,4,0,0,0,80,65,84,72,122,42,101,
+    110,118,32,99,97,110,110,111,116,32,99,111,110,116,97,105,
+    110,32,39,80,65,84,72,39,32,97,110,100,32,98,39,80,
+    65,84,72,39,32,107,101,121,115,41,16,218,8,119,97,114,
+    110,105,110,103,115,114,118,0,0,0,90,14,99,97,116,99,
+    104,95,119,97,114,110,105,110,103,115,90,12,115,105,109,112,
+    108,101,102,105,108,116,101,114,218,12,66,121,116,101,115,87,
+    97,114,110,105,110,103,218,3,103,101,116,218,9,84,121,112,
+    101,69,114,114,111,114,218,22,115,117,112,112,111,114,116,115,
+    95,98,121,116,101,115,95,101,110,118,105,114,111,110,218,8,
+    75,101,121,69,114,114,111,114,218,10,86,97,108,117,101,69,
+    114,114,111,114,114,60,0,0,0,114,61,0,0,0,114,15,
+    0,0,0,114,7,0,0,0,114,56,0,0,0,114,5,0,
+    0,0,41,4,114,110,0,0,0,114,124,0,0,0,114,122,
+    0,0,0,90,10,112,97,116,104,95,108,105,115,116,98,114,
+    22,0,0,0,114,22,0,0,0,114,23,0,0,0,114,16,
+    0,0,0,98,2,0,0,115,48,0,0,0,0,10,8,2,
+    8,1,4,4,10,1,12,2,2,1,14,1,14,1,10,2,
+    4,1,2,1,12,1,18,1,6,2,8,1,2,1,2,255,
+    4,2,4,2,18,1,18,2,8,1,4,1,41,1,218,14,
+    77,117,116,97,98,108,101,77,97,112,112,105,110,103,99,0,
+    0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,64,
+    0,0,0,115,84,0,0,0,101,0,90,1,100,0,90,2,
+    100,1,100,2,132,0,90,3,100,3,100,4,132,0,90,4,
+    100,5,100,6,132,0,90,5,100,7,100,8,132,0,90,6,
+    100,9,100,10,132,0,90,7,100,11,100,12,132,0,90,8,
+    100,13,100,14,132,0,90,9,100,15,100,16,132,0,90,10,
+    100,17,100,18,132,0,90,11,100,19,83,0,41,20,218,8,
+    95,69,110,118,105,114,111,110,99,8,0,0,0,0,0,0,
+    0,8,0,0,0,2,0,0,0,67,0,0,0,115,46,0,
+    0,0,124,2,124,0,95,0,124,3,124,0,95,1,124,4,
+    124,0,95,2,124,5,124,0,95,3,124,6,124,0,95,4,
+    124,7,124,0,95,5,124,1,124,0,95,6,100,0,83,0,
+    114,20,0,0,0,41,7,218,9,101,110,99,111,100,101,107,
+    101,121,218,9,100,101,99,111,100,101,107,101,121,218,11,101,
+    110,99,111,100,101,118,97,108,117,101,218,11,100,101,99,111,
+    100,101,118,97,108,117,101,218,6,112,117,116,101,110,118,218,
+    8,117,110,115,101,116,101,110,118,218,5,95,100,97,116,97,
+    41,8,218,4,115,101,108,102,218,4,100,97,116,97,114,133,
+    0,0,0,114,134,0,0,0,114,135,0,0,0,114,136,0,
+    0,0,114,137,0,0,0,114,138,0,0,0,114,22,0,0,
+    0,114,22,0,0,0,114,23,0,0,0,218,8,95,95,105,
+    110,105,116,95,95,146,2,0,0,115,14,0,0,0,0,1,
+    6,1,6,1,6,1,6,1,6,1,6,1,122,17,95,69,
+    110,118,105,114,111,110,46,95,95,105,110,105,116,95,95,99,
+    2,0,0,0,0,0,0,0,3,0,0,0,8,0,0,0,
+    67,0,0,0,115,62,0,0,0,122,20,124,0,106,0,124,
+    0,160,1,124,1,161,1,25,0,125,2,87,0,110,30,4,
+    0,116,2,107,10,114,50,1,0,1,0,1,0,116,2,124,
+    1,131,1,100,0,130,2,89,0,110,2,88,0,124,0,160,
+    3,124,2,161,1,83,0,114,20,0,0,0,41,4,114,139,
+    0,0,0,114,133,0,0,0,114,129,0,0,0,114,136,0,
+    0,0,169,3,114,140,0,0,0,218,3,107,101,121,218,5,
+    118,97,108,117,101,114,22,0,0,0,114,22,0,0,0,114,
+    23,0,0,0,218,11,95,95,103,101,116,105,116,101,109,95,
+    95,155,2,0,0,115,10,0,0,0,0,1,2,1,20,1,
+    14,2,16,1,122,20,95,69,110,118,105,114,111,110,46,95,
+    95,103,101,116,105,116,101,109,95,95,99,3,0,0,0,0,
+    0,0,0,3,0,0,0,4,0,0,0,67,0,0,0,115,
+    46,0,0,0,124,0,160,0,124,1,161,1,125,1,124,0,
+    160,1,124,2,161,1,125,2,124,0,160,2,124,1,124,2,
+    161,2,1,0,124,2,124,0,106,3,124,1,60,0,100,0,
+    83,0,114,20,0,0,0,41,4,114,133,0,0,0,114,135,
+    0,0,0,114,137,0,0,0,114,139,0,0,0,114,143,0,
+    0,0,114,22,0,0,0,114,22,0,0,0,114,23,0,0,
+    0,218,11,95,95,115,101,116,105,116,101,109,95,95,163,2,
+    0,0,115,8,0,0,0,0,1,10,1,10,1,12,1,122,
+    20,95,69,110,118,105,114,111,110,46,95,95,115,101,116,105,
+    116,101,109,95,95,99,2,0,0,0,0,0,0,0,3,0,
+    0,0,8,0,0,0,67,0,0,0,115,68,0,0,0,124,
+    0,160,0,124,1,161,1,125,2,124,0,160,1,124,2,161,
+    1,1,0,122,12,124,0,106,2,124,2,61,0,87,0,110,
+    30,4,0,116,3,107,10,114,62,1,0,1,0,1,0,116,
+    3,124,1,131,1,100,0,130,2,89,0,110,2,88,0,100,
+    0,83,0,114,20,0,0,0,41,4,114,133,0,0,0,114,
+    138,0,0,0,114,139,0,0,0,114,129,0,0,0,41,3,
+    114,140,0,0,0,114,144,0,0,0,90,10,101,110,99,111,
+    100,101,100,107,101,121,114,22,0,0,0,114,22,0,0,0,
+    114,23,0,0,0,218,11,95,95,100,101,108,105,116,101,109,
+    95,95,169,2,0,0,115,12,0,0,0,0,1,10,1,10,
+    1,2,1,12,1,14,2,122,20,95,69,110,118,105,114,111,
+    110,46,95,95,100,101,108,105,116,101,109,95,95,99,1,0,
+    0,0,0,0,0,0,3,0,0,0,4,0,0,0,99,0,
+    0,0,115,36,0,0,0,116,0,124,0,106,1,131,1,125,
+    1,124,1,68,0,93,16,125,2,124,0,160,2,124,2,161,
+    1,86,0,1,0,113,14,100,0,83,0,114,20,0,0,0,
+    41,3,114,29,0,0,0,114,139,0,0,0,114,134,0,0,
+    0,41,3,114,140,0,0,0,218,4,107,101,121,115,114,144,
+    0,0,0,114,22,0,0,0,114,22,0,0,0,114,23,0,
+    0,0,218,8,95,95,105,116,101,114,95,95,178,2,0,0,
+    115,6,0,0,0,0,2,10,1,8,1,122,17,95,69,110,
+    118,105,114,111,110,46,95,95,105,116,101,114,95,95,99,1,
+    0,0,0,0,0,0,0,1,0,0,0,2,0,0,0,67,
+    0,0,0,115,10,0,0,0,116,0,124,0,106,1,131,1,
+    83,0,114,20,0,0,0,41,2,218,3,108,101,110,114,139,
+    0,0,0,169,1,114,140,0,0,0,114,22,0,0,0,114,
+    22,0,0,0,114,23,0,0,0,218,7,95,95,108,101,110,
+    95,95,184,2,0,0,115,2,0,0,0,0,1,122,16,95,
+    69,110,118,105,114,111,110,46,95,95,108,101,110,95,95,99,
+    1,0,0,0,0,0,0,0,1,0,0,0,7,0,0,0,
+    3,0,0,0,115,36,0,0,0,100,1,160,0,100,2,160,
+    1,135,0,102,1,100,3,100,4,132,8,136,0,106,2,160,
+    3,161,0,68,0,131,1,161,1,161,1,83,0,41,5,78,
+    122,15,101,110,118,105,114,111,110,40,123,123,123,125,125,125,
+    41,122,2,44,32,99,1,0,0,0,0,0,0,0,3,0,
+    0,0,7,0,0,0,51,0,0,0,115,42,0,0,0,124,
+    0,93,34,92,2,125,1,125,2,100,0,160,0,136,0,160,
+    1,124,1,161,1,136,0,160,2,124,2,161,1,161,2,86,
+    0,1,0,113,2,100,1,83,0,41,2,122,10,123,33,114,
+    125,58,32,123,33,114,125,78,41,3,218,6,102,111,114,109,
+    97,116,114,134,0,0,0,114,136,0,0,0,41,3,114,26,
+    0,0,0,114,144,0,0,0,114,145,0,0,0,114,152,0,
+    0,0,114,22,0,0,0,114,23,0,0,0,218,9,60,103,
+    101,110,101,120,112,114,62,189,2,0,0,115,4,0,0,0,
+    4,1,6,255,122,36,95,69,110,118,105,114,111,110,46,95,
+    95,114,101,112,114,95,95,46,60,108,111,99,97,108,115,62,
+    46,60,103,101,110,101,120,112,114,62,41,4,114,154,0,0,
+    0,114,75,0,0,0,114,139,0,0,0,218,5,105,116,101,
+    109,115,114,152,0,0,0,114,22,0,0,0,114,152,0,0,
+    0,114,23,0,0,0,218,8,95,95,114,101,112,114,95,95,
+    187,2,0,0,115,10,0,0,0,0,1,8,1,10,1,8,
+    255,4,255,122,17,95,69,110,118,105,114,111,110,46,95,95,
+    114,101,112,114,95,95,99,1,0,0,0,0,0,0,0,1,
+    0,0,0,2,0,0,0,67,0,0,0,115,8,0,0,0,
+    116,0,124,0,131,1,83,0,114,20,0,0,0,41,1,218,
+    4,100,105,99,116,114,152,0,0,0,114,22,0,0,0,114,
+    22,0,0,0,114,23,0,0,0,218,4,99,111,112,121,192,
+    2,0,0,115,2,0,0,0,0,1,122,13,95,69,110,118,
+    105,114,111,110,46,99,111,112,121,99,3,0,0,0,0,0,
+    0,0,3,0,0,0,3,0,0,0,67,0,0,0,115,24,
+    0,0,0,124,1,124,0,107,7,114,16,124,2,124,0,124,
+    1,60,0,124,0,124,1,25,0,83,0,114,20,0,0,0,
+    114,22,0,0,0,114,143,0,0,0,114,22,0,0,0,114,
+    22,0,0,0,114,23,0,0,0,218,10,115,101,116,100,101,
+    102,97,117,108,116,195,2,0,0,115,6,0,0,0,0,1,
+    8,1,8,1,122,19,95,69,110,118,105,114,111,110,46,115,
+    101,116,100,101,102,97,117,108,116,78,41,12,218,8,95,95,
+    110,97,109,101,95,95,218,10,95,95,109,111,100,117,108,101,
+    95,95,218,12,95,95,113,117,97,108,110,97,109,101,95,95,
+    114,142,0,0,0,114,146,0,0,0,114,147,0,0,0,114,
+    148,0,0,0,114,150,0,0,0,114,153,0,0,0,114,157,
+    0,0,0,114,159,0,0,0,114,160,0,0,0,114,22,0,
+    0,0,114,22,0,0,0,114,22,0,0,0,114,23,0,0,
+    0,114,132,0,0,0,145,2,0,0,115,18,0,0,0,8,
+    1,8,9,8,8,8,6,8,9,8,6,8,3,8,5,8,
+    3,114,132,0,0,0,99,2,0,0,0,0,0,0,0,2,
+    0,0,0,1,0,0,0,67,0,0,0,115,4,0,0,0,
+    100,0,83,0,114,20,0,0,0,114,22,0,0,0,41,2,
+    114,144,0,0,0,114,145,0,0,0,114,22,0,0,0,114,
+    22,0,0,0,114,23,0,0,0,218,8,60,108,97,109,98,
+    100,97,62,203,2,0,0,243,0,0,0,0,114,164,0,0,
+    0,114,137,0,0,0,99,1,0,0,0,0,0,0,0,1,
+    0,0,0,3,0,0,0,67,0,0,0,115,10,0,0,0,
+    116,0,124,0,100,1,131,2,83,0,41,2,78,218,0,41,
+    1,218,7,95,112,117,116,101,110,118,169,1,114,144,0,0,
+    0,114,22,0,0,0,114,22,0,0,0,114,23,0,0,0,
+    114,164,0,0,0,211,2,0,0,114,165,0,0,0,114,138,
+    0,0,0,99,0,0,0,0,0,0,0,0,6,0,0,0,
+    8,0,0,0,3,0,0,0,115,132,0,0,0,116,0,100,
+    1,107,2,114,72,100,2,100,3,132,0,125,0,124,0,137,
+    0,116,1,125,1,135,0,102,1,100,4,100,5,132,8,125,
+    2,105,0,125,3,116,2,160,3,161,0,68,0,93,20,92,
+    2,125,4,125,5,124,5,124,3,124,2,124,4,131,1,60,
+    0,113,48,110,40,116,4,160,5,161,0,137,1,135,1,102,
+    1,100,6,100,7,132,8,137,0,135,1,102,1,100,8,100,
+    9,132,8,125,1,136,0,125,2,116,2,125,3,116,6,124,
+    3,124,2,124,1,136,0,124,1,116,7,116,8,131,7,83,
+    0,41,10,78,114,39,0,0,0,99,1,0,0,0,0,0,
+    0,0,1,0,0,0,4,0,0,0,83,0,0,0,115,32,
+    0,0,0,116,0,124,0,116,1,131,2,115,28,116,2,100,
+    1,116,3,124,0,131,1,106,4,22,0,131,1,130,1,124,
+    0,83,0,41,2,78,250,20,115,116,114,32,101,120,112,101,
+    99,116,101,100,44,32,110,111,116,32,37,115,41,5,114,60,
+    0,0,0,114,43,0,0,0,114,127,0,0,0,218,4,116,
+    121,112,101,114,161,0,0,0,169,1,114,145,0,0,0,114,
+    22,0,0,0,114,22,0,0,0,114,23,0,0,0,218,9,
+    99,104,101,99,107,95,115,116,114,219,2,0,0,115,6,0,
+    0,0,0,1,10,1,18,1,122,33,95,99,114,101,97,116,
+    101,101,110,118,105,114,111,110,46,60,108,111,99,97,108,115,
+    62,46,99,104,101,99,107,95,115,116,114,99,1,0,0,0,
+    0,0,0,0,1,0,0,0,2,0,0,0,19,0,0,0,
+    115,12,0,0,0,136,0,124,0,131,1,160,0,161,0,83,
+    0,114,20,0,0,0,41,1,218,5,117,112,112,101,114,114,
+    168,0,0,0,41,1,218,6,101,110,99,111,100,101,114,22,
+    0,0,0,114,23,0,0,0,114,133,0,0,0,225,2,0,
+    0,115,2,0,0,0,0,1,122,33,95,99,114,101,97,116,
+    101,101,110,118,105,114,111,110,46,60,108,111,99,97,108,115,
+    62,46,101,110,99,111,100,101,107,101,121,99,1,0,0,0,
+    0,0,0,0,1,0,0,0,4,0,0,0,19,0,0,0,
+    115,40,0,0,0,116,0,124,0,116,1,131,2,115,28,116,
+    2,100,1,116,3,124,0,131,1,106,4,22,0,131,1,130,
+    1,124,0,160,5,136,0,100,2,161,2,83,0,41,3,78,
+    114,169,0,0,0,218,15,115,117,114,114,111,103,97,116,101,
+    101,115,99,97,112,101,41,6,114,60,0,0,0,114,43,0,
+    0,0,114,127,0,0,0,114,170,0,0,0,114,161,0,0,
+    0,114,174,0,0,0,114,171,0,0,0,169,1,218,8,101,
+    110,99,111,100,105,110,103,114,22,0,0,0,114,23,0,0,
+    0,114,174,0,0,0,233,2,0,0,115,6,0,0,0,0,
+    1,10,1,18,1,122,30,95,99,114,101,97,116,101,101,110,
+    118,105,114,111,110,46,60,108,111,99,97,108,115,62,46,101,
+    110,99,111,100,101,99,1,0,0,0,0,0,0,0,1,0,
+    0,0,4,0,0,0,19,0,0,0,115,12,0,0,0,124,
+    0,160,0,136,0,100,1,161,2,83,0,41,2,78,114,175,
+    0,0,0,41,1,218,6,100,101,99,111,100,101,114,171,0,
+    0,0,114,176,0,0,0,114,22,0,0,0,114,23,0,0,
+    0,114,178,0,0,0,237,2,0,0,115,2,0,0,0,0,
+    1,122,30,95,99,114,101,97,116,101,101,110,118,105,114,111,
+    110,46,60,108,111,99,97,108,115,62,46,100,101,99,111,100,
+    101,41,9,114,8,0,0,0,114,43,0,0,0,114,118,0,
+    0,0,114,156,0,0,0,218,3,115,121,115,218,21,103,101,
+    116,102,105,108,101,115,121,115,116,101,109,101,110,99,111,100,
+    105,110,103,114,132,0,0,0,114,167,0,0,0,218,9,95,
+    117,110,115,101,116,101,110,118,41,6,114,172,0,0,0,114,
+    178,0,0,0,114,133,0,0,0,114,141,0,0,0,114,144,
+    0,0,0,114,145,0,0,0,114,22,0,0,0,41,2,114,
+    174,0,0,0,114,177,0,0,0,114,23,0,0,0,218,14,
+    95,99,114,101,97,116,101,101,110,118,105,114,111,110,216,2,
+    0,0,115,42,0,0,0,0,1,8,2,8,4,4,1,4,
+    1,12,2,4,1,16,1,16,3,8,1,12,4,12,2,4,
+    1,4,1,4,1,2,0,2,1,2,0,2,1,2,0,2,
+    253,114,182,0,0,0,99,2,0,0,0,0,0,0,0,2,
+    0,0,0,4,0,0,0,67,0,0,0,115,12,0,0,0,
+    116,0,160,1,124,0,124,1,161,2,83,0,41,1,122,169,
+    71,101,116,32,97,110,32,101,110,118,105,114,111,110,109,101,
+    110,116,32,118,97,114,105,97,98,108,101,44,32,114,101,116,
+    117,114,110,32,78,111,110,101,32,105,102,32,105,116,32,100,
+    111,101,115,110,39,116,32,101,120,105,115,116,46,10,32,32,
+    32,32,84,104,101,32,111,112,116,105,111,110,97,108,32,115,
+    101,99,111,110,100,32,97,114,103,117,109,101,110,116,32,99,
+    97,110,32,115,112,101,99,105,102,121,32,97,110,32,97,108,
+    116,101,114,110,97,116,101,32,100,101,102,97,117,108,116,46,
+    10,32,32,32,32,107,101,121,44,32,100,101,102,97,117,108,
+    116,32,97,110,100,32,116,104,101,32,114,101,115,117,108,116,
+    32,97,114,101,32,115,116,114,46,41,2,114,118,0,0,0,
+    114,126,0,0,0,169,2,114,144,0,0,0,90,7,100,101,
+    102,97,117,108,116,114,22,0,0,0,114,22,0,0,0,114,
+    23,0,0,0,218,6,103,101,116,101,110,118,251,2,0,0,
+    115,2,0,0,0,0,4,114,184,0,0,0,41,2,114,184,
+    0,0,0,114,128,0,0,0,99,1,0,0,0,0,0,0,
+    0,1,0,0,0,4,0,0,0,67,0,0,0,115,32,0,
+    0,0,116,0,124,0,116,1,131,2,115,28,116,2,100,1,
+    116,3,124,0,131,1,106,4,22,0,131,1,130,1,124,0,
+    83,0,41,2,78,122,22,98,121,116,101,115,32,101,120,112,
+    101,99,116,101,100,44,32,110,111,116,32,37,115,41,5,114,
+    60,0,0,0,114,61,0,0,0,114,127,0,0,0,114,170,
+    0,0,0,114,161,0,0,0,114,171,0,0,0,114,22,0,
+    0,0,114,22,0,0,0,114,23,0,0,0,218,12,95,99,
+    104,101,99,107,95,98,121,116,101,115,5,3,0,0,115,6,
+    0,0,0,0,1,10,1,18,1,114,185,0,0,0,99,2,
+    0,0,0,0,0,0,0,2,0,0,0,4,0,0,0,67,
+    0,0,0,115,12,0,0,0,116,0,160,1,124,0,124,1,
+    161,2,83,0,41,1,122,179,71,101,116,32,97,110,32,101,
+    110,118,105,114,111,110,109,101,110,116,32,118,97,114,105,97,
+    98,108,101,44,32,114,101,116,117,114,110,32,78,111,110,101,
+    32,105,102,32,105,116,32,100,111,101,115,110,39,116,32,101,
+    120,105,115,116,46,10,32,32,32,32,32,32,32,32,84,104,
+    101,32,111,112,116,105,111,110,97,108,32,115,101,99,111,110,
+    100,32,97,114,103,117,109,101,110,116,32,99,97,110,32,115,
+    112,101,99,105,102,121,32,97,110,32,97,108,116,101,114,110,
+    97,116,101,32,100,101,102,97,117,108,116,46,10,32,32,32,
+    32,32,32,32,32,107,101,121,44,32,100,101,102,97,117,108,
+    116,32,97,110,100,32,116,104,101,32,114,101,115,117,108,116,
+    32,97,114,101,32,98,121,116,101,115,46,41,2,218,8,101,
+    110,118,105,114,111,110,98,114,126,0,0,0,114,183,0,0,
+    0,114,22,0,0,0,114,22,0,0,0,114,23,0,0,0,
+    218,7,103,101,116,101,110,118,98,17,3,0,0,115,2,0,
+    0,0,0,4,114,187,0,0,0,41,2,114,186,0,0,0,
+    114,187,0,0,0,99,0,0,0,0,0,0,0,0,2,0,
+    0,0,3,0,0,0,3,0,0,0,115,52,0,0,0,116,
+    0,160,1,161,0,137,0,116,0,160,2,161,0,137,1,135,
+    0,135,1,102,2,100,1,100,2,132,8,125,0,135,0,135,
+    1,102,2,100,3,100,4,132,8,125,1,124,0,124,1,102,
+    2,83,0,41,5,78,99,1,0,0,0,0,0,0,0,1,
+    0,0,0,4,0,0,0,19,0,0,0,115,38,0,0,0,
+    116,0,124,0,131,1,125,0,116,1,124,0,116,2,131,2,
+    114,30,124,0,160,3,136,0,136,1,161,2,83,0,124,0,
+    83,0,100,1,83,0,41,2,97,23,1,0,0,69,110,99,
+    111,100,101,32,102,105,108,101,110,97,109,101,32,40,97,110,
+    32,111,115,46,80,97,116,104,76,105,107,101,44,32,98,121,
+    116,101,115,44,32,111,114,32,115,116,114,41,32,116,111,32,
+    116,104,101,32,102,105,108,101,115,121,115,116,101,109,10,32,
+    32,32,32,32,32,32,32,101,110,99,111,100,105,110,103,32,
+    119,105,116,104,32,39,115,117,114,114,111,103,97,116,101,101,
+    115,99,97,112,101,39,32,101,114,114,111,114,32,104,97,110,
+    100,108,101,114,44,32,114,101,116,117,114,110,32,98,121,116,
+    101,115,32,117,110,99,104,97,110,103,101,100,46,10,32,32,
+    32,32,32,32,32,32,79,110,32,87,105,110,100,111,119,115,
+    44,32,117,115,101,32,39,115,116,114,105,99,116,39,32,101,
+    114,114,111,114,32,104,97,110,100,108,101,114,32,105,102,32,
+    116,104,101,32,102,105,108,101,32,115,121,115,116,101,109,32,
+    101,110,99,111,100,105,110,103,32,105,115,10,32,32,32,32,
+    32,32,32,32,39,109,98,99,115,39,32,40,119,104,105,99,
+    104,32,105,115,32,116,104,101,32,100,101,102,97,117,108,116,
+    32,101,110,99,111,100,105,110,103,41,46,10,32,32,32,32,
+    32,32,32,32,78,41,4,114,68,0,0,0,114,60,0,0,
+    0,114,43,0,0,0,114,174,0,0,0,169,1,218,8,102,
+    105,108,101,110,97,109,101,169,2,114,177,0,0,0,90,6,
+    101,114,114,111,114,115,114,22,0,0,0,114,23,0,0,0,
+    114,14,0,0,0,29,3,0,0,115,8,0,0,0,0,6,
+    8,1,10,1,12,2,122,26,95,102,115,99,111,100,101,99,
+    46,60,108,111,99,97,108,115,62,46,102,115,101,110,99,111,
+    100,101,99,1,0,0,0,0,0,0,0,1,0,0,0,4,
+    0,0,0,19,0,0,0,115,38,0,0,0,116,0,124,0,
+    131,1,125,0,116,1,124,0,116,2,131,2,114,30,124,0,
+    160,3,136,0,136,1,161,2,83,0,124,0,83,0,100,1,
+    83,0,41,2,97,23,1,0,0,68,101,99,111,100,101,32,
+    102,105,108,101,110,97,109,101,32,40,97,110,32,111,115,46,
+    80,97,116,104,76,105,107,101,44,32,98,121,116,101,115,44,
+    32,111,114,32,115,116,114,41,32,102,114,111,109,32,116,104,
+    101,32,102,105,108,101,115,121,115,116,101,109,10,32,32,32,
+    32,32,32,32,32,101,110,99,111,100,105,110,103,32,119,105,
+    116,104,32,39,115,117,114,114,111,103,97,116,101,101,115,99,
+    97,112,101,39,32,101,114,114,111,114,32,104,97,110,100,108,
+    101,114,44,32,114,101,116,117,114,110,32,115,116,114,32,117,
+    110,99,104,97,110,103,101,100,46,32,79,110,10,32,32,32,
+    32,32,32,32,32,87,105,110,100,111,119,115,44,32,117,115,
+    101,32,39,115,116,114,105,99,116,39,32,101,114,114,111,114,
+    32,104,97,110,100,108,101,114,32,105,102,32,116,104,101,32,
+    102,105,108,101,32,115,121,115,116,101,109,32,101,110,99,111,
+    100,105,110,103,32,105,115,10,32,32,32,32,32,32,32,32,
+    39,109,98,99,115,39,32,40,119,104,105,99,104,32,105,115,
+    32,116,104,101,32,100,101,102,97,117,108,116,32,101,110,99,
+    111,100,105,110,103,41,46,10,32,32,32,32,32,32,32,32,
+    78,41,4,114,68,0,0,0,114,60,0,0,0,114,61,0,
+    0,0,114,178,0,0,0,114,188,0,0,0,114,190,0,0,
+    0,114,22,0,0,0,114,23,0,0,0,114,15,0,0,0,
+    41,3,0,0,115,8,0,0,0,0,6,8,1,10,1,12,
+    2,122,26,95,102,115,99,111,100,101,99,46,60,108,111,99,
+    97,108,115,62,46,102,115,100,101,99,111,100,101,41,3,114,
+    179,0,0,0,114,180,0,0,0,218,25,103,101,116,102,105,
+    108,101,115,121,115,116,101,109,101,110,99,111,100,101,101,114,
+    114,111,114,115,41,2,114,14,0,0,0,114,15,0,0,0,
+    114,22,0,0,0,114,190,0,0,0,114,23,0,0,0,218,
+    8,95,102,115,99,111,100,101,99,25,3,0,0,115,10,0,
+    0,0,0,1,8,1,8,2,14,12,14,12,114,192,0,0,
+    0,218,4,102,111,114,107,218,6,115,112,97,119,110,118,114,
+    103,0,0,0,218,6,80,95,87,65,73,84,218,8,80,95,
+    78,79,87,65,73,84,218,9,80,95,78,79,87,65,73,84,
+    79,99,5,0,0,0,0,0,0,0,8,0,0,0,6,0,
+    0,0,67,0,0,0,115,198,0,0,0,116,0,124,2,116,
+    1,116,2,102,2,131,2,115,22,116,3,100,1,131,1,130,
+    1,124,2,114,34,124,2,100,2,25,0,115,42,116,4,100,
+    3,131,1,130,1,116,5,131,0,125,5,124,5,115,112,122,
+    36,124,3,100,0,107,8,114,74,124,4,124,1,124,2,131,
+    2,1,0,110,12,124,4,124,1,124,2,124,3,131,3,1,
+    0,87,0,113,194,1,0,1,0,1,0,116,6,100,4,131,
+    1,1,0,89,0,113,194,88,0,110,82,124,0,116,7,107,
+    2,114,124,124,5,83,0,116,8,124,5,100,2,131,2,92,
+    2,125,6,125,7,116,9,124,7,131,1,114,150,113,124,113,
+    124,116,10,124,7,131,1,114,168,116,11,124,7,131,1,11,
+    0,83,0,116,12,124,7,131,1,114,184,116,13,124,7,131,
+    1,83,0,116,14,100,5,131,1,130,1,113,124,100,0,83,
+    0,41,6,78,122,30,97,114,103,118,32,109,117,115,116,32,
+    98,101,32,97,32,116,117,112,108,101,32,111,114,32,97,32,
+    108,105,115,116,114,0,0,0,0,122,34,97,114,103,118,32,
+    102,105,114,115,116,32,101,108,101,109,101,110,116,32,99,97,
+    110,110,111,116,32,98,101,32,101,109,112,116,121,233,127,0,
+    0,0,122,34,78,111,116,32,115,116,111,112,112,101,100,44,
+    32,115,105,103,110,97,108,101,100,32,111,114,32,101,120,105,
+    116,101,100,63,63,63,41,15,114,60,0,0,0,218,5,116,
+    117,112,108,101,114,29,0,0,0,114,127,0,0,0,114,130,
+    0,0,0,114,193,0,0,0,114,37,0,0,0,114,196,0,
+    0,0,90,7,119,97,105,116,112,105,100,90,10,87,73,70,
+    83,84,79,80,80,69,68,90,11,87,73,70,83,73,71,78,
+    65,76,69,68,90,8,87,84,69,82,77,83,73,71,90,9,
+    87,73,70,69,88,73,84,69,68,90,11,87,69,88,73,84,
+    83,84,65,84,85,83,114,62,0,0,0,41,8,114,63,0,
+    0,0,114,105,0,0,0,114,106,0,0,0,114,110,0,0,
+    0,90,4,102,117,110,99,90,3,112,105,100,90,4,119,112,
+    105,100,90,3,115,116,115,114,22,0,0,0,114,22,0,0,
+    0,114,23,0,0,0,218,9,95,115,112,97,119,110,118,101,
+    102,70,3,0,0,115,44,0,0,0,0,2,14,1,8,1,
+    12,1,8,1,6,1,4,2,2,1,8,1,12,2,16,1,
+    6,1,16,3,8,1,4,2,14,1,8,1,4,1,8,1,
+    10,1,8,1,8,2,114,200,0,0,0,99,3,0,0,0,
+    0,0,0,0,3,0,0,0,6,0,0,0,67,0,0,0,
+    115,16,0,0,0,116,0,124,0,124,1,124,2,100,1,116,
+    1,131,5,83,0,41,2,97,21,1,0,0,115,112,97,119,
+    110,118,40,109,111,100,101,44,32,102,105,108,101,44,32,97,
+    114,103,115,41,32,45,62,32,105,110,116,101,103,101,114,10,
+    10,69,120,101,99,117,116,101,32,102,105,108,101,32,119,105,
+    116,104,32,97,114,103,117,109,101,110,116,115,32,102,114,111,
+    109,32,97,114,103,115,32,105,110,32,97,32,115,117,98,112,
+    114,111,99,101,115,115,46,10,73,102,32,109,111,100,101,32,
+    61,61,32,80,95,78,79,87,65,73,84,32,114,101,116,117,
+    114,110,32,116,104,101,32,112,105,100,32,111,102,32,116,104,
+    101,32,112,114,111,99,101,115,115,46,10,73,102,32,109,111,
+    100,101,32,61,61,32,80,95,87,65,73,84,32,114,101,116,
+    117,114,110,32,116,104,101,32,112,114,111,99,101,115,115,39,
+    115,32,101,120,105,116,32,99,111,100,101,32,105,102,32,105,
+    116,32,101,120,105,116,115,32,110,111,114,109,97,108,108,121,
+    59,10,111,116,104,101,114,119,105,115,101,32,114,101,116,117,
+    114,110,32,45,83,73,71,44,32,119,104,101,114,101,32,83,
+    73,71,32,105,115,32,116,104,101,32,115,105,103,110,97,108,
+    32,116,104,97,116,32,107,105,108,108,101,100,32,105,116,46,
+    32,78,41,2,114,200,0,0,0,114,103,0,0,0,169,3,
+    114,63,0,0,0,114,105,0,0,0,114,106,0,0,0,114,
+    22,0,0,0,114,22,0,0,0,114,23,0,0,0,114,194,
+    0,0,0,101,3,0,0,115,2,0,0,0,0,7,99,4,
+    0,0,0,0,0,0,0,4,0,0,0,6,0,0,0,67,
+    0,0,0,115,16,0,0,0,116,0,124,0,124,1,124,2,
+    124,3,116,1,131,5,83,0,41,1,97,58,1,0,0,115,
+    112,97,119,110,118,101,40,109,111,100,101,44,32,102,105,108,
+    101,44,32,97,114,103,115,44,32,101,110,118,41,32,45,62,
+    32,105,110,116,101,103,101,114,10,10,69,120,101,99,117,116,
+    101,32,102,105,108,101,32,119,105,116,104,32,97,114,103,117,
+    109,101,110,116,115,32,102,114,111,109,32,97,114,103,115,32,
+    105,110,32,97,32,115,117,98,112,114,111,99,101,115,115,32,
+    119,105,116,104,32,116,104,101,10,115,112,101,99,105,102,105,
+    101,100,32,101,110,118,105,114,111,110,109,101,110,116,46,10,
+    73,102,32,109,111,100,101,32,61,61,32,80,95,78,79,87,
+    65,73,84,32,114,101,116,117,114,110,32,116,104,101,32,112,
+    105,100,32,111,102,32,116,104,101,32,112,114,111,99,101,115,
+    115,46,10,73,102,32,109,111,100,101,32,61,61,32,80,95,
+    87,65,73,84,32,114,101,116,117,114,110,32,116,104,101,32,
+    112,114,111,99,101,115,115,39,115,32,101,120,105,116,32,99,
+    111,100,101,32,105,102,32,105,116,32,101,120,105,116,115,32,
+    110,111,114,109,97,108,108,121,59,10,111,116,104,101,114,119,
+    105,115,101,32,114,101,116,117,114,110,32,45,83,73,71,44,
+    32,119,104,101,114,101,32,83,73,71,32,105,115,32,116,104,
+    101,32,115,105,103,110,97,108,32,116,104,97,116,32,107,105,
+    108,108,101,100,32,105,116,46,32,41,2,114,200,0,0,0,
+    114,51,0,0,0,169,4,114,63,0,0,0,114,105,0,0,
+    0,114,106,0,0,0,114,110,0,0,0,114,22,0,0,0,
+    114,22,0,0,0,114,23,0,0,0,218,7,115,112,97,119,
+    110,118,101,110,3,0,0,115,2,0,0,0,0,8,114,203,
+    0,0,0,99,3,0,0,0,0,0,0,0,3,0,0,0,
+    6,0,0,0,67,0,0,0,115,16,0,0,0,116,0,124,
+    0,124,1,124,2,100,1,116,1,131,5,83,0,41,2,97,
+    56,1,0,0,115,112,97,119,110,118,112,40,109,111,100,101,
+    44,32,102,105,108,101,44,32,97,114,103,115,41,32,45,62,
+    32,105,110,116,101,103,101,114,10,10,69,120,101,99,117,116,
+    101,32,102,105,108,101,32,40,119,104,105,99,104,32,105,115,
+    32,108,111,111,107,101,100,32,102,111,114,32,97,108,111,110,
+    103,32,36,80,65,84,72,41,32,119,105,116,104,32,97,114,
+    103,117,109,101,110,116,115,32,102,114,111,109,10,97,114,103,
+    115,32,105,110,32,97,32,115,117,98,112,114,111,99,101,115,
+    115,46,10,73,102,32,109,111,100,101,32,61,61,32,80,95,
+    78,79,87,65,73,84,32,114,101,116,117,114,110,32,116,104,
+    101,32,112,105,100,32,111,102,32,116,104,101,32,112,114,111,
+    99,101,115,115,46,10,73,102,32,109,111,100,101,32,61,61,
+    32,80,95,87,65,73,84,32,114,101,116,117,114,110,32,116,
+    104,101,32,112,114,111,99,101,115,115,39,115,32,101,120,105,
+    116,32,99,111,100,101,32,105,102,32,105,116,32,101,120,105,
+    116,115,32,110,111,114,109,97,108,108,121,59,10,111,116,104,
+    101,114,119,105,115,101,32,114,101,116,117,114,110,32,45,83,
+    73,71,44,32,119,104,101,114,101,32,83,73,71,32,105,115,
+    32,116,104,101,32,115,105,103,110,97,108,32,116,104,97,116,
+    32,107,105,108,108,101,100,32,105,116,46,32,78,41,2,114,
+    200,0,0,0,114,112,0,0,0,114,201,0,0,0,114,22,
+    0,0,0,114,22,0,0,0,114,23,0,0,0,218,7,115,
+    112,97,119,110,118,112,122,3,0,0,115,2,0,0,0,0,
+    8,114,204,0,0,0,99,4,0,0,0,0,0,0,0,4,
+    0,0,0,6,0,0,0,67,0,0,0,115,16,0,0,0,
+    116,0,124,0,124,1,124,2,124,3,116,1,131,5,83,0,
+    41,1,97,92,1,0,0,115,112,97,119,110,118,112,101,40,
+    109,111,100,101,44,32,102,105,108,101,44,32,97,114,103,115,
+    44,32,101,110,118,41,32,45,62,32,105,110,116,101,103,101,
+    114,10,10,69,120,101,99,117,116,101,32,102,105,108,101,32,
+    40,119,104,105,99,104,32,105,115,32,108,111,111,107,101,100,
+    32,102,111,114,32,97,108,111,110,103,32,36,80,65,84,72,
+    41,32,119,105,116,104,32,97,114,103,117,109,101,110,116,115,
+    32,102,114,111,109,10,97,114,103,115,32,105,110,32,97,32,
+    115,117,98,112,114,111,99,101,115,115,32,119,105,116,104,32,
+    116,104,101,32,115,117,112,112,108,105,101,100,32,101,110,118,
+    105,114,111,110,109,101,110,116,46,10,73,102,32,109,111,100,
+    101,32,61,61,32,80,95,78,79,87,65,73,84,32,114,101,
+    116,117,114,110,32,116,104,101,32,112,105,100,32,111,102,32,
+    116,104,101,32,112,114,111,99,101,115,115,46,10,73,102,32,
+    109,111,100,101,32,61,61,32,80,95,87,65,73,84,32,114,
+    101,116,117,114,110,32,116,104,101,32,112,114,111,99,101,115,
+    115,39,115,32,101,120,105,116,32,99,111,100,101,32,105,102,
+    32,105,116,32,101,120,105,116,115,32,110,111,114,109,97,108,
+    108,121,59,10,111,116,104,101,114,119,105,115,101,32,114,101,
+    116,117,114,110,32,45,83,73,71,44,32,119,104,101,114,101,
+    32,83,73,71,32,105,115,32,116,104,101,32,115,105,103,110,
+    97,108,32,116,104,97,116,32,107,105,108,108,101,100,32,105,
+    116,46,32,41,2,114,200,0,0,0,114,114,0,0,0,114,
+    202,0,0,0,114,22,0,0,0,114,22,0,0,0,114,23,
+    0,0,0,218,8,115,112,97,119,110,118,112,101,132,3,0,
+    0,115,2,0,0,0,0,8,114,205,0,0,0,99,2,0,
+    0,0,0,0,0,0,3,0,0,0,4,0,0,0,71,0,
+    0,0,115,12,0,0,0,116,0,124,0,124,1,124,2,131,
+    3,83,0,41,1,97,22,1,0,0,115,112,97,119,110,108,
+    40,109,111,100,101,44,32,102,105,108,101,44,32,42,97,114,
+    103,115,41,32,45,62,32,105,110,116,101,103,101,114,10,10,
+    69,120,101,99,117,116,101,32,102,105,108,101,32,119,105,116,
+    104,32,97,114,103,117,109,101,110,116,115,32,102,114,111,109,
+    32,97,114,103,115,32,105,110,32,97,32,115,117,98,112,114,
+    111,99,101,115,115,46,10,73,102,32,109,111,100,101,32,61,
+    61,32,80,95,78,79,87,65,73,84,32,114,101,116,117,114,
+    110,32,116,104,101,32,112,105,100,32,111,102,32,116,104,101,
+    32,112,114,111,99,101,115,115,46,10,73,102,32,109,111,100,
+    101,32,61,61,32,80,95,87,65,73,84,32,114,101,116,117,
+    114,110,32,116,104,101,32,112,114,111,99,101,115,115,39,115,
+    32,101,120,105,116,32,99,111,100,101,32,105,102,32,105,116,
+    32,101,120,105,116,115,32,110,111,114,109,97,108,108,121,59,
+    10,111,116,104,101,114,119,105,115,101,32,114,101,116,117,114,
+    110,32,45,83,73,71,44,32,119,104,101,114,101,32,83,73,
+    71,32,105,115,32,116,104,101,32,115,105,103,110,97,108,32,
+    116,104,97,116,32,107,105,108,108,101,100,32,105,116,46,32,
+    41,1,114,194,0,0,0,114,201,0,0,0,114,22,0,0,
+    0,114,22,0,0,0,114,23,0,0,0,218,6,115,112,97,
+    119,110,108,150,3,0,0,115,2,0,0,0,0,7,114,206,
+    0,0,0,99,2,0,0,0,0,0,0,0,4,0,0,0,
+    6,0,0,0,71,0,0,0,115,30,0,0,0,124,2,100,
+    1,25,0,125,3,116,0,124,0,124,1,124,2,100,2,100,
+    1,133,2,25,0,124,3,131,4,83,0,41,3,97,58,1,
+    0,0,115,112,97,119,110,108,101,40,109,111,100,101,44,32,
+    102,105,108,101,44,32,42,97,114,103,115,44,32,101,110,118,
+    41,32,45,62,32,105,110,116,101,103,101,114,10,10,69,120,
+    101,99,117,116,101,32,102,105,108,101,32,119,105,116,104,32,
+    97,114,103,117,109,101,110,116,115,32,102,114,111,109,32,97,
+    114,103,115,32,105,110,32,97,32,115,117,98,112,114,111,99,
+    101,115,115,32,119,105,116,104,32,116,104,101,10,115,117,112,
+    112,108,105,101,100,32,101,110,118,105,114,111,110,109,101,110,
+    116,46,10,73,102,32,109,111,100,101,32,61,61,32,80,95,
+    78,79,87,65,73,84,32,114,101,116,117,114,110,32,116,104,
+    101,32,112,105,100,32,111,102,32,116,104,101,32,112,114,111,
+    99,101,115,115,46,10,73,102,32,109,111,100,101,32,61,61,
+    32,80,95,87,65,73,84,32,114,101,116,117,114,110,32,116,
+    104,101,32,112,114,111,99,101,115,115,39,115,32,101,120,105,
+    116,32,99,111,100,101,32,105,102,32,105,116,32,101,120,105,
+    116,115,32,110,111,114,109,97,108,108,121,59,10,111,116,104,
+    101,114,119,105,115,101,32,114,101,116,117,114,110,32,45,83,
+    73,71,44,32,119,104,101,114,101,32,83,73,71,32,105,115,
+    32,116,104,101,32,115,105,103,110,97,108,32,116,104,97,116,
+    32,107,105,108,108,101,100,32,105,116,46,32,114,108,0,0,
+    0,78,41,1,114,203,0,0,0,114,202,0,0,0,114,22,
+    0,0,0,114,22,0,0,0,114,23,0,0,0,218,7,115,
+    112,97,119,110,108,101,159,3,0,0,115,4,0,0,0,0,
+    8,8,1,114,207,0,0,0,99,2,0,0,0,0,0,0,
+    0,3,0,0,0,4,0,0,0,71,0,0,0,115,12,0,
+    0,0,116,0,124,0,124,1,124,2,131,3,83,0,41,1,
+    97,87,1,0,0,115,112,97,119,110,108,112,40,109,111,100,
+    101,44,32,102,105,108,101,44,32,42,97,114,103,115,41,32,
+    45,62,32,105,110,116,101,103,101,114,10,10,69,120,101,99,
+    117,116,101,32,102,105,108,101,32,40,119,104,105,99,104,32,
+    105,115,32,108,111,111,107,101,100,32,102,111,114,32,97,108,
+    111,110,103,32,36,80,65,84,72,41,32,119,105,116,104,32,
+    97,114,103,117,109,101,110,116,115,32,102,114,111,109,10,97,
+    114,103,115,32,105,110,32,97,32,115,117,98,112,114,111,99,
+    101,115,115,32,119,105,116,104,32,116,104,101,32,115,117,112,
+    112,108,105,101,100,32,101,110,118,105,114,111,110,109,101,110,
+    116,46,10,73,102,32,109,111,100,101,32,61,61,32,80,95,
+    78,79,87,65,73,84,32,114,101,116,117,114,110,32,116,104,
+    101,32,112,105,100,32,111,102,32,116,104,101,32,112,114,111,
+    99,101,115,115,46,10,73,102,32,109,111,100,101,32,61,61,
+    32,80,95,87,65,73,84,32,114,101,116,117,114,110,32,116,
+    104,101,32,112,114,111,99,101,115,115,39,115,32,101,120,105,
+    116,32,99,111,100,101,32,105,102,32,105,116,32,101,120,105,
+    116,115,32,110,111,114,109,97,108,108,121,59,10,111,116,104,
+    101,114,119,105,115,101,32,114,101,116,117,114,110,32,45,83,
+    73,71,44,32,119,104,101,114,101,32,83,73,71,32,105,115,
+    32,116,104,101,32,115,105,103,110,97,108,32,116,104,97,116,
+    32,107,105,108,108,101,100,32,105,116,46,32,41,1,114,204,
+    0,0,0,114,201,0,0,0,114,22,0,0,0,114,22,0,
+    0,0,114,23,0,0,0,218,7,115,112,97,119,110,108,112,
+    177,3,0,0,115,2,0,0,0,0,8,114,208,0,0,0,
+    99,2,0,0,0,0,0,0,0,4,0,0,0,6,0,0,
+    0,71,0,0,0,115,30,0,0,0,124,2,100,1,25,0,
+    125,3,116,0,124,0,124,1,124,2,100,2,100,1,133,2,
+    25,0,124,3,131,4,83,0,41,3,97,93,1,0,0,115,
+    112,97,119,110,108,112,101,40,109,111,100,101,44,32,102,105,
+    108,101,44,32,42,97,114,103,115,44,32,101,110,118,41,32,
+    45,62,32,105,110,116,101,103,101,114,10,10,69,120,101,99,
+    117,116,101,32,102,105,108,101,32,40,119,104,105,99,104,32,
+    105,115,32,108,111,111,107,101,100,32,102,111,114,32,97,108,
+    111,110,103,32,36,80,65,84,72,41,32,119,105,116,104,32,
+    97,114,103,117,109,101,110,116,115,32,102,114,111,109,10,97,
+    114,103,115,32,105,110,32,97,32,115,117,98,112,114,111,99,
+    101,115,115,32,119,105,116,104,32,116,104,101,32,115,117,112,
+    112,108,105,101,100,32,101,110,118,105,114,111,110,109,101,110,
+    116,46,10,73,102,32,109,111,100,101,32,61,61,32,80,95,
+    78,79,87,65,73,84,32,114,101,116,117,114,110,32,116,104,
+    101,32,112,105,100,32,111,102,32,116,104,101,32,112,114,111,
+    99,101,115,115,46,10,73,102,32,109,111,100,101,32,61,61,
+    32,80,95,87,65,73,84,32,114,101,116,117,114,110,32,116,
+    104,101,32,112,114,111,99,101,115,115,39,115,32,101,120,105,
+    116,32,99,111,100,101,32,105,102,32,105,116,32,101,120,105,
+    116,115,32,110,111,114,109,97,108,108,121,59,10,111,116,104,
+    101,114,119,105,115,101,32,114,101,116,117,114,110,32,45,83,
+    73,71,44,32,119,104,101,114,101,32,83,73,71,32,105,115,
+    32,116,104,101,32,115,105,103,110,97,108,32,116,104,97,116,
+    32,107,105,108,108,101,100,32,105,116,46,32,114,108,0,0,
+    0,78,41,1,114,205,0,0,0,114,202,0,0,0,114,22,
+    0,0,0,114,22,0,0,0,114,23,0,0,0,218,8,115,
+    112,97,119,110,108,112,101,187,3,0,0,115,4,0,0,0,
+    0,8,8,1,114,209,0,0,0,218,1,114,114,108,0,0,
+    0,99,3,0,0,0,0,0,0,0,6,0,0,0,6,0,
+    0,0,67,0,0,0,115,174,0,0,0,116,0,124,0,116,
+    1,131,2,115,26,116,2,100,1,116,3,124,0,131,1,22,
+    0,131,1,130,1,124,1,100,2,107,7,114,46,116,4,100,
+    3,124,1,22,0,131,1,130,1,124,2,100,4,107,2,115,
+    62,124,2,100,0,107,8,114,70,116,4,100,5,131,1,130,
+    1,100,4,100,0,108,5,125,3,100,4,100,0,108,6,125,
+    4,124,1,100,6,107,2,114,132,124,3,106,7,124,0,100,
+    7,124,3,106,8,124,2,100,8,141,4,125,5,116,9,124,
+    4,160,10,124,5,106,11,161,1,124,5,131,2,83,0,124,
+    3,106,7,124,0,100,7,124,3,106,8,124,2,100,9,141,
+    4,125,5,116,9,124,4,160,10,124,5,106,12,161,1,124,
+    5,131,2,83,0,100,0,83,0,41,10,78,122,38,105,110,
+    118,97,108,105,100,32,99,109,100,32,116,121,112,101,32,40,
+    37,115,44,32,101,120,112,101,99,116,101,100,32,115,116,114,
+    105,110,103,41,41,2,114,210,0,0,0,218,1,119,122,15,
+    105,110,118,97,108,105,100,32,109,111,100,101,32,37,114,114,
+    0,0,0,0,122,43,112,111,112,101,110,40,41,32,100,111,
+    101,115,32,110,111,116,32,115,117,112,112,111,114,116,32,117,
+    110,98,117,102,102,101,114,101,100,32,115,116,114,101,97,109,
+    115,114,210,0,0,0,84,41,3,218,5,115,104,101,108,108,
+    218,6,115,116,100,111,117,116,218,7,98,117,102,115,105,122,
+    101,41,3,114,212,0,0,0,218,5,115,116,100,105,110,114,
+    214,0,0,0,41,13,114,60,0,0,0,114,43,0,0,0,
+    114,127,0,0,0,114,170,0,0,0,114,130,0,0,0,218,
+    10,115,117,98,112,114,111,99,101,115,115,218,2,105,111,90,
+    5,80,111,112,101,110,90,4,80,73,80,69,218,11,95,119,
+    114,97,112,95,99,108,111,115,101,90,13,84,101,120,116,73,
+    79,87,114,97,112,112,101,114,114,213,0,0,0,114,215,0,
+    0,0,41,6,90,3,99,109,100,114,63,0,0,0,90,9,
+    98,117,102,102,101,114,105,110,103,114,216,0,0,0,114,217,
+    0,0,0,218,4,112,114,111,99,114,22,0,0,0,114,22,
+    0,0,0,114,23,0,0,0,114,18,0,0,0,203,3,0,
+    0,115,40,0,0,0,0,1,10,1,16,1,8,1,12,1,
+    16,1,8,1,16,1,8,1,6,1,2,1,4,1,2,253,
+    6,4,18,2,6,1,2,1,4,1,2,253,6,4,99,0,
+    0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,64,
+    0,0,0,115,60,0,0,0,101,0,90,1,100,0,90,2,
+    100,1,100,2,132,0,90,3,100,3,100,4,132,0,90,4,
+    100,5,100,6,132,0,90,5,100,7,100,8,132,0,90,6,
+    100,9,100,10,132,0,90,7,100,11,100,12,132,0,90,8,
+    100,13,83,0,41,14,114,218,0,0,0,99,3,0,0,0,
+    0,0,0,0,3,0,0,0,2,0,0,0,67,0,0,0,
+    115,16,0,0,0,124,1,124,0,95,0,124,2,124,0,95,
+    1,100,0,83,0,114,20,0,0,0,41,2,218,7,95,115,
+    116,114,101,97,109,218,5,95,112,114,111,99,41,3,114,140,
+    0,0,0,90,6,115,116,114,101,97,109,114,219,0,0,0,
+    114,22,0,0,0,114,22,0,0,0,114,23,0,0,0,114,
+    142,0,0,0,226,3,0,0,115,4,0,0,0,0,1,6,
+    1,122,20,95,119,114,97,112,95,99,108,111,115,101,46,95,
+    95,105,110,105,116,95,95,99,1,0,0,0,0,0,0,0,
+    2,0,0,0,2,0,0,0,67,0,0,0,115,56,0,0,
+    0,124,0,106,0,160,1,161,0,1,0,124,0,106,2,160,
+    3,161,0,125,1,124,1,100,1,107,2,114,32,100,0,83,
+    0,116,4,100,2,107,2,114,44,124,1,83,0,124,1,100,
+    3,62,0,83,0,100,0,83,0,41,4,78,114,0,0,0,
+    0,114,39,0,0,0,233,8,0,0,0,41,5,114,220,0,
+    0,0,114,97,0,0,0,114,221,0,0,0,90,4,119,97,
+    105,116,114,8,0,0,0,41,2,114,140,0,0,0,90,10,
+    114,101,116,117,114,110,99,111,100,101,114,22,0,0,0,114,
+    22,0,0,0,114,23,0,0,0,114,97,0,0,0,229,3,
+    0,0,115,14,0,0,0,0,1,10,1,10,1,8,1,4,
+    1,8,1,4,2,122,17,95,119,114,97,112,95,99,108,111,
+    115,101,46,99,108,111,115,101,99,1,0,0,0,0,0,0,
+    0,1,0,0,0,1,0,0,0,67,0,0,0,115,4,0,
+    0,0,124,0,83,0,114,20,0,0,0,114,22,0,0,0,
+    114,152,0,0,0,114,22,0,0,0,114,22,0,0,0,114,
+    23,0,0,0,218,9,95,95,101,110,116,101,114,95,95,238,
+    3,0,0,115,2,0,0,0,0,1,122,21,95,119,114,97,
+    112,95,99,108,111,115,101,46,95,95,101,110,116,101,114,95,
+    95,99,1,0,0,0,0,0,0,0,2,0,0,0,2,0,
+    0,0,71,0,0,0,115,12,0,0,0,124,0,160,0,161,
+    0,1,0,100,0,83,0,114,20,0,0,0,41,1,114,97,
+    0,0,0,41,2,114,140,0,0,0,114,106,0,0,0,114,
+    22,0,0,0,114,22,0,0,0,114,23,0,0,0,218,8,
+    95,95,101,120,105,116,95,95,240,3,0,0,115,2,0,0,
+    0,0,1,122,20,95,119,114,97,112,95,99,108,111,115,101,
+    46,95,95,101,120,105,116,95,95,99,2,0,0,0,0,0,
+    0,0,2,0,0,0,3,0,0,0,67,0,0,0,115,12,
+    0,0,0,116,0,124,0,106,1,124,1,131,2,83,0,114,
+    20,0,0,0,41,2,218,7,103,101,116,97,116,116,114,114,
+    220,0,0,0,41,2,114,140,0,0,0,114,8,0,0,0,
+    114,22,0,0,0,114,22,0,0,0,114,23,0,0,0,218,
+    11,95,95,103,101,116,97,116,116,114,95,95,242,3,0,0,
+    115,2,0,0,0,0,1,122,23,95,119,114,97,112,95,99,
+    108,111,115,101,46,95,95,103,101,116,97,116,116,114,95,95,
+    99,1,0,0,0,0,0,0,0,1,0,0,0,2,0,0,
+    0,67,0,0,0,115,10,0,0,0,116,0,124,0,106,1,
+    131,1,83,0,114,20,0,0,0,41,2,218,4,105,116,101,
+    114,114,220,0,0,0,114,152,0,0,0,114,22,0,0,0,
+    114,22,0,0,0,114,23,0,0,0,114,150,0,0,0,244,
+    3,0,0,115,2,0,0,0,0,1,122,20,95,119,114,97,
+    112,95,99,108,111,115,101,46,95,95,105,116,101,114,95,95,
+    78,41,9,114,161,0,0,0,114,162,0,0,0,114,163,0,
+    0,0,114,142,0,0,0,114,97,0,0,0,114,223,0,0,
+    0,114,224,0,0,0,114,226,0,0,0,114,150,0,0,0,
+    114,22,0,0,0,114,22,0,0,0,114,22,0,0,0,114,
+    23,0,0,0,114,218,0,0,0,225,3,0,0,115,12,0,
+    0,0,8,1,8,3,8,9,8,2,8,2,8,2,114,218,
+    0,0,0,99,1,0,0,0,0,0,0,0,4,0,0,0,
+    4,0,0,0,79,0,0,0,115,52,0,0,0,116,0,124,
+    0,116,1,131,2,115,26,116,2,100,1,116,3,124,0,131,
+    1,22,0,131,1,130,1,100,2,100,0,108,4,125,3,124,
+    3,106,5,124,0,102,1,124,1,158,2,124,2,142,1,83,
+    0,41,3,78,122,38,105,110,118,97,108,105,100,32,102,100,
+    32,116,121,112,101,32,40,37,115,44,32,101,120,112,101,99,
+    116,101,100,32,105,110,116,101,103,101,114,41,114,0,0,0,
+    0,41,6,114,60,0,0,0,114,91,0,0,0,114,127,0,
+    0,0,114,170,0,0,0,114,217,0,0,0,114,47,0,0,
+    0,41,4,90,2,102,100,114,106,0,0,0,90,6,107,119,
+    97,114,103,115,114,217,0,0,0,114,22,0,0,0,114,22,
+    0,0,0,114,23,0,0,0,114,17,0,0,0,248,3,0,
+    0,115,8,0,0,0,0,1,10,1,16,1,8,1,99,1,
+    0,0,0,0,0,0,0,3,0,0,0,8,0,0,0,67,
+    0,0,0,115,138,0,0,0,116,0,124,0,116,1,116,2,
+    102,2,131,2,114,18,124,0,83,0,116,3,124,0,131,1,
+    125,1,122,14,124,1,160,4,124,0,161,1,125,2,87,0,
+    110,48,4,0,116,5,107,10,114,88,1,0,1,0,1,0,
+    116,6,124,1,100,1,131,2,114,70,130,0,110,14,116,7,
+    100,2,124,1,106,8,23,0,131,1,130,1,89,0,110,2,
+    88,0,116,0,124,2,116,1,116,2,102,2,131,2,114,110,
+    124,2,83,0,110,24,116,7,100,3,160,9,124,1,106,8,
+    116,3,124,2,131,1,106,8,161,2,131,1,130,1,100,4,
+    83,0,41,5,97,97,1,0,0,82,101,116,117,114,110,32,
+    116,104,101,32,112,97,116,104,32,114,101,112,114,101,115,101,
+    110,116,97,116,105,111,110,32,111,102,32,97,32,112,97,116,
+    104,45,108,105,107,101,32,111,98,106,101,99,116,46,10,10,
+    32,32,32,32,73,102,32,115,116,114,32,111,114,32,98,121,
+    116,101,115,32,105,115,32,112,97,115,115,101,100,32,105,110,
+    44,32,105,116,32,105,115,32,114,101,116,117,114,110,101,100,
+    32,117,110,99,104,97,110,103,101,100,46,32,79,116,104,101,
+    114,119,105,115,101,32,116,104,101,10,32,32,32,32,111,115,
+    46,80,97,116,104,76,105,107,101,32,105,110,116,101,114,102,
+    97,99,101,32,105,115,32,117,115,101,100,32,116,111,32,103,
+    101,116,32,116,104,101,32,112,97,116,104,32,114,101,112,114,
+    101,115,101,110,116,97,116,105,111,110,46,32,73,102,32,116,
+    104,101,10,32,32,32,32,112,97,116,104,32,114,101,112,114,
+    101,115,101,110,116,97,116,105,111,110,32,105,115,32,110,111,
+    116,32,115,116,114,32,111,114,32,98,121,116,101,115,44,32,
+    84,121,112,101,69,114,114,111,114,32,105,115,32,114,97,105,
+    115,101,100,46,32,73,102,32,116,104,101,10,32,32,32,32,
+    112,114,111,118,105,100,101,100,32,112,97,116,104,32,105,115,
+    32,110,111,116,32,115,116,114,44,32,98,121,116,101,115,44,
+    32,111,114,32,111,115,46,80,97,116,104,76,105,107,101,44,
+    32,84,121,112,101,69,114,114,111,114,32,105,115,32,114,97,
+    105,115,101,100,46,10,32,32,32,32,218,10,95,95,102,115,
+    112,97,116,104,95,95,122,47,101,120,112,101,99,116,101,100,
+    32,115,116,114,44,32,98,121,116,101,115,32,111,114,32,111,
+    115,46,80,97,116,104,76,105,107,101,32,111,98,106,101,99,
+    116,44,32,110,111,116,32,122,55,101,120,112,101,99,116,101,
+    100,32,123,125,46,95,95,102,115,112,97,116,104,95,95,40,
+    41,32,116,111,32,114,101,116,117,114,110,32,115,116,114,32,
+    111,114,32,98,121,116,101,115,44,32,110,111,116,32,123,125,
+    78,41,10,114,60,0,0,0,114,43,0,0,0,114,61,0,
+    0,0,114,170,0,0,0,114,228,0,0,0,114,31,0,0,
+    0,114,92,0,0,0,114,127,0,0,0,114,161,0,0,0,
+    114,154,0,0,0,41,3,114,9,0,0,0,90,9,112,97,
+    116,104,95,116,121,112,101,90,9,112,97,116,104,95,114,101,
+    112,114,114,22,0,0,0,114,22,0,0,0,114,23,0,0,
+    0,218,7,95,102,115,112,97,116,104,1,4,0,0,115,34,
+    0,0,0,0,8,14,1,4,4,8,1,2,1,14,1,14,
+    1,10,1,4,2,4,1,4,255,12,2,14,1,6,2,6,
+    1,4,1,8,254,114,229,0,0,0,114,68,0,0,0,99,
+    0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,
+    64,0,0,0,115,42,0,0,0,101,0,90,1,100,0,90,
+    2,100,1,90,3,101,4,106,5,100,2,100,3,132,0,131,
+    1,90,6,101,7,100,4,100,5,132,0,131,1,90,8,100,
+    6,83,0,41,7,218,8,80,97,116,104,76,105,107,101,122,
+    67,65,98,115,116,114,97,99,116,32,98,97,115,101,32,99,
+    108,97,115,115,32,102,111,114,32,105,109,112,108,101,109,101,
+    110,116,105,110,103,32,116,104,101,32,102,105,108,101,32,115,
+    121,115,116,101,109,32,112,97,116,104,32,112,114,111,116,111,
+    99,111,108,46,99,1,0,0,0,0,0,0,0,1,0,0,
+    0,1,0,0,0,67,0,0,0,115,8,0,0,0,116,0,
+    130,1,100,1,83,0,41,2,122,57,82,101,116,117,114,110,
+    32,116,104,101,32,102,105,108,101,32,115,121,115,116,101,109,
+    32,112,97,116,104,32,114,101,112,114,101,115,101,110,116,97,
+    116,105,111,110,32,111,102,32,116,104,101,32,111,98,106,101,
+    99,116,46,78,41,1,218,19,78,111,116,73,109,112,108,101,
+    109,101,110,116,101,100,69,114,114,111,114,114,152,0,0,0,
+    114,22,0,0,0,114,22,0,0,0,114,23,0,0,0,114,
+    228,0,0,0,41,4,0,0,115,2,0,0,0,0,3,122,
+    19,80,97,116,104,76,105,107,101,46,95,95,102,115,112,97,
+    116,104,95,95,99,2,0,0,0,0,0,0,0,2,0,0,
+    0,3,0,0,0,67,0,0,0,115,10,0,0,0,116,0,
+    124,1,100,1,131,2,83,0,41,2,78,114,228,0,0,0,
+    41,1,114,92,0,0,0,41,2,90,3,99,108,115,90,8,
+    115,117,98,99,108,97,115,115,114,22,0,0,0,114,22,0,
+    0,0,114,23,0,0,0,218,16,95,95,115,117,98,99,108,
+    97,115,115,104,111,111,107,95,95,46,4,0,0,115,2,0,
+    0,0,0,2,122,25,80,97,116,104,76,105,107,101,46,95,
+    95,115,117,98,99,108,97,115,115,104,111,111,107,95,95,78,
+    41,9,114,161,0,0,0,114,162,0,0,0,114,163,0,0,
+    0,218,7,95,95,100,111,99,95,95,218,3,97,98,99,90,
+    14,97,98,115,116,114,97,99,116,109,101,116,104,111,100,114,
+    228,0,0,0,218,11,99,108,97,115,115,109,101,116,104,111,
+    100,114,232,0,0,0,114,22,0,0,0,114,22,0,0,0,
+    114,22,0,0,0,114,23,0,0,0,114,230,0,0,0,37,
+    4,0,0,115,10,0,0,0,8,2,4,2,4,1,10,4,
+    2,1,114,230,0,0,0,41,2,114,54,0,0,0,70,41,
+    3,84,78,70,41,3,114,85,0,0,0,84,78,41,1,78,
+    41,1,78,41,1,78,41,1,78,41,2,114,210,0,0,0,
+    114,108,0,0,0,41,101,114,233,0,0,0,114,234,0,0,
+    0,114,179,0,0,0,114,45,0,0,0,114,94,0,0,0,
+    218,20,98,117,105,108,116,105,110,95,109,111,100,117,108,101,
+    95,110,97,109,101,115,90,6,95,110,97,109,101,115,114,30,
+    0,0,0,114,24,0,0,0,114,33,0,0,0,114,8,0,
+    0,0,114,6,0,0,0,114,34,0,0,0,114,37,0,0,
+    0,114,72,0,0,0,218,11,73,109,112,111,114,116,69,114,
+    114,111,114,90,9,112,111,115,105,120,112,97,116,104,114,9,
+    0,0,0,114,38,0,0,0,218,6,101,120,116,101,110,100,
+    114,39,0,0,0,90,6,110,116,112,97,116,104,218,7,109,
+    111,100,117,108,101,115,90,7,111,115,46,112,97,116,104,114,
+    2,0,0,0,114,3,0,0,0,114,4,0,0,0,114,5,
+    0,0,0,114,7,0,0,0,114,19,0,0,0,114,1,0,
+    0,0,114,10,0,0,0,114,21,0,0,0,114,40,0,0,
+    0,114,44,0,0,0,218,3,115,101,116,114,41,0,0,0,
+    90,15,115,117,112,112,111,114,116,115,95,100,105,114,95,102,
+    100,90,22,115,117,112,112,111,114,116,115,95,101,102,102,101,
+    99,116,105,118,101,95,105,100,115,114,42,0,0,0,90,11,
+    115,117,112,112,111,114,116,115,95,102,100,90,24,115,117,112,
+    112,111,114,116,115,95,102,111,108,108,111,119,95,115,121,109,
+    108,105,110,107,115,114,11,0,0,0,114,12,0,0,0,114,
+    13,0,0,0,114,58,0,0,0,114,66,0,0,0,114,67,
+    0,0,0,114,76,0,0,0,114,47,0,0,0,114,50,0,
+    0,0,114,100,0,0,0,114,96,0,0,0,114,107,0,0,
+    0,114,111,0,0,0,114,113,0,0,0,114,115,0,0,0,
+    114,112,0,0,0,114,114,0,0,0,114,117,0,0,0,114,
+    16,0,0,0,90,16,95,99,111,108,108,101,99,116,105,111,
+    110,115,95,97,98,99,114,131,0,0,0,114,132,0,0,0,
+    114,137,0,0,0,114,167,0,0,0,218,9,78,97,109,101,
+    69,114,114,111,114,114,138,0,0,0,114,181,0,0,0,114,
+    182,0,0,0,114,118,0,0,0,114,184,0,0,0,114,128,
+    0,0,0,114,185,0,0,0,114,139,0,0,0,114,61,0,
+    0,0,114,186,0,0,0,114,187,0,0,0,114,192,0,0,
+    0,114,14,0,0,0,114,15,0,0,0,114,195,0,0,0,
+    114,196,0,0,0,114,197,0,0,0,114,200,0,0,0,114,
+    194,0,0,0,114,203,0,0,0,114,204,0,0,0,114,205,
+    0,0,0,114,206,0,0,0,114,207,0,0,0,114,208,0,
+    0,0,114,209,0,0,0,114,18,0,0,0,114,218,0,0,
+    0,114,17,0,0,0,114,229,0,0,0,114,68,0,0,0,
+    114,161,0,0,0,90,3,65,66,67,114,230,0,0,0,114,
+    22,0,0,0,114,22,0,0,0,114,22,0,0,0,114,23,
+    0,0,0,218,8,60,109,111,100,117,108,101,62,1,0,0,
+    0,115,148,1,0,0,4,24,8,1,8,1,8,2,6,3,
+    12,1,2,0,2,0,2,0,2,0,2,0,2,1,2,0,
+    2,0,2,0,2,0,2,1,2,0,2,253,4,5,8,3,
+    8,8,8,1,4,1,4,1,8,1,2,1,12,1,14,1,
+    14,1,6,1,8,2,2,1,16,1,14,1,6,2,8,1,
+    14,1,4,2,10,1,4,1,4,1,8,1,2,1,12,1,
+    14,1,16,1,6,1,8,2,8,1,14,1,2,2,2,1,
+    16,1,16,1,8,3,8,2,10,1,40,3,2,3,10,1,
+    6,1,8,4,6,1,10,1,10,1,10,1,10,1,10,1,
+    10,1,10,1,10,1,10,1,10,1,10,1,10,1,10,1,
+    10,1,10,1,10,1,4,2,6,1,10,1,4,2,6,1,
+    10,1,10,1,10,1,10,1,10,1,10,1,10,1,10,1,
+    10,1,10,1,10,1,20,1,10,1,4,2,6,1,10,22,
+    10,1,10,1,10,1,10,1,10,1,10,1,10,1,10,1,
+    10,1,10,1,10,1,10,1,4,2,2,1,2,1,2,1,
+    2,6,4,1,4,1,4,5,10,32,8,22,8,26,16,2,
+    10,127,0,13,10,2,28,2,18,48,8,56,10,2,8,7,
+    8,8,8,7,8,9,8,8,8,9,22,2,10,32,10,45,
+    12,2,16,55,2,1,8,1,16,1,14,2,10,1,10,2,
+    2,1,8,1,16,1,14,2,10,1,10,2,8,31,6,1,
+    2,3,10,6,8,1,10,2,6,1,8,6,6,1,2,0,
+    2,1,2,0,2,1,2,0,2,253,4,4,2,2,10,6,
+    10,2,8,30,10,1,2,3,30,2,4,1,8,2,16,6,
+    8,31,8,9,8,12,8,10,8,11,18,3,10,4,8,9,
+    8,12,14,3,10,3,8,10,8,12,14,4,10,22,14,23,
+    8,9,8,31,10,1,4,1,6,3,
+};
@@ -0,0 +1,656 @@
+/* Auto-generated by Programs/_freeze_importlib.c */
+const unsigned char _Py_M__posixpath[] = {
+    99,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,
+    0,64,0,0,0,115,94,1,0,0,100,0,90,0,100,1,
+    90,1,100,2,90,2,100,1,90,3,100,3,90,4,100,4,
+    90,5,100,5,90,6,100,6,90,7,100,7,90,8,100,8,
+    100,6,108,9,90,9,100,8,100,6,108,10,90,10,100,8,
+    100,6,108,11,90,11,100,8,100,6,108,12,90,12,100,8,
+    100,9,108,12,84,0,100,10,100,11,100,12,100,13,100,14,
+    100,15,100,16,100,17,100,18,100,19,100,20,100,21,100,22,
+    100,23,100,24,100,25,100,26,100,27,100,28,100,29,100,30,
+    100,31,100,32,100,33,100,34,100,35,100,36,100,37,100,38,
+    100,39,100,40,100,41,100,42,100,43,100,44,100,45,100,46,
+    100,47,103,38,90,13,100,48,100,49,132,0,90,14,100,50,
+    100,10,132,0,90,15,100,51,100,11,132,0,90,16,100,52,
+    100,12,132,0,90,17,100,53,100,14,132,0,90,18,100,54,
+    100,15,132,0,90,19,101,12,106,20,106,0,101,19,95,0,
+    100,55,100,13,132,0,90,21,100,56,100,16,132,0,90,22,
+    100,57,100,17,132,0,90,23,100,58,100,23,132,0,90,24,
+    100,59,100,25,132,0,90,25,100,60,100,28,132,0,90,26,
+    100,61,100,29,132,0,90,27,100,6,97,28,100,6,97,29,
+    100,62,100,30,132,0,90,30,100,63,100,31,132,0,90,31,
+    100,64,100,32,132,0,90,32,100,65,100,44,132,0,90,33,
+    100,66,100,67,132,0,90,34,101,10,106,35,100,68,107,2,
+    90,36,100,71,100,69,100,46,132,1,90,37,100,70,100,47,
+    132,0,90,38,100,6,83,0,41,72,97,217,1,0,0,67,
+    111,109,109,111,110,32,111,112,101,114,97,116,105,111,110,115,
+    32,111,110,32,80,111,115,105,120,32,112,97,116,104,110,97,
+    109,101,115,46,10,10,73,110,115,116,101,97,100,32,111,102,
+    32,105,109,112,111,114,116,105,110,103,32,116,104,105,115,32,
+    109,111,100,117,108,101,32,100,105,114,101,99,116,108,121,44,
+    32,105,109,112,111,114,116,32,111,115,32,97,110,100,32,114,
+    101,102,101,114,32,116,111,10,116,104,105,115,32,109,111,100,
+    117,108,101,32,97,115,32,111,115,46,112,97,116,104,46,32,
+    32,84,104,101,32,34,111,115,46,112,97,116,104,34,32,110,
+    97,109,101,32,105,115,32,97,110,32,97,108,105,97,115,32,
+    102,111,114,32,116,104,105,115,10,109,111,100,117,108,101,32,
+    111,110,32,80,111,115,105,120,32,115,121,115,116,101,109,115,
+    59,32,111,110,32,111,116,104,101,114,32,115,121,115,116,101,
+    109,115,32,40,101,46,103,46,32,87,105,110,100,111,119,115,
+    41,44,10,111,115,46,112,97,116,104,32,112,114,111,118,105,
+    100,101,115,32,116,104,101,32,115,97,109,101,32,111,112,101,
+    114,97,116,105,111,110,115,32,105,110,32,97,32,109,97,110,
+    110,101,114,32,115,112,101,99,105,102,105,99,32,116,111,32,
+    116,104,97,116,10,112,108,97,116,102,111,114,109,44,32,97,
+    110,100,32,105,115,32,97,110,32,97,108,105,97,115,32,116,
+    111,32,97,110,111,116,104,101,114,32,109,111,100,117,108,101,
+    32,40,101,46,103,46,32,110,116,112,97,116,104,41,46,10,
+    10,83,111,109,101,32,111,102,32,116,104,105,115,32,99,97,
+    110,32,97,99,116,117,97,108,108,121,32,98,101,32,117,115,
+    101,102,117,108,32,111,110,32,110,111,110,45,80,111,115,105,
+    120,32,115,121,115,116,101,109,115,32,116,111,111,44,32,101,
+    46,103,46,10,102,111,114,32,109,97,110,105,112,117,108,97,
+    116,105,111,110,32,111,102,32,116,104,101,32,112,97,116,104,
+    110,97,109,101,32,99,111,109,112,111,110,101,110,116,32,111,
+    102,32,85,82,76,115,46,10,218,1,46,250,2,46,46,250,
+    1,47,250,1,58,122,14,58,47,98,105,110,58,47,117,115,
+    114,47,98,105,110,78,122,9,47,100,101,118,47,110,117,108,
+    108,233,0,0,0,0,41,1,218,1,42,218,8,110,111,114,
+    109,99,97,115,101,218,5,105,115,97,98,115,218,4,106,111,
+    105,110,218,10,115,112,108,105,116,100,114,105,118,101,218,5,
+    115,112,108,105,116,218,8,115,112,108,105,116,101,120,116,218,
+    8,98,97,115,101,110,97,109,101,218,7,100,105,114,110,97,
+    109,101,218,12,99,111,109,109,111,110,112,114,101,102,105,120,
+    90,7,103,101,116,115,105,122,101,90,8,103,101,116,109,116,
+    105,109,101,90,8,103,101,116,97,116,105,109,101,90,8,103,
+    101,116,99,116,105,109,101,218,6,105,115,108,105,110,107,90,
+    6,101,120,105,115,116,115,218,7,108,101,120,105,115,116,115,
+    90,5,105,115,100,105,114,90,6,105,115,102,105,108,101,218,
+    7,105,115,109,111,117,110,116,218,10,101,120,112,97,110,100,
+    117,115,101,114,218,10,101,120,112,97,110,100,118,97,114,115,
+    218,8,110,111,114,109,112,97,116,104,218,7,97,98,115,112,
+    97,116,104,90,8,115,97,109,101,102,105,108,101,90,12,115,
+    97,109,101,111,112,101,110,102,105,108,101,90,8,115,97,109,
+    101,115,116,97,116,218,6,99,117,114,100,105,114,218,6,112,
+    97,114,100,105,114,218,3,115,101,112,218,7,112,97,116,104,
+    115,101,112,218,7,100,101,102,112,97,116,104,218,6,97,108,
+    116,115,101,112,218,6,101,120,116,115,101,112,218,7,100,101,
+    118,110,117,108,108,218,8,114,101,97,108,112,97,116,104,218,
+    26,115,117,112,112,111,114,116,115,95,117,110,105,99,111,100,
+    101,95,102,105,108,101,110,97,109,101,115,218,7,114,101,108,
+    112,97,116,104,218,10,99,111,109,109,111,110,112,97,116,104,
+    99,1,0,0,0,0,0,0,0,1,0,0,0,3,0,0,
+    0,67,0,0,0,115,22,0,0,0,116,0,124,0,116,1,
+    131,2,114,14,100,1,83,0,100,2,83,0,100,0,83,0,
+    41,3,78,243,1,0,0,0,47,114,2,0,0,0,41,2,
+    218,10,105,115,105,110,115,116,97,110,99,101,218,5,98,121,
+    116,101,115,169,1,218,4,112,97,116,104,169,0,114,39,0,
+    0,0,250,18,60,102,114,111,122,101,110,32,112,111,115,105,
+    120,112,97,116,104,62,218,8,95,103,101,116,95,115,101,112,
+    41,0,0,0,115,6,0,0,0,0,1,10,1,4,2,114,
+    41,0,0,0,99,1,0,0,0,0,0,0,0,1,0,0,
+    0,4,0,0,0,67,0,0,0,115,46,0,0,0,116,0,
+    160,1,124,0,161,1,125,0,116,2,124,0,116,3,116,4,
+    102,2,131,2,115,42,116,5,100,1,160,6,124,0,106,7,
+    106,8,161,1,131,1,130,1,124,0,83,0,41,2,122,54,
+    78,111,114,109,97,108,105,122,101,32,99,97,115,101,32,111,
+    102,32,112,97,116,104,110,97,109,101,46,32,32,72,97,115,
+    32,110,111,32,101,102,102,101,99,116,32,117,110,100,101,114,
+    32,80,111,115,105,120,122,50,110,111,114,109,99,97,115,101,
+    40,41,32,97,114,103,117,109,101,110,116,32,109,117,115,116,
+    32,98,101,32,115,116,114,32,111,114,32,98,121,116,101,115,
+    44,32,110,111,116,32,39,123,125,39,41,9,218,2,111,115,
+    218,6,102,115,112,97,116,104,114,35,0,0,0,114,36,0,
+    0,0,218,3,115,116,114,218,9,84,121,112,101,69,114,114,
+    111,114,218,6,102,111,114,109,97,116,218,9,95,95,99,108,
+    97,115,115,95,95,218,8,95,95,110,97,109,101,95,95,41,
+    1,218,1,115,114,39,0,0,0,114,39,0,0,0,114,40,
+    0,0,0,114,6,0,0,0,52,0,0,0,115,12,0,0,
+    0,0,2,10,1,14,1,6,1,6,255,6,2,99,1,0,
+    0,0,0,0,0,0,2,0,0,0,3,0,0,0,67,0,
+    0,0,115,28,0,0,0,116,0,160,1,124,0,161,1,125,
+    0,116,2,124,0,131,1,125,1,124,0,160,3,124,1,161,
+    1,83,0,41,1,122,31,84,101,115,116,32,119,104,101,116,
+    104,101,114,32,97,32,112,97,116,104,32,105,115,32,97,98,
+    115,111,108,117,116,101,41,4,114,42,0,0,0,114,43,0,
+    0,0,114,41,0,0,0,218,10,115,116,97,114,116,115,119,
+    105,116,104,41,2,114,49,0,0,0,114,24,0,0,0,114,
+    39,0,0,0,114,39,0,0,0,114,40,0,0,0,114,7,
+    0,0,0,64,0,0,0,115,6,0,0,0,0,2,10,1,
+    8,1,99,1,0,0,0,0,0,0,0,5,0,0,0,10,
+    0,0,0,71,0,0,0,115,168,0,0,0,116,0,160,1,
+    124,0,161,1,125,0,116,2,124,0,131,1,125,2,124,0,
+    125,3,122,94,124,1,115,44,124,3,100,1,100,2,133,2,
+    25,0,124,2,23,0,1,0,116,3,116,0,106,1,124,1,
+    131,2,68,0,93,56,125,4,124,4,160,4,124,2,161,1,
+    114,76,124,4,125,3,113,56,124,3,114,90,124,3,160,5,
+    124,2,161,1,114,100,124,3,124,4,55,0,125,3,113,56,
+    124,3,124,2,124,4,23,0,55,0,125,3,113,56,87,0,
+    110,46,4,0,116,6,116,7,116,8,102,3,107,10,114,162,
+    1,0,1,0,1,0,116,9,106,10,100,3,124,0,102,2,
+    124,1,158,2,142,0,1,0,130,0,89,0,110,2,88,0,
+    124,3,83,0,41,4,122,230,74,111,105,110,32,116,119,111,
+    32,111,114,32,109,111,114,101,32,112,97,116,104,110,97,109,
+    101,32,99,111,109,112,111,110,101,110,116,115,44,32,105,110,
+    115,101,114,116,105,110,103,32,39,47,39,32,97,115,32,110,
+    101,101,100,101,100,46,10,32,32,32,32,73,102,32,97,110,
+    121,32,99,111,109,112,111,110,101,110,116,32,105,115,32,97,
+    110,32,97,98,115,111,108,117,116,101,32,112,97,116,104,44,
+    32,97,108,108,32,112,114,101,118,105,111,117,115,32,112,97,
+    116,104,32,99,111,109,112,111,110,101,110,116,115,10,32,32,
+    32,32,119,105,108,108,32,98,101,32,100,105,115,99,97,114,
+    100,101,100,46,32,32,65,110,32,101,109,112,116,121,32,108,
+    97,115,116,32,112,97,114,116,32,119,105,108,108,32,114,101,
+    115,117,108,116,32,105,110,32,97,32,112,97,116,104,32,116,
+    104,97,116,10,32,32,32,32,101,110,100,115,32,119,105,116,
+    104,32,97,32,115,101,112,97,114,97,116,111,114,46,78,114,
+    4,0,0,0,114,8,0,0,0,41,11,114,42,0,0,0,
+    114,43,0,0,0,114,41,0,0,0,218,3,109,97,112,114,
+    50,0,0,0,218,8,101,110,100,115,119,105,116,104,114,45,
+    0,0,0,218,14,65,116,116,114,105,98,117,116,101,69,114,
+    114,111,114,218,12,66,121,116,101,115,87,97,114,110,105,110,
+    103,218,11,103,101,110,101,114,105,99,112,97,116,104,218,16,
+    95,99,104,101,99,107,95,97,114,103,95,116,121,112,101,115,
+    41,5,218,1,97,218,1,112,114,24,0,0,0,114,38,0,
+    0,0,218,1,98,114,39,0,0,0,114,39,0,0,0,114,
+    40,0,0,0,114,8,0,0,0,75,0,0,0,115,32,0,
+    0,0,0,5,10,1,8,1,4,1,2,1,4,1,16,1,
+    16,1,10,1,6,1,14,1,10,2,18,1,20,1,18,1,
+    8,1,99,1,0,0,0,0,0,0,0,5,0,0,0,4,
+    0,0,0,67,0,0,0,115,96,0,0,0,116,0,160,1,
+    124,0,161,1,125,0,116,2,124,0,131,1,125,1,124,0,
+    160,3,124,1,161,1,100,1,23,0,125,2,124,0,100,2,
+    124,2,133,2,25,0,124,0,124,2,100,2,133,2,25,0,
+    2,0,125,3,125,4,124,3,114,88,124,3,124,1,116,4,
+    124,3,131,1,20,0,107,3,114,88,124,3,160,5,124,1,
+    161,1,125,3,124,3,124,4,102,2,83,0,41,3,122,128,
+    83,112,108,105,116,32,97,32,112,97,116,104,110,97,109,101,
+    46,32,32,82,101,116,117,114,110,115,32,116,117,112,108,101,
+    32,34,40,104,101,97,100,44,32,116,97,105,108,41,34,32,
+    119,104,101,114,101,32,34,116,97,105,108,34,32,105,115,10,
+    32,32,32,32,101,118,101,114,121,116,104,105,110,103,32,97,
+    102,116,101,114,32,116,104,101,32,102,105,110,97,108,32,115,
+    108,97,115,104,46,32,32,69,105,116,104,101,114,32,112,97,
+    114,116,32,109,97,121,32,98,101,32,101,109,112,116,121,46,
+    233,1,0,0,0,78,169,6,114,42,0,0,0,114,43,0,
+    0,0,114,41,0,0,0,218,5,114,102,105,110,100,218,3,
+    108,101,110,218,6,114,115,116,114,105,112,41,5,114,58,0,
+    0,0,114,24,0,0,0,218,1,105,218,4,104,101,97,100,
+    218,4,116,97,105,108,114,39,0,0,0,114,39,0,0,0,
+    114,40,0,0,0,114,10,0,0,0,104,0,0,0,115,14,
+    0,0,0,0,3,10,1,8,1,14,1,26,1,20,1,10,
+    1,99,1,0,0,0,0,0,0,0,3,0,0,0,6,0,
+    0,0,67,0,0,0,115,54,0,0,0,116,0,160,1,124,
+    0,161,1,125,0,116,2,124,0,116,3,131,2,114,30,100,
+    1,125,1,100,2,125,2,110,8,100,3,125,1,100,4,125,
+    2,116,4,160,5,124,0,124,1,100,0,124,2,161,4,83,
+    0,41,5,78,114,34,0,0,0,243,1,0,0,0,46,114,
+    2,0,0,0,114,0,0,0,0,41,6,114,42,0,0,0,
+    114,43,0,0,0,114,35,0,0,0,114,36,0,0,0,114,
+    55,0,0,0,218,9,95,115,112,108,105,116,101,120,116,41,
+    3,114,58,0,0,0,114,24,0,0,0,114,28,0,0,0,
+    114,39,0,0,0,114,39,0,0,0,114,40,0,0,0,114,
+    11,0,0,0,121,0,0,0,115,14,0,0,0,0,1,10,
+    1,10,1,4,1,6,2,4,1,4,1,99,1,0,0,0,
+    0,0,0,0,1,0,0,0,3,0,0,0,67,0,0,0,
+    115,26,0,0,0,116,0,160,1,124,0,161,1,125,0,124,
+    0,100,1,100,2,133,2,25,0,124,0,102,2,83,0,41,
+    3,122,74,83,112,108,105,116,32,97,32,112,97,116,104,110,
+    97,109,101,32,105,110,116,111,32,100,114,105,118,101,32,97,
+    110,100,32,112,97,116,104,46,32,79,110,32,80,111,115,105,
+    120,44,32,100,114,105,118,101,32,105,115,32,97,108,119,97,
+    121,115,10,32,32,32,32,101,109,112,116,121,46,78,114,4,
+    0,0,0,41,2,114,42,0,0,0,114,43,0,0,0,41,
+    1,114,58,0,0,0,114,39,0,0,0,114,39,0,0,0,
+    114,40,0,0,0,114,9,0,0,0,135,0,0,0,115,4,
+    0,0,0,0,3,10,1,99,1,0,0,0,0,0,0,0,
+    3,0,0,0,3,0,0,0,67,0,0,0,115,44,0,0,
+    0,116,0,160,1,124,0,161,1,125,0,116,2,124,0,131,
+    1,125,1,124,0,160,3,124,1,161,1,100,1,23,0,125,
+    2,124,0,124,2,100,2,133,2,25,0,83,0,41,3,122,
+    41,82,101,116,117,114,110,115,32,116,104,101,32,102,105,110,
+    97,108,32,99,111,109,112,111,110,101,110,116,32,111,102,32,
+    97,32,112,97,116,104,110,97,109,101,114,60,0,0,0,78,
+    41,4,114,42,0,0,0,114,43,0,0,0,114,41,0,0,
+    0,114,62,0,0,0,41,3,114,58,0,0,0,114,24,0,
+    0,0,114,65,0,0,0,114,39,0,0,0,114,39,0,0,
+    0,114,40,0,0,0,114,12,0,0,0,144,0,0,0,115,
+    8,0,0,0,0,2,10,1,8,1,14,1,99,1,0,0,
+    0,0,0,0,0,4,0,0,0,4,0,0,0,67,0,0,
+    0,115,78,0,0,0,116,0,160,1,124,0,161,1,125,0,
+    116,2,124,0,131,1,125,1,124,0,160,3,124,1,161,1,
+    100,1,23,0,125,2,124,0,100,2,124,2,133,2,25,0,
+    125,3,124,3,114,74,124,3,124,1,116,4,124,3,131,1,
+    20,0,107,3,114,74,124,3,160,5,124,1,161,1,125,3,
+    124,3,83,0,41,3,122,45,82,101,116,117,114,110,115,32,
+    116,104,101,32,100,105,114,101,99,116,111,114,121,32,99,111,
+    109,112,111,110,101,110,116,32,111,102,32,97,32,112,97,116,
+    104,110,97,109,101,114,60,0,0,0,78,114,61,0,0,0,
+    41,4,114,58,0,0,0,114,24,0,0,0,114,65,0,0,
+    0,114,66,0,0,0,114,39,0,0,0,114,39,0,0,0,
+    114,40,0,0,0,114,13,0,0,0,154,0,0,0,115,14,
+    0,0,0,0,2,10,1,8,1,14,1,12,1,20,1,10,
+    1,99,1,0,0,0,0,0,0,0,2,0,0,0,10,0,
+    0,0,67,0,0,0,115,56,0,0,0,122,14,116,0,160,
+    1,124,0,161,1,125,1,87,0,110,28,4,0,116,2,116,
+    3,116,4,102,3,107,10,114,42,1,0,1,0,1,0,89,
+    0,100,1,83,0,88,0,116,5,160,6,124,1,106,7,161,
+    1,83,0,41,2,122,38,84,101,115,116,32,119,104,101,116,
+    104,101,114,32,97,32,112,97,116,104,32,105,115,32,97,32,
+    115,121,109,98,111,108,105,99,32,108,105,110,107,70,41,8,
+    114,42,0,0,0,218,5,108,115,116,97,116,218,7,79,83,
+    69,114,114,111,114,218,10,86,97,108,117,101,69,114,114,111,
+    114,114,53,0,0,0,218,4,115,116,97,116,218,7,83,95,
+    73,83,76,78,75,218,7,115,116,95,109,111,100,101,41,2,
+    114,38,0,0,0,90,2,115,116,114,39,0,0,0,114,39,
+    0,0,0,114,40,0,0,0,114,15,0,0,0,168,0,0,
+    0,115,10,0,0,0,0,2,2,1,14,1,20,1,8,1,
+    99,1,0,0,0,0,0,0,0,1,0,0,0,9,0,0,
+    0,67,0,0,0,115,46,0,0,0,122,14,116,0,160,1,
+    124,0,161,1,1,0,87,0,110,26,4,0,116,2,116,3,
+    102,2,107,10,114,40,1,0,1,0,1,0,89,0,100,1,
+    83,0,88,0,100,2,83,0,41,3,122,67,84,101,115,116,
+    32,119,104,101,116,104,101,114,32,97,32,112,97,116,104,32,
+    101,120,105,115,116,115,46,32,32,82,101,116,117,114,110,115,
+    32,84,114,117,101,32,102,111,114,32,98,114,111,107,101,110,
+    32,115,121,109,98,111,108,105,99,32,108,105,110,107,115,70,
+    84,41,4,114,42,0,0,0,114,70,0,0,0,114,71,0,
+    0,0,114,72,0,0,0,114,37,0,0,0,114,39,0,0,
+    0,114,39,0,0,0,114,40,0,0,0,114,16,0,0,0,
+    178,0,0,0,115,10,0,0,0,0,2,2,1,14,1,18,
+    1,8,1,99,1,0,0,0,0,0,0,0,8,0,0,0,
+    9,0,0,0,67,0,0,0,115,192,0,0,0,122,14,116,
+    0,160,1,124,0,161,1,125,1,87,0,110,26,4,0,116,
+    2,116,3,102,2,107,10,114,40,1,0,1,0,1,0,89,
+    0,100,1,83,0,88,0,116,4,160,5,124,1,106,6,161,
+    1,114,58,100,1,83,0,116,7,124,0,116,8,131,2,114,
+    80,116,9,124,0,100,2,131,2,125,2,110,10,116,9,124,
+    0,100,3,131,2,125,2,116,10,124,2,131,1,125,2,122,
+    14,116,0,160,1,124,2,161,1,125,3,87,0,110,26,4,
+    0,116,2,116,3,102,2,107,10,114,138,1,0,1,0,1,
+    0,89,0,100,1,83,0,88,0,124,1,106,11,125,4,124,
+    3,106,11,125,5,124,4,124,5,107,3,114,164,100,4,83,
+    0,124,1,106,12,125,6,124,3,106,12,125,7,124,6,124,
+    7,107,2,114,188,100,4,83,0,100,1,83,0,41,5,122,
+    36,84,101,115,116,32,119,104,101,116,104,101,114,32,97,32,
+    112,97,116,104,32,105,115,32,97,32,109,111,117,110,116,32,
+    112,111,105,110,116,70,243,2,0,0,0,46,46,114,1,0,
+    0,0,84,41,13,114,42,0,0,0,114,70,0,0,0,114,
+    71,0,0,0,114,72,0,0,0,114,73,0,0,0,114,74,
+    0,0,0,114,75,0,0,0,114,35,0,0,0,114,36,0,
+    0,0,114,8,0,0,0,114,30,0,0,0,90,6,115,116,
+    95,100,101,118,90,6,115,116,95,105,110,111,41,8,114,38,
+    0,0,0,218,2,115,49,90,6,112,97,114,101,110,116,218,
+    2,115,50,90,4,100,101,118,49,90,4,100,101,118,50,90,
+    4,105,110,111,49,90,4,105,110,111,50,114,39,0,0,0,
+    114,39,0,0,0,114,40,0,0,0,114,17,0,0,0,190,
+    0,0,0,115,46,0,0,0,0,2,2,1,14,1,18,2,
+    8,3,12,1,4,2,10,1,12,2,10,1,8,1,2,1,
+    14,1,18,1,8,2,6,1,6,1,8,1,4,1,6,1,
+    6,1,8,1,4,1,99,1,0,0,0,0,0,0,0,9,
+    0,0,0,8,0,0,0,67,0,0,0,115,60,1,0,0,
+    116,0,160,1,124,0,161,1,125,0,116,2,124,0,116,3,
+    131,2,114,26,100,1,125,1,110,4,100,2,125,1,124,0,
+    160,4,124,1,161,1,115,44,124,0,83,0,116,5,124,0,
+    131,1,125,2,124,0,160,6,124,2,100,3,161,2,125,3,
+    124,3,100,4,107,0,114,80,116,7,124,0,131,1,125,3,
+    124,3,100,3,107,2,114,166,100,5,116,0,106,8,107,7,
+    114,154,100,4,100,6,108,9,125,4,122,20,124,4,160,10,
+    116,0,160,11,161,0,161,1,106,12,125,5,87,0,113,164,
+    4,0,116,13,107,10,114,150,1,0,1,0,1,0,124,0,
+    6,0,89,0,83,0,88,0,110,10,116,0,106,8,100,5,
+    25,0,125,5,110,86,100,4,100,6,108,9,125,4,124,0,
+    100,3,124,3,133,2,25,0,125,6,116,2,124,6,116,3,
+    131,2,114,206,116,14,124,6,100,7,131,2,125,6,122,14,
+    124,4,160,15,124,6,161,1,125,7,87,0,110,24,4,0,
+    116,13,107,10,114,244,1,0,1,0,1,0,124,0,6,0,
+    89,0,83,0,88,0,124,7,106,12,125,5,116,2,124,0,
+    116,3,131,2,144,1,114,24,116,0,160,16,124,5,161,1,
+    125,5,100,8,125,8,110,4,100,9,125,8,124,5,160,17,
+    124,8,161,1,125,5,124,5,124,0,124,3,100,6,133,2,
+    25,0,23,0,144,1,112,58,124,8,83,0,41,10,122,79,
+    69,120,112,97,110,100,32,126,32,97,110,100,32,126,117,115,
+    101,114,32,99,111,110,115,116,114,117,99,116,105,111,110,115,
+    46,32,32,73,102,32,117,115,101,114,32,111,114,32,36,72,
+    79,77,69,32,105,115,32,117,110,107,110,111,119,110,44,10,
+    32,32,32,32,100,111,32,110,111,116,104,105,110,103,46,243,
+    1,0,0,0,126,250,1,126,114,60,0,0,0,114,4,0,
+    0,0,90,4,72,79,77,69,78,218,5,65,83,67,73,73,
+    114,34,0,0,0,114,2,0,0,0,41,18,114,42,0,0,
+    0,114,43,0,0,0,114,35,0,0,0,114,36,0,0,0,
+    114,50,0,0,0,114,41,0,0,0,218,4,102,105,110,100,
+    114,63,0,0,0,218,7,101,110,118,105,114,111,110,218,3,
+    112,119,100,90,8,103,101,116,112,119,117,105,100,90,6,103,
+    101,116,117,105,100,90,6,112,119,95,100,105,114,218,8,75,
+    101,121,69,114,114,111,114,114,44,0,0,0,90,8,103,101,
+    116,112,119,110,97,109,218,8,102,115,101,110,99,111,100,101,
+    114,64,0,0,0,41,9,114,38,0,0,0,90,5,116,105,
+    108,100,101,114,24,0,0,0,114,65,0,0,0,114,84,0,
+    0,0,90,8,117,115,101,114,104,111,109,101,218,4,110,97,
+    109,101,90,5,112,119,101,110,116,90,4,114,111,111,116,114,
+    39,0,0,0,114,39,0,0,0,114,40,0,0,0,114,18,
+    0,0,0,232,0,0,0,115,66,0,0,0,0,3,10,1,
+    10,1,6,2,4,1,10,1,4,1,8,1,12,1,8,1,
+    8,1,8,1,10,1,8,1,2,1,20,1,14,3,12,2,
+    12,2,8,1,12,1,10,1,10,1,2,1,14,1,14,3,
+    10,1,6,1,12,1,10,1,6,2,4,1,10,1,99,1,
+    0,0,0,0,0,0,0,12,0,0,0,8,0,0,0,67,
+    0,0,0,115,90,1,0,0,116,0,160,1,124,0,161,1,
+    125,0,116,2,124,0,116,3,131,2,114,86,100,1,124,0,
+    107,7,114,32,124,0,83,0,116,4,115,58,100,2,100,3,
+    108,5,125,1,124,1,160,6,100,4,124,1,106,7,161,2,
+    97,4,116,4,106,8,125,2,100,5,125,3,100,6,125,4,
+    116,9,116,0,100,7,100,3,131,3,125,5,110,58,100,8,
+    124,0,107,7,114,98,124,0,83,0,116,10,115,124,100,2,
+    100,3,108,5,125,1,124,1,160,6,100,9,124,1,106,7,
+    161,2,97,10,116,10,106,8,125,2,100,10,125,3,100,11,
+    125,4,116,0,106,11,125,5,100,2,125,6,124,2,124,0,
+    124,6,131,2,125,7,124,7,115,166,144,1,113,86,124,7,
+    160,12,100,2,161,1,92,2,125,6,125,8,124,7,160,13,
+    100,12,161,1,125,9,124,9,160,14,124,3,161,1,114,222,
+    124,9,160,15,124,4,161,1,114,222,124,9,100,12,100,13,
+    133,2,25,0,125,9,122,46,124,5,100,3,107,8,144,1,
+    114,2,116,0,160,16,116,0,106,11,116,0,160,17,124,9,
+    161,1,25,0,161,1,125,10,110,8,124,5,124,9,25,0,
+    125,10,87,0,110,26,4,0,116,18,107,10,144,1,114,38,
+    1,0,1,0,1,0,124,8,125,6,89,0,113,148,88,0,
+    124,0,124,8,100,3,133,2,25,0,125,11,124,0,100,3,
+    124,6,133,2,25,0,124,10,23,0,125,0,116,19,124,0,
+    131,1,125,6,124,0,124,11,55,0,125,0,113,148,124,0,
+    83,0,41,14,122,90,69,120,112,97,110,100,32,115,104,101,
+    108,108,32,118,97,114,105,97,98,108,101,115,32,111,102,32,
+    102,111,114,109,32,36,118,97,114,32,97,110,100,32,36,123,
+    118,97,114,125,46,32,32,85,110,107,110,111,119,110,32,118,
+    97,114,105,97,98,108,101,115,10,32,32,32,32,97,114,101,
+    32,108,101,102,116,32,117,110,99,104,97,110,103,101,100,46,
+    243,1,0,0,0,36,114,4,0,0,0,78,115,17,0,0,
+    0,92,36,40,92,119,43,124,92,123,91,94,125,93,42,92,
+    125,41,243,1,0,0,0,123,243,1,0,0,0,125,90,8,
+    101,110,118,105,114,111,110,98,250,1,36,122,17,92,36,40,
+    92,119,43,124,92,123,91,94,125,93,42,92,125,41,250,1,
+    123,250,1,125,114,60,0,0,0,233,255,255,255,255,41,20,
+    114,42,0,0,0,114,43,0,0,0,114,35,0,0,0,114,
+    36,0,0,0,218,9,95,118,97,114,112,114,111,103,98,218,
+    2,114,101,218,7,99,111,109,112,105,108,101,114,81,0,0,
+    0,218,6,115,101,97,114,99,104,218,7,103,101,116,97,116,
+    116,114,218,8,95,118,97,114,112,114,111,103,114,83,0,0,
+    0,90,4,115,112,97,110,90,5,103,114,111,117,112,114,50,
+    0,0,0,114,52,0,0,0,114,86,0,0,0,90,8,102,
+    115,100,101,99,111,100,101,114,85,0,0,0,114,63,0,0,
+    0,41,12,114,38,0,0,0,114,96,0,0,0,114,98,0,
+    0,0,218,5,115,116,97,114,116,218,3,101,110,100,114,83,
+    0,0,0,114,65,0,0,0,218,1,109,218,1,106,114,87,
+    0,0,0,218,5,118,97,108,117,101,114,67,0,0,0,114,
+    39,0,0,0,114,39,0,0,0,114,40,0,0,0,114,19,
+    0,0,0,29,1,0,0,115,78,0,0,0,0,3,10,2,
+    10,1,8,1,4,1,4,1,8,1,14,1,6,1,4,1,
+    4,1,14,2,8,1,4,1,4,1,8,1,14,1,6,1,
+    4,1,4,1,6,1,4,2,10,1,4,1,4,1,14,1,
+    10,1,20,1,12,1,2,1,10,1,24,2,12,1,16,1,
+    10,2,12,1,16,1,8,1,10,1,99,1,0,0,0,0,
+    0,0,0,9,0,0,0,4,0,0,0,67,0,0,0,115,
+    244,0,0,0,116,0,160,1,124,0,161,1,125,0,116,2,
+    124,0,116,3,131,2,114,38,100,1,125,1,100,2,125,2,
+    100,3,125,3,100,4,125,4,110,16,100,5,125,1,100,6,
+    125,2,100,7,125,3,100,8,125,4,124,0,124,2,107,2,
+    114,66,124,3,83,0,124,0,160,4,124,1,161,1,125,5,
+    124,5,114,112,124,0,160,4,124,1,100,9,20,0,161,1,
+    114,112,124,0,160,4,124,1,100,10,20,0,161,1,115,112,
+    100,9,125,5,124,0,160,5,124,1,161,1,125,6,103,0,
+    125,7,124,6,68,0,93,74,125,8,124,8,124,2,124,3,
+    102,2,107,6,114,148,113,130,124,8,124,4,107,3,115,180,
+    124,5,115,164,124,7,114,180,124,7,114,192,124,7,100,11,
+    25,0,124,4,107,2,114,192,124,7,160,6,124,8,161,1,
+    1,0,110,12,124,7,114,204,124,7,160,7,161,0,1,0,
+    113,130,124,7,125,6,124,1,160,8,124,6,161,1,125,0,
+    124,5,114,236,124,1,124,5,20,0,124,0,23,0,125,0,
+    124,0,112,242,124,3,83,0,41,12,122,48,78,111,114,109,
+    97,108,105,122,101,32,112,97,116,104,44,32,101,108,105,109,
+    105,110,97,116,105,110,103,32,100,111,117,98,108,101,32,115,
+    108,97,115,104,101,115,44,32,101,116,99,46,114,34,0,0,
+    0,243,0,0,0,0,114,68,0,0,0,114,76,0,0,0,
+    114,2,0,0,0,218,0,114,0,0,0,0,114,1,0,0,
+    0,233,2,0,0,0,233,3,0,0,0,114,94,0,0,0,
+    41,9,114,42,0,0,0,114,43,0,0,0,114,35,0,0,
+    0,114,36,0,0,0,114,50,0,0,0,114,10,0,0,0,
+    218,6,97,112,112,101,110,100,218,3,112,111,112,114,8,0,
+    0,0,41,9,114,38,0,0,0,114,24,0,0,0,90,5,
+    101,109,112,116,121,90,3,100,111,116,90,6,100,111,116,100,
+    111,116,90,15,105,110,105,116,105,97,108,95,115,108,97,115,
+    104,101,115,90,5,99,111,109,112,115,90,9,110,101,119,95,
+    99,111,109,112,115,90,4,99,111,109,112,114,39,0,0,0,
+    114,39,0,0,0,114,40,0,0,0,114,20,0,0,0,82,
+    1,0,0,115,74,0,0,0,0,2,10,1,10,1,4,1,
+    4,1,4,1,6,2,4,1,4,1,4,1,4,1,8,1,
+    4,1,10,3,4,1,12,255,2,1,12,255,2,2,4,1,
+    10,1,4,1,8,1,12,1,2,1,16,1,2,255,2,1,
+    10,255,2,2,12,1,4,1,10,1,4,1,10,1,4,1,
+    12,1,99,1,0,0,0,0,0,0,0,2,0,0,0,3,
+    0,0,0,67,0,0,0,115,64,0,0,0,116,0,160,1,
+    124,0,161,1,125,0,116,2,124,0,131,1,115,56,116,3,
+    124,0,116,4,131,2,114,38,116,0,160,5,161,0,125,1,
+    110,8,116,0,160,6,161,0,125,1,116,7,124,1,124,0,
+    131,2,125,0,116,8,124,0,131,1,83,0,41,1,122,24,
+    82,101,116,117,114,110,32,97,110,32,97,98,115,111,108,117,
+    116,101,32,112,97,116,104,46,41,9,114,42,0,0,0,114,
+    43,0,0,0,114,7,0,0,0,114,35,0,0,0,114,36,
+    0,0,0,90,7,103,101,116,99,119,100,98,90,6,103,101,
+    116,99,119,100,114,8,0,0,0,114,20,0,0,0,41,2,
+    114,38,0,0,0,90,3,99,119,100,114,39,0,0,0,114,
+    39,0,0,0,114,40,0,0,0,114,21,0,0,0,120,1,
+    0,0,115,14,0,0,0,0,2,10,1,8,1,10,1,10,
+    2,8,1,10,1,99,1,0,0,0,0,0,0,0,3,0,
+    0,0,4,0,0,0,67,0,0,0,115,42,0,0,0,116,
+    0,160,1,124,0,161,1,125,0,116,2,124,0,100,1,100,
+    2,133,2,25,0,124,0,105,0,131,3,92,2,125,1,125,
+    2,116,3,124,1,131,1,83,0,41,3,122,108,82,101,116,
+    117,114,110,32,116,104,101,32,99,97,110,111,110,105,99,97,
+    108,32,112,97,116,104,32,111,102,32,116,104,101,32,115,112,
+    101,99,105,102,105,101,100,32,102,105,108,101,110,97,109,101,
+    44,32,101,108,105,109,105,110,97,116,105,110,103,32,97,110,
+    121,10,115,121,109,98,111,108,105,99,32,108,105,110,107,115,
+    32,101,110,99,111,117,110,116,101,114,101,100,32,105,110,32,
+    116,104,101,32,112,97,116,104,46,78,114,4,0,0,0,41,
+    4,114,42,0,0,0,114,43,0,0,0,218,13,95,106,111,
+    105,110,114,101,97,108,112,97,116,104,114,21,0,0,0,41,
+    3,218,8,102,105,108,101,110,97,109,101,114,38,0,0,0,
+    218,2,111,107,114,39,0,0,0,114,39,0,0,0,114,40,
+    0,0,0,114,30,0,0,0,135,1,0,0,115,6,0,0,
+    0,0,3,10,1,24,1,99,3,0,0,0,0,0,0,0,
+    10,0,0,0,5,0,0,0,67,0,0,0,115,24,1,0,
+    0,116,0,124,0,116,1,131,2,114,24,100,1,125,3,100,
+    2,125,4,100,3,125,5,110,12,100,4,125,3,100,5,125,
+    4,100,6,125,5,116,2,124,1,131,1,114,60,124,1,100,
+    7,100,0,133,2,25,0,125,1,124,3,125,0,124,1,144,
+    1,114,16,124,1,160,3,124,3,161,1,92,3,125,6,125,
+    7,125,1,124,6,114,60,124,6,124,4,107,2,114,96,113,
+    60,124,6,124,5,107,2,114,148,124,0,114,142,116,4,124,
+    0,131,1,92,2,125,0,125,6,124,6,124,5,107,2,114,
+    146,116,5,124,0,124,5,124,5,131,3,125,0,113,60,124,
+    5,125,0,113,60,116,5,124,0,124,6,131,2,125,8,116,
+    6,124,8,131,1,115,172,124,8,125,0,113,60,124,8,124,
+    2,107,6,114,212,124,2,124,8,25,0,125,0,124,0,100,
+    0,107,9,114,198,113,60,116,5,124,8,124,1,131,2,100,
+    8,102,2,83,0,100,0,124,2,124,8,60,0,116,7,124,
+    0,116,8,160,9,124,8,161,1,124,2,131,3,92,2,125,
+    0,125,9,124,9,144,1,115,6,116,5,124,0,124,1,131,
+    2,100,8,102,2,83,0,124,0,124,2,124,8,60,0,113,
+    60,124,0,100,9,102,2,83,0,41,10,78,114,34,0,0,
+    0,114,68,0,0,0,114,76,0,0,0,114,2,0,0,0,
+    114,0,0,0,0,114,1,0,0,0,114,60,0,0,0,70,
+    84,41,10,114,35,0,0,0,114,36,0,0,0,114,7,0,
+    0,0,218,9,112,97,114,116,105,116,105,111,110,114,10,0,
+    0,0,114,8,0,0,0,114,15,0,0,0,114,112,0,0,
+    0,114,42,0,0,0,90,8,114,101,97,100,108,105,110,107,
+    41,10,114,38,0,0,0,90,4,114,101,115,116,90,4,115,
+    101,101,110,114,24,0,0,0,114,22,0,0,0,114,23,0,
+    0,0,114,87,0,0,0,218,1,95,90,7,110,101,119,112,
+    97,116,104,114,114,0,0,0,114,39,0,0,0,114,39,0,
+    0,0,114,40,0,0,0,114,112,0,0,0,144,1,0,0,
+    115,72,0,0,0,0,1,10,1,4,1,4,1,6,2,4,
+    1,4,1,4,2,8,1,12,1,4,2,6,1,16,1,12,
+    2,2,1,8,2,4,1,12,1,8,1,14,2,4,1,2,
+    1,10,1,8,1,4,1,2,2,8,2,8,1,8,2,2,
+    3,14,1,8,1,22,1,6,1,14,1,10,2,114,112,0,
+    0,0,90,6,100,97,114,119,105,110,99,2,0,0,0,0,
+    0,0,0,9,0,0,0,11,0,0,0,67,0,0,0,115,
+    246,0,0,0,124,0,115,12,116,0,100,1,131,1,130,1,
+    116,1,160,2,124,0,161,1,125,0,116,3,124,0,116,4,
+    131,2,114,46,100,2,125,2,100,3,125,3,100,4,125,4,
+    110,12,100,5,125,2,100,6,125,3,100,7,125,4,124,1,
+    100,8,107,8,114,72,124,2,125,1,110,10,116,1,160,2,
+    124,1,161,1,125,1,122,114,100,9,100,10,132,0,116,5,
+    124,1,131,1,160,6,124,3,161,1,68,0,131,1,125,5,
+    100,11,100,10,132,0,116,5,124,0,131,1,160,6,124,3,
+    161,1,68,0,131,1,125,6,116,7,116,8,124,5,124,6,
+    103,2,131,1,131,1,125,7,124,4,103,1,116,7,124,5,
+    131,1,124,7,24,0,20,0,124,6,124,7,100,8,133,2,
+    25,0,23,0,125,8,124,8,115,188,124,2,87,0,83,0,
+    116,9,124,8,142,0,87,0,83,0,4,0,116,10,116,11,
+    116,12,116,13,102,4,107,10,114,240,1,0,1,0,1,0,
+    116,14,160,15,100,12,124,0,124,1,161,3,1,0,130,0,
+    89,0,110,2,88,0,100,8,83,0,41,13,122,35,82,101,
+    116,117,114,110,32,97,32,114,101,108,97,116,105,118,101,32,
+    118,101,114,115,105,111,110,32,111,102,32,97,32,112,97,116,
+    104,122,17,110,111,32,112,97,116,104,32,115,112,101,99,105,
+    102,105,101,100,114,68,0,0,0,114,34,0,0,0,114,76,
+    0,0,0,114,0,0,0,0,114,2,0,0,0,114,1,0,
+    0,0,78,99,1,0,0,0,0,0,0,0,2,0,0,0,
+    3,0,0,0,83,0,0,0,115,20,0,0,0,103,0,124,
+    0,93,12,125,1,124,1,114,4,124,1,145,2,113,4,83,
+    0,114,39,0,0,0,114,39,0,0,0,169,2,218,2,46,
+    48,218,1,120,114,39,0,0,0,114,39,0,0,0,114,40,
+    0,0,0,218,10,60,108,105,115,116,99,111,109,112,62,219,
+    1,0,0,115,6,0,0,0,6,0,2,0,4,0,122,27,
+    114,101,108,112,97,116,104,46,60,108,111,99,97,108,115,62,
+    46,60,108,105,115,116,99,111,109,112,62,99,1,0,0,0,
+    0,0,0,0,2,0,0,0,3,0,0,0,83,0,0,0,
+    115,20,0,0,0,103,0,124,0,93,12,125,1,124,1,114,
+    4,124,1,145,2,113,4,83,0,114,39,0,0,0,114,39,
+    0,0,0,114,117,0,0,0,114,39,0,0,0,114,39,0,
+    0,0,114,40,0,0,0,114,120,0,0,0,220,1,0,0,
+    115,6,0,0,0,6,0,2,0,4,0,114,32,0,0,0,
+    41,16,114,72,0,0,0,114,42,0,0,0,114,43,0,0,
+    0,114,35,0,0,0,114,36,0,0,0,114,21,0,0,0,
+    114,10,0,0,0,114,63,0,0,0,114,14,0,0,0,114,
+    8,0,0,0,114,45,0,0,0,114,53,0,0,0,114,54,
+    0,0,0,218,18,68,101,112,114,101,99,97,116,105,111,110,
+    87,97,114,110,105,110,103,114,55,0,0,0,114,56,0,0,
+    0,41,9,114,38,0,0,0,114,101,0,0,0,114,22,0,
+    0,0,114,24,0,0,0,114,23,0,0,0,90,10,115,116,
+    97,114,116,95,108,105,115,116,90,9,112,97,116,104,95,108,
+    105,115,116,114,65,0,0,0,90,8,114,101,108,95,108,105,
+    115,116,114,39,0,0,0,114,39,0,0,0,114,40,0,0,
+    0,114,32,0,0,0,197,1,0,0,115,48,0,0,0,0,
+    3,4,1,8,2,10,1,10,1,4,1,4,1,6,2,4,
+    1,4,1,4,2,8,1,6,2,10,2,2,1,24,1,24,
+    2,16,2,30,1,4,1,6,1,10,1,22,1,14,1,99,
+    1,0,0,0,0,0,0,0,9,0,0,0,9,0,0,0,
+    3,0,0,0,115,50,1,0,0,124,0,115,12,116,0,100,
+    1,131,1,130,1,116,1,116,2,116,3,106,4,124,0,131,
+    2,131,1,125,0,116,5,124,0,100,2,25,0,116,6,131,
+    2,114,52,100,3,137,1,100,4,137,0,110,8,100,5,137,
+    1,100,6,137,0,122,198,135,1,102,1,100,7,100,8,132,
+    8,124,0,68,0,131,1,125,1,122,28,116,7,135,1,102,
+    1,100,9,100,10,132,8,124,0,68,0,131,1,131,1,92,
+    1,125,2,87,0,110,30,4,0,116,0,107,10,114,138,1,
+    0,1,0,1,0,116,0,100,11,131,1,100,12,130,2,89,
+    0,110,2,88,0,135,0,102,1,100,13,100,8,132,8,124,
+    1,68,0,131,1,125,1,116,8,124,1,131,1,125,3,116,
+    9,124,1,131,1,125,4,124,3,125,5,116,10,124,3,131,
+    1,68,0,93,36,92,2,125,6,125,7,124,7,124,4,124,
+    6,25,0,107,3,114,186,124,3,100,12,124,6,133,2,25,
+    0,125,5,1,0,113,224,113,186,124,2,114,232,136,1,110,
+    10,136,1,100,12,100,2,133,2,25,0,125,8,124,8,136,
+    1,160,11,124,5,161,1,23,0,87,0,83,0,4,0,116,
+    12,116,13,102,2,107,10,144,1,114,44,1,0,1,0,1,
+    0,116,14,106,15,100,15,124,0,158,2,142,0,1,0,130,
+    0,89,0,110,2,88,0,100,12,83,0,41,16,122,68,71,
+    105,118,101,110,32,97,32,115,101,113,117,101,110,99,101,32,
+    111,102,32,112,97,116,104,32,110,97,109,101,115,44,32,114,
+    101,116,117,114,110,115,32,116,104,101,32,108,111,110,103,101,
+    115,116,32,99,111,109,109,111,110,32,115,117,98,45,112,97,
+    116,104,46,122,37,99,111,109,109,111,110,112,97,116,104,40,
+    41,32,97,114,103,32,105,115,32,97,110,32,101,109,112,116,
+    121,32,115,101,113,117,101,110,99,101,114,4,0,0,0,114,
+    34,0,0,0,114,68,0,0,0,114,2,0,0,0,114,0,
+    0,0,0,99,1,0,0,0,0,0,0,0,2,0,0,0,
+    5,0,0,0,19,0,0,0,115,22,0,0,0,103,0,124,
+    0,93,14,125,1,124,1,160,0,136,0,161,1,145,2,113,
+    4,83,0,114,39,0,0,0,41,1,114,10,0,0,0,41,
+    2,114,118,0,0,0,114,38,0,0,0,169,1,114,24,0,
+    0,0,114,39,0,0,0,114,40,0,0,0,114,120,0,0,
+    0,253,1,0,0,115,4,0,0,0,6,0,2,0,122,30,
+    99,111,109,109,111,110,112,97,116,104,46,60,108,111,99,97,
+    108,115,62,46,60,108,105,115,116,99,111,109,112,62,99,1,
+    0,0,0,0,0,0,0,2,0,0,0,4,0,0,0,51,
+    0,0,0,115,30,0,0,0,124,0,93,22,125,1,124,1,
+    100,0,100,1,133,2,25,0,136,0,107,2,86,0,1,0,
+    113,2,100,0,83,0,41,2,78,114,60,0,0,0,114,39,
+    0,0,0,41,2,114,118,0,0,0,114,58,0,0,0,114,
+    122,0,0,0,114,39,0,0,0,114,40,0,0,0,218,9,
+    60,103,101,110,101,120,112,114,62,0,2,0,0,115,4,0,
+    0,0,4,0,2,0,122,29,99,111,109,109,111,110,112,97,
+    116,104,46,60,108,111,99,97,108,115,62,46,60,103,101,110,
+    101,120,112,114,62,122,37,67,97,110,39,116,32,109,105,120,
+    32,97,98,115,111,108,117,116,101,32,97,110,100,32,114,101,
+    108,97,116,105,118,101,32,112,97,116,104,115,78,99,1,0,
+    0,0,0,0,0,0,2,0,0,0,5,0,0,0,19,0,
+    0,0,115,30,0,0,0,103,0,124,0,93,22,125,1,135,
+    0,102,1,100,0,100,1,132,8,124,1,68,0,131,1,145,
+    2,113,4,83,0,41,2,99,1,0,0,0,0,0,0,0,
+    2,0,0,0,4,0,0,0,19,0,0,0,115,28,0,0,
+    0,103,0,124,0,93,20,125,1,124,1,114,4,124,1,136,
+    0,107,3,114,4,124,1,145,2,113,4,83,0,114,39,0,
+    0,0,114,39,0,0,0,41,2,114,118,0,0,0,218,1,
+    99,169,1,114,22,0,0,0,114,39,0,0,0,114,40,0,
+    0,0,114,120,0,0,0,4,2,0,0,115,8,0,0,0,
+    6,0,2,0,4,0,8,0,122,41,99,111,109,109,111,110,
+    112,97,116,104,46,60,108,111,99,97,108,115,62,46,60,108,
+    105,115,116,99,111,109,112,62,46,60,108,105,115,116,99,111,
+    109,112,62,114,39,0,0,0,41,2,114,118,0,0,0,114,
+    49,0,0,0,114,125,0,0,0,114,39,0,0,0,114,40,
+    0,0,0,114,120,0,0,0,4,2,0,0,115,4,0,0,
+    0,6,0,2,0,114,33,0,0,0,41,1,114,33,0,0,
+    0,41,16,114,72,0,0,0,218,5,116,117,112,108,101,114,
+    51,0,0,0,114,42,0,0,0,114,43,0,0,0,114,35,
+    0,0,0,114,36,0,0,0,218,3,115,101,116,218,3,109,
+    105,110,218,3,109,97,120,218,9,101,110,117,109,101,114,97,
+    116,101,114,8,0,0,0,114,45,0,0,0,114,53,0,0,
+    0,114,55,0,0,0,114,56,0,0,0,41,9,90,5,112,
+    97,116,104,115,90,11,115,112,108,105,116,95,112,97,116,104,
+    115,114,7,0,0,0,114,77,0,0,0,114,78,0,0,0,
+    90,6,99,111,109,109,111,110,114,65,0,0,0,114,124,0,
+    0,0,90,6,112,114,101,102,105,120,114,39,0,0,0,41,
+    2,114,22,0,0,0,114,24,0,0,0,114,40,0,0,0,
+    114,33,0,0,0,238,1,0,0,115,54,0,0,0,0,3,
+    4,1,8,2,16,1,14,1,4,1,6,2,4,1,4,2,
+    2,1,18,2,2,1,28,1,14,1,16,2,18,1,8,1,
+    8,1,4,1,16,1,12,1,12,1,6,2,20,1,16,1,
+    20,1,14,1,41,1,78,41,39,218,7,95,95,100,111,99,
+    95,95,114,22,0,0,0,114,23,0,0,0,114,28,0,0,
+    0,114,24,0,0,0,114,25,0,0,0,114,26,0,0,0,
+    114,27,0,0,0,114,29,0,0,0,114,42,0,0,0,218,
+    3,115,121,115,114,73,0,0,0,114,55,0,0,0,90,7,
+    95,95,97,108,108,95,95,114,41,0,0,0,114,6,0,0,
+    0,114,7,0,0,0,114,8,0,0,0,114,10,0,0,0,
+    114,11,0,0,0,114,69,0,0,0,114,9,0,0,0,114,
+    12,0,0,0,114,13,0,0,0,114,15,0,0,0,114,16,
+    0,0,0,114,17,0,0,0,114,18,0,0,0,114,100,0,
+    0,0,114,95,0,0,0,114,19,0,0,0,114,20,0,0,
+    0,114,21,0,0,0,114,30,0,0,0,114,112,0,0,0,
+    218,8,112,108,97,116,102,111,114,109,114,31,0,0,0,114,
+    32,0,0,0,114,33,0,0,0,114,39,0,0,0,114,39,
+    0,0,0,114,39,0,0,0,114,40,0,0,0,218,8,60,
+    109,111,100,117,108,101,62,1,0,0,0,115,142,0,0,0,
+    4,15,4,1,4,1,4,1,4,1,4,1,4,1,4,1,
+    4,2,8,1,8,1,8,1,8,1,8,2,12,1,2,0,
+    2,0,2,0,2,0,2,1,2,0,2,0,2,0,2,0,
+    2,0,2,0,2,1,2,0,2,0,2,0,2,0,2,1,
+    2,0,2,0,2,1,2,0,2,0,2,0,2,0,2,0,
+    2,0,2,1,2,0,2,0,2,0,2,1,2,249,4,10,
+    8,11,8,12,8,11,8,29,8,17,8,9,10,5,8,9,
+    8,10,8,14,8,10,8,12,8,42,8,50,4,1,4,2,
+    8,53,8,38,8,15,8,9,8,51,10,2,10,41,
+};
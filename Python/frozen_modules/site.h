@@ -0,0 +1,1043 @@
+/* Auto-generated by Programs/_freeze_importlib.c */
+const unsigned char _Py_M__site[] = {
+    99,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,
+    0,64,0,0,0,115,30,1,0,0,100,0,90,0,100,1,
+    100,2,108,1,90,1,100,1,100,2,108,2,90,2,100,1,
+    100,2,108,3,90,3,100,1,100,2,108,4,90,4,101,1,
+    106,5,101,1,106,6,103,2,97,7,100,2,97,8,100,2,
+    97,9,100,2,97,10,100,3,100,4,132,0,90,11,100,5,
+    100,6,132,0,90,12,100,7,100,8,132,0,90,13,100,9,
+    100,10,132,0,90,14,100,11,100,12,132,0,90,15,100,50,
+    100,13,100,14,132,1,90,16,100,15,100,16,132,0,90,17,
+    100,17,100,18,132,0,90,18,100,19,100,20,132,0,90,19,
+    100,21,100,22,132,0,90,20,100,23,100,24,132,0,90,21,
+    100,25,100,26,132,0,90,22,100,51,100,27,100,28,132,1,
+    90,23,100,52,100,29,100,30,132,1,90,24,100,31,100,32,
+    132,0,90,25,100,33,100,34,132,0,90,26,100,35,100,36,
+    132,0,90,27,100,37,100,38,132,0,90,28,100,39,100,40,
+    132,0,90,29,100,41,100,42,132,0,90,30,100,43,100,44,
+    132,0,90,31,100,45,100,46,132,0,90,32,101,1,106,33,
+    106,34,144,1,115,2,101,32,131,0,1,0,100,47,100,48,
+    132,0,90,35,101,36,100,49,107,2,144,1,114,26,101,35,
+    131,0,1,0,100,2,83,0,41,53,97,182,11,0,0,65,
+    112,112,101,110,100,32,109,111,100,117,108,101,32,115,101,97,
+    114,99,104,32,112,97,116,104,115,32,102,111,114,32,116,104,
+    105,114,100,45,112,97,114,116,121,32,112,97,99,107,97,103,
+    101,115,32,116,111,32,115,121,115,46,112,97,116,104,46,10,
+    10,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+    42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+    42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+    42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+    42,10,42,32,84,104,105,115,32,109,111,100,117,108,101,32,
+    105,115,32,97,117,116,111,109,97,116,105,99,97,108,108,121,
+    32,105,109,112,111,114,116,101,100,32,100,117,114,105,110,103,
+    32,105,110,105,116,105,97,108,105,122,97,116,105,111,110,46,
+    32,42,10,42,42,42,42,42,42,42,42,42,42,42,42,42,
+    42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+    42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+    42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+    42,42,42,10,10,84,104,105,115,32,119,105,108,108,32,97,
+    112,112,101,110,100,32,115,105,116,101,45,115,112,101,99,105,
+    102,105,99,32,112,97,116,104,115,32,116,111,32,116,104,101,
+    32,109,111,100,117,108,101,32,115,101,97,114,99,104,32,112,
+    97,116,104,46,32,32,79,110,10,85,110,105,120,32,40,105,
+    110,99,108,117,100,105,110,103,32,77,97,99,32,79,83,88,
+    41,44,32,105,116,32,115,116,97,114,116,115,32,119,105,116,
+    104,32,115,121,115,46,112,114,101,102,105,120,32,97,110,100,
+    10,115,121,115,46,101,120,101,99,95,112,114,101,102,105,120,
+    32,40,105,102,32,100,105,102,102,101,114,101,110,116,41,32,
+    97,110,100,32,97,112,112,101,110,100,115,10,108,105,98,47,
+    112,121,116,104,111,110,60,118,101,114,115,105,111,110,62,47,
+    115,105,116,101,45,112,97,99,107,97,103,101,115,46,10,79,
+    110,32,111,116,104,101,114,32,112,108,97,116,102,111,114,109,
+    115,32,40,115,117,99,104,32,97,115,32,87,105,110,100,111,
+    119,115,41,44,32,105,116,32,116,114,105,101,115,32,101,97,
+    99,104,32,111,102,32,116,104,101,10,112,114,101,102,105,120,
+    101,115,32,100,105,114,101,99,116,108,121,44,32,97,115,32,
+    119,101,108,108,32,97,115,32,119,105,116,104,32,108,105,98,
+    47,115,105,116,101,45,112,97,99,107,97,103,101,115,32,97,
+    112,112,101,110,100,101,100,46,32,32,84,104,101,10,114,101,
+    115,117,108,116,105,110,103,32,100,105,114,101,99,116,111,114,
+    105,101,115,44,32,105,102,32,116,104,101,121,32,101,120,105,
+    115,116,44,32,97,114,101,32,97,112,112,101,110,100,101,100,
+    32,116,111,32,115,121,115,46,112,97,116,104,44,32,97,110,
+    100,10,97,108,115,111,32,105,110,115,112,101,99,116,101,100,
+    32,102,111,114,32,112,97,116,104,32,99,111,110,102,105,103,
+    117,114,97,116,105,111,110,32,102,105,108,101,115,46,10,10,
+    73,102,32,97,32,102,105,108,101,32,110,97,109,101,100,32,
+    34,112,121,118,101,110,118,46,99,102,103,34,32,101,120,105,
+    115,116,115,32,111,110,101,32,100,105,114,101,99,116,111,114,
+    121,32,97,98,111,118,101,32,115,121,115,46,101,120,101,99,
+    117,116,97,98,108,101,44,10,115,121,115,46,112,114,101,102,
+    105,120,32,97,110,100,32,115,121,115,46,101,120,101,99,95,
+    112,114,101,102,105,120,32,97,114,101,32,115,101,116,32,116,
+    111,32,116,104,97,116,32,100,105,114,101,99,116,111,114,121,
+    32,97,110,100,10,105,116,32,105,115,32,97,108,115,111,32,
+    99,104,101,99,107,101,100,32,102,111,114,32,115,105,116,101,
+    45,112,97,99,107,97,103,101,115,32,40,115,121,115,46,98,
+    97,115,101,95,112,114,101,102,105,120,32,97,110,100,10,115,
+    121,115,46,98,97,115,101,95,101,120,101,99,95,112,114,101,
+    102,105,120,32,119,105,108,108,32,97,108,119,97,121,115,32,
+    98,101,32,116,104,101,32,34,114,101,97,108,34,32,112,114,
+    101,102,105,120,101,115,32,111,102,32,116,104,101,32,80,121,
+    116,104,111,110,10,105,110,115,116,97,108,108,97,116,105,111,
+    110,41,46,32,73,102,32,34,112,121,118,101,110,118,46,99,
+    102,103,34,32,40,97,32,98,111,111,116,115,116,114,97,112,
+    32,99,111,110,102,105,103,117,114,97,116,105,111,110,32,102,
+    105,108,101,41,32,99,111,110,116,97,105,110,115,10,116,104,
+    101,32,107,101,121,32,34,105,110,99,108,117,100,101,45,115,
+    121,115,116,101,109,45,115,105,116,101,45,112,97,99,107,97,
+    103,101,115,34,32,115,101,116,32,116,111,32,97,110,121,116,
+    104,105,110,103,32,111,116,104,101,114,32,116,104,97,110,32,
+    34,102,97,108,115,101,34,10,40,99,97,115,101,45,105,110,
+    115,101,110,115,105,116,105,118,101,41,44,32,116,104,101,32,
+    115,121,115,116,101,109,45,108,101,118,101,108,32,112,114,101,
+    102,105,120,101,115,32,119,105,108,108,32,115,116,105,108,108,
+    32,97,108,115,111,32,98,101,10,115,101,97,114,99,104,101,
+    100,32,102,111,114,32,115,105,116,101,45,112,97,99,107,97,
+    103,101,115,59,32,111,116,104,101,114,119,105,115,101,32,116,
+    104,101,121,32,119,111,110,39,116,46,10,10,65,108,108,32,
+    111,102,32,116,104,101,32,114,101,115,117,108,116,105,110,103,
+    32,115,105,116,101,45,115,112,101,99,105,102,105,99,32,100,
+    105,114,101,99,116,111,114,105,101,115,44,32,105,102,32,116,
+    104,101,121,32,101,120,105,115,116,44,32,97,114,101,10,97,
+    112,112,101,110,100,101,100,32,116,111,32,115,121,115,46,112,
+    97,116,104,44,32,97,110,100,32,97,108,115,111,32,105,110,
+    115,112,101,99,116,101,100,32,102,111,114,32,112,97,116,104,
+    32,99,111,110,102,105,103,117,114,97,116,105,111,110,10,102,
+    105,108,101,115,46,10,10,65,32,112,97,116,104,32,99,111,
+    110,102,105,103,117,114,97,116,105,111,110,32,102,105,108,101,
+    32,105,115,32,97,32,102,105,108,101,32,119,104,111,115,101,
+    32,110,97,109,101,32,104,97,115,32,116,104,101,32,102,111,
+    114,109,10,60,112,97,99,107,97,103,101,62,46,112,116,104,
+    59,32,105,116,115,32,99,111,110,116,101,110,116,115,32,97,
+    114,101,32,97,100,100,105,116,105,111,110,97,108,32,100,105,
+    114,101,99,116,111,114,105,101,115,32,40,111,110,101,32,112,
+    101,114,32,108,105,110,101,41,10,116,111,32,98,101,32,97,
+    100,100,101,100,32,116,111,32,115,121,115,46,112,97,116,104,
+    46,32,32,78,111,110,45,101,120,105,115,116,105,110,103,32,
+    100,105,114,101,99,116,111,114,105,101,115,32,40,111,114,10,
+    110,111,110,45,100,105,114,101,99,116,111,114,105,101,115,41,
+    32,97,114,101,32,110,101,118,101,114,32,97,100,100,101,100,
+    32,116,111,32,115,121,115,46,112,97,116,104,59,32,110,111,
+    32,100,105,114,101,99,116,111,114,121,32,105,115,32,97,100,
+    100,101,100,32,116,111,10,115,121,115,46,112,97,116,104,32,
+    109,111,114,101,32,116,104,97,110,32,111,110,99,101,46,32,
+    32,66,108,97,110,107,32,108,105,110,101,115,32,97,110,100,
+    32,108,105,110,101,115,32,98,101,103,105,110,110,105,110,103,
+    32,119,105,116,104,10,39,35,39,32,97,114,101,32,115,107,
+    105,112,112,101,100,46,32,76,105,110,101,115,32,115,116,97,
+    114,116,105,110,103,32,119,105,116,104,32,39,105,109,112,111,
+    114,116,39,32,97,114,101,32,101,120,101,99,117,116,101,100,
+    46,10,10,70,111,114,32,101,120,97,109,112,108,101,44,32,
+    115,117,112,112,111,115,101,32,115,121,115,46,112,114,101,102,
+    105,120,32,97,110,100,32,115,121,115,46,101,120,101,99,95,
+    112,114,101,102,105,120,32,97,114,101,32,115,101,116,32,116,
+    111,10,47,117,115,114,47,108,111,99,97,108,32,97,110,100,
+    32,116,104,101,114,101,32,105,115,32,97,32,100,105,114,101,
+    99,116,111,114,121,32,47,117,115,114,47,108,111,99,97,108,
+    47,108,105,98,47,112,121,116,104,111,110,50,46,53,47,115,
+    105,116,101,45,112,97,99,107,97,103,101,115,10,119,105,116,
+    104,32,116,104,114,101,101,32,115,117,98,100,105,114,101,99,
+    116,111,114,105,101,115,44,32,102,111,111,44,32,98,97,114,
+    32,97,110,100,32,115,112,97,109,44,32,97,110,100,32,116,
+    119,111,32,112,97,116,104,10,99,111,110,102,105,103,117,114,
+    97,116,105,111,110,32,102,105,108,101,115,44,32,102,111,111,
+    46,112,116,104,32,97,110,100,32,98,97,114,46,112,116,104,
+    46,32,32,65,115,115,117,109,101,32,102,111,111,46,112,116,
+    104,32,99,111,110,116,97,105,110,115,32,116,104,101,10,102,
+    111,108,108,111,119,105,110,103,58,10,10,32,32,35,32,102,
+    111,111,32,112,97,99,107,97,103,101,32,99,111,110,102,105,
+    103,117,114,97,116,105,111,110,10,32,32,102,111,111,10,32,
+    32,98,97,114,10,32,32,98,108,101,116,99,104,10,10,97,
+    110,100,32,98,97,114,46,112,116,104,32,99,111,110,116,97,
+    105,110,115,58,10,10,32,32,35,32,98,97,114,32,112,97,
+    99,107,97,103,101,32,99,111,110,102,105,103,117,114,97,116,
+    105,111,110,10,32,32,98,97,114,10,10,84,104,101,110,32,
+    116,104,101,32,102,111,108,108,111,119,105,110,103,32,100,105,
+    114,101,99,116,111,114,105,101,115,32,97,114,101,32,97,100,
+    100,101,100,32,116,111,32,115,121,115,46,112,97,116,104,44,
+    32,105,110,32,116,104,105,115,32,111,114,100,101,114,58,10,
+    10,32,32,47,117,115,114,47,108,111,99,97,108,47,108,105,
+    98,47,112,121,116,104,111,110,50,46,53,47,115,105,116,101,
+    45,112,97,99,107,97,103,101,115,47,98,97,114,10,32,32,
+    47,117,115,114,47,108,111,99,97,108,47,108,105,98,47,112,
+    121,116,104,111,110,50,46,53,47,115,105,116,101,45,112,97,
+    99,107,97,103,101,115,47,102,111,111,10,10,78,111,116,101,
+    32,116,104,97,116,32,98,108,101,116,99,104,32,105,115,32,
+    111,109,105,116,116,101,100,32,98,101,99,97,117,115,101,32,
+    105,116,32,100,111,101,115,110,39,116,32,101,120,105,115,116,
+    59,32,98,97,114,32,112,114,101,99,101,100,101,115,32,102,
+    111,111,10,98,101,99,97,117,115,101,32,98,97,114,46,112,
+    116,104,32,99,111,109,101,115,32,97,108,112,104,97,98,101,
+    116,105,99,97,108,108,121,32,98,101,102,111,114,101,32,102,
+    111,111,46,112,116,104,59,32,97,110,100,32,115,112,97,109,
+    32,105,115,10,111,109,105,116,116,101,100,32,98,101,99,97,
+    117,115,101,32,105,116,32,105,115,32,110,111,116,32,109,101,
+    110,116,105,111,110,101,100,32,105,110,32,101,105,116,104,101,
+    114,32,112,97,116,104,32,99,111,110,102,105,103,117,114,97,
+    116,105,111,110,32,102,105,108,101,46,10,10,84,104,101,32,
+    114,101,97,100,108,105,110,101,32,109,111,100,117,108,101,32,
+    105,115,32,97,108,115,111,32,97,117,116,111,109,97,116,105,
+    99,97,108,108,121,32,99,111,110,102,105,103,117,114,101,100,
+    32,116,111,32,101,110,97,98,108,101,10,99,111,109,112,108,
+    101,116,105,111,110,32,102,111,114,32,115,121,115,116,101,109,
+    115,32,116,104,97,116,32,115,117,112,112,111,114,116,32,105,
+    116,46,32,32,84,104,105,115,32,99,97,110,32,98,101,32,
+    111,118,101,114,114,105,100,100,101,110,32,105,110,10,115,105,
+    116,101,99,117,115,116,111,109,105,122,101,44,32,117,115,101,
+    114,99,117,115,116,111,109,105,122,101,32,111,114,32,80,89,
+    84,72,79,78,83,84,65,82,84,85,80,46,32,32,83,116,
+    97,114,116,105,110,103,32,80,121,116,104,111,110,32,105,110,
+    10,105,115,111,108,97,116,101,100,32,109,111,100,101,32,40,
+    45,73,41,32,100,105,115,97,98,108,101,115,32,97,117,116,
+    111,109,97,116,105,99,32,114,101,97,100,108,105,110,101,32,
+    99,111,110,102,105,103,117,114,97,116,105,111,110,46,10,10,
+    65,102,116,101,114,32,116,104,101,115,101,32,111,112,101,114,
+    97,116,105,111,110,115,44,32,97,110,32,97,116,116,101,109,
+    112,116,32,105,115,32,109,97,100,101,32,116,111,32,105,109,
+    112,111,114,116,32,97,32,109,111,100,117,108,101,10,110,97,
+    109,101,100,32,115,105,116,101,99,117,115,116,111,109,105,122,
+    101,44,32,119,104,105,99,104,32,99,97,110,32,112,101,114,
+    102,111,114,109,32,97,114,98,105,116,114,97,114,121,32,97,
+    100,100,105,116,105,111,110,97,108,10,115,105,116,101,45,115,
+    112,101,99,105,102,105,99,32,99,117,115,116,111,109,105,122,
+    97,116,105,111,110,115,46,32,32,73,102,32,116,104,105,115,
+    32,105,109,112,111,114,116,32,102,97,105,108,115,32,119,105,
+    116,104,32,97,110,10,73,109,112,111,114,116,69,114,114,111,
+    114,32,101,120,99,101,112,116,105,111,110,44,32,105,116,32,
+    105,115,32,115,105,108,101,110,116,108,121,32,105,103,110,111,
+    114,101,100,46,10,233,0,0,0,0,78,99,0,0,0,0,
+    0,0,0,0,2,0,0,0,8,0,0,0,71,0,0,0,
+    115,66,0,0,0,116,0,106,1,106,2,124,0,142,0,125,
+    1,122,16,116,0,106,1,160,3,124,1,161,1,125,1,87,
+    0,110,20,4,0,116,4,107,10,114,48,1,0,1,0,1,
+    0,89,0,110,2,88,0,124,1,116,0,106,1,160,5,124,
+    1,161,1,102,2,83,0,169,1,78,41,6,218,2,111,115,
+    218,4,112,97,116,104,218,4,106,111,105,110,218,7,97,98,
+    115,112,97,116,104,218,7,79,83,69,114,114,111,114,90,8,
+    110,111,114,109,99,97,115,101,41,2,90,5,112,97,116,104,
+    115,218,3,100,105,114,169,0,114,8,0,0,0,250,13,60,
+    102,114,111,122,101,110,32,115,105,116,101,62,218,8,109,97,
+    107,101,112,97,116,104,90,0,0,0,115,12,0,0,0,0,
+    1,12,1,2,1,16,1,14,1,6,1,114,10,0,0,0,
+    99,0,0,0,0,0,0,0,0,1,0,0,0,11,0,0,
+    0,67,0,0,0,115,146,0,0,0,116,0,116,1,106,2,
+    160,3,161,0,131,1,68,0,93,126,125,0,116,4,116,4,
+    124,0,100,1,100,2,131,3,100,3,100,2,131,3,100,4,
+    107,7,114,44,113,14,122,20,116,5,106,6,160,7,124,0,
+    106,8,161,1,124,0,95,8,87,0,110,26,4,0,116,9,
+    116,10,116,11,102,3,107,10,114,90,1,0,1,0,1,0,
+    89,0,110,2,88,0,122,20,116,5,106,6,160,7,124,0,
+    106,12,161,1,124,0,95,12,87,0,110,26,4,0,116,9,
+    116,10,116,11,102,3,107,10,114,138,1,0,1,0,1,0,
+    89,0,110,2,88,0,113,14,100,2,83,0,41,5,122,69,
+    83,101,116,32,97,108,108,32,109,111,100,117,108,101,32,95,
+    95,102,105,108,101,95,95,32,97,110,100,32,95,95,99,97,
+    99,104,101,100,95,95,32,97,116,116,114,105,98,117,116,101,
+    115,32,116,111,32,97,110,32,97,98,115,111,108,117,116,101,
+    32,112,97,116,104,218,10,95,95,108,111,97,100,101,114,95,
+    95,78,218,10,95,95,109,111,100,117,108,101,95,95,41,2,
+    90,17,95,102,114,111,122,101,110,95,105,109,112,111,114,116,
+    108,105,98,90,26,95,102,114,111,122,101,110,95,105,109,112,
+    111,114,116,108,105,98,95,101,120,116,101,114,110,97,108,41,
+    13,218,3,115,101,116,218,3,115,121,115,218,7,109,111,100,
+    117,108,101,115,218,6,118,97,108,117,101,115,218,7,103,101,
+    116,97,116,116,114,114,2,0,0,0,114,3,0,0,0,114,
+    5,0,0,0,218,8,95,95,102,105,108,101,95,95,218,14,
+    65,116,116,114,105,98,117,116,101,69,114,114,111,114,114,6,
+    0,0,0,218,9,84,121,112,101,69,114,114,111,114,90,10,
+    95,95,99,97,99,104,101,100,95,95,41,1,218,1,109,114,
+    8,0,0,0,114,8,0,0,0,114,9,0,0,0,218,9,
+    97,98,115,95,112,97,116,104,115,99,0,0,0,115,26,0,
+    0,0,0,2,18,1,18,1,2,255,4,2,2,1,2,1,
+    20,1,20,1,6,1,2,1,20,1,20,1,114,22,0,0,
+    0,99,0,0,0,0,0,0,0,0,4,0,0,0,4,0,
+    0,0,67,0,0,0,115,80,0,0,0,103,0,125,0,116,
+    0,131,0,125,1,116,1,106,2,68,0,93,44,125,2,116,
+    3,124,2,131,1,92,2,125,2,125,3,124,3,124,1,107,
+    7,114,16,124,0,160,4,124,2,161,1,1,0,124,1,160,
+    5,124,3,161,1,1,0,113,16,124,0,116,1,106,2,100,
+    1,100,1,133,2,60,0,124,1,83,0,41,2,122,75,32,
+    82,101,109,111,118,101,32,100,117,112,108,105,99,97,116,101,
+    32,101,110,116,114,105,101,115,32,102,114,111,109,32,115,121,
+    115,46,112,97,116,104,32,97,108,111,110,103,32,119,105,116,
+    104,32,109,97,107,105,110,103,32,116,104,101,109,10,32,32,
+    32,32,97,98,115,111,108,117,116,101,78,41,6,114,13,0,
+    0,0,114,14,0,0,0,114,3,0,0,0,114,10,0,0,
+    0,218,6,97,112,112,101,110,100,218,3,97,100,100,41,4,
+    218,1,76,218,11,107,110,111,119,110,95,112,97,116,104,115,
+    114,7,0,0,0,218,7,100,105,114,99,97,115,101,114,8,
+    0,0,0,114,8,0,0,0,114,9,0,0,0,218,14,114,
+    101,109,111,118,101,100,117,112,112,97,116,104,115,115,0,0,
+    0,115,18,0,0,0,0,5,4,1,6,1,10,4,12,1,
+    8,1,10,1,12,1,14,1,114,28,0,0,0,99,0,0,
+    0,0,0,0,0,0,4,0,0,0,9,0,0,0,67,0,
+    0,0,115,86,0,0,0,116,0,131,0,125,0,116,1,106,
+    2,68,0,93,68,125,1,122,38,116,3,106,2,160,4,124,
+    1,161,1,114,52,116,5,124,1,131,1,92,2,125,2,125,
+    3,124,0,160,6,124,3,161,1,1,0,87,0,113,12,4,
+    0,116,7,107,10,114,78,1,0,1,0,1,0,89,0,113,
+    12,89,0,113,12,88,0,113,12,124,0,83,0,41,1,122,
+    69,82,101,116,117,114,110,32,97,32,115,101,116,32,99,111,
+    110,116,97,105,110,105,110,103,32,97,108,108,32,101,120,105,
+    115,116,105,110,103,32,102,105,108,101,32,115,121,115,116,101,
+    109,32,105,116,101,109,115,32,102,114,111,109,32,115,121,115,
+    46,112,97,116,104,46,41,8,114,13,0,0,0,114,14,0,
+    0,0,114,3,0,0,0,114,2,0,0,0,218,6,101,120,
+    105,115,116,115,114,10,0,0,0,114,24,0,0,0,114,20,
+    0,0,0,41,4,218,1,100,90,4,105,116,101,109,218,1,
+    95,90,8,105,116,101,109,99,97,115,101,114,8,0,0,0,
+    114,8,0,0,0,114,9,0,0,0,218,14,95,105,110,105,
+    116,95,112,97,116,104,105,110,102,111,134,0,0,0,115,18,
+    0,0,0,0,2,6,1,10,1,2,1,12,1,12,1,14,
+    1,14,1,12,1,114,32,0,0,0,99,3,0,0,0,0,
+    0,0,0,12,0,0,0,11,0,0,0,67,0,0,0,115,
+    112,1,0,0,124,2,100,1,107,8,114,20,116,0,131,0,
+    125,2,100,2,125,3,110,4,100,3,125,3,116,1,106,2,
+    160,3,124,0,124,1,161,2,125,4,122,14,116,4,124,4,
+    100,4,131,2,125,5,87,0,110,26,4,0,116,5,107,10,
+    114,78,1,0,1,0,1,0,89,0,100,1,83,0,89,0,
+    110,2,88,0,124,5,144,1,143,6,1,0,116,6,124,5,
+    131,1,68,0,93,246,92,2,125,6,125,7,124,7,160,7,
+    100,5,161,1,114,116,113,96,122,90,124,7,160,7,100,6,
+    161,1,114,140,116,8,124,7,131,1,1,0,87,0,113,96,
+    124,7,160,9,161,0,125,7,116,10,124,0,124,7,131,2,
+    92,2,125,8,125,9,124,9,124,2,107,7,114,204,116,1,
+    106,2,160,11,124,8,161,1,114,204,116,12,106,2,160,13,
+    124,8,161,1,1,0,124,2,160,14,124,9,161,1,1,0,
+    87,0,110,134,4,0,116,15,107,10,144,1,114,84,1,0,
+    1,0,1,0,116,16,100,7,160,17,124,6,100,8,23,0,
+    124,4,161,2,116,12,106,18,100,9,141,2,1,0,100,10,
+    100,1,108,19,125,10,124,10,106,20,116,12,160,21,161,0,
+    142,0,68,0,93,40,125,11,124,11,160,22,161,0,68,0,
+    93,24,125,7,116,16,100,11,124,7,23,0,116,12,106,18,
+    100,9,141,2,1,0,144,1,113,28,144,1,113,16,116,16,
+    100,12,116,12,106,18,100,9,141,2,1,0,89,0,1,0,
+    144,1,113,88,89,0,110,2,88,0,113,96,87,0,53,0,
+    81,0,82,0,88,0,124,3,144,1,114,108,100,1,125,2,
+    124,2,83,0,41,13,122,214,80,114,111,99,101,115,115,32,
+    97,32,46,112,116,104,32,102,105,108,101,32,119,105,116,104,
+    105,110,32,116,104,101,32,115,105,116,101,45,112,97,99,107,
+    97,103,101,115,32,100,105,114,101,99,116,111,114,121,58,10,
+    32,32,32,32,32,32,32,70,111,114,32,101,97,99,104,32,
+    108,105,110,101,32,105,110,32,116,104,101,32,102,105,108,101,
+    44,32,101,105,116,104,101,114,32,99,111,109,98,105,110,101,
+    32,105,116,32,119,105,116,104,32,115,105,116,101,100,105,114,
+    32,116,111,32,97,32,112,97,116,104,10,32,32,32,32,32,
+    32,32,97,110,100,32,97,100,100,32,116,104,97,116,32,116,
+    111,32,107,110,111,119,110,95,112,97,116,104,115,44,32,111,
+    114,32,101,120,101,99,117,116,101,32,105,116,32,105,102,32,
+    105,116,32,115,116,97,114,116,115,32,119,105,116,104,32,39,
+    105,109,112,111,114,116,32,39,46,10,32,32,32,32,78,84,
+    70,218,1,114,250,1,35,41,2,122,7,105,109,112,111,114,
+    116,32,122,7,105,109,112,111,114,116,9,122,34,69,114,114,
+    111,114,32,112,114,111,99,101,115,115,105,110,103,32,108,105,
+    110,101,32,123,58,100,125,32,111,102,32,123,125,58,10,233,
+    1,0,0,0,41,1,90,4,102,105,108,101,114,0,0,0,
+    0,122,2,32,32,122,26,10,82,101,109,97,105,110,100,101,
+    114,32,111,102,32,102,105,108,101,32,105,103,110,111,114,101,
+    100,41,23,114,32,0,0,0,114,2,0,0,0,114,3,0,
+    0,0,114,4,0,0,0,218,4,111,112,101,110,114,6,0,
+    0,0,218,9,101,110,117,109,101,114,97,116,101,218,10,115,
+    116,97,114,116,115,119,105,116,104,218,4,101,120,101,99,218,
+    6,114,115,116,114,105,112,114,10,0,0,0,114,29,0,0,
+    0,114,14,0,0,0,114,23,0,0,0,114,24,0,0,0,
+    218,9,69,120,99,101,112,116,105,111,110,218,5,112,114,105,
+    110,116,218,6,102,111,114,109,97,116,218,6,115,116,100,101,
+    114,114,218,9,116,114,97,99,101,98,97,99,107,90,16,102,
+    111,114,109,97,116,95,101,120,99,101,112,116,105,111,110,218,
+    8,101,120,99,95,105,110,102,111,218,10,115,112,108,105,116,
+    108,105,110,101,115,41,12,218,7,115,105,116,101,100,105,114,
+    218,4,110,97,109,101,114,26,0,0,0,218,5,114,101,115,
+    101,116,90,8,102,117,108,108,110,97,109,101,218,1,102,218,
+    1,110,218,4,108,105,110,101,114,7,0,0,0,114,27,0,
+    0,0,114,45,0,0,0,90,6,114,101,99,111,114,100,114,
+    8,0,0,0,114,8,0,0,0,114,9,0,0,0,218,10,
+    97,100,100,112,97,99,107,97,103,101,147,0,0,0,115,70,
+    0,0,0,0,5,8,1,6,1,6,2,4,1,14,1,2,
+    1,14,1,14,1,12,1,8,1,16,1,10,1,2,1,2,
+    1,10,1,8,1,4,1,8,1,14,1,20,1,12,1,14,
+    1,16,1,16,1,4,255,6,2,8,1,18,1,12,1,26,
+    1,14,1,26,1,6,1,4,1,114,54,0,0,0,99,2,
+    0,0,0,0,0,0,0,6,0,0,0,8,0,0,0,67,
+    0,0,0,115,156,0,0,0,124,1,100,1,107,8,114,20,
+    116,0,131,0,125,1,100,2,125,2,110,4,100,3,125,2,
+    116,1,124,0,131,1,92,2,125,0,125,3,124,3,124,1,
+    107,7,114,66,116,2,106,3,160,4,124,0,161,1,1,0,
+    124,1,160,5,124,3,161,1,1,0,122,14,116,6,160,7,
+    124,0,161,1,125,4,87,0,110,22,4,0,116,8,107,10,
+    114,102,1,0,1,0,1,0,89,0,100,1,83,0,88,0,
+    100,4,100,5,132,0,124,4,68,0,131,1,125,4,116,9,
+    124,4,131,1,68,0,93,16,125,5,116,10,124,0,124,5,
+    124,1,131,3,1,0,113,126,124,2,114,152,100,1,125,1,
+    124,1,83,0,41,6,122,84,65,100,100,32,39,115,105,116,
+    101,100,105,114,39,32,97,114,103,117,109,101,110,116,32,116,
+    111,32,115,121,115,46,112,97,116,104,32,105,102,32,109,105,
+    115,115,105,110,103,32,97,110,100,32,104,97,110,100,108,101,
+    32,46,112,116,104,32,102,105,108,101,115,32,105,110,10,32,
+    32,32,32,39,115,105,116,101,100,105,114,39,78,84,70,99,
+    1,0,0,0,0,0,0,0,2,0,0,0,5,0,0,0,
+    83,0,0,0,115,26,0,0,0,103,0,124,0,93,18,125,
+    1,124,1,160,0,100,0,161,1,114,4,124,1,145,2,113,
+    4,83,0,41,1,122,4,46,112,116,104,41,1,218,8,101,
+    110,100,115,119,105,116,104,41,2,218,2,46,48,114,49,0,
+    0,0,114,8,0,0,0,114,8,0,0,0,114,9,0,0,
+    0,218,10,60,108,105,115,116,99,111,109,112,62,205,0,0,
+    0,115,6,0,0,0,6,0,2,0,10,0,122,30,97,100,
+    100,115,105,116,101,100,105,114,46,60,108,111,99,97,108,115,
+    62,46,60,108,105,115,116,99,111,109,112,62,41,11,114,32,
+    0,0,0,114,10,0,0,0,114,14,0,0,0,114,3,0,
+    0,0,114,23,0,0,0,114,24,0,0,0,114,2,0,0,
+    0,90,7,108,105,115,116,100,105,114,114,6,0,0,0,218,
+    6,115,111,114,116,101,100,114,54,0,0,0,41,6,114,48,
+    0,0,0,114,26,0,0,0,114,50,0,0,0,90,11,115,
+    105,116,101,100,105,114,99,97,115,101,90,5,110,97,109,101,
+    115,114,49,0,0,0,114,8,0,0,0,114,8,0,0,0,
+    114,9,0,0,0,218,10,97,100,100,115,105,116,101,100,105,
+    114,189,0,0,0,115,36,0,0,0,0,3,8,1,6,1,
+    6,2,4,1,12,1,8,1,12,1,10,1,2,1,14,1,
+    14,1,8,1,14,1,12,1,14,1,4,1,4,1,114,59,
+    0,0,0,99,0,0,0,0,0,0,0,0,0,0,0,0,
+    3,0,0,0,67,0,0,0,115,96,0,0,0,116,0,106,
+    1,106,2,114,12,100,1,83,0,116,3,116,4,100,2,131,
+    2,114,52,116,3,116,4,100,3,131,2,114,52,116,4,160,
+    5,161,0,116,4,160,6,161,0,107,3,114,52,100,4,83,
+    0,116,3,116,4,100,5,131,2,114,92,116,3,116,4,100,
+    6,131,2,114,92,116,4,160,7,161,0,116,4,160,8,161,
+    0,107,3,114,92,100,4,83,0,100,7,83,0,41,8,97,
+    44,1,0,0,67,104,101,99,107,32,105,102,32,117,115,101,
+    114,32,115,105,116,101,32,100,105,114,101,99,116,111,114,121,
+    32,105,115,32,115,97,102,101,32,102,111,114,32,105,110,99,
+    108,117,115,105,111,110,10,10,32,32,32,32,84,104,101,32,
+    102,117,110,99,116,105,111,110,32,116,101,115,116,115,32,102,
+    111,114,32,116,104,101,32,99,111,109,109,97,110,100,32,108,
+    105,110,101,32,102,108,97,103,32,40,105,110,99,108,117,100,
+    105,110,103,32,101,110,118,105,114,111,110,109,101,110,116,32,
+    118,97,114,41,44,10,32,32,32,32,112,114,111,99,101,115,
+    115,32,117,105,100,47,103,105,100,32,101,113,117,97,108,32,
+    116,111,32,101,102,102,101,99,116,105,118,101,32,117,105,100,
+    47,103,105,100,46,10,10,32,32,32,32,78,111,110,101,58,
+    32,68,105,115,97,98,108,101,100,32,102,111,114,32,115,101,
+    99,117,114,105,116,121,32,114,101,97,115,111,110,115,10,32,
+    32,32,32,70,97,108,115,101,58,32,68,105,115,97,98,108,
+    101,100,32,98,121,32,117,115,101,114,32,40,99,111,109,109,
+    97,110,100,32,108,105,110,101,32,111,112,116,105,111,110,41,
+    10,32,32,32,32,84,114,117,101,58,32,83,97,102,101,32,
+    97,110,100,32,101,110,97,98,108,101,100,10,32,32,32,32,
+    70,218,6,103,101,116,117,105,100,218,7,103,101,116,101,117,
+    105,100,78,218,6,103,101,116,103,105,100,218,7,103,101,116,
+    101,103,105,100,84,41,9,114,14,0,0,0,218,5,102,108,
+    97,103,115,218,12,110,111,95,117,115,101,114,95,115,105,116,
+    101,218,7,104,97,115,97,116,116,114,114,2,0,0,0,114,
+    61,0,0,0,114,60,0,0,0,114,63,0,0,0,114,62,
+    0,0,0,114,8,0,0,0,114,8,0,0,0,114,8,0,
+    0,0,114,9,0,0,0,218,20,99,104,101,99,107,95,101,
+    110,97,98,108,101,117,115,101,114,115,105,116,101,213,0,0,
+    0,115,18,0,0,0,0,10,8,1,4,2,20,2,16,1,
+    4,1,20,2,16,1,4,2,114,67,0,0,0,99,0,0,
+    0,0,0,0,0,0,3,0,0,0,8,0,0,0,67,0,
+    0,0,115,122,0,0,0,116,0,106,1,160,2,100,1,100,
+    0,161,2,125,0,124,0,114,22,124,0,83,0,100,2,100,
+    3,132,0,125,1,116,0,106,3,100,4,107,2,114,66,116,
+    0,106,1,160,2,100,5,161,1,112,54,100,6,125,2,124,
+    1,124,2,100,7,131,2,83,0,116,4,106,5,100,8,107,
+    2,114,112,116,4,106,6,114,112,124,1,100,6,100,9,116,
+    4,106,6,100,10,116,4,106,7,100,0,100,11,133,2,25,
+    0,22,0,131,4,83,0,124,1,100,6,100,12,131,2,83,
+    0,41,13,78,90,14,80,89,84,72,79,78,85,83,69,82,
+    66,65,83,69,99,0,0,0,0,0,0,0,0,1,0,0,
+    0,4,0,0,0,87,0,0,0,115,20,0,0,0,116,0,
+    106,1,160,2,116,0,106,1,106,3,124,0,142,0,161,1,
+    83,0,114,1,0,0,0,41,4,114,2,0,0,0,114,3,
+    0,0,0,218,10,101,120,112,97,110,100,117,115,101,114,114,
+    4,0,0,0,41,1,218,4,97,114,103,115,114,8,0,0,
+    0,114,8,0,0,0,114,9,0,0,0,218,8,106,111,105,
+    110,117,115,101,114,250,0,0,0,115,2,0,0,0,0,1,
+    122,30,95,103,101,116,117,115,101,114,98,97,115,101,46,60,
+    108,111,99,97,108,115,62,46,106,111,105,110,117,115,101,114,
+    218,2,110,116,90,7,65,80,80,68,65,84,65,250,1,126,
+    90,6,80,121,116,104,111,110,218,6,100,97,114,119,105,110,
+    90,7,76,105,98,114,97,114,121,122,5,37,100,46,37,100,
+    233,2,0,0,0,122,6,46,108,111,99,97,108,41,8,114,
+    2,0,0,0,218,7,101,110,118,105,114,111,110,218,3,103,
+    101,116,114,49,0,0,0,114,14,0,0,0,218,8,112,108,
+    97,116,102,111,114,109,218,10,95,102,114,97,109,101,119,111,
+    114,107,218,12,118,101,114,115,105,111,110,95,105,110,102,111,
+    41,3,90,8,101,110,118,95,98,97,115,101,114,70,0,0,
+    0,90,4,98,97,115,101,114,8,0,0,0,114,8,0,0,
+    0,114,9,0,0,0,218,12,95,103,101,116,117,115,101,114,
+    98,97,115,101,245,0,0,0,115,24,0,0,0,0,1,14,
+    1,4,1,4,2,8,3,10,1,16,1,10,2,16,1,10,
+    1,16,255,4,3,114,80,0,0,0,99,1,0,0,0,0,
+    0,0,0,2,0,0,0,6,0,0,0,67,0,0,0,115,
+    100,0,0,0,116,0,106,1,125,1,116,2,106,3,100,1,
+    107,2,114,44,124,0,155,0,100,2,124,1,100,3,25,0,
+    155,0,124,1,100,4,25,0,155,0,100,5,157,5,83,0,
+    116,0,106,4,100,6,107,2,114,70,116,0,106,5,114,70,
+    124,0,155,0,100,7,157,2,83,0,124,0,155,0,100,8,
+    124,1,100,3,25,0,155,0,100,9,124,1,100,4,25,0,
+    155,0,100,10,157,6,83,0,41,11,78,114,71,0,0,0,
+    122,7,92,80,121,116,104,111,110,114,0,0,0,0,114,35,
+    0,0,0,122,14,92,115,105,116,101,45,112,97,99,107,97,
+    103,101,115,114,73,0,0,0,122,25,47,108,105,98,47,112,
+    121,116,104,111,110,47,115,105,116,101,45,112,97,99,107,97,
+    103,101,115,122,11,47,108,105,98,47,112,121,116,104,111,110,
+    218,1,46,122,14,47,115,105,116,101,45,112,97,99,107,97,
+    103,101,115,41,6,114,14,0,0,0,114,79,0,0,0,114,
+    2,0,0,0,114,49,0,0,0,114,77,0,0,0,114,78,
+    0,0,0,41,2,218,8,117,115,101,114,98,97,115,101,218,
+    7,118,101,114,115,105,111,110,114,8,0,0,0,114,8,0,
+    0,0,114,9,0,0,0,218,9,95,103,101,116,95,112,97,
+    116,104,9,1,0,0,115,12,0,0,0,0,1,6,2,10,
+    1,28,2,16,1,10,2,114,84,0,0,0,99,0,0,0,
+    0,0,0,0,0,0,0,0,0,2,0,0,0,67,0,0,
+    0,115,18,0,0,0,116,0,100,1,107,8,114,14,116,1,
+    131,0,97,0,116,0,83,0,41,2,122,203,82,101,116,117,
+    114,110,115,32,116,104,101,32,96,117,115,101,114,32,98,97,
+    115,101,96,32,100,105,114,101,99,116,111,114,121,32,112,97,
+    116,104,46,10,10,32,32,32,32,84,104,101,32,96,117,115,
+    101,114,32,98,97,115,101,96,32,100,105,114,101,99,116,111,
+    114,121,32,99,97,110,32,98,101,32,117,115,101,100,32,116,
+    111,32,115,116,111,114,101,32,100,97,116,97,46,32,73,102,
+    32,116,104,101,32,103,108,111,98,97,108,10,32,32,32,32,
+    118,97,114,105,97,98,108,101,32,96,96,85,83,69,82,95,
+    66,65,83,69,96,96,32,105,115,32,110,111,116,32,105,110,
+    105,116,105,97,108,105,122,101,100,32,121,101,116,44,32,116,
+    104,105,115,32,102,117,110,99,116,105,111,110,32,119,105,108,
+    108,32,97,108,115,111,32,115,101,116,10,32,32,32,32,105,
+    116,46,10,32,32,32,32,78,41,2,218,9,85,83,69,82,
+    95,66,65,83,69,114,80,0,0,0,114,8,0,0,0,114,
+    8,0,0,0,114,8,0,0,0,114,9,0,0,0,218,11,
+    103,101,116,117,115,101,114,98,97,115,101,21,1,0,0,115,
+    6,0,0,0,0,8,8,1,6,1,114,86,0,0,0,99,
+    0,0,0,0,0,0,0,0,1,0,0,0,2,0,0,0,
+    67,0,0,0,115,26,0,0,0,116,0,131,0,125,0,116,
+    1,100,1,107,8,114,22,116,2,124,0,131,1,97,1,116,
+    1,83,0,41,2,122,162,82,101,116,117,114,110,115,32,116,
+    104,101,32,117,115,101,114,45,115,112,101,99,105,102,105,99,
+    32,115,105,116,101,45,112,97,99,107,97,103,101,115,32,100,
+    105,114,101,99,116,111,114,121,32,112,97,116,104,46,10,10,
+    32,32,32,32,73,102,32,116,104,101,32,103,108,111,98,97,
+    108,32,118,97,114,105,97,98,108,101,32,96,96,85,83,69,
+    82,95,83,73,84,69,96,96,32,105,115,32,110,111,116,32,
+    105,110,105,116,105,97,108,105,122,101,100,32,121,101,116,44,
+    32,116,104,105,115,10,32,32,32,32,102,117,110,99,116,105,
+    111,110,32,119,105,108,108,32,97,108,115,111,32,115,101,116,
+    32,105,116,46,10,32,32,32,32,78,41,3,114,86,0,0,
+    0,218,9,85,83,69,82,95,83,73,84,69,114,84,0,0,
+    0,41,1,114,82,0,0,0,114,8,0,0,0,114,8,0,
+    0,0,114,9,0,0,0,218,19,103,101,116,117,115,101,114,
+    115,105,116,101,112,97,99,107,97,103,101,115,34,1,0,0,
+    115,8,0,0,0,0,7,6,2,8,1,8,2,114,88,0,
+    0,0,99,1,0,0,0,0,0,0,0,2,0,0,0,3,
+    0,0,0,67,0,0,0,115,36,0,0,0,116,0,131,0,
+    125,1,116,1,114,32,116,2,106,3,160,4,124,1,161,1,
+    114,32,116,5,124,1,124,0,131,2,1,0,124,0,83,0,
+    41,1,122,134,65,100,100,32,97,32,112,101,114,32,117,115,
+    101,114,32,115,105,116,101,45,112,97,99,107,97,103,101,32,
+    116,111,32,115,121,115,46,112,97,116,104,10,10,32,32,32,
+    32,69,97,99,104,32,117,115,101,114,32,104,97,115,32,105,
+    116,115,32,111,119,110,32,112,121,116,104,111,110,32,100,105,
+    114,101,99,116,111,114,121,32,119,105,116,104,32,115,105,116,
+    101,45,112,97,99,107,97,103,101,115,32,105,110,32,116,104,
+    101,10,32,32,32,32,104,111,109,101,32,100,105,114,101,99,
+    116,111,114,121,46,10,32,32,32,32,41,6,114,88,0,0,
+    0,218,16,69,78,65,66,76,69,95,85,83,69,82,95,83,
+    73,84,69,114,2,0,0,0,114,3,0,0,0,218,5,105,
+    115,100,105,114,114,59,0,0,0,41,2,114,26,0,0,0,
+    218,9,117,115,101,114,95,115,105,116,101,114,8,0,0,0,
+    114,8,0,0,0,114,9,0,0,0,218,19,97,100,100,117,
+    115,101,114,115,105,116,101,112,97,99,107,97,103,101,115,48,
+    1,0,0,115,8,0,0,0,0,8,6,2,16,1,10,1,
+    114,92,0,0,0,99,1,0,0,0,0,0,0,0,4,0,
+    0,0,11,0,0,0,67,0,0,0,115,142,0,0,0,103,
+    0,125,1,116,0,131,0,125,2,124,0,100,1,107,8,114,
+    22,116,1,125,0,124,0,68,0,93,110,125,3,124,3,114,
+    26,124,3,124,2,107,6,114,44,113,26,124,2,160,2,124,
+    3,161,1,1,0,116,3,106,4,100,2,107,2,114,104,124,
+    1,160,5,116,3,106,6,160,7,124,3,100,3,100,4,116,
+    8,106,9,100,1,100,5,133,2,25,0,22,0,100,6,161,
+    4,161,1,1,0,113,26,124,1,160,5,124,3,161,1,1,
+    0,124,1,160,5,116,3,106,6,160,7,124,3,100,3,100,
+    6,161,3,161,1,1,0,113,26,124,1,83,0,41,7,97,
+    30,1,0,0,82,101,116,117,114,110,115,32,97,32,108,105,
+    115,116,32,99,111,110,116,97,105,110,105,110,103,32,97,108,
+    108,32,103,108,111,98,97,108,32,115,105,116,101,45,112,97,
+    99,107,97,103,101,115,32,100,105,114,101,99,116,111,114,105,
+    101,115,46,10,10,32,32,32,32,70,111,114,32,101,97,99,
+    104,32,100,105,114,101,99,116,111,114,121,32,112,114,101,115,
+    101,110,116,32,105,110,32,96,96,112,114,101,102,105,120,101,
+    115,96,96,32,40,111,114,32,116,104,101,32,103,108,111,98,
+    97,108,32,96,96,80,82,69,70,73,88,69,83,96,96,41,
+    44,10,32,32,32,32,116,104,105,115,32,102,117,110,99,116,
+    105,111,110,32,119,105,108,108,32,102,105,110,100,32,105,116,
+    115,32,96,115,105,116,101,45,112,97,99,107,97,103,101,115,
+    96,32,115,117,98,100,105,114,101,99,116,111,114,121,32,100,
+    101,112,101,110,100,105,110,103,32,111,110,32,116,104,101,10,
+    32,32,32,32,115,121,115,116,101,109,32,101,110,118,105,114,
+    111,110,109,101,110,116,44,32,97,110,100,32,119,105,108,108,
+    32,114,101,116,117,114,110,32,97,32,108,105,115,116,32,111,
+    102,32,102,117,108,108,32,112,97,116,104,115,46,10,32,32,
+    32,32,78,250,1,47,90,3,108,105,98,122,11,112,121,116,
+    104,111,110,37,100,46,37,100,114,74,0,0,0,122,13,115,
+    105,116,101,45,112,97,99,107,97,103,101,115,41,10,114,13,
+    0,0,0,218,8,80,82,69,70,73,88,69,83,114,24,0,
+    0,0,114,2,0,0,0,218,3,115,101,112,114,23,0,0,
+    0,114,3,0,0,0,114,4,0,0,0,114,14,0,0,0,
+    114,79,0,0,0,41,4,218,8,112,114,101,102,105,120,101,
+    115,90,12,115,105,116,101,112,97,99,107,97,103,101,115,90,
+    4,115,101,101,110,218,6,112,114,101,102,105,120,114,8,0,
+    0,0,114,8,0,0,0,114,9,0,0,0,218,15,103,101,
+    116,115,105,116,101,112,97,99,107,97,103,101,115,62,1,0,
+    0,115,32,0,0,0,0,7,4,1,6,2,8,1,4,2,
+    8,1,12,1,2,1,10,2,10,1,14,1,16,1,2,254,
+    8,4,10,1,24,1,114,98,0,0,0,99,2,0,0,0,
+    0,0,0,0,3,0,0,0,4,0,0,0,67,0,0,0,
+    115,40,0,0,0,116,0,124,1,131,1,68,0,93,26,125,
+    2,116,1,106,2,160,3,124,2,161,1,114,8,116,4,124,
+    2,124,0,131,2,1,0,113,8,124,0,83,0,41,1,122,
+    29,65,100,100,32,115,105,116,101,45,112,97,99,107,97,103,
+    101,115,32,116,111,32,115,121,115,46,112,97,116,104,41,5,
+    114,98,0,0,0,114,2,0,0,0,114,3,0,0,0,114,
+    90,0,0,0,114,59,0,0,0,41,3,114,26,0,0,0,
+    114,96,0,0,0,114,48,0,0,0,114,8,0,0,0,114,
+    8,0,0,0,114,9,0,0,0,218,15,97,100,100,115,105,
+    116,101,112,97,99,107,97,103,101,115,89,1,0,0,115,8,
+    0,0,0,0,2,12,1,12,1,12,2,114,99,0,0,0,
+    99,0,0,0,0,0,0,0,0,1,0,0,0,4,0,0,
+    0,67,0,0,0,115,52,0,0,0,116,0,106,1,100,1,
+    107,2,114,16,100,2,125,0,110,4,100,3,125,0,116,2,
+    160,3,100,4,124,0,161,2,116,4,95,5,116,2,160,3,
+    100,5,124,0,161,2,116,4,95,6,100,6,83,0,41,7,
+    122,173,68,101,102,105,110,101,32,110,101,119,32,98,117,105,
+    108,116,105,110,115,32,39,113,117,105,116,39,32,97,110,100,
+    32,39,101,120,105,116,39,46,10,10,32,32,32,32,84,104,
+    101,115,101,32,97,114,101,32,111,98,106,101,99,116,115,32,
+    119,104,105,99,104,32,109,97,107,101,32,116,104,101,32,105,
+    110,116,101,114,112,114,101,116,101,114,32,101,120,105,116,32,
+    119,104,101,110,32,99,97,108,108,101,100,46,10,32,32,32,
+    32,84,104,101,32,114,101,112,114,32,111,102,32,101,97,99,
+    104,32,111,98,106,101,99,116,32,99,111,110,116,97,105,110,
+    115,32,97,32,104,105,110,116,32,97,116,32,104,111,119,32,
+    105,116,32,119,111,114,107,115,46,10,10,32,32,32,32,250,
+    1,92,122,18,67,116,114,108,45,90,32,112,108,117,115,32,
+    82,101,116,117,114,110,122,17,67,116,114,108,45,68,32,40,
+    105,46,101,46,32,69,79,70,41,218,4,113,117,105,116,218,
+    4,101,120,105,116,78,41,7,114,2,0,0,0,114,95,0,
+    0,0,218,13,95,115,105,116,101,98,117,105,108,116,105,110,
+    115,90,7,81,117,105,116,116,101,114,218,8,98,117,105,108,
+    116,105,110,115,114,101,0,0,0,114,102,0,0,0,41,1,
+    90,3,101,111,102,114,8,0,0,0,114,8,0,0,0,114,
+    9,0,0,0,218,7,115,101,116,113,117,105,116,97,1,0,
+    0,115,10,0,0,0,0,7,10,1,6,2,4,2,14,1,
+    114,105,0,0,0,99,0,0,0,0,0,0,0,0,3,0,
+    0,0,6,0,0,0,67,0,0,0,115,164,0,0,0,116,
+    0,160,1,100,1,116,2,106,3,161,2,116,4,95,3,116,
+    2,106,5,100,2,100,3,133,2,25,0,100,4,107,2,114,
+    50,116,0,160,1,100,5,100,6,161,2,116,4,95,6,110,
+    14,116,0,160,1,100,5,100,7,161,2,116,4,95,6,103,
+    0,103,0,2,0,125,0,125,1,116,7,116,8,100,8,131,
+    2,114,142,116,8,106,9,160,10,116,8,106,11,161,1,125,
+    2,124,0,160,12,100,9,100,10,103,2,161,1,1,0,124,
+    1,160,12,116,8,106,9,160,13,124,2,116,8,106,14,161,
+    2,124,2,116,8,106,15,103,3,161,1,1,0,116,0,160,
+    1,100,11,100,12,124,0,124,1,161,4,116,4,95,16,100,
+    2,83,0,41,13,122,41,83,101,116,32,39,99,111,112,121,
+    114,105,103,104,116,39,32,97,110,100,32,39,99,114,101,100,
+    105,116,115,39,32,105,110,32,98,117,105,108,116,105,110,115,
+    218,9,99,111,112,121,114,105,103,104,116,78,233,4,0,0,
+    0,90,4,106,97,118,97,218,7,99,114,101,100,105,116,115,
+    122,63,74,121,116,104,111,110,32,105,115,32,109,97,105,110,
+    116,97,105,110,101,100,32,98,121,32,116,104,101,32,74,121,
+    116,104,111,110,32,100,101,118,101,108,111,112,101,114,115,32,
+    40,119,119,119,46,106,121,116,104,111,110,46,111,114,103,41,
+    46,122,158,32,32,32,32,84,104,97,110,107,115,32,116,111,
+    32,67,87,73,44,32,67,78,82,73,44,32,66,101,79,112,
+    101,110,46,99,111,109,44,32,90,111,112,101,32,67,111,114,
+    112,111,114,97,116,105,111,110,32,97,110,100,32,97,32,99,
+    97,115,116,32,111,102,32,116,104,111,117,115,97,110,100,115,
+    10,32,32,32,32,102,111,114,32,115,117,112,112,111,114,116,
+    105,110,103,32,80,121,116,104,111,110,32,100,101,118,101,108,
+    111,112,109,101,110,116,46,32,32,83,101,101,32,119,119,119,
+    46,112,121,116,104,111,110,46,111,114,103,32,102,111,114,32,
+    109,111,114,101,32,105,110,102,111,114,109,97,116,105,111,110,
+    46,114,18,0,0,0,122,11,76,73,67,69,78,83,69,46,
+    116,120,116,90,7,76,73,67,69,78,83,69,218,7,108,105,
+    99,101,110,115,101,122,39,83,101,101,32,104,116,116,112,115,
+    58,47,47,119,119,119,46,112,121,116,104,111,110,46,111,114,
+    103,47,112,115,102,47,108,105,99,101,110,115,101,47,41,17,
+    114,103,0,0,0,90,8,95,80,114,105,110,116,101,114,114,
+    14,0,0,0,114,106,0,0,0,114,104,0,0,0,114,77,
+    0,0,0,114,108,0,0,0,114,66,0,0,0,114,2,0,
+    0,0,114,3,0,0,0,218,7,100,105,114,110,97,109,101,
+    114,18,0,0,0,218,6,101,120,116,101,110,100,114,4,0,
+    0,0,90,6,112,97,114,100,105,114,90,6,99,117,114,100,
+    105,114,114,109,0,0,0,41,3,90,5,102,105,108,101,115,
+    90,4,100,105,114,115,90,4,104,101,114,101,114,8,0,0,
+    0,114,8,0,0,0,114,9,0,0,0,218,12,115,101,116,
+    99,111,112,121,114,105,103,104,116,113,1,0,0,115,36,0,
+    0,0,0,2,16,1,18,1,4,1,2,1,2,254,8,4,
+    14,3,10,3,10,1,14,1,14,1,30,1,4,1,2,1,
+    2,1,2,0,2,253,114,112,0,0,0,99,0,0,0,0,
+    0,0,0,0,0,0,0,0,2,0,0,0,67,0,0,0,
+    115,14,0,0,0,116,0,160,1,161,0,116,2,95,3,100,
+    0,83,0,114,1,0,0,0,41,4,114,103,0,0,0,90,
+    7,95,72,101,108,112,101,114,114,104,0,0,0,218,4,104,
+    101,108,112,114,8,0,0,0,114,8,0,0,0,114,8,0,
+    0,0,114,9,0,0,0,218,9,115,101,116,104,101,108,112,
+    101,114,137,1,0,0,115,2,0,0,0,0,1,114,114,0,
+    0,0,99,0,0,0,0,0,0,0,0,1,0,0,0,2,
+    0,0,0,67,0,0,0,115,18,0,0,0,100,1,100,2,
+    132,0,125,0,124,0,116,0,95,1,100,3,83,0,41,4,
+    97,106,1,0,0,69,110,97,98,108,101,32,100,101,102,97,
+    117,108,116,32,114,101,97,100,108,105,110,101,32,99,111,110,
+    102,105,103,117,114,97,116,105,111,110,32,111,110,32,105,110,
+    116,101,114,97,99,116,105,118,101,32,112,114,111,109,112,116,
+    115,44,32,98,121,10,32,32,32,32,114,101,103,105,115,116,
+    101,114,105,110,103,32,97,32,115,121,115,46,95,95,105,110,
+    116,101,114,97,99,116,105,118,101,104,111,111,107,95,95,46,
+    10,10,32,32,32,32,73,102,32,116,104,101,32,114,101,97,
+    100,108,105,110,101,32,109,111,100,117,108,101,32,99,97,110,
+    32,98,101,32,105,109,112,111,114,116,101,100,44,32,116,104,
+    101,32,104,111,111,107,32,119,105,108,108,32,115,101,116,32,
+    116,104,101,32,84,97,98,32,107,101,121,10,32,32,32,32,
+    97,115,32,99,111,109,112,108,101,116,105,111,110,32,107,101,
+    121,32,97,110,100,32,114,101,103,105,115,116,101,114,32,126,
+    47,46,112,121,116,104,111,110,95,104,105,115,116,111,114,121,
+    32,97,115,32,104,105,115,116,111,114,121,32,102,105,108,101,
+    46,10,32,32,32,32,84,104,105,115,32,99,97,110,32,98,
+    101,32,111,118,101,114,114,105,100,100,101,110,32,105,110,32,
+    116,104,101,32,115,105,116,101,99,117,115,116,111,109,105,122,
+    101,32,111,114,32,117,115,101,114,99,117,115,116,111,109,105,
+    122,101,32,109,111,100,117,108,101,44,10,32,32,32,32,111,
+    114,32,105,110,32,97,32,80,89,84,72,79,78,83,84,65,
+    82,84,85,80,32,102,105,108,101,46,10,32,32,32,32,99,
+    0,0,0,0,0,0,0,0,4,0,0,0,8,0,0,0,
+    19,0,0,0,115,238,0,0,0,100,1,100,0,108,0,125,
+    0,122,20,100,1,100,0,108,1,137,1,100,1,100,0,108,
+    2,125,1,87,0,110,26,4,0,116,3,107,10,114,54,1,
+    0,1,0,1,0,89,0,100,0,83,0,89,0,110,2,88,
+    0,116,4,136,1,100,2,100,3,131,3,125,2,124,2,100,
+    0,107,9,114,96,100,4,124,2,107,6,114,96,136,1,160,
+    5,100,5,161,1,1,0,110,10,136,1,160,5,100,6,161,
+    1,1,0,122,12,136,1,160,6,161,0,1,0,87,0,110,
+    20,4,0,116,7,107,10,114,138,1,0,1,0,1,0,89,
+    0,110,2,88,0,136,1,160,8,161,0,100,1,107,2,114,
+    234,116,9,106,10,160,11,116,9,106,10,160,12,100,7,161,
+    1,100,8,161,2,137,0,122,14,136,1,160,13,136,0,161,
+    1,1,0,87,0,110,20,4,0,116,7,107,10,114,208,1,
+    0,1,0,1,0,89,0,110,2,88,0,135,0,135,1,102,
+    2,100,9,100,10,132,8,125,3,124,0,160,14,124,3,161,
+    1,1,0,100,0,83,0,41,11,78,114,0,0,0,0,218,
+    7,95,95,100,111,99,95,95,218,0,90,7,108,105,98,101,
+    100,105,116,122,19,98,105,110,100,32,94,73,32,114,108,95,
+    99,111,109,112,108,101,116,101,122,13,116,97,98,58,32,99,
+    111,109,112,108,101,116,101,114,72,0,0,0,122,15,46,112,
+    121,116,104,111,110,95,104,105,115,116,111,114,121,99,0,0,
+    0,0,0,0,0,0,0,0,0,0,9,0,0,0,19,0,
+    0,0,115,44,0,0,0,122,14,136,1,160,0,136,0,161,
+    1,1,0,87,0,110,24,4,0,116,1,116,2,102,2,107,
+    10,114,38,1,0,1,0,1,0,89,0,110,2,88,0,100,
+    0,83,0,114,1,0,0,0,41,3,90,18,119,114,105,116,
+    101,95,104,105,115,116,111,114,121,95,102,105,108,101,218,17,
+    70,105,108,101,78,111,116,70,111,117,110,100,69,114,114,111,
+    114,218,15,80,101,114,109,105,115,115,105,111,110,69,114,114,
+    111,114,114,8,0,0,0,169,2,90,7,104,105,115,116,111,
+    114,121,218,8,114,101,97,100,108,105,110,101,114,8,0,0,
+    0,114,9,0,0,0,218,13,119,114,105,116,101,95,104,105,
+    115,116,111,114,121,187,1,0,0,115,8,0,0,0,0,1,
+    2,1,14,1,18,3,122,67,101,110,97,98,108,101,114,108,
+    99,111,109,112,108,101,116,101,114,46,60,108,111,99,97,108,
+    115,62,46,114,101,103,105,115,116,101,114,95,114,101,97,100,
+    108,105,110,101,46,60,108,111,99,97,108,115,62,46,119,114,
+    105,116,101,95,104,105,115,116,111,114,121,41,15,218,6,97,
+    116,101,120,105,116,114,120,0,0,0,218,11,114,108,99,111,
+    109,112,108,101,116,101,114,218,11,73,109,112,111,114,116,69,
+    114,114,111,114,114,17,0,0,0,90,14,112,97,114,115,101,
+    95,97,110,100,95,98,105,110,100,90,14,114,101,97,100,95,
+    105,110,105,116,95,102,105,108,101,114,6,0,0,0,90,26,
+    103,101,116,95,99,117,114,114,101,110,116,95,104,105,115,116,
+    111,114,121,95,108,101,110,103,116,104,114,2,0,0,0,114,
+    3,0,0,0,114,4,0,0,0,114,68,0,0,0,90,17,
+    114,101,97,100,95,104,105,115,116,111,114,121,95,102,105,108,
+    101,90,8,114,101,103,105,115,116,101,114,41,4,114,122,0,
+    0,0,114,123,0,0,0,90,12,114,101,97,100,108,105,110,
+    101,95,100,111,99,114,121,0,0,0,114,8,0,0,0,114,
+    119,0,0,0,114,9,0,0,0,218,17,114,101,103,105,115,
+    116,101,114,95,114,101,97,100,108,105,110,101,149,1,0,0,
+    115,48,0,0,0,0,1,8,1,2,1,8,1,12,1,14,
+    1,12,4,12,1,16,1,12,2,10,2,2,1,12,1,14,
+    5,6,2,12,6,16,1,2,255,4,2,2,1,14,1,14,
+    1,6,2,14,8,122,44,101,110,97,98,108,101,114,108,99,
+    111,109,112,108,101,116,101,114,46,60,108,111,99,97,108,115,
+    62,46,114,101,103,105,115,116,101,114,95,114,101,97,100,108,
+    105,110,101,78,41,2,114,14,0,0,0,90,19,95,95,105,
+    110,116,101,114,97,99,116,105,118,101,104,111,111,107,95,95,
+    41,1,114,125,0,0,0,114,8,0,0,0,114,8,0,0,
+    0,114,9,0,0,0,218,17,101,110,97,98,108,101,114,108,
+    99,111,109,112,108,101,116,101,114,140,1,0,0,115,4,0,
+    0,0,0,9,8,48,114,126,0,0,0,99,1,0,0,0,
+    0,0,0,0,15,0,0,0,9,0,0,0,67,0,0,0,
+    115,132,1,0,0,116,0,106,1,125,1,116,2,106,3,100,
+    1,107,2,114,42,100,2,124,1,107,6,114,42,116,0,106,
+    1,100,2,25,0,4,0,125,2,116,2,95,4,110,60,116,
+    2,106,3,100,3,107,2,114,96,100,2,124,1,107,6,114,
+    96,116,2,106,5,125,2,100,4,100,0,108,6,125,3,124,
+    3,160,7,100,4,161,1,116,2,95,4,116,0,106,1,100,
+    2,61,0,110,6,116,2,106,5,125,2,116,0,106,8,160,
+    9,116,0,106,8,160,10,124,2,161,1,161,1,92,2,125,
+    4,125,5,116,0,106,8,160,11,124,4,161,1,125,6,100,
+    0,116,2,95,12,100,5,125,7,100,6,100,7,132,0,116,
+    0,106,8,160,13,124,4,124,7,161,2,116,0,106,8,160,
+    13,124,6,124,7,161,2,102,2,68,0,131,1,125,8,124,
+    8,144,1,114,128,124,8,100,4,25,0,125,9,100,8,125,
+    10,116,14,124,9,100,9,100,10,141,2,143,98,125,11,124,
+    11,68,0,93,86,125,12,100,11,124,12,107,6,144,1,114,
+    52,124,12,160,15,100,11,161,1,92,3,125,13,125,5,125,
+    14,124,13,160,16,161,0,160,17,161,0,125,13,124,14,160,
+    16,161,0,125,14,124,13,100,12,107,2,144,1,114,36,124,
+    14,160,17,161,0,125,10,110,16,124,13,100,13,107,2,144,
+    1,114,52,124,14,116,2,95,12,113,222,87,0,53,0,81,
+    0,82,0,88,0,124,6,4,0,116,2,95,18,116,2,95,
+    19,116,20,124,0,116,2,106,18,103,1,131,2,1,0,124,
+    10,100,8,107,2,144,1,114,116,116,21,160,22,100,4,116,
+    2,106,18,161,2,1,0,110,12,116,2,106,18,103,1,97,
+    21,100,14,97,23,124,0,83,0,41,15,78,114,73,0,0,
+    0,90,19,95,95,80,89,86,69,78,86,95,76,65,85,78,
+    67,72,69,82,95,95,90,5,119,105,110,51,50,114,0,0,
+    0,0,122,10,112,121,118,101,110,118,46,99,102,103,99,1,
+    0,0,0,0,0,0,0,2,0,0,0,5,0,0,0,83,
+    0,0,0,115,28,0,0,0,103,0,124,0,93,20,125,1,
+    116,0,106,1,160,2,124,1,161,1,114,4,124,1,145,2,
+    113,4,83,0,114,8,0,0,0,41,3,114,2,0,0,0,
+    114,3,0,0,0,90,6,105,115,102,105,108,101,41,2,114,
+    56,0,0,0,90,8,99,111,110,102,102,105,108,101,114,8,
+    0,0,0,114,8,0,0,0,114,9,0,0,0,114,57,0,
+    0,0,218,1,0,0,115,6,0,0,0,6,1,2,4,12,
+    252,122,24,118,101,110,118,46,60,108,111,99,97,108,115,62,
+    46,60,108,105,115,116,99,111,109,112,62,90,4,116,114,117,
+    101,122,5,117,116,102,45,56,41,1,218,8,101,110,99,111,
+    100,105,110,103,250,1,61,122,28,105,110,99,108,117,100,101,
+    45,115,121,115,116,101,109,45,115,105,116,101,45,112,97,99,
+    107,97,103,101,115,90,4,104,111,109,101,70,41,24,114,2,
+    0,0,0,114,75,0,0,0,114,14,0,0,0,114,77,0,
+    0,0,90,16,95,98,97,115,101,95,101,120,101,99,117,116,
+    97,98,108,101,218,10,101,120,101,99,117,116,97,98,108,101,
+    218,7,95,119,105,110,97,112,105,90,17,71,101,116,77,111,
+    100,117,108,101,70,105,108,101,78,97,109,101,114,3,0,0,
+    0,218,5,115,112,108,105,116,114,5,0,0,0,114,110,0,
+    0,0,90,5,95,104,111,109,101,114,4,0,0,0,114,36,
+    0,0,0,218,9,112,97,114,116,105,116,105,111,110,218,5,
+    115,116,114,105,112,218,5,108,111,119,101,114,114,97,0,0,
+    0,218,11,101,120,101,99,95,112,114,101,102,105,120,114,99,
+    0,0,0,114,94,0,0,0,218,6,105,110,115,101,114,116,
+    114,89,0,0,0,41,15,114,26,0,0,0,90,3,101,110,
+    118,114,129,0,0,0,114,130,0,0,0,90,7,101,120,101,
+    95,100,105,114,114,31,0,0,0,90,11,115,105,116,101,95,
+    112,114,101,102,105,120,90,13,99,111,110,102,95,98,97,115,
+    101,110,97,109,101,90,15,99,97,110,100,105,100,97,116,101,
+    95,99,111,110,102,115,90,12,118,105,114,116,117,97,108,95,
+    99,111,110,102,90,11,115,121,115,116,101,109,95,115,105,116,
+    101,114,51,0,0,0,114,53,0,0,0,90,3,107,101,121,
+    218,5,118,97,108,117,101,114,8,0,0,0,114,8,0,0,
+    0,114,9,0,0,0,218,4,118,101,110,118,199,1,0,0,
+    115,76,0,0,0,0,3,6,1,18,1,18,1,18,1,6,
+    1,8,1,12,3,10,2,6,1,24,1,12,1,6,1,4,
+    1,6,2,12,1,12,254,2,255,6,8,6,1,8,1,4,
+    3,14,1,8,1,10,1,16,1,12,1,8,1,10,1,10,
+    1,10,1,18,2,12,3,14,4,10,1,16,2,8,1,4,
+    2,114,138,0,0,0,99,0,0,0,0,0,0,0,0,3,
+    0,0,0,10,0,0,0,67,0,0,0,115,154,0,0,0,
+    122,66,122,12,100,1,100,2,108,0,125,0,87,0,110,48,
+    4,0,116,1,107,10,114,62,1,0,125,1,1,0,122,18,
+    124,1,106,2,100,3,107,2,114,44,110,2,130,0,87,0,
+    53,0,100,2,125,1,126,1,88,0,89,0,110,2,88,0,
+    87,0,110,82,4,0,116,3,107,10,114,148,1,0,125,2,
+    1,0,122,52,116,4,106,5,106,6,114,108,116,4,106,7,
+    116,4,160,8,161,0,142,0,1,0,110,24,116,4,106,9,
+    160,10,100,4,124,2,106,11,106,12,124,2,102,2,22,0,
+    161,1,1,0,87,0,53,0,100,2,125,2,126,2,88,0,
+    89,0,110,2,88,0,100,2,83,0,41,5,122,44,82,117,
+    110,32,99,117,115,116,111,109,32,115,105,116,101,32,115,112,
+    101,99,105,102,105,99,32,99,111,100,101,44,32,105,102,32,
+    97,118,97,105,108,97,98,108,101,46,114,0,0,0,0,78,
+    218,13,115,105,116,101,99,117,115,116,111,109,105,122,101,122,
+    64,69,114,114,111,114,32,105,110,32,115,105,116,101,99,117,
+    115,116,111,109,105,122,101,59,32,115,101,116,32,80,89,84,
+    72,79,78,86,69,82,66,79,83,69,32,102,111,114,32,116,
+    114,97,99,101,98,97,99,107,58,10,37,115,58,32,37,115,
+    10,41,13,114,139,0,0,0,114,124,0,0,0,114,49,0,
+    0,0,114,41,0,0,0,114,14,0,0,0,114,64,0,0,
+    0,218,7,118,101,114,98,111,115,101,218,10,101,120,99,101,
+    112,116,104,111,111,107,114,46,0,0,0,114,44,0,0,0,
+    218,5,119,114,105,116,101,218,9,95,95,99,108,97,115,115,
+    95,95,218,8,95,95,110,97,109,101,95,95,41,3,114,139,
+    0,0,0,218,3,101,120,99,218,3,101,114,114,114,8,0,
+    0,0,114,8,0,0,0,114,9,0,0,0,218,17,101,120,
+    101,99,115,105,116,101,99,117,115,116,111,109,105,122,101,2,
+    2,0,0,115,30,0,0,0,0,2,2,1,2,1,12,1,
+    16,1,10,1,2,2,24,1,16,1,8,1,16,2,6,1,
+    2,2,10,254,2,255,114,147,0,0,0,99,0,0,0,0,
+    0,0,0,0,3,0,0,0,10,0,0,0,67,0,0,0,
+    115,154,0,0,0,122,66,122,12,100,1,100,2,108,0,125,
+    0,87,0,110,48,4,0,116,1,107,10,114,62,1,0,125,
+    1,1,0,122,18,124,1,106,2,100,3,107,2,114,44,110,
+    2,130,0,87,0,53,0,100,2,125,1,126,1,88,0,89,
+    0,110,2,88,0,87,0,110,82,4,0,116,3,107,10,114,
+    148,1,0,125,2,1,0,122,52,116,4,106,5,106,6,114,
+    108,116,4,106,7,116,4,160,8,161,0,142,0,1,0,110,
+    24,116,4,106,9,160,10,100,4,124,2,106,11,106,12,124,
+    2,102,2,22,0,161,1,1,0,87,0,53,0,100,2,125,
+    2,126,2,88,0,89,0,110,2,88,0,100,2,83,0,41,
+    5,122,44,82,117,110,32,99,117,115,116,111,109,32,117,115,
+    101,114,32,115,112,101,99,105,102,105,99,32,99,111,100,101,
+    44,32,105,102,32,97,118,97,105,108,97,98,108,101,46,114,
+    0,0,0,0,78,218,13,117,115,101,114,99,117,115,116,111,
+    109,105,122,101,122,64,69,114,114,111,114,32,105,110,32,117,
+    115,101,114,99,117,115,116,111,109,105,122,101,59,32,115,101,
+    116,32,80,89,84,72,79,78,86,69,82,66,79,83,69,32,
+    102,111,114,32,116,114,97,99,101,98,97,99,107,58,10,37,
+    115,58,32,37,115,10,41,13,114,148,0,0,0,114,124,0,
+    0,0,114,49,0,0,0,114,41,0,0,0,114,14,0,0,
+    0,114,64,0,0,0,114,140,0,0,0,114,141,0,0,0,
+    114,46,0,0,0,114,44,0,0,0,114,142,0,0,0,114,
+    143,0,0,0,114,144,0,0,0,41,3,114,148,0,0,0,
+    114,145,0,0,0,114,146,0,0,0,114,8,0,0,0,114,
+    8,0,0,0,114,9,0,0,0,218,17,101,120,101,99,117,
+    115,101,114,99,117,115,116,111,109,105,122,101,22,2,0,0,
+    115,30,0,0,0,0,2,2,1,2,1,12,1,16,1,10,
+    1,2,2,24,1,16,1,8,1,16,2,6,1,2,2,10,
+    254,2,255,114,149,0,0,0,99,0,0,0,0,0,0,0,
+    0,2,0,0,0,3,0,0,0,67,0,0,0,115,126,0,
+    0,0,116,0,106,1,100,1,100,1,133,2,25,0,125,0,
+    116,2,131,0,125,1,124,0,116,0,106,1,107,3,114,36,
+    116,3,131,0,1,0,116,4,124,1,131,1,125,1,116,5,
+    100,1,107,8,114,58,116,6,131,0,97,5,116,7,124,1,
+    131,1,125,1,116,8,124,1,131,1,125,1,116,9,131,0,
+    1,0,116,10,131,0,1,0,116,11,131,0,1,0,116,0,
+    106,12,106,13,115,106,116,14,131,0,1,0,116,15,131,0,
+    1,0,116,5,114,122,116,16,131,0,1,0,100,1,83,0,
+    41,2,122,207,65,100,100,32,115,116,97,110,100,97,114,100,
+    32,115,105,116,101,45,115,112,101,99,105,102,105,99,32,100,
+    105,114,101,99,116,111,114,105,101,115,32,116,111,32,116,104,
+    101,32,109,111,100,117,108,101,32,115,101,97,114,99,104,32,
+    112,97,116,104,46,10,10,32,32,32,32,84,104,105,115,32,
+    102,117,110,99,116,105,111,110,32,105,115,32,99,97,108,108,
+    101,100,32,97,117,116,111,109,97,116,105,99,97,108,108,121,
+    32,119,104,101,110,32,116,104,105,115,32,109,111,100,117,108,
+    101,32,105,115,32,105,109,112,111,114,116,101,100,44,10,32,
+    32,32,32,117,110,108,101,115,115,32,116,104,101,32,112,121,
+    116,104,111,110,32,105,110,116,101,114,112,114,101,116,101,114,
+    32,119,97,115,32,115,116,97,114,116,101,100,32,119,105,116,
+    104,32,116,104,101,32,45,83,32,102,108,97,103,46,10,32,
+    32,32,32,78,41,17,114,14,0,0,0,114,3,0,0,0,
+    114,28,0,0,0,114,22,0,0,0,114,138,0,0,0,114,
+    89,0,0,0,114,67,0,0,0,114,92,0,0,0,114,99,
+    0,0,0,114,105,0,0,0,114,112,0,0,0,114,114,0,
+    0,0,114,64,0,0,0,218,8,105,115,111,108,97,116,101,
+    100,114,126,0,0,0,114,147,0,0,0,114,149,0,0,0,
+    41,2,90,9,111,114,105,103,95,112,97,116,104,114,26,0,
+    0,0,114,8,0,0,0,114,8,0,0,0,114,9,0,0,
+    0,218,4,109,97,105,110,42,2,0,0,115,34,0,0,0,
+    0,8,14,1,6,1,10,3,6,2,8,1,8,1,6,1,
+    8,1,8,1,6,1,6,1,6,1,8,1,6,1,6,1,
+    4,1,114,151,0,0,0,99,0,0,0,0,0,0,0,0,
+    7,0,0,0,6,0,0,0,67,0,0,0,115,92,1,0,
+    0,100,1,125,0,116,0,106,1,100,2,100,0,133,2,25,
+    0,125,1,124,1,115,162,116,2,131,0,125,2,116,3,131,
+    0,125,3,116,4,100,3,131,1,1,0,116,0,106,5,68,
+    0,93,18,125,4,116,4,100,4,124,4,102,1,22,0,131,
+    1,1,0,113,48,116,4,100,5,131,1,1,0,116,4,100,
+    6,124,2,116,6,106,5,160,7,124,2,161,1,114,98,100,
+    7,110,2,100,8,102,2,22,0,131,1,1,0,116,4,100,
+    9,124,3,116,6,106,5,160,7,124,3,161,1,114,130,100,
+    7,110,2,100,8,102,2,22,0,131,1,1,0,116,4,100,
+    10,116,8,22,0,131,1,1,0,116,0,160,9,100,11,161,
+    1,1,0,103,0,125,5,100,12,124,1,107,6,114,184,124,
+    5,160,10,116,11,161,1,1,0,100,13,124,1,107,6,114,
+    202,124,5,160,10,116,12,161,1,1,0,124,5,144,1,114,
+    40,116,4,116,6,106,13,160,14,124,5,161,1,131,1,1,
+    0,116,8,114,240,116,0,160,9,100,11,161,1,1,0,110,
+    54,116,8,100,14,107,8,144,1,114,6,116,0,160,9,100,
+    2,161,1,1,0,110,32,116,8,100,0,107,8,144,1,114,
+    28,116,0,160,9,100,15,161,1,1,0,110,10,116,0,160,
+    9,100,16,161,1,1,0,110,48,100,11,100,0,108,15,125,
+    6,116,4,124,6,160,16,124,0,116,0,106,1,100,11,25,
+    0,116,6,106,13,102,2,22,0,161,1,131,1,1,0,116,
+    0,160,9,100,17,161,1,1,0,100,0,83,0,41,18,78,
+    97,178,1,0,0,32,32,32,32,37,115,32,91,45,45,117,
+    115,101,114,45,98,97,115,101,93,32,91,45,45,117,115,101,
+    114,45,115,105,116,101,93,10,10,32,32,32,32,87,105,116,
+    104,111,117,116,32,97,114,103,117,109,101,110,116,115,32,112,
+    114,105,110,116,32,115,111,109,101,32,117,115,101,102,117,108,
+    32,105,110,102,111,114,109,97,116,105,111,110,10,32,32,32,
+    32,87,105,116,104,32,97,114,103,117,109,101,110,116,115,32,
+    112,114,105,110,116,32,116,104,101,32,118,97,108,117,101,32,
+    111,102,32,85,83,69,82,95,66,65,83,69,32,97,110,100,
+    47,111,114,32,85,83,69,82,95,83,73,84,69,32,115,101,
+    112,97,114,97,116,101,100,10,32,32,32,32,98,121,32,39,
+    37,115,39,46,10,10,32,32,32,32,69,120,105,116,32,99,
+    111,100,101,115,32,119,105,116,104,32,45,45,117,115,101,114,
+    45,98,97,115,101,32,111,114,32,45,45,117,115,101,114,45,
+    115,105,116,101,58,10,32,32,32,32,32,32,48,32,45,32,
+    117,115,101,114,32,115,105,116,101,32,100,105,114,101,99,116,
+    111,114,121,32,105,115,32,101,110,97,98,108,101,100,10,32,
+    32,32,32,32,32,49,32,45,32,117,115,101,114,32,115,105,
+    116,101,32,100,105,114,101,99,116,111,114,121,32,105,115,32,
+    100,105,115,97,98,108,101,100,32,98,121,32,117,115,101,114,
+    10,32,32,32,32,32,32,50,32,45,32,117,115,101,115,32,
+    115,105,116,101,32,100,105,114,101,99,116,111,114,121,32,105,
+    115,32,100,105,115,97,98,108,101,100,32,98,121,32,115,117,
+    112,101,114,32,117,115,101,114,10,32,32,32,32,32,32,32,
+    32,32,32,111,114,32,102,111,114,32,115,101,99,117,114,105,
+    116,121,32,114,101,97,115,111,110,115,10,32,32,32,32,32,
+    62,50,32,45,32,117,110,107,110,111,119,110,32,101,114,114,
+    111,114,10,32,32,32,32,114,35,0,0,0,122,12,115,121,
+    115,46,112,97,116,104,32,61,32,91,122,7,32,32,32,32,
+    37,114,44,250,1,93,122,18,85,83,69,82,95,66,65,83,
+    69,58,32,37,114,32,40,37,115,41,114,29,0,0,0,122,
+    13,100,111,101,115,110,39,116,32,101,120,105,115,116,122,18,
+    85,83,69,82,95,83,73,84,69,58,32,37,114,32,40,37,
+    115,41,122,20,69,78,65,66,76,69,95,85,83,69,82,95,
+    83,73,84,69,58,32,37,114,114,0,0,0,0,122,11,45,
+    45,117,115,101,114,45,98,97,115,101,122,11,45,45,117,115,
+    101,114,45,115,105,116,101,70,114,74,0,0,0,233,3,0,
+    0,0,233,10,0,0,0,41,17,114,14,0,0,0,90,4,
+    97,114,103,118,114,86,0,0,0,114,88,0,0,0,114,42,
+    0,0,0,114,3,0,0,0,114,2,0,0,0,114,90,0,
+    0,0,114,89,0,0,0,114,102,0,0,0,114,23,0,0,
+    0,114,85,0,0,0,114,87,0,0,0,90,7,112,97,116,
+    104,115,101,112,114,4,0,0,0,218,8,116,101,120,116,119,
+    114,97,112,90,6,100,101,100,101,110,116,41,7,114,113,0,
+    0,0,114,69,0,0,0,90,9,117,115,101,114,95,98,97,
+    115,101,114,91,0,0,0,114,7,0,0,0,90,6,98,117,
+    102,102,101,114,114,155,0,0,0,114,8,0,0,0,114,8,
+    0,0,0,114,9,0,0,0,218,7,95,115,99,114,105,112,
+    116,76,2,0,0,115,68,0,0,0,0,1,4,14,14,1,
+    4,1,6,1,6,1,8,1,10,1,16,1,8,1,6,1,
+    18,255,8,2,6,1,18,255,8,2,12,1,10,2,4,1,
+    8,1,10,1,8,1,10,2,6,1,16,1,4,1,12,1,
+    10,1,12,1,10,1,12,2,12,2,8,1,30,1,114,156,
+    0,0,0,90,8,95,95,109,97,105,110,95,95,41,1,78,
+    41,1,78,41,1,78,41,37,114,115,0,0,0,114,14,0,
+    0,0,114,2,0,0,0,114,104,0,0,0,114,103,0,0,
+    0,114,97,0,0,0,114,135,0,0,0,114,94,0,0,0,
+    114,89,0,0,0,114,87,0,0,0,114,85,0,0,0,114,
+    10,0,0,0,114,22,0,0,0,114,28,0,0,0,114,32,
+    0,0,0,114,54,0,0,0,114,59,0,0,0,114,67,0,
+    0,0,114,80,0,0,0,114,84,0,0,0,114,86,0,0,
+    0,114,88,0,0,0,114,92,0,0,0,114,98,0,0,0,
+    114,99,0,0,0,114,105,0,0,0,114,112,0,0,0,114,
+    114,0,0,0,114,126,0,0,0,114,138,0,0,0,114,147,
+    0,0,0,114,149,0,0,0,114,151,0,0,0,114,64,0,
+    0,0,218,7,110,111,95,115,105,116,101,114,156,0,0,0,
+    114,144,0,0,0,114,8,0,0,0,114,8,0,0,0,114,
+    8,0,0,0,114,9,0,0,0,218,8,60,109,111,100,117,
+    108,101,62,1,0,0,0,115,70,0,0,0,4,71,8,1,
+    8,1,8,1,8,3,12,3,4,5,4,1,4,3,8,9,
+    8,16,8,19,8,13,8,42,10,24,8,32,8,20,8,12,
+    8,13,8,14,8,14,10,27,10,8,8,16,8,24,8,3,
+    8,59,8,59,8,20,8,20,8,31,10,1,6,2,8,51,
+    10,1,
+};
@@ -0,0 +1,242 @@
+/* Auto-generated by Programs/_freeze_importlib.c */
+const unsigned char _Py_M__stat[] = {
+    99,0,0,0,0,0,0,0,0,0,0,0,0,13,0,0,
+    0,64,0,0,0,115,40,2,0,0,100,0,90,0,100,1,
+    90,1,100,2,90,2,100,3,90,3,100,4,90,4,100,5,
+    90,5,100,6,90,6,100,7,90,7,100,8,90,8,100,9,
+    90,9,100,10,90,10,100,11,100,12,132,0,90,11,100,13,
+    100,14,132,0,90,12,100,15,90,13,100,16,90,14,100,17,
+    90,15,100,18,90,16,100,19,90,17,100,20,90,18,100,21,
+    90,19,100,22,100,23,132,0,90,20,100,24,100,25,132,0,
+    90,21,100,26,100,27,132,0,90,22,100,28,100,29,132,0,
+    90,23,100,30,100,31,132,0,90,24,100,32,100,33,132,0,
+    90,25,100,34,100,35,132,0,90,26,100,36,90,27,100,37,
+    90,28,101,28,90,29,100,38,90,30,100,39,90,31,100,40,
+    90,32,100,41,90,33,100,42,90,34,100,39,90,35,100,40,
+    90,36,100,41,90,37,100,43,90,38,100,44,90,39,100,45,
+    90,40,100,9,90,41,100,8,90,42,100,5,90,43,100,3,
+    90,44,100,2,90,45,100,2,90,46,100,3,90,47,100,5,
+    90,48,100,9,90,49,100,45,90,50,100,44,90,51,100,18,
+    90,52,100,46,90,53,100,47,90,54,100,48,90,55,100,49,
+    90,56,100,50,90,57,101,18,100,51,102,2,101,19,100,52,
+    102,2,101,16,100,53,102,2,101,15,100,54,102,2,101,13,
+    100,55,102,2,101,14,100,56,102,2,101,17,100,57,102,2,
+    102,7,101,35,100,58,102,2,102,1,101,36,100,59,102,2,
+    102,1,101,37,101,27,66,0,100,52,102,2,101,27,100,60,
+    102,2,101,37,100,61,102,2,102,3,101,39,100,58,102,2,
+    102,1,101,40,100,59,102,2,102,1,101,41,101,28,66,0,
+    100,52,102,2,101,28,100,60,102,2,101,41,100,61,102,2,
+    102,3,101,43,100,58,102,2,102,1,101,44,100,59,102,2,
+    102,1,101,45,101,30,66,0,100,62,102,2,101,30,100,63,
+    102,2,101,45,100,61,102,2,102,3,102,10,90,58,100,64,
+    100,65,132,0,90,59,100,44,90,60,100,36,90,61,100,41,
+    90,62,100,45,90,63,100,15,90,64,100,3,90,65,100,18,
+    90,66,100,40,90,67,100,16,90,68,100,47,90,69,100,19,
+    90,70,100,2,90,71,100,37,90,72,100,38,90,73,100,5,
+    90,74,100,39,90,75,100,46,90,76,122,12,100,1,100,66,
+    108,77,84,0,87,0,110,22,4,0,101,78,107,10,144,2,
+    114,34,1,0,1,0,1,0,89,0,110,2,88,0,100,67,
+    83,0,41,68,122,111,67,111,110,115,116,97,110,116,115,47,
+    102,117,110,99,116,105,111,110,115,32,102,111,114,32,105,110,
+    116,101,114,112,114,101,116,105,110,103,32,114,101,115,117,108,
+    116,115,32,111,102,32,111,115,46,115,116,97,116,40,41,32,
+    97,110,100,32,111,115,46,108,115,116,97,116,40,41,46,10,
+    10,83,117,103,103,101,115,116,101,100,32,117,115,97,103,101,
+    58,32,102,114,111,109,32,115,116,97,116,32,105,109,112,111,
+    114,116,32,42,10,233,0,0,0,0,233,1,0,0,0,233,
+    2,0,0,0,233,3,0,0,0,233,4,0,0,0,233,5,
+    0,0,0,233,6,0,0,0,233,7,0,0,0,233,8,0,
+    0,0,233,9,0,0,0,99,1,0,0,0,0,0,0,0,
+    1,0,0,0,2,0,0,0,67,0,0,0,115,8,0,0,
+    0,124,0,100,1,64,0,83,0,41,2,122,77,82,101,116,
+    117,114,110,32,116,104,101,32,112,111,114,116,105,111,110,32,
+    111,102,32,116,104,101,32,102,105,108,101,39,115,32,109,111,
+    100,101,32,116,104,97,116,32,99,97,110,32,98,101,32,115,
+    101,116,32,98,121,10,32,32,32,32,111,115,46,99,104,109,
+    111,100,40,41,46,10,32,32,32,32,105,255,15,0,0,169,
+    0,169,1,218,4,109,111,100,101,114,10,0,0,0,114,10,
+    0,0,0,250,13,60,102,114,111,122,101,110,32,115,116,97,
+    116,62,218,7,83,95,73,77,79,68,69,21,0,0,0,115,
+    2,0,0,0,0,4,114,14,0,0,0,99,1,0,0,0,
+    0,0,0,0,1,0,0,0,2,0,0,0,67,0,0,0,
+    115,8,0,0,0,124,0,100,1,64,0,83,0,41,2,122,
+    76,82,101,116,117,114,110,32,116,104,101,32,112,111,114,116,
+    105,111,110,32,111,102,32,116,104,101,32,102,105,108,101,39,
+    115,32,109,111,100,101,32,116,104,97,116,32,100,101,115,99,
+    114,105,98,101,115,32,116,104,101,10,32,32,32,32,102,105,
+    108,101,32,116,121,112,101,46,10,32,32,32,32,105,0,240,
+    0,0,114,10,0,0,0,114,11,0,0,0,114,10,0,0,
+    0,114,10,0,0,0,114,13,0,0,0,218,6,83,95,73,
+    70,77,84,27,0,0,0,115,2,0,0,0,0,4,114,15,
+    0,0,0,105,0,64,0,0,105,0,32,0,0,105,0,96,
+    0,0,105,0,128,0,0,105,0,16,0,0,105,0,160,0,
+    0,105,0,192,0,0,99,1,0,0,0,0,0,0,0,1,
+    0,0,0,2,0,0,0,67,0,0,0,115,12,0,0,0,
+    116,0,124,0,131,1,116,1,107,2,83,0,41,1,122,40,
+    82,101,116,117,114,110,32,84,114,117,101,32,105,102,32,109,
+    111,100,101,32,105,115,32,102,114,111,109,32,97,32,100,105,
+    114,101,99,116,111,114,121,46,41,2,114,15,0,0,0,218,
+    7,83,95,73,70,68,73,82,114,11,0,0,0,114,10,0,
+    0,0,114,10,0,0,0,114,13,0,0,0,218,7,83,95,
+    73,83,68,73,82,46,0,0,0,115,2,0,0,0,0,2,
+    114,17,0,0,0,99,1,0,0,0,0,0,0,0,1,0,
+    0,0,2,0,0,0,67,0,0,0,115,12,0,0,0,116,
+    0,124,0,131,1,116,1,107,2,83,0,41,1,122,60,82,
+    101,116,117,114,110,32,84,114,117,101,32,105,102,32,109,111,
+    100,101,32,105,115,32,102,114,111,109,32,97,32,99,104,97,
+    114,97,99,116,101,114,32,115,112,101,99,105,97,108,32,100,
+    101,118,105,99,101,32,102,105,108,101,46,41,2,114,15,0,
+    0,0,218,7,83,95,73,70,67,72,82,114,11,0,0,0,
+    114,10,0,0,0,114,10,0,0,0,114,13,0,0,0,218,
+    7,83,95,73,83,67,72,82,50,0,0,0,115,2,0,0,
+    0,0,2,114,19,0,0,0,99,1,0,0,0,0,0,0,
+    0,1,0,0,0,2,0,0,0,67,0,0,0,115,12,0,
+    0,0,116,0,124,0,131,1,116,1,107,2,83,0,41,1,
+    122,56,82,101,116,117,114,110,32,84,114,117,101,32,105,102,
+    32,109,111,100,101,32,105,115,32,102,114,111,109,32,97,32,
+    98,108,111,99,107,32,115,112,101,99,105,97,108,32,100,101,
+    118,105,99,101,32,102,105,108,101,46,41,2,114,15,0,0,
+    0,218,7,83,95,73,70,66,76,75,114,11,0,0,0,114,
+    10,0,0,0,114,10,0,0,0,114,13,0,0,0,218,7,
+    83,95,73,83,66,76,75,54,0,0,0,115,2,0,0,0,
+    0,2,114,21,0,0,0,99,1,0,0,0,0,0,0,0,
+    1,0,0,0,2,0,0,0,67,0,0,0,115,12,0,0,
+    0,116,0,124,0,131,1,116,1,107,2,83,0,41,1,122,
+    43,82,101,116,117,114,110,32,84,114,117,101,32,105,102,32,
+    109,111,100,101,32,105,115,32,102,114,111,109,32,97,32,114,
+    101,103,117,108,97,114,32,102,105,108,101,46,41,2,114,15,
+    0,0,0,218,7,83,95,73,70,82,69,71,114,11,0,0,
+    0,114,10,0,0,0,114,10,0,0,0,114,13,0,0,0,
+    218,7,83,95,73,83,82,69,71,58,0,0,0,115,2,0,
+    0,0,0,2,114,23,0,0,0,99,1,0,0,0,0,0,
+    0,0,1,0,0,0,2,0,0,0,67,0,0,0,115,12,
+    0,0,0,116,0,124,0,131,1,116,1,107,2,83,0,41,
+    1,122,48,82,101,116,117,114,110,32,84,114,117,101,32,105,
+    102,32,109,111,100,101,32,105,115,32,102,114,111,109,32,97,
+    32,70,73,70,79,32,40,110,97,109,101,100,32,112,105,112,
+    101,41,46,41,2,114,15,0,0,0,218,7,83,95,73,70,
+    73,70,79,114,11,0,0,0,114,10,0,0,0,114,10,0,
+    0,0,114,13,0,0,0,218,8,83,95,73,83,70,73,70,
+    79,62,0,0,0,115,2,0,0,0,0,2,114,25,0,0,
+    0,99,1,0,0,0,0,0,0,0,1,0,0,0,2,0,
+    0,0,67,0,0,0,115,12,0,0,0,116,0,124,0,131,
+    1,116,1,107,2,83,0,41,1,122,44,82,101,116,117,114,
+    110,32,84,114,117,101,32,105,102,32,109,111,100,101,32,105,
+    115,32,102,114,111,109,32,97,32,115,121,109,98,111,108,105,
+    99,32,108,105,110,107,46,41,2,114,15,0,0,0,218,7,
+    83,95,73,70,76,78,75,114,11,0,0,0,114,10,0,0,
+    0,114,10,0,0,0,114,13,0,0,0,218,7,83,95,73,
+    83,76,78,75,66,0,0,0,115,2,0,0,0,0,2,114,
+    27,0,0,0,99,1,0,0,0,0,0,0,0,1,0,0,
+    0,2,0,0,0,67,0,0,0,115,12,0,0,0,116,0,
+    124,0,131,1,116,1,107,2,83,0,41,1,122,37,82,101,
+    116,117,114,110,32,84,114,117,101,32,105,102,32,109,111,100,
+    101,32,105,115,32,102,114,111,109,32,97,32,115,111,99,107,
+    101,116,46,41,2,114,15,0,0,0,218,8,83,95,73,70,
+    83,79,67,75,114,11,0,0,0,114,10,0,0,0,114,10,
+    0,0,0,114,13,0,0,0,218,8,83,95,73,83,83,79,
+    67,75,70,0,0,0,115,2,0,0,0,0,2,114,29,0,
+    0,0,105,0,8,0,0,105,0,4,0,0,105,0,2,0,
+    0,233,0,1,0,0,233,128,0,0,0,233,64,0,0,0,
+    105,192,1,0,0,233,56,0,0,0,233,32,0,0,0,233,
+    16,0,0,0,105,0,0,1,0,105,0,0,2,0,105,0,
+    0,4,0,105,0,0,16,0,105,0,0,32,0,218,1,108,
+    218,1,115,250,1,45,218,1,98,218,1,100,218,1,99,218,
+    1,112,218,1,114,218,1,119,218,1,83,218,1,120,218,1,
+    116,218,1,84,99,1,0,0,0,0,0,0,0,5,0,0,
+    0,5,0,0,0,67,0,0,0,115,74,0,0,0,103,0,
+    125,1,116,0,68,0,93,54,125,2,124,2,68,0,93,34,
+    92,2,125,3,125,4,124,0,124,3,64,0,124,3,107,2,
+    114,16,124,1,160,1,124,4,161,1,1,0,1,0,113,8,
+    113,16,124,1,160,1,100,1,161,1,1,0,113,8,100,2,
+    160,2,124,1,161,1,83,0,41,3,122,59,67,111,110,118,
+    101,114,116,32,97,32,102,105,108,101,39,115,32,109,111,100,
+    101,32,116,111,32,97,32,115,116,114,105,110,103,32,111,102,
+    32,116,104,101,32,102,111,114,109,32,39,45,114,119,120,114,
+    119,120,114,119,120,39,46,114,38,0,0,0,218,0,41,3,
+    218,15,95,102,105,108,101,109,111,100,101,95,116,97,98,108,
+    101,218,6,97,112,112,101,110,100,218,4,106,111,105,110,41,
+    5,114,12,0,0,0,90,4,112,101,114,109,90,5,116,97,
+    98,108,101,90,3,98,105,116,90,4,99,104,97,114,114,10,
+    0,0,0,114,10,0,0,0,114,13,0,0,0,218,8,102,
+    105,108,101,109,111,100,101,140,0,0,0,115,16,0,0,0,
+    0,2,4,1,8,1,12,1,12,1,10,1,6,2,12,1,
+    114,53,0,0,0,41,1,218,1,42,78,41,79,218,7,95,
+    95,100,111,99,95,95,90,7,83,84,95,77,79,68,69,90,
+    6,83,84,95,73,78,79,90,6,83,84,95,68,69,86,90,
+    8,83,84,95,78,76,73,78,75,90,6,83,84,95,85,73,
+    68,90,6,83,84,95,71,73,68,90,7,83,84,95,83,73,
+    90,69,90,8,83,84,95,65,84,73,77,69,90,8,83,84,
+    95,77,84,73,77,69,90,8,83,84,95,67,84,73,77,69,
+    114,14,0,0,0,114,15,0,0,0,114,16,0,0,0,114,
+    18,0,0,0,114,20,0,0,0,114,22,0,0,0,114,24,
+    0,0,0,114,26,0,0,0,114,28,0,0,0,114,17,0,
+    0,0,114,19,0,0,0,114,21,0,0,0,114,23,0,0,
+    0,114,25,0,0,0,114,27,0,0,0,114,29,0,0,0,
+    90,7,83,95,73,83,85,73,68,90,7,83,95,73,83,71,
+    73,68,90,7,83,95,69,78,70,77,84,90,7,83,95,73,
+    83,86,84,88,90,7,83,95,73,82,69,65,68,90,8,83,
+    95,73,87,82,73,84,69,90,7,83,95,73,69,88,69,67,
+    90,7,83,95,73,82,87,88,85,90,7,83,95,73,82,85,
+    83,82,90,7,83,95,73,87,85,83,82,90,7,83,95,73,
+    88,85,83,82,90,7,83,95,73,82,87,88,71,90,7,83,
+    95,73,82,71,82,80,90,7,83,95,73,87,71,82,80,90,
+    7,83,95,73,88,71,82,80,90,7,83,95,73,82,87,88,
+    79,90,7,83,95,73,82,79,84,72,90,7,83,95,73,87,
+    79,84,72,90,7,83,95,73,88,79,84,72,90,9,85,70,
+    95,78,79,68,85,77,80,90,12,85,70,95,73,77,77,85,
+    84,65,66,76,69,90,9,85,70,95,65,80,80,69,78,68,
+    90,9,85,70,95,79,80,65,81,85,69,90,11,85,70,95,
+    78,79,85,78,76,73,78,75,90,13,85,70,95,67,79,77,
+    80,82,69,83,83,69,68,90,9,85,70,95,72,73,68,68,
+    69,78,90,11,83,70,95,65,82,67,72,73,86,69,68,90,
+    12,83,70,95,73,77,77,85,84,65,66,76,69,90,9,83,
+    70,95,65,80,80,69,78,68,90,11,83,70,95,78,79,85,
+    78,76,73,78,75,90,11,83,70,95,83,78,65,80,83,72,
+    79,84,114,50,0,0,0,114,53,0,0,0,90,22,70,73,
+    76,69,95,65,84,84,82,73,66,85,84,69,95,65,82,67,
+    72,73,86,69,90,25,70,73,76,69,95,65,84,84,82,73,
+    66,85,84,69,95,67,79,77,80,82,69,83,83,69,68,90,
+    21,70,73,76,69,95,65,84,84,82,73,66,85,84,69,95,
+    68,69,86,73,67,69,90,24,70,73,76,69,95,65,84,84,
+    82,73,66,85,84,69,95,68,73,82,69,67,84,79,82,89,
+    90,24,70,73,76,69,95,65,84,84,82,73,66,85,84,69,
+    95,69,78,67,82,89,80,84,69,68,90,21,70,73,76,69,
+    95,65,84,84,82,73,66,85,84,69,95,72,73,68,68,69,
+    78,90,31,70,73,76,69,95,65,84,84,82,73,66,85,84,
+    69,95,73,78,84,69,71,82,73,84,89,95,83,84,82,69,
+    65,77,90,21,70,73,76,69,95,65,84,84,82,73,66,85,
+    84,69,95,78,79,82,77,65,76,90,34,70,73,76,69,95,
+    65,84,84,82,73,66,85,84,69,95,78,79,84,95,67,79,
+    78,84,69,78,84,95,73,78,68,69,88,69,68,90,28,70,
+    73,76,69,95,65,84,84,82,73,66,85,84,69,95,78,79,
+    95,83,67,82,85,66,95,68,65,84,65,90,22,70,73,76,
+    69,95,65,84,84,82,73,66,85,84,69,95,79,70,70,76,
+    73,78,69,90,23,70,73,76,69,95,65,84,84,82,73,66,
+    85,84,69,95,82,69,65,68,79,78,76,89,90,28,70,73,
+    76,69,95,65,84,84,82,73,66,85,84,69,95,82,69,80,
+    65,82,83,69,95,80,79,73,78,84,90,26,70,73,76,69,
+    95,65,84,84,82,73,66,85,84,69,95,83,80,65,82,83,
+    69,95,70,73,76,69,90,21,70,73,76,69,95,65,84,84,
+    82,73,66,85,84,69,95,83,89,83,84,69,77,90,24,70,
+    73,76,69,95,65,84,84,82,73,66,85,84,69,95,84,69,
+    77,80,79,82,65,82,89,90,22,70,73,76,69,95,65,84,
+    84,82,73,66,85,84,69,95,86,73,82,84,85,65,76,90,
+    5,95,115,116,97,116,218,11,73,109,112,111,114,116,69,114,
+    114,111,114,114,10,0,0,0,114,10,0,0,0,114,10,0,
+    0,0,114,13,0,0,0,218,8,60,109,111,100,117,108,101,
+    62,1,0,0,0,115,212,0,0,0,4,7,4,1,4,1,
+    4,1,4,1,4,1,4,1,4,1,4,1,4,1,4,4,
+    8,6,8,9,4,1,4,1,4,1,4,1,4,1,4,1,
+    4,4,8,4,8,4,8,4,8,4,8,4,8,4,8,6,
+    4,1,4,1,4,1,4,1,4,1,4,1,4,1,4,1,
+    4,1,4,1,4,1,4,1,4,1,4,1,4,1,4,1,
+    4,1,4,1,4,4,4,1,4,1,4,1,4,1,4,1,
+    4,1,4,1,4,1,4,1,4,1,4,1,4,4,6,1,
+    6,1,6,1,6,1,6,1,6,1,6,250,2,8,8,1,
+    8,1,10,1,6,1,6,254,2,4,8,1,8,1,10,1,
+    6,1,6,254,2,4,8,1,8,1,10,1,6,1,6,254,
+    2,233,4,28,8,16,4,1,4,1,4,1,4,1,4,1,
+    4,1,4,1,4,1,4,1,4,1,4,1,4,1,4,1,
+    4,1,4,1,4,1,4,4,2,1,12,1,16,1,
+};
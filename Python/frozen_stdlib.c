@@ -0,0 +1,71 @@
+
+/* Frozen copies of the standard library modules imported at startup */
+
+#include "Python.h"
+
+/* These are used instead of the modules in Lib/ with -X frozen_modules,
+   which saves looking the modules up on sys.path and reading, checking
+   and unmarshalling their bytecode files on every launch.  A copy is only
+   used while the source of the module is missing or has the hash it was
+   frozen from.  To regenerate them after changing one of the modules, or
+   the bytecode or marshal format, run "make regen-frozen".  FROZEN_STDLIB
+   in Makefile.pre.in lists the modules. */
+
+#include "frozen_modules/_collections_abc.h"
+#include "frozen_modules/_sitebuiltins.h"
+#include "frozen_modules/abc.h"
+#include "frozen_modules/codecs.h"
+#include "frozen_modules/encodings.h"
+#include "frozen_modules/encodings.aliases.h"
+#include "frozen_modules/encodings.latin_1.h"
+#include "frozen_modules/encodings.utf_8.h"
+#include "frozen_modules/genericpath.h"
+#include "frozen_modules/io.h"
+#include "frozen_modules/ntpath.h"
+#include "frozen_modules/os.h"
+#include "frozen_modules/posixpath.h"
+#include "frozen_modules/site.h"
+#include "frozen_modules/stat.h"
+#include "frozen_modules/hashes.h"
+
+#define FROZEN(name, data) {name, data, (int)sizeof(data)}
+/* Negative size indicates package-ness */
+#define FROZEN_PACKAGE(name, data) {name, data, -(int)sizeof(data)}
+
+const struct _frozen _PyImport_FrozenStdlib[] = {
+    FROZEN("_collections_abc", _Py_M___collections_abc),
+    FROZEN("_sitebuiltins", _Py_M___sitebuiltins),
+    FROZEN("abc", _Py_M__abc),
+    FROZEN("codecs", _Py_M__codecs),
+    FROZEN_PACKAGE("encodings", _Py_M__encodings),
+    FROZEN("encodings.aliases", _Py_M__encodingsaliases),
+    FROZEN("encodings.latin_1", _Py_M__encodingslatin_1),
+    FROZEN("encodings.utf_8", _Py_M__encodingsutf_8),
+    FROZEN("genericpath", _Py_M__genericpath),
+    FROZEN("io", _Py_M__io),
+    FROZEN("ntpath", _Py_M__ntpath),
+    FROZEN("os", _Py_M__os),
+    FROZEN("posixpath", _Py_M__posixpath),
+    FROZEN("site", _Py_M__site),
+    FROZEN("stat", _Py_M__stat),
+    {0, 0, 0} /* sentinel */
+};
+
+/* The hashes of the sources of the modules above, in the same order */
+const char * const _PyImport_FrozenStdlibHashes[] = {
+    _Py_H___collections_abc,
+    _Py_H___sitebuiltins,
+    _Py_H__abc,
+    _Py_H__codecs,
+    _Py_H__encodings,
+    _Py_H__encodingsaliases,
+    _Py_H__encodingslatin_1,
+    _Py_H__encodingsutf_8,
+    _Py_H__genericpath,
+    _Py_H__io,
+    _Py_H__ntpath,
+    _Py_H__os,
+    _Py_H__posixpath,
+    _Py_H__site,
+    _Py_H__stat,
+};
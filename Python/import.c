@@ -34,6 +34,10 @@ extern struct _inittab _PyImport_Inittab[];
 struct _inittab *PyImport_Inittab = _PyImport_Inittab;
 static struct _inittab *inittab_copy = NULL;
 
+/* These tables are defined in frozen_stdlib.c: */
+extern const struct _frozen _PyImport_FrozenStdlib[];
+extern const char * const _PyImport_FrozenStdlibHashes[];
+
 /*[clinic input]
 module _imp
 [clinic start generated code]*/
@@ -1012,7 +1016,11 @@ update_code_filenames(PyCodeObject *co, PyObject *oldname, PyObject *newname)
     Py_INCREF(newname);
     Py_XSETREF(co->co_filename, newname);
 
+    /* Code objects nested in a lazily loaded one get its co_filename when
+       they are loaded */
     constants = co->co_consts;
+    if (constants == NULL)
+        return;
     n = PyTuple_GET_SIZE(constants);
     for (i = 0; i < n; i++) {
         tmp = PyTuple_GET_ITEM(constants, i);
@@ -1237,14 +1245,11 @@ _imp_create_builtin(PyObject *module, PyObject *spec)
 /* Frozen modules */
 
 static const struct _frozen *
-find_frozen(PyObject *name)
+find_frozen_in(const struct _frozen *table, PyObject *name)
 {
     const struct _frozen *p;
 
-    if (name == NULL)
-        return NULL;
-
-    for (p = PyImport_FrozenModules; ; p++) {
+    for (p = table; ; p++) {
         if (p->name == NULL)
             return NULL;
         if (_PyUnicode_EqualToASCIIString(name, p->name))
@@ -1253,6 +1258,22 @@ find_frozen(PyObject *name)
     return p;
 }
 
+/* Look name up in PyImport_FrozenModules, then in the frozen copies of
+   standard library modules if they are used */
+static const struct _frozen *
+find_frozen(PyObject *name)
+{
+    const struct _frozen *p;
+
+    if (name == NULL)
+        return NULL;
+
+    p = find_frozen_in(PyImport_FrozenModules, name);
+    if (p == NULL && _PyInterpreterState_GET_UNSAFE()->frozen_stdlib)
+        p = find_frozen_in(_PyImport_FrozenStdlib, name);
+    return p;
+}
+
 static PyObject *
 get_frozen_object(PyObject *name)
 {
@@ -2087,6 +2108,81 @@ _imp_is_frozen_impl(PyObject *module, PyObject *name)
     return PyBool_FromLong((long) (p == NULL ? 0 : p->size));
 }
 
+/*[clinic input]
+_imp._frozen_stdlib_names
+
+Returns the names of the frozen copies of standard library modules.
+[clinic start generated code]*/
+
+static PyObject *
+_imp__frozen_stdlib_names_impl(PyObject *module)
+/*[clinic end generated code: output=d855d1385b0415da input=dd061379a2a5d0eb]*/
+{
+    const struct _frozen *p;
+    Py_ssize_t i, n = 0;
+    PyObject *names;
+
+    for (p = _PyImport_FrozenStdlib; p->name != NULL; p++)
+        n++;
+    names = PyTuple_New(n);
+    if (names == NULL)
+        return NULL;
+    for (i = 0; i < n; i++) {
+        PyObject *name = PyUnicode_FromString(_PyImport_FrozenStdlib[i].name);
+        if (name == NULL) {
+            Py_DECREF(names);
+            return NULL;
+        }
+        PyTuple_SET_ITEM(names, i, name);
+    }
+    return names;
+}
+
+/*[clinic input]
+_imp._frozen_stdlib_source_hash
+
+    name: unicode
+    /
+
+Returns the hash of the source of a frozen copy of a standard library module.
+
+This is _imp.source_hash(0, source), with "\r\n" newlines read as "\n".
+Returns None if name is not one of the frozen copies.
+[clinic start generated code]*/
+
+static PyObject *
+_imp__frozen_stdlib_source_hash_impl(PyObject *module, PyObject *name)
+/*[clinic end generated code: output=10fce14cc15c2b98 input=fb80bc2f303dd0fa]*/
+{
+    const struct _frozen *p;
+
+    for (p = _PyImport_FrozenStdlib; p->name != NULL; p++) {
+        if (_PyUnicode_EqualToASCIIString(name, p->name)) {
+            return PyBytes_FromStringAndSize(
+                _PyImport_FrozenStdlibHashes[p - _PyImport_FrozenStdlib],
+                sizeof(uint64_t));
+        }
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_imp._use_frozen_stdlib
+
+    enabled: bool
+    /
+
+Sets whether the frozen copies of standard library modules are used.
+[clinic start generated code]*/
+
+static PyObject *
+_imp__use_frozen_stdlib_impl(PyObject *module, int enabled)
+/*[clinic end generated code: output=1c72ed4050ca0b4a input=285b1b731a014851]*/
+{
+    _PyInterpreterState_GET_UNSAFE()->frozen_stdlib = enabled;
+    Py_RETURN_NONE;
+}
+
 /* Common implementation for _imp.exec_dynamic and _imp.exec_builtin */
 static int
 exec_builtin_or_dynamic(PyObject *mod) {
@@ -2247,6 +2343,9 @@ static PyMethodDef imp_methods[] = {
     _IMP_INIT_FROZEN_METHODDEF
     _IMP_IS_BUILTIN_METHODDEF
     _IMP_IS_FROZEN_METHODDEF
+    _IMP__FROZEN_STDLIB_NAMES_METHODDEF
+    _IMP__FROZEN_STDLIB_SOURCE_HASH_METHODDEF
+    _IMP__USE_FROZEN_STDLIB_METHODDEF
     _IMP_CREATE_DYNAMIC_METHODDEF
     _IMP_EXEC_DYNAMIC_METHODDEF
     _IMP_EXEC_BUILTIN_METHODDEF
@@ -444,7 +444,7 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     0,0,0,4,0,0,0,19,0,0,0,115,38,0,0,0,
     116,0,160,1,124,1,161,1,115,28,116,2,100,1,160,3,
     124,1,161,1,124,1,100,2,141,2,130,1,136,0,124,0,
-    124,1,131,2,83,0,169,3,78,122,27,123,33,114,125,32,
+    124,1,131,2,83,0,41,3,78,250,27,123,33,114,125,32,
     105,115,32,110,111,116,32,97,32,102,114,111,122,101,110,32,
     109,111,100,117,108,101,114,16,0,0,0,41,4,114,57,0,
     0,0,218,9,105,115,95,102,114,111,122,101,110,114,79,0,
@@ -790,7 +790,7 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     116,104,95,95,114,112,0,0,0,114,118,0,0,0,114,123,
     0,0,0,114,117,0,0,0,41,8,114,96,0,0,0,114,
     109,0,0,0,114,113,0,0,0,114,95,0,0,0,114,17,
-    0,0,0,90,8,108,111,99,97,116,105,111,110,114,123,0,
+    0,0,0,218,8,108,111,99,97,116,105,111,110,114,123,0,
     0,0,114,117,0,0,0,114,10,0,0,0,114,10,0,0,
     0,114,11,0,0,0,218,17,95,115,112,101,99,95,102,114,
     111,109,95,109,111,100,117,108,101,176,1,0,0,115,72,0,
@@ -798,7 +798,7 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     6,1,8,1,2,1,10,1,14,2,6,1,2,1,10,1,
     14,1,10,1,8,1,8,1,2,1,10,1,14,1,12,2,
     4,1,2,1,10,1,14,1,10,1,2,1,14,1,16,1,
-    10,2,14,1,20,1,6,1,6,1,114,142,0,0,0,70,
+    10,2,14,1,20,1,6,1,6,1,114,143,0,0,0,70,
     169,1,218,8,111,118,101,114,114,105,100,101,99,2,0,0,
     0,1,0,0,0,5,0,0,0,8,0,0,0,67,0,0,
     0,115,226,1,0,0,124,2,115,20,116,0,124,1,100,1,
@@ -839,11 +839,11 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     0,114,126,0,0,0,114,127,0,0,0,218,16,95,78,97,
     109,101,115,112,97,99,101,76,111,97,100,101,114,218,7,95,
     95,110,101,119,95,95,90,5,95,112,97,116,104,114,108,0,
-    0,0,114,98,0,0,0,114,130,0,0,0,114,145,0,0,
+    0,0,114,98,0,0,0,114,130,0,0,0,114,146,0,0,
     0,114,105,0,0,0,114,141,0,0,0,114,124,0,0,0,
     114,113,0,0,0,114,123,0,0,0,114,139,0,0,0,41,
-    5,114,95,0,0,0,114,96,0,0,0,114,144,0,0,0,
-    114,109,0,0,0,114,146,0,0,0,114,10,0,0,0,114,
+    5,114,95,0,0,0,114,96,0,0,0,114,145,0,0,0,
+    114,109,0,0,0,114,147,0,0,0,114,10,0,0,0,114,
     10,0,0,0,114,11,0,0,0,218,18,95,105,110,105,116,
     95,109,111,100,117,108,101,95,97,116,116,114,115,221,1,0,
     0,115,96,0,0,0,0,4,20,1,2,1,12,1,14,1,
@@ -852,7 +852,7 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     20,1,2,1,12,1,14,1,6,2,2,1,10,1,16,1,
     6,2,24,1,12,1,2,1,12,1,16,1,6,2,8,1,
     24,1,2,1,12,1,16,1,6,2,24,1,12,1,2,1,
-    12,1,16,1,6,1,114,148,0,0,0,99,1,0,0,0,
+    12,1,16,1,6,1,114,149,0,0,0,99,1,0,0,0,
     0,0,0,0,2,0,0,0,3,0,0,0,67,0,0,0,
     115,82,0,0,0,100,1,125,1,116,0,124,0,106,1,100,
     2,131,2,114,30,124,0,106,1,160,2,124,0,161,1,125,
@@ -869,13 +869,13 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     100,117,108,101,40,41,32,109,117,115,116,32,97,108,115,111,
     32,100,101,102,105,110,101,32,99,114,101,97,116,101,95,109,
     111,100,117,108,101,40,41,41,7,114,4,0,0,0,114,109,
-    0,0,0,114,149,0,0,0,114,79,0,0,0,114,18,0,
-    0,0,114,17,0,0,0,114,148,0,0,0,169,2,114,95,
+    0,0,0,114,150,0,0,0,114,79,0,0,0,114,18,0,
+    0,0,114,17,0,0,0,114,149,0,0,0,169,2,114,95,
     0,0,0,114,96,0,0,0,114,10,0,0,0,114,10,0,
     0,0,114,11,0,0,0,218,16,109,111,100,117,108,101,95,
     102,114,111,109,95,115,112,101,99,37,2,0,0,115,18,0,
     0,0,0,3,4,1,12,3,14,1,12,1,8,2,8,1,
-    10,1,10,1,114,152,0,0,0,99,1,0,0,0,0,0,
+    10,1,10,1,114,153,0,0,0,99,1,0,0,0,0,0,
     0,0,2,0,0,0,4,0,0,0,67,0,0,0,115,106,
     0,0,0,124,0,106,0,100,1,107,8,114,14,100,2,110,
     4,124,0,106,0,125,1,124,0,106,1,100,1,107,8,114,
@@ -917,12 +917,12 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     101,32,123,33,114,125,32,110,111,116,32,105,110,32,115,121,
     115,46,109,111,100,117,108,101,115,114,16,0,0,0,78,250,
     14,109,105,115,115,105,110,103,32,108,111,97,100,101,114,84,
-    114,143,0,0,0,114,150,0,0,0,41,14,114,17,0,0,
+    114,144,0,0,0,114,151,0,0,0,41,14,114,17,0,0,
     0,114,50,0,0,0,114,15,0,0,0,114,92,0,0,0,
     114,34,0,0,0,114,45,0,0,0,114,79,0,0,0,114,
-    109,0,0,0,114,117,0,0,0,114,148,0,0,0,114,4,
+    109,0,0,0,114,117,0,0,0,114,149,0,0,0,114,4,
     0,0,0,218,11,108,111,97,100,95,109,111,100,117,108,101,
-    114,150,0,0,0,218,3,112,111,112,41,4,114,95,0,0,
+    114,151,0,0,0,218,3,112,111,112,41,4,114,95,0,0,
     0,114,96,0,0,0,114,17,0,0,0,218,3,109,115,103,
     114,10,0,0,0,114,10,0,0,0,114,11,0,0,0,114,
     93,0,0,0,71,2,0,0,115,34,0,0,0,0,2,6,
@@ -948,20 +948,20 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     114,22,122,10,124,0,124,1,95,13,87,0,110,22,4,0,
     116,8,107,10,144,1,114,20,1,0,1,0,1,0,89,0,
     110,2,88,0,124,1,83,0,41,7,78,114,98,0,0,0,
-    114,145,0,0,0,114,141,0,0,0,114,128,0,0,0,114,
+    114,146,0,0,0,114,141,0,0,0,114,128,0,0,0,114,
     22,0,0,0,114,105,0,0,0,41,14,114,109,0,0,0,
-    114,155,0,0,0,114,17,0,0,0,114,15,0,0,0,114,
-    92,0,0,0,114,156,0,0,0,114,6,0,0,0,114,98,
-    0,0,0,114,106,0,0,0,114,1,0,0,0,114,145,0,
+    114,156,0,0,0,114,17,0,0,0,114,15,0,0,0,114,
+    92,0,0,0,114,157,0,0,0,114,6,0,0,0,114,98,
+    0,0,0,114,106,0,0,0,114,1,0,0,0,114,146,0,
     0,0,114,4,0,0,0,114,129,0,0,0,114,105,0,0,
-    0,114,151,0,0,0,114,10,0,0,0,114,10,0,0,0,
+    0,114,152,0,0,0,114,10,0,0,0,114,10,0,0,0,
     114,11,0,0,0,218,25,95,108,111,97,100,95,98,97,99,
     107,119,97,114,100,95,99,111,109,112,97,116,105,98,108,101,
     101,2,0,0,115,54,0,0,0,0,4,2,1,18,1,6,
     1,12,1,14,1,12,1,8,3,14,1,12,1,16,1,2,
     1,12,1,14,1,6,1,16,1,2,4,8,1,10,1,22,
     1,14,1,6,1,18,1,2,1,10,1,16,1,6,1,114,
-    158,0,0,0,99,1,0,0,0,0,0,0,0,2,0,0,
+    159,0,0,0,99,1,0,0,0,0,0,0,0,2,0,0,
     0,11,0,0,0,67,0,0,0,115,220,0,0,0,124,0,
     106,0,100,0,107,9,114,30,116,1,124,0,106,0,100,1,
     131,2,115,30,116,2,124,0,131,1,83,0,116,3,124,0,
@@ -976,21 +976,21 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     116,5,106,6,160,12,124,0,106,7,161,1,125,1,124,1,
     116,5,106,6,124,0,106,7,60,0,116,13,100,5,124,0,
     106,7,124,0,106,0,131,3,1,0,87,0,53,0,100,6,
-    124,0,95,4,88,0,124,1,83,0,41,7,78,114,150,0,
-    0,0,84,114,154,0,0,0,114,16,0,0,0,122,18,105,
+    124,0,95,4,88,0,124,1,83,0,41,7,78,114,151,0,
+    0,0,84,114,155,0,0,0,114,16,0,0,0,122,18,105,
     109,112,111,114,116,32,123,33,114,125,32,35,32,123,33,114,
-    125,70,41,14,114,109,0,0,0,114,4,0,0,0,114,158,
-    0,0,0,114,152,0,0,0,90,13,95,105,110,105,116,105,
+    125,70,41,14,114,109,0,0,0,114,4,0,0,0,114,159,
+    0,0,0,114,153,0,0,0,90,13,95,105,110,105,116,105,
     97,108,105,122,105,110,103,114,15,0,0,0,114,92,0,0,
     0,114,17,0,0,0,114,117,0,0,0,114,79,0,0,0,
-    114,150,0,0,0,114,63,0,0,0,114,156,0,0,0,114,
-    76,0,0,0,114,151,0,0,0,114,10,0,0,0,114,10,
+    114,151,0,0,0,114,63,0,0,0,114,157,0,0,0,114,
+    76,0,0,0,114,152,0,0,0,114,10,0,0,0,114,10,
     0,0,0,114,11,0,0,0,218,14,95,108,111,97,100,95,
     117,110,108,111,99,107,101,100,138,2,0,0,115,46,0,0,
     0,0,2,10,2,12,1,8,2,8,5,6,1,2,1,12,
     1,2,1,10,1,10,1,16,3,16,1,6,1,2,1,14,
     1,14,1,6,1,8,5,14,1,12,1,20,2,8,2,114,
-    159,0,0,0,99,1,0,0,0,0,0,0,0,1,0,0,
+    160,0,0,0,99,1,0,0,0,0,0,0,0,1,0,0,
     0,10,0,0,0,67,0,0,0,115,42,0,0,0,116,0,
     124,0,106,1,131,1,143,22,1,0,116,2,124,0,131,1,
     87,0,2,0,53,0,81,0,82,0,163,0,83,0,81,0,
@@ -1007,7 +1007,7 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     116,32,101,120,105,115,116,105,110,103,32,109,111,100,117,108,
     101,32,103,101,116,115,10,32,32,32,32,99,108,111,98,98,
     101,114,101,100,46,10,10,32,32,32,32,78,41,3,114,50,
-    0,0,0,114,17,0,0,0,114,159,0,0,0,41,1,114,
+    0,0,0,114,17,0,0,0,114,160,0,0,0,41,1,114,
     95,0,0,0,114,10,0,0,0,114,10,0,0,0,114,11,
     0,0,0,114,94,0,0,0,180,2,0,0,115,4,0,0,
     0,0,9,12,1,114,94,0,0,0,99,0,0,0,0,0,
@@ -1054,7 +1054,7 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     100,2,141,3,83,0,100,0,83,0,100,0,83,0,41,3,
     78,122,8,98,117,105,108,116,45,105,110,114,137,0,0,0,
     41,3,114,57,0,0,0,90,10,105,115,95,98,117,105,108,
-    116,105,110,114,91,0,0,0,169,4,218,3,99,108,115,114,
+    116,105,110,114,91,0,0,0,41,4,218,3,99,108,115,114,
     81,0,0,0,218,4,112,97,116,104,218,6,116,97,114,103,
     101,116,114,10,0,0,0,114,10,0,0,0,114,11,0,0,
     0,218,9,102,105,110,100,95,115,112,101,99,213,2,0,0,
@@ -1093,7 +1093,7 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     0,0,114,45,0,0,0,114,67,0,0,0,114,57,0,0,
     0,90,14,99,114,101,97,116,101,95,98,117,105,108,116,105,
     110,41,2,114,30,0,0,0,114,95,0,0,0,114,10,0,
-    0,0,114,10,0,0,0,114,11,0,0,0,114,149,0,0,
+    0,0,114,10,0,0,0,114,11,0,0,0,114,150,0,0,
     0,234,2,0,0,115,10,0,0,0,0,3,12,1,12,1,
     4,255,6,2,122,29,66,117,105,108,116,105,110,73,109,112,
     111,114,116,101,114,46,99,114,101,97,116,101,95,109,111,100,
@@ -1104,7 +1104,7 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     32,109,111,100,117,108,101,78,41,3,114,67,0,0,0,114,
     57,0,0,0,90,12,101,120,101,99,95,98,117,105,108,116,
     105,110,41,2,114,30,0,0,0,114,96,0,0,0,114,10,
-    0,0,0,114,10,0,0,0,114,11,0,0,0,114,150,0,
+    0,0,0,114,10,0,0,0,114,11,0,0,0,114,151,0,
     0,0,242,2,0,0,115,2,0,0,0,0,3,122,27,66,
     117,105,108,116,105,110,73,109,112,111,114,116,101,114,46,101,
     120,101,99,95,109,111,100,117,108,101,99,2,0,0,0,0,
@@ -1143,627 +1143,643 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     114,3,0,0,0,218,12,115,116,97,116,105,99,109,101,116,
     104,111,100,114,99,0,0,0,218,11,99,108,97,115,115,109,
     101,116,104,111,100,114,166,0,0,0,114,167,0,0,0,114,
-    149,0,0,0,114,150,0,0,0,114,86,0,0,0,114,169,
+    150,0,0,0,114,151,0,0,0,114,86,0,0,0,114,169,
     0,0,0,114,170,0,0,0,114,115,0,0,0,114,97,0,
-    0,0,114,155,0,0,0,114,10,0,0,0,114,10,0,0,
-    0,114,10,0,0,0,114,11,0,0,0,114,160,0,0,0,
+    0,0,114,156,0,0,0,114,10,0,0,0,114,10,0,0,
+    0,114,10,0,0,0,114,11,0,0,0,114,161,0,0,0,
     195,2,0,0,115,42,0,0,0,8,2,4,7,2,1,10,
     8,2,1,12,8,2,1,12,11,2,1,10,7,2,1,10,
     4,2,1,2,1,12,4,2,1,2,1,12,4,2,1,2,
-    1,12,4,114,160,0,0,0,99,0,0,0,0,0,0,0,
-    0,0,0,0,0,4,0,0,0,64,0,0,0,115,144,0,
+    1,12,4,114,161,0,0,0,99,0,0,0,0,0,0,0,
+    0,0,0,0,0,4,0,0,0,64,0,0,0,115,148,0,
     0,0,101,0,90,1,100,0,90,2,100,1,90,3,100,2,
-    90,4,101,5,100,3,100,4,132,0,131,1,90,6,101,7,
-    100,22,100,6,100,7,132,1,131,1,90,8,101,7,100,23,
-    100,8,100,9,132,1,131,1,90,9,101,7,100,10,100,11,
-    132,0,131,1,90,10,101,5,100,12,100,13,132,0,131,1,
-    90,11,101,7,100,14,100,15,132,0,131,1,90,12,101,7,
-    101,13,100,16,100,17,132,0,131,1,131,1,90,14,101,7,
-    101,13,100,18,100,19,132,0,131,1,131,1,90,15,101,7,
-    101,13,100,20,100,21,132,0,131,1,131,1,90,16,100,5,
-    83,0,41,24,218,14,70,114,111,122,101,110,73,109,112,111,
-    114,116,101,114,122,142,77,101,116,97,32,112,97,116,104,32,
-    105,109,112,111,114,116,32,102,111,114,32,102,114,111,122,101,
-    110,32,109,111,100,117,108,101,115,46,10,10,32,32,32,32,
-    65,108,108,32,109,101,116,104,111,100,115,32,97,114,101,32,
-    101,105,116,104,101,114,32,99,108,97,115,115,32,111,114,32,
-    115,116,97,116,105,99,32,109,101,116,104,111,100,115,32,116,
-    111,32,97,118,111,105,100,32,116,104,101,32,110,101,101,100,
-    32,116,111,10,32,32,32,32,105,110,115,116,97,110,116,105,
-    97,116,101,32,116,104,101,32,99,108,97,115,115,46,10,10,
-    32,32,32,32,90,6,102,114,111,122,101,110,99,1,0,0,
-    0,0,0,0,0,1,0,0,0,4,0,0,0,67,0,0,
-    0,115,16,0,0,0,100,1,160,0,124,0,106,1,116,2,
-    106,3,161,2,83,0,41,2,114,161,0,0,0,114,153,0,
-    0,0,41,4,114,45,0,0,0,114,1,0,0,0,114,173,
-    0,0,0,114,138,0,0,0,41,1,218,1,109,114,10,0,
-    0,0,114,10,0,0,0,114,11,0,0,0,114,99,0,0,
-    0,23,3,0,0,115,2,0,0,0,0,7,122,26,70,114,
-    111,122,101,110,73,109,112,111,114,116,101,114,46,109,111,100,
-    117,108,101,95,114,101,112,114,78,99,4,0,0,0,0,0,
-    0,0,4,0,0,0,5,0,0,0,67,0,0,0,115,34,
-    0,0,0,116,0,160,1,124,1,161,1,114,26,116,2,124,
-    1,124,0,124,0,106,3,100,1,141,3,83,0,100,0,83,
-    0,100,0,83,0,41,2,78,114,137,0,0,0,41,4,114,
-    57,0,0,0,114,88,0,0,0,114,91,0,0,0,114,138,
-    0,0,0,114,162,0,0,0,114,10,0,0,0,114,10,0,
-    0,0,114,11,0,0,0,114,166,0,0,0,32,3,0,0,
-    115,6,0,0,0,0,2,10,1,16,2,122,24,70,114,111,
-    122,101,110,73,109,112,111,114,116,101,114,46,102,105,110,100,
-    95,115,112,101,99,99,3,0,0,0,0,0,0,0,3,0,
-    0,0,3,0,0,0,67,0,0,0,115,18,0,0,0,116,
-    0,160,1,124,1,161,1,114,14,124,0,83,0,100,1,83,
-    0,41,2,122,93,70,105,110,100,32,97,32,102,114,111,122,
-    101,110,32,109,111,100,117,108,101,46,10,10,32,32,32,32,
-    32,32,32,32,84,104,105,115,32,109,101,116,104,111,100,32,
-    105,115,32,100,101,112,114,101,99,97,116,101,100,46,32,32,
-    85,115,101,32,102,105,110,100,95,115,112,101,99,40,41,32,
-    105,110,115,116,101,97,100,46,10,10,32,32,32,32,32,32,
-    32,32,78,41,2,114,57,0,0,0,114,88,0,0,0,41,
-    3,114,163,0,0,0,114,81,0,0,0,114,164,0,0,0,
+    90,4,105,0,90,5,101,6,100,3,100,4,132,0,131,1,
+    90,7,101,8,100,22,100,6,100,7,132,1,131,1,90,9,
+    101,8,100,23,100,8,100,9,132,1,131,1,90,10,101,8,
+    100,10,100,11,132,0,131,1,90,11,101,6,100,12,100,13,
+    132,0,131,1,90,12,101,8,100,14,100,15,132,0,131,1,
+    90,13,101,8,101,14,100,16,100,17,132,0,131,1,131,1,
+    90,15,101,8,101,14,100,18,100,19,132,0,131,1,131,1,
+    90,16,101,8,101,14,100,20,100,21,132,0,131,1,131,1,
+    90,17,100,5,83,0,41,24,218,14,70,114,111,122,101,110,
+    73,109,112,111,114,116,101,114,122,142,77,101,116,97,32,112,
+    97,116,104,32,105,109,112,111,114,116,32,102,111,114,32,102,
+    114,111,122,101,110,32,109,111,100,117,108,101,115,46,10,10,
+    32,32,32,32,65,108,108,32,109,101,116,104,111,100,115,32,
+    97,114,101,32,101,105,116,104,101,114,32,99,108,97,115,115,
+    32,111,114,32,115,116,97,116,105,99,32,109,101,116,104,111,
+    100,115,32,116,111,32,97,118,111,105,100,32,116,104,101,32,
+    110,101,101,100,32,116,111,10,32,32,32,32,105,110,115,116,
+    97,110,116,105,97,116,101,32,116,104,101,32,99,108,97,115,
+    115,46,10,10,32,32,32,32,90,6,102,114,111,122,101,110,
+    99,1,0,0,0,0,0,0,0,1,0,0,0,4,0,0,
+    0,67,0,0,0,115,16,0,0,0,100,1,160,0,124,0,
+    106,1,116,2,106,3,161,2,83,0,41,2,114,162,0,0,
+    0,114,154,0,0,0,41,4,114,45,0,0,0,114,1,0,
+    0,0,114,173,0,0,0,114,138,0,0,0,41,1,218,1,
+    109,114,10,0,0,0,114,10,0,0,0,114,11,0,0,0,
+    114,99,0,0,0,29,3,0,0,115,2,0,0,0,0,7,
+    122,26,70,114,111,122,101,110,73,109,112,111,114,116,101,114,
+    46,109,111,100,117,108,101,95,114,101,112,114,78,99,4,0,
+    0,0,0,0,0,0,6,0,0,0,5,0,0,0,67,0,
+    0,0,115,88,0,0,0,116,0,160,1,124,1,161,1,115,
+    14,100,0,83,0,124,0,106,2,160,3,124,1,100,1,161,
+    2,125,4,124,4,100,0,107,8,114,40,100,0,83,0,116,
+    4,124,1,124,0,124,0,106,5,100,2,141,3,125,5,124,
+    4,114,84,124,4,100,3,25,0,100,0,107,9,114,84,124,
+    4,100,3,25,0,103,1,124,5,95,6,124,5,83,0,41,
+    4,78,114,10,0,0,0,114,137,0,0,0,114,37,0,0,
+    0,41,7,114,57,0,0,0,114,88,0,0,0,218,17,95,
+    115,116,100,108,105,98,95,108,111,99,97,116,105,111,110,115,
+    114,34,0,0,0,114,91,0,0,0,114,138,0,0,0,114,
+    117,0,0,0,41,6,114,163,0,0,0,114,81,0,0,0,
+    114,164,0,0,0,114,165,0,0,0,114,142,0,0,0,114,
+    95,0,0,0,114,10,0,0,0,114,10,0,0,0,114,11,
+    0,0,0,114,166,0,0,0,38,3,0,0,115,18,0,0,
+    0,0,2,10,1,4,1,14,1,8,2,4,1,16,1,16,
+    3,12,1,122,24,70,114,111,122,101,110,73,109,112,111,114,
+    116,101,114,46,102,105,110,100,95,115,112,101,99,99,3,0,
+    0,0,0,0,0,0,3,0,0,0,3,0,0,0,67,0,
+    0,0,115,22,0,0,0,124,0,160,0,124,1,161,1,100,
+    1,107,9,114,18,124,0,83,0,100,1,83,0,41,2,122,
+    93,70,105,110,100,32,97,32,102,114,111,122,101,110,32,109,
+    111,100,117,108,101,46,10,10,32,32,32,32,32,32,32,32,
+    84,104,105,115,32,109,101,116,104,111,100,32,105,115,32,100,
+    101,112,114,101,99,97,116,101,100,46,32,32,85,115,101,32,
+    102,105,110,100,95,115,112,101,99,40,41,32,105,110,115,116,
+    101,97,100,46,10,10,32,32,32,32,32,32,32,32,78,41,
+    1,114,166,0,0,0,41,3,114,163,0,0,0,114,81,0,
+    0,0,114,164,0,0,0,114,10,0,0,0,114,10,0,0,
+    0,114,11,0,0,0,114,167,0,0,0,53,3,0,0,115,
+    2,0,0,0,0,7,122,26,70,114,111,122,101,110,73,109,
+    112,111,114,116,101,114,46,102,105,110,100,95,109,111,100,117,
+    108,101,99,2,0,0,0,0,0,0,0,2,0,0,0,1,
+    0,0,0,67,0,0,0,115,4,0,0,0,100,1,83,0,
+    41,2,122,42,85,115,101,32,100,101,102,97,117,108,116,32,
+    115,101,109,97,110,116,105,99,115,32,102,111,114,32,109,111,
+    100,117,108,101,32,99,114,101,97,116,105,111,110,46,78,114,
+    10,0,0,0,41,2,114,163,0,0,0,114,95,0,0,0,
     114,10,0,0,0,114,10,0,0,0,114,11,0,0,0,114,
-    167,0,0,0,39,3,0,0,115,2,0,0,0,0,7,122,
-    26,70,114,111,122,101,110,73,109,112,111,114,116,101,114,46,
-    102,105,110,100,95,109,111,100,117,108,101,99,2,0,0,0,
-    0,0,0,0,2,0,0,0,1,0,0,0,67,0,0,0,
-    115,4,0,0,0,100,1,83,0,41,2,122,42,85,115,101,
-    32,100,101,102,97,117,108,116,32,115,101,109,97,110,116,105,
-    99,115,32,102,111,114,32,109,111,100,117,108,101,32,99,114,
-    101,97,116,105,111,110,46,78,114,10,0,0,0,41,2,114,
-    163,0,0,0,114,95,0,0,0,114,10,0,0,0,114,10,
-    0,0,0,114,11,0,0,0,114,149,0,0,0,48,3,0,
-    0,115,2,0,0,0,0,2,122,28,70,114,111,122,101,110,
-    73,109,112,111,114,116,101,114,46,99,114,101,97,116,101,95,
-    109,111,100,117,108,101,99,1,0,0,0,0,0,0,0,3,
-    0,0,0,4,0,0,0,67,0,0,0,115,64,0,0,0,
-    124,0,106,0,106,1,125,1,116,2,160,3,124,1,161,1,
-    115,36,116,4,100,1,160,5,124,1,161,1,124,1,100,2,
-    141,2,130,1,116,6,116,2,106,7,124,1,131,2,125,2,
-    116,8,124,2,124,0,106,9,131,2,1,0,100,0,83,0,
-    114,87,0,0,0,41,10,114,105,0,0,0,114,17,0,0,
-    0,114,57,0,0,0,114,88,0,0,0,114,79,0,0,0,
-    114,45,0,0,0,114,67,0,0,0,218,17,103,101,116,95,
-    102,114,111,122,101,110,95,111,98,106,101,99,116,218,4,101,
-    120,101,99,114,7,0,0,0,41,3,114,96,0,0,0,114,
-    17,0,0,0,218,4,99,111,100,101,114,10,0,0,0,114,
-    10,0,0,0,114,11,0,0,0,114,150,0,0,0,52,3,
-    0,0,115,14,0,0,0,0,2,8,1,10,1,10,1,2,
-    255,6,2,12,1,122,26,70,114,111,122,101,110,73,109,112,
-    111,114,116,101,114,46,101,120,101,99,95,109,111,100,117,108,
-    101,99,2,0,0,0,0,0,0,0,2,0,0,0,3,0,
-    0,0,67,0,0,0,115,10,0,0,0,116,0,124,0,124,
-    1,131,2,83,0,41,1,122,95,76,111,97,100,32,97,32,
-    102,114,111,122,101,110,32,109,111,100,117,108,101,46,10,10,
-    32,32,32,32,32,32,32,32,84,104,105,115,32,109,101,116,
-    104,111,100,32,105,115,32,100,101,112,114,101,99,97,116,101,
-    100,46,32,32,85,115,101,32,101,120,101,99,95,109,111,100,
-    117,108,101,40,41,32,105,110,115,116,101,97,100,46,10,10,
-    32,32,32,32,32,32,32,32,41,1,114,97,0,0,0,114,
-    168,0,0,0,114,10,0,0,0,114,10,0,0,0,114,11,
-    0,0,0,114,155,0,0,0,61,3,0,0,115,2,0,0,
-    0,0,7,122,26,70,114,111,122,101,110,73,109,112,111,114,
-    116,101,114,46,108,111,97,100,95,109,111,100,117,108,101,99,
+    150,0,0,0,62,3,0,0,115,2,0,0,0,0,2,122,
+    28,70,114,111,122,101,110,73,109,112,111,114,116,101,114,46,
+    99,114,101,97,116,101,95,109,111,100,117,108,101,99,1,0,
+    0,0,0,0,0,0,4,0,0,0,5,0,0,0,67,0,
+    0,0,115,110,0,0,0,124,0,106,0,106,1,125,1,116,
+    2,160,3,124,1,161,1,115,36,116,4,100,1,160,5,124,
+    1,161,1,124,1,100,2,141,2,130,1,116,6,116,2,106,
+    7,124,1,131,2,125,2,116,8,106,9,160,10,124,1,161,
+    1,125,3,124,3,100,0,107,9,114,94,124,3,100,3,25,
+    0,124,0,95,11,116,2,160,12,124,2,124,3,100,3,25,
+    0,161,2,1,0,116,13,124,2,124,0,106,14,131,2,1,
+    0,100,0,83,0,41,4,78,114,87,0,0,0,114,16,0,
+    0,0,114,22,0,0,0,41,15,114,105,0,0,0,114,17,
+    0,0,0,114,57,0,0,0,114,88,0,0,0,114,79,0,
+    0,0,114,45,0,0,0,114,67,0,0,0,218,17,103,101,
+    116,95,102,114,111,122,101,110,95,111,98,106,101,99,116,114,
+    173,0,0,0,114,175,0,0,0,114,34,0,0,0,114,108,
+    0,0,0,90,16,95,102,105,120,95,99,111,95,102,105,108,
+    101,110,97,109,101,218,4,101,120,101,99,114,7,0,0,0,
+    41,4,114,96,0,0,0,114,17,0,0,0,218,4,99,111,
+    100,101,114,142,0,0,0,114,10,0,0,0,114,10,0,0,
+    0,114,11,0,0,0,114,151,0,0,0,66,3,0,0,115,
+    22,0,0,0,0,2,8,1,10,1,10,1,2,255,6,2,
+    12,1,12,1,8,1,10,1,16,1,122,26,70,114,111,122,
+    101,110,73,109,112,111,114,116,101,114,46,101,120,101,99,95,
+    109,111,100,117,108,101,99,2,0,0,0,0,0,0,0,2,
+    0,0,0,3,0,0,0,67,0,0,0,115,10,0,0,0,
+    116,0,124,0,124,1,131,2,83,0,41,1,122,95,76,111,
+    97,100,32,97,32,102,114,111,122,101,110,32,109,111,100,117,
+    108,101,46,10,10,32,32,32,32,32,32,32,32,84,104,105,
+    115,32,109,101,116,104,111,100,32,105,115,32,100,101,112,114,
+    101,99,97,116,101,100,46,32,32,85,115,101,32,101,120,101,
+    99,95,109,111,100,117,108,101,40,41,32,105,110,115,116,101,
+    97,100,46,10,10,32,32,32,32,32,32,32,32,41,1,114,
+    97,0,0,0,114,168,0,0,0,114,10,0,0,0,114,10,
+    0,0,0,114,11,0,0,0,114,156,0,0,0,79,3,0,
+    0,115,2,0,0,0,0,7,122,26,70,114,111,122,101,110,
+    73,109,112,111,114,116,101,114,46,108,111,97,100,95,109,111,
+    100,117,108,101,99,2,0,0,0,0,0,0,0,2,0,0,
+    0,3,0,0,0,67,0,0,0,115,10,0,0,0,116,0,
+    160,1,124,1,161,1,83,0,41,1,122,45,82,101,116,117,
+    114,110,32,116,104,101,32,99,111,100,101,32,111,98,106,101,
+    99,116,32,102,111,114,32,116,104,101,32,102,114,111,122,101,
+    110,32,109,111,100,117,108,101,46,41,2,114,57,0,0,0,
+    114,176,0,0,0,114,168,0,0,0,114,10,0,0,0,114,
+    10,0,0,0,114,11,0,0,0,114,169,0,0,0,88,3,
+    0,0,115,2,0,0,0,0,4,122,23,70,114,111,122,101,
+    110,73,109,112,111,114,116,101,114,46,103,101,116,95,99,111,
+    100,101,99,2,0,0,0,0,0,0,0,2,0,0,0,1,
+    0,0,0,67,0,0,0,115,4,0,0,0,100,1,83,0,
+    41,2,122,54,82,101,116,117,114,110,32,78,111,110,101,32,
+    97,115,32,102,114,111,122,101,110,32,109,111,100,117,108,101,
+    115,32,100,111,32,110,111,116,32,104,97,118,101,32,115,111,
+    117,114,99,101,32,99,111,100,101,46,78,114,10,0,0,0,
+    114,168,0,0,0,114,10,0,0,0,114,10,0,0,0,114,
+    11,0,0,0,114,170,0,0,0,94,3,0,0,115,2,0,
+    0,0,0,4,122,25,70,114,111,122,101,110,73,109,112,111,
+    114,116,101,114,46,103,101,116,95,115,111,117,114,99,101,99,
     2,0,0,0,0,0,0,0,2,0,0,0,3,0,0,0,
     67,0,0,0,115,10,0,0,0,116,0,160,1,124,1,161,
-    1,83,0,41,1,122,45,82,101,116,117,114,110,32,116,104,
-    101,32,99,111,100,101,32,111,98,106,101,99,116,32,102,111,
-    114,32,116,104,101,32,102,114,111,122,101,110,32,109,111,100,
-    117,108,101,46,41,2,114,57,0,0,0,114,175,0,0,0,
-    114,168,0,0,0,114,10,0,0,0,114,10,0,0,0,114,
-    11,0,0,0,114,169,0,0,0,70,3,0,0,115,2,0,
-    0,0,0,4,122,23,70,114,111,122,101,110,73,109,112,111,
-    114,116,101,114,46,103,101,116,95,99,111,100,101,99,2,0,
-    0,0,0,0,0,0,2,0,0,0,1,0,0,0,67,0,
-    0,0,115,4,0,0,0,100,1,83,0,41,2,122,54,82,
-    101,116,117,114,110,32,78,111,110,101,32,97,115,32,102,114,
-    111,122,101,110,32,109,111,100,117,108,101,115,32,100,111,32,
-    110,111,116,32,104,97,118,101,32,115,111,117,114,99,101,32,
-    99,111,100,101,46,78,114,10,0,0,0,114,168,0,0,0,
-    114,10,0,0,0,114,10,0,0,0,114,11,0,0,0,114,
-    170,0,0,0,76,3,0,0,115,2,0,0,0,0,4,122,
-    25,70,114,111,122,101,110,73,109,112,111,114,116,101,114,46,
-    103,101,116,95,115,111,117,114,99,101,99,2,0,0,0,0,
-    0,0,0,2,0,0,0,3,0,0,0,67,0,0,0,115,
-    10,0,0,0,116,0,160,1,124,1,161,1,83,0,41,1,
-    122,46,82,101,116,117,114,110,32,84,114,117,101,32,105,102,
-    32,116,104,101,32,102,114,111,122,101,110,32,109,111,100,117,
-    108,101,32,105,115,32,97,32,112,97,99,107,97,103,101,46,
-    41,2,114,57,0,0,0,90,17,105,115,95,102,114,111,122,
-    101,110,95,112,97,99,107,97,103,101,114,168,0,0,0,114,
-    10,0,0,0,114,10,0,0,0,114,11,0,0,0,114,115,
-    0,0,0,82,3,0,0,115,2,0,0,0,0,4,122,25,
-    70,114,111,122,101,110,73,109,112,111,114,116,101,114,46,105,
-    115,95,112,97,99,107,97,103,101,41,2,78,78,41,1,78,
-    41,17,114,1,0,0,0,114,0,0,0,0,114,2,0,0,
-    0,114,3,0,0,0,114,138,0,0,0,114,171,0,0,0,
-    114,99,0,0,0,114,172,0,0,0,114,166,0,0,0,114,
-    167,0,0,0,114,149,0,0,0,114,150,0,0,0,114,155,
-    0,0,0,114,90,0,0,0,114,169,0,0,0,114,170,0,
-    0,0,114,115,0,0,0,114,10,0,0,0,114,10,0,0,
-    0,114,10,0,0,0,114,11,0,0,0,114,173,0,0,0,
-    12,3,0,0,115,46,0,0,0,8,2,4,7,4,2,2,
-    1,10,8,2,1,12,6,2,1,12,8,2,1,10,3,2,
-    1,10,8,2,1,10,8,2,1,2,1,12,4,2,1,2,
-    1,12,4,2,1,2,1,114,173,0,0,0,99,0,0,0,
-    0,0,0,0,0,0,0,0,0,2,0,0,0,64,0,0,
-    0,115,32,0,0,0,101,0,90,1,100,0,90,2,100,1,
-    90,3,100,2,100,3,132,0,90,4,100,4,100,5,132,0,
-    90,5,100,6,83,0,41,7,218,18,95,73,109,112,111,114,
-    116,76,111,99,107,67,111,110,116,101,120,116,122,36,67,111,
-    110,116,101,120,116,32,109,97,110,97,103,101,114,32,102,111,
-    114,32,116,104,101,32,105,109,112,111,114,116,32,108,111,99,
-    107,46,99,1,0,0,0,0,0,0,0,1,0,0,0,2,
-    0,0,0,67,0,0,0,115,12,0,0,0,116,0,160,1,
-    161,0,1,0,100,1,83,0,41,2,122,24,65,99,113,117,
-    105,114,101,32,116,104,101,32,105,109,112,111,114,116,32,108,
-    111,99,107,46,78,41,2,114,57,0,0,0,114,58,0,0,
-    0,114,47,0,0,0,114,10,0,0,0,114,10,0,0,0,
-    114,11,0,0,0,114,54,0,0,0,95,3,0,0,115,2,
-    0,0,0,0,2,122,28,95,73,109,112,111,114,116,76,111,
-    99,107,67,111,110,116,101,120,116,46,95,95,101,110,116,101,
-    114,95,95,99,4,0,0,0,0,0,0,0,4,0,0,0,
-    2,0,0,0,67,0,0,0,115,12,0,0,0,116,0,160,
-    1,161,0,1,0,100,1,83,0,41,2,122,60,82,101,108,
-    101,97,115,101,32,116,104,101,32,105,109,112,111,114,116,32,
-    108,111,99,107,32,114,101,103,97,114,100,108,101,115,115,32,
-    111,102,32,97,110,121,32,114,97,105,115,101,100,32,101,120,
-    99,101,112,116,105,111,110,115,46,78,41,2,114,57,0,0,
-    0,114,60,0,0,0,41,4,114,30,0,0,0,90,8,101,
-    120,99,95,116,121,112,101,90,9,101,120,99,95,118,97,108,
-    117,101,90,13,101,120,99,95,116,114,97,99,101,98,97,99,
-    107,114,10,0,0,0,114,10,0,0,0,114,11,0,0,0,
-    114,56,0,0,0,99,3,0,0,115,2,0,0,0,0,2,
-    122,27,95,73,109,112,111,114,116,76,111,99,107,67,111,110,
-    116,101,120,116,46,95,95,101,120,105,116,95,95,78,41,6,
-    114,1,0,0,0,114,0,0,0,0,114,2,0,0,0,114,
-    3,0,0,0,114,54,0,0,0,114,56,0,0,0,114,10,
-    0,0,0,114,10,0,0,0,114,10,0,0,0,114,11,0,
-    0,0,114,178,0,0,0,91,3,0,0,115,6,0,0,0,
-    8,2,4,2,8,4,114,178,0,0,0,99,3,0,0,0,
-    0,0,0,0,5,0,0,0,5,0,0,0,67,0,0,0,
-    115,64,0,0,0,124,1,160,0,100,1,124,2,100,2,24,
-    0,161,2,125,3,116,1,124,3,131,1,124,2,107,0,114,
-    36,116,2,100,3,131,1,130,1,124,3,100,4,25,0,125,
-    4,124,0,114,60,100,5,160,3,124,4,124,0,161,2,83,
-    0,124,4,83,0,41,6,122,50,82,101,115,111,108,118,101,
-    32,97,32,114,101,108,97,116,105,118,101,32,109,111,100,117,
-    108,101,32,110,97,109,101,32,116,111,32,97,110,32,97,98,
-    115,111,108,117,116,101,32,111,110,101,46,114,128,0,0,0,
-    114,37,0,0,0,122,50,97,116,116,101,109,112,116,101,100,
-    32,114,101,108,97,116,105,118,101,32,105,109,112,111,114,116,
-    32,98,101,121,111,110,100,32,116,111,112,45,108,101,118,101,
-    108,32,112,97,99,107,97,103,101,114,22,0,0,0,250,5,
-    123,125,46,123,125,41,4,218,6,114,115,112,108,105,116,218,
-    3,108,101,110,218,10,86,97,108,117,101,69,114,114,111,114,
-    114,45,0,0,0,41,5,114,17,0,0,0,218,7,112,97,
-    99,107,97,103,101,218,5,108,101,118,101,108,90,4,98,105,
-    116,115,90,4,98,97,115,101,114,10,0,0,0,114,10,0,
-    0,0,114,11,0,0,0,218,13,95,114,101,115,111,108,118,
-    101,95,110,97,109,101,104,3,0,0,115,10,0,0,0,0,
-    2,16,1,12,1,8,1,8,1,114,185,0,0,0,99,3,
-    0,0,0,0,0,0,0,4,0,0,0,4,0,0,0,67,
-    0,0,0,115,34,0,0,0,124,0,160,0,124,1,124,2,
-    161,2,125,3,124,3,100,0,107,8,114,24,100,0,83,0,
-    116,1,124,1,124,3,131,2,83,0,114,13,0,0,0,41,
-    2,114,167,0,0,0,114,91,0,0,0,41,4,218,6,102,
-    105,110,100,101,114,114,17,0,0,0,114,164,0,0,0,114,
-    109,0,0,0,114,10,0,0,0,114,10,0,0,0,114,11,
-    0,0,0,218,17,95,102,105,110,100,95,115,112,101,99,95,
-    108,101,103,97,99,121,113,3,0,0,115,8,0,0,0,0,
-    3,12,1,8,1,4,1,114,187,0,0,0,99,3,0,0,
-    0,0,0,0,0,10,0,0,0,10,0,0,0,67,0,0,
-    0,115,12,1,0,0,116,0,106,1,125,3,124,3,100,1,
-    107,8,114,22,116,2,100,2,131,1,130,1,124,3,115,38,
-    116,3,160,4,100,3,116,5,161,2,1,0,124,0,116,0,
-    106,6,107,6,125,4,124,3,68,0,93,210,125,5,116,7,
-    131,0,143,84,1,0,122,10,124,5,106,8,125,6,87,0,
-    110,54,4,0,116,9,107,10,114,128,1,0,1,0,1,0,
-    116,10,124,5,124,0,124,1,131,3,125,7,124,7,100,1,
-    107,8,114,124,89,0,87,0,53,0,81,0,82,0,163,0,
-    113,52,89,0,110,14,88,0,124,6,124,0,124,1,124,2,
-    131,3,125,7,87,0,53,0,81,0,82,0,88,0,124,7,
-    100,1,107,9,114,52,124,4,144,0,115,254,124,0,116,0,
-    106,6,107,6,144,0,114,254,116,0,106,6,124,0,25,0,
-    125,8,122,10,124,8,106,11,125,9,87,0,110,28,4,0,
-    116,9,107,10,114,226,1,0,1,0,1,0,124,7,6,0,
-    89,0,2,0,1,0,83,0,88,0,124,9,100,1,107,8,
-    114,244,124,7,2,0,1,0,83,0,124,9,2,0,1,0,
-    83,0,113,52,124,7,2,0,1,0,83,0,113,52,100,1,
-    83,0,41,4,122,21,70,105,110,100,32,97,32,109,111,100,
-    117,108,101,39,115,32,115,112,101,99,46,78,122,53,115,121,
-    115,46,109,101,116,97,95,112,97,116,104,32,105,115,32,78,
-    111,110,101,44,32,80,121,116,104,111,110,32,105,115,32,108,
-    105,107,101,108,121,32,115,104,117,116,116,105,110,103,32,100,
-    111,119,110,122,22,115,121,115,46,109,101,116,97,95,112,97,
-    116,104,32,105,115,32,101,109,112,116,121,41,12,114,15,0,
-    0,0,218,9,109,101,116,97,95,112,97,116,104,114,79,0,
-    0,0,218,9,95,119,97,114,110,105,110,103,115,218,4,119,
-    97,114,110,218,13,73,109,112,111,114,116,87,97,114,110,105,
-    110,103,114,92,0,0,0,114,178,0,0,0,114,166,0,0,
-    0,114,106,0,0,0,114,187,0,0,0,114,105,0,0,0,
-    41,10,114,17,0,0,0,114,164,0,0,0,114,165,0,0,
-    0,114,188,0,0,0,90,9,105,115,95,114,101,108,111,97,
-    100,114,186,0,0,0,114,166,0,0,0,114,95,0,0,0,
-    114,96,0,0,0,114,105,0,0,0,114,10,0,0,0,114,
-    10,0,0,0,114,11,0,0,0,218,10,95,102,105,110,100,
-    95,115,112,101,99,122,3,0,0,115,54,0,0,0,0,2,
-    6,1,8,2,8,3,4,1,12,5,10,1,8,1,8,1,
-    2,1,10,1,14,1,12,1,8,1,20,2,22,1,8,2,
-    18,1,10,1,2,1,10,1,14,4,14,2,8,1,8,2,
-    10,2,10,2,114,192,0,0,0,99,3,0,0,0,0,0,
-    0,0,3,0,0,0,5,0,0,0,67,0,0,0,115,108,
-    0,0,0,116,0,124,0,116,1,131,2,115,28,116,2,100,
-    1,160,3,116,4,124,0,131,1,161,1,131,1,130,1,124,
-    2,100,2,107,0,114,44,116,5,100,3,131,1,130,1,124,
-    2,100,2,107,4,114,84,116,0,124,1,116,1,131,2,115,
-    72,116,2,100,4,131,1,130,1,110,12,124,1,115,84,116,
-    6,100,5,131,1,130,1,124,0,115,104,124,2,100,2,107,
-    2,114,104,116,5,100,6,131,1,130,1,100,7,83,0,41,
-    8,122,28,86,101,114,105,102,121,32,97,114,103,117,109,101,
-    110,116,115,32,97,114,101,32,34,115,97,110,101,34,46,122,
-    31,109,111,100,117,108,101,32,110,97,109,101,32,109,117,115,
-    116,32,98,101,32,115,116,114,44,32,110,111,116,32,123,125,
-    114,22,0,0,0,122,18,108,101,118,101,108,32,109,117,115,
-    116,32,98,101,32,62,61,32,48,122,31,95,95,112,97,99,
-    107,97,103,101,95,95,32,110,111,116,32,115,101,116,32,116,
-    111,32,97,32,115,116,114,105,110,103,122,54,97,116,116,101,
-    109,112,116,101,100,32,114,101,108,97,116,105,118,101,32,105,
-    109,112,111,114,116,32,119,105,116,104,32,110,111,32,107,110,
-    111,119,110,32,112,97,114,101,110,116,32,112,97,99,107,97,
-    103,101,122,17,69,109,112,116,121,32,109,111,100,117,108,101,
-    32,110,97,109,101,78,41,7,218,10,105,115,105,110,115,116,
-    97,110,99,101,218,3,115,116,114,218,9,84,121,112,101,69,
-    114,114,111,114,114,45,0,0,0,114,14,0,0,0,114,182,
-    0,0,0,114,79,0,0,0,169,3,114,17,0,0,0,114,
-    183,0,0,0,114,184,0,0,0,114,10,0,0,0,114,10,
-    0,0,0,114,11,0,0,0,218,13,95,115,97,110,105,116,
-    121,95,99,104,101,99,107,169,3,0,0,115,22,0,0,0,
-    0,2,10,1,18,1,8,1,8,1,8,1,10,1,10,1,
-    4,1,8,2,12,1,114,197,0,0,0,122,16,78,111,32,
-    109,111,100,117,108,101,32,110,97,109,101,100,32,122,4,123,
-    33,114,125,99,2,0,0,0,0,0,0,0,8,0,0,0,
-    8,0,0,0,67,0,0,0,115,220,0,0,0,100,0,125,
-    2,124,0,160,0,100,1,161,1,100,2,25,0,125,3,124,
-    3,114,134,124,3,116,1,106,2,107,7,114,42,116,3,124,
-    1,124,3,131,2,1,0,124,0,116,1,106,2,107,6,114,
-    62,116,1,106,2,124,0,25,0,83,0,116,1,106,2,124,
-    3,25,0,125,4,122,10,124,4,106,4,125,2,87,0,110,
-    50,4,0,116,5,107,10,114,132,1,0,1,0,1,0,116,
-    6,100,3,23,0,160,7,124,0,124,3,161,2,125,5,116,
-    8,124,5,124,0,100,4,141,2,100,0,130,2,89,0,110,
-    2,88,0,116,9,124,0,124,2,131,2,125,6,124,6,100,
-    0,107,8,114,172,116,8,116,6,160,7,124,0,161,1,124,
-    0,100,4,141,2,130,1,110,8,116,10,124,6,131,1,125,
-    7,124,3,114,216,116,1,106,2,124,3,25,0,125,4,116,
-    11,124,4,124,0,160,0,100,1,161,1,100,5,25,0,124,
-    7,131,3,1,0,124,7,83,0,41,6,78,114,128,0,0,
-    0,114,22,0,0,0,122,23,59,32,123,33,114,125,32,105,
-    115,32,110,111,116,32,97,32,112,97,99,107,97,103,101,114,
-    16,0,0,0,233,2,0,0,0,41,12,114,129,0,0,0,
-    114,15,0,0,0,114,92,0,0,0,114,67,0,0,0,114,
-    141,0,0,0,114,106,0,0,0,218,8,95,69,82,82,95,
-    77,83,71,114,45,0,0,0,218,19,77,111,100,117,108,101,
-    78,111,116,70,111,117,110,100,69,114,114,111,114,114,192,0,
-    0,0,114,159,0,0,0,114,5,0,0,0,41,8,114,17,
-    0,0,0,218,7,105,109,112,111,114,116,95,114,164,0,0,
-    0,114,130,0,0,0,90,13,112,97,114,101,110,116,95,109,
-    111,100,117,108,101,114,157,0,0,0,114,95,0,0,0,114,
-    96,0,0,0,114,10,0,0,0,114,10,0,0,0,114,11,
-    0,0,0,218,23,95,102,105,110,100,95,97,110,100,95,108,
-    111,97,100,95,117,110,108,111,99,107,101,100,188,3,0,0,
-    115,42,0,0,0,0,1,4,1,14,1,4,1,10,1,10,
-    2,10,1,10,1,10,1,2,1,10,1,14,1,16,1,20,
-    1,10,1,8,1,20,2,8,1,4,2,10,1,22,1,114,
-    202,0,0,0,99,2,0,0,0,0,0,0,0,4,0,0,
-    0,10,0,0,0,67,0,0,0,115,106,0,0,0,116,0,
-    124,0,131,1,143,50,1,0,116,1,106,2,160,3,124,0,
-    116,4,161,2,125,2,124,2,116,4,107,8,114,54,116,5,
-    124,0,124,1,131,2,87,0,2,0,53,0,81,0,82,0,
-    163,0,83,0,87,0,53,0,81,0,82,0,88,0,124,2,
-    100,1,107,8,114,94,100,2,160,6,124,0,161,1,125,3,
-    116,7,124,3,124,0,100,3,141,2,130,1,116,8,124,0,
-    131,1,1,0,124,2,83,0,41,4,122,25,70,105,110,100,
-    32,97,110,100,32,108,111,97,100,32,116,104,101,32,109,111,
-    100,117,108,101,46,78,122,40,105,109,112,111,114,116,32,111,
-    102,32,123,125,32,104,97,108,116,101,100,59,32,78,111,110,
-    101,32,105,110,32,115,121,115,46,109,111,100,117,108,101,115,
-    114,16,0,0,0,41,9,114,50,0,0,0,114,15,0,0,
-    0,114,92,0,0,0,114,34,0,0,0,218,14,95,78,69,
-    69,68,83,95,76,79,65,68,73,78,71,114,202,0,0,0,
-    114,45,0,0,0,114,200,0,0,0,114,65,0,0,0,41,
-    4,114,17,0,0,0,114,201,0,0,0,114,96,0,0,0,
-    114,75,0,0,0,114,10,0,0,0,114,10,0,0,0,114,
-    11,0,0,0,218,14,95,102,105,110,100,95,97,110,100,95,
-    108,111,97,100,218,3,0,0,115,22,0,0,0,0,2,10,
-    1,14,1,8,1,32,2,8,1,4,1,2,255,4,2,12,
-    2,8,1,114,204,0,0,0,114,22,0,0,0,99,3,0,
-    0,0,0,0,0,0,3,0,0,0,4,0,0,0,67,0,
-    0,0,115,42,0,0,0,116,0,124,0,124,1,124,2,131,
-    3,1,0,124,2,100,1,107,4,114,32,116,1,124,0,124,
-    1,124,2,131,3,125,0,116,2,124,0,116,3,131,2,83,
-    0,41,2,97,50,1,0,0,73,109,112,111,114,116,32,97,
-    110,100,32,114,101,116,117,114,110,32,116,104,101,32,109,111,
-    100,117,108,101,32,98,97,115,101,100,32,111,110,32,105,116,
-    115,32,110,97,109,101,44,32,116,104,101,32,112,97,99,107,
-    97,103,101,32,116,104,101,32,99,97,108,108,32,105,115,10,
-    32,32,32,32,98,101,105,110,103,32,109,97,100,101,32,102,
-    114,111,109,44,32,97,110,100,32,116,104,101,32,108,101,118,
-    101,108,32,97,100,106,117,115,116,109,101,110,116,46,10,10,
-    32,32,32,32,84,104,105,115,32,102,117,110,99,116,105,111,
-    110,32,114,101,112,114,101,115,101,110,116,115,32,116,104,101,
-    32,103,114,101,97,116,101,115,116,32,99,111,109,109,111,110,
-    32,100,101,110,111,109,105,110,97,116,111,114,32,111,102,32,
-    102,117,110,99,116,105,111,110,97,108,105,116,121,10,32,32,
-    32,32,98,101,116,119,101,101,110,32,105,109,112,111,114,116,
-    95,109,111,100,117,108,101,32,97,110,100,32,95,95,105,109,
-    112,111,114,116,95,95,46,32,84,104,105,115,32,105,110,99,
-    108,117,100,101,115,32,115,101,116,116,105,110,103,32,95,95,
-    112,97,99,107,97,103,101,95,95,32,105,102,10,32,32,32,
-    32,116,104,101,32,108,111,97,100,101,114,32,100,105,100,32,
-    110,111,116,46,10,10,32,32,32,32,114,22,0,0,0,41,
-    4,114,197,0,0,0,114,185,0,0,0,114,204,0,0,0,
-    218,11,95,103,99,100,95,105,109,112,111,114,116,114,196,0,
+    1,83,0,41,1,122,46,82,101,116,117,114,110,32,84,114,
+    117,101,32,105,102,32,116,104,101,32,102,114,111,122,101,110,
+    32,109,111,100,117,108,101,32,105,115,32,97,32,112,97,99,
+    107,97,103,101,46,41,2,114,57,0,0,0,90,17,105,115,
+    95,102,114,111,122,101,110,95,112,97,99,107,97,103,101,114,
+    168,0,0,0,114,10,0,0,0,114,10,0,0,0,114,11,
+    0,0,0,114,115,0,0,0,100,3,0,0,115,2,0,0,
+    0,0,4,122,25,70,114,111,122,101,110,73,109,112,111,114,
+    116,101,114,46,105,115,95,112,97,99,107,97,103,101,41,2,
+    78,78,41,1,78,41,18,114,1,0,0,0,114,0,0,0,
+    0,114,2,0,0,0,114,3,0,0,0,114,138,0,0,0,
+    114,175,0,0,0,114,171,0,0,0,114,99,0,0,0,114,
+    172,0,0,0,114,166,0,0,0,114,167,0,0,0,114,150,
+    0,0,0,114,151,0,0,0,114,156,0,0,0,114,90,0,
+    0,0,114,169,0,0,0,114,170,0,0,0,114,115,0,0,
+    0,114,10,0,0,0,114,10,0,0,0,114,10,0,0,0,
+    114,11,0,0,0,114,173,0,0,0,12,3,0,0,115,48,
+    0,0,0,8,2,4,7,4,6,4,2,2,1,10,8,2,
+    1,12,14,2,1,12,8,2,1,10,3,2,1,10,12,2,
+    1,10,8,2,1,2,1,12,4,2,1,2,1,12,4,2,
+    1,2,1,114,173,0,0,0,99,0,0,0,0,0,0,0,
+    0,0,0,0,0,2,0,0,0,64,0,0,0,115,32,0,
+    0,0,101,0,90,1,100,0,90,2,100,1,90,3,100,2,
+    100,3,132,0,90,4,100,4,100,5,132,0,90,5,100,6,
+    83,0,41,7,218,18,95,73,109,112,111,114,116,76,111,99,
+    107,67,111,110,116,101,120,116,122,36,67,111,110,116,101,120,
+    116,32,109,97,110,97,103,101,114,32,102,111,114,32,116,104,
+    101,32,105,109,112,111,114,116,32,108,111,99,107,46,99,1,
+    0,0,0,0,0,0,0,1,0,0,0,2,0,0,0,67,
+    0,0,0,115,12,0,0,0,116,0,160,1,161,0,1,0,
+    100,1,83,0,41,2,122,24,65,99,113,117,105,114,101,32,
+    116,104,101,32,105,109,112,111,114,116,32,108,111,99,107,46,
+    78,41,2,114,57,0,0,0,114,58,0,0,0,114,47,0,
     0,0,114,10,0,0,0,114,10,0,0,0,114,11,0,0,
-    0,114,205,0,0,0,234,3,0,0,115,8,0,0,0,0,
-    9,12,1,8,1,12,1,114,205,0,0,0,169,1,218,9,
-    114,101,99,117,114,115,105,118,101,99,3,0,0,0,1,0,
-    0,0,8,0,0,0,11,0,0,0,67,0,0,0,115,226,
-    0,0,0,124,1,68,0,93,216,125,4,116,0,124,4,116,
-    1,131,2,115,66,124,3,114,34,124,0,106,2,100,1,23,
-    0,125,5,110,4,100,2,125,5,116,3,100,3,124,5,155,
-    0,100,4,116,4,124,4,131,1,106,2,155,0,157,4,131,
-    1,130,1,110,154,124,4,100,5,107,2,114,108,124,3,115,
-    106,116,5,124,0,100,6,131,2,114,106,116,6,124,0,124,
-    0,106,7,124,2,100,7,100,8,141,4,1,0,110,112,116,
-    5,124,0,124,4,131,2,115,220,100,9,160,8,124,0,106,
-    2,124,4,161,2,125,6,122,14,116,9,124,2,124,6,131,
-    2,1,0,87,0,110,72,4,0,116,10,107,10,114,218,1,
-    0,125,7,1,0,122,42,124,7,106,11,124,6,107,2,114,
-    200,116,12,106,13,160,14,124,6,116,15,161,2,100,10,107,
-    9,114,200,87,0,89,0,162,8,113,4,130,0,87,0,53,
-    0,100,10,125,7,126,7,88,0,89,0,110,2,88,0,113,
-    4,124,0,83,0,41,11,122,238,70,105,103,117,114,101,32,
-    111,117,116,32,119,104,97,116,32,95,95,105,109,112,111,114,
-    116,95,95,32,115,104,111,117,108,100,32,114,101,116,117,114,
-    110,46,10,10,32,32,32,32,84,104,101,32,105,109,112,111,
-    114,116,95,32,112,97,114,97,109,101,116,101,114,32,105,115,
-    32,97,32,99,97,108,108,97,98,108,101,32,119,104,105,99,
-    104,32,116,97,107,101,115,32,116,104,101,32,110,97,109,101,
-    32,111,102,32,109,111,100,117,108,101,32,116,111,10,32,32,
-    32,32,105,109,112,111,114,116,46,32,73,116,32,105,115,32,
-    114,101,113,117,105,114,101,100,32,116,111,32,100,101,99,111,
-    117,112,108,101,32,116,104,101,32,102,117,110,99,116,105,111,
-    110,32,102,114,111,109,32,97,115,115,117,109,105,110,103,32,
-    105,109,112,111,114,116,108,105,98,39,115,10,32,32,32,32,
-    105,109,112,111,114,116,32,105,109,112,108,101,109,101,110,116,
-    97,116,105,111,110,32,105,115,32,100,101,115,105,114,101,100,
-    46,10,10,32,32,32,32,122,8,46,95,95,97,108,108,95,
-    95,122,13,96,96,102,114,111,109,32,108,105,115,116,39,39,
-    122,8,73,116,101,109,32,105,110,32,122,18,32,109,117,115,
-    116,32,98,101,32,115,116,114,44,32,110,111,116,32,250,1,
-    42,218,7,95,95,97,108,108,95,95,84,114,206,0,0,0,
-    114,179,0,0,0,78,41,16,114,193,0,0,0,114,194,0,
-    0,0,114,1,0,0,0,114,195,0,0,0,114,14,0,0,
-    0,114,4,0,0,0,218,16,95,104,97,110,100,108,101,95,
-    102,114,111,109,108,105,115,116,114,209,0,0,0,114,45,0,
-    0,0,114,67,0,0,0,114,200,0,0,0,114,17,0,0,
-    0,114,15,0,0,0,114,92,0,0,0,114,34,0,0,0,
-    114,203,0,0,0,41,8,114,96,0,0,0,218,8,102,114,
-    111,109,108,105,115,116,114,201,0,0,0,114,207,0,0,0,
-    218,1,120,90,5,119,104,101,114,101,90,9,102,114,111,109,
-    95,110,97,109,101,90,3,101,120,99,114,10,0,0,0,114,
-    10,0,0,0,114,11,0,0,0,114,210,0,0,0,249,3,
-    0,0,115,44,0,0,0,0,10,8,1,10,1,4,1,12,
-    2,4,1,28,2,8,1,14,1,10,1,2,255,8,2,10,
-    1,14,1,2,1,14,1,16,4,10,1,16,255,2,2,8,
-    1,22,1,114,210,0,0,0,99,1,0,0,0,0,0,0,
-    0,3,0,0,0,6,0,0,0,67,0,0,0,115,146,0,
-    0,0,124,0,160,0,100,1,161,1,125,1,124,0,160,0,
-    100,2,161,1,125,2,124,1,100,3,107,9,114,82,124,2,
-    100,3,107,9,114,78,124,1,124,2,106,1,107,3,114,78,
-    116,2,106,3,100,4,124,1,155,2,100,5,124,2,106,1,
-    155,2,100,6,157,5,116,4,100,7,100,8,141,3,1,0,
-    124,1,83,0,124,2,100,3,107,9,114,96,124,2,106,1,
-    83,0,116,2,106,3,100,9,116,4,100,7,100,8,141,3,
-    1,0,124,0,100,10,25,0,125,1,100,11,124,0,107,7,
-    114,142,124,1,160,5,100,12,161,1,100,13,25,0,125,1,
-    124,1,83,0,41,14,122,167,67,97,108,99,117,108,97,116,
-    101,32,119,104,97,116,32,95,95,112,97,99,107,97,103,101,
-    95,95,32,115,104,111,117,108,100,32,98,101,46,10,10,32,
-    32,32,32,95,95,112,97,99,107,97,103,101,95,95,32,105,
-    115,32,110,111,116,32,103,117,97,114,97,110,116,101,101,100,
-    32,116,111,32,98,101,32,100,101,102,105,110,101,100,32,111,
-    114,32,99,111,117,108,100,32,98,101,32,115,101,116,32,116,
-    111,32,78,111,110,101,10,32,32,32,32,116,111,32,114,101,
-    112,114,101,115,101,110,116,32,116,104,97,116,32,105,116,115,
-    32,112,114,111,112,101,114,32,118,97,108,117,101,32,105,115,
-    32,117,110,107,110,111,119,110,46,10,10,32,32,32,32,114,
-    145,0,0,0,114,105,0,0,0,78,122,32,95,95,112,97,
-    99,107,97,103,101,95,95,32,33,61,32,95,95,115,112,101,
-    99,95,95,46,112,97,114,101,110,116,32,40,122,4,32,33,
-    61,32,250,1,41,233,3,0,0,0,41,1,90,10,115,116,
-    97,99,107,108,101,118,101,108,122,89,99,97,110,39,116,32,
-    114,101,115,111,108,118,101,32,112,97,99,107,97,103,101,32,
-    102,114,111,109,32,95,95,115,112,101,99,95,95,32,111,114,
-    32,95,95,112,97,99,107,97,103,101,95,95,44,32,102,97,
-    108,108,105,110,103,32,98,97,99,107,32,111,110,32,95,95,
-    110,97,109,101,95,95,32,97,110,100,32,95,95,112,97,116,
-    104,95,95,114,1,0,0,0,114,141,0,0,0,114,128,0,
-    0,0,114,22,0,0,0,41,6,114,34,0,0,0,114,130,
-    0,0,0,114,189,0,0,0,114,190,0,0,0,114,191,0,
-    0,0,114,129,0,0,0,41,3,218,7,103,108,111,98,97,
-    108,115,114,183,0,0,0,114,95,0,0,0,114,10,0,0,
-    0,114,10,0,0,0,114,11,0,0,0,218,17,95,99,97,
-    108,99,95,95,95,112,97,99,107,97,103,101,95,95,30,4,
-    0,0,115,38,0,0,0,0,7,10,1,10,1,8,1,18,
-    1,22,2,2,0,2,254,6,3,4,1,8,1,6,2,6,
-    2,2,0,2,254,6,3,8,1,8,1,14,1,114,216,0,
-    0,0,114,10,0,0,0,99,5,0,0,0,0,0,0,0,
-    9,0,0,0,5,0,0,0,67,0,0,0,115,180,0,0,
-    0,124,4,100,1,107,2,114,18,116,0,124,0,131,1,125,
-    5,110,36,124,1,100,2,107,9,114,30,124,1,110,2,105,
-    0,125,6,116,1,124,6,131,1,125,7,116,0,124,0,124,
-    7,124,4,131,3,125,5,124,3,115,150,124,4,100,1,107,
-    2,114,84,116,0,124,0,160,2,100,3,161,1,100,1,25,
-    0,131,1,83,0,124,0,115,92,124,5,83,0,116,3,124,
-    0,131,1,116,3,124,0,160,2,100,3,161,1,100,1,25,
-    0,131,1,24,0,125,8,116,4,106,5,124,5,106,6,100,
-    2,116,3,124,5,106,6,131,1,124,8,24,0,133,2,25,
-    0,25,0,83,0,110,26,116,7,124,5,100,4,131,2,114,
-    172,116,8,124,5,124,3,116,0,131,3,83,0,124,5,83,
-    0,100,2,83,0,41,5,97,215,1,0,0,73,109,112,111,
-    114,116,32,97,32,109,111,100,117,108,101,46,10,10,32,32,
-    32,32,84,104,101,32,39,103,108,111,98,97,108,115,39,32,
-    97,114,103,117,109,101,110,116,32,105,115,32,117,115,101,100,
-    32,116,111,32,105,110,102,101,114,32,119,104,101,114,101,32,
-    116,104,101,32,105,109,112,111,114,116,32,105,115,32,111,99,
-    99,117,114,114,105,110,103,32,102,114,111,109,10,32,32,32,
-    32,116,111,32,104,97,110,100,108,101,32,114,101,108,97,116,
-    105,118,101,32,105,109,112,111,114,116,115,46,32,84,104,101,
-    32,39,108,111,99,97,108,115,39,32,97,114,103,117,109,101,
-    110,116,32,105,115,32,105,103,110,111,114,101,100,46,32,84,
-    104,101,10,32,32,32,32,39,102,114,111,109,108,105,115,116,
-    39,32,97,114,103,117,109,101,110,116,32,115,112,101,99,105,
-    102,105,101,115,32,119,104,97,116,32,115,104,111,117,108,100,
-    32,101,120,105,115,116,32,97,115,32,97,116,116,114,105,98,
-    117,116,101,115,32,111,110,32,116,104,101,32,109,111,100,117,
-    108,101,10,32,32,32,32,98,101,105,110,103,32,105,109,112,
-    111,114,116,101,100,32,40,101,46,103,46,32,96,96,102,114,
-    111,109,32,109,111,100,117,108,101,32,105,109,112,111,114,116,
-    32,60,102,114,111,109,108,105,115,116,62,96,96,41,46,32,
-    32,84,104,101,32,39,108,101,118,101,108,39,10,32,32,32,
-    32,97,114,103,117,109,101,110,116,32,114,101,112,114,101,115,
-    101,110,116,115,32,116,104,101,32,112,97,99,107,97,103,101,
-    32,108,111,99,97,116,105,111,110,32,116,111,32,105,109,112,
-    111,114,116,32,102,114,111,109,32,105,110,32,97,32,114,101,
-    108,97,116,105,118,101,10,32,32,32,32,105,109,112,111,114,
-    116,32,40,101,46,103,46,32,96,96,102,114,111,109,32,46,
-    46,112,107,103,32,105,109,112,111,114,116,32,109,111,100,96,
-    96,32,119,111,117,108,100,32,104,97,118,101,32,97,32,39,
-    108,101,118,101,108,39,32,111,102,32,50,41,46,10,10,32,
-    32,32,32,114,22,0,0,0,78,114,128,0,0,0,114,141,
-    0,0,0,41,9,114,205,0,0,0,114,216,0,0,0,218,
-    9,112,97,114,116,105,116,105,111,110,114,181,0,0,0,114,
-    15,0,0,0,114,92,0,0,0,114,1,0,0,0,114,4,
-    0,0,0,114,210,0,0,0,41,9,114,17,0,0,0,114,
-    215,0,0,0,218,6,108,111,99,97,108,115,114,211,0,0,
-    0,114,184,0,0,0,114,96,0,0,0,90,8,103,108,111,
-    98,97,108,115,95,114,183,0,0,0,90,7,99,117,116,95,
-    111,102,102,114,10,0,0,0,114,10,0,0,0,114,11,0,
-    0,0,218,10,95,95,105,109,112,111,114,116,95,95,57,4,
-    0,0,115,30,0,0,0,0,11,8,1,10,2,16,1,8,
-    1,12,1,4,3,8,1,18,1,4,1,4,4,26,3,32,
-    1,10,1,12,2,114,219,0,0,0,99,1,0,0,0,0,
-    0,0,0,2,0,0,0,3,0,0,0,67,0,0,0,115,
-    38,0,0,0,116,0,160,1,124,0,161,1,125,1,124,1,
-    100,0,107,8,114,30,116,2,100,1,124,0,23,0,131,1,
-    130,1,116,3,124,1,131,1,83,0,41,2,78,122,25,110,
-    111,32,98,117,105,108,116,45,105,110,32,109,111,100,117,108,
-    101,32,110,97,109,101,100,32,41,4,114,160,0,0,0,114,
-    166,0,0,0,114,79,0,0,0,114,159,0,0,0,41,2,
-    114,17,0,0,0,114,95,0,0,0,114,10,0,0,0,114,
-    10,0,0,0,114,11,0,0,0,218,18,95,98,117,105,108,
-    116,105,110,95,102,114,111,109,95,110,97,109,101,94,4,0,
-    0,115,8,0,0,0,0,1,10,1,8,1,12,1,114,220,
-    0,0,0,99,2,0,0,0,0,0,0,0,10,0,0,0,
-    5,0,0,0,67,0,0,0,115,166,0,0,0,124,1,97,
-    0,124,0,97,1,116,2,116,1,131,1,125,2,116,1,106,
-    3,160,4,161,0,68,0,93,72,92,2,125,3,125,4,116,
-    5,124,4,124,2,131,2,114,26,124,3,116,1,106,6,107,
-    6,114,60,116,7,125,5,110,18,116,0,160,8,124,3,161,
-    1,114,26,116,9,125,5,110,2,113,26,116,10,124,4,124,
-    5,131,2,125,6,116,11,124,6,124,4,131,2,1,0,113,
-    26,116,1,106,3,116,12,25,0,125,7,100,1,68,0,93,
-    46,125,8,124,8,116,1,106,3,107,7,114,138,116,13,124,
-    8,131,1,125,9,110,10,116,1,106,3,124,8,25,0,125,
-    9,116,14,124,7,124,8,124,9,131,3,1,0,113,114,100,
-    2,83,0,41,3,122,250,83,101,116,117,112,32,105,109,112,
-    111,114,116,108,105,98,32,98,121,32,105,109,112,111,114,116,
-    105,110,103,32,110,101,101,100,101,100,32,98,117,105,108,116,
-    45,105,110,32,109,111,100,117,108,101,115,32,97,110,100,32,
-    105,110,106,101,99,116,105,110,103,32,116,104,101,109,10,32,
-    32,32,32,105,110,116,111,32,116,104,101,32,103,108,111,98,
-    97,108,32,110,97,109,101,115,112,97,99,101,46,10,10,32,
-    32,32,32,65,115,32,115,121,115,32,105,115,32,110,101,101,
-    100,101,100,32,102,111,114,32,115,121,115,46,109,111,100,117,
-    108,101,115,32,97,99,99,101,115,115,32,97,110,100,32,95,
-    105,109,112,32,105,115,32,110,101,101,100,101,100,32,116,111,
-    32,108,111,97,100,32,98,117,105,108,116,45,105,110,10,32,
-    32,32,32,109,111,100,117,108,101,115,44,32,116,104,111,115,
-    101,32,116,119,111,32,109,111,100,117,108,101,115,32,109,117,
-    115,116,32,98,101,32,101,120,112,108,105,99,105,116,108,121,
-    32,112,97,115,115,101,100,32,105,110,46,10,10,32,32,32,
-    32,41,3,114,23,0,0,0,114,189,0,0,0,114,64,0,
-    0,0,78,41,15,114,57,0,0,0,114,15,0,0,0,114,
-    14,0,0,0,114,92,0,0,0,218,5,105,116,101,109,115,
-    114,193,0,0,0,114,78,0,0,0,114,160,0,0,0,114,
-    88,0,0,0,114,173,0,0,0,114,142,0,0,0,114,148,
-    0,0,0,114,1,0,0,0,114,220,0,0,0,114,5,0,
-    0,0,41,10,218,10,115,121,115,95,109,111,100,117,108,101,
-    218,11,95,105,109,112,95,109,111,100,117,108,101,90,11,109,
-    111,100,117,108,101,95,116,121,112,101,114,17,0,0,0,114,
-    96,0,0,0,114,109,0,0,0,114,95,0,0,0,90,11,
-    115,101,108,102,95,109,111,100,117,108,101,90,12,98,117,105,
-    108,116,105,110,95,110,97,109,101,90,14,98,117,105,108,116,
-    105,110,95,109,111,100,117,108,101,114,10,0,0,0,114,10,
-    0,0,0,114,11,0,0,0,218,6,95,115,101,116,117,112,
-    101,4,0,0,115,36,0,0,0,0,9,4,1,4,3,8,
-    1,18,1,10,1,10,1,6,1,10,1,6,2,2,1,10,
-    1,12,3,10,1,8,1,10,1,10,2,10,1,114,224,0,
-    0,0,99,2,0,0,0,0,0,0,0,2,0,0,0,3,
-    0,0,0,67,0,0,0,115,38,0,0,0,116,0,124,0,
-    124,1,131,2,1,0,116,1,106,2,160,3,116,4,161,1,
-    1,0,116,1,106,2,160,3,116,5,161,1,1,0,100,1,
-    83,0,41,2,122,48,73,110,115,116,97,108,108,32,105,109,
-    112,111,114,116,101,114,115,32,102,111,114,32,98,117,105,108,
-    116,105,110,32,97,110,100,32,102,114,111,122,101,110,32,109,
-    111,100,117,108,101,115,78,41,6,114,224,0,0,0,114,15,
-    0,0,0,114,188,0,0,0,114,120,0,0,0,114,160,0,
-    0,0,114,173,0,0,0,41,2,114,222,0,0,0,114,223,
-    0,0,0,114,10,0,0,0,114,10,0,0,0,114,11,0,
-    0,0,218,8,95,105,110,115,116,97,108,108,136,4,0,0,
-    115,6,0,0,0,0,2,10,2,12,1,114,225,0,0,0,
-    99,0,0,0,0,0,0,0,0,1,0,0,0,4,0,0,
-    0,67,0,0,0,115,32,0,0,0,100,1,100,2,108,0,
-    125,0,124,0,97,1,124,0,160,2,116,3,106,4,116,5,
-    25,0,161,1,1,0,100,2,83,0,41,3,122,57,73,110,
-    115,116,97,108,108,32,105,109,112,111,114,116,101,114,115,32,
-    116,104,97,116,32,114,101,113,117,105,114,101,32,101,120,116,
-    101,114,110,97,108,32,102,105,108,101,115,121,115,116,101,109,
-    32,97,99,99,101,115,115,114,22,0,0,0,78,41,6,218,
-    26,95,102,114,111,122,101,110,95,105,109,112,111,114,116,108,
-    105,98,95,101,120,116,101,114,110,97,108,114,126,0,0,0,
-    114,225,0,0,0,114,15,0,0,0,114,92,0,0,0,114,
-    1,0,0,0,41,1,114,226,0,0,0,114,10,0,0,0,
-    114,10,0,0,0,114,11,0,0,0,218,27,95,105,110,115,
-    116,97,108,108,95,101,120,116,101,114,110,97,108,95,105,109,
-    112,111,114,116,101,114,115,144,4,0,0,115,6,0,0,0,
-    0,3,8,1,4,1,114,227,0,0,0,41,2,78,78,41,
-    1,78,41,2,78,114,22,0,0,0,41,4,78,78,114,10,
-    0,0,0,114,22,0,0,0,41,50,114,3,0,0,0,114,
-    126,0,0,0,114,12,0,0,0,114,18,0,0,0,114,59,
-    0,0,0,114,33,0,0,0,114,42,0,0,0,114,19,0,
-    0,0,114,20,0,0,0,114,49,0,0,0,114,50,0,0,
-    0,114,53,0,0,0,114,65,0,0,0,114,67,0,0,0,
-    114,76,0,0,0,114,86,0,0,0,114,90,0,0,0,114,
-    97,0,0,0,114,111,0,0,0,114,112,0,0,0,114,91,
-    0,0,0,114,142,0,0,0,114,148,0,0,0,114,152,0,
-    0,0,114,107,0,0,0,114,93,0,0,0,114,158,0,0,
-    0,114,159,0,0,0,114,94,0,0,0,114,160,0,0,0,
-    114,173,0,0,0,114,178,0,0,0,114,185,0,0,0,114,
-    187,0,0,0,114,192,0,0,0,114,197,0,0,0,90,15,
-    95,69,82,82,95,77,83,71,95,80,82,69,70,73,88,114,
-    199,0,0,0,114,202,0,0,0,218,6,111,98,106,101,99,
-    116,114,203,0,0,0,114,204,0,0,0,114,205,0,0,0,
-    114,210,0,0,0,114,216,0,0,0,114,219,0,0,0,114,
-    220,0,0,0,114,224,0,0,0,114,225,0,0,0,114,227,
-    0,0,0,114,10,0,0,0,114,10,0,0,0,114,10,0,
-    0,0,114,11,0,0,0,218,8,60,109,111,100,117,108,101,
-    62,1,0,0,0,115,94,0,0,0,4,24,4,2,8,8,
-    8,8,4,2,4,3,16,4,14,68,14,21,14,16,8,37,
-    8,17,8,11,14,8,8,11,8,12,8,16,8,36,14,101,
-    16,26,10,45,14,72,8,17,8,17,8,30,8,37,8,42,
-    8,15,14,73,14,79,14,13,8,9,8,9,10,47,8,16,
-    4,1,8,2,8,27,6,3,8,16,10,15,14,37,8,27,
-    10,37,8,7,8,35,8,8,
+    0,114,54,0,0,0,113,3,0,0,115,2,0,0,0,0,
+    2,122,28,95,73,109,112,111,114,116,76,111,99,107,67,111,
+    110,116,101,120,116,46,95,95,101,110,116,101,114,95,95,99,
+    4,0,0,0,0,0,0,0,4,0,0,0,2,0,0,0,
+    67,0,0,0,115,12,0,0,0,116,0,160,1,161,0,1,
+    0,100,1,83,0,41,2,122,60,82,101,108,101,97,115,101,
+    32,116,104,101,32,105,109,112,111,114,116,32,108,111,99,107,
+    32,114,101,103,97,114,100,108,101,115,115,32,111,102,32,97,
+    110,121,32,114,97,105,115,101,100,32,101,120,99,101,112,116,
+    105,111,110,115,46,78,41,2,114,57,0,0,0,114,60,0,
+    0,0,41,4,114,30,0,0,0,90,8,101,120,99,95,116,
+    121,112,101,90,9,101,120,99,95,118,97,108,117,101,90,13,
+    101,120,99,95,116,114,97,99,101,98,97,99,107,114,10,0,
+    0,0,114,10,0,0,0,114,11,0,0,0,114,56,0,0,
+    0,117,3,0,0,115,2,0,0,0,0,2,122,27,95,73,
+    109,112,111,114,116,76,111,99,107,67,111,110,116,101,120,116,
+    46,95,95,101,120,105,116,95,95,78,41,6,114,1,0,0,
+    0,114,0,0,0,0,114,2,0,0,0,114,3,0,0,0,
+    114,54,0,0,0,114,56,0,0,0,114,10,0,0,0,114,
+    10,0,0,0,114,10,0,0,0,114,11,0,0,0,114,179,
+    0,0,0,109,3,0,0,115,6,0,0,0,8,2,4,2,
+    8,4,114,179,0,0,0,99,3,0,0,0,0,0,0,0,
+    5,0,0,0,5,0,0,0,67,0,0,0,115,64,0,0,
+    0,124,1,160,0,100,1,124,2,100,2,24,0,161,2,125,
+    3,116,1,124,3,131,1,124,2,107,0,114,36,116,2,100,
+    3,131,1,130,1,124,3,100,4,25,0,125,4,124,0,114,
+    60,100,5,160,3,124,4,124,0,161,2,83,0,124,4,83,
+    0,41,6,122,50,82,101,115,111,108,118,101,32,97,32,114,
+    101,108,97,116,105,118,101,32,109,111,100,117,108,101,32,110,
+    97,109,101,32,116,111,32,97,110,32,97,98,115,111,108,117,
+    116,101,32,111,110,101,46,114,128,0,0,0,114,37,0,0,
+    0,122,50,97,116,116,101,109,112,116,101,100,32,114,101,108,
+    97,116,105,118,101,32,105,109,112,111,114,116,32,98,101,121,
+    111,110,100,32,116,111,112,45,108,101,118,101,108,32,112,97,
+    99,107,97,103,101,114,22,0,0,0,250,5,123,125,46,123,
+    125,41,4,218,6,114,115,112,108,105,116,218,3,108,101,110,
+    218,10,86,97,108,117,101,69,114,114,111,114,114,45,0,0,
+    0,41,5,114,17,0,0,0,218,7,112,97,99,107,97,103,
+    101,218,5,108,101,118,101,108,90,4,98,105,116,115,90,4,
+    98,97,115,101,114,10,0,0,0,114,10,0,0,0,114,11,
+    0,0,0,218,13,95,114,101,115,111,108,118,101,95,110,97,
+    109,101,122,3,0,0,115,10,0,0,0,0,2,16,1,12,
+    1,8,1,8,1,114,186,0,0,0,99,3,0,0,0,0,
+    0,0,0,4,0,0,0,4,0,0,0,67,0,0,0,115,
+    34,0,0,0,124,0,160,0,124,1,124,2,161,2,125,3,
+    124,3,100,0,107,8,114,24,100,0,83,0,116,1,124,1,
+    124,3,131,2,83,0,114,13,0,0,0,41,2,114,167,0,
+    0,0,114,91,0,0,0,41,4,218,6,102,105,110,100,101,
+    114,114,17,0,0,0,114,164,0,0,0,114,109,0,0,0,
+    114,10,0,0,0,114,10,0,0,0,114,11,0,0,0,218,
+    17,95,102,105,110,100,95,115,112,101,99,95,108,101,103,97,
+    99,121,131,3,0,0,115,8,0,0,0,0,3,12,1,8,
+    1,4,1,114,188,0,0,0,99,3,0,0,0,0,0,0,
+    0,10,0,0,0,10,0,0,0,67,0,0,0,115,12,1,
+    0,0,116,0,106,1,125,3,124,3,100,1,107,8,114,22,
+    116,2,100,2,131,1,130,1,124,3,115,38,116,3,160,4,
+    100,3,116,5,161,2,1,0,124,0,116,0,106,6,107,6,
+    125,4,124,3,68,0,93,210,125,5,116,7,131,0,143,84,
+    1,0,122,10,124,5,106,8,125,6,87,0,110,54,4,0,
+    116,9,107,10,114,128,1,0,1,0,1,0,116,10,124,5,
+    124,0,124,1,131,3,125,7,124,7,100,1,107,8,114,124,
+    89,0,87,0,53,0,81,0,82,0,163,0,113,52,89,0,
+    110,14,88,0,124,6,124,0,124,1,124,2,131,3,125,7,
+    87,0,53,0,81,0,82,0,88,0,124,7,100,1,107,9,
+    114,52,124,4,144,0,115,254,124,0,116,0,106,6,107,6,
+    144,0,114,254,116,0,106,6,124,0,25,0,125,8,122,10,
+    124,8,106,11,125,9,87,0,110,28,4,0,116,9,107,10,
+    114,226,1,0,1,0,1,0,124,7,6,0,89,0,2,0,
+    1,0,83,0,88,0,124,9,100,1,107,8,114,244,124,7,
+    2,0,1,0,83,0,124,9,2,0,1,0,83,0,113,52,
+    124,7,2,0,1,0,83,0,113,52,100,1,83,0,41,4,
+    122,21,70,105,110,100,32,97,32,109,111,100,117,108,101,39,
+    115,32,115,112,101,99,46,78,122,53,115,121,115,46,109,101,
+    116,97,95,112,97,116,104,32,105,115,32,78,111,110,101,44,
+    32,80,121,116,104,111,110,32,105,115,32,108,105,107,101,108,
+    121,32,115,104,117,116,116,105,110,103,32,100,111,119,110,122,
+    22,115,121,115,46,109,101,116,97,95,112,97,116,104,32,105,
+    115,32,101,109,112,116,121,41,12,114,15,0,0,0,218,9,
+    109,101,116,97,95,112,97,116,104,114,79,0,0,0,218,9,
+    95,119,97,114,110,105,110,103,115,218,4,119,97,114,110,218,
+    13,73,109,112,111,114,116,87,97,114,110,105,110,103,114,92,
+    0,0,0,114,179,0,0,0,114,166,0,0,0,114,106,0,
+    0,0,114,188,0,0,0,114,105,0,0,0,41,10,114,17,
+    0,0,0,114,164,0,0,0,114,165,0,0,0,114,189,0,
+    0,0,90,9,105,115,95,114,101,108,111,97,100,114,187,0,
+    0,0,114,166,0,0,0,114,95,0,0,0,114,96,0,0,
+    0,114,105,0,0,0,114,10,0,0,0,114,10,0,0,0,
+    114,11,0,0,0,218,10,95,102,105,110,100,95,115,112,101,
+    99,140,3,0,0,115,54,0,0,0,0,2,6,1,8,2,
+    8,3,4,1,12,5,10,1,8,1,8,1,2,1,10,1,
+    14,1,12,1,8,1,20,2,22,1,8,2,18,1,10,1,
+    2,1,10,1,14,4,14,2,8,1,8,2,10,2,10,2,
+    114,193,0,0,0,99,3,0,0,0,0,0,0,0,3,0,
+    0,0,5,0,0,0,67,0,0,0,115,108,0,0,0,116,
+    0,124,0,116,1,131,2,115,28,116,2,100,1,160,3,116,
+    4,124,0,131,1,161,1,131,1,130,1,124,2,100,2,107,
+    0,114,44,116,5,100,3,131,1,130,1,124,2,100,2,107,
+    4,114,84,116,0,124,1,116,1,131,2,115,72,116,2,100,
+    4,131,1,130,1,110,12,124,1,115,84,116,6,100,5,131,
+    1,130,1,124,0,115,104,124,2,100,2,107,2,114,104,116,
+    5,100,6,131,1,130,1,100,7,83,0,41,8,122,28,86,
+    101,114,105,102,121,32,97,114,103,117,109,101,110,116,115,32,
+    97,114,101,32,34,115,97,110,101,34,46,122,31,109,111,100,
+    117,108,101,32,110,97,109,101,32,109,117,115,116,32,98,101,
+    32,115,116,114,44,32,110,111,116,32,123,125,114,22,0,0,
+    0,122,18,108,101,118,101,108,32,109,117,115,116,32,98,101,
+    32,62,61,32,48,122,31,95,95,112,97,99,107,97,103,101,
+    95,95,32,110,111,116,32,115,101,116,32,116,111,32,97,32,
+    115,116,114,105,110,103,122,54,97,116,116,101,109,112,116,101,
+    100,32,114,101,108,97,116,105,118,101,32,105,109,112,111,114,
+    116,32,119,105,116,104,32,110,111,32,107,110,111,119,110,32,
+    112,97,114,101,110,116,32,112,97,99,107,97,103,101,122,17,
+    69,109,112,116,121,32,109,111,100,117,108,101,32,110,97,109,
+    101,78,41,7,218,10,105,115,105,110,115,116,97,110,99,101,
+    218,3,115,116,114,218,9,84,121,112,101,69,114,114,111,114,
+    114,45,0,0,0,114,14,0,0,0,114,183,0,0,0,114,
+    79,0,0,0,169,3,114,17,0,0,0,114,184,0,0,0,
+    114,185,0,0,0,114,10,0,0,0,114,10,0,0,0,114,
+    11,0,0,0,218,13,95,115,97,110,105,116,121,95,99,104,
+    101,99,107,187,3,0,0,115,22,0,0,0,0,2,10,1,
+    18,1,8,1,8,1,8,1,10,1,10,1,4,1,8,2,
+    12,1,114,198,0,0,0,122,16,78,111,32,109,111,100,117,
+    108,101,32,110,97,109,101,100,32,122,4,123,33,114,125,99,
+    2,0,0,0,0,0,0,0,8,0,0,0,8,0,0,0,
+    67,0,0,0,115,220,0,0,0,100,0,125,2,124,0,160,
+    0,100,1,161,1,100,2,25,0,125,3,124,3,114,134,124,
+    3,116,1,106,2,107,7,114,42,116,3,124,1,124,3,131,
+    2,1,0,124,0,116,1,106,2,107,6,114,62,116,1,106,
+    2,124,0,25,0,83,0,116,1,106,2,124,3,25,0,125,
+    4,122,10,124,4,106,4,125,2,87,0,110,50,4,0,116,
+    5,107,10,114,132,1,0,1,0,1,0,116,6,100,3,23,
+    0,160,7,124,0,124,3,161,2,125,5,116,8,124,5,124,
+    0,100,4,141,2,100,0,130,2,89,0,110,2,88,0,116,
+    9,124,0,124,2,131,2,125,6,124,6,100,0,107,8,114,
+    172,116,8,116,6,160,7,124,0,161,1,124,0,100,4,141,
+    2,130,1,110,8,116,10,124,6,131,1,125,7,124,3,114,
+    216,116,1,106,2,124,3,25,0,125,4,116,11,124,4,124,
+    0,160,0,100,1,161,1,100,5,25,0,124,7,131,3,1,
+    0,124,7,83,0,41,6,78,114,128,0,0,0,114,22,0,
+    0,0,122,23,59,32,123,33,114,125,32,105,115,32,110,111,
+    116,32,97,32,112,97,99,107,97,103,101,114,16,0,0,0,
+    233,2,0,0,0,41,12,114,129,0,0,0,114,15,0,0,
+    0,114,92,0,0,0,114,67,0,0,0,114,141,0,0,0,
+    114,106,0,0,0,218,8,95,69,82,82,95,77,83,71,114,
+    45,0,0,0,218,19,77,111,100,117,108,101,78,111,116,70,
+    111,117,110,100,69,114,114,111,114,114,193,0,0,0,114,160,
+    0,0,0,114,5,0,0,0,41,8,114,17,0,0,0,218,
+    7,105,109,112,111,114,116,95,114,164,0,0,0,114,130,0,
+    0,0,90,13,112,97,114,101,110,116,95,109,111,100,117,108,
+    101,114,158,0,0,0,114,95,0,0,0,114,96,0,0,0,
+    114,10,0,0,0,114,10,0,0,0,114,11,0,0,0,218,
+    23,95,102,105,110,100,95,97,110,100,95,108,111,97,100,95,
+    117,110,108,111,99,107,101,100,206,3,0,0,115,42,0,0,
+    0,0,1,4,1,14,1,4,1,10,1,10,2,10,1,10,
+    1,10,1,2,1,10,1,14,1,16,1,20,1,10,1,8,
+    1,20,2,8,1,4,2,10,1,22,1,114,203,0,0,0,
+    99,2,0,0,0,0,0,0,0,4,0,0,0,10,0,0,
+    0,67,0,0,0,115,106,0,0,0,116,0,124,0,131,1,
+    143,50,1,0,116,1,106,2,160,3,124,0,116,4,161,2,
+    125,2,124,2,116,4,107,8,114,54,116,5,124,0,124,1,
+    131,2,87,0,2,0,53,0,81,0,82,0,163,0,83,0,
+    87,0,53,0,81,0,82,0,88,0,124,2,100,1,107,8,
+    114,94,100,2,160,6,124,0,161,1,125,3,116,7,124,3,
+    124,0,100,3,141,2,130,1,116,8,124,0,131,1,1,0,
+    124,2,83,0,41,4,122,25,70,105,110,100,32,97,110,100,
+    32,108,111,97,100,32,116,104,101,32,109,111,100,117,108,101,
+    46,78,122,40,105,109,112,111,114,116,32,111,102,32,123,125,
+    32,104,97,108,116,101,100,59,32,78,111,110,101,32,105,110,
+    32,115,121,115,46,109,111,100,117,108,101,115,114,16,0,0,
+    0,41,9,114,50,0,0,0,114,15,0,0,0,114,92,0,
+    0,0,114,34,0,0,0,218,14,95,78,69,69,68,83,95,
+    76,79,65,68,73,78,71,114,203,0,0,0,114,45,0,0,
+    0,114,201,0,0,0,114,65,0,0,0,41,4,114,17,0,
+    0,0,114,202,0,0,0,114,96,0,0,0,114,75,0,0,
+    0,114,10,0,0,0,114,10,0,0,0,114,11,0,0,0,
+    218,14,95,102,105,110,100,95,97,110,100,95,108,111,97,100,
+    236,3,0,0,115,22,0,0,0,0,2,10,1,14,1,8,
+    1,32,2,8,1,4,1,2,255,4,2,12,2,8,1,114,
+    205,0,0,0,114,22,0,0,0,99,3,0,0,0,0,0,
+    0,0,3,0,0,0,4,0,0,0,67,0,0,0,115,42,
+    0,0,0,116,0,124,0,124,1,124,2,131,3,1,0,124,
+    2,100,1,107,4,114,32,116,1,124,0,124,1,124,2,131,
+    3,125,0,116,2,124,0,116,3,131,2,83,0,41,2,97,
+    50,1,0,0,73,109,112,111,114,116,32,97,110,100,32,114,
+    101,116,117,114,110,32,116,104,101,32,109,111,100,117,108,101,
+    32,98,97,115,101,100,32,111,110,32,105,116,115,32,110,97,
+    109,101,44,32,116,104,101,32,112,97,99,107,97,103,101,32,
+    116,104,101,32,99,97,108,108,32,105,115,10,32,32,32,32,
+    98,101,105,110,103,32,109,97,100,101,32,102,114,111,109,44,
+    32,97,110,100,32,116,104,101,32,108,101,118,101,108,32,97,
+    100,106,117,115,116,109,101,110,116,46,10,10,32,32,32,32,
+    84,104,105,115,32,102,117,110,99,116,105,111,110,32,114,101,
+    112,114,101,115,101,110,116,115,32,116,104,101,32,103,114,101,
+    97,116,101,115,116,32,99,111,109,109,111,110,32,100,101,110,
+    111,109,105,110,97,116,111,114,32,111,102,32,102,117,110,99,
+    116,105,111,110,97,108,105,116,121,10,32,32,32,32,98,101,
+    116,119,101,101,110,32,105,109,112,111,114,116,95,109,111,100,
+    117,108,101,32,97,110,100,32,95,95,105,109,112,111,114,116,
+    95,95,46,32,84,104,105,115,32,105,110,99,108,117,100,101,
+    115,32,115,101,116,116,105,110,103,32,95,95,112,97,99,107,
+    97,103,101,95,95,32,105,102,10,32,32,32,32,116,104,101,
+    32,108,111,97,100,101,114,32,100,105,100,32,110,111,116,46,
+    10,10,32,32,32,32,114,22,0,0,0,41,4,114,198,0,
+    0,0,114,186,0,0,0,114,205,0,0,0,218,11,95,103,
+    99,100,95,105,109,112,111,114,116,114,197,0,0,0,114,10,
+    0,0,0,114,10,0,0,0,114,11,0,0,0,114,206,0,
+    0,0,252,3,0,0,115,8,0,0,0,0,9,12,1,8,
+    1,12,1,114,206,0,0,0,169,1,218,9,114,101,99,117,
+    114,115,105,118,101,99,3,0,0,0,1,0,0,0,8,0,
+    0,0,11,0,0,0,67,0,0,0,115,226,0,0,0,124,
+    1,68,0,93,216,125,4,116,0,124,4,116,1,131,2,115,
+    66,124,3,114,34,124,0,106,2,100,1,23,0,125,5,110,
+    4,100,2,125,5,116,3,100,3,124,5,155,0,100,4,116,
+    4,124,4,131,1,106,2,155,0,157,4,131,1,130,1,110,
+    154,124,4,100,5,107,2,114,108,124,3,115,106,116,5,124,
+    0,100,6,131,2,114,106,116,6,124,0,124,0,106,7,124,
+    2,100,7,100,8,141,4,1,0,110,112,116,5,124,0,124,
+    4,131,2,115,220,100,9,160,8,124,0,106,2,124,4,161,
+    2,125,6,122,14,116,9,124,2,124,6,131,2,1,0,87,
+    0,110,72,4,0,116,10,107,10,114,218,1,0,125,7,1,
+    0,122,42,124,7,106,11,124,6,107,2,114,200,116,12,106,
+    13,160,14,124,6,116,15,161,2,100,10,107,9,114,200,87,
+    0,89,0,162,8,113,4,130,0,87,0,53,0,100,10,125,
+    7,126,7,88,0,89,0,110,2,88,0,113,4,124,0,83,
+    0,41,11,122,238,70,105,103,117,114,101,32,111,117,116,32,
+    119,104,97,116,32,95,95,105,109,112,111,114,116,95,95,32,
+    115,104,111,117,108,100,32,114,101,116,117,114,110,46,10,10,
+    32,32,32,32,84,104,101,32,105,109,112,111,114,116,95,32,
+    112,97,114,97,109,101,116,101,114,32,105,115,32,97,32,99,
+    97,108,108,97,98,108,101,32,119,104,105,99,104,32,116,97,
+    107,101,115,32,116,104,101,32,110,97,109,101,32,111,102,32,
+    109,111,100,117,108,101,32,116,111,10,32,32,32,32,105,109,
+    112,111,114,116,46,32,73,116,32,105,115,32,114,101,113,117,
+    105,114,101,100,32,116,111,32,100,101,99,111,117,112,108,101,
+    32,116,104,101,32,102,117,110,99,116,105,111,110,32,102,114,
+    111,109,32,97,115,115,117,109,105,110,103,32,105,109,112,111,
+    114,116,108,105,98,39,115,10,32,32,32,32,105,109,112,111,
+    114,116,32,105,109,112,108,101,109,101,110,116,97,116,105,111,
+    110,32,105,115,32,100,101,115,105,114,101,100,46,10,10,32,
+    32,32,32,122,8,46,95,95,97,108,108,95,95,122,13,96,
+    96,102,114,111,109,32,108,105,115,116,39,39,122,8,73,116,
+    101,109,32,105,110,32,122,18,32,109,117,115,116,32,98,101,
+    32,115,116,114,44,32,110,111,116,32,250,1,42,218,7,95,
+    95,97,108,108,95,95,84,114,207,0,0,0,114,180,0,0,
+    0,78,41,16,114,194,0,0,0,114,195,0,0,0,114,1,
+    0,0,0,114,196,0,0,0,114,14,0,0,0,114,4,0,
+    0,0,218,16,95,104,97,110,100,108,101,95,102,114,111,109,
+    108,105,115,116,114,210,0,0,0,114,45,0,0,0,114,67,
+    0,0,0,114,201,0,0,0,114,17,0,0,0,114,15,0,
+    0,0,114,92,0,0,0,114,34,0,0,0,114,204,0,0,
+    0,41,8,114,96,0,0,0,218,8,102,114,111,109,108,105,
+    115,116,114,202,0,0,0,114,208,0,0,0,218,1,120,90,
+    5,119,104,101,114,101,90,9,102,114,111,109,95,110,97,109,
+    101,90,3,101,120,99,114,10,0,0,0,114,10,0,0,0,
+    114,11,0,0,0,114,211,0,0,0,11,4,0,0,115,44,
+    0,0,0,0,10,8,1,10,1,4,1,12,2,4,1,28,
+    2,8,1,14,1,10,1,2,255,8,2,10,1,14,1,2,
+    1,14,1,16,4,10,1,16,255,2,2,8,1,22,1,114,
+    211,0,0,0,99,1,0,0,0,0,0,0,0,3,0,0,
+    0,6,0,0,0,67,0,0,0,115,146,0,0,0,124,0,
+    160,0,100,1,161,1,125,1,124,0,160,0,100,2,161,1,
+    125,2,124,1,100,3,107,9,114,82,124,2,100,3,107,9,
+    114,78,124,1,124,2,106,1,107,3,114,78,116,2,106,3,
+    100,4,124,1,155,2,100,5,124,2,106,1,155,2,100,6,
+    157,5,116,4,100,7,100,8,141,3,1,0,124,1,83,0,
+    124,2,100,3,107,9,114,96,124,2,106,1,83,0,116,2,
+    106,3,100,9,116,4,100,7,100,8,141,3,1,0,124,0,
+    100,10,25,0,125,1,100,11,124,0,107,7,114,142,124,1,
+    160,5,100,12,161,1,100,13,25,0,125,1,124,1,83,0,
+    41,14,122,167,67,97,108,99,117,108,97,116,101,32,119,104,
+    97,116,32,95,95,112,97,99,107,97,103,101,95,95,32,115,
+    104,111,117,108,100,32,98,101,46,10,10,32,32,32,32,95,
+    95,112,97,99,107,97,103,101,95,95,32,105,115,32,110,111,
+    116,32,103,117,97,114,97,110,116,101,101,100,32,116,111,32,
+    98,101,32,100,101,102,105,110,101,100,32,111,114,32,99,111,
+    117,108,100,32,98,101,32,115,101,116,32,116,111,32,78,111,
+    110,101,10,32,32,32,32,116,111,32,114,101,112,114,101,115,
+    101,110,116,32,116,104,97,116,32,105,116,115,32,112,114,111,
+    112,101,114,32,118,97,108,117,101,32,105,115,32,117,110,107,
+    110,111,119,110,46,10,10,32,32,32,32,114,146,0,0,0,
+    114,105,0,0,0,78,122,32,95,95,112,97,99,107,97,103,
+    101,95,95,32,33,61,32,95,95,115,112,101,99,95,95,46,
+    112,97,114,101,110,116,32,40,122,4,32,33,61,32,250,1,
+    41,233,3,0,0,0,41,1,90,10,115,116,97,99,107,108,
+    101,118,101,108,122,89,99,97,110,39,116,32,114,101,115,111,
+    108,118,101,32,112,97,99,107,97,103,101,32,102,114,111,109,
+    32,95,95,115,112,101,99,95,95,32,111,114,32,95,95,112,
+    97,99,107,97,103,101,95,95,44,32,102,97,108,108,105,110,
+    103,32,98,97,99,107,32,111,110,32,95,95,110,97,109,101,
+    95,95,32,97,110,100,32,95,95,112,97,116,104,95,95,114,
+    1,0,0,0,114,141,0,0,0,114,128,0,0,0,114,22,
+    0,0,0,41,6,114,34,0,0,0,114,130,0,0,0,114,
+    190,0,0,0,114,191,0,0,0,114,192,0,0,0,114,129,
+    0,0,0,41,3,218,7,103,108,111,98,97,108,115,114,184,
+    0,0,0,114,95,0,0,0,114,10,0,0,0,114,10,0,
+    0,0,114,11,0,0,0,218,17,95,99,97,108,99,95,95,
+    95,112,97,99,107,97,103,101,95,95,48,4,0,0,115,38,
+    0,0,0,0,7,10,1,10,1,8,1,18,1,22,2,2,
+    0,2,254,6,3,4,1,8,1,6,2,6,2,2,0,2,
+    254,6,3,8,1,8,1,14,1,114,217,0,0,0,114,10,
+    0,0,0,99,5,0,0,0,0,0,0,0,9,0,0,0,
+    5,0,0,0,67,0,0,0,115,180,0,0,0,124,4,100,
+    1,107,2,114,18,116,0,124,0,131,1,125,5,110,36,124,
+    1,100,2,107,9,114,30,124,1,110,2,105,0,125,6,116,
+    1,124,6,131,1,125,7,116,0,124,0,124,7,124,4,131,
+    3,125,5,124,3,115,150,124,4,100,1,107,2,114,84,116,
+    0,124,0,160,2,100,3,161,1,100,1,25,0,131,1,83,
+    0,124,0,115,92,124,5,83,0,116,3,124,0,131,1,116,
+    3,124,0,160,2,100,3,161,1,100,1,25,0,131,1,24,
+    0,125,8,116,4,106,5,124,5,106,6,100,2,116,3,124,
+    5,106,6,131,1,124,8,24,0,133,2,25,0,25,0,83,
+    0,110,26,116,7,124,5,100,4,131,2,114,172,116,8,124,
+    5,124,3,116,0,131,3,83,0,124,5,83,0,100,2,83,
+    0,41,5,97,215,1,0,0,73,109,112,111,114,116,32,97,
+    32,109,111,100,117,108,101,46,10,10,32,32,32,32,84,104,
+    101,32,39,103,108,111,98,97,108,115,39,32,97,114,103,117,
+    109,101,110,116,32,105,115,32,117,115,101,100,32,116,111,32,
+    105,110,102,101,114,32,119,104,101,114,101,32,116,104,101,32,
+    105,109,112,111,114,116,32,105,115,32,111,99,99,117,114,114,
+    105,110,103,32,102,114,111,109,10,32,32,32,32,116,111,32,
+    104,97,110,100,108,101,32,114,101,108,97,116,105,118,101,32,
+    105,109,112,111,114,116,115,46,32,84,104,101,32,39,108,111,
+    99,97,108,115,39,32,97,114,103,117,109,101,110,116,32,105,
+    115,32,105,103,110,111,114,101,100,46,32,84,104,101,10,32,
+    32,32,32,39,102,114,111,109,108,105,115,116,39,32,97,114,
+    103,117,109,101,110,116,32,115,112,101,99,105,102,105,101,115,
+    32,119,104,97,116,32,115,104,111,117,108,100,32,101,120,105,
+    115,116,32,97,115,32,97,116,116,114,105,98,117,116,101,115,
+    32,111,110,32,116,104,101,32,109,111,100,117,108,101,10,32,
+    32,32,32,98,101,105,110,103,32,105,109,112,111,114,116,101,
+    100,32,40,101,46,103,46,32,96,96,102,114,111,109,32,109,
+    111,100,117,108,101,32,105,109,112,111,114,116,32,60,102,114,
+    111,109,108,105,115,116,62,96,96,41,46,32,32,84,104,101,
+    32,39,108,101,118,101,108,39,10,32,32,32,32,97,114,103,
+    117,109,101,110,116,32,114,101,112,114,101,115,101,110,116,115,
+    32,116,104,101,32,112,97,99,107,97,103,101,32,108,111,99,
+    97,116,105,111,110,32,116,111,32,105,109,112,111,114,116,32,
+    102,114,111,109,32,105,110,32,97,32,114,101,108,97,116,105,
+    118,101,10,32,32,32,32,105,109,112,111,114,116,32,40,101,
+    46,103,46,32,96,96,102,114,111,109,32,46,46,112,107,103,
+    32,105,109,112,111,114,116,32,109,111,100,96,96,32,119,111,
+    117,108,100,32,104,97,118,101,32,97,32,39,108,101,118,101,
+    108,39,32,111,102,32,50,41,46,10,10,32,32,32,32,114,
+    22,0,0,0,78,114,128,0,0,0,114,141,0,0,0,41,
+    9,114,206,0,0,0,114,217,0,0,0,218,9,112,97,114,
+    116,105,116,105,111,110,114,182,0,0,0,114,15,0,0,0,
+    114,92,0,0,0,114,1,0,0,0,114,4,0,0,0,114,
+    211,0,0,0,41,9,114,17,0,0,0,114,216,0,0,0,
+    218,6,108,111,99,97,108,115,114,212,0,0,0,114,185,0,
+    0,0,114,96,0,0,0,90,8,103,108,111,98,97,108,115,
+    95,114,184,0,0,0,90,7,99,117,116,95,111,102,102,114,
+    10,0,0,0,114,10,0,0,0,114,11,0,0,0,218,10,
+    95,95,105,109,112,111,114,116,95,95,75,4,0,0,115,30,
+    0,0,0,0,11,8,1,10,2,16,1,8,1,12,1,4,
+    3,8,1,18,1,4,1,4,4,26,3,32,1,10,1,12,
+    2,114,220,0,0,0,99,1,0,0,0,0,0,0,0,2,
+    0,0,0,3,0,0,0,67,0,0,0,115,38,0,0,0,
+    116,0,160,1,124,0,161,1,125,1,124,1,100,0,107,8,
+    114,30,116,2,100,1,124,0,23,0,131,1,130,1,116,3,
+    124,1,131,1,83,0,41,2,78,122,25,110,111,32,98,117,
+    105,108,116,45,105,110,32,109,111,100,117,108,101,32,110,97,
+    109,101,100,32,41,4,114,161,0,0,0,114,166,0,0,0,
+    114,79,0,0,0,114,160,0,0,0,41,2,114,17,0,0,
+    0,114,95,0,0,0,114,10,0,0,0,114,10,0,0,0,
+    114,11,0,0,0,218,18,95,98,117,105,108,116,105,110,95,
+    102,114,111,109,95,110,97,109,101,112,4,0,0,115,8,0,
+    0,0,0,1,10,1,8,1,12,1,114,221,0,0,0,99,
+    2,0,0,0,0,0,0,0,10,0,0,0,5,0,0,0,
+    67,0,0,0,115,166,0,0,0,124,1,97,0,124,0,97,
+    1,116,2,116,1,131,1,125,2,116,1,106,3,160,4,161,
+    0,68,0,93,72,92,2,125,3,125,4,116,5,124,4,124,
+    2,131,2,114,26,124,3,116,1,106,6,107,6,114,60,116,
+    7,125,5,110,18,116,0,160,8,124,3,161,1,114,26,116,
+    9,125,5,110,2,113,26,116,10,124,4,124,5,131,2,125,
+    6,116,11,124,6,124,4,131,2,1,0,113,26,116,1,106,
+    3,116,12,25,0,125,7,100,1,68,0,93,46,125,8,124,
+    8,116,1,106,3,107,7,114,138,116,13,124,8,131,1,125,
+    9,110,10,116,1,106,3,124,8,25,0,125,9,116,14,124,
+    7,124,8,124,9,131,3,1,0,113,114,100,2,83,0,41,
+    3,122,250,83,101,116,117,112,32,105,109,112,111,114,116,108,
+    105,98,32,98,121,32,105,109,112,111,114,116,105,110,103,32,
+    110,101,101,100,101,100,32,98,117,105,108,116,45,105,110,32,
+    109,111,100,117,108,101,115,32,97,110,100,32,105,110,106,101,
+    99,116,105,110,103,32,116,104,101,109,10,32,32,32,32,105,
+    110,116,111,32,116,104,101,32,103,108,111,98,97,108,32,110,
+    97,109,101,115,112,97,99,101,46,10,10,32,32,32,32,65,
+    115,32,115,121,115,32,105,115,32,110,101,101,100,101,100,32,
+    102,111,114,32,115,121,115,46,109,111,100,117,108,101,115,32,
+    97,99,99,101,115,115,32,97,110,100,32,95,105,109,112,32,
+    105,115,32,110,101,101,100,101,100,32,116,111,32,108,111,97,
+    100,32,98,117,105,108,116,45,105,110,10,32,32,32,32,109,
+    111,100,117,108,101,115,44,32,116,104,111,115,101,32,116,119,
+    111,32,109,111,100,117,108,101,115,32,109,117,115,116,32,98,
+    101,32,101,120,112,108,105,99,105,116,108,121,32,112,97,115,
+    115,101,100,32,105,110,46,10,10,32,32,32,32,41,3,114,
+    23,0,0,0,114,190,0,0,0,114,64,0,0,0,78,41,
+    15,114,57,0,0,0,114,15,0,0,0,114,14,0,0,0,
+    114,92,0,0,0,218,5,105,116,101,109,115,114,194,0,0,
+    0,114,78,0,0,0,114,161,0,0,0,114,88,0,0,0,
+    114,173,0,0,0,114,143,0,0,0,114,149,0,0,0,114,
+    1,0,0,0,114,221,0,0,0,114,5,0,0,0,41,10,
+    218,10,115,121,115,95,109,111,100,117,108,101,218,11,95,105,
+    109,112,95,109,111,100,117,108,101,90,11,109,111,100,117,108,
+    101,95,116,121,112,101,114,17,0,0,0,114,96,0,0,0,
+    114,109,0,0,0,114,95,0,0,0,90,11,115,101,108,102,
+    95,109,111,100,117,108,101,90,12,98,117,105,108,116,105,110,
+    95,110,97,109,101,90,14,98,117,105,108,116,105,110,95,109,
+    111,100,117,108,101,114,10,0,0,0,114,10,0,0,0,114,
+    11,0,0,0,218,6,95,115,101,116,117,112,119,4,0,0,
+    115,36,0,0,0,0,9,4,1,4,3,8,1,18,1,10,
+    1,10,1,6,1,10,1,6,2,2,1,10,1,12,3,10,
+    1,8,1,10,1,10,2,10,1,114,225,0,0,0,99,2,
+    0,0,0,0,0,0,0,2,0,0,0,3,0,0,0,67,
+    0,0,0,115,38,0,0,0,116,0,124,0,124,1,131,2,
+    1,0,116,1,106,2,160,3,116,4,161,1,1,0,116,1,
+    106,2,160,3,116,5,161,1,1,0,100,1,83,0,41,2,
+    122,48,73,110,115,116,97,108,108,32,105,109,112,111,114,116,
+    101,114,115,32,102,111,114,32,98,117,105,108,116,105,110,32,
+    97,110,100,32,102,114,111,122,101,110,32,109,111,100,117,108,
+    101,115,78,41,6,114,225,0,0,0,114,15,0,0,0,114,
+    189,0,0,0,114,120,0,0,0,114,161,0,0,0,114,173,
+    0,0,0,41,2,114,223,0,0,0,114,224,0,0,0,114,
+    10,0,0,0,114,10,0,0,0,114,11,0,0,0,218,8,
+    95,105,110,115,116,97,108,108,154,4,0,0,115,6,0,0,
+    0,0,2,10,2,12,1,114,226,0,0,0,99,0,0,0,
+    0,0,0,0,0,1,0,0,0,4,0,0,0,67,0,0,
+    0,115,32,0,0,0,100,1,100,2,108,0,125,0,124,0,
+    97,1,124,0,160,2,116,3,106,4,116,5,25,0,161,1,
+    1,0,100,2,83,0,41,3,122,57,73,110,115,116,97,108,
+    108,32,105,109,112,111,114,116,101,114,115,32,116,104,97,116,
+    32,114,101,113,117,105,114,101,32,101,120,116,101,114,110,97,
+    108,32,102,105,108,101,115,121,115,116,101,109,32,97,99,99,
+    101,115,115,114,22,0,0,0,78,41,6,218,26,95,102,114,
+    111,122,101,110,95,105,109,112,111,114,116,108,105,98,95,101,
+    120,116,101,114,110,97,108,114,126,0,0,0,114,226,0,0,
+    0,114,15,0,0,0,114,92,0,0,0,114,1,0,0,0,
+    41,1,114,227,0,0,0,114,10,0,0,0,114,10,0,0,
+    0,114,11,0,0,0,218,27,95,105,110,115,116,97,108,108,
+    95,101,120,116,101,114,110,97,108,95,105,109,112,111,114,116,
+    101,114,115,162,4,0,0,115,6,0,0,0,0,3,8,1,
+    4,1,114,228,0,0,0,41,2,78,78,41,1,78,41,2,
+    78,114,22,0,0,0,41,4,78,78,114,10,0,0,0,114,
+    22,0,0,0,41,50,114,3,0,0,0,114,126,0,0,0,
+    114,12,0,0,0,114,18,0,0,0,114,59,0,0,0,114,
+    33,0,0,0,114,42,0,0,0,114,19,0,0,0,114,20,
+    0,0,0,114,49,0,0,0,114,50,0,0,0,114,53,0,
+    0,0,114,65,0,0,0,114,67,0,0,0,114,76,0,0,
+    0,114,86,0,0,0,114,90,0,0,0,114,97,0,0,0,
+    114,111,0,0,0,114,112,0,0,0,114,91,0,0,0,114,
+    143,0,0,0,114,149,0,0,0,114,153,0,0,0,114,107,
+    0,0,0,114,93,0,0,0,114,159,0,0,0,114,160,0,
+    0,0,114,94,0,0,0,114,161,0,0,0,114,173,0,0,
+    0,114,179,0,0,0,114,186,0,0,0,114,188,0,0,0,
+    114,193,0,0,0,114,198,0,0,0,90,15,95,69,82,82,
+    95,77,83,71,95,80,82,69,70,73,88,114,200,0,0,0,
+    114,203,0,0,0,218,6,111,98,106,101,99,116,114,204,0,
+    0,0,114,205,0,0,0,114,206,0,0,0,114,211,0,0,
+    0,114,217,0,0,0,114,220,0,0,0,114,221,0,0,0,
+    114,225,0,0,0,114,226,0,0,0,114,228,0,0,0,114,
+    10,0,0,0,114,10,0,0,0,114,10,0,0,0,114,11,
+    0,0,0,218,8,60,109,111,100,117,108,101,62,1,0,0,
+    0,115,94,0,0,0,4,24,4,2,8,8,8,8,4,2,
+    4,3,16,4,14,68,14,21,14,16,8,37,8,17,8,11,
+    14,8,8,11,8,12,8,16,8,36,14,101,16,26,10,45,
+    14,72,8,17,8,17,8,30,8,37,8,42,8,15,14,73,
+    14,97,14,13,8,9,8,9,10,47,8,16,4,1,8,2,
+    8,27,6,3,8,16,10,15,14,37,8,27,10,37,8,7,
+    8,35,8,8,
 };
@@ -12,7 +12,6 @@
 #include "longintrepr.h"
 #include "code.h"
 #include "marshal.h"
-#include "../Modules/hashtable.h"
 
 /*[clinic input]
 module marshal
@@ -72,11 +71,37 @@ module marshal
 #define TYPE_SHORT_ASCII        'z'
 #define TYPE_SHORT_ASCII_INTERNED 'Z'
 
+/* Version 5: a code object followed by the size of its co_code, co_consts,
+   co_names and co_lnotab, written as a separate stream, so that they can be
+   loaded on first use. */
+#define TYPE_LAZY_CODE          'C'
+
 #define WFERR_OK 0
 #define WFERR_UNMARSHALLABLE 1
 #define WFERR_NESTEDTOODEEP 2
 #define WFERR_NOMEMORY 3
 
+/* An object written with FLAG_REF and its index */
+typedef struct {
+    PyObject *obj;
+    int index;
+} w_ref_entry;
+
+/* initial size of a table of references */
+#define W_SMALL_REFS_BITS 6
+#define W_SMALL_REFS (1 << W_SMALL_REFS_BITS)
+
+/* The objects written with FLAG_REF, in an open-addressed hash table on
+   their addresses with linear probing.  The table is at most half full,
+   and starts as small. */
+typedef struct {
+    w_ref_entry *entries;
+    size_t size;            /* a power of 2 */
+    int shift;              /* bits of a hash not used for the index */
+    size_t count;
+    w_ref_entry small[W_SMALL_REFS];
+} w_refs;
+
 typedef struct {
     FILE *fp;
     int error;  /* see WFERR_* values */
@@ -85,7 +110,7 @@ typedef struct {
     char *ptr;
     char *end;
     char *buf;
-    _Py_hashtable_t *hashtable;
+    w_refs *refs;  /* NULL if not writing references */
     int version;
 } WFILE;
 
@@ -292,52 +317,103 @@ w_float_str(double v, WFILE *p)
     PyMem_Free(buf);
 }
 
+/* Return the entry of the table of references for v, either the one
+   holding v or the empty one where it would be inserted. */
+static inline w_ref_entry *
+w_ref_lookup(w_refs *refs, PyObject *v)
+{
+    /* Fibonacci hashing of the address, as objects are allocated at
+       addresses with regular strides */
+#if SIZEOF_SIZE_T > 4
+    size_t h = ((size_t)v >> 3) * (size_t)0x9E3779B97F4A7C15ULL;
+#else
+    size_t h = ((size_t)v >> 3) * (size_t)0x9E3779B9UL;
+#endif
+    size_t i = h >> refs->shift;
+    size_t mask = refs->size - 1;
+
+    while (refs->entries[i].obj != NULL && refs->entries[i].obj != v)
+        i = (i + 1) & mask;
+    return &refs->entries[i];
+}
+
+/* Double the size of the table of references.  Return -1 on memory
+   error. */
+static int
+w_refs_grow(w_refs *refs)
+{
+    w_ref_entry *old = refs->entries;
+    size_t old_size = refs->size;
+    size_t i;
+
+    if (old_size > PY_SSIZE_T_MAX / sizeof(w_ref_entry) / 2)
+        return -1;
+    refs->entries = PyMem_Calloc(old_size * 2, sizeof(w_ref_entry));
+    if (refs->entries == NULL) {
+        refs->entries = old;
+        return -1;
+    }
+    refs->size = old_size * 2;
+    refs->shift--;
+    for (i = 0; i < old_size; i++) {
+        if (old[i].obj != NULL)
+            *w_ref_lookup(refs, old[i].obj) = old[i];
+    }
+    if (old != refs->small)
+        PyMem_Free(old);
+    return 0;
+}
+
 static int
 w_ref(PyObject *v, char *flag, WFILE *p)
 {
-    _Py_hashtable_entry_t *entry;
-    int w;
+    w_refs *refs = p->refs;
+    w_ref_entry *entry;
 
-    if (p->version < 3 || p->hashtable == NULL)
+    if (refs == NULL)
         return 0; /* not writing object references */
 
     /* if it has only one reference, it definitely isn't shared */
     if (Py_REFCNT(v) == 1)
         return 0;
 
-    entry = _Py_HASHTABLE_GET_ENTRY(p->hashtable, v);
-    if (entry != NULL) {
+    entry = w_ref_lookup(refs, v);
+    if (entry->obj != NULL) {
         /* write the reference index to the stream */
-        _Py_HASHTABLE_ENTRY_READ_DATA(p->hashtable, entry, w);
-        /* we don't store "long" indices in the dict */
-        assert(0 <= w && w <= 0x7fffffff);
+        assert(0 <= entry->index && entry->index <= 0x7fffffff);
         w_byte(TYPE_REF, p);
-        w_long(w, p);
+        w_long(entry->index, p);
         return 1;
-    } else {
-        size_t s = p->hashtable->entries;
-        /* we don't support long indices */
-        if (s >= 0x7fffffff) {
-            PyErr_SetString(PyExc_ValueError, "too many objects");
-            goto err;
-        }
-        w = (int)s;
-        Py_INCREF(v);
-        if (_Py_HASHTABLE_SET(p->hashtable, v, w) < 0) {
-            Py_DECREF(v);
-            goto err;
+    }
+    /* we don't support long indices */
+    if (refs->count >= 0x7fffffff) {
+        PyErr_SetString(PyExc_ValueError, "too many objects");
+        p->error = WFERR_UNMARSHALLABLE;
+        return 1;
+    }
+    if (2 * (refs->count + 1) > refs->size) {
+        if (w_refs_grow(refs) < 0) {
+            p->error = WFERR_NOMEMORY;
+            return 1;
         }
-        *flag |= FLAG_REF;
-        return 0;
+        entry = w_ref_lookup(refs, v);
     }
-err:
-    p->error = WFERR_UNMARSHALLABLE;
-    return 1;
+    Py_INCREF(v);
+    entry->obj = v;
+    entry->index = (int)refs->count++;
+    *flag |= FLAG_REF;
+    return 0;
 }
 
 static void
 w_complex_object(PyObject *v, char flag, WFILE *p);
 
+static void
+w_init_refs(WFILE *wf, w_refs *refs, int version);
+
+static void
+w_clear_refs(WFILE *wf);
+
 static void
 w_object(PyObject *v, WFILE *p)
 {
@@ -372,6 +448,76 @@ w_object(PyObject *v, WFILE *p)
     p->depth--;
 }
 
+/* Write co_code, co_consts, co_names and co_lnotab of a TYPE_LAZY_CODE
+   object as a stream with its own references, preceded by its size. */
+static void
+w_code_body(PyCodeObject *co, WFILE *p)
+{
+    WFILE wf;
+    w_refs refs, *saved_refs;
+    Py_ssize_t start, size;
+
+    if (p->fp == NULL) {
+        /* Write the stream in place and fill in its size afterwards */
+        w_long(0, p);
+        if (p->ptr == NULL)
+            return;
+        start = p->ptr - p->buf;
+        saved_refs = p->refs;
+        w_init_refs(p, &refs, p->version);
+        w_object(co->co_code, p);
+        w_object(co->co_consts, p);
+        w_object(co->co_names, p);
+        w_object(co->co_lnotab, p);
+        w_clear_refs(p);
+        p->refs = saved_refs;
+        if (p->ptr == NULL || p->error != WFERR_OK)
+            return;
+        size = (p->ptr - p->buf) - start;
+        if (size > SIZE32_MAX) {
+            p->error = WFERR_UNMARSHALLABLE;
+            return;
+        }
+        p->buf[start - 4] = (char)(size & 0xff);
+        p->buf[start - 3] = (char)((size >> 8) & 0xff);
+        p->buf[start - 2] = (char)((size >> 16) & 0xff);
+        p->buf[start - 1] = (char)((size >> 24) & 0xff);
+        return;
+    }
+
+    memset(&wf, 0, sizeof(wf));
+    wf.str = PyBytes_FromStringAndSize((char *)NULL, 50);
+    if (wf.str == NULL) {
+        p->error = WFERR_NOMEMORY;
+        return;
+    }
+    wf.ptr = wf.buf = PyBytes_AS_STRING(wf.str);
+    wf.end = wf.ptr + PyBytes_GET_SIZE(wf.str);
+    wf.error = WFERR_OK;
+    wf.depth = p->depth;
+    wf.version = p->version;
+    w_init_refs(&wf, &refs, wf.version);
+    w_object(co->co_code, &wf);
+    w_object(co->co_consts, &wf);
+    w_object(co->co_names, &wf);
+    w_object(co->co_lnotab, &wf);
+    w_clear_refs(&wf);
+    if (wf.str == NULL) {
+        p->error = WFERR_NOMEMORY;
+        return;
+    }
+    size = wf.ptr - wf.buf;
+    if (wf.error != WFERR_OK)
+        p->error = wf.error;
+    else if (size > SIZE32_MAX)
+        p->error = WFERR_UNMARSHALLABLE;
+    else {
+        w_long((long)size, p);
+        w_string(wf.buf, size, p);
+    }
+    Py_DECREF(wf.str);
+}
+
 static void
 w_complex_object(PyObject *v, char flag, WFILE *p)
 {
@@ -528,6 +674,29 @@ w_complex_object(PyObject *v, char flag, WFILE *p)
     }
     else if (PyCode_Check(v)) {
         PyCodeObject *co = (PyCodeObject *)v;
+        if (_PyCode_MATERIALIZE(co) < 0) {
+            w_byte(TYPE_UNKNOWN, p);
+            p->depth--;
+            p->error = WFERR_UNMARSHALLABLE;
+            return;
+        }
+        if (p->version >= 5 && p->depth > 1) {
+            /* All code objects but the outermost one */
+            W_TYPE(TYPE_LAZY_CODE, p);
+            w_long(co->co_argcount, p);
+            w_long(co->co_kwonlyargcount, p);
+            w_long(co->co_nlocals, p);
+            w_long(co->co_stacksize, p);
+            w_long(co->co_flags, p);
+            w_object(co->co_varnames, p);
+            w_object(co->co_freevars, p);
+            w_object(co->co_cellvars, p);
+            w_object(co->co_filename, p);
+            w_object(co->co_name, p);
+            w_long(co->co_firstlineno, p);
+            w_code_body(co, p);
+            return;
+        }
         W_TYPE(TYPE_CODE, p);
         w_long(co->co_argcount, p);
         w_long(co->co_kwonlyargcount, p);
@@ -564,39 +733,32 @@ w_complex_object(PyObject *v, char flag, WFILE *p)
     }
 }
 
-static int
-w_init_refs(WFILE *wf, int version)
+static void
+w_init_refs(WFILE *wf, w_refs *refs, int version)
 {
     if (version >= 3) {
-        wf->hashtable = _Py_hashtable_new(sizeof(PyObject *), sizeof(int),
-                                          _Py_hashtable_hash_ptr,
-                                          _Py_hashtable_compare_direct);
-        if (wf->hashtable == NULL) {
-            PyErr_NoMemory();
-            return -1;
-        }
+        memset(refs->small, 0, sizeof(refs->small));
+        refs->entries = refs->small;
+        refs->size = W_SMALL_REFS;
+        refs->shift = 8 * SIZEOF_SIZE_T - W_SMALL_REFS_BITS;
+        refs->count = 0;
+        wf->refs = refs;
     }
-    return 0;
-}
-
-static int
-w_decref_entry(_Py_hashtable_t *ht, _Py_hashtable_entry_t *entry,
-               void *Py_UNUSED(data))
-{
-    PyObject *entry_key;
-
-    _Py_HASHTABLE_ENTRY_READ_KEY(ht, entry, entry_key);
-    Py_XDECREF(entry_key);
-    return 0;
 }
 
 static void
 w_clear_refs(WFILE *wf)
 {
-    if (wf->hashtable != NULL) {
-        _Py_hashtable_foreach(wf->hashtable, w_decref_entry, NULL);
-        _Py_hashtable_destroy(wf->hashtable);
-    }
+    w_refs *refs = wf->refs;
+    size_t i;
+
+    if (refs == NULL)
+        return;
+    for (i = 0; i < refs->size; i++)
+        Py_XDECREF(refs->entries[i].obj);
+    if (refs->entries != refs->small)
+        PyMem_Free(refs->entries);
+    wf->refs = NULL;
 }
 
 /* version currently has no effect for writing ints. */
@@ -620,14 +782,14 @@ PyMarshal_WriteObjectToFile(PyObject *x, FILE *fp, int version)
 {
     char buf[BUFSIZ];
     WFILE wf;
+    w_refs refs;
     memset(&wf, 0, sizeof(wf));
     wf.fp = fp;
     wf.ptr = wf.buf = buf;
     wf.end = wf.ptr + sizeof(buf);
     wf.error = WFERR_OK;
     wf.version = version;
-    if (w_init_refs(&wf, version))
-        return; /* caller mush check PyErr_Occurred() */
+    w_init_refs(&wf, &refs, version);
     w_object(x, &wf);
     w_clear_refs(&wf);
     w_flush(&wf);
@@ -642,6 +804,10 @@ typedef struct {
     char *buf;
     Py_ssize_t buf_size;
     PyObject *refs;  /* a list */
+    PyObject *lazybuf;  /* memoryview of the data when loading code objects
+                           lazily, else NULL */
+    PyObject *filename;  /* co_filename of TYPE_LAZY_CODE objects if not
+                            NULL */
 } RFILE;
 
 static const char *
@@ -948,6 +1114,11 @@ r_ref(PyObject *o, int flag, RFILE *p)
     return o;
 }
 
+static int
+r_code_body(const char *s, Py_ssize_t n, PyObject *lazybuf,
+            PyObject *filename, int depth, PyObject **code,
+            PyObject **consts, PyObject **names, PyObject **lnotab);
+
 static PyObject *
 r_object(RFILE *p)
 {
@@ -1412,6 +1583,117 @@ r_object(RFILE *p)
         retval = v;
         break;
 
+    case TYPE_LAZY_CODE:
+        {
+            int argcount;
+            int kwonlyargcount;
+            int nlocals;
+            int stacksize;
+            int flags;
+            PyObject *varnames = NULL;
+            PyObject *freevars = NULL;
+            PyObject *cellvars = NULL;
+            PyObject *filename = NULL;
+            PyObject *name = NULL;
+            int firstlineno;
+            PyObject *code = NULL;
+            PyObject *consts = NULL;
+            PyObject *names = NULL;
+            PyObject *lnotab = NULL;
+            const char *body;
+
+            idx = r_ref_reserve(flag, p);
+            if (idx < 0)
+                break;
+
+            v = NULL;
+
+            argcount = (int)r_long(p);
+            if (PyErr_Occurred())
+                goto lazy_code_error;
+            kwonlyargcount = (int)r_long(p);
+            if (PyErr_Occurred())
+                goto lazy_code_error;
+            nlocals = (int)r_long(p);
+            if (PyErr_Occurred())
+                goto lazy_code_error;
+            stacksize = (int)r_long(p);
+            if (PyErr_Occurred())
+                goto lazy_code_error;
+            flags = (int)r_long(p);
+            if (PyErr_Occurred())
+                goto lazy_code_error;
+            varnames = r_object(p);
+            if (varnames == NULL)
+                goto lazy_code_error;
+            freevars = r_object(p);
+            if (freevars == NULL)
+                goto lazy_code_error;
+            cellvars = r_object(p);
+            if (cellvars == NULL)
+                goto lazy_code_error;
+            filename = r_object(p);
+            if (filename == NULL)
+                goto lazy_code_error;
+            if (p->filename != NULL) {
+                /* The filename of the enclosing code object, which may
+                   have been changed since this one was written */
+                Py_INCREF(p->filename);
+                Py_SETREF(filename, p->filename);
+            }
+            name = r_object(p);
+            if (name == NULL)
+                goto lazy_code_error;
+            firstlineno = (int)r_long(p);
+            if (PyErr_Occurred())
+                goto lazy_code_error;
+            n = r_long(p);
+            if (PyErr_Occurred())
+                goto lazy_code_error;
+            if (n < 0) {
+                PyErr_SetString(PyExc_ValueError,
+                                "bad marshal data (code size out of range)");
+                goto lazy_code_error;
+            }
+            body = r_string(n, p);
+            if (body == NULL)
+                goto lazy_code_error;
+
+            if (p->lazybuf != NULL) {
+                const char *base = PyMemoryView_GET_BUFFER(p->lazybuf)->buf;
+                v = (PyObject *) _PyCode_NewLazy(
+                                argcount, kwonlyargcount,
+                                nlocals, stacksize, flags,
+                                varnames, freevars, cellvars, filename, name,
+                                firstlineno, p->lazybuf, body - base, n);
+            }
+            else {
+                if (r_code_body(body, n, NULL, filename, p->depth,
+                                &code, &consts, &names, &lnotab) < 0)
+                    goto lazy_code_error;
+                v = (PyObject *) PyCode_New(
+                                argcount, kwonlyargcount,
+                                nlocals, stacksize, flags,
+                                code, consts, names, varnames,
+                                freevars, cellvars, filename, name,
+                                firstlineno, lnotab);
+            }
+            v = r_ref_insert(v, idx, flag, p);
+
+          lazy_code_error:
+            Py_XDECREF(varnames);
+            Py_XDECREF(freevars);
+            Py_XDECREF(cellvars);
+            Py_XDECREF(filename);
+            Py_XDECREF(name);
+            Py_XDECREF(code);
+            Py_XDECREF(consts);
+            Py_XDECREF(names);
+            Py_XDECREF(lnotab);
+        }
+        retval = v;
+        break;
+
     case TYPE_REF:
         n = r_long(p);
         if (n < 0 || n >= PyList_GET_SIZE(p->refs)) {
@@ -1440,6 +1722,61 @@ r_object(RFILE *p)
     return retval;
 }
 
+/* Read the co_code, co_consts, co_names and co_lnotab of a TYPE_LAZY_CODE
+   object from n bytes at s.  If lazybuf is not NULL, s is in its buffer and
+   the code objects in co_consts are loaded lazily too. */
+static int
+r_code_body(const char *s, Py_ssize_t n, PyObject *lazybuf,
+            PyObject *filename, int depth, PyObject **code,
+            PyObject **consts, PyObject **names, PyObject **lnotab)
+{
+    RFILE rf;
+
+    *code = *consts = *names = *lnotab = NULL;
+    rf.fp = NULL;
+    rf.readable = NULL;
+    rf.ptr = (char *)s;
+    rf.end = (char *)s + n;
+    rf.buf = NULL;
+    rf.depth = depth;
+    rf.lazybuf = lazybuf;
+    rf.filename = filename;
+    if ((rf.refs = PyList_New(0)) == NULL)
+        return -1;
+    if ((*code = r_object(&rf)) == NULL ||
+        (*consts = r_object(&rf)) == NULL ||
+        (*names = r_object(&rf)) == NULL ||
+        (*lnotab = r_object(&rf)) == NULL) {
+        if (!PyErr_Occurred())
+            PyErr_SetString(PyExc_TypeError,
+                            "NULL object in marshal data for code object");
+        Py_CLEAR(*code);
+        Py_CLEAR(*consts);
+        Py_CLEAR(*names);
+        Py_CLEAR(*lnotab);
+        Py_DECREF(rf.refs);
+        return -1;
+    }
+    Py_DECREF(rf.refs);
+    return 0;
+}
+
+int
+_PyMarshal_ReadCodeBody(PyObject *buffer, Py_ssize_t offset, Py_ssize_t size,
+                        PyObject *filename, PyObject **code,
+                        PyObject **consts, PyObject **names, PyObject **lnotab)
+{
+    Py_buffer *view = PyMemoryView_GET_BUFFER(buffer);
+
+    if (offset > view->len || size > view->len - offset) {
+        PyErr_SetString(PyExc_ValueError,
+                        "bad marshal data (code size out of range)");
+        return -1;
+    }
+    return r_code_body((const char *)view->buf + offset, size, buffer,
+                       filename, 0, code, consts, names, lnotab);
+}
+
 static PyObject *
 read_object(RFILE *p)
 {
@@ -1541,6 +1878,8 @@ PyMarshal_ReadObjectFromFile(FILE *fp)
     rf.depth = 0;
     rf.ptr = rf.end = NULL;
     rf.buf = NULL;
+    rf.lazybuf = NULL;
+    rf.filename = NULL;
     rf.refs = PyList_New(0);
     if (rf.refs == NULL)
         return NULL;
@@ -1562,6 +1901,8 @@ PyMarshal_ReadObjectFromString(const char *str, Py_ssize_t len)
     rf.end = (char *)str + len;
     rf.buf = NULL;
     rf.depth = 0;
+    rf.lazybuf = NULL;
+    rf.filename = NULL;
     rf.refs = PyList_New(0);
     if (rf.refs == NULL)
         return NULL;
@@ -1576,6 +1917,7 @@ PyObject *
 PyMarshal_WriteObjectToString(PyObject *x, int version)
 {
     WFILE wf;
+    w_refs refs;
 
     memset(&wf, 0, sizeof(wf));
     wf.str = PyBytes_FromStringAndSize((char *)NULL, 50);
@@ -1585,10 +1927,7 @@ PyMarshal_WriteObjectToString(PyObject *x, int version)
     wf.end = wf.ptr + PyBytes_Size(wf.str);
     wf.error = WFERR_OK;
     wf.version = version;
-    if (w_init_refs(&wf, version)) {
-        Py_DECREF(wf.str);
-        return NULL;
-    }
+    w_init_refs(&wf, &refs, version);
     w_object(x, &wf);
     w_clear_refs(&wf);
     if (wf.str != NULL) {
@@ -1699,6 +2038,8 @@ marshal_load(PyObject *module, PyObject *file)
         rf.readable = file;
         rf.ptr = rf.end = NULL;
         rf.buf = NULL;
+        rf.lazybuf = NULL;
+        rf.filename = NULL;
         if ((rf.refs = PyList_New(0)) != NULL) {
             result = read_object(&rf);
             Py_DECREF(rf.refs);
@@ -1738,16 +2079,23 @@ marshal.loads
 
     bytes: Py_buffer
     /
+    *
+    lazy: bool = False
+        Load code objects written with version 5 on first use.
 
 Convert the bytes-like object to a value.
 
 If no valid value is found, raise EOFError, ValueError or TypeError.  Extra
 bytes in the input are ignored.
+
+With lazy=True, code objects nested in other code objects are only loaded
+from a read-only bytes-like object when they are first run or inspected,
+and keep it alive until then.  A mutable object is always loaded eagerly.
 [clinic start generated code]*/
 
 static PyObject *
-marshal_loads_impl(PyObject *module, Py_buffer *bytes)
-/*[clinic end generated code: output=9fc65985c93d1bb1 input=6f426518459c8495]*/
+marshal_loads_impl(PyObject *module, Py_buffer *bytes, int lazy)
+/*[clinic end generated code: output=9a1f2325db169b0d input=9c6bb19287502404]*/
 {
     RFILE rf;
     char *s = bytes->buf;
@@ -1758,10 +2106,25 @@ marshal_loads_impl(PyObject *module, Py_buffer *bytes)
     rf.ptr = s;
     rf.end = s + n;
     rf.depth = 0;
-    if ((rf.refs = PyList_New(0)) == NULL)
+    rf.lazybuf = NULL;
+    rf.filename = NULL;
+    if (lazy && bytes->readonly && bytes->obj != NULL) {
+        rf.lazybuf = PyMemoryView_FromObject(bytes->obj);
+        if (rf.lazybuf == NULL)
+            return NULL;
+        if (PyMemoryView_GET_BUFFER(rf.lazybuf)->buf != s ||
+            PyMemoryView_GET_BUFFER(rf.lazybuf)->len != n) {
+            /* Not the same memory, load eagerly */
+            Py_CLEAR(rf.lazybuf);
+        }
+    }
+    if ((rf.refs = PyList_New(0)) == NULL) {
+        Py_XDECREF(rf.lazybuf);
         return NULL;
+    }
     result = read_object(&rf);
     Py_DECREF(rf.refs);
+    Py_XDECREF(rf.lazybuf);
     return result;
 }
 
@@ -1795,6 +2158,7 @@ version -- indicates the format that the module uses. Version 0 is the\n\
     historical format, version 1 shares interned strings and version 2\n\
     uses a binary format for floating point numbers.\n\
     Version 3 shares common object references (New in version 3.4).\n\
+    Version 5 allows code objects to be loaded lazily (New in version 3.8).\n\
 \n\
 Functions:\n\
 \n\
@@ -50,6 +50,7 @@ _PyPathConfig_Clear(_PyPathConfig *config)
     CLEAR(config->prefix);
     CLEAR(config->program_full_path);
     CLEAR(config->exec_prefix);
+    CLEAR(config->stdlib_dir);
 #ifdef MS_WINDOWS
     CLEAR(config->dll_path);
 #endif
@@ -126,6 +127,7 @@ _PyPathConfig_SetGlobal(const _PyPathConfig *config)
     COPY_ATTR(program_full_path);
     COPY_ATTR(prefix);
     COPY_ATTR(exec_prefix);
+    COPY_ATTR(stdlib_dir);
 #ifdef MS_WINDOWS
     COPY_ATTR(dll_path);
 #endif
@@ -209,6 +211,9 @@ _PyCoreConfig_SetPathConfig(const _PyCoreConfig *core_config)
     if (copy_wstr(&path_config.exec_prefix, core_config->exec_prefix) < 0) {
         goto no_memory;
     }
+    if (copy_wstr(&path_config.stdlib_dir, core_config->stdlib_dir) < 0) {
+        goto no_memory;
+    }
 #ifdef MS_WINDOWS
     if (copy_wstr(&path_config.dll_path, core_config->dll_path) < 0) {
         goto no_memory;
@@ -320,6 +325,12 @@ _PyCoreConfig_CalculatePathConfig(_PyCoreConfig *config)
         }
     }
 
+    if (config->stdlib_dir == NULL) {
+        if (copy_wstr(&config->stdlib_dir, path_config.stdlib_dir) < 0) {
+            goto no_memory;
+        }
+    }
+
 #ifdef MS_WINDOWS
     if (config->dll_path == NULL) {
         if (copy_wstr(&config->dll_path, path_config.dll_path) < 0) {
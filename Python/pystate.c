@@ -151,6 +151,7 @@ PyInterpreterState_New(void)
     interp->core_config = _PyCoreConfig_INIT;
     interp->config = _PyMainInterpreterConfig_INIT;
     interp->importlib = NULL;
+    interp->frozen_stdlib = 0;
     interp->import_func = NULL;
     interp->eval_frame = _PyEval_EvalFrameDefault;
     interp->co_extra_user_count = 0;
@@ -739,6 +739,41 @@ sys_getswitchinterval_impl(PyObject *module)
     return 1e-6 * _PyEval_GetSwitchInterval();
 }
 
+/*[clinic input]
+sys.setsortthreads
+
+    n: int
+    /
+
+Set the number of threads list.sort() may use.
+
+Very large lists of floats, small ints or latin-1 strings are then
+sorted by up to n threads, with the GIL released.  The default, 1,
+sorts in the calling thread only.
+[clinic start generated code]*/
+
+static PyObject *
+sys_setsortthreads_impl(PyObject *module, int n)
+/*[clinic end generated code: output=f45fad6703c4935b input=d499f68e14ab601f]*/
+{
+    if (_PyList_SetSortThreads(n) < 0)
+        return NULL;
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+sys.getsortthreads -> int
+
+Return the number of threads list.sort() may use; see sys.setsortthreads().
+[clinic start generated code]*/
+
+static int
+sys_getsortthreads_impl(PyObject *module)
+/*[clinic end generated code: output=16a0a48a1d766898 input=f61785e28e787ac6]*/
+{
+    return _PyList_GetSortThreads();
+}
+
 /*[clinic input]
 sys.setrecursionlimit
 
@@ -1396,7 +1431,7 @@ static Py_ssize_t
 sys_getrefcount_impl(PyObject *module, PyObject *object)
 /*[clinic end generated code: output=5fd477f2264b85b2 input=bf474efd50a21535]*/
 {
-    return object->ob_refcnt;
+    return Py_REFCNT(object);
 }
 
 #ifdef Py_REF_DEBUG
@@ -1425,6 +1460,23 @@ sys_getallocatedblocks_impl(PyObject *module)
     return _Py_GetAllocatedBlocks();
 }
 
+/*[clinic input]
+sys._getsplitdictconversions -> Py_ssize_t
+
+Return the number of key-sharing dicts converted to regular dicts.
+
+Instance dicts share their keys with the other instances of the class.
+They are converted when a key which is not a string is inserted, or when
+a new key does not fit in the shared keys.
+[clinic start generated code]*/
+
+static Py_ssize_t
+sys__getsplitdictconversions_impl(PyObject *module)
+/*[clinic end generated code: output=770484f7dc6301e1 input=baf7032c09ac15ce]*/
+{
+    return _PyDict_GetSplitConversions();
+}
+
 #ifdef COUNT_ALLOCS
 /*[clinic input]
 sys.getcounts
@@ -1650,6 +1702,7 @@ static PyMethodDef sys_methods[] = {
     SYS_GETDEFAULTENCODING_METHODDEF
     SYS_GETDLOPENFLAGS_METHODDEF
     SYS_GETALLOCATEDBLOCKS_METHODDEF
+    SYS__GETSPLITDICTCONVERSIONS_METHODDEF
     SYS_GETCOUNTS_METHODDEF
 #ifdef DYNAMIC_EXECUTION_PROFILE
     {"getdxp",          _Py_GetDXProfile, METH_VARARGS},
@@ -1674,6 +1727,8 @@ static PyMethodDef sys_methods[] = {
     SYS_GETCHECKINTERVAL_METHODDEF
     SYS_SETSWITCHINTERVAL_METHODDEF
     SYS_GETSWITCHINTERVAL_METHODDEF
+    SYS_SETSORTTHREADS_METHODDEF
+    SYS_GETSORTTHREADS_METHODDEF
     SYS_SETDLOPENFLAGS_METHODDEF
     {"setprofile",      sys_setprofile, METH_O, setprofile_doc},
     SYS_GETPROFILE_METHODDEF
@@ -2562,6 +2617,14 @@ _PySys_InitMain(PyInterpreterState *interp)
     SET_SYS_FROM_STRING_BORROW("exec_prefix", config->exec_prefix);
     SET_SYS_FROM_STRING_BORROW("base_exec_prefix", config->base_exec_prefix);
 
+    if (core_config->stdlib_dir != NULL) {
+        SET_SYS_FROM_STRING_INT_RESULT(
+            "_stdlib_dir",
+            PyUnicode_FromWideChar(core_config->stdlib_dir, -1));
+    } else {
+        PyDict_SetItemString(sysdict, "_stdlib_dir", Py_None);
+    }
+
     if (config->pycache_prefix != NULL) {
         SET_SYS_FROM_STRING_BORROW("pycache_prefix", config->pycache_prefix);
     } else {
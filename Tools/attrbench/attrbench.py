@@ -0,0 +1,113 @@
+"""Memory and speed of instances whose attributes vary between instances.
+
+Instance __dict__s share their keys with the other instances of the class,
+and only store their own values.  This benchmark creates many instances of
+a class with a few typical attribute patterns and reports the memory used
+per instance, the time to create them, and how many instance dicts stopped
+sharing their keys (sys._getsplitdictconversions()):
+
+    ./python Tools/attrbench/attrbench.py -n 1000000
+
+The patterns are:
+
+    same       all attributes, set in the same order
+    shuffled   all attributes, in an order which varies between instances
+    optional   a random subset of the attributes
+    deleted    all attributes, then a random subset of them is deleted
+"""
+import argparse
+import gc
+import random
+import sys
+import time
+import tracemalloc
+
+
+def make_class(nattrs):
+    names = ['attr%d' % i for i in range(nattrs)]
+
+    class Record:
+        def __init__(self, order, delete):
+            for name in order:
+                setattr(self, name, None)
+            for name in delete:
+                delattr(self, name)
+
+    return Record, names
+
+
+def make_plans(pattern, names, n, rng):
+    # a few hundred distinct attribute sets, reused by all the instances
+    plans = []
+    for _ in range(min(n, 256)):
+        order = list(names)
+        delete = []
+        if pattern == 'shuffled':
+            rng.shuffle(order)
+        elif pattern == 'optional':
+            order = [name for name in order if rng.random() < 0.7]
+        elif pattern == 'deleted':
+            delete = [name for name in order if rng.random() < 0.3]
+        elif pattern != 'same':
+            raise ValueError(pattern)
+        plans.append((order, delete))
+    return [plans[i % len(plans)] for i in range(n)]
+
+
+def create(cls, plans):
+    return [cls(order, delete) for order, delete in plans]
+
+
+def run(pattern, n, nattrs, seed):
+    rng = random.Random(seed)
+    cls, names = make_class(nattrs)
+    plans = make_plans(pattern, names, n, rng)
+
+    # warm up the shared keys of the class
+    create(cls, plans[:10])
+
+    gc.collect()
+    conversions = sys._getsplitdictconversions()
+    start = time.perf_counter()
+    objs = create(cls, plans)
+    elapsed = time.perf_counter() - start
+    conversions = sys._getsplitdictconversions() - conversions
+    del objs
+
+    gc.collect()
+    tracemalloc.start()
+    before = tracemalloc.get_traced_memory()[0]
+    objs = create(cls, plans)
+    used = tracemalloc.get_traced_memory()[0] - before
+    tracemalloc.stop()
+    # the list holding the instances is not part of their cost
+    used -= sys.getsizeof(objs)
+    del objs
+    return used / n, elapsed * 1e9 / n, conversions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+            formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('-n', '--instances', type=int, default=10**6,
+                        help='number of instances (default: 10**6)')
+    parser.add_argument('-a', '--attrs', type=int, nargs='+',
+                        default=[4, 8, 16],
+                        help='number of attributes of the class')
+    parser.add_argument('--seed', type=int, default=1234)
+    parser.add_argument('patterns', nargs='*',
+                        default=['same', 'shuffled', 'optional', 'deleted'],
+                        help='attribute patterns to run')
+    options = parser.parse_args()
+
+    for nattrs in options.attrs:
+        for pattern in options.patterns:
+            size, ns, conversions = run(pattern, options.instances, nattrs,
+                                        options.seed)
+            print("{:<8} {:>2} attrs: {:7.1f} bytes {:7.1f} ns "
+                  "per instance, {:,} unshared dicts".format(
+                      pattern, nattrs, size, ns, conversions))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,92 @@
+"""Time multiplication, division and modular exponentiation of huge ints.
+
+Multiplication uses Karatsuba's algorithm above 70 digits (of 30 bits)
+and Toom-Cook 3-way above a few hundred digits, and division with large
+quotients uses the recursive algorithm of Burnikel and Ziegler, which
+also speeds up pow() with a large modulus.  This benchmark reports the
+time of a*b, a*a, divmod(a*b, b) and pow(a, e, m) with a 64-bit exponent,
+for operands with the given numbers of decimal digits:
+
+    ./python Tools/bigintbench/bigintbench.py -d 10000 100000 1000000
+
+The thresholds in Objects/longobject.c (KARATSUBA_CUTOFF, TOOM3_CUTOFF,
+TOOM3_SQUARE_CUTOFF, BURNIKEL_ZIEGLER_CUTOFF) were tuned by running this
+around them, with digits counted in internal digits:
+
+    ./python Tools/bigintbench/bigintbench.py --internal -d 300 400 600 800
+"""
+import argparse
+import random
+import sys
+import time
+
+
+OPERATIONS = {
+    'mul': lambda a, b, x, m: a * b,
+    'square': lambda a, b, x, m: a * a,
+    'divmod': lambda a, b, x, m: divmod(x, b),
+    'pow': lambda a, b, x, m: pow(a, 0xffffffffffffffc5, m),
+}
+
+
+def bench(func, args, repeat, mintime=0.2):
+    # Run enough loops to last mintime, and report the best time per loop.
+    loops = 1
+    while True:
+        t0 = time.perf_counter()
+        for _ in range(loops):
+            func(*args)
+        t = time.perf_counter() - t0
+        if t >= mintime or loops >= 1 << 20:
+            break
+        loops *= 2
+    best = t / loops
+    for _ in range(repeat - 1):
+        t0 = time.perf_counter()
+        for _ in range(loops):
+            func(*args)
+        best = min(best, (time.perf_counter() - t0) / loops)
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+            formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('-d', '--digits', type=int, nargs='+',
+                        default=[10**3, 10**4, 10**5, 10**6],
+                        help='sizes of the operands')
+    parser.add_argument('--internal', action='store_true',
+                        help='count sizes in internal digits of %d bits '
+                             'instead of decimal digits'
+                             % sys.int_info.bits_per_digit)
+    parser.add_argument('-r', '--repeat', type=int, default=3,
+                        help='runs per measurement, the best is reported')
+    parser.add_argument('--seed', type=int, default=1234)
+    parser.add_argument('operations', nargs='*',
+                        default=['mul', 'square', 'divmod', 'pow'],
+                        help='operations to time (default: all of %s)'
+                             % ', '.join(OPERATIONS))
+    options = parser.parse_args()
+
+    for size in options.digits:
+        if options.internal:
+            bits = size * sys.int_info.bits_per_digit
+        else:
+            bits = int(size * 3.3219280948873626)
+        rng = random.Random(options.seed)
+        a = rng.getrandbits(bits) | (1 << (bits - 1))
+        b = rng.getrandbits(bits) | (1 << (bits - 1))
+        x = a * b + a
+        m = b | 1
+        for name in options.operations:
+            if name == 'pow' and size > 10**5:
+                # Squaring and reducing 64 times is slow for huge moduli.
+                continue
+            t = bench(OPERATIONS[name], (a, b, x, m), options.repeat)
+            print("{:>10,} {:8} {:<7} {:12.6f} s".format(
+                size, 'internal' if options.internal else 'decimal',
+                name, t))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,237 @@
+"""Benchmark producer/consumer pipelines over subinterpreter channels.
+
+Producers and consumers each run in their own subinterpreter, driven by
+their own thread.  Throughput benchmarks report items per second; the
+latency benchmark reports the median round trip time of a ping-pong
+between two subinterpreters.
+
+"""
+import _xxsubinterpreters as interpreters
+import argparse
+import threading
+import time
+from textwrap import dedent
+
+
+# Each consumer gets a None per producer to tell it to stop.
+
+POLL_CONSUMER = """
+    import time
+    import _xxsubinterpreters as _interpreters
+    count = 0
+    stops = 0
+    while stops < {nproducers}:
+        try:
+            obj = _interpreters.channel_recv({cid})
+        except _interpreters.ChannelEmptyError:
+            time.sleep({interval})
+            continue
+        if obj is None:
+            stops += 1
+        else:
+            count += 1
+    _interpreters.channel_send({done}, count)
+    """
+
+BLOCKING_CONSUMER = """
+    import _xxsubinterpreters as _interpreters
+    count = 0
+    stops = 0
+    while stops < {nproducers}:
+        obj = _interpreters.channel_recv({cid}, block=True)
+        if obj is None:
+            stops += 1
+        else:
+            count += 1
+    _interpreters.channel_send({done}, count)
+    """
+
+BATCH_CONSUMER = """
+    import _xxsubinterpreters as _interpreters
+    count = 0
+    stops = 0
+    while stops < {nproducers}:
+        objs = _interpreters.channel_recv_many({cid}, {batch}, block=True)
+        nones = objs.count(None)
+        stops += nones
+        count += len(objs) - nones
+    if stops > {nproducers}:
+        # Hand back the stop markers meant for the other consumers.
+        _interpreters.channel_send_many({cid}, [None] * (stops - {nproducers}))
+    _interpreters.channel_send({done}, count)
+    """
+
+PRODUCER = """
+    import _xxsubinterpreters as _interpreters
+    item = b'x' * {size}
+    for _ in range({nitems}):
+        _interpreters.channel_send({cid}, item)
+    for _ in range({nconsumers}):
+        _interpreters.channel_send({cid}, None)
+    """
+
+BATCH_PRODUCER = """
+    import _xxsubinterpreters as _interpreters
+    items = [b'x' * {size}] * {batch}
+    for _ in range({nitems} // {batch}):
+        _interpreters.channel_send_many({cid}, items)
+    _interpreters.channel_send_many({cid}, [None] * {nconsumers})
+    """
+
+
+def _start(scripts, **kwargs):
+    interps = []
+    threads = []
+    for script in scripts:
+        interp = interpreters.create()
+        t = threading.Thread(target=interpreters.run_string,
+                             args=(interp, dedent(script).format(**kwargs)))
+        interps.append(interp)
+        threads.append(t)
+    for t in threads:
+        t.start()
+    return interps, threads
+
+
+def _join(interps, threads, done, nresults):
+    for t in threads:
+        t.join()
+    # Receive the results before their interpreters go away.
+    results = [interpreters.channel_recv(done) for _ in range(nresults)]
+    for interp in interps:
+        interpreters.destroy(interp)
+    return results
+
+
+def throughput(producer, consumer, nitems, nproducers, nconsumers,
+               batch=1, size=64, interval=0.001):
+    cid = interpreters.channel_create()
+    done = interpreters.channel_create()
+    nitems = nitems // nproducers // batch * batch
+    start = time.perf_counter()
+    interps, threads = _start(
+            [consumer] * nconsumers + [producer] * nproducers,
+            cid=int(cid), done=int(done), nitems=nitems,
+            nproducers=nproducers, nconsumers=nconsumers, batch=batch,
+            size=size, interval=interval)
+    counts = _join(interps, threads, done, nconsumers)
+    elapsed = time.perf_counter() - start
+    total = sum(counts)
+    interpreters.channel_destroy(cid)
+    interpreters.channel_destroy(done)
+    assert total == nitems * nproducers, total
+    return total / elapsed
+
+
+PING_POLL = """
+    import statistics
+    import time
+    import _xxsubinterpreters as _interpreters
+    timings = []
+    for i in range({nrounds}):
+        start = time.perf_counter()
+        _interpreters.channel_send({ping}, i)
+        while True:
+            try:
+                _interpreters.channel_recv({pong})
+                break
+            except _interpreters.ChannelEmptyError:
+                time.sleep({interval})
+        timings.append(time.perf_counter() - start)
+    _interpreters.channel_send({ping}, None)
+    _interpreters.channel_send({done}, int(statistics.median(timings) * 1e9))
+    """
+
+PONG_POLL = """
+    import time
+    import _xxsubinterpreters as _interpreters
+    while True:
+        try:
+            obj = _interpreters.channel_recv({ping})
+        except _interpreters.ChannelEmptyError:
+            time.sleep({interval})
+            continue
+        if obj is None:
+            break
+        _interpreters.channel_send({pong}, obj)
+    """
+
+PING_BLOCKING = """
+    import statistics
+    import time
+    import _xxsubinterpreters as _interpreters
+    timings = []
+    for i in range({nrounds}):
+        start = time.perf_counter()
+        _interpreters.channel_send({ping}, i)
+        _interpreters.channel_recv({pong}, block=True)
+        timings.append(time.perf_counter() - start)
+    _interpreters.channel_send({ping}, None)
+    _interpreters.channel_send({done}, int(statistics.median(timings) * 1e9))
+    """
+
+PONG_BLOCKING = """
+    import _xxsubinterpreters as _interpreters
+    while True:
+        obj = _interpreters.channel_recv({ping}, block=True)
+        if obj is None:
+            break
+        _interpreters.channel_send({pong}, obj)
+    """
+
+
+def latency(pinger, ponger, nrounds, interval=0.001):
+    ping = interpreters.channel_create()
+    pong = interpreters.channel_create()
+    done = interpreters.channel_create()
+    interps, threads = _start([ponger, pinger],
+                              ping=int(ping), pong=int(pong), done=int(done),
+                              nrounds=nrounds, interval=interval)
+    nanoseconds, = _join(interps, threads, done, 1)
+    for cid in (ping, pong, done):
+        interpreters.channel_destroy(cid)
+    return nanoseconds / 1e9
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('-n', '--items', type=int, default=100000,
+                        help='number of items sent per throughput run')
+    parser.add_argument('-p', '--producers', type=int, default=1,
+                        help='number of producer subinterpreters')
+    parser.add_argument('-c', '--consumers', type=int, default=2,
+                        help='number of consumer subinterpreters')
+    parser.add_argument('-b', '--batch', type=int, default=100,
+                        help='batch size for channel_send_many/recv_many')
+    parser.add_argument('-s', '--size', type=int, default=64,
+                        help='size in bytes of each item')
+    parser.add_argument('-r', '--rounds', type=int, default=2000,
+                        help='number of ping-pong rounds for latency')
+    parser.add_argument('-i', '--interval', type=float, default=0.001,
+                        help='sleep interval used by the polling variants')
+    options = parser.parse_args()
+
+    print("Throughput ({} items, {} producers, {} consumers):".format(
+        options.items, options.producers, options.consumers))
+    for label, producer, consumer, batch in [
+            ('polling recv', PRODUCER, POLL_CONSUMER, 1),
+            ('blocking recv', PRODUCER, BLOCKING_CONSUMER, 1),
+            ('send_many/recv_many', BATCH_PRODUCER, BATCH_CONSUMER,
+             options.batch),
+            ]:
+        rate = throughput(producer, consumer, options.items,
+                          options.producers, options.consumers, batch,
+                          options.size, options.interval)
+        print("  {:<22} {:>12,.0f} items/sec".format(label, rate))
+
+    print("Latency ({} round trips, median):".format(options.rounds))
+    for label, pinger, ponger in [
+            ('polling recv', PING_POLL, PONG_POLL),
+            ('blocking recv', PING_BLOCKING, PONG_BLOCKING),
+            ]:
+        median = latency(pinger, ponger, options.rounds, options.interval)
+        print("  {:<22} {:>12.1f} usec".format(label, median * 1e6))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,136 @@
+"""Lookup, miss and insert benchmarks for large dicts and frozendicts.
+
+Dicts used as in-memory indexes spend most of their time waiting for cache
+misses in the hash table.  This benchmark measures the time per operation
+for table sizes from fitting in L1 to well beyond the last level cache;
+compare a regular build with one configured using
+--with-dict-control-bytes:
+
+    ./python Tools/dictbench/dictbench.py -s 1000 1000000 10000000
+
+Keys are visited in random order so that hardware prefetching does not
+hide the cost of probing.
+
+With --frozen, the lookup and miss benchmarks run on a frozendict of the
+same items.  The freeze benchmark times frozendict(d), which shares the
+table of d instead of copying it, against copy, which times dict(d) (dict(f)
+with --frozen, which shares the table of f as well):
+
+    ./python Tools/dictbench/dictbench.py freeze copy
+    ./python Tools/dictbench/dictbench.py --frozen lookup miss
+"""
+import argparse
+import random
+import sysconfig
+import time
+from collections import frozendict
+
+
+def make_keys(kind, n, rng):
+    if kind == 'int':
+        # random 62-bit integers: their hashes are spread over the table
+        return [rng.getrandbits(62) for _ in range(n)]
+    if kind == 'seq':
+        return list(range(n))
+    if kind == 'str':
+        return ['user:%016x' % rng.getrandbits(64) for _ in range(n)]
+    raise ValueError(kind)
+
+
+def bench_lookup(d, keys, missing):
+    getitem = d.__getitem__
+    start = time.perf_counter()
+    for _ in map(getitem, keys):
+        pass
+    return time.perf_counter() - start
+
+
+def bench_miss(d, keys, missing):
+    contains = d.__contains__
+    start = time.perf_counter()
+    for _ in map(contains, missing):
+        pass
+    return time.perf_counter() - start
+
+
+def bench_insert(d, keys, missing):
+    start = time.perf_counter()
+    dict.fromkeys(keys)
+    return time.perf_counter() - start
+
+
+def bench_freeze(d, keys, missing):
+    d = dict(d)
+    start = time.perf_counter()
+    frozendict(d)
+    return time.perf_counter() - start
+
+
+def bench_copy(d, keys, missing):
+    start = time.perf_counter()
+    dict(d)
+    return time.perf_counter() - start
+
+
+BENCHMARKS = {
+    'lookup': bench_lookup,
+    'miss': bench_miss,
+    'insert': bench_insert,
+    'freeze': bench_freeze,
+    'copy': bench_copy,
+}
+
+
+def run(kind, size, names, repeat, seed, frozen):
+    rng = random.Random(seed)
+    keys = make_keys(kind, 2 * size, rng)
+    if kind == 'seq':
+        # the missing keys are the ones past the end of the dict
+        rng.shuffle(keys)
+    present, missing = keys[:size], keys[size:]
+    d = dict.fromkeys(present, 0)
+    if frozen:
+        d = frozendict(d)
+    rng.shuffle(present)
+    results = []
+    for name in names:
+        func = BENCHMARKS[name]
+        best = min(func(d, present, missing) for _ in range(repeat))
+        results.append((name, best * 1e9 / size))
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+            formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('-s', '--sizes', type=int, nargs='+',
+                        default=[1000, 10000, 100000, 1000000],
+                        help='dict sizes to run')
+    parser.add_argument('-k', '--keys', choices=['int', 'seq', 'str'],
+                        nargs='+', default=['int', 'str'],
+                        help='key kinds: random ints, sequential ints, '
+                             'strings')
+    parser.add_argument('-r', '--repeat', type=int, default=3,
+                        help='runs per measurement, the best is reported')
+    parser.add_argument('--seed', type=int, default=1234)
+    parser.add_argument('--frozen', action='store_true',
+                        help='run the lookups on a frozendict')
+    parser.add_argument('benchmarks', nargs='*',
+                        default=['lookup', 'miss', 'insert'],
+                        help='benchmarks to run (default: lookup, miss, '
+                             'insert); also freeze, copy')
+    options = parser.parse_args()
+
+    ctrl = sysconfig.get_config_var('Py_DICT_CONTROL_BYTES')
+    print("dict control bytes:", "yes" if ctrl else "no")
+    for kind in options.keys:
+        for size in options.sizes:
+            results = run(kind, size, options.benchmarks, options.repeat,
+                          options.seed, options.frozen)
+            print("{:<4} {:>11,}: ".format(kind, size) +
+                  "  ".join("{} {:6.1f} ns".format(name, ns)
+                            for name, ns in results))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,137 @@
+"""Benchmark ThreadPoolExecutor submit/result throughput for tiny tasks.
+
+Runs each benchmark with the C accelerated Future and worker loop (when
+the _concurrent_futures module is available) and with the pure Python
+implementations, and reports tasks per second.
+
+"""
+import argparse
+import time
+from concurrent.futures import _base, thread, wait
+
+# Keep both implementations around, whichever one thread.py picked.
+_c_workitem = thread._WorkItem
+_c_run_work_items = thread._run_work_items
+try:
+    import _concurrent_futures
+except ImportError:
+    _py_workitem = thread._WorkItem
+    _py_run_work_items = thread._run_work_items
+else:
+    from test.support import import_fresh_module
+    _pythread = import_fresh_module('concurrent.futures.thread',
+                                    blocked=['_concurrent_futures'])
+    _py_workitem = _pythread._WorkItem
+    _py_run_work_items = _pythread._run_work_items
+
+
+def noop():
+    pass
+
+
+def add(a, b):
+    return a + b
+
+
+def bench_fanout(executor, n):
+    """Submit n tasks, then collect all the results."""
+    submit = executor.submit
+    futures = [submit(add, i, 1) for i in range(n)]
+    for f in futures:
+        f.result()
+
+
+def bench_wait(executor, n):
+    """Submit n tasks, then wait() for all of them."""
+    submit = executor.submit
+    futures = [submit(noop) for _ in range(n)]
+    wait(futures)
+
+
+def bench_roundtrip(executor, n):
+    """Submit a task and wait for its result, n times."""
+    submit = executor.submit
+    for i in range(n):
+        submit(add, i, 1).result()
+
+
+def bench_map(executor, n):
+    """Executor.map() over n items."""
+    for _ in executor.map(abs, range(n)):
+        pass
+
+
+BENCHMARKS = {
+    'fanout': bench_fanout,
+    'wait': bench_wait,
+    'roundtrip': bench_roundtrip,
+    'map': bench_map,
+}
+
+
+def use_implementation(name):
+    """Switch concurrent.futures to the 'c' or 'py' implementation."""
+    if name == 'c':
+        _base.Future = _base._CFuture
+        thread._WorkItem = _c_workitem
+        thread._run_work_items = _c_run_work_items
+    else:
+        _base.Future = _base._PyFuture
+        thread._WorkItem = _py_workitem
+        thread._run_work_items = _py_run_work_items
+
+
+def run(func, workers, n, repeat):
+    best = None
+    for _ in range(repeat):
+        with thread.ThreadPoolExecutor(workers) as executor:
+            # Start the worker threads before timing.
+            for f in [executor.submit(noop) for _ in range(workers)]:
+                f.result()
+            start = time.perf_counter()
+            func(executor, n)
+            elapsed = time.perf_counter() - start
+        if best is None or elapsed < best:
+            best = elapsed
+    return n / best
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+            formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('-n', '--tasks', type=int, default=100000,
+                        help='number of tasks per run')
+    parser.add_argument('-w', '--workers', type=int, nargs='+',
+                        default=[1, 4],
+                        help='worker thread counts to run')
+    parser.add_argument('-r', '--repeat', type=int, default=3,
+                        help='runs per benchmark, the best one is reported')
+    parser.add_argument('benchmarks', nargs='*', default=sorted(BENCHMARKS),
+                        help='benchmarks to run (default: all)')
+    options = parser.parse_args()
+
+    implementations = ['py']
+    if hasattr(_base, '_CFuture'):
+        implementations.insert(0, 'c')
+    else:
+        print("_concurrent_futures not available, "
+              "only the Python implementation is run")
+
+    for name in options.benchmarks:
+        func = BENCHMARKS[name]
+        for workers in options.workers:
+            rates = []
+            for impl in implementations:
+                use_implementation(impl)
+                rates.append(run(func, workers, options.tasks,
+                                 options.repeat))
+            line = "{:<10} {:>2} workers:".format(name, workers)
+            for impl, rate in zip(implementations, rates):
+                line += "  {} {:>10,.0f} tasks/sec".format(impl, rate)
+            if len(rates) == 2:
+                line += "  ({:.2f}x)".format(rates[0] / rates[1])
+            print(line)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,102 @@
+"""Benchmark writing bytecode files.
+
+Compiles the modules of a source tree (by default the standard library)
+once, then reports the throughput of marshalling all their code objects
+with marshal.dumps(), as done for each bytecode file, for the marshal
+versions given.  Then reports the time of compileall.compile_dir() over a
+copy of the tree, which also includes reading and compiling the sources
+and writing the files.
+"""
+import argparse
+import compileall
+import marshal
+import os
+import shutil
+import sys
+import tempfile
+import time
+import warnings
+
+
+def find_sources(root):
+    for dirpath, dirnames, filenames in os.walk(root):
+        dirnames[:] = sorted(d for d in dirnames
+                             if d not in ('__pycache__', 'site-packages'))
+        for name in sorted(filenames):
+            if name.endswith('.py'):
+                yield os.path.join(dirpath, name)
+
+
+def compile_sources(root):
+    codes = []
+    for path in find_sources(root):
+        try:
+            with open(path, 'rb') as f:
+                source = f.read()
+            with warnings.catch_warnings():
+                warnings.simplefilter('ignore')
+                codes.append(compile(source, path, 'exec',
+                                     dont_inherit=True))
+        except (SyntaxError, ValueError):
+            # Test data with invalid syntax or encodings
+            pass
+    return codes
+
+
+def bench_dumps(codes, version, repeat):
+    best = float('inf')
+    for _ in range(repeat):
+        start = time.perf_counter()
+        for code in codes:
+            marshal.dumps(code, version)
+        best = min(best, time.perf_counter() - start)
+    size = sum(len(marshal.dumps(code, version)) for code in codes)
+    return best, size
+
+
+def bench_compileall(root, repeat):
+    best = float('inf')
+    with tempfile.TemporaryDirectory() as tmpdir:
+        tree = os.path.join(tmpdir, 'src')
+        shutil.copytree(root, tree, ignore=shutil.ignore_patterns(
+            '__pycache__', 'site-packages', '*.pyc'))
+        for _ in range(repeat):
+            start = time.perf_counter()
+            with warnings.catch_warnings():
+                warnings.simplefilter('ignore')
+                compileall.compile_dir(tree, quiet=2, force=True)
+            best = min(best, time.perf_counter() - start)
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+            formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('-d', '--directory',
+                        default=os.path.dirname(os.__file__),
+                        help='source tree to compile')
+    parser.add_argument('-v', '--versions', nargs='+', type=int,
+                        default=[marshal.version, 5],
+                        help='marshal versions to write')
+    parser.add_argument('-r', '--repeat', type=int, default=5,
+                        help='runs per benchmark, the best one is reported')
+    parser.add_argument('--no-compileall', action='store_true',
+                        help='only time marshal.dumps()')
+    options = parser.parse_args()
+
+    codes = compile_sources(options.directory)
+    for version in options.versions:
+        t, size = bench_dumps(codes, version, options.repeat)
+        print("marshal.dumps version {}  {:6} files {:7.1f} MB  "
+              "{:7.1f} ms  {:6.1f} MB/s {:8.0f} files/s".format(
+                  version, len(codes), size / (1 << 20), t * 1e3,
+                  size / t / (1 << 20), len(codes) / t))
+    if not options.no_compileall:
+        t = bench_compileall(options.directory, max(1, options.repeat // 2))
+        print("compileall.compile_dir       {:6} files            "
+              "{:7.1f} ms {:8.0f} files/s".format(
+                  len(codes), t * 1e3, len(codes) / t))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,171 @@
+"""Benchmark interpreter startup importing a large set of packages.
+
+Runs fresh interpreters which import the given modules (by default a large
+part of the standard library; pass -m without names to time a bare
+startup, as "python -c pass").  The modes are:
+
+  eager   bytecode files written and loaded as usual
+  lazy    -X lazy_bytecode, where the code objects of functions and
+          methods are only loaded from the memory-mapped bytecode files
+          when first used
+  frozen  -X frozen_modules=on, where the standard library modules
+          imported at startup are the frozen copies built into the
+          interpreter
+
+Each mode gets its own -X pycache_prefix, filled by a first run which is
+not timed, and the other two options are turned off.
+
+Reports the best wall-clock time of a run, the peak RSS of the process,
+the private (anonymous) part of its RSS at exit where the platform tells,
+and the total size of the bytecode files.  Pages of mapped bytecode files
+count in the RSS but are shared with the page cache.
+
+With --importtime, reports the best self time of each module instead, as
+given by -X importtime.
+"""
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+
+MODULES = [
+    'argparse', 'asyncio', 'concurrent.futures', 'csv', 'dataclasses',
+    'decimal', 'difflib', 'email.mime.multipart', 'email.parser', 'ftplib',
+    'http.client', 'http.server', 'inspect', 'json', 'logging.handlers',
+    'multiprocessing.pool', 'optparse', 'pathlib', 'pdb', 'pickle', 'pydoc',
+    'smtplib', 'statistics', 'subprocess', 'tarfile', 'typing', 'unittest',
+    'unittest.mock', 'urllib.request', 'uuid', 'xml.dom.minidom',
+    'xml.etree.ElementTree', 'xmlrpc.client', 'zipfile',
+]
+
+MODES = {
+    'eager': ['-X', 'frozen_modules=off'],
+    'lazy': ['-X', 'frozen_modules=off', '-X', 'lazy_bytecode'],
+    'frozen': ['-X', 'frozen_modules=on'],
+}
+
+# Imports the modules given as arguments, then prints the peak RSS and the
+# anonymous RSS (0 if unknown) in kB.
+CHILD = """\
+import sys
+for name in sys.argv[1:]:
+    try:
+        __import__(name)
+    except ImportError:
+        pass
+import resource
+rss = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+anon = 0
+try:
+    with open('/proc/self/status') as f:
+        for line in f:
+            if line.startswith('RssAnon:'):
+                anon = int(line.split()[1])
+except OSError:
+    pass
+print(rss // 1024 if sys.platform == 'darwin' else rss, anon)
+"""
+
+
+def run(executable, args, modules):
+    start = time.perf_counter()
+    output = subprocess.check_output([executable, '-I'] + args +
+                                     ['-c', CHILD] + modules)
+    rss, anon = map(int, output.split())
+    return time.perf_counter() - start, rss, anon
+
+
+def run_importtime(executable, args, modules):
+    """Return the self times in us of the imported modules, by name."""
+    proc = subprocess.run([executable, '-I', '-X', 'importtime'] + args +
+                          ['-c', CHILD] + modules,
+                          stdout=subprocess.DEVNULL, stderr=subprocess.PIPE,
+                          check=True, universal_newlines=True)
+    times = {}
+    for line in proc.stderr.splitlines():
+        # import time: self [us] | cumulative | imported package
+        fields = line.split('|')
+        if not line.startswith('import time:') or len(fields) != 3:
+            continue
+        try:
+            self_time = int(fields[0].split(':')[1])
+        except ValueError:
+            continue
+        times[fields[2].strip()] = self_time
+    return times
+
+
+def cache_size(path):
+    total = 0
+    for dirpath, dirnames, filenames in os.walk(path):
+        for name in filenames:
+            total += os.path.getsize(os.path.join(dirpath, name))
+    return total
+
+
+def main_importtime(options, args):
+    best = {}
+    for mode in options.modes:
+        runs = [run_importtime(options.executable, args[mode],
+                               options.modules)
+                for _ in range(options.repeat)]
+        best[mode] = {name: min(r.get(name, 0) for r in runs)
+                      for name in runs[0]}
+    # In the order of the first mode's imports
+    names = list(best[options.modes[0]])
+    for mode in options.modes[1:]:
+        names.extend(name for name in best[mode] if name not in names)
+    width = max(len(name) for name in names + ['module [us]'])
+    print("{:<{}} ".format('module [us]', width) +
+          ' '.join('{:>8}'.format(mode) for mode in options.modes))
+    for name in names:
+        print("{:<{}} ".format(name, width) +
+              ' '.join('{:8d}'.format(best[mode].get(name, 0))
+                       for mode in options.modes))
+    print("{:<{}} ".format('total', width) +
+          ' '.join('{:8d}'.format(sum(best[mode].values()))
+                   for mode in options.modes))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+            formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('-m', '--modules', nargs='*', default=MODULES,
+                        help='modules to import')
+    parser.add_argument('--modes', nargs='+', choices=list(MODES),
+                        default=list(MODES), help='modes to compare')
+    parser.add_argument('-e', '--executable', default=sys.executable,
+                        help='Python interpreter to run')
+    parser.add_argument('-r', '--repeat', type=int, default=10,
+                        help='runs per mode, the best one is reported')
+    parser.add_argument('-i', '--importtime', action='store_true',
+                        help='compare the -X importtime self times')
+    options = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        args = {}
+        for mode in options.modes:
+            prefix = os.path.join(tmpdir, mode)
+            args[mode] = MODES[mode] + ['-X', 'pycache_prefix=' + prefix]
+            run(options.executable, args[mode], options.modules)
+
+        if options.importtime:
+            main_importtime(options, args)
+            return
+
+        for mode in options.modes:
+            results = [run(options.executable, args[mode], options.modules)
+                       for _ in range(options.repeat)]
+            print("{:<6} {:8.1f} ms  peak RSS {:6.1f} MB  "
+                  "private {:6.1f} MB  bytecode {:6.1f} MB"
+                  .format(mode, min(r[0] for r in results) * 1e3,
+                          min(r[1] for r in results) / 1024,
+                          min(r[2] for r in results) / 1024,
+                          cache_size(os.path.join(tmpdir, mode)) / (1 << 20)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,64 @@
+"""Time conversions of huge ints to and from decimal strings.
+
+str(int) and int(str) switch from quadratic schoolbook algorithms to
+divide-and-conquer ones built on Karatsuba multiplication for values of
+more than a few thousand digits.  This benchmark reports the time of
+str(n), int(s), and optionally int(s, base) for other non-binary bases,
+for random values with the given numbers of decimal digits:
+
+    ./python Tools/intstrbench/intstrbench.py -d 1000 10000 100000 1000000
+
+Times grow roughly as the 1.6th power of the number of digits on large
+values, instead of the square.  Converting 10**7 digits takes minutes:
+
+    ./python Tools/intstrbench/intstrbench.py -d 10000000 -r 1
+"""
+import argparse
+import random
+import string
+import time
+
+
+def bench(func, arg, repeat):
+    best = None
+    for _ in range(repeat):
+        t0 = time.perf_counter()
+        func(arg)
+        t = time.perf_counter() - t0
+        if best is None or t < best:
+            best = t
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+            formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('-d', '--digits', type=int, nargs='+',
+                        default=[10**3, 10**4, 10**5, 10**6],
+                        help='numbers of decimal digits to run')
+    parser.add_argument('-b', '--bases', type=int, nargs='+',
+                        default=[], help='also time int(s, base) for '
+                                         'these bases')
+    parser.add_argument('-r', '--repeat', type=int, default=3,
+                        help='runs per measurement, the best is reported')
+    parser.add_argument('--seed', type=int, default=1234)
+    options = parser.parse_args()
+
+    alphabet = string.digits + string.ascii_lowercase
+    for ndigits in options.digits:
+        rng = random.Random(options.seed)
+        s = str(rng.randrange(1, 10)) + ''.join(
+            rng.choice(string.digits) for _ in range(ndigits - 1))
+        n = int(s)
+        print("{:>11,} digits  str(n): {:10.6f} s  int(s): {:10.6f} s".format(
+            ndigits, bench(str, n, options.repeat),
+            bench(int, s, options.repeat)))
+        for base in options.bases:
+            s = ''.join(rng.choice(alphabet[:base]) for _ in range(ndigits))
+            print("{:>11,} digits  int(s, {:d}): {:10.6f} s".format(
+                ndigits, base,
+                bench(lambda s: int(s, base), s, options.repeat)))
+
+
+if __name__ == '__main__':
+    main()
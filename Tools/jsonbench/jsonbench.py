@@ -0,0 +1,302 @@
+"""Benchmark JSON encoding and decoding.
+
+The "dumps" workload encodes API responses to UTF-8 bytes, as sent in HTTP
+responses: with json.dumps() and str.encode(), with json.dumpb(), and with
+json.dumpb() passing chunks to a write() function.  The payloads are a page
+of records, a larger list of records, and records with long non-ASCII text
+fields; each with ensure_ascii true and false.  Reports MB/s of output.
+
+The "stream" workload decodes a file holding a JSON array of records
+(dicts of strings, numbers and nested lists and dicts), either whole with
+json.load(), or element by element with json.iterload(array=True), which
+reads the file in chunks of the given sizes and drops each record once it
+is decoded.  Each run is a fresh interpreter.  Reports MB/s, records/s and
+the peak RSS of the process.
+
+The "loads" workload decodes documents shaped like the usual JSON parser
+benchmark corpora, generated from a fixed seed: "twitter" (indented search
+results with long ASCII and Japanese texts, so the document is a 2-byte
+string), "citm" (an indented catalog of many small objects with integer
+keys and values, all ASCII) and "canada" (a compact GeoJSON polygon with
+long arrays of float coordinates).  Reports MB/s of UTF-8 input for
+json.loads() of the str and of the bytes.
+
+"""
+import argparse
+import json
+import os
+import random
+import subprocess
+import sys
+import tempfile
+import time
+
+
+RECORDS = [10 ** 5, 10 ** 6]
+
+CHUNKS = {
+    '4K': 4 << 10,
+    '64K': 64 << 10,
+    '1M': 1 << 20,
+}
+
+# Decodes the file, then prints the time, the number of records and the
+# peak RSS in kB.
+CHILD = """\
+import json, resource, sys, time
+mode, path, chunk_size = sys.argv[1], sys.argv[2], int(sys.argv[3])
+start = time.perf_counter()
+with open(path, 'rb') as f:
+    if mode == 'load':
+        n = len(json.load(f))
+    else:
+        n = 0
+        for record in json.iterload(f, array=True, chunk_size=chunk_size):
+            n += 1
+elapsed = time.perf_counter() - start
+rss = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+print(elapsed, n, rss // 1024 if sys.platform == 'darwin' else rss)
+"""
+
+
+def make_record(rnd, i):
+    words = ['alpha', 'beta', 'gamma', 'delta', 'epsilon', 'zeta', 'eta']
+    return {
+        'id': i,
+        'name': 'user%d' % rnd.randrange(10 ** 6),
+        'active': rnd.random() < 0.5,
+        'score': rnd.random() * 100,
+        'tags': rnd.sample(words, 3),
+        'address': {'city': rnd.choice(words).title(),
+                    'zip': '%05d' % rnd.randrange(10 ** 5),
+                    'geo': [rnd.uniform(-90, 90), rnd.uniform(-180, 180)]},
+        'parent': None if i % 4 else i // 4,
+    }
+
+
+def make_payloads():
+    rnd = random.Random(0)
+    words = ['caf\xe9', 'na\xefve', '\u65e5\u672c\u8a9e', 'stra\xdfe',
+             '\u2603', 'r\xe9sum\xe9', 'emoji \U0001f600', 'plain', 'text']
+    records = [make_record(rnd, i) for i in range(10000)]
+    comments = [{'id': i, 'author': make_record(rnd, i)['name'],
+                 'body': ' '.join(rnd.choice(words) for _ in range(200)),
+                 'likes': rnd.randrange(1000)}
+                for i in range(500)]
+    return {
+        'page': {'count': 10000, 'next': '/users?page=2',
+                 'results': records[:50]},
+        'list': {'count': 10000, 'results': records},
+        'text': {'count': 500, 'results': comments},
+    }
+
+
+def time_dumps(func, obj, total):
+    """Return the best MB/s of func(obj) over runs of about total bytes."""
+    size = len(json.dumps(obj).encode('utf-8'))
+    count = max(1, total // size)
+    best = float('inf')
+    for _ in range(3):
+        start = time.perf_counter()
+        for _ in range(count):
+            func(obj)
+        best = min(best, time.perf_counter() - start)
+    return count * size / best / (1 << 20)
+
+
+def main_dumps(options):
+    def sink(data):
+        pass
+    for name, obj in make_payloads().items():
+        for ensure_ascii in (True, False):
+            funcs = [
+                ('dumps+encode', lambda obj: json.dumps(
+                    obj, ensure_ascii=ensure_ascii).encode('utf-8')),
+                ('dumpb', lambda obj: json.dumpb(
+                    obj, ensure_ascii=ensure_ascii)),
+                ('dumpb write', lambda obj: json.dumpb(
+                    obj, ensure_ascii=ensure_ascii, write=sink)),
+            ]
+            size = len(json.dumpb(obj, ensure_ascii=ensure_ascii))
+            rates = [max(time_dumps(func, obj, options.total << 20)
+                         for _ in range(options.repeat))
+                     for _, func in funcs]
+            print("{:<5} {:>9} bytes  ensure_ascii={:<5}  ".format(
+                      name, size, str(ensure_ascii)) +
+                  "  ".join("{} {:7.1f} MB/s".format(func_name, rate)
+                            for (func_name, _), rate in zip(funcs, rates)))
+
+
+def make_twitter(rnd):
+    ascii_words = ['the', 'quick', 'brown', 'fox', 'jumps', 'over', 'lazy',
+                   'dog', 'RT', '@user', '#python', 'http://t.co/abc123']
+    kana = [chr(c) for c in range(0x3041, 0x3097)]
+    def text(n):
+        if rnd.random() < 0.3:
+            return ''.join(rnd.choice(kana) for _ in range(n // 2))
+        return ' '.join(rnd.choice(ascii_words) for _ in range(n // 5))
+    def user(i):
+        return {'id': i, 'id_str': str(i), 'name': text(20),
+                'screen_name': 'user%d' % i, 'location': text(15),
+                'description': text(120), 'url': None,
+                'followers_count': rnd.randrange(10 ** 5),
+                'friends_count': rnd.randrange(10 ** 4),
+                'created_at': 'Sun Aug 31 00:29:15 +0000 2014',
+                'profile_image_url': 'http://pbs.twimg.com/profile_images/'
+                                     '%d/normal.jpeg' % i,
+                'verified': False, 'lang': rnd.choice(['ja', 'en'])}
+    statuses = [{'metadata': {'result_type': 'recent',
+                              'iso_language_code': 'ja'},
+                 'created_at': 'Sun Aug 31 00:29:15 +0000 2014',
+                 'id': 505874924095815681 + i, 'text': text(140),
+                 'source': '<a href="http://twitter.com/download/iphone" '
+                           'rel="nofollow">Twitter for iPhone</a>',
+                 'user': user(i), 'retweet_count': rnd.randrange(100),
+                 'entities': {'hashtags': [], 'urls': [],
+                              'user_mentions': [{'screen_name': 'user%d' % j,
+                                                 'indices': [0, 12]}
+                                                for j in range(i % 3)]},
+                 'favorited': False, 'lang': 'ja'}
+                for i in range(1000)]
+    return json.dumps({'statuses': statuses}, ensure_ascii=False, indent=2)
+
+
+def make_citm(rnd):
+    events = {}
+    for i in range(3000):
+        events[str(138586341 + i)] = {
+            'description': None, 'id': 138586341 + i, 'logo': None,
+            'name': 'Event %d' % i,
+            'subTopicIds': rnd.sample(range(337184262, 337184300), 4),
+            'subjectCode': None, 'subtitle': None,
+            'topicIds': rnd.sample(range(324846098, 324846110), 3)}
+    performances = [{'eventId': 138586341 + i, 'id': 339887544 + i,
+                     'logo': '/images/UE0AAAAACEKo6QAAAAZDSVRN',
+                     'name': None,
+                     'prices': [{'amount': rnd.randrange(10, 200) * 1000,
+                                 'audienceSubCategoryId': 337100890,
+                                 'seatCategoryId': 338937295 + j}
+                                for j in range(3)],
+                     'seatCategories': [{'areas': [{'areaId': 205705999 + k,
+                                                    'blockIds': []}
+                                                   for k in range(4)],
+                                         'seatCategoryId': 338937295 + j}
+                                        for j in range(3)],
+                     'start': 1372701600000 + i * 86400000,
+                     'venueCode': 'PLEYEL_PLEYEL'}
+                    for i in range(2000)]
+    return json.dumps({'events': events, 'performances': performances},
+                      indent=4)
+
+
+def make_canada(rnd):
+    rings = [[[round(rnd.uniform(-141, -52), 15),
+               round(rnd.uniform(41, 83), 15)]
+              for _ in range(rnd.randrange(10, 2000))]
+             for _ in range(300)]
+    return json.dumps({'type': 'FeatureCollection', 'features': [
+        {'type': 'Feature', 'properties': {'name': 'Canada'},
+         'geometry': {'type': 'Polygon', 'coordinates': rings}}]})
+
+
+CORPORA = {
+    'twitter': make_twitter,
+    'citm': make_citm,
+    'canada': make_canada,
+}
+
+
+def time_loads(data, total):
+    """Return the best MB/s of json.loads(data) over runs of about total
+    bytes of UTF-8 input."""
+    size = len(data.encode('utf-8') if isinstance(data, str) else data)
+    count = max(1, total // size)
+    best = float('inf')
+    for _ in range(3):
+        start = time.perf_counter()
+        for _ in range(count):
+            json.loads(data)
+        best = min(best, time.perf_counter() - start)
+    return count * size / best / (1 << 20)
+
+
+def main_loads(options):
+    for name in options.corpora:
+        text = CORPORA[name](random.Random(0))
+        data = text.encode('utf-8')
+        rates = [max(time_loads(doc, options.total << 20)
+                     for _ in range(options.repeat))
+                 for doc in (text, data)]
+        print("{:<8} {:9} bytes  str {:7.1f} MB/s  bytes {:7.1f} MB/s"
+              .format(name, len(data), *rates))
+
+
+def write_records(path, n):
+    rnd = random.Random(n)
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write('[')
+        for i in range(n):
+            if i:
+                f.write(',\n')
+            json.dump(make_record(rnd, i), f)
+        f.write(']\n')
+
+
+def run(executable, mode, path, chunk_size):
+    output = subprocess.check_output([executable, '-c', CHILD, mode, path,
+                                      str(chunk_size)])
+    elapsed, n, rss = output.split()
+    return float(elapsed), int(n), int(rss)
+
+
+def main_stream(options):
+    with tempfile.TemporaryDirectory() as tmpdir:
+        for n in options.records:
+            path = os.path.join(tmpdir, 'records%d.json' % n)
+            write_records(path, n)
+            megs = os.path.getsize(path) / (1 << 20)
+            runs = [('load', 'whole', 0)]
+            runs += [('iterload', name, CHUNKS[name])
+                     for name in options.chunks]
+            for mode, name, chunk_size in runs:
+                results = [run(options.executable, mode, path, chunk_size)
+                           for _ in range(options.repeat)]
+                assert all(r[1] == n for r in results)
+                best = min(r[0] for r in results)
+                print("{:>8} records {:7.1f} MB  {:<8} {:>5}  "
+                      "{:7.1f} MB/s {:10.0f} rec/s  peak RSS {:7.1f} MB"
+                      .format(n, megs, mode, name, megs / best, n / best,
+                              min(r[2] for r in results) / 1024))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+            formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('workload', nargs='?',
+                        choices=['dumps', 'loads', 'stream'],
+                        default='stream', help='what to encode or decode')
+    parser.add_argument('-n', '--records', nargs='+', type=int,
+                        default=RECORDS, help='record counts to run (stream)')
+    parser.add_argument('-c', '--chunks', nargs='+', choices=list(CHUNKS),
+                        default=['4K', '64K', '1M'],
+                        help='sizes of the chunks read (stream)')
+    parser.add_argument('--corpora', nargs='+', choices=list(CORPORA),
+                        default=list(CORPORA),
+                        help='documents to decode (loads)')
+    parser.add_argument('-t', '--total', type=int, default=64,
+                        help='MB to encode or decode per run (dumps, loads)')
+    parser.add_argument('-e', '--executable', default=sys.executable,
+                        help='Python interpreter to run (stream)')
+    parser.add_argument('-r', '--repeat', type=int, default=3,
+                        help='runs per benchmark, the best one is reported')
+    options = parser.parse_args()
+    if options.workload == 'dumps':
+        main_dumps(options)
+    elif options.workload == 'loads':
+        main_loads(options)
+    else:
+        main_stream(options)
+
+
+if __name__ == '__main__':
+    main()
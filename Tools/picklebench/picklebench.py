@@ -0,0 +1,241 @@
+"""Benchmark pickling and unpickling.
+
+The "buffers" workload pickles a bytearray of the given size, wrapped in
+a small object that knows how to reduce itself, with protocol 4, with
+protocol 5 in-band, and with protocol 5 using out-of-band buffers
+(buffer_callback and buffers).  Reports MB/s for dumps() and loads().
+
+The "tree" workload pickles lists of JSON-like records (dicts, lists,
+strings, numbers), as decoded by json.loads(), with and without
+memoization (memoize=False).  Reports records/s for dumps() and loads(),
+and the pickle size.
+
+The "stream" workload loads the same records, pickled with the given
+protocol, as if received in chunks of the given sizes: either joined
+into a whole message passed to loads(), or fed to an
+IncrementalUnpickler as they come.  Reports records/s.
+
+"""
+import argparse
+import json
+import pickle
+import random
+import time
+
+try:
+    from pickle import PickleBuffer
+except ImportError:
+    PickleBuffer = None
+
+
+SIZES = {
+    '1M': 1 << 20,
+    '16M': 16 << 20,
+    '256M': 256 << 20,
+    '1G': 1 << 30,
+}
+
+MODES = ['proto4', 'proto5', 'oob']
+
+RECORDS = [1000, 10000, 100000]
+
+CHUNKS = {
+    '1K': 1 << 10,
+    '4K': 4 << 10,
+    '64K': 64 << 10,
+    '1M': 1 << 20,
+}
+
+
+class Payload:
+    """A bytearray-backed object which can be reconstructed without a copy
+    from an out-of-band buffer."""
+
+    def __init__(self, data):
+        self.data = data
+
+    def __reduce_ex__(self, protocol):
+        if protocol >= 5:
+            return type(self)._reconstruct, (PickleBuffer(self.data),)
+        return type(self)._reconstruct, (self.data,)
+
+    @classmethod
+    def _reconstruct(cls, obj):
+        with memoryview(obj) as m:
+            obj = m.obj
+        if type(obj) is not bytearray:
+            obj = bytearray(obj)
+        return cls(obj)
+
+
+def run(mode, obj, count):
+    if mode == 'oob':
+        buffers = []
+        dumps = lambda: pickle.dumps(obj, 5, buffer_callback=buffers.append)
+        loads = lambda data: pickle.loads(data, buffers=buffers)
+    else:
+        proto = 4 if mode == 'proto4' else 5
+        dumps = lambda: pickle.dumps(obj, proto)
+        loads = pickle.loads
+
+    dump_time = load_time = 0.0
+    for _ in range(count):
+        if mode == 'oob':
+            buffers.clear()
+        start = time.perf_counter()
+        data = dumps()
+        dump_time += time.perf_counter() - start
+        start = time.perf_counter()
+        loads(data)
+        load_time += time.perf_counter() - start
+        del data
+    return dump_time, load_time
+
+
+def make_records(n):
+    rnd = random.Random(n)
+    words = ['alpha', 'beta', 'gamma', 'delta', 'epsilon', 'zeta', 'eta']
+    records = []
+    for i in range(n):
+        records.append({
+            'id': i,
+            'name': 'user%d' % rnd.randrange(10 ** 6),
+            'active': rnd.random() < 0.5,
+            'score': rnd.random() * 100,
+            'tags': rnd.sample(words, 3),
+            'address': {'city': rnd.choice(words).title(),
+                        'zip': '%05d' % rnd.randrange(10 ** 5),
+                        'geo': [rnd.uniform(-90, 90),
+                                rnd.uniform(-180, 180)]},
+            'parent': None if i % 4 else i // 4,
+        })
+    # Go through JSON, so that the dict keys are shared as in decoded
+    # messages.
+    return json.loads(json.dumps(records))
+
+
+def run_tree(records, protocol, memoize, count):
+    dump_time = load_time = 0.0
+    for _ in range(count):
+        start = time.perf_counter()
+        data = pickle.dumps(records, protocol, memoize=memoize)
+        dump_time += time.perf_counter() - start
+        start = time.perf_counter()
+        pickle.loads(data)
+        load_time += time.perf_counter() - start
+    return dump_time, load_time, len(data)
+
+
+def main_tree(options):
+    for n in options.records:
+        records = make_records(n)
+        count = max(1, options.total // n)
+        for memoize in (True, False):
+            results = [run_tree(records, options.protocol, memoize, count)
+                       for _ in range(options.repeat)]
+            best_dump = min(r[0] for r in results)
+            best_load = min(r[1] for r in results)
+            print("{:>7} x {:<5} {:<9} dumps {:10.0f} rec/s  "
+                  "loads {:10.0f} rec/s  {:>10} bytes"
+                  .format(n, count, 'memo' if memoize else 'no memo',
+                          count * n / best_dump, count * n / best_load,
+                          results[0][2]))
+
+
+def load_whole(chunks):
+    return pickle.loads(b''.join(chunks))
+
+
+def load_incremental(chunks):
+    unpickler = pickle.IncrementalUnpickler()
+    result = []
+    for chunk in chunks:
+        result.extend(unpickler.feed(chunk))
+    unpickler.close()
+    return result[0]
+
+
+def main_stream(options):
+    for n in options.records:
+        records = make_records(n)
+        data = pickle.dumps(records, options.protocol)
+        count = max(1, options.total // n)
+        for chunk_name in options.chunks:
+            size = CHUNKS[chunk_name]
+            chunks = [data[i:i+size] for i in range(0, len(data), size)]
+            rates = []
+            for load in (load_whole, load_incremental):
+                best = float('inf')
+                for _ in range(options.repeat):
+                    start = time.perf_counter()
+                    for _ in range(count):
+                        load(chunks)
+                    best = min(best, time.perf_counter() - start)
+                rates.append(count * n / best)
+            print("{:>7} x {:<5} {:>4} chunks  whole {:10.0f} rec/s  "
+                  "incremental {:10.0f} rec/s  ({:.2f}x)"
+                  .format(n, count, chunk_name, rates[0], rates[1],
+                          rates[1] / rates[0]))
+
+
+def main_buffers(options, parser):
+    if PickleBuffer is None or pickle.HIGHEST_PROTOCOL < 5:
+        parser.error("this Python does not support pickle protocol 5")
+
+    for size_name in options.sizes:
+        size = SIZES[size_name]
+        obj = Payload(bytearray(size))
+        count = max(1, (options.total << 20) // size)
+        megs = count * size / (1 << 20)
+        for mode in options.modes:
+            results = [run(mode, obj, count) for _ in range(options.repeat)]
+            best_dump = min(r[0] for r in results)
+            best_load = min(r[1] for r in results)
+            print("{:>5} x {:<5} {:<7} dumps {:9.1f} MB/s  loads {:9.1f} MB/s"
+                  .format(size_name, count, mode,
+                          megs / best_dump, megs / best_load))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+            formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('workload', nargs='?',
+                        choices=['buffers', 'tree', 'stream'],
+                        default='buffers', help='what to pickle')
+    parser.add_argument('-s', '--sizes', nargs='+', choices=list(SIZES),
+                        default=['1M', '16M', '256M'],
+                        help='payload sizes to run (buffers)')
+    parser.add_argument('-m', '--modes', nargs='+', choices=MODES,
+                        default=MODES,
+                        help='pickling modes to compare (buffers)')
+    parser.add_argument('-n', '--records', nargs='+', type=int,
+                        default=RECORDS,
+                        help='record counts to run (tree, stream)')
+    parser.add_argument('-p', '--protocol', type=int,
+                        default=pickle.DEFAULT_PROTOCOL,
+                        help='pickle protocol (tree, stream)')
+    parser.add_argument('-c', '--chunks', nargs='+', choices=list(CHUNKS),
+                        default=['4K', '64K'],
+                        help='sizes of the received chunks (stream)')
+    parser.add_argument('-t', '--total', type=int, default=None,
+                        help='MB (buffers) or records (tree, stream) to '
+                             'pickle per run, at least one payload')
+    parser.add_argument('-r', '--repeat', type=int, default=3,
+                        help='runs per benchmark, the best one is reported')
+    options = parser.parse_args()
+
+    if options.workload in ('tree', 'stream'):
+        if options.total is None:
+            options.total = 10 ** 6
+        if options.workload == 'tree':
+            main_tree(options)
+        else:
+            main_stream(options)
+    else:
+        if options.total is None:
+            options.total = 1024
+        main_buffers(options, parser)
+
+
+if __name__ == '__main__':
+    main()
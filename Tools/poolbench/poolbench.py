@@ -0,0 +1,143 @@
+"""Benchmark multiprocessing pools on workloads with skewed task durations.
+
+Runs Pool.map() and a stream of apply_async() calls over tasks whose
+durations follow the chosen distribution, once with multiprocessing.Pool
+and once with multiprocessing.WorkStealingPool, and reports the wall clock
+time of each run.
+
+By default tasks sleep, which measures scheduling independently of the
+number of CPUs; use --spin to make them busy-wait instead.
+
+"""
+import argparse
+import multiprocessing
+import random
+import time
+
+
+def sleep_task(duration):
+    time.sleep(duration)
+    return duration
+
+
+def spin_task(duration):
+    deadline = time.perf_counter() + duration
+    while time.perf_counter() < deadline:
+        pass
+    return duration
+
+
+def durations_uniform(n, mean, rng):
+    return [mean] * n
+
+
+def durations_blocks(n, mean, rng):
+    """One task in 16 is 16 times slower, and they all come first."""
+    slow = n // 16
+    scale = n / (slow * 16 + (n - slow)) if slow else 1.0
+    return [mean * 16 * scale] * slow + [mean * scale] * (n - slow)
+
+
+def durations_pareto(n, mean, rng):
+    """Heavy-tailed durations (Pareto, alpha=1.5) in random order."""
+    alpha = 1.5
+    xm = mean * (alpha - 1) / alpha
+    return [xm * rng.paretovariate(alpha) for _ in range(n)]
+
+
+def durations_sorted(n, mean, rng):
+    """Pareto durations, slowest tasks last."""
+    return sorted(durations_pareto(n, mean, rng))
+
+
+DISTRIBUTIONS = {
+    'uniform': durations_uniform,
+    'blocks': durations_blocks,
+    'pareto': durations_pareto,
+    'sorted': durations_sorted,
+}
+
+
+def bench_map(pool, func, durations):
+    """Pool.map() with the default chunksize."""
+    pool.map(func, durations)
+
+
+def bench_apply(pool, func, durations):
+    """apply_async() for every task, then get() all the results."""
+    results = [pool.apply_async(func, (d,)) for d in durations]
+    for r in results:
+        r.get()
+
+
+BENCHMARKS = {
+    'map': bench_map,
+    'apply': bench_apply,
+}
+
+POOLS = {
+    'Pool': multiprocessing.Pool,
+    'WorkStealingPool': multiprocessing.WorkStealingPool,
+}
+
+
+def run(pool_type, processes, bench, func, durations, repeat):
+    best = None
+    with pool_type(processes) as pool:
+        # Start the worker processes before timing.
+        pool.map(abs, range(processes), chunksize=1)
+        for _ in range(repeat):
+            start = time.perf_counter()
+            bench(pool, func, durations)
+            elapsed = time.perf_counter() - start
+            if best is None or elapsed < best:
+                best = elapsed
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+            formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('-n', '--tasks', type=int, default=2000,
+                        help='number of tasks per run')
+    parser.add_argument('-m', '--mean', type=float, default=0.002,
+                        help='mean task duration in seconds')
+    parser.add_argument('-p', '--processes', type=int, nargs='+',
+                        default=[4, 16, 64],
+                        help='worker process counts to run')
+    parser.add_argument('-d', '--distribution', nargs='+',
+                        choices=sorted(DISTRIBUTIONS),
+                        default=['blocks', 'pareto', 'sorted'],
+                        help='task duration distributions to run')
+    parser.add_argument('-r', '--repeat', type=int, default=3,
+                        help='runs per benchmark, the best one is reported')
+    parser.add_argument('--spin', action='store_true',
+                        help='busy-wait in tasks instead of sleeping')
+    parser.add_argument('--seed', type=int, default=42,
+                        help='random seed for the task durations')
+    parser.add_argument('benchmarks', nargs='*', default=sorted(BENCHMARKS),
+                        help='benchmarks to run (default: all)')
+    options = parser.parse_args()
+
+    func = spin_task if options.spin else sleep_task
+    for dist in options.distribution:
+        rng = random.Random(options.seed)
+        durations = DISTRIBUTIONS[dist](options.tasks, options.mean, rng)
+        ideal = sum(durations)
+        for name in options.benchmarks:
+            bench = BENCHMARKS[name]
+            for processes in options.processes:
+                times = [run(POOLS[pool], processes, bench, func, durations,
+                             options.repeat)
+                         for pool in sorted(POOLS)]
+                line = "{:<8} {:<6} {:>2} processes:".format(dist, name,
+                                                             processes)
+                for pool, elapsed in zip(sorted(POOLS), times):
+                    line += "  {} {:7.3f} s".format(pool, elapsed)
+                line += "  ({:.2f}x, ideal {:.3f} s)".format(
+                    times[0] / times[1], ideal / processes)
+                print(line)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,101 @@
+"""Benchmark multiprocessing queue throughput for large messages.
+
+A child process receives messages of the given sizes from a queue and
+acknowledges each one with a small message on a second queue.  The same
+run is done with multiprocessing.Queue, which pickles the payload and
+sends it through a pipe, and with multiprocessing.SharedMemoryQueue,
+which streams it through a shared memory ring buffer.  Reports MB/s.
+
+"""
+import argparse
+import multiprocessing
+import time
+
+
+SIZES = {
+    '1M': 1 << 20,
+    '16M': 16 << 20,
+    '256M': 256 << 20,
+    '1G': 1 << 30,
+}
+
+
+def consumer(inq, ackq):
+    while True:
+        obj = inq.get()
+        if obj is None:
+            break
+        ackq.put(len(obj))
+
+
+def make_payload(kind, size):
+    if kind == 'bytes':
+        return bytes(size)
+    elif kind == 'bytearray':
+        return bytearray(size)
+    else:
+        # a list of distinct bytes objects is pickled, then sent as one
+        # message
+        return [i.to_bytes(1024, 'little') for i in range(size // 1024)]
+
+
+def make_queue(name, capacity):
+    if name == 'Queue':
+        return multiprocessing.Queue()
+    return multiprocessing.SharedMemoryQueue(capacity=capacity)
+
+
+def run(queue_name, payload, count, capacity):
+    inq = make_queue(queue_name, capacity)
+    ackq = multiprocessing.Queue()
+    p = multiprocessing.Process(target=consumer, args=(inq, ackq))
+    p.start()
+    try:
+        # Warm up the feeder thread and the consumer.
+        inq.put(b'')
+        ackq.get()
+        start = time.perf_counter()
+        for _ in range(count):
+            inq.put(payload)
+            ackq.get()
+        elapsed = time.perf_counter() - start
+    finally:
+        inq.put(None)
+        p.join()
+    return elapsed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+            formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('-s', '--sizes', nargs='+', choices=list(SIZES),
+                        default=['1M', '16M', '256M'],
+                        help='message sizes to run')
+    parser.add_argument('-k', '--kind', choices=['bytes', 'bytearray', 'list'],
+                        default='bytes', help='type of the payload')
+    parser.add_argument('-t', '--total', type=int, default=1024,
+                        help='MB to send per run (at least one message)')
+    parser.add_argument('-c', '--capacity', type=int, default=64,
+                        help='ring buffer capacity in MB')
+    parser.add_argument('-r', '--repeat', type=int, default=3,
+                        help='runs per benchmark, the best one is reported')
+    options = parser.parse_args()
+
+    capacity = options.capacity << 20
+    for size_name in options.sizes:
+        size = SIZES[size_name]
+        payload = make_payload(options.kind, size)
+        count = max(1, (options.total << 20) // size)
+        rates = []
+        for queue_name in ('Queue', 'SharedMemoryQueue'):
+            best = min(run(queue_name, payload, count, capacity)
+                       for _ in range(options.repeat))
+            rates.append(count * size / best / (1 << 20))
+        print("{:>5} {} x {:<5}  Queue {:8.1f} MB/s  SharedMemoryQueue "
+              "{:8.1f} MB/s  ({:.2f}x)".format(size_name, options.kind,
+                                                count, rates[0], rates[1],
+                                                rates[1] / rates[0]))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,160 @@
+"""Multi-threaded reference counting microbenchmark.
+
+Each worker thread runs a tight loop that takes and drops references to
+objects that are either shared by all threads (a config dict, interned
+strings, module globals) or private to the thread.  Compare a regular
+build with one configured using --with-biased-refcount.
+
+Besides the time, each run reports the cache references and misses of the
+process, read from the hardware counters with perf_event_open() on Linux
+("n/a" where the kernel doesn't expose them, as in many virtual machines),
+and the size of the object header is printed first.
+"""
+import argparse
+import ctypes
+import fcntl
+import os
+import platform
+import struct
+import sys
+import threading
+import time
+
+
+# perf_event_open() constants from <linux/perf_event.h>
+PERF_TYPE_HARDWARE = 0
+PERF_COUNT_HW_CACHE_REFERENCES = 2
+PERF_COUNT_HW_CACHE_MISSES = 3
+PERF_FLAG_INHERIT = 1 << 1          # count the threads started later
+PERF_FLAG_EXCLUDE_KERNEL = 1 << 5
+PERF_FLAG_EXCLUDE_HV = 1 << 6
+PERF_EVENT_IOC_ENABLE = 0x2400
+PERF_EVENT_IOC_DISABLE = 0x2401
+PERF_EVENT_IOC_RESET = 0x2403
+SYS_perf_event_open = {'x86_64': 298, 'aarch64': 241}
+
+
+class Counter:
+    """A hardware event counter for the process and its threads."""
+
+    def __init__(self, config):
+        nr = SYS_perf_event_open.get(platform.machine())
+        if not sys.platform.startswith('linux') or nr is None:
+            raise OSError("perf_event_open() is not supported")
+        # struct perf_event_attr, PERF_ATTR_SIZE_VER0
+        attr = bytearray(64)
+        struct.pack_into('IIQ', attr, 0, PERF_TYPE_HARDWARE, len(attr),
+                         config)
+        struct.pack_into('Q', attr, 40, PERF_FLAG_INHERIT |
+                         PERF_FLAG_EXCLUDE_KERNEL | PERF_FLAG_EXCLUDE_HV)
+        libc = ctypes.CDLL(None, use_errno=True)
+        buf = (ctypes.c_char * len(attr)).from_buffer(attr)
+        self.fd = libc.syscall(nr, buf, 0, -1, -1, 0)
+        if self.fd < 0:
+            errno = ctypes.get_errno()
+            raise OSError(errno, os.strerror(errno))
+
+    def start(self):
+        fcntl.ioctl(self.fd, PERF_EVENT_IOC_RESET, 0)
+        fcntl.ioctl(self.fd, PERF_EVENT_IOC_ENABLE, 0)
+
+    def stop(self):
+        fcntl.ioctl(self.fd, PERF_EVENT_IOC_DISABLE, 0)
+        return struct.unpack('q', os.read(self.fd, 8))[0]
+
+
+def open_counters():
+    try:
+        return [Counter(PERF_COUNT_HW_CACHE_REFERENCES),
+                Counter(PERF_COUNT_HW_CACHE_MISSES)]
+    except OSError:
+        return None
+
+
+CONFIG = {'name': 'service', 'debug': False, 'retries': 3, 'timeout': 1.5,
+          'hosts': ('alpha', 'beta', 'gamma'), 'port': 8080}
+
+
+def shared_objects(n):
+    config = CONFIG
+    get = config.get
+    keys = sys.intern('name'), sys.intern('retries'), sys.intern('port')
+    for _ in range(n):
+        for key in keys:
+            value = get(key)
+            value = config[key]
+        hosts = config['hosts']
+        first = hosts[0]
+
+
+def private_objects(n):
+    keys = 'name', 'retries', 'port'
+    config = {key: object() for key in keys}
+    config['hosts'] = tuple(object() for _ in range(3))
+    get = config.get
+    for _ in range(n):
+        for key in keys:
+            value = get(key)
+            value = config[key]
+        hosts = config['hosts']
+        first = hosts[0]
+
+
+BENCHMARKS = {
+    'shared': shared_objects,
+    'private': private_objects,
+}
+
+
+def run(func, nthreads, n, counters):
+    threads = [threading.Thread(target=func, args=(n,))
+               for _ in range(nthreads)]
+    for counter in counters or ():
+        counter.start()
+    start = time.perf_counter()
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    elapsed = time.perf_counter() - start
+    counts = [counter.stop() for counter in counters or ()]
+    return elapsed, counts
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+            formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('-n', '--loops', type=int, default=200000,
+                        help='iterations per thread')
+    parser.add_argument('-t', '--threads', type=int, nargs='+',
+                        default=[1, 2, 4, 8],
+                        help='thread counts to run')
+    parser.add_argument('-i', '--switch-interval', type=float, default=None,
+                        help='value for sys.setswitchinterval()')
+    parser.add_argument('benchmarks', nargs='*', default=sorted(BENCHMARKS),
+                        help='benchmarks to run (default: all)')
+    options = parser.parse_args()
+    if options.switch_interval is not None:
+        sys.setswitchinterval(options.switch_interval)
+
+    biased = hasattr(sys, 'abiflags') and 'b' in sys.abiflags
+    print("biased reference counting:", "yes" if biased else "no")
+    print("object header: {} bytes".format(sys.getsizeof(object())))
+    counters = open_counters()
+    for name in options.benchmarks:
+        func = BENCHMARKS[name]
+        for nthreads in options.threads:
+            elapsed, counts = run(func, nthreads, options.loops, counters)
+            loops = nthreads * options.loops
+            if counts:
+                refs, misses = counts
+                cache = ("{:>7.1f} cache refs/loop {:>7.2f} misses/loop"
+                         .format(refs / loops, misses / loops))
+            else:
+                cache = "cache misses n/a"
+            print("{:<8} {:>3} threads: {:>8.3f} sec {:>12,.0f} loops/sec  {}"
+                  .format(name, nthreads, elapsed, loops / elapsed, cache))
+
+
+if __name__ == '__main__':
+    main()
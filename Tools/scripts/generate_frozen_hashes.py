@@ -0,0 +1,33 @@
+# This script generates the Python/frozen_modules/hashes.h header file.
+# It must be run by the interpreter which checks the hashes, since
+# _imp.source_hash() can differ between versions.
+
+import _imp
+import sys
+
+header = """
+/* Auto-generated by Tools/scripts/generate_frozen_hashes.py */
+
+/* The _imp.source_hash(0, source) of the source of each module in
+   Python/frozen_stdlib.c, with "\\r\\n" newlines read as "\\n".  A frozen
+   copy is only used if the source it was made from is unchanged. */
+
+""".lstrip()
+
+
+def main(srcdir, outfile, *entries):
+    with open(outfile, 'w') as fobj:
+        fobj.write(header)
+        for entry in entries:
+            name, source = entry.split(':')
+            with open(srcdir + '/' + source, 'rb') as fp:
+                data = fp.read().replace(b'\r\n', b'\n')
+            digest = ''.join('\\x%02x' % b for b in _imp.source_hash(0, data))
+            fobj.write('#define _Py_H__%s "%s"\n'
+                       % (name.replace('.', ''), digest))
+
+    print("%s regenerated" % outfile)
+
+
+if __name__ == '__main__':
+    main(*sys.argv[1:])
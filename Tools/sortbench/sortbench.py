@@ -0,0 +1,140 @@
+"""Time list.sort() on large lists of ints, floats and strings.
+
+Lists whose sort keys are machine-size ints, floats, or short tuples of
+them are radix sorted rather than compared element by element, unless they
+are already mostly in order.  This benchmark reports the time per element
+of list.sort() for sizes up to beyond the last level cache and for inputs
+which are random, sorted, or partially sorted (sorted, then 1% of the
+elements swapped with others at random positions):
+
+    ./python Tools/sortbench/sortbench.py -s 100000 1000000 10000000
+
+With --key, records holding the values are sorted with a key function
+instead: objects by attrgetter('value'), lists by itemgetter(0), or lists
+by itemgetter(0, 1), whose keys are (value, record number) tuples:
+
+    ./python Tools/sortbench/sortbench.py --key attrgetter itemgetter2
+
+With --threads, each sort is run with each of the given numbers of threads
+set by sys.setsortthreads(), to measure how the parallel sort of lists of
+strings, small ints and floats scales:
+
+    ./python Tools/sortbench/sortbench.py -k str -s 10000000 -t 1 2 4 8
+"""
+import argparse
+import operator
+import random
+import sys
+import time
+
+
+class Record:
+    __slots__ = ('value', 'number')
+
+    def __init__(self, value, number):
+        self.value = value
+        self.number = number
+
+
+def make_records(key, data):
+    if key == 'none':
+        return data, None
+    if key == 'attrgetter':
+        return ([Record(value, i) for i, value in enumerate(data)],
+                operator.attrgetter('value'))
+    records = [[value, i] for i, value in enumerate(data)]
+    if key == 'itemgetter':
+        return records, operator.itemgetter(0)
+    if key == 'itemgetter2':
+        return records, operator.itemgetter(0, 1)
+    raise ValueError(key)
+
+
+def make_list(kind, n, rng):
+    if kind == 'int':
+        return [rng.randrange(-2**63 + 1, 2**63) for _ in range(n)]
+    if kind == 'smallint':
+        return [rng.randrange(1000) for _ in range(n)]
+    if kind == 'float':
+        return [rng.gauss(0.0, 1e6) for _ in range(n)]
+    if kind == 'str':
+        return ['%016x' % rng.getrandbits(64) for _ in range(n)]
+    raise ValueError(kind)
+
+
+def arrange(data, order, rng):
+    if order == 'random':
+        return data
+    data = sorted(data)
+    if order == 'partial':
+        for _ in range(len(data) // 200):
+            i = rng.randrange(len(data))
+            j = rng.randrange(len(data))
+            data[i], data[j] = data[j], data[i]
+    elif order == 'reversed':
+        data.reverse()
+    elif order != 'sorted':
+        raise ValueError(order)
+    return data
+
+
+def bench(data, repeat, key):
+    best = None
+    for _ in range(repeat):
+        lst = list(data)
+        start = time.perf_counter()
+        lst.sort(key=key)
+        elapsed = time.perf_counter() - start
+        if best is None or elapsed < best:
+            best = elapsed
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+            formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('-s', '--sizes', type=int, nargs='+',
+                        default=[10**5, 10**6, 10**7],
+                        help='list sizes to run')
+    parser.add_argument('-k', '--kinds', nargs='+',
+                        choices=['int', 'smallint', 'float', 'str'],
+                        default=['int', 'smallint', 'float', 'str'],
+                        help='element kinds: 64-bit ints, ints below 1000, '
+                             'floats, strings')
+    parser.add_argument('-r', '--repeat', type=int, default=3,
+                        help='runs per measurement, the best is reported')
+    parser.add_argument('--key', nargs='+',
+                        choices=['none', 'attrgetter', 'itemgetter',
+                                 'itemgetter2'],
+                        default=['none'],
+                        help='sort records with these key functions')
+    parser.add_argument('-t', '--threads', type=int, nargs='+',
+                        default=[1],
+                        help='numbers of sort threads to run with')
+    parser.add_argument('--seed', type=int, default=1234)
+    parser.add_argument('orders', nargs='*',
+                        default=['random', 'sorted', 'partial'],
+                        help='input orders (default: random, sorted, '
+                             'partial); also reversed')
+    options = parser.parse_args()
+
+    for kind in options.kinds:
+        for size in options.sizes:
+            rng = random.Random(options.seed)
+            data = make_list(kind, size, rng)
+            for order in options.orders:
+                arranged = arrange(data, order, rng)
+                for key in options.key:
+                    records, keyfunc = make_records(key, arranged)
+                    for threads in options.threads:
+                        sys.setsortthreads(threads)
+                        ns = bench(records, options.repeat,
+                                   keyfunc) * 1e9 / size
+                        print("{:<8} {:<8} {:<11} {:>11,} {:>3} threads: "
+                              "{:6.1f} ns per element".format(
+                                  kind, order, key, size, threads, ns))
+                    del records
+
+
+if __name__ == '__main__':
+    main()
@@ -1390,6 +1390,156 @@ def upper_conversion_dense(STR):
         s_upper()
 
 
+#### Long needles in a 1 MB log
+
+def _make_log():
+    lines = []
+    for i in range(8000):
+        lines.append("2018-10-%02d 13:%02d:%02d INFO worker-%d handled "
+                     "GET /api/v1/items/%d in %d ms status=200\n"
+                     % (i % 28 + 1, i % 60, (i * 7) % 60, i % 16,
+                        i * 37, i % 250))
+    return "".join(lines)
+
+_LOG = _make_log()
+_LOG_NEEDLE_20 = "status=503 upstream "
+_LOG_NEEDLE_200 = ("ERROR worker-3 failed GET /api/v1/items/4242 after 3 "
+                   "retries: connection reset by peer while reading the "
+                   "response body from upstream cache node 7; request "
+                   "will be retried on another replica shortly ok")
+
+@bench('log_1mb.find(needle_20)', "no match in a log, 20 characters", 10)
+def find_test_log_no_match_20_characters(STR):
+    s1 = STR(_LOG)
+    s2 = STR(_LOG_NEEDLE_20)
+    s1_find = s1.find
+    for x in _RANGE_10:
+        s1_find(s2)
+
+@bench('log_1mb.find(needle_200)', "no match in a log, 200 characters", 10)
+def find_test_log_no_match_200_characters(STR):
+    s1 = STR(_LOG)
+    s2 = STR(_LOG_NEEDLE_200)
+    s1_find = s1.find
+    for x in _RANGE_10:
+        s1_find(s2)
+
+@bench('(log_1mb+needle_200).count(needle_200)',
+       "late match in a log, 200 characters", 10)
+def count_test_log_late_match_200_characters(STR):
+    s2 = STR(_LOG_NEEDLE_200)
+    s1 = STR(_LOG) + s2
+    s1_count = s1.count
+    for x in _RANGE_10:
+        s1_count(s2)
+
+@bench('log_1mb.split(needle_20)', "no match in a log, 20 characters", 10)
+def split_test_log_no_match_20_characters(STR):
+    s1 = STR(_LOG)
+    s2 = STR(_LOG_NEEDLE_20)
+    s1_split = s1.split
+    for x in _RANGE_10:
+        s1_split(s2)
+
+@bench('log_1mb.replace(needle_200, "")',
+       "no match in a log, 200 characters", 10)
+def replace_test_log_no_match_200_characters(STR):
+    s1 = STR(_LOG)
+    s2 = STR(_LOG_NEEDLE_200)
+    empty = STR("")
+    s1_replace = s1.replace
+    for x in _RANGE_10:
+        s1_replace(s2, empty)
+
+@bench('s="A"*50; ("A"*1000000).find(s+"B"+s)',
+       "worst case, 101 characters", 10)
+def find_test_worst_case_101_characters(STR):
+    m = STR("A"*50)
+    s1 = STR("A"*1000000)
+    s2 = m+STR("B")+m
+    s1_find = s1.find
+    for x in _RANGE_10:
+        s1_find(s2)
+
+@bench('s="AB"*50; (s*20000).count(s+"C"+s)',
+       "worst case, periodic, 201 characters", 10)
+def count_test_worst_case_periodic_201_characters(STR):
+    m = STR("AB"*50)
+    s1 = m*20000
+    s2 = m+STR("C")+m
+    s1_count = s1.count
+    for x in _RANGE_10:
+        s1_count(s2)
+
+
+#### UTF-8 decoding of 64 KiB corpora
+
+def _utf8_corpus(text):
+    data = text.encode("utf-8")
+    return (data * (65536 // len(data) + 1))[:65536].decode(
+        "utf-8", "ignore").encode("utf-8")
+
+_utf8_corpora = {
+    "ascii": _utf8_corpus(
+        u'{"id": 12345, "user": "jdoe", "status": "ok", "path": '
+        u'"/api/v1/items?page=2"}\n'),
+    "mostly ascii": _utf8_corpus(
+        u'127.0.0.1 - - [10/Oct/2018:13:55:36] "GET /caf\u00e9/menu HTTP/1.1" '
+        u'200 2326 "-" "Mozilla/5.0 (X11; Linux x86_64)"\n'),
+    "latin-1": _utf8_corpus(
+        u"\u00c7\u00e0 et l\u00e0, l'\u00e9t\u00e9 dernier, "
+        u"\u00e9l\u00e8ves \u00e0 l'\u00e9cole; Gr\u00f6\u00dfe \u00fcber "
+        u"\u00d6l und \u00e4hnliches. "),
+    "cjk": _utf8_corpus(
+        u"\u4eca\u65e5\u306f\u826f\u3044\u5929\u6c17\u3067\u3059\u3002"
+        u"\u6211\u4eec\u660e\u5929\u89c1\u3002\ud55c\uad6d\uc5b4 "
+        u"\u30c6\u30b9\u30c8 123 "),
+    "emoji": _utf8_corpus(
+        u"great job \U0001F600\U0001F44D see you soon \U0001F680 "
+        u"ok \u2764 "),
+}
+
+def _get_utf8_corpus(STR, name):
+    if STR is BYTES:
+        raise UnsupportedType
+    return _utf8_corpora[name]
+
+@bench('ascii_64k.decode("utf-8")', "UTF-8 decoding", 100)
+def utf8_decode_ascii(STR):
+    s = _get_utf8_corpus(STR, "ascii")
+    s_decode = s.decode
+    for x in _RANGE_100:
+        s_decode("utf-8")
+
+@bench('mostly_ascii_64k.decode("utf-8")', "UTF-8 decoding", 100)
+def utf8_decode_mostly_ascii(STR):
+    s = _get_utf8_corpus(STR, "mostly ascii")
+    s_decode = s.decode
+    for x in _RANGE_100:
+        s_decode("utf-8")
+
+@bench('latin1_heavy_64k.decode("utf-8")', "UTF-8 decoding", 100)
+def utf8_decode_latin1(STR):
+    s = _get_utf8_corpus(STR, "latin-1")
+    s_decode = s.decode
+    for x in _RANGE_100:
+        s_decode("utf-8")
+
+@bench('cjk_64k.decode("utf-8")', "UTF-8 decoding", 100)
+def utf8_decode_cjk(STR):
+    s = _get_utf8_corpus(STR, "cjk")
+    s_decode = s.decode
+    for x in _RANGE_100:
+        s_decode("utf-8")
+
+@bench('emoji_64k.decode("utf-8")', "UTF-8 decoding", 100)
+def utf8_decode_emoji(STR):
+    s = _get_utf8_corpus(STR, "emoji")
+    s_decode = s.decode
+    for x in _RANGE_100:
+        s_decode("utf-8")
+
+
 # end of benchmarks
 
 #################
@@ -0,0 +1,157 @@
+"""Benchmark unpacking and packing files of fixed-width binary records.
+
+Each format is a kind of record found in binary logs and sensor dumps.
+A file of random records of the given size is written, then read back in
+chunks of a whole number of records and unpacked:
+
+  iter_unpack   a tuple per record with Struct.iter_unpack()
+  transpose     the same, gathered into one list per field with zip()
+  columns       one column per field with Struct.unpack_columns()
+
+and the columns are packed back into records:
+
+  pack          Struct.pack() of each record, joined
+  pack_columns  Struct.pack_columns() of the columns
+
+Reports the best MB/s and million records/s of each.
+"""
+import argparse
+import os
+import random
+import struct
+import sys
+import tempfile
+import time
+
+
+FORMATS = {
+    # timestamp, event id, code, flags, two measurements
+    'event': '<QIHHdd',
+    # sensor id and three readings
+    'sensor': '<Ifff',
+    # timestamp, a fixed-width name and a count
+    'named': '<Q16sI',
+    # native layout with padding
+    'native': '@bqhd',
+}
+
+
+def make_record(rnd, fmt):
+    record = []
+    for code in fmt.lstrip('<>!=@'):
+        if code.isdigit():
+            continue
+        if code == 's':
+            record.append(b'name%d' % rnd.randrange(10 ** 6))
+        elif code in 'fd':
+            record.append(rnd.random() * 1000)
+        elif code in 'bhq':
+            size = struct.calcsize(fmt[0] + code)
+            record.append(rnd.randrange(-2 ** (size * 8 - 1),
+                                        2 ** (size * 8 - 1)))
+        else:
+            size = struct.calcsize(fmt[0] + code)
+            record.append(rnd.randrange(2 ** (size * 8)))
+    return record
+
+
+def write_file(path, s, fmt, size):
+    rnd = random.Random(0)
+    # Repeat a block of distinct records to fill the file quickly
+    block = b''.join(s.pack(*make_record(rnd, fmt)) for _ in range(10000))
+    with open(path, 'wb') as f:
+        for _ in range(max(1, size // len(block))):
+            f.write(block)
+
+
+def read_chunks(path, s, chunk_size):
+    chunk_size -= chunk_size % s.size
+    with open(path, 'rb') as f:
+        while True:
+            chunk = f.read(chunk_size)
+            if not chunk:
+                break
+            yield chunk
+
+
+def run_iter_unpack(path, s, chunk_size):
+    for chunk in read_chunks(path, s, chunk_size):
+        for record in s.iter_unpack(chunk):
+            pass
+
+
+def run_transpose(path, s, chunk_size):
+    for chunk in read_chunks(path, s, chunk_size):
+        columns = list(zip(*s.iter_unpack(chunk)))
+
+
+def run_columns(path, s, chunk_size):
+    for chunk in read_chunks(path, s, chunk_size):
+        columns = s.unpack_columns(chunk)
+
+
+def run_pack(s, records, columns):
+    b''.join([s.pack(*record) for record in records])
+
+
+def run_pack_columns(s, records, columns):
+    s.pack_columns(*columns)
+
+
+def best_time(func, *args, repeat):
+    best = float('inf')
+    for _ in range(repeat):
+        start = time.perf_counter()
+        func(*args)
+        best = min(best, time.perf_counter() - start)
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+            formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('-f', '--formats', nargs='+', choices=list(FORMATS),
+                        default=list(FORMATS), help='record formats to run')
+    parser.add_argument('-s', '--size', type=int, default=256,
+                        help='MB of records per file')
+    parser.add_argument('-c', '--chunk-size', type=int, default=1024,
+                        help='kB of records read at a time')
+    parser.add_argument('-p', '--pack-size', type=int, default=16,
+                        help='MB of records to pack')
+    parser.add_argument('-r', '--repeat', type=int, default=3,
+                        help='runs per benchmark, the best one is reported')
+    options = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        for name in options.formats:
+            fmt = FORMATS[name]
+            s = struct.Struct(fmt)
+            path = os.path.join(tmpdir, name)
+            write_file(path, s, fmt, options.size << 20)
+            size = os.path.getsize(path)
+            nrecords = size // s.size
+            print("{} ({!r}, {} bytes, {} records)".format(
+                name, fmt, s.size, nrecords))
+            for run in (run_iter_unpack, run_transpose, run_columns):
+                t = best_time(run, path, s, options.chunk_size << 10,
+                              repeat=options.repeat)
+                print("  {:<13} {:8.1f} MB/s {:8.2f} M records/s".format(
+                    run.__name__[4:], size / t / (1 << 20),
+                    nrecords / t / 1e6))
+
+            with open(path, 'rb') as f:
+                data = f.read(options.pack_size << 20)
+            data = data[:len(data) - len(data) % s.size]
+            records = list(s.iter_unpack(data))
+            columns = s.unpack_columns(data)
+            assert s.pack_columns(*columns) == data
+            for run in (run_pack, run_pack_columns):
+                t = best_time(run, s, records, columns,
+                              repeat=options.repeat)
+                print("  {:<13} {:8.1f} MB/s {:8.2f} M records/s".format(
+                    run.__name__[4:], len(data) / t / (1 << 20),
+                    len(records) / t / 1e6))
+
+
+if __name__ == '__main__':
+    main()
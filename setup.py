@@ -708,6 +708,9 @@ class PyBuildExt(build_ext):
         exts.append( Extension("_abc", ["_abc.c"]) )
         # _queue module
         exts.append( Extension("_queue", ["_queuemodule.c"]) )
+        # concurrent.futures speedups
+        exts.append( Extension("_concurrent_futures",
+                               ["_concurrent_futuresmodule.c"]) )
 
         # Modules with some UNIX dependencies -- on by default:
         # (If you have a really backward UNIX, select and socket may not be